@@ -0,0 +1,69 @@
+import ctypes, os
+
+# schnorr_verify and affine_decompress from src/crypto.c, through the host
+# build of the signing code (make -C host libcoda.so). CODA_LIBCODA overrides
+# the library path.
+
+field_bytes = 48
+scalar_bytes = 48
+
+lib_path = os.environ.get('CODA_LIBCODA',
+        os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'host', 'libcoda.so'))
+
+_lib = None
+
+def load():
+    global _lib
+    if _lib is None:
+        _lib = ctypes.CDLL(lib_path)
+        _lib.schnorr_verify.restype = ctypes.c_uint
+        _lib.schnorr_verify.argtypes = [ctypes.c_char_p] * 5
+        _lib.schnorr_batch_verify.restype = ctypes.c_uint
+        _lib.schnorr_batch_verify.argtypes = [ctypes.c_uint] + [ctypes.c_char_p] * 4
+        _lib.affine_decompress.restype = ctypes.c_uint
+        _lib.affine_decompress.argtypes = [ctypes.c_char_p] * 2
+    return _lib
+
+# whether libcoda.so is there to be loaded
+def available():
+    try:
+        load()
+    except OSError:
+        return False
+    return True
+
+# all arguments are big endian bytes, as sent to and returned by the device:
+# msgx and msgm are the two message fields of the sign apdu, pk = x || y
+# and sig = rx || s
+def schnorr_verify(msgx, msgm, pk, sig):
+    assert len(msgx) == scalar_bytes and len(msgm) == scalar_bytes
+    assert len(pk) == 2 * field_bytes
+    assert len(sig) == field_bytes + scalar_bytes
+    # affine is x || y with no padding, so pk can be passed as the struct
+    return load().schnorr_verify(bytes(sig[:field_bytes]), bytes(sig[field_bytes:]),
+            bytes(pk), bytes(msgx), bytes(msgm)) == 1
+
+# the same for many signatures at once, msgs a list of (msgx, msgm): one
+# multi scalar multiplication for the whole batch, bisected if it fails.
+# returns a list telling which signatures are valid
+def schnorr_batch_verify(msgs, pks, sigs):
+    n = len(msgs)
+    assert len(pks) == n and len(sigs) == n
+    for (msgx, msgm), pk, sig in zip(msgs, pks, sigs):
+        assert len(msgx) == scalar_bytes and len(msgm) == scalar_bytes
+        assert len(pk) == 2 * field_bytes
+        assert len(sig) == field_bytes + scalar_bytes
+    # arrays of message = x || m, affine = x || y, signature = rx || s
+    ok = ctypes.create_string_buffer(n)
+    load().schnorr_batch_verify(n, b''.join(bytes(x) + bytes(m) for x, m in msgs),
+            b''.join(bytes(pk) for pk in pks), b''.join(bytes(sig) for sig in sigs), ok)
+    return [b == 1 for b in ok.raw]
+
+# x || y from the compressed form the device sends, the parity of y then x,
+# or None if that is not a point
+def point_decompress(bs):
+    assert len(bs) == field_bytes + 1
+    pk = ctypes.create_string_buffer(2 * field_bytes)
+    if load().affine_decompress(pk, bytes(bs)) != 1:
+        return None
+    return pk.raw
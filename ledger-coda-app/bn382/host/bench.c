@@ -0,0 +1,301 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "os.h"
+#include "crypto.h"
+#include "poseidon.h"
+#include "curve_tables.h"
+
+/* Host benchmark for the signing path. Before timing anything it checks
+ * generate_pubkey and sign against a known answer computed with an
+ * independent python model of the scheme, so a broken backend can't
+ * produce good looking numbers.
+ *
+ *   ./bench        known answer test, then timings
+ *   ./bench -k     known answer test only
+ */
+
+// known answer, from the python model
+
+static const scalar kat_priv_key = {
+    0x1f, 0x0f, 0x4f, 0x0f, 0x8c, 0x2b, 0xbd, 0x80, 0x91, 0xe7, 0xa6, 0xd5,
+    0xf1, 0x93, 0x74, 0xa2, 0xd7, 0x0e, 0x33, 0x4f, 0x8c, 0x58, 0xca, 0x83,
+    0xa8, 0xa7, 0x65, 0x4c, 0xd5, 0x45, 0xb3, 0xcd, 0xc2, 0x64, 0xe9, 0x3a,
+    0xb0, 0x06, 0xef, 0x5b, 0x7c, 0x82, 0x11, 0xf0, 0x3f, 0x30, 0xb5, 0xb6};
+
+static const scalar kat_msgx = {
+    0x1d, 0xfe, 0xd1, 0x25, 0x90, 0xc9, 0x22, 0x36, 0x5f, 0xd7, 0x97, 0xb9,
+    0x27, 0x77, 0x0a, 0x6a, 0x85, 0xcc, 0x0b, 0x3d, 0x57, 0xdc, 0x1b, 0x17,
+    0x2b, 0xcc, 0xc7, 0xe9, 0xb1, 0xa9, 0x7c, 0x2e, 0x17, 0xed, 0x42, 0x75,
+    0xd1, 0x62, 0xc6, 0xf8, 0x6d, 0xaf, 0xed, 0xf4, 0xff, 0x21, 0x6c, 0x40};
+
+static const scalar kat_msgm = {
+    0x04, 0x42, 0xfa, 0xbf, 0x18, 0xdc, 0x2b, 0xd3, 0x1c, 0x73, 0x42, 0xa6,
+    0xdb, 0xa1, 0x64, 0xcb, 0xce, 0xd9, 0x94, 0x11, 0x3c, 0xe9, 0x54, 0x78,
+    0xa6, 0x36, 0x9d, 0x05, 0xb8, 0x92, 0x01, 0x13, 0xab, 0xf1, 0x91, 0xe9,
+    0x27, 0x9d, 0x3d, 0x5d, 0x9c, 0xb8, 0xc5, 0x37, 0x56, 0xf8, 0xda, 0x46};
+
+static const field kat_pub_x = {
+    0x14, 0xb3, 0x9c, 0xf1, 0x5d, 0x3a, 0xc8, 0x47, 0x0a, 0x19, 0x07, 0xb3,
+    0xe3, 0x0e, 0x86, 0xb4, 0x1f, 0xc2, 0x06, 0xd3, 0x58, 0x73, 0xa0, 0x78,
+    0x99, 0x7c, 0x74, 0x6f, 0x22, 0xd3, 0x32, 0xc0, 0x18, 0x07, 0xa6, 0x5a,
+    0x72, 0x60, 0x11, 0x41, 0x9f, 0x5e, 0x6b, 0xf2, 0xc6, 0xe5, 0xe6, 0x3e};
+
+static const field kat_pub_y = {
+    0x10, 0xb8, 0x71, 0xcd, 0xb8, 0x61, 0x37, 0xe3, 0x3a, 0x09, 0xd6, 0xe6,
+    0xab, 0x92, 0xb8, 0x11, 0xd4, 0x8b, 0x1c, 0xf7, 0xcd, 0xc9, 0xc7, 0x15,
+    0x27, 0x42, 0x43, 0x74, 0x4d, 0x1a, 0x38, 0x0c, 0x7a, 0x23, 0x50, 0xb3,
+    0xe9, 0xbd, 0xd6, 0xa2, 0xfa, 0x33, 0xe6, 0xb5, 0x2b, 0x63, 0xfd, 0x1f};
+
+static const field kat_rx = {
+    0x10, 0xac, 0x99, 0x32, 0xb3, 0x98, 0x77, 0x5d, 0x99, 0x1e, 0x2e, 0xa9,
+    0x5d, 0x66, 0x2a, 0x8f, 0x98, 0x84, 0x9e, 0xc1, 0x0f, 0xe9, 0x10, 0x5c,
+    0x51, 0x44, 0x24, 0xf5, 0x86, 0x31, 0x20, 0xb5, 0xdd, 0xaf, 0x61, 0x38,
+    0xd4, 0x87, 0xda, 0x16, 0xc1, 0xe7, 0x39, 0xe0, 0x39, 0x65, 0x9f, 0x96};
+
+static const scalar kat_s = {
+    0x06, 0xf5, 0xd0, 0xff, 0x0f, 0xd2, 0xde, 0x23, 0x86, 0x6d, 0x48, 0x41,
+    0x9f, 0x88, 0xe1, 0x26, 0xa0, 0x00, 0x3a, 0x88, 0x06, 0x79, 0xde, 0xc5,
+    0xc4, 0x59, 0xb1, 0xf5, 0x36, 0xec, 0xdd, 0x9d, 0x4c, 0x35, 0x81, 0xf4,
+    0x53, 0xca, 0x14, 0x8b, 0x48, 0x53, 0xda, 0x56, 0xad, 0x1b, 0x97, 0xb3};
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// runs stmt until at least 0.5s have passed and prints the time per call,
+// or per item for a stmt that handles items of them
+#define BENCH_N(name, items, stmt)                                             \
+  do {                                                                         \
+    unsigned long n = 0;                                                       \
+    double t0 = now(), t1;                                                     \
+    do {                                                                       \
+      stmt;                                                                    \
+      n++;                                                                     \
+    } while ((t1 = now()) - t0 < 0.5);                                         \
+    printf("%-24s %12.3f us\n", name, (t1 - t0) * 1e6 / (n * (items)));     \
+  } while (0)
+
+#define BENCH(name, stmt) BENCH_N(name, 1, stmt)
+
+// signatures of the kat key on batch_size variants of the kat message
+#define batch_size 64
+static message batch_msgs[batch_size];
+static affine batch_pks[batch_size];
+static signature batch_sigs[batch_size];
+
+static void batch_sign(const affine *pub_key) {
+  for (unsigned int i = 0; i < batch_size; i++) {
+    memcpy(batch_msgs[i].x, kat_msgx, scalar_bytes);
+    memcpy(batch_msgs[i].m, kat_msgm, scalar_bytes);
+    batch_msgs[i].m[scalar_bytes - 1] ^= i;
+    batch_pks[i] = *pub_key;
+    sign(batch_sigs[i].rx, batch_sigs[i].s, pub_key, kat_priv_key,
+         batch_msgs[i].x, batch_msgs[i].m);
+  }
+}
+
+static unsigned int check(const char *name, const unsigned char *got,
+                          const unsigned char *want) {
+  if (memcmp(got, want, field_bytes) != 0) {
+    printf("%s: mismatch\n", name);
+    return 0;
+  }
+  return 1;
+}
+
+static unsigned int known_answer(void) {
+  affine pub_key;
+  field rx;
+  scalar s;
+  unsigned int ok = 1;
+
+  if (!curve_tables_ok() || !poseidon_tables_ok()) {
+    printf("tables: checksum mismatch\n");
+    ok = 0;
+  }
+
+  generate_pubkey(&pub_key, kat_priv_key);
+  ok &= check("pub_key.x", pub_key.x, kat_pub_x);
+  ok &= check("pub_key.y", pub_key.y, kat_pub_y);
+
+  // the top scalar_offset bits of a key are not used, so setting them in the
+  // kat key, whose top bits are clear, gives the same public key
+  scalar high_key;
+  memcpy(high_key, kat_priv_key, scalar_bytes);
+  for (unsigned int i = 0; i < scalar_offset; i++) {
+    high_key[i / 8] |= 0x80 >> (i % 8);
+  }
+  generate_pubkey(&pub_key, high_key);
+  ok &= check("pub_key.x, top bits set", pub_key.x, kat_pub_x);
+  ok &= check("pub_key.y, top bits set", pub_key.y, kat_pub_y);
+  generate_pubkey(&pub_key, kat_priv_key);
+
+  sign(rx, s, &pub_key, kat_priv_key, kat_msgx, kat_msgm);
+  ok &= check("signature.rx", rx, kat_rx);
+  ok &= check("signature.s", s, kat_s);
+  if (!schnorr_verify(rx, s, &pub_key, kat_msgx, kat_msgm)) {
+    printf("schnorr_verify: rejected\n");
+    ok = 0;
+  }
+  s[scalar_bytes - 1] ^= 1;
+  if (schnorr_verify(rx, s, &pub_key, kat_msgx, kat_msgm)) {
+    printf("schnorr_verify: accepted a bad signature\n");
+    ok = 0;
+  }
+
+  // a batch with two bad signatures, which the bisection has to find
+  unsigned char valid[batch_size];
+  batch_sign(&pub_key);
+  batch_sigs[3].s[scalar_bytes - 1] ^= 1;
+  batch_msgs[40].x[scalar_bytes - 1] ^= 1;
+  schnorr_batch_verify(batch_size, batch_msgs, batch_pks, batch_sigs, valid);
+  for (unsigned int i = 0; i < batch_size; i++) {
+    if (valid[i] != (i != 3 && i != 40)) {
+      printf("schnorr_batch_verify: wrong answer for %u\n", i);
+      ok = 0;
+    }
+  }
+
+  // both parities, the key and its negation, through the compressed form
+  unsigned char packed[compressed_bytes];
+  affine q;
+  for (unsigned int neg = 0; neg < 2; neg++) {
+    affine_compress(packed, &pub_key);
+    if (!affine_decompress(&q, packed)) {
+      printf("affine_decompress: rejected a point\n");
+      ok = 0;
+    }
+    ok &= check("affine_decompress", q.y, pub_key.y);
+    fe_begin();
+    fe y = fe_new();
+    fe_from_bytes(y, pub_key.y);
+    fe_neg(y, y);
+    fe_to_bytes(pub_key.y, y);
+    fe_end();
+  }
+  packed[0] = 0x04;
+  if (affine_decompress(&q, packed)) {
+    printf("affine_decompress: accepted a bad prefix\n");
+    ok = 0;
+  }
+
+  // the sponge, fed in one go, against the fixed arity calls
+  scalar in[4], d0, d1;
+  state st;
+  poseidon_sponge sp;
+  memcpy(in[0], kat_msgx, scalar_bytes);
+  memcpy(in[1], pub_key.x, scalar_bytes);
+  memcpy(in[2], pub_key.y, scalar_bytes);
+  memcpy(in[3], kat_msgm, scalar_bytes);
+  memset(st, 0, sizeof(st));
+  poseidon_init(&sp, st);
+  poseidon_2in(st, in[0], in[1]);
+  poseidon_2in(st, in[2], in[3]);
+  poseidon_digest(st, d0);
+  poseidon_absorb_many(&sp, (const scalar *)in, 4);
+  poseidon_squeeze(&sp, d1);
+  ok &= check("poseidon_absorb_many", d1, d0);
+
+  // the lanes against the sponge, messages of 2 and 5 elements out of the
+  // batch, with a partly filled last group for the odd length
+  static scalar digests[batch_size];
+  const scalar *elems = (const scalar *)batch_msgs;
+  for (unsigned int len = 2; len <= 5; len += 3) {
+    unsigned int n = 2 * batch_size / len;
+    poseidon_xN(digests, st, elems, len, n);
+    for (unsigned int k = 0; k < n; k++) {
+      poseidon_init(&sp, st);
+      poseidon_absorb_many(&sp, elems + k * len, len);
+      poseidon_squeeze(&sp, d0);
+      ok &= check("poseidon_xN", digests[k], d0);
+    }
+  }
+
+  fe_begin();
+  group r, g;
+  group_new(&r);
+  group_new(&g);
+  group_load(&g, &group_one);
+  group_scalar_mul(&r, kat_priv_key, &g);
+  projective_to_affine(&pub_key, &r);
+  ok &= check("group_scalar_mul", pub_key.x, kat_pub_x);
+  ok &= check("group_scalar_mul", pub_key.y, kat_pub_y);
+  group_scalar_mul_ladder(&r, kat_priv_key, &g);
+  projective_to_affine(&pub_key, &r);
+  ok &= check("group_scalar_mul_ladder", pub_key.x, kat_pub_x);
+  group_scalar_mul_madd(&r, kat_priv_key, &g);
+  projective_to_affine(&pub_key, &r);
+  ok &= check("group_scalar_mul_madd", pub_key.x, kat_pub_x);
+  group_scalar_mul_wnaf(&r, kat_priv_key, &g);
+  projective_to_affine(&pub_key, &r);
+  ok &= check("group_scalar_mul_wnaf", pub_key.x, kat_pub_x);
+  ok &= check("group_scalar_mul_wnaf", pub_key.y, kat_pub_y);
+  fe_end();
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  if (!known_answer()) {
+    printf("known answer test FAILED\n");
+    return 1;
+  }
+  printf("known answer test ok\n");
+  if (argc > 1 && strcmp(argv[1], "-k") == 0) {
+    return 0;
+  }
+
+  state st;
+  affine pub_key;
+  field rx;
+  scalar s;
+  memset(st, 0, sizeof(st));
+  generate_pubkey(&pub_key, kat_priv_key);
+
+  fe_begin();
+  fe a = fe_new(), b = fe_new();
+  fe_from_bytes(a, kat_msgx);
+  fe_from_bytes(b, kat_msgm);
+  BENCH("fe_mul", fe_mul(a, a, b));
+  BENCH("fe_inv", fe_inv(a, a));
+  fe_end();
+
+  fe_begin();
+  group r, g;
+  group_new(&r);
+  group_new(&g);
+  group_load(&g, &group_one);
+  BENCH("group_scalar_mul", group_scalar_mul(&r, kat_priv_key, &g));
+  BENCH("group_scalar_mul_ladder",
+        group_scalar_mul_ladder(&r, kat_priv_key, &g));
+  BENCH("group_scalar_mul_madd", group_scalar_mul_madd(&r, kat_priv_key, &g));
+  BENCH("group_scalar_mul_wnaf", group_scalar_mul_wnaf(&r, kat_priv_key, &g));
+  fe_end();
+  BENCH("poseidon_2in", poseidon_2in(st, kat_msgx, kat_msgm));
+  poseidon_sponge sp;
+  poseidon_init(&sp, st);
+  BENCH("poseidon_absorb", poseidon_absorb(&sp, kat_msgx));
+  BENCH("generate_pubkey", generate_pubkey(&pub_key, kat_priv_key));
+  unsigned char packed[compressed_bytes];
+  affine q;
+  affine_compress(packed, &pub_key);
+  BENCH("affine_decompress", affine_decompress(&q, packed));
+  BENCH("sign", sign(rx, s, &pub_key, kat_priv_key, kat_msgx, kat_msgm));
+  BENCH("schnorr_verify",
+        schnorr_verify(rx, s, &pub_key, kat_msgx, kat_msgm));
+
+  unsigned char valid[batch_size];
+  batch_sign(&pub_key);
+  BENCH_N("schnorr_batch_verify/64", batch_size,
+          schnorr_batch_verify(batch_size, batch_msgs, batch_pks, batch_sigs,
+                               valid));
+
+  // the 2 element sponge of poseidon_2in, over the batch messages
+  static scalar digests[batch_size];
+  BENCH_N("poseidon_xN/64", batch_size,
+          poseidon_xN(digests, st, (const scalar *)batch_msgs, 2,
+                      batch_size));
+  return 0;
+}
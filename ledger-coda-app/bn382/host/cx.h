@@ -0,0 +1,9 @@
+#ifndef CODA_HOST_CX
+#define CODA_HOST_CX
+
+/* Stand-in for the BOLOS cx.h when building the crypto code on a host.
+ * The field and scalar arithmetic is provided by host/field.c instead of
+ * the cx_math_* calls, and key derivation is not available.
+ */
+
+#endif // CODA_HOST_CX
@@ -0,0 +1,313 @@
+#include <stdint.h>
+#include "os.h"
+#include "crypto.h"
+
+/* Host implementation of the field and scalar arithmetic that crypto.c
+ * otherwise gets from the cx_math_* calls of the crypto coprocessor.
+ * Elements are held in 64-bit limbs (least significant first) and
+ * multiplied with montgomery's CIOS method, so the rest of the code
+ * (group law, poseidon, schnorr) can be run and timed off-device.
+ *
+ * Field elements (fe) are slots of a static pool, handed out and given
+ * back in stack order like the coprocessor slots of the device backend,
+ * and stay in montgomery form, R = 2^(64 * field_limbs), from
+ * fe_from_bytes to fe_to_bytes. Scalars only see a handful of operations
+ * per signature and keep the byte interface.
+ */
+
+typedef unsigned __int128 uint128_t;
+
+typedef struct mont {
+  uint64_t m[field_limbs];   // modulus
+  uint64_t r2[field_limbs];  // R^2 mod m, R = 2^(64 * field_limbs)
+  uint64_t n0;               // -1/m mod 2^64
+} mont;
+
+// BN382_p
+static const mont fp = {
+    {0x0000000000000001, 0x00000001800c1818, 0x2012246d22424120,
+     0xb48a3614289b0901, 0x71503c69b09dbf88, 0x2404893fdad8878e},
+    {0xaa7b14a53b610887, 0xb22034140d119ca9, 0x0e10d2796937ba75,
+     0xe52454bf8b810402, 0x1b4eec3d89fc0fd3, 0x0bc857aea27171f7},
+    0xffffffffffffffff};
+
+// BN382_q
+static const mont fq = {
+    {0x0000000000000001, 0x00000001800c1818, 0x8018309183030180,
+     0xb48a3614289b0901, 0x71503c69b09dbf88, 0x2404893fdad8878e},
+    {0xc79c121e98884701, 0xfd75271b6a2e235d, 0x01530439e68fe657,
+     0x0f6b7a72ebfbdbfb, 0x50c6c2ce8f44951b, 0x17fe189b54066561},
+    0xffffffffffffffff};
+
+static const uint64_t limbs_one[field_limbs] = {1};
+
+// big endian bytes -> limbs
+static void load(uint64_t r[field_limbs], const unsigned char *a) {
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    const unsigned char *b = a + field_bytes - 8 * (i + 1);
+    uint64_t w = 0;
+    for (unsigned int j = 0; j < 8; j++) {
+      w = (w << 8) | b[j];
+    }
+    r[i] = w;
+  }
+}
+
+// limbs -> big endian bytes
+static void store(unsigned char *r, const uint64_t a[field_limbs]) {
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    unsigned char *b = r + field_bytes - 8 * (i + 1);
+    uint64_t w = a[i];
+    for (int j = 7; j >= 0; j--) {
+      b[j] = w & 0xff;
+      w >>= 8;
+    }
+  }
+}
+
+static uint64_t add_n(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                      const uint64_t b[field_limbs]) {
+  uint128_t t = 0;
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    t += (uint128_t)a[i] + b[i];
+    c[i] = (uint64_t)t;
+    t >>= 64;
+  }
+  return (uint64_t)t;
+}
+
+static uint64_t sub_n(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                      const uint64_t b[field_limbs]) {
+  uint64_t borrow = 0;
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    uint128_t t = (uint128_t)a[i] - b[i] - borrow;
+    c[i] = (uint64_t)t;
+    borrow = (uint64_t)(t >> 64) & 1;
+  }
+  return borrow;
+}
+
+static unsigned int geq_n(const uint64_t a[field_limbs],
+                          const uint64_t b[field_limbs]) {
+  for (int i = field_limbs - 1; i >= 0; i--) {
+    if (a[i] != b[i]) {
+      return a[i] > b[i];
+    }
+  }
+  return 1;
+}
+
+// inputs are not always reduced (e.g. a scalar fed to poseidon), so bring
+// anything below 2^(64 * field_limbs) into [0, m)
+static void reduce(uint64_t a[field_limbs], const mont *m) {
+  while (geq_n(a, m->m)) {
+    sub_n(a, a, m->m);
+  }
+}
+
+static void mont_add(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const uint64_t b[field_limbs], const mont *m) {
+  uint64_t carry = add_n(c, a, b);
+  if (carry || geq_n(c, m->m)) {
+    sub_n(c, c, m->m);
+  }
+}
+
+static void mont_sub(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const uint64_t b[field_limbs], const mont *m) {
+  if (sub_n(c, a, b)) {
+    add_n(c, c, m->m);
+  }
+}
+
+// c = a * b / R mod m (CIOS), a and b reduced
+static void mont_mul(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const uint64_t b[field_limbs], const mont *m) {
+  uint64_t t[field_limbs + 2] = {0};
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    uint128_t uv = 0;
+    for (unsigned int j = 0; j < field_limbs; j++) {
+      uv = (uint128_t)a[j] * b[i] + t[j] + (uint64_t)(uv >> 64);
+      t[j] = (uint64_t)uv;
+    }
+    uv = (uint128_t)t[field_limbs] + (uint64_t)(uv >> 64);
+    t[field_limbs] = (uint64_t)uv;
+    t[field_limbs + 1] = (uint64_t)(uv >> 64);
+
+    uint64_t q = t[0] * m->n0;
+    uv = (uint128_t)q * m->m[0] + t[0];
+    for (unsigned int j = 1; j < field_limbs; j++) {
+      uv = (uint128_t)q * m->m[j] + t[j] + (uint64_t)(uv >> 64);
+      t[j - 1] = (uint64_t)uv;
+    }
+    uv = (uint128_t)t[field_limbs] + (uint64_t)(uv >> 64);
+    t[field_limbs - 1] = (uint64_t)uv;
+    t[field_limbs] = t[field_limbs + 1] + (uint64_t)(uv >> 64);
+  }
+  if (t[field_limbs] || geq_n(t, m->m)) {
+    sub_n(t, t, m->m);
+  }
+  os_memcpy(c, t, field_limbs * sizeof(uint64_t));
+}
+
+// c = a^e, a in montgomery form, e given as len big endian bytes
+static void mont_pow(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const unsigned char *e, unsigned int len, const mont *m) {
+  uint64_t r[field_limbs], b[field_limbs];
+  os_memcpy(b, a, sizeof(b));
+  mont_mul(r, limbs_one, m->r2, m); // R mod m
+  for (unsigned int i = 0; i < 8 * len; i++) {
+    mont_mul(r, r, r, m);
+    if (e[i / 8] & (0x80 >> (i % 8))) {
+      mont_mul(r, r, b, m);
+    }
+  }
+  os_memcpy(c, r, sizeof(r));
+}
+
+// c = a^(m - 2) = 1/a by fermat, a in montgomery form
+static void mont_inv(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const mont *m) {
+  uint64_t e[field_limbs];
+  unsigned char eb[field_bytes];
+  const uint64_t two[field_limbs] = {2};
+  sub_n(e, m->m, two);
+  store(eb, e);
+  mont_pow(c, a, eb, field_bytes, m);
+}
+
+static void mod_add(unsigned char *c, const unsigned char *a,
+                    const unsigned char *b, const mont *m) {
+  uint64_t x[field_limbs], y[field_limbs];
+  load(x, a);
+  load(y, b);
+  reduce(x, m);
+  reduce(y, m);
+  mont_add(x, x, y, m);
+  store(c, x);
+}
+
+static void mod_sub(unsigned char *c, const unsigned char *a,
+                    const unsigned char *b, const mont *m) {
+  uint64_t x[field_limbs], y[field_limbs];
+  load(x, a);
+  load(y, b);
+  reduce(x, m);
+  reduce(y, m);
+  mont_sub(x, x, y, m);
+  store(c, x);
+}
+
+// a * b / R, then * R^2 / R to land back on a * b
+static void mod_mul(unsigned char *c, const unsigned char *a,
+                    const unsigned char *b, const mont *m) {
+  uint64_t x[field_limbs], y[field_limbs];
+  load(x, a);
+  load(y, b);
+  reduce(x, m);
+  reduce(y, m);
+  mont_mul(x, x, y, m);
+  mont_mul(x, x, m->r2, m);
+  store(c, x);
+}
+
+static void mod_pow(unsigned char *c, const unsigned char *a,
+                    const unsigned char *e, unsigned int len, const mont *m) {
+  uint64_t x[field_limbs];
+  load(x, a);
+  reduce(x, m);
+  mont_mul(x, x, m->r2, m);
+  mont_pow(x, x, e, len, m);
+  mont_mul(x, x, limbs_one, m);
+  store(c, x);
+}
+
+static uint64_t pool[fe_slots][field_limbs];
+static unsigned int top;
+static unsigned int depth;
+
+void fe_begin(void) {
+  if (depth++ == 0) {
+    top = 0;
+  }
+}
+
+void fe_end(void) { depth--; }
+
+void fe_reset(void) { depth = 0; }
+
+fe fe_new(void) {
+  if (top == fe_slots) {
+    THROW(EXCEPTION_OVERFLOW);
+  }
+  return pool[top++];
+}
+
+unsigned int fe_mark(void) { return top; }
+
+void fe_release(unsigned int mark) { top = mark; }
+
+void fe_load(fe r, const fe_packed a) { os_memcpy(r, a, sizeof(fe_packed)); }
+
+void fe_store(fe_packed r, const fe a) { os_memcpy(r, a, sizeof(fe_packed)); }
+
+void fe_from_bytes(fe r, const field a) {
+  load(r, a);
+  reduce(r, &fp);
+  mont_mul(r, r, fp.r2, &fp);
+}
+
+void fe_to_bytes(field r, const fe a) {
+  uint64_t x[field_limbs];
+  mont_mul(x, a, limbs_one, &fp);
+  store(r, x);
+}
+
+void fe_copy(fe r, const fe a) { os_memcpy(r, a, sizeof(fe_packed)); }
+
+// montgomery form is unique for reduced elements
+unsigned int fe_eq(const fe a, const fe b) {
+  return (os_memcmp(a, b, sizeof(fe_packed)) == 0);
+}
+
+unsigned int fe_is_zero(const fe a) {
+  const fe_packed zero = {0};
+  return (os_memcmp(a, zero, sizeof(fe_packed)) == 0);
+}
+
+void fe_add(fe c, const fe a, const fe b) { mont_add(c, a, b, &fp); }
+
+void fe_sub(fe c, const fe a, const fe b) { mont_sub(c, a, b, &fp); }
+
+void fe_neg(fe c, const fe a) {
+  const fe_packed zero = {0};
+  mont_sub(c, zero, a, &fp);
+}
+
+void fe_mul(fe c, const fe a, const fe b) { mont_mul(c, a, b, &fp); }
+
+void fe_sq(fe c, const fe a) { mont_mul(c, a, a, &fp); }
+
+void fe_inv(fe c, const fe a) { mont_inv(c, a, &fp); }
+
+void fe_pow(fe c, const fe a, const unsigned char *e, unsigned int len_e) {
+  mont_pow(c, a, e, len_e, &fp);
+}
+
+void scalar_add(scalar c, const scalar a, const scalar b) {
+  mod_add(c, a, b, &fq);
+}
+
+void scalar_sub(scalar c, const scalar a, const scalar b) {
+  mod_sub(c, a, b, &fq);
+}
+
+void scalar_mul(scalar c, const scalar a, const scalar b) {
+  mod_mul(c, a, b, &fq);
+}
+
+void scalar_sq(scalar c, const scalar a) { mod_mul(c, a, a, &fq); }
+
+void scalar_pow(scalar c, const scalar a, const scalar e) {
+  mod_pow(c, a, e, 1, &fq);
+}
@@ -0,0 +1,20 @@
+#ifndef CODA_HOST_OS
+#define CODA_HOST_OS
+
+/* Stand-in for the BOLOS os.h when building the crypto code on a host,
+ * see host/Makefile. Only what crypto.c and poseidon.c use is provided.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define os_memcpy memcpy
+#define os_memmove memmove
+#define os_memset memset
+#define os_memcmp memcmp
+
+#define THROW(x) abort()
+#define PRINTF(...) fprintf(stderr, __VA_ARGS__)
+
+#endif // CODA_HOST_OS
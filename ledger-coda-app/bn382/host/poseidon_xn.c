@@ -0,0 +1,396 @@
+#include <stdint.h>
+#include "os.h"
+#include "crypto.h"
+#include "poseidon.h"
+#include "poseidon_tables.h"
+
+/* Bulk poseidon for the host, to rehash many payloads at once (an indexer
+ * matching device signatures against the chain). poseidon_xN runs eight
+ * sponges in lock step, one per 64-bit lane of the avx-512 registers, with
+ * the field multiplication done by the 52-bit multiply-adds of IFMA.
+ *
+ * In the lanes elements are held in 52-bit limbs, montgomery form with
+ * R' = 2^(52 * lane_limbs) instead of the R of field.c, so the keys and
+ * matrices of poseidon_tables.h are converted once, on first use. The
+ * permutation is the one of poseidon.c, sparse partial rounds included,
+ * and the digests are those of the sponge API. Without IFMA (older cpus,
+ * other architectures) poseidon_xN hashes one message at a time through
+ * the sponge.
+ */
+
+#define lanes 8
+#define lane_limbs ((8 * field_bytes + 51) / 52)
+#define limb_mask ((1ULL << 52) - 1)
+
+static void hash_one(scalar out, const state init, const scalar *in,
+                     unsigned int len) {
+  poseidon_sponge sp;
+  poseidon_init(&sp, init);
+  poseidon_absorb_many(&sp, in, len);
+  poseidon_squeeze(&sp, out);
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+
+#define ifma __attribute__((target("avx512f,avx512ifma")))
+
+// big endian bytes -> 52-bit limbs, least significant first
+static void to_limbs(uint64_t r[lane_limbs], const unsigned char *a) {
+  os_memset(r, 0, lane_limbs * sizeof(uint64_t));
+  for (unsigned int k = 0; k < field_bytes; k++) {
+    uint64_t b = a[field_bytes - 1 - k];
+    unsigned int limb = 8 * k / 52, off = 8 * k % 52;
+    r[limb] |= (b << off) & limb_mask;
+    if (off > 44) {
+      r[limb + 1] |= b >> (52 - off);
+    }
+  }
+}
+
+// 52-bit limbs -> big endian bytes, a below 2^(8 * field_bytes)
+static void from_limbs(unsigned char *r, const uint64_t a[lane_limbs]) {
+  for (unsigned int k = 0; k < field_bytes; k++) {
+    unsigned int limb = 8 * k / 52, off = 8 * k % 52;
+    uint64_t b = a[limb] >> off;
+    if (off > 44 && limb + 1 < lane_limbs) {
+      b |= a[limb + 1] << (52 - off);
+    }
+    r[field_bytes - 1 - k] = b & 0xff;
+  }
+}
+
+typedef struct {
+  __m512i l[lane_limbs];
+} lfe; // one field element per lane
+
+typedef uint64_t lconst[lane_limbs]; // the same element in every lane
+
+static struct {
+  unsigned int ready;
+  lconst p, r2, one;  // modulus, R'^2 mod p and 1, plain
+  uint64_t n0;        // -1/p mod 2^52
+  lconst full_keys[full_rounds][sponge_size];
+  lconst partial_keys[partial_rounds];
+  lconst u[sponge_size][sponge_size], l[sponge_size][sponge_size];
+  lconst pre[sponge_size - 1][sponge_size - 1];
+  lconst sparse[partial_rounds][2 * sponge_size - 1];
+} lt;
+
+ifma static inline void lfe_bcast(lfe *r, const lconst a) {
+  for (unsigned int j = 0; j < lane_limbs; j++) {
+    r->l[j] = _mm512_set1_epi64(a[j]);
+  }
+}
+
+// r = r - p in the lanes where r >= p, limbs normalized
+ifma static inline void lfe_reduce(lfe *r) {
+  const __m512i mask = _mm512_set1_epi64(limb_mask);
+  __m512i d[lane_limbs], borrow = _mm512_setzero_si512();
+  for (unsigned int j = 0; j < lane_limbs; j++) {
+    d[j] = _mm512_sub_epi64(r->l[j], _mm512_set1_epi64(lt.p[j]));
+    d[j] = _mm512_sub_epi64(d[j], borrow);
+    borrow = _mm512_srli_epi64(d[j], 63);
+    d[j] = _mm512_and_si512(d[j], mask);
+  }
+  __mmask8 ge = _mm512_cmpeq_epi64_mask(borrow, _mm512_setzero_si512());
+  for (unsigned int j = 0; j < lane_limbs; j++) {
+    r->l[j] = _mm512_mask_blend_epi64(ge, r->l[j], d[j]);
+  }
+}
+
+ifma static inline void lfe_add(lfe *r, const lfe *a, const lfe *b) {
+  const __m512i mask = _mm512_set1_epi64(limb_mask);
+  __m512i carry = _mm512_setzero_si512();
+  for (unsigned int j = 0; j < lane_limbs; j++) {
+    __m512i t = _mm512_add_epi64(_mm512_add_epi64(a->l[j], b->l[j]), carry);
+    carry = _mm512_srli_epi64(t, 52);
+    r->l[j] = _mm512_and_si512(t, mask);
+  }
+  lfe_reduce(r);
+}
+
+// r = a * b / R' mod p, operand scanning montgomery. the columns are not
+// normalized until the end: each gets at most four 52-bit terms per outer
+// step, which a 64-bit lane holds for every limb count used here
+ifma static void lfe_mul(lfe *r, const lfe *a, const lfe *b) {
+  const __m512i mask = _mm512_set1_epi64(limb_mask);
+  const __m512i n0 = _mm512_set1_epi64(lt.n0);
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i t[lane_limbs + 1];
+  for (unsigned int j = 0; j <= lane_limbs; j++) {
+    t[j] = zero;
+  }
+  for (unsigned int i = 0; i < lane_limbs; i++) {
+    for (unsigned int j = 0; j < lane_limbs; j++) {
+      t[j] = _mm512_madd52lo_epu64(t[j], a->l[j], b->l[i]);
+      t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a->l[j], b->l[i]);
+    }
+    __m512i q = _mm512_madd52lo_epu64(zero, t[0], n0);
+    for (unsigned int j = 0; j < lane_limbs; j++) {
+      __m512i m = _mm512_set1_epi64(lt.p[j]);
+      t[j] = _mm512_madd52lo_epu64(t[j], q, m);
+      t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], q, m);
+    }
+    t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+    for (unsigned int j = 0; j < lane_limbs; j++) {
+      t[j] = t[j + 1];
+    }
+    t[lane_limbs] = zero;
+  }
+  __m512i carry = zero;
+  for (unsigned int j = 0; j < lane_limbs; j++) {
+    t[j] = _mm512_add_epi64(t[j], carry);
+    carry = _mm512_srli_epi64(t[j], 52);
+    r->l[j] = _mm512_and_si512(t[j], mask);
+  }
+  lfe_reduce(r);
+}
+
+ifma static inline void lfe_mulc(lfe *r, const lfe *a, const lconst c) {
+  lfe t;
+  lfe_bcast(&t, c);
+  lfe_mul(r, a, &t);
+}
+
+ifma static inline void lfe_addc(lfe *r, const lfe *a, const lconst c) {
+  lfe t;
+  lfe_bcast(&t, c);
+  lfe_add(r, a, &t);
+}
+
+// lanes k of r <- x[k], canonical or not, times R'
+ifma static void lfe_from_bytes(lfe *r, const unsigned char *const *x) {
+  uint64_t v[lanes][lane_limbs], col[lanes];
+  for (unsigned int k = 0; k < lanes; k++) {
+    if (x[k] != NULL) {
+      to_limbs(v[k], x[k]);
+    } else {
+      os_memset(v[k], 0, sizeof(v[k]));
+    }
+  }
+  for (unsigned int j = 0; j < lane_limbs; j++) {
+    for (unsigned int k = 0; k < lanes; k++) {
+      col[k] = v[k][j];
+    }
+    r->l[j] = _mm512_loadu_si512(col);
+  }
+  lfe_mulc(r, r, lt.r2);
+}
+
+ifma static void lfe_to_bytes(unsigned char *const *x, const lfe *a) {
+  uint64_t v[lanes][lane_limbs], col[lanes];
+  lfe t;
+  lfe_mulc(&t, a, lt.one);
+  for (unsigned int j = 0; j < lane_limbs; j++) {
+    _mm512_storeu_si512(col, t.l[j]);
+    for (unsigned int k = 0; k < lanes; k++) {
+      v[k][j] = col[k];
+    }
+  }
+  for (unsigned int k = 0; k < lanes; k++) {
+    if (x[k] != NULL) {
+      from_limbs(x[k], v[k]);
+    }
+  }
+}
+
+// a packed element of field.c, x R, to x R' for the lanes
+ifma static void convert(lconst r, const fe_packed a) {
+  field x;
+  const unsigned char *in[lanes] = {x};
+  uint64_t col[lanes];
+  lfe t;
+  fe_to_bytes(x, (fe)a);
+  lfe_from_bytes(&t, in);
+  for (unsigned int j = 0; j < lane_limbs; j++) {
+    _mm512_storeu_si512(col, t.l[j]);
+    r[j] = col[0];
+  }
+}
+
+ifma static void lanes_init(void) {
+  unsigned char e[2] = {(2 * 52 * lane_limbs) >> 8,
+                        (2 * 52 * lane_limbs) & 0xff};
+  field x;
+  os_memset(x, 0, field_bytes);
+
+  // p = (p - 1) + 1 and R'^2 = 2^(2 * 52 * lane_limbs), through field.c
+  fe_begin();
+  fe a = fe_new(), b = fe_new();
+  x[field_bytes - 1] = 1;
+  fe_from_bytes(a, x);
+  fe_neg(b, a);
+  fe_to_bytes(x, b);
+  to_limbs(lt.p, x);
+  for (unsigned int j = 0; ++lt.p[j] >> 52; j++) {
+    lt.p[j] &= limb_mask;
+  }
+  os_memset(x, 0, field_bytes);
+  x[field_bytes - 1] = 2;
+  fe_from_bytes(a, x);
+  fe_pow(b, a, e, sizeof(e));
+  fe_to_bytes(x, b);
+  to_limbs(lt.r2, x);
+  fe_end();
+
+  os_memset(lt.one, 0, sizeof(lt.one));
+  lt.one[0] = 1;
+  uint64_t inv = 1; // 1/p mod 2^64 by newton, p odd
+  for (unsigned int i = 0; i < 6; i++) {
+    inv *= 2 - (lt.p[0] | lt.p[1] << 52) * inv;
+  }
+  lt.n0 = -inv & limb_mask;
+
+  for (unsigned int r = 0; r < full_rounds; r++) {
+    for (unsigned int i = 0; i < sponge_size; i++) {
+      convert(lt.full_keys[r][i], full_round_keys[r][i]);
+    }
+  }
+  for (unsigned int r = 0; r < partial_rounds; r++) {
+    convert(lt.partial_keys[r], partial_round_keys[r]);
+    for (unsigned int i = 0; i < 2 * sponge_size - 1; i++) {
+      convert(lt.sparse[r][i], MDS_sparse[r][i]);
+    }
+  }
+  for (unsigned int i = 0; i < sponge_size; i++) {
+    for (unsigned int j = 0; j < sponge_size; j++) {
+      convert(lt.u[i][j], MDS_U[i][j]);
+      convert(lt.l[i][j], MDS_L[i][j]);
+      if (i < sponge_size - 1 && j < sponge_size - 1) {
+        convert(lt.pre[i][j], MDS_pre[i][j]);
+      }
+    }
+  }
+  lt.ready = 1;
+}
+
+// x^17 = (((x^2)^2)^2)^2 x, as to_the_alpha
+ifma static inline void lfe_alpha(lfe *x) {
+  lfe t;
+  lfe_mul(&t, x, x);
+  lfe_mul(&t, &t, &t);
+  lfe_mul(&t, &t, &t);
+  lfe_mul(&t, &t, &t);
+  lfe_mul(x, &t, x);
+}
+
+// s = m s for a triangular m, the zeros skipped
+ifma static void lfe_matrix(lfe s[sponge_size],
+                            const lconst m[sponge_size][sponge_size],
+                            unsigned int upper) {
+  lfe r[sponge_size], t;
+  for (unsigned int i = 0; i < sponge_size; i++) {
+    unsigned int lo = upper ? i : 0, hi = upper ? sponge_size - 1 : i;
+    lfe_mulc(&r[i], &s[lo], m[i][lo]);
+    for (unsigned int j = lo + 1; j <= hi; j++) {
+      lfe_mulc(&t, &s[j], m[i][j]);
+      lfe_add(&r[i], &r[i], &t);
+    }
+  }
+  os_memcpy(s, r, sizeof(r));
+}
+
+ifma static void lfe_full_round(lfe s[sponge_size], unsigned int r) {
+  for (unsigned int i = 0; i < sponge_size; i++) {
+    lfe_addc(&s[i], &s[i], lt.full_keys[r][i]);
+    lfe_alpha(&s[i]);
+  }
+  lfe_matrix(s, lt.u, 1);
+  lfe_matrix(s, lt.l, 0);
+}
+
+ifma static void lfe_poseidon(lfe s[sponge_size]) {
+  lfe t0, t1;
+  for (unsigned int r = 0; r < full_rounds / 2; r++) {
+    lfe_full_round(s, r);
+  }
+
+  lfe_mulc(&t0, &s[1], lt.pre[0][0]);
+  lfe_mulc(&t1, &s[2], lt.pre[0][1]);
+  lfe_add(&t0, &t0, &t1);
+  lfe_mulc(&t1, &s[1], lt.pre[1][0]);
+  lfe_mulc(&s[2], &s[2], lt.pre[1][1]);
+  lfe_add(&s[2], &s[2], &t1);
+  s[1] = t0;
+  for (unsigned int r = 0; r < partial_rounds; r++) {
+    const lconst *m = lt.sparse[r];
+    lfe_addc(&s[0], &s[0], lt.partial_keys[r]);
+    lfe_alpha(&s[0]);
+    lfe_mulc(&t0, &s[0], m[0]);
+    lfe_mulc(&t1, &s[1], m[1]);
+    lfe_add(&t0, &t0, &t1);
+    lfe_mulc(&t1, &s[2], m[2]);
+    lfe_add(&t0, &t0, &t1);
+    lfe_mulc(&t1, &s[0], m[3]);
+    lfe_add(&s[1], &s[1], &t1);
+    lfe_mulc(&t1, &s[0], m[4]);
+    lfe_add(&s[2], &s[2], &t1);
+    s[0] = t0;
+  }
+
+  for (unsigned int r = full_rounds / 2; r < full_rounds; r++) {
+    lfe_full_round(s, r);
+  }
+}
+
+// up to eight messages, the lanes without one run on zeros
+ifma static void hash_lanes(scalar *out, const lconst init[sponge_size],
+                            const scalar *in, unsigned int len,
+                            unsigned int n) {
+  lfe s[sponge_size], x;
+  const unsigned char *src[lanes];
+  unsigned char *dst[lanes];
+  for (unsigned int i = 0; i < sponge_size; i++) {
+    lfe_bcast(&s[i], init[i]);
+  }
+  for (unsigned int e = 0; e < len; e += sponge_rate) {
+    for (unsigned int i = 0; i < sponge_rate && e + i < len; i++) {
+      for (unsigned int k = 0; k < lanes; k++) {
+        src[k] = k < n ? in[k * len + e + i] : NULL;
+      }
+      lfe_from_bytes(&x, src);
+      lfe_add(&s[i], &s[i], &x);
+    }
+    lfe_poseidon(s);
+  }
+  for (unsigned int k = 0; k < lanes; k++) {
+    dst[k] = k < n ? out[k] : NULL;
+  }
+  lfe_to_bytes(dst, &s[0]);
+}
+
+ifma static void hash_ifma(scalar *out, const state init, const scalar *in,
+                           unsigned int len, unsigned int n) {
+  lconst s[sponge_size];
+  if (!lt.ready) {
+    lanes_init();
+  }
+  for (unsigned int i = 0; i < sponge_size; i++) {
+    convert(s[i], init[i]);
+  }
+  for (unsigned int k = 0; k < n; k += lanes) {
+    hash_lanes(out + k, s, in + k * len, len, n - k < lanes ? n - k : lanes);
+  }
+}
+
+static unsigned int has_ifma(void) {
+  return __builtin_cpu_supports("avx512ifma");
+}
+#else
+static void hash_ifma(scalar *out, const state init, const scalar *in,
+                      unsigned int len, unsigned int n) {}
+
+static unsigned int has_ifma(void) { return 0; }
+#endif
+
+void poseidon_xN(scalar *out, const state init, const scalar *in,
+                 unsigned int len, unsigned int n) {
+  if (has_ifma()) {
+    hash_ifma(out, init, in, len, n);
+    return;
+  }
+  for (unsigned int k = 0; k < n; k++) {
+    hash_one(out[k], init, in + k * len, len);
+  }
+}
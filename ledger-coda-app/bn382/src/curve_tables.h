@@ -0,0 +1,1028 @@
+// generated by gen_tables.py, do not edit
+
+#ifndef CURVE_TABLES
+#define CURVE_TABLES
+
+#include "crypto.h"
+#include "poseidon.h"
+
+#if field_bytes != 48
+#error "field_bytes differs from gen_tables.py"
+#endif
+#if comb_teeth != 4
+#error "comb_teeth differs from gen_tables.py"
+#endif
+#if comb_tables != 4
+#error "comb_tables differs from gen_tables.py"
+#endif
+#if glv_bits != 193
+#error "glv_bits differs from gen_tables.py"
+#endif
+
+static const field field_modulus = {
+    0x24, 0x04, 0x89, 0x3f, 0xda, 0xd8, 0x87, 0x8e, 0x71, 0x50, 0x3c, 0x69,
+    0xb0, 0x9d, 0xbf, 0x88, 0xb4, 0x8a, 0x36, 0x14, 0x28, 0x9b, 0x09, 0x01,
+    0x20, 0x12, 0x24, 0x6d, 0x22, 0x42, 0x41, 0x20, 0x00, 0x00, 0x00, 0x01,
+    0x80, 0x0c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
+static const scalar group_order = {
+    0x24, 0x04, 0x89, 0x3f, 0xda, 0xd8, 0x87, 0x8e, 0x71, 0x50, 0x3c, 0x69,
+    0xb0, 0x9d, 0xbf, 0x88, 0xb4, 0x8a, 0x36, 0x14, 0x28, 0x9b, 0x09, 0x01,
+    0x80, 0x18, 0x30, 0x91, 0x83, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01,
+    0x80, 0x0c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+// R^2 mod p, for cx_mont_init2
+#if !defined(CODA_HOST)
+static const field field_r2 = {
+    0x0b, 0xc8, 0x57, 0xae, 0xa2, 0x71, 0x71, 0xf7, 0x1b, 0x4e, 0xec, 0x3d,
+    0x89, 0xfc, 0x0f, 0xd3, 0xe5, 0x24, 0x54, 0xbf, 0x8b, 0x81, 0x04, 0x02,
+    0x0e, 0x10, 0xd2, 0x79, 0x69, 0x37, 0xba, 0x75, 0xb2, 0x20, 0x34, 0x14,
+    0x0d, 0x11, 0x9c, 0xa9, 0xaa, 0x7b, 0x14, 0xa5, 0x3b, 0x61, 0x08, 0x87};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed field_one = {
+    0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+    0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a};
+#else
+static const fe_packed field_one = {
+    0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+    0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+    0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+    0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed group_coeff_b = {
+    0xffffffffffffffcf, 0xffffffb67daf6367, 0xdc87071c715188df,
+    0x718ba6243a5346c8, 0x4fa46fc531ce56d5, 0x1b21bac71c8e0dbc};
+#else
+static const fe_packed group_coeff_b = {
+    0x1b, 0x21, 0xba, 0xc7, 0x1c, 0x8e, 0x0d, 0xbc, 0x4f, 0xa4, 0x6f, 0xc5,
+    0x31, 0xce, 0x56, 0xd5, 0x71, 0x8b, 0xa6, 0x24, 0x3a, 0x53, 0x46, 0xc8,
+    0xdc, 0x87, 0x07, 0x1c, 0x71, 0x51, 0x88, 0xdf, 0xff, 0xff, 0xff, 0xb6,
+    0x7d, 0xaf, 0x63, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf};
+#endif
+
+// (X : Y : Z) = (0 : 1 : 0)
+#if defined(CODA_HOST)
+static const group_packed group_zero = {
+    {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+     0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+    {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+     0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+    {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+     0x0000000000000000, 0x0000000000000000, 0x0000000000000000}};
+#else
+static const group_packed group_zero = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+     0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+     0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+     0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+#endif
+
+#if defined(CODA_HOST)
+static const group_packed group_one = {
+    {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+     0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+    {0x7bbbac48dff48e8a, 0x7f0b69a418192817, 0x91be699f8043e89b,
+     0xb9a47acffcccc09c, 0xbd7a048e12f9984f, 0x16e7846105853ac1},
+    {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+     0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a}};
+#else
+static const group_packed group_one = {
+    {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+     0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+     0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+     0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+    {0x16, 0xe7, 0x84, 0x61, 0x05, 0x85, 0x3a, 0xc1, 0xbd, 0x7a, 0x04, 0x8e,
+     0x12, 0xf9, 0x98, 0x4f, 0xb9, 0xa4, 0x7a, 0xcf, 0xfc, 0xcc, 0xc0, 0x9c,
+     0x91, 0xbe, 0x69, 0x9f, 0x80, 0x43, 0xe8, 0x9b, 0x7f, 0x0b, 0x69, 0xa4,
+     0x18, 0x19, 0x28, 0x17, 0x7b, 0xbb, 0xac, 0x48, 0xdf, 0xf4, 0x8e, 0x8a},
+    {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+     0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+     0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+     0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9}};
+#endif
+
+#if defined(CODA_HOST)
+static const affine_packed group_comb[comb_tables][1 << (comb_teeth - 1)] = {
+    {{{0x46ab41c8a60b0feb, 0x891707a7b5f8c912, 0x8e31174e82e5558f,
+       0xdd1e7c10788aea03, 0x52835fb99b7f4204, 0x1ae7461fac2bdcb4},
+      {0x7f235aa3b809ac15, 0xb477585c7343d74d, 0x89beb428a2dd8223,
+       0x4a1d7273a9dfc01b, 0x40a9b205091b5670, 0x0facdb9fde594114}},
+     {{0xcf2a94fdf55f97a9, 0xeb85e19efa45b242, 0xc5bc7f655a63bafd,
+       0x00c3a47543c4663c, 0x1de5919a36adc4bb, 0x14162859ce70d7fb},
+      {0xd73df01f276aa5d7, 0x685768b50ed18c8c, 0x6bc9d67008c9edc6,
+       0x0804eebc31c5ea58, 0xd71003169a07730c, 0x1089e20f4fe0eee8}},
+     {{0x7afb8ed396d03446, 0xa91043e3bbf84308, 0x58d81945a41e0e9a,
+       0xdbc8729d9e2dbb78, 0x665d547c698b3e8e, 0x07c58740a608e068},
+      {0x19aac1f1f72cd8c4, 0x629b63ed92e7f6e7, 0x9dbfdd137e030c4f,
+       0xf618f00f87f83dcb, 0x0984a139a45a209b, 0x15b9b35f8242f98b}},
+     {{0x9a409740eb7c646f, 0x9f4eaf0e537c49d9, 0xca5ae26a8a28e463,
+       0x95f0f8db723f35be, 0x7680dea3cd3d3987, 0x17c0f7298e22dccf},
+      {0x86037a156315b936, 0x4b9c7de49b88ffaf, 0x2f3d358270ea02ec,
+       0x8263c6fbdf10e388, 0xe322c0b0fe230356, 0x04b8bbfba35bd6f3}},
+     {{0x0e173144cea2d01e, 0x9fa752f1f0a95bbd, 0x74ad4bd865c1f23c,
+       0xacabcef31bab7cc5, 0x689bede327ac47b5, 0x00bfc9d09587ac93},
+      {0x190207089a36b123, 0x230fc38640731718, 0x83a17dea4a447d2f,
+       0x15ea47f0283309f8, 0x8b5f3bee1355ed07, 0x0bf4ef98fab4b025}},
+     {{0xeaca0709c7e46c84, 0x4e1065642ce47424, 0xca6764461e99a589,
+       0x8334aca1e7b146aa, 0x35360c017b73ffac, 0x201de5074dc79bfc},
+      {0xc21103b5be3117bf, 0xb2b69d04e1ed949a, 0x1bdf1e1645ad6f25,
+       0x4e2cc4d1d0846106, 0xf0bac2cc9d79e765, 0x1b994e01f80ffbe2}},
+     {{0x03e21e95921ca177, 0x86c5a5e5520a8694, 0x41586213d8d7242d,
+       0x7a7b8463d80c2dd5, 0xe55b58bbc0f370b3, 0x0ea60247962dcfdf},
+      {0x585a41cf65be0a2c, 0xff9104bf105851be, 0x6dd9082ed2f99b86,
+       0x5c60a1d9f54a42d1, 0xba4245e0685028da, 0x1358632e99ff400c}},
+     {{0xd829a066a75454e7, 0x9977625ba3784d86, 0xb8aa9c232fba832b,
+       0x574a05ddb1605cf1, 0x02c1fbc75d72b2e0, 0x07b70a96bee771fd},
+      {0x33b7ff40e0e8c212, 0xa6636b57968425f6, 0x10d1079c58a4705f,
+       0x1e43917fb7b7b881, 0x9650cbe37d1325eb, 0x1b539bd7022d5c4b}}},
+    {{{0x2d7e7bcd14deb81c, 0x68fbefa550945f3a, 0x80d97136fc2bb38b,
+       0xb9442271c6253689, 0xcf2cefa2afa1ac70, 0x152407a158ec4ad2},
+      {0xa144c3c26cb59d52, 0xafe099625469d8b5, 0x3a2833bd9ce66437,
+       0xc29d31491d1a8cf0, 0xc36f158d8f13b6de, 0x00793eff5d75fd0a}},
+     {{0xa24d65c943ca0bcd, 0xb90460c1ff944945, 0x37aeb8cc0dfdc358,
+       0xbd2090c503c28755, 0x2749a8759b823df8, 0x0e8dc583d3c920db},
+      {0xc8d6a9f59fa5bf50, 0x95d0294f261b3f24, 0x390b778756891b3a,
+       0xeba7ae4585c9fdcf, 0xfa345b2ecf362ef2, 0x22129c9fb3503c62}},
+     {{0xd773a2fc4272e4b9, 0xa26c243e4e22edcc, 0x5fd4b3bfd9b05f47,
+       0xe1a775011ef4e44c, 0x7b9d47f669a8dc3d, 0x10665a1a891dcdd7},
+      {0x402dbf3c957240ac, 0x5edb49bfe108cb11, 0xdcaf9be925404ce1,
+       0xe5b32fed6925dcd4, 0xa240f1442261d9ef, 0x214fc3fbcd5d851f}},
+     {{0x4cc3b9aaa76daf96, 0x7d4064ada6172d3a, 0x805bb7f2f167cf6f,
+       0x6b1e39adef638444, 0x21e622d492cf5e91, 0x19dc93807a5a3d86},
+      {0xac08d79c744f54d5, 0x8f1efedc99c55fae, 0xe5938aaf237a35f3,
+       0x819adf08c748202f, 0xbc708ccc0e117a83, 0x1056a5d7f3189d12}},
+     {{0x9bea94765b1020b0, 0xae90a6100c8d6a24, 0xecb2c71bc21fca7b,
+       0x6b0e6f64942cf218, 0x545eac4b273aad8c, 0x0695161e753012a6},
+      {0x6eafd0daf856824e, 0xd94ed44c4439e529, 0x0bf731b3c031a3ef,
+       0xa3b0dfd0859bd863, 0x655bf3a9548a4de6, 0x01756071950ce13a}},
+     {{0x43e00c289cffe423, 0x9615ab258a210369, 0xe87308dfaa79b815,
+       0x6015194a71ce040c, 0x13578b8477822efe, 0x0042e7345ba63ae8},
+      {0x00ab8054d28377fc, 0x62099da68ef1d2ad, 0xd6c914d7f93fdf4a,
+       0x7fe2076389916526, 0x403aefb9deedca86, 0x21ffcb85f4024889}},
+     {{0x14a30b9995253489, 0x80ea8f7577d3808e, 0x271eeb77277280bc,
+       0x2bbf6fe342e13cd6, 0x9e46fa9f5f704480, 0x0b37e56c34dae380},
+      {0x0238d113cd5a6606, 0x11009d2789ee2b1c, 0x8d43b195827e0250,
+       0xaf2825d97515bad1, 0xcce0686b11b55b9b, 0x0f38d93c4b14a370}},
+     {{0x55fb2aae73ada508, 0x2e421c0b1ede4803, 0x886b1e959e5945aa,
+       0x0b60935cec635066, 0x271f0c397b3c70f1, 0x1c59ac6c363b27b9},
+      {0xb2ca8914e3cc1582, 0x83e309116f24c680, 0x56041091c5326a9b,
+       0x4b2403fe9f906f51, 0xdbf090e2f9f0691c, 0x0d27747b7f6962e2}}},
+    {{{0xcd982c1b7f95903e, 0xf4550b56abddd722, 0xa724325dc0257b00,
+       0x5e8c07d51ae00f49, 0x43517ffd08c56598, 0x0a0258dd843d3e2e},
+      {0x1ea79005b2155fd4, 0x8f42514554a57f18, 0x675be1a763c91160,
+       0x007c2ad434d27e9b, 0xd2788567bf6a3c2e, 0x03fa2967308b14c2}},
+     {{0x3ea95395013c7784, 0xc332cbee34e06486, 0xb75f47a340f97cf7,
+       0xc21329db0b7e3d5a, 0x4e05190f2c814041, 0x14b374450d229083},
+      {0x85950578fd41ec92, 0x641a5f879c953a18, 0x385728e31539380d,
+       0x307a0f4f5af9e03d, 0xfe67aacabec395b9, 0x06c9eff70ea8937b}},
+     {{0xafdcd6d15b5b2a4d, 0x9dec79edc6afe8de, 0x6b44226e1e2bd82f,
+       0xc472786418140a94, 0xb52441d3306b9072, 0x10f9c15a6ee9fee1},
+      {0xe3d8a05230cbb837, 0xf42d4803dc471997, 0x642c86c3a31f8646,
+       0xd5f332b46e9e32ff, 0x312be1a2b7fc57de, 0x00a6acd200f6617f}},
+     {{0x516787c26d0e2b9d, 0x3ea0cff228c2a0f5, 0x8c4d1211bebf0068,
+       0xb266abccef8b9a3b, 0x927d7013506bff13, 0x21a337197e113d2e},
+      {0xfa7fd443f62fd5e4, 0xdbdf417e4d982b04, 0x1503345a3c22c758,
+       0x086018547fdb64d4, 0x8fa4341d3749a459, 0x217c21465ca79979}},
+     {{0xb929df8ed1c57f46, 0x684f72084309d299, 0x1c51a59136147897,
+       0x28afed64bd33265c, 0x8c5d8b287a825cad, 0x11afff96a252a723},
+      {0x5db7987898c43c02, 0x55b2ab6a68a1cef6, 0x694098f0fdefc513,
+       0x43f5c768f929bbec, 0x2b65b332bf4a5dc5, 0x0836ccc5d7e6c660}},
+     {{0x417e6ff02de8674c, 0xb43bc22f10e8d552, 0xf0fbd73275cc3d17,
+       0xabdbb2102d7e1975, 0xead2f8cd7318a250, 0x10f29fd969ecd151},
+      {0x6cb3a90c3b12295b, 0xb9c831111e76d94b, 0xe54d85e4f59a4f23,
+       0x1654e6f576db72a2, 0x600b94b788c2691c, 0x0058d8fd305d8bb0}},
+     {{0xd408fde2dc20dca1, 0x740a64cea900191a, 0xc82f1b6f61db29b7,
+       0xde47809c866fd045, 0x0a0369f2eb57e247, 0x0ff42e6ec08a33b0},
+      {0x45acc13f802d1097, 0xf992bd872737bd68, 0x1e44eaed5cbe84d2,
+       0x72ec02a06b686c9c, 0x436dae47d395c928, 0x02f9439b2b939dea}},
+     {{0x682766174f33898a, 0x06665b4a67e023f8, 0xbfa10498a1478250,
+       0x9243bf74f11b2116, 0x00f3b53e23923c6e, 0x0a460bb41c39203a},
+      {0x66c043a3c8a29869, 0x7f5f4a3984d95d55, 0xb1984bf3bc9ab159,
+       0x510cd8d13e1bb6f4, 0x4d0d95559e9c46cb, 0x0636f5aa1f0cba5b}}},
+    {{{0xd0e31664591572d4, 0x963b58543f04454c, 0x3f3426a2d53e5d22,
+       0x81f6f3e36ac8d632, 0xe3c443033b1fc86f, 0x17e0350827e72dee},
+      {0xa959b3f4c80b3cda, 0x2d328bfc1e471d17, 0x1d6e2950c5ef2f69,
+       0xc71ee2cf1ed9fd0e, 0x1b99067cc4660f10, 0x04067974c52d0d64}},
+     {{0x2d41c9033acf1f07, 0x9b9db47311031c1a, 0xcae2071cf3926bb3,
+       0xeb8f221770b18deb, 0x3794dca9feeaaa4e, 0x099cccc5a8020706},
+      {0x19404193859644fd, 0xdaef01e01d950e8a, 0x59e6dd566c92afc2,
+       0x05573085c8ef9fe8, 0xe10332b2cf32c1f3, 0x1b339360e3a82934}},
+     {{0xab12c2c98bb5659f, 0xf084981a90df7faf, 0x84918fdbe58292fa,
+       0x4dbda9e0d9a98cd5, 0x9c12d1aefff03c5d, 0x0e8cea590342c85d},
+      {0xfcace98477243ce4, 0xb73b4860c61d70d9, 0x1ecfc03972ac5f42,
+       0xc7c3f79140b4ab6f, 0x4e8ca758d061fda9, 0x04e3c5cae07447ed}},
+     {{0xe53d951392959d55, 0x0674ab8dac3ca7b4, 0x1738cbb8f9744f87,
+       0x515a3bf4701c8140, 0x60607819a8b66405, 0x078f17f65f5a865f},
+      {0x82abacf10103a4d1, 0x47da0340de09661d, 0xb1568ec341bb837e,
+       0x82d7f176bd28d043, 0x397c89314d0a085c, 0x085a2c9cf7cb40c6}},
+     {{0xb3ec4215b6d9e90f, 0x3e14957738bfbf8d, 0xedd5bc8838d7fb6a,
+       0x9dd4504ac9c24735, 0x436cc4b1a146c4ba, 0x13ebd2403205b48b},
+      {0x31cdf9906a111060, 0x8f64d8b6e4b77dc6, 0xfb9193591ab70afd,
+       0x5ad9909ca125ce81, 0xbc902a0b4b81080d, 0x1000cb8c773d7ac1}},
+     {{0x49831a183848f92b, 0x4644f997606d9f25, 0x8260619244385cd8,
+       0x79633d19573bad91, 0x415fe74eaa5bd196, 0x05e3779eb72c38a7},
+      {0x55b95c48977dd3dc, 0xf875e5685b4db3ff, 0x40eeb4fb2a41f128,
+       0x928c50f8e79d4dee, 0x48d4c5dae7eff217, 0x0d012edfcf2654f1}},
+     {{0x962d7281fe494a67, 0xa73c0ccaf5e03c18, 0x5208f8de5578d243,
+       0x16e3d55e6a388e8b, 0xcaa13a39e532b883, 0x05b3738de2a54f05},
+      {0xd4e748c5a53541df, 0xb53134f608bf54cd, 0xa1730f9f686c39f0,
+       0x6ac4207bc6e02c42, 0x148136cf48d8a5b3, 0x0262d15da72c1bb7}},
+     {{0xfa6037c456601983, 0x305248657526cdfe, 0xf4a8c1b14206308d,
+       0x560c8602c917d9de, 0x7226fec1d55142b0, 0x1208d95f6eab0e49},
+      {0x8276798e4e2c9b2b, 0x0b9ad2964768e36b, 0xf985aa7f1e56c1f3,
+       0xaba359b825c6bc9a, 0xe213e418363d2a40, 0x0beeb3e82de837bc}}}};
+#else
+static const affine_packed group_comb[comb_tables][1 << (comb_teeth - 1)] = {
+    {{{0x1a, 0xe7, 0x46, 0x1f, 0xac, 0x2b, 0xdc, 0xb4, 0x52, 0x83, 0x5f, 0xb9,
+       0x9b, 0x7f, 0x42, 0x04, 0xdd, 0x1e, 0x7c, 0x10, 0x78, 0x8a, 0xea, 0x03,
+       0x8e, 0x31, 0x17, 0x4e, 0x82, 0xe5, 0x55, 0x8f, 0x89, 0x17, 0x07, 0xa7,
+       0xb5, 0xf8, 0xc9, 0x12, 0x46, 0xab, 0x41, 0xc8, 0xa6, 0x0b, 0x0f, 0xeb},
+      {0x0f, 0xac, 0xdb, 0x9f, 0xde, 0x59, 0x41, 0x14, 0x40, 0xa9, 0xb2, 0x05,
+       0x09, 0x1b, 0x56, 0x70, 0x4a, 0x1d, 0x72, 0x73, 0xa9, 0xdf, 0xc0, 0x1b,
+       0x89, 0xbe, 0xb4, 0x28, 0xa2, 0xdd, 0x82, 0x23, 0xb4, 0x77, 0x58, 0x5c,
+       0x73, 0x43, 0xd7, 0x4d, 0x7f, 0x23, 0x5a, 0xa3, 0xb8, 0x09, 0xac, 0x15}},
+     {{0x14, 0x16, 0x28, 0x59, 0xce, 0x70, 0xd7, 0xfb, 0x1d, 0xe5, 0x91, 0x9a,
+       0x36, 0xad, 0xc4, 0xbb, 0x00, 0xc3, 0xa4, 0x75, 0x43, 0xc4, 0x66, 0x3c,
+       0xc5, 0xbc, 0x7f, 0x65, 0x5a, 0x63, 0xba, 0xfd, 0xeb, 0x85, 0xe1, 0x9e,
+       0xfa, 0x45, 0xb2, 0x42, 0xcf, 0x2a, 0x94, 0xfd, 0xf5, 0x5f, 0x97, 0xa9},
+      {0x10, 0x89, 0xe2, 0x0f, 0x4f, 0xe0, 0xee, 0xe8, 0xd7, 0x10, 0x03, 0x16,
+       0x9a, 0x07, 0x73, 0x0c, 0x08, 0x04, 0xee, 0xbc, 0x31, 0xc5, 0xea, 0x58,
+       0x6b, 0xc9, 0xd6, 0x70, 0x08, 0xc9, 0xed, 0xc6, 0x68, 0x57, 0x68, 0xb5,
+       0x0e, 0xd1, 0x8c, 0x8c, 0xd7, 0x3d, 0xf0, 0x1f, 0x27, 0x6a, 0xa5, 0xd7}},
+     {{0x07, 0xc5, 0x87, 0x40, 0xa6, 0x08, 0xe0, 0x68, 0x66, 0x5d, 0x54, 0x7c,
+       0x69, 0x8b, 0x3e, 0x8e, 0xdb, 0xc8, 0x72, 0x9d, 0x9e, 0x2d, 0xbb, 0x78,
+       0x58, 0xd8, 0x19, 0x45, 0xa4, 0x1e, 0x0e, 0x9a, 0xa9, 0x10, 0x43, 0xe3,
+       0xbb, 0xf8, 0x43, 0x08, 0x7a, 0xfb, 0x8e, 0xd3, 0x96, 0xd0, 0x34, 0x46},
+      {0x15, 0xb9, 0xb3, 0x5f, 0x82, 0x42, 0xf9, 0x8b, 0x09, 0x84, 0xa1, 0x39,
+       0xa4, 0x5a, 0x20, 0x9b, 0xf6, 0x18, 0xf0, 0x0f, 0x87, 0xf8, 0x3d, 0xcb,
+       0x9d, 0xbf, 0xdd, 0x13, 0x7e, 0x03, 0x0c, 0x4f, 0x62, 0x9b, 0x63, 0xed,
+       0x92, 0xe7, 0xf6, 0xe7, 0x19, 0xaa, 0xc1, 0xf1, 0xf7, 0x2c, 0xd8, 0xc4}},
+     {{0x17, 0xc0, 0xf7, 0x29, 0x8e, 0x22, 0xdc, 0xcf, 0x76, 0x80, 0xde, 0xa3,
+       0xcd, 0x3d, 0x39, 0x87, 0x95, 0xf0, 0xf8, 0xdb, 0x72, 0x3f, 0x35, 0xbe,
+       0xca, 0x5a, 0xe2, 0x6a, 0x8a, 0x28, 0xe4, 0x63, 0x9f, 0x4e, 0xaf, 0x0e,
+       0x53, 0x7c, 0x49, 0xd9, 0x9a, 0x40, 0x97, 0x40, 0xeb, 0x7c, 0x64, 0x6f},
+      {0x04, 0xb8, 0xbb, 0xfb, 0xa3, 0x5b, 0xd6, 0xf3, 0xe3, 0x22, 0xc0, 0xb0,
+       0xfe, 0x23, 0x03, 0x56, 0x82, 0x63, 0xc6, 0xfb, 0xdf, 0x10, 0xe3, 0x88,
+       0x2f, 0x3d, 0x35, 0x82, 0x70, 0xea, 0x02, 0xec, 0x4b, 0x9c, 0x7d, 0xe4,
+       0x9b, 0x88, 0xff, 0xaf, 0x86, 0x03, 0x7a, 0x15, 0x63, 0x15, 0xb9, 0x36}},
+     {{0x00, 0xbf, 0xc9, 0xd0, 0x95, 0x87, 0xac, 0x93, 0x68, 0x9b, 0xed, 0xe3,
+       0x27, 0xac, 0x47, 0xb5, 0xac, 0xab, 0xce, 0xf3, 0x1b, 0xab, 0x7c, 0xc5,
+       0x74, 0xad, 0x4b, 0xd8, 0x65, 0xc1, 0xf2, 0x3c, 0x9f, 0xa7, 0x52, 0xf1,
+       0xf0, 0xa9, 0x5b, 0xbd, 0x0e, 0x17, 0x31, 0x44, 0xce, 0xa2, 0xd0, 0x1e},
+      {0x0b, 0xf4, 0xef, 0x98, 0xfa, 0xb4, 0xb0, 0x25, 0x8b, 0x5f, 0x3b, 0xee,
+       0x13, 0x55, 0xed, 0x07, 0x15, 0xea, 0x47, 0xf0, 0x28, 0x33, 0x09, 0xf8,
+       0x83, 0xa1, 0x7d, 0xea, 0x4a, 0x44, 0x7d, 0x2f, 0x23, 0x0f, 0xc3, 0x86,
+       0x40, 0x73, 0x17, 0x18, 0x19, 0x02, 0x07, 0x08, 0x9a, 0x36, 0xb1, 0x23}},
+     {{0x20, 0x1d, 0xe5, 0x07, 0x4d, 0xc7, 0x9b, 0xfc, 0x35, 0x36, 0x0c, 0x01,
+       0x7b, 0x73, 0xff, 0xac, 0x83, 0x34, 0xac, 0xa1, 0xe7, 0xb1, 0x46, 0xaa,
+       0xca, 0x67, 0x64, 0x46, 0x1e, 0x99, 0xa5, 0x89, 0x4e, 0x10, 0x65, 0x64,
+       0x2c, 0xe4, 0x74, 0x24, 0xea, 0xca, 0x07, 0x09, 0xc7, 0xe4, 0x6c, 0x84},
+      {0x1b, 0x99, 0x4e, 0x01, 0xf8, 0x0f, 0xfb, 0xe2, 0xf0, 0xba, 0xc2, 0xcc,
+       0x9d, 0x79, 0xe7, 0x65, 0x4e, 0x2c, 0xc4, 0xd1, 0xd0, 0x84, 0x61, 0x06,
+       0x1b, 0xdf, 0x1e, 0x16, 0x45, 0xad, 0x6f, 0x25, 0xb2, 0xb6, 0x9d, 0x04,
+       0xe1, 0xed, 0x94, 0x9a, 0xc2, 0x11, 0x03, 0xb5, 0xbe, 0x31, 0x17, 0xbf}},
+     {{0x0e, 0xa6, 0x02, 0x47, 0x96, 0x2d, 0xcf, 0xdf, 0xe5, 0x5b, 0x58, 0xbb,
+       0xc0, 0xf3, 0x70, 0xb3, 0x7a, 0x7b, 0x84, 0x63, 0xd8, 0x0c, 0x2d, 0xd5,
+       0x41, 0x58, 0x62, 0x13, 0xd8, 0xd7, 0x24, 0x2d, 0x86, 0xc5, 0xa5, 0xe5,
+       0x52, 0x0a, 0x86, 0x94, 0x03, 0xe2, 0x1e, 0x95, 0x92, 0x1c, 0xa1, 0x77},
+      {0x13, 0x58, 0x63, 0x2e, 0x99, 0xff, 0x40, 0x0c, 0xba, 0x42, 0x45, 0xe0,
+       0x68, 0x50, 0x28, 0xda, 0x5c, 0x60, 0xa1, 0xd9, 0xf5, 0x4a, 0x42, 0xd1,
+       0x6d, 0xd9, 0x08, 0x2e, 0xd2, 0xf9, 0x9b, 0x86, 0xff, 0x91, 0x04, 0xbf,
+       0x10, 0x58, 0x51, 0xbe, 0x58, 0x5a, 0x41, 0xcf, 0x65, 0xbe, 0x0a, 0x2c}},
+     {{0x07, 0xb7, 0x0a, 0x96, 0xbe, 0xe7, 0x71, 0xfd, 0x02, 0xc1, 0xfb, 0xc7,
+       0x5d, 0x72, 0xb2, 0xe0, 0x57, 0x4a, 0x05, 0xdd, 0xb1, 0x60, 0x5c, 0xf1,
+       0xb8, 0xaa, 0x9c, 0x23, 0x2f, 0xba, 0x83, 0x2b, 0x99, 0x77, 0x62, 0x5b,
+       0xa3, 0x78, 0x4d, 0x86, 0xd8, 0x29, 0xa0, 0x66, 0xa7, 0x54, 0x54, 0xe7},
+      {0x1b, 0x53, 0x9b, 0xd7, 0x02, 0x2d, 0x5c, 0x4b, 0x96, 0x50, 0xcb, 0xe3,
+       0x7d, 0x13, 0x25, 0xeb, 0x1e, 0x43, 0x91, 0x7f, 0xb7, 0xb7, 0xb8, 0x81,
+       0x10, 0xd1, 0x07, 0x9c, 0x58, 0xa4, 0x70, 0x5f, 0xa6, 0x63, 0x6b, 0x57,
+       0x96, 0x84, 0x25, 0xf6, 0x33, 0xb7, 0xff, 0x40, 0xe0, 0xe8, 0xc2, 0x12}}},
+    {{{0x15, 0x24, 0x07, 0xa1, 0x58, 0xec, 0x4a, 0xd2, 0xcf, 0x2c, 0xef, 0xa2,
+       0xaf, 0xa1, 0xac, 0x70, 0xb9, 0x44, 0x22, 0x71, 0xc6, 0x25, 0x36, 0x89,
+       0x80, 0xd9, 0x71, 0x36, 0xfc, 0x2b, 0xb3, 0x8b, 0x68, 0xfb, 0xef, 0xa5,
+       0x50, 0x94, 0x5f, 0x3a, 0x2d, 0x7e, 0x7b, 0xcd, 0x14, 0xde, 0xb8, 0x1c},
+      {0x00, 0x79, 0x3e, 0xff, 0x5d, 0x75, 0xfd, 0x0a, 0xc3, 0x6f, 0x15, 0x8d,
+       0x8f, 0x13, 0xb6, 0xde, 0xc2, 0x9d, 0x31, 0x49, 0x1d, 0x1a, 0x8c, 0xf0,
+       0x3a, 0x28, 0x33, 0xbd, 0x9c, 0xe6, 0x64, 0x37, 0xaf, 0xe0, 0x99, 0x62,
+       0x54, 0x69, 0xd8, 0xb5, 0xa1, 0x44, 0xc3, 0xc2, 0x6c, 0xb5, 0x9d, 0x52}},
+     {{0x0e, 0x8d, 0xc5, 0x83, 0xd3, 0xc9, 0x20, 0xdb, 0x27, 0x49, 0xa8, 0x75,
+       0x9b, 0x82, 0x3d, 0xf8, 0xbd, 0x20, 0x90, 0xc5, 0x03, 0xc2, 0x87, 0x55,
+       0x37, 0xae, 0xb8, 0xcc, 0x0d, 0xfd, 0xc3, 0x58, 0xb9, 0x04, 0x60, 0xc1,
+       0xff, 0x94, 0x49, 0x45, 0xa2, 0x4d, 0x65, 0xc9, 0x43, 0xca, 0x0b, 0xcd},
+      {0x22, 0x12, 0x9c, 0x9f, 0xb3, 0x50, 0x3c, 0x62, 0xfa, 0x34, 0x5b, 0x2e,
+       0xcf, 0x36, 0x2e, 0xf2, 0xeb, 0xa7, 0xae, 0x45, 0x85, 0xc9, 0xfd, 0xcf,
+       0x39, 0x0b, 0x77, 0x87, 0x56, 0x89, 0x1b, 0x3a, 0x95, 0xd0, 0x29, 0x4f,
+       0x26, 0x1b, 0x3f, 0x24, 0xc8, 0xd6, 0xa9, 0xf5, 0x9f, 0xa5, 0xbf, 0x50}},
+     {{0x10, 0x66, 0x5a, 0x1a, 0x89, 0x1d, 0xcd, 0xd7, 0x7b, 0x9d, 0x47, 0xf6,
+       0x69, 0xa8, 0xdc, 0x3d, 0xe1, 0xa7, 0x75, 0x01, 0x1e, 0xf4, 0xe4, 0x4c,
+       0x5f, 0xd4, 0xb3, 0xbf, 0xd9, 0xb0, 0x5f, 0x47, 0xa2, 0x6c, 0x24, 0x3e,
+       0x4e, 0x22, 0xed, 0xcc, 0xd7, 0x73, 0xa2, 0xfc, 0x42, 0x72, 0xe4, 0xb9},
+      {0x21, 0x4f, 0xc3, 0xfb, 0xcd, 0x5d, 0x85, 0x1f, 0xa2, 0x40, 0xf1, 0x44,
+       0x22, 0x61, 0xd9, 0xef, 0xe5, 0xb3, 0x2f, 0xed, 0x69, 0x25, 0xdc, 0xd4,
+       0xdc, 0xaf, 0x9b, 0xe9, 0x25, 0x40, 0x4c, 0xe1, 0x5e, 0xdb, 0x49, 0xbf,
+       0xe1, 0x08, 0xcb, 0x11, 0x40, 0x2d, 0xbf, 0x3c, 0x95, 0x72, 0x40, 0xac}},
+     {{0x19, 0xdc, 0x93, 0x80, 0x7a, 0x5a, 0x3d, 0x86, 0x21, 0xe6, 0x22, 0xd4,
+       0x92, 0xcf, 0x5e, 0x91, 0x6b, 0x1e, 0x39, 0xad, 0xef, 0x63, 0x84, 0x44,
+       0x80, 0x5b, 0xb7, 0xf2, 0xf1, 0x67, 0xcf, 0x6f, 0x7d, 0x40, 0x64, 0xad,
+       0xa6, 0x17, 0x2d, 0x3a, 0x4c, 0xc3, 0xb9, 0xaa, 0xa7, 0x6d, 0xaf, 0x96},
+      {0x10, 0x56, 0xa5, 0xd7, 0xf3, 0x18, 0x9d, 0x12, 0xbc, 0x70, 0x8c, 0xcc,
+       0x0e, 0x11, 0x7a, 0x83, 0x81, 0x9a, 0xdf, 0x08, 0xc7, 0x48, 0x20, 0x2f,
+       0xe5, 0x93, 0x8a, 0xaf, 0x23, 0x7a, 0x35, 0xf3, 0x8f, 0x1e, 0xfe, 0xdc,
+       0x99, 0xc5, 0x5f, 0xae, 0xac, 0x08, 0xd7, 0x9c, 0x74, 0x4f, 0x54, 0xd5}},
+     {{0x06, 0x95, 0x16, 0x1e, 0x75, 0x30, 0x12, 0xa6, 0x54, 0x5e, 0xac, 0x4b,
+       0x27, 0x3a, 0xad, 0x8c, 0x6b, 0x0e, 0x6f, 0x64, 0x94, 0x2c, 0xf2, 0x18,
+       0xec, 0xb2, 0xc7, 0x1b, 0xc2, 0x1f, 0xca, 0x7b, 0xae, 0x90, 0xa6, 0x10,
+       0x0c, 0x8d, 0x6a, 0x24, 0x9b, 0xea, 0x94, 0x76, 0x5b, 0x10, 0x20, 0xb0},
+      {0x01, 0x75, 0x60, 0x71, 0x95, 0x0c, 0xe1, 0x3a, 0x65, 0x5b, 0xf3, 0xa9,
+       0x54, 0x8a, 0x4d, 0xe6, 0xa3, 0xb0, 0xdf, 0xd0, 0x85, 0x9b, 0xd8, 0x63,
+       0x0b, 0xf7, 0x31, 0xb3, 0xc0, 0x31, 0xa3, 0xef, 0xd9, 0x4e, 0xd4, 0x4c,
+       0x44, 0x39, 0xe5, 0x29, 0x6e, 0xaf, 0xd0, 0xda, 0xf8, 0x56, 0x82, 0x4e}},
+     {{0x00, 0x42, 0xe7, 0x34, 0x5b, 0xa6, 0x3a, 0xe8, 0x13, 0x57, 0x8b, 0x84,
+       0x77, 0x82, 0x2e, 0xfe, 0x60, 0x15, 0x19, 0x4a, 0x71, 0xce, 0x04, 0x0c,
+       0xe8, 0x73, 0x08, 0xdf, 0xaa, 0x79, 0xb8, 0x15, 0x96, 0x15, 0xab, 0x25,
+       0x8a, 0x21, 0x03, 0x69, 0x43, 0xe0, 0x0c, 0x28, 0x9c, 0xff, 0xe4, 0x23},
+      {0x21, 0xff, 0xcb, 0x85, 0xf4, 0x02, 0x48, 0x89, 0x40, 0x3a, 0xef, 0xb9,
+       0xde, 0xed, 0xca, 0x86, 0x7f, 0xe2, 0x07, 0x63, 0x89, 0x91, 0x65, 0x26,
+       0xd6, 0xc9, 0x14, 0xd7, 0xf9, 0x3f, 0xdf, 0x4a, 0x62, 0x09, 0x9d, 0xa6,
+       0x8e, 0xf1, 0xd2, 0xad, 0x00, 0xab, 0x80, 0x54, 0xd2, 0x83, 0x77, 0xfc}},
+     {{0x0b, 0x37, 0xe5, 0x6c, 0x34, 0xda, 0xe3, 0x80, 0x9e, 0x46, 0xfa, 0x9f,
+       0x5f, 0x70, 0x44, 0x80, 0x2b, 0xbf, 0x6f, 0xe3, 0x42, 0xe1, 0x3c, 0xd6,
+       0x27, 0x1e, 0xeb, 0x77, 0x27, 0x72, 0x80, 0xbc, 0x80, 0xea, 0x8f, 0x75,
+       0x77, 0xd3, 0x80, 0x8e, 0x14, 0xa3, 0x0b, 0x99, 0x95, 0x25, 0x34, 0x89},
+      {0x0f, 0x38, 0xd9, 0x3c, 0x4b, 0x14, 0xa3, 0x70, 0xcc, 0xe0, 0x68, 0x6b,
+       0x11, 0xb5, 0x5b, 0x9b, 0xaf, 0x28, 0x25, 0xd9, 0x75, 0x15, 0xba, 0xd1,
+       0x8d, 0x43, 0xb1, 0x95, 0x82, 0x7e, 0x02, 0x50, 0x11, 0x00, 0x9d, 0x27,
+       0x89, 0xee, 0x2b, 0x1c, 0x02, 0x38, 0xd1, 0x13, 0xcd, 0x5a, 0x66, 0x06}},
+     {{0x1c, 0x59, 0xac, 0x6c, 0x36, 0x3b, 0x27, 0xb9, 0x27, 0x1f, 0x0c, 0x39,
+       0x7b, 0x3c, 0x70, 0xf1, 0x0b, 0x60, 0x93, 0x5c, 0xec, 0x63, 0x50, 0x66,
+       0x88, 0x6b, 0x1e, 0x95, 0x9e, 0x59, 0x45, 0xaa, 0x2e, 0x42, 0x1c, 0x0b,
+       0x1e, 0xde, 0x48, 0x03, 0x55, 0xfb, 0x2a, 0xae, 0x73, 0xad, 0xa5, 0x08},
+      {0x0d, 0x27, 0x74, 0x7b, 0x7f, 0x69, 0x62, 0xe2, 0xdb, 0xf0, 0x90, 0xe2,
+       0xf9, 0xf0, 0x69, 0x1c, 0x4b, 0x24, 0x03, 0xfe, 0x9f, 0x90, 0x6f, 0x51,
+       0x56, 0x04, 0x10, 0x91, 0xc5, 0x32, 0x6a, 0x9b, 0x83, 0xe3, 0x09, 0x11,
+       0x6f, 0x24, 0xc6, 0x80, 0xb2, 0xca, 0x89, 0x14, 0xe3, 0xcc, 0x15, 0x82}}},
+    {{{0x0a, 0x02, 0x58, 0xdd, 0x84, 0x3d, 0x3e, 0x2e, 0x43, 0x51, 0x7f, 0xfd,
+       0x08, 0xc5, 0x65, 0x98, 0x5e, 0x8c, 0x07, 0xd5, 0x1a, 0xe0, 0x0f, 0x49,
+       0xa7, 0x24, 0x32, 0x5d, 0xc0, 0x25, 0x7b, 0x00, 0xf4, 0x55, 0x0b, 0x56,
+       0xab, 0xdd, 0xd7, 0x22, 0xcd, 0x98, 0x2c, 0x1b, 0x7f, 0x95, 0x90, 0x3e},
+      {0x03, 0xfa, 0x29, 0x67, 0x30, 0x8b, 0x14, 0xc2, 0xd2, 0x78, 0x85, 0x67,
+       0xbf, 0x6a, 0x3c, 0x2e, 0x00, 0x7c, 0x2a, 0xd4, 0x34, 0xd2, 0x7e, 0x9b,
+       0x67, 0x5b, 0xe1, 0xa7, 0x63, 0xc9, 0x11, 0x60, 0x8f, 0x42, 0x51, 0x45,
+       0x54, 0xa5, 0x7f, 0x18, 0x1e, 0xa7, 0x90, 0x05, 0xb2, 0x15, 0x5f, 0xd4}},
+     {{0x14, 0xb3, 0x74, 0x45, 0x0d, 0x22, 0x90, 0x83, 0x4e, 0x05, 0x19, 0x0f,
+       0x2c, 0x81, 0x40, 0x41, 0xc2, 0x13, 0x29, 0xdb, 0x0b, 0x7e, 0x3d, 0x5a,
+       0xb7, 0x5f, 0x47, 0xa3, 0x40, 0xf9, 0x7c, 0xf7, 0xc3, 0x32, 0xcb, 0xee,
+       0x34, 0xe0, 0x64, 0x86, 0x3e, 0xa9, 0x53, 0x95, 0x01, 0x3c, 0x77, 0x84},
+      {0x06, 0xc9, 0xef, 0xf7, 0x0e, 0xa8, 0x93, 0x7b, 0xfe, 0x67, 0xaa, 0xca,
+       0xbe, 0xc3, 0x95, 0xb9, 0x30, 0x7a, 0x0f, 0x4f, 0x5a, 0xf9, 0xe0, 0x3d,
+       0x38, 0x57, 0x28, 0xe3, 0x15, 0x39, 0x38, 0x0d, 0x64, 0x1a, 0x5f, 0x87,
+       0x9c, 0x95, 0x3a, 0x18, 0x85, 0x95, 0x05, 0x78, 0xfd, 0x41, 0xec, 0x92}},
+     {{0x10, 0xf9, 0xc1, 0x5a, 0x6e, 0xe9, 0xfe, 0xe1, 0xb5, 0x24, 0x41, 0xd3,
+       0x30, 0x6b, 0x90, 0x72, 0xc4, 0x72, 0x78, 0x64, 0x18, 0x14, 0x0a, 0x94,
+       0x6b, 0x44, 0x22, 0x6e, 0x1e, 0x2b, 0xd8, 0x2f, 0x9d, 0xec, 0x79, 0xed,
+       0xc6, 0xaf, 0xe8, 0xde, 0xaf, 0xdc, 0xd6, 0xd1, 0x5b, 0x5b, 0x2a, 0x4d},
+      {0x00, 0xa6, 0xac, 0xd2, 0x00, 0xf6, 0x61, 0x7f, 0x31, 0x2b, 0xe1, 0xa2,
+       0xb7, 0xfc, 0x57, 0xde, 0xd5, 0xf3, 0x32, 0xb4, 0x6e, 0x9e, 0x32, 0xff,
+       0x64, 0x2c, 0x86, 0xc3, 0xa3, 0x1f, 0x86, 0x46, 0xf4, 0x2d, 0x48, 0x03,
+       0xdc, 0x47, 0x19, 0x97, 0xe3, 0xd8, 0xa0, 0x52, 0x30, 0xcb, 0xb8, 0x37}},
+     {{0x21, 0xa3, 0x37, 0x19, 0x7e, 0x11, 0x3d, 0x2e, 0x92, 0x7d, 0x70, 0x13,
+       0x50, 0x6b, 0xff, 0x13, 0xb2, 0x66, 0xab, 0xcc, 0xef, 0x8b, 0x9a, 0x3b,
+       0x8c, 0x4d, 0x12, 0x11, 0xbe, 0xbf, 0x00, 0x68, 0x3e, 0xa0, 0xcf, 0xf2,
+       0x28, 0xc2, 0xa0, 0xf5, 0x51, 0x67, 0x87, 0xc2, 0x6d, 0x0e, 0x2b, 0x9d},
+      {0x21, 0x7c, 0x21, 0x46, 0x5c, 0xa7, 0x99, 0x79, 0x8f, 0xa4, 0x34, 0x1d,
+       0x37, 0x49, 0xa4, 0x59, 0x08, 0x60, 0x18, 0x54, 0x7f, 0xdb, 0x64, 0xd4,
+       0x15, 0x03, 0x34, 0x5a, 0x3c, 0x22, 0xc7, 0x58, 0xdb, 0xdf, 0x41, 0x7e,
+       0x4d, 0x98, 0x2b, 0x04, 0xfa, 0x7f, 0xd4, 0x43, 0xf6, 0x2f, 0xd5, 0xe4}},
+     {{0x11, 0xaf, 0xff, 0x96, 0xa2, 0x52, 0xa7, 0x23, 0x8c, 0x5d, 0x8b, 0x28,
+       0x7a, 0x82, 0x5c, 0xad, 0x28, 0xaf, 0xed, 0x64, 0xbd, 0x33, 0x26, 0x5c,
+       0x1c, 0x51, 0xa5, 0x91, 0x36, 0x14, 0x78, 0x97, 0x68, 0x4f, 0x72, 0x08,
+       0x43, 0x09, 0xd2, 0x99, 0xb9, 0x29, 0xdf, 0x8e, 0xd1, 0xc5, 0x7f, 0x46},
+      {0x08, 0x36, 0xcc, 0xc5, 0xd7, 0xe6, 0xc6, 0x60, 0x2b, 0x65, 0xb3, 0x32,
+       0xbf, 0x4a, 0x5d, 0xc5, 0x43, 0xf5, 0xc7, 0x68, 0xf9, 0x29, 0xbb, 0xec,
+       0x69, 0x40, 0x98, 0xf0, 0xfd, 0xef, 0xc5, 0x13, 0x55, 0xb2, 0xab, 0x6a,
+       0x68, 0xa1, 0xce, 0xf6, 0x5d, 0xb7, 0x98, 0x78, 0x98, 0xc4, 0x3c, 0x02}},
+     {{0x10, 0xf2, 0x9f, 0xd9, 0x69, 0xec, 0xd1, 0x51, 0xea, 0xd2, 0xf8, 0xcd,
+       0x73, 0x18, 0xa2, 0x50, 0xab, 0xdb, 0xb2, 0x10, 0x2d, 0x7e, 0x19, 0x75,
+       0xf0, 0xfb, 0xd7, 0x32, 0x75, 0xcc, 0x3d, 0x17, 0xb4, 0x3b, 0xc2, 0x2f,
+       0x10, 0xe8, 0xd5, 0x52, 0x41, 0x7e, 0x6f, 0xf0, 0x2d, 0xe8, 0x67, 0x4c},
+      {0x00, 0x58, 0xd8, 0xfd, 0x30, 0x5d, 0x8b, 0xb0, 0x60, 0x0b, 0x94, 0xb7,
+       0x88, 0xc2, 0x69, 0x1c, 0x16, 0x54, 0xe6, 0xf5, 0x76, 0xdb, 0x72, 0xa2,
+       0xe5, 0x4d, 0x85, 0xe4, 0xf5, 0x9a, 0x4f, 0x23, 0xb9, 0xc8, 0x31, 0x11,
+       0x1e, 0x76, 0xd9, 0x4b, 0x6c, 0xb3, 0xa9, 0x0c, 0x3b, 0x12, 0x29, 0x5b}},
+     {{0x0f, 0xf4, 0x2e, 0x6e, 0xc0, 0x8a, 0x33, 0xb0, 0x0a, 0x03, 0x69, 0xf2,
+       0xeb, 0x57, 0xe2, 0x47, 0xde, 0x47, 0x80, 0x9c, 0x86, 0x6f, 0xd0, 0x45,
+       0xc8, 0x2f, 0x1b, 0x6f, 0x61, 0xdb, 0x29, 0xb7, 0x74, 0x0a, 0x64, 0xce,
+       0xa9, 0x00, 0x19, 0x1a, 0xd4, 0x08, 0xfd, 0xe2, 0xdc, 0x20, 0xdc, 0xa1},
+      {0x02, 0xf9, 0x43, 0x9b, 0x2b, 0x93, 0x9d, 0xea, 0x43, 0x6d, 0xae, 0x47,
+       0xd3, 0x95, 0xc9, 0x28, 0x72, 0xec, 0x02, 0xa0, 0x6b, 0x68, 0x6c, 0x9c,
+       0x1e, 0x44, 0xea, 0xed, 0x5c, 0xbe, 0x84, 0xd2, 0xf9, 0x92, 0xbd, 0x87,
+       0x27, 0x37, 0xbd, 0x68, 0x45, 0xac, 0xc1, 0x3f, 0x80, 0x2d, 0x10, 0x97}},
+     {{0x0a, 0x46, 0x0b, 0xb4, 0x1c, 0x39, 0x20, 0x3a, 0x00, 0xf3, 0xb5, 0x3e,
+       0x23, 0x92, 0x3c, 0x6e, 0x92, 0x43, 0xbf, 0x74, 0xf1, 0x1b, 0x21, 0x16,
+       0xbf, 0xa1, 0x04, 0x98, 0xa1, 0x47, 0x82, 0x50, 0x06, 0x66, 0x5b, 0x4a,
+       0x67, 0xe0, 0x23, 0xf8, 0x68, 0x27, 0x66, 0x17, 0x4f, 0x33, 0x89, 0x8a},
+      {0x06, 0x36, 0xf5, 0xaa, 0x1f, 0x0c, 0xba, 0x5b, 0x4d, 0x0d, 0x95, 0x55,
+       0x9e, 0x9c, 0x46, 0xcb, 0x51, 0x0c, 0xd8, 0xd1, 0x3e, 0x1b, 0xb6, 0xf4,
+       0xb1, 0x98, 0x4b, 0xf3, 0xbc, 0x9a, 0xb1, 0x59, 0x7f, 0x5f, 0x4a, 0x39,
+       0x84, 0xd9, 0x5d, 0x55, 0x66, 0xc0, 0x43, 0xa3, 0xc8, 0xa2, 0x98, 0x69}}},
+    {{{0x17, 0xe0, 0x35, 0x08, 0x27, 0xe7, 0x2d, 0xee, 0xe3, 0xc4, 0x43, 0x03,
+       0x3b, 0x1f, 0xc8, 0x6f, 0x81, 0xf6, 0xf3, 0xe3, 0x6a, 0xc8, 0xd6, 0x32,
+       0x3f, 0x34, 0x26, 0xa2, 0xd5, 0x3e, 0x5d, 0x22, 0x96, 0x3b, 0x58, 0x54,
+       0x3f, 0x04, 0x45, 0x4c, 0xd0, 0xe3, 0x16, 0x64, 0x59, 0x15, 0x72, 0xd4},
+      {0x04, 0x06, 0x79, 0x74, 0xc5, 0x2d, 0x0d, 0x64, 0x1b, 0x99, 0x06, 0x7c,
+       0xc4, 0x66, 0x0f, 0x10, 0xc7, 0x1e, 0xe2, 0xcf, 0x1e, 0xd9, 0xfd, 0x0e,
+       0x1d, 0x6e, 0x29, 0x50, 0xc5, 0xef, 0x2f, 0x69, 0x2d, 0x32, 0x8b, 0xfc,
+       0x1e, 0x47, 0x1d, 0x17, 0xa9, 0x59, 0xb3, 0xf4, 0xc8, 0x0b, 0x3c, 0xda}},
+     {{0x09, 0x9c, 0xcc, 0xc5, 0xa8, 0x02, 0x07, 0x06, 0x37, 0x94, 0xdc, 0xa9,
+       0xfe, 0xea, 0xaa, 0x4e, 0xeb, 0x8f, 0x22, 0x17, 0x70, 0xb1, 0x8d, 0xeb,
+       0xca, 0xe2, 0x07, 0x1c, 0xf3, 0x92, 0x6b, 0xb3, 0x9b, 0x9d, 0xb4, 0x73,
+       0x11, 0x03, 0x1c, 0x1a, 0x2d, 0x41, 0xc9, 0x03, 0x3a, 0xcf, 0x1f, 0x07},
+      {0x1b, 0x33, 0x93, 0x60, 0xe3, 0xa8, 0x29, 0x34, 0xe1, 0x03, 0x32, 0xb2,
+       0xcf, 0x32, 0xc1, 0xf3, 0x05, 0x57, 0x30, 0x85, 0xc8, 0xef, 0x9f, 0xe8,
+       0x59, 0xe6, 0xdd, 0x56, 0x6c, 0x92, 0xaf, 0xc2, 0xda, 0xef, 0x01, 0xe0,
+       0x1d, 0x95, 0x0e, 0x8a, 0x19, 0x40, 0x41, 0x93, 0x85, 0x96, 0x44, 0xfd}},
+     {{0x0e, 0x8c, 0xea, 0x59, 0x03, 0x42, 0xc8, 0x5d, 0x9c, 0x12, 0xd1, 0xae,
+       0xff, 0xf0, 0x3c, 0x5d, 0x4d, 0xbd, 0xa9, 0xe0, 0xd9, 0xa9, 0x8c, 0xd5,
+       0x84, 0x91, 0x8f, 0xdb, 0xe5, 0x82, 0x92, 0xfa, 0xf0, 0x84, 0x98, 0x1a,
+       0x90, 0xdf, 0x7f, 0xaf, 0xab, 0x12, 0xc2, 0xc9, 0x8b, 0xb5, 0x65, 0x9f},
+      {0x04, 0xe3, 0xc5, 0xca, 0xe0, 0x74, 0x47, 0xed, 0x4e, 0x8c, 0xa7, 0x58,
+       0xd0, 0x61, 0xfd, 0xa9, 0xc7, 0xc3, 0xf7, 0x91, 0x40, 0xb4, 0xab, 0x6f,
+       0x1e, 0xcf, 0xc0, 0x39, 0x72, 0xac, 0x5f, 0x42, 0xb7, 0x3b, 0x48, 0x60,
+       0xc6, 0x1d, 0x70, 0xd9, 0xfc, 0xac, 0xe9, 0x84, 0x77, 0x24, 0x3c, 0xe4}},
+     {{0x07, 0x8f, 0x17, 0xf6, 0x5f, 0x5a, 0x86, 0x5f, 0x60, 0x60, 0x78, 0x19,
+       0xa8, 0xb6, 0x64, 0x05, 0x51, 0x5a, 0x3b, 0xf4, 0x70, 0x1c, 0x81, 0x40,
+       0x17, 0x38, 0xcb, 0xb8, 0xf9, 0x74, 0x4f, 0x87, 0x06, 0x74, 0xab, 0x8d,
+       0xac, 0x3c, 0xa7, 0xb4, 0xe5, 0x3d, 0x95, 0x13, 0x92, 0x95, 0x9d, 0x55},
+      {0x08, 0x5a, 0x2c, 0x9c, 0xf7, 0xcb, 0x40, 0xc6, 0x39, 0x7c, 0x89, 0x31,
+       0x4d, 0x0a, 0x08, 0x5c, 0x82, 0xd7, 0xf1, 0x76, 0xbd, 0x28, 0xd0, 0x43,
+       0xb1, 0x56, 0x8e, 0xc3, 0x41, 0xbb, 0x83, 0x7e, 0x47, 0xda, 0x03, 0x40,
+       0xde, 0x09, 0x66, 0x1d, 0x82, 0xab, 0xac, 0xf1, 0x01, 0x03, 0xa4, 0xd1}},
+     {{0x13, 0xeb, 0xd2, 0x40, 0x32, 0x05, 0xb4, 0x8b, 0x43, 0x6c, 0xc4, 0xb1,
+       0xa1, 0x46, 0xc4, 0xba, 0x9d, 0xd4, 0x50, 0x4a, 0xc9, 0xc2, 0x47, 0x35,
+       0xed, 0xd5, 0xbc, 0x88, 0x38, 0xd7, 0xfb, 0x6a, 0x3e, 0x14, 0x95, 0x77,
+       0x38, 0xbf, 0xbf, 0x8d, 0xb3, 0xec, 0x42, 0x15, 0xb6, 0xd9, 0xe9, 0x0f},
+      {0x10, 0x00, 0xcb, 0x8c, 0x77, 0x3d, 0x7a, 0xc1, 0xbc, 0x90, 0x2a, 0x0b,
+       0x4b, 0x81, 0x08, 0x0d, 0x5a, 0xd9, 0x90, 0x9c, 0xa1, 0x25, 0xce, 0x81,
+       0xfb, 0x91, 0x93, 0x59, 0x1a, 0xb7, 0x0a, 0xfd, 0x8f, 0x64, 0xd8, 0xb6,
+       0xe4, 0xb7, 0x7d, 0xc6, 0x31, 0xcd, 0xf9, 0x90, 0x6a, 0x11, 0x10, 0x60}},
+     {{0x05, 0xe3, 0x77, 0x9e, 0xb7, 0x2c, 0x38, 0xa7, 0x41, 0x5f, 0xe7, 0x4e,
+       0xaa, 0x5b, 0xd1, 0x96, 0x79, 0x63, 0x3d, 0x19, 0x57, 0x3b, 0xad, 0x91,
+       0x82, 0x60, 0x61, 0x92, 0x44, 0x38, 0x5c, 0xd8, 0x46, 0x44, 0xf9, 0x97,
+       0x60, 0x6d, 0x9f, 0x25, 0x49, 0x83, 0x1a, 0x18, 0x38, 0x48, 0xf9, 0x2b},
+      {0x0d, 0x01, 0x2e, 0xdf, 0xcf, 0x26, 0x54, 0xf1, 0x48, 0xd4, 0xc5, 0xda,
+       0xe7, 0xef, 0xf2, 0x17, 0x92, 0x8c, 0x50, 0xf8, 0xe7, 0x9d, 0x4d, 0xee,
+       0x40, 0xee, 0xb4, 0xfb, 0x2a, 0x41, 0xf1, 0x28, 0xf8, 0x75, 0xe5, 0x68,
+       0x5b, 0x4d, 0xb3, 0xff, 0x55, 0xb9, 0x5c, 0x48, 0x97, 0x7d, 0xd3, 0xdc}},
+     {{0x05, 0xb3, 0x73, 0x8d, 0xe2, 0xa5, 0x4f, 0x05, 0xca, 0xa1, 0x3a, 0x39,
+       0xe5, 0x32, 0xb8, 0x83, 0x16, 0xe3, 0xd5, 0x5e, 0x6a, 0x38, 0x8e, 0x8b,
+       0x52, 0x08, 0xf8, 0xde, 0x55, 0x78, 0xd2, 0x43, 0xa7, 0x3c, 0x0c, 0xca,
+       0xf5, 0xe0, 0x3c, 0x18, 0x96, 0x2d, 0x72, 0x81, 0xfe, 0x49, 0x4a, 0x67},
+      {0x02, 0x62, 0xd1, 0x5d, 0xa7, 0x2c, 0x1b, 0xb7, 0x14, 0x81, 0x36, 0xcf,
+       0x48, 0xd8, 0xa5, 0xb3, 0x6a, 0xc4, 0x20, 0x7b, 0xc6, 0xe0, 0x2c, 0x42,
+       0xa1, 0x73, 0x0f, 0x9f, 0x68, 0x6c, 0x39, 0xf0, 0xb5, 0x31, 0x34, 0xf6,
+       0x08, 0xbf, 0x54, 0xcd, 0xd4, 0xe7, 0x48, 0xc5, 0xa5, 0x35, 0x41, 0xdf}},
+     {{0x12, 0x08, 0xd9, 0x5f, 0x6e, 0xab, 0x0e, 0x49, 0x72, 0x26, 0xfe, 0xc1,
+       0xd5, 0x51, 0x42, 0xb0, 0x56, 0x0c, 0x86, 0x02, 0xc9, 0x17, 0xd9, 0xde,
+       0xf4, 0xa8, 0xc1, 0xb1, 0x42, 0x06, 0x30, 0x8d, 0x30, 0x52, 0x48, 0x65,
+       0x75, 0x26, 0xcd, 0xfe, 0xfa, 0x60, 0x37, 0xc4, 0x56, 0x60, 0x19, 0x83},
+      {0x0b, 0xee, 0xb3, 0xe8, 0x2d, 0xe8, 0x37, 0xbc, 0xe2, 0x13, 0xe4, 0x18,
+       0x36, 0x3d, 0x2a, 0x40, 0xab, 0xa3, 0x59, 0xb8, 0x25, 0xc6, 0xbc, 0x9a,
+       0xf9, 0x85, 0xaa, 0x7f, 0x1e, 0x56, 0xc1, 0xf3, 0x0b, 0x9a, 0xd2, 0x96,
+       0x47, 0x68, 0xe3, 0x6b, 0x82, 0x76, 0x79, 0x8e, 0x4e, 0x2c, 0x9b, 0x2b}}}};
+#endif
+
+// group_scalar_mul, host only: phi(x, y) = (beta x, y) = lambda (x, y),
+// the basis (a1, -b1), (a2, b2) and gi = (2^scalar_bits * bi) / q
+#if defined(CODA_HOST)
+static const fe_packed glv_beta = {
+    0x8533cc28673f47ce, 0x4856d7ae740da4f6, 0x52418bf7cf8ba1a7,
+    0xb6112d3d0432d4b2, 0xb88066992a2d4f26, 0x081566c3adffaee4};
+#endif
+
+#if defined(CODA_HOST)
+static const scalar glv_a1 = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x04, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static const scalar glv_b1 = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x06, 0x0c, 0x24, 0x60, 0xc0, 0xc0, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x04, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
+static const scalar glv_a2 = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x06, 0x0c, 0x24, 0x60, 0xc0, 0xc0, 0x60, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
+static const scalar glv_b2 = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x04, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+static const scalar glv_g1 = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x8d, 0xe2, 0xe8, 0x4e, 0x1a, 0xf0, 0x43, 0xc9, 0x18, 0xe7, 0xd1, 0x27};
+static const scalar glv_g2 = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xaa, 0x7f, 0xac, 0x5d, 0x4f, 0x8f, 0x61, 0x64, 0xef, 0xd5, 0x0c, 0xe8,
+    0x22, 0x8e, 0x37, 0xa9, 0x04, 0x2e, 0xa4, 0xb1, 0xe0, 0x4a, 0xc6, 0xe0};
+static const scalar glv_half = {
+    0x12, 0x02, 0x44, 0x9f, 0xed, 0x6c, 0x43, 0xc7, 0x38, 0xa8, 0x1e, 0x34,
+    0xd8, 0x4e, 0xdf, 0xc4, 0x5a, 0x45, 0x1b, 0x0a, 0x14, 0x4d, 0x84, 0x80,
+    0xc0, 0x0c, 0x18, 0x48, 0xc1, 0x81, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0x06, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+#endif
+
+// group_lift_x: p - 1 = 2^field_two_adicity t with t odd, c = z^t for
+// a non residue z, roots[j] = c^(2^j), and e = (t - 1) / 2
+#define field_two_adicity 67
+
+#if defined(CODA_HOST)
+static const fe_packed field_sqrt_roots[field_two_adicity] = {
+    {0x6325e559d80e5ee8, 0x3c549e4f70d9d7f9, 0x433b5efa247295f0,
+     0xe299e2024f66cd0b, 0x961697c0199588c5, 0x1239d89ebd605561},
+    {0x2f603bcf7c3bb38a, 0xea8103d5575fcbd2, 0xfdb4b513409756eb,
+     0x62cec3ef08f4cf86, 0xc209e2ed8d4732c9, 0x1bdee3c9425c15c4},
+    {0xe090401ad517bf3f, 0xaf644fde47ed3568, 0x4882649bdd336a64,
+     0xa3e892035cff78d4, 0x767d3c09606631c5, 0x0e71eebd8e3bfab1},
+    {0x7acb935710656053, 0x52469786029f2c74, 0x793ca51faa87140e,
+     0x83215121a6dfc7d8, 0x8c8c88199051599a, 0x1db0396be7aa805c},
+    {0x995dbd9f1e3cf7f3, 0xa007d1b44afdf1e7, 0x62ff9b0d9a4cc145,
+     0x0ed38d2d7d072ccb, 0x8a8ae65a275e448a, 0x0b3c53d3cbf99fac},
+    {0xe97c4d0a996ec8aa, 0x36d39a5fbef333f2, 0xb6a03c082dbcb933,
+     0x40488274b705e7b2, 0xa4744973b8928b75, 0x14165093ce633783},
+    {0x98bef22a23a999d5, 0x7c524bc035877eb5, 0x2fb13b1f20ce2b7e,
+     0x9725295b1290df09, 0x3d7dcafd313df76b, 0x183f263abc871d72},
+    {0xb0b73b5625ac8757, 0x88912ea59ca8de1e, 0x142da2d0fffbc2cf,
+     0x547336562a2d4ad2, 0xee93a7f0836b4413, 0x1249c972c362f4af},
+    {0xb855e056bb640323, 0x2026944970ac1fdc, 0x413622e2d7ebaf0f,
+     0x4c0a98bbffdd395d, 0xe66702eed1c22828, 0x191331685285946e},
+    {0x2c8aa5d2b71a6b1b, 0x6cf441f33a2a4205, 0xacc6ffd5ea49435e,
+     0x68711b241e5797bb, 0x977d3e33586ab14c, 0x1470e267522ec785},
+    {0x800cee55abd2cea0, 0xb5b5b3c424c179fd, 0xeab765eda6a9756d,
+     0x5400ac7233f5f99b, 0xde2337ee219f7595, 0x222fc341ddbc2f1b},
+    {0x80aba1831c108e62, 0x4029c970920cc340, 0x892f852879791518,
+     0xa3cdc13d89cfa565, 0xcb0d9574b3602698, 0x0630ead98502a713},
+    {0x82a8b86eba60c96b, 0x2b3bac2e1cdde2b8, 0xdf54aa13dfde5364,
+     0xb093c15b4f9c71f3, 0x435e298ab81f6c0f, 0x0677b50b8f6c4368},
+    {0xbb4316e3a9c5024a, 0xf58b5d8fa36d8b58, 0x37ce5666d75b536a,
+     0x0c4e2a35b7b0ba5f, 0xfd9b1df8e98852a7, 0x23a042419199c5d4},
+    {0x82310b7f40e86280, 0x7eda92ab5c30125b, 0x59f82fb3a2c245ce,
+     0xc66fd60f873df63d, 0x66c9856d1db198cf, 0x0af7b1aa43626364},
+    {0x30b723cf97f05e2c, 0xc21ed3500e45c6bf, 0x5c0dba698154a98d,
+     0x8554caaa0042123b, 0x1a360b9cf6a15473, 0x0b4da0b59de7ce02},
+    {0xb57278e8f11b4a56, 0xca40a8b047139cf8, 0x56fe22c777dd2b1f,
+     0xb60568b174ecbb4b, 0xb235360095bf0f2e, 0x0a7bd7360901d9da},
+    {0xbdbecbe3c582f7f8, 0x6f0ff9aa6feba863, 0xe7cd8ed2621f4eed,
+     0x2c94bf846a1e334b, 0x2709b13be4ab2179, 0x1391da2858119be4},
+    {0x28fdaf3603a5a68b, 0x7ed2feeb4fda3228, 0x393da39447bc8364,
+     0xefda817ec6135f93, 0xbdc1d3c952b5c67c, 0x23c122537f5cac5d},
+    {0x84a3b02489dd13f3, 0xe4f55b12f9f5c7fe, 0x33a0e22d9412fe8e,
+     0xa28337fab3f39f42, 0xb939aebd95241b16, 0x025a1fe4da356863},
+    {0x03f4ee9bc077cbf2, 0xc705d380406f9411, 0xdd21154267e174ac,
+     0x3a674fc95724af04, 0x90633c030feb789d, 0x13d45c1b49ea25b4},
+    {0x181d0785e0fe34ec, 0x5a83cf2bc1d6ac52, 0x8da76c2216d81ccd,
+     0x4cf7ec272b7d4918, 0x9eb10ac651cf5026, 0x1b8bb92c2f8250b7},
+    {0x70d4a89a347f282d, 0x8a0cc5e34c8d9e46, 0x0c771b755e9df77c,
+     0x553b2ee0f994d4b7, 0x771804133b4ac03c, 0x1eb96b6f57af5cc4},
+    {0xfa9c69c4e5817516, 0xace061e27ed850a5, 0xb6c8bf010561e4d3,
+     0x8058b601f6bb129d, 0x252d29b5ca0e07dd, 0x08734e468db5bbd5},
+    {0x6a89d721c682c0d5, 0xeef4c0b6e65883b1, 0x62eb1d0850626c26,
+     0x32a47c852d9ec9d0, 0x502380ed7c212d24, 0x0041a1a86b26eb4c},
+    {0x8081c155b6047b48, 0xd7c52b89e6f66c94, 0x668d212b7f10da8a,
+     0x8eca08f3e905a7bd, 0xbe5baf9cddbadf12, 0x0c72c45795393e3e},
+    {0x6f232c3a313eff26, 0x0101c79d2978f493, 0x78f921fb77d797dd,
+     0x015ea5a955962249, 0x98e4b0205d438fcb, 0x0a6a7431f326fe3c},
+    {0x36650fb59ed0ab14, 0x6326d2eb6889812b, 0x1affa92f738e162c,
+     0xeb7e49e3aebda03d, 0xeba68d96f9601ce0, 0x0031028794ab7b6a},
+    {0xe5a223ae55cdf26b, 0xb5bcb594683b7520, 0x81a607404d6e96a8,
+     0xeb50a71ddeab306e, 0x0b5d1265649b2216, 0x17d72f9e09fef36b},
+    {0x9c55c89e49a53880, 0x68a56304dc89408f, 0x8cf57a76294cd340,
+     0x90cf1079a9e37477, 0xc6bbd57bc5ead656, 0x1be0f2717cf948d3},
+    {0x43f286fc986df600, 0x7810919db22dac9a, 0xb184eb08b686891f,
+     0x020193a584b929cd, 0x14bbc57dd6af81a4, 0x062cec58a97bda04},
+    {0x36dfb0a2dc671e91, 0xed26057827222731, 0x0ed6ea5e70da09b6,
+     0xc8deda37a2cc1c78, 0x0aa27d61f07e321b, 0x18620031f4b55950},
+    {0x68b577d7130f4360, 0x11a8d09f2eb4da46, 0xe0d573e2effe877a,
+     0xe65315fc68852b14, 0xdc2a83e0942e4d52, 0x0cbe7c436bda2ddf},
+    {0x86691ac35142b18b, 0xb9bfb1a170dd7ec7, 0xc3d0d311f8fac7c5,
+     0xabe779b8eb435137, 0x4f7f1b632f26cd65, 0x1254eb151bb6b297},
+    {0x64aea49fc63c5b71, 0xc499cdc1434710fd, 0x5c0e4b9f5ec3e4ce,
+     0x09512649b22ee946, 0x6e26038863869dad, 0x17ccae0aca1806c7},
+    {0x3b8cd90e0c1d73dd, 0x8f647777dca9caa2, 0xa0b5e6b2cb79360c,
+     0x344aaae6b1e68dec, 0xdbd5890a98b6e855, 0x0376875e50930900},
+    {0xd23af2a554c19b3a, 0x117c0029c8786b68, 0x2d0d1e2e22f78dd0,
+     0x863c5232cbddf544, 0x98017ad5c7aa0a83, 0x1b77c2f0004fb5f0},
+    {0xa7f81a582810d421, 0xde14678f83f65d59, 0xa98e0bf535304334,
+     0x314876041504baf7, 0x13e45c6b11b243b6, 0x002ce2e1cb2ef556},
+    {0xf17b9b6f853e64be, 0xe3f476ab8a33abcc, 0x4a362195f879bfd1,
+     0xf01757bd18105e85, 0x4059056c9494c3e3, 0x184c36e6cbfcb65e},
+    {0x76bd1f6bcbcde9a9, 0x4211f81a1c983369, 0x4bbeef9da47d9be2,
+     0x2e96f3679f4fc3cf, 0x60615dacbc483e40, 0x1b69ae9ddd099dc3},
+    {0xc0b121e761c4cf5c, 0x8284bf92e47a82a6, 0x690fba962665c7cb,
+     0xcb1fdb9d6024c6cc, 0x8fd734d151475d79, 0x22d8e52ac7524868},
+    {0x1f95aa0b6da5815d, 0x400b995d9c099d73, 0x6d78c23acc64096b,
+     0x66cb3c7d57efac5d, 0xc49c74c472ba9089, 0x05281f7e100b77fc},
+    {0x5af375e387a20fac, 0x439c8f96d045415e, 0xc1eb190028c28e9f,
+     0xfaf60a98a75ab804, 0xc84eff950ebef380, 0x15cdc85bea3910fe},
+    {0x20ff06d623fd44d1, 0x310bbcf311de2b7c, 0x5ca28f8255a3919c,
+     0xf8f04238f3727433, 0xdc7aa21072d82a89, 0x09598f30d606d42d},
+    {0x4d2146d6522f139b, 0x7d744f711283c755, 0x1d347a5e3068b461,
+     0x9a1fd965a735c750, 0x31b970664ebc1613, 0x1e13ce4f61be2d2b},
+    {0xf327786d8dfb716f, 0x9c45d9948b246cf7, 0x5688a7e5eed0c320,
+     0x7fca1c5447ba04dc, 0xaedf80cf0a7ee80f, 0x1c77eaae40338766},
+    {0xf211b35ccd57fb06, 0x8f3019a01dd39617, 0xc36c738fe710cfa0,
+     0xf2fb16130884fdf6, 0xb099e8a6df99c6d8, 0x09aeaee1dc8a0367},
+    {0xa083fcdd5a228be2, 0x16de23a011a1c1d4, 0xa79908c64dbb491d,
+     0x6e60c4105e1d8e57, 0x5dae76cbd4becb44, 0x10ea6d2f66bd3503},
+    {0xa14b04bf461616cc, 0x0d018b4ee4102275, 0xbe1d307f2195e06e,
+     0xc58660a143d60e87, 0xaad902d1eda69134, 0x01fd1ea2eb629aba},
+    {0xbc456f679760b824, 0x682c2c0058221ace, 0x178d98f218afa9cb,
+     0xcb436f6c0f1d0439, 0x246dd13822ca7748, 0x0b53eea013212adc},
+    {0x8c73fac202396ca9, 0xf38ef61de4496182, 0x7cbb30f7b18ea985,
+     0x675f699c76d9cbc1, 0xba359112635f2db8, 0x0233f53ff48c7c74},
+    {0x4810dbf97481f79d, 0x4aeb364a2d7ea68b, 0xe9e3524e6c37596f,
+     0xb5569d08bff5e42e, 0x992961700558d4b9, 0x12e2d702c8e1770d},
+    {0x3319cdf69ca3166e, 0x554fb42ad934ef96, 0x818b473209f1123b,
+     0xd7fa54217df2cbeb, 0xb84acb38a38bb1c7, 0x05ac1e40b5cb45d7},
+    {0x1374fc490e1ef27a, 0x2583880d0f876a01, 0x445074ad03a12a6d,
+     0x6457233c854f0c67, 0x08bf017d691dc2ef, 0x1196042ce18604e8},
+    {0x49d9a07601e5917f, 0xf5380308da0a0778, 0x12e5e83a7f0f2f78,
+     0x92b672f6950dcf58, 0x27222855dffea864, 0x08d99e4212e4fe70},
+    {0x1eeccb71a704b381, 0x056a1ab8df3ceae5, 0x0d9671e3b7bcb2b6,
+     0x4cfb9949559c6ab7, 0xb3dc1af9aeb42c1a, 0x1f4f0fc86805da1a},
+    {0x9d5b830066653d33, 0xd8fd1a13e3e202ff, 0xc6150c5dd125c997,
+     0xc7557e56e4770ad9, 0xd5becc12d628cab2, 0x0ff4a7dbb90ada5d},
+    {0xd557f5d3eebebfc6, 0xfba4ddb273c4d52b, 0xd83aeb703361e39c,
+     0x740176c5a1b1f262, 0xcf96284d6491f543, 0x212126d357e61bd1},
+    {0x4782321aeb4c39cb, 0x972e52361153bd7a, 0x6417209e2965976c,
+     0x05fb036d5c61cb0e, 0x96947e086312e688, 0x075ec7e6e40179cb},
+    {0x5ef56aa734b701c3, 0x4fffd914ae49ba60, 0x2d7fe93cf8ca6b50,
+     0xd2db04c7e0001f8a, 0x3422db54a89a50a7, 0x2137adeb3534fbc7},
+    {0x66a5e29bcfb705f7, 0x4c57c1c6ff921b97, 0x72b201f5c18eaf89,
+     0xe0f7fd1efda4acaf, 0x6cf6aa8f79f99b17, 0x1c47d73811b98b95},
+    {0x75acecf78abcd438, 0xe0956aa40ee91174, 0x51bd97acbb64ce5d,
+     0x8c4a6293ef76553f, 0xe34fa202c040afde, 0x0286aaeddc36e26c},
+    {0xb56b853b80d1494f, 0x36677aaec880d5d1, 0xe053a2d700e9a665,
+     0xfd7c540373a465ab, 0x5557da9a57fe7700, 0x1a406ce5fb9cc215},
+    {0x6c1821a3284470b6, 0x062270e83e95a105, 0xaaf006505278d7ce,
+     0xe8918860b7712c78, 0x85090d74704b98fc, 0x0d8adab2e76aa7bb},
+    {0x5c33730bff22c8d9, 0xaa1b4861c8902f6e, 0x137bfd0d7475f2d3,
+     0x6a5d9d65de39401e, 0x33ef5231f77d6d40, 0x0ef0a7b2d5db805a},
+    {0x4b249fe45524de90, 0x4c96cb911a79eee1, 0x975ebdb236fd9b77,
+     0x6df0b04dcee83d61, 0x4ed9a59c6f8148ee, 0x03d570f2be50e566},
+    {0x0000000000000008, 0x0000000c0060c0c0, 0x0091236912120900,
+     0xa451b0a144d84809, 0x8a81e34d84edfc45, 0x202449fed6c43c73}};
+#else
+static const fe_packed field_sqrt_roots[field_two_adicity] = {
+    {0x12, 0x39, 0xd8, 0x9e, 0xbd, 0x60, 0x55, 0x61, 0x96, 0x16, 0x97, 0xc0,
+     0x19, 0x95, 0x88, 0xc5, 0xe2, 0x99, 0xe2, 0x02, 0x4f, 0x66, 0xcd, 0x0b,
+     0x43, 0x3b, 0x5e, 0xfa, 0x24, 0x72, 0x95, 0xf0, 0x3c, 0x54, 0x9e, 0x4f,
+     0x70, 0xd9, 0xd7, 0xf9, 0x63, 0x25, 0xe5, 0x59, 0xd8, 0x0e, 0x5e, 0xe8},
+    {0x1b, 0xde, 0xe3, 0xc9, 0x42, 0x5c, 0x15, 0xc4, 0xc2, 0x09, 0xe2, 0xed,
+     0x8d, 0x47, 0x32, 0xc9, 0x62, 0xce, 0xc3, 0xef, 0x08, 0xf4, 0xcf, 0x86,
+     0xfd, 0xb4, 0xb5, 0x13, 0x40, 0x97, 0x56, 0xeb, 0xea, 0x81, 0x03, 0xd5,
+     0x57, 0x5f, 0xcb, 0xd2, 0x2f, 0x60, 0x3b, 0xcf, 0x7c, 0x3b, 0xb3, 0x8a},
+    {0x0e, 0x71, 0xee, 0xbd, 0x8e, 0x3b, 0xfa, 0xb1, 0x76, 0x7d, 0x3c, 0x09,
+     0x60, 0x66, 0x31, 0xc5, 0xa3, 0xe8, 0x92, 0x03, 0x5c, 0xff, 0x78, 0xd4,
+     0x48, 0x82, 0x64, 0x9b, 0xdd, 0x33, 0x6a, 0x64, 0xaf, 0x64, 0x4f, 0xde,
+     0x47, 0xed, 0x35, 0x68, 0xe0, 0x90, 0x40, 0x1a, 0xd5, 0x17, 0xbf, 0x3f},
+    {0x1d, 0xb0, 0x39, 0x6b, 0xe7, 0xaa, 0x80, 0x5c, 0x8c, 0x8c, 0x88, 0x19,
+     0x90, 0x51, 0x59, 0x9a, 0x83, 0x21, 0x51, 0x21, 0xa6, 0xdf, 0xc7, 0xd8,
+     0x79, 0x3c, 0xa5, 0x1f, 0xaa, 0x87, 0x14, 0x0e, 0x52, 0x46, 0x97, 0x86,
+     0x02, 0x9f, 0x2c, 0x74, 0x7a, 0xcb, 0x93, 0x57, 0x10, 0x65, 0x60, 0x53},
+    {0x0b, 0x3c, 0x53, 0xd3, 0xcb, 0xf9, 0x9f, 0xac, 0x8a, 0x8a, 0xe6, 0x5a,
+     0x27, 0x5e, 0x44, 0x8a, 0x0e, 0xd3, 0x8d, 0x2d, 0x7d, 0x07, 0x2c, 0xcb,
+     0x62, 0xff, 0x9b, 0x0d, 0x9a, 0x4c, 0xc1, 0x45, 0xa0, 0x07, 0xd1, 0xb4,
+     0x4a, 0xfd, 0xf1, 0xe7, 0x99, 0x5d, 0xbd, 0x9f, 0x1e, 0x3c, 0xf7, 0xf3},
+    {0x14, 0x16, 0x50, 0x93, 0xce, 0x63, 0x37, 0x83, 0xa4, 0x74, 0x49, 0x73,
+     0xb8, 0x92, 0x8b, 0x75, 0x40, 0x48, 0x82, 0x74, 0xb7, 0x05, 0xe7, 0xb2,
+     0xb6, 0xa0, 0x3c, 0x08, 0x2d, 0xbc, 0xb9, 0x33, 0x36, 0xd3, 0x9a, 0x5f,
+     0xbe, 0xf3, 0x33, 0xf2, 0xe9, 0x7c, 0x4d, 0x0a, 0x99, 0x6e, 0xc8, 0xaa},
+    {0x18, 0x3f, 0x26, 0x3a, 0xbc, 0x87, 0x1d, 0x72, 0x3d, 0x7d, 0xca, 0xfd,
+     0x31, 0x3d, 0xf7, 0x6b, 0x97, 0x25, 0x29, 0x5b, 0x12, 0x90, 0xdf, 0x09,
+     0x2f, 0xb1, 0x3b, 0x1f, 0x20, 0xce, 0x2b, 0x7e, 0x7c, 0x52, 0x4b, 0xc0,
+     0x35, 0x87, 0x7e, 0xb5, 0x98, 0xbe, 0xf2, 0x2a, 0x23, 0xa9, 0x99, 0xd5},
+    {0x12, 0x49, 0xc9, 0x72, 0xc3, 0x62, 0xf4, 0xaf, 0xee, 0x93, 0xa7, 0xf0,
+     0x83, 0x6b, 0x44, 0x13, 0x54, 0x73, 0x36, 0x56, 0x2a, 0x2d, 0x4a, 0xd2,
+     0x14, 0x2d, 0xa2, 0xd0, 0xff, 0xfb, 0xc2, 0xcf, 0x88, 0x91, 0x2e, 0xa5,
+     0x9c, 0xa8, 0xde, 0x1e, 0xb0, 0xb7, 0x3b, 0x56, 0x25, 0xac, 0x87, 0x57},
+    {0x19, 0x13, 0x31, 0x68, 0x52, 0x85, 0x94, 0x6e, 0xe6, 0x67, 0x02, 0xee,
+     0xd1, 0xc2, 0x28, 0x28, 0x4c, 0x0a, 0x98, 0xbb, 0xff, 0xdd, 0x39, 0x5d,
+     0x41, 0x36, 0x22, 0xe2, 0xd7, 0xeb, 0xaf, 0x0f, 0x20, 0x26, 0x94, 0x49,
+     0x70, 0xac, 0x1f, 0xdc, 0xb8, 0x55, 0xe0, 0x56, 0xbb, 0x64, 0x03, 0x23},
+    {0x14, 0x70, 0xe2, 0x67, 0x52, 0x2e, 0xc7, 0x85, 0x97, 0x7d, 0x3e, 0x33,
+     0x58, 0x6a, 0xb1, 0x4c, 0x68, 0x71, 0x1b, 0x24, 0x1e, 0x57, 0x97, 0xbb,
+     0xac, 0xc6, 0xff, 0xd5, 0xea, 0x49, 0x43, 0x5e, 0x6c, 0xf4, 0x41, 0xf3,
+     0x3a, 0x2a, 0x42, 0x05, 0x2c, 0x8a, 0xa5, 0xd2, 0xb7, 0x1a, 0x6b, 0x1b},
+    {0x22, 0x2f, 0xc3, 0x41, 0xdd, 0xbc, 0x2f, 0x1b, 0xde, 0x23, 0x37, 0xee,
+     0x21, 0x9f, 0x75, 0x95, 0x54, 0x00, 0xac, 0x72, 0x33, 0xf5, 0xf9, 0x9b,
+     0xea, 0xb7, 0x65, 0xed, 0xa6, 0xa9, 0x75, 0x6d, 0xb5, 0xb5, 0xb3, 0xc4,
+     0x24, 0xc1, 0x79, 0xfd, 0x80, 0x0c, 0xee, 0x55, 0xab, 0xd2, 0xce, 0xa0},
+    {0x06, 0x30, 0xea, 0xd9, 0x85, 0x02, 0xa7, 0x13, 0xcb, 0x0d, 0x95, 0x74,
+     0xb3, 0x60, 0x26, 0x98, 0xa3, 0xcd, 0xc1, 0x3d, 0x89, 0xcf, 0xa5, 0x65,
+     0x89, 0x2f, 0x85, 0x28, 0x79, 0x79, 0x15, 0x18, 0x40, 0x29, 0xc9, 0x70,
+     0x92, 0x0c, 0xc3, 0x40, 0x80, 0xab, 0xa1, 0x83, 0x1c, 0x10, 0x8e, 0x62},
+    {0x06, 0x77, 0xb5, 0x0b, 0x8f, 0x6c, 0x43, 0x68, 0x43, 0x5e, 0x29, 0x8a,
+     0xb8, 0x1f, 0x6c, 0x0f, 0xb0, 0x93, 0xc1, 0x5b, 0x4f, 0x9c, 0x71, 0xf3,
+     0xdf, 0x54, 0xaa, 0x13, 0xdf, 0xde, 0x53, 0x64, 0x2b, 0x3b, 0xac, 0x2e,
+     0x1c, 0xdd, 0xe2, 0xb8, 0x82, 0xa8, 0xb8, 0x6e, 0xba, 0x60, 0xc9, 0x6b},
+    {0x23, 0xa0, 0x42, 0x41, 0x91, 0x99, 0xc5, 0xd4, 0xfd, 0x9b, 0x1d, 0xf8,
+     0xe9, 0x88, 0x52, 0xa7, 0x0c, 0x4e, 0x2a, 0x35, 0xb7, 0xb0, 0xba, 0x5f,
+     0x37, 0xce, 0x56, 0x66, 0xd7, 0x5b, 0x53, 0x6a, 0xf5, 0x8b, 0x5d, 0x8f,
+     0xa3, 0x6d, 0x8b, 0x58, 0xbb, 0x43, 0x16, 0xe3, 0xa9, 0xc5, 0x02, 0x4a},
+    {0x0a, 0xf7, 0xb1, 0xaa, 0x43, 0x62, 0x63, 0x64, 0x66, 0xc9, 0x85, 0x6d,
+     0x1d, 0xb1, 0x98, 0xcf, 0xc6, 0x6f, 0xd6, 0x0f, 0x87, 0x3d, 0xf6, 0x3d,
+     0x59, 0xf8, 0x2f, 0xb3, 0xa2, 0xc2, 0x45, 0xce, 0x7e, 0xda, 0x92, 0xab,
+     0x5c, 0x30, 0x12, 0x5b, 0x82, 0x31, 0x0b, 0x7f, 0x40, 0xe8, 0x62, 0x80},
+    {0x0b, 0x4d, 0xa0, 0xb5, 0x9d, 0xe7, 0xce, 0x02, 0x1a, 0x36, 0x0b, 0x9c,
+     0xf6, 0xa1, 0x54, 0x73, 0x85, 0x54, 0xca, 0xaa, 0x00, 0x42, 0x12, 0x3b,
+     0x5c, 0x0d, 0xba, 0x69, 0x81, 0x54, 0xa9, 0x8d, 0xc2, 0x1e, 0xd3, 0x50,
+     0x0e, 0x45, 0xc6, 0xbf, 0x30, 0xb7, 0x23, 0xcf, 0x97, 0xf0, 0x5e, 0x2c},
+    {0x0a, 0x7b, 0xd7, 0x36, 0x09, 0x01, 0xd9, 0xda, 0xb2, 0x35, 0x36, 0x00,
+     0x95, 0xbf, 0x0f, 0x2e, 0xb6, 0x05, 0x68, 0xb1, 0x74, 0xec, 0xbb, 0x4b,
+     0x56, 0xfe, 0x22, 0xc7, 0x77, 0xdd, 0x2b, 0x1f, 0xca, 0x40, 0xa8, 0xb0,
+     0x47, 0x13, 0x9c, 0xf8, 0xb5, 0x72, 0x78, 0xe8, 0xf1, 0x1b, 0x4a, 0x56},
+    {0x13, 0x91, 0xda, 0x28, 0x58, 0x11, 0x9b, 0xe4, 0x27, 0x09, 0xb1, 0x3b,
+     0xe4, 0xab, 0x21, 0x79, 0x2c, 0x94, 0xbf, 0x84, 0x6a, 0x1e, 0x33, 0x4b,
+     0xe7, 0xcd, 0x8e, 0xd2, 0x62, 0x1f, 0x4e, 0xed, 0x6f, 0x0f, 0xf9, 0xaa,
+     0x6f, 0xeb, 0xa8, 0x63, 0xbd, 0xbe, 0xcb, 0xe3, 0xc5, 0x82, 0xf7, 0xf8},
+    {0x23, 0xc1, 0x22, 0x53, 0x7f, 0x5c, 0xac, 0x5d, 0xbd, 0xc1, 0xd3, 0xc9,
+     0x52, 0xb5, 0xc6, 0x7c, 0xef, 0xda, 0x81, 0x7e, 0xc6, 0x13, 0x5f, 0x93,
+     0x39, 0x3d, 0xa3, 0x94, 0x47, 0xbc, 0x83, 0x64, 0x7e, 0xd2, 0xfe, 0xeb,
+     0x4f, 0xda, 0x32, 0x28, 0x28, 0xfd, 0xaf, 0x36, 0x03, 0xa5, 0xa6, 0x8b},
+    {0x02, 0x5a, 0x1f, 0xe4, 0xda, 0x35, 0x68, 0x63, 0xb9, 0x39, 0xae, 0xbd,
+     0x95, 0x24, 0x1b, 0x16, 0xa2, 0x83, 0x37, 0xfa, 0xb3, 0xf3, 0x9f, 0x42,
+     0x33, 0xa0, 0xe2, 0x2d, 0x94, 0x12, 0xfe, 0x8e, 0xe4, 0xf5, 0x5b, 0x12,
+     0xf9, 0xf5, 0xc7, 0xfe, 0x84, 0xa3, 0xb0, 0x24, 0x89, 0xdd, 0x13, 0xf3},
+    {0x13, 0xd4, 0x5c, 0x1b, 0x49, 0xea, 0x25, 0xb4, 0x90, 0x63, 0x3c, 0x03,
+     0x0f, 0xeb, 0x78, 0x9d, 0x3a, 0x67, 0x4f, 0xc9, 0x57, 0x24, 0xaf, 0x04,
+     0xdd, 0x21, 0x15, 0x42, 0x67, 0xe1, 0x74, 0xac, 0xc7, 0x05, 0xd3, 0x80,
+     0x40, 0x6f, 0x94, 0x11, 0x03, 0xf4, 0xee, 0x9b, 0xc0, 0x77, 0xcb, 0xf2},
+    {0x1b, 0x8b, 0xb9, 0x2c, 0x2f, 0x82, 0x50, 0xb7, 0x9e, 0xb1, 0x0a, 0xc6,
+     0x51, 0xcf, 0x50, 0x26, 0x4c, 0xf7, 0xec, 0x27, 0x2b, 0x7d, 0x49, 0x18,
+     0x8d, 0xa7, 0x6c, 0x22, 0x16, 0xd8, 0x1c, 0xcd, 0x5a, 0x83, 0xcf, 0x2b,
+     0xc1, 0xd6, 0xac, 0x52, 0x18, 0x1d, 0x07, 0x85, 0xe0, 0xfe, 0x34, 0xec},
+    {0x1e, 0xb9, 0x6b, 0x6f, 0x57, 0xaf, 0x5c, 0xc4, 0x77, 0x18, 0x04, 0x13,
+     0x3b, 0x4a, 0xc0, 0x3c, 0x55, 0x3b, 0x2e, 0xe0, 0xf9, 0x94, 0xd4, 0xb7,
+     0x0c, 0x77, 0x1b, 0x75, 0x5e, 0x9d, 0xf7, 0x7c, 0x8a, 0x0c, 0xc5, 0xe3,
+     0x4c, 0x8d, 0x9e, 0x46, 0x70, 0xd4, 0xa8, 0x9a, 0x34, 0x7f, 0x28, 0x2d},
+    {0x08, 0x73, 0x4e, 0x46, 0x8d, 0xb5, 0xbb, 0xd5, 0x25, 0x2d, 0x29, 0xb5,
+     0xca, 0x0e, 0x07, 0xdd, 0x80, 0x58, 0xb6, 0x01, 0xf6, 0xbb, 0x12, 0x9d,
+     0xb6, 0xc8, 0xbf, 0x01, 0x05, 0x61, 0xe4, 0xd3, 0xac, 0xe0, 0x61, 0xe2,
+     0x7e, 0xd8, 0x50, 0xa5, 0xfa, 0x9c, 0x69, 0xc4, 0xe5, 0x81, 0x75, 0x16},
+    {0x00, 0x41, 0xa1, 0xa8, 0x6b, 0x26, 0xeb, 0x4c, 0x50, 0x23, 0x80, 0xed,
+     0x7c, 0x21, 0x2d, 0x24, 0x32, 0xa4, 0x7c, 0x85, 0x2d, 0x9e, 0xc9, 0xd0,
+     0x62, 0xeb, 0x1d, 0x08, 0x50, 0x62, 0x6c, 0x26, 0xee, 0xf4, 0xc0, 0xb6,
+     0xe6, 0x58, 0x83, 0xb1, 0x6a, 0x89, 0xd7, 0x21, 0xc6, 0x82, 0xc0, 0xd5},
+    {0x0c, 0x72, 0xc4, 0x57, 0x95, 0x39, 0x3e, 0x3e, 0xbe, 0x5b, 0xaf, 0x9c,
+     0xdd, 0xba, 0xdf, 0x12, 0x8e, 0xca, 0x08, 0xf3, 0xe9, 0x05, 0xa7, 0xbd,
+     0x66, 0x8d, 0x21, 0x2b, 0x7f, 0x10, 0xda, 0x8a, 0xd7, 0xc5, 0x2b, 0x89,
+     0xe6, 0xf6, 0x6c, 0x94, 0x80, 0x81, 0xc1, 0x55, 0xb6, 0x04, 0x7b, 0x48},
+    {0x0a, 0x6a, 0x74, 0x31, 0xf3, 0x26, 0xfe, 0x3c, 0x98, 0xe4, 0xb0, 0x20,
+     0x5d, 0x43, 0x8f, 0xcb, 0x01, 0x5e, 0xa5, 0xa9, 0x55, 0x96, 0x22, 0x49,
+     0x78, 0xf9, 0x21, 0xfb, 0x77, 0xd7, 0x97, 0xdd, 0x01, 0x01, 0xc7, 0x9d,
+     0x29, 0x78, 0xf4, 0x93, 0x6f, 0x23, 0x2c, 0x3a, 0x31, 0x3e, 0xff, 0x26},
+    {0x00, 0x31, 0x02, 0x87, 0x94, 0xab, 0x7b, 0x6a, 0xeb, 0xa6, 0x8d, 0x96,
+     0xf9, 0x60, 0x1c, 0xe0, 0xeb, 0x7e, 0x49, 0xe3, 0xae, 0xbd, 0xa0, 0x3d,
+     0x1a, 0xff, 0xa9, 0x2f, 0x73, 0x8e, 0x16, 0x2c, 0x63, 0x26, 0xd2, 0xeb,
+     0x68, 0x89, 0x81, 0x2b, 0x36, 0x65, 0x0f, 0xb5, 0x9e, 0xd0, 0xab, 0x14},
+    {0x17, 0xd7, 0x2f, 0x9e, 0x09, 0xfe, 0xf3, 0x6b, 0x0b, 0x5d, 0x12, 0x65,
+     0x64, 0x9b, 0x22, 0x16, 0xeb, 0x50, 0xa7, 0x1d, 0xde, 0xab, 0x30, 0x6e,
+     0x81, 0xa6, 0x07, 0x40, 0x4d, 0x6e, 0x96, 0xa8, 0xb5, 0xbc, 0xb5, 0x94,
+     0x68, 0x3b, 0x75, 0x20, 0xe5, 0xa2, 0x23, 0xae, 0x55, 0xcd, 0xf2, 0x6b},
+    {0x1b, 0xe0, 0xf2, 0x71, 0x7c, 0xf9, 0x48, 0xd3, 0xc6, 0xbb, 0xd5, 0x7b,
+     0xc5, 0xea, 0xd6, 0x56, 0x90, 0xcf, 0x10, 0x79, 0xa9, 0xe3, 0x74, 0x77,
+     0x8c, 0xf5, 0x7a, 0x76, 0x29, 0x4c, 0xd3, 0x40, 0x68, 0xa5, 0x63, 0x04,
+     0xdc, 0x89, 0x40, 0x8f, 0x9c, 0x55, 0xc8, 0x9e, 0x49, 0xa5, 0x38, 0x80},
+    {0x06, 0x2c, 0xec, 0x58, 0xa9, 0x7b, 0xda, 0x04, 0x14, 0xbb, 0xc5, 0x7d,
+     0xd6, 0xaf, 0x81, 0xa4, 0x02, 0x01, 0x93, 0xa5, 0x84, 0xb9, 0x29, 0xcd,
+     0xb1, 0x84, 0xeb, 0x08, 0xb6, 0x86, 0x89, 0x1f, 0x78, 0x10, 0x91, 0x9d,
+     0xb2, 0x2d, 0xac, 0x9a, 0x43, 0xf2, 0x86, 0xfc, 0x98, 0x6d, 0xf6, 0x00},
+    {0x18, 0x62, 0x00, 0x31, 0xf4, 0xb5, 0x59, 0x50, 0x0a, 0xa2, 0x7d, 0x61,
+     0xf0, 0x7e, 0x32, 0x1b, 0xc8, 0xde, 0xda, 0x37, 0xa2, 0xcc, 0x1c, 0x78,
+     0x0e, 0xd6, 0xea, 0x5e, 0x70, 0xda, 0x09, 0xb6, 0xed, 0x26, 0x05, 0x78,
+     0x27, 0x22, 0x27, 0x31, 0x36, 0xdf, 0xb0, 0xa2, 0xdc, 0x67, 0x1e, 0x91},
+    {0x0c, 0xbe, 0x7c, 0x43, 0x6b, 0xda, 0x2d, 0xdf, 0xdc, 0x2a, 0x83, 0xe0,
+     0x94, 0x2e, 0x4d, 0x52, 0xe6, 0x53, 0x15, 0xfc, 0x68, 0x85, 0x2b, 0x14,
+     0xe0, 0xd5, 0x73, 0xe2, 0xef, 0xfe, 0x87, 0x7a, 0x11, 0xa8, 0xd0, 0x9f,
+     0x2e, 0xb4, 0xda, 0x46, 0x68, 0xb5, 0x77, 0xd7, 0x13, 0x0f, 0x43, 0x60},
+    {0x12, 0x54, 0xeb, 0x15, 0x1b, 0xb6, 0xb2, 0x97, 0x4f, 0x7f, 0x1b, 0x63,
+     0x2f, 0x26, 0xcd, 0x65, 0xab, 0xe7, 0x79, 0xb8, 0xeb, 0x43, 0x51, 0x37,
+     0xc3, 0xd0, 0xd3, 0x11, 0xf8, 0xfa, 0xc7, 0xc5, 0xb9, 0xbf, 0xb1, 0xa1,
+     0x70, 0xdd, 0x7e, 0xc7, 0x86, 0x69, 0x1a, 0xc3, 0x51, 0x42, 0xb1, 0x8b},
+    {0x17, 0xcc, 0xae, 0x0a, 0xca, 0x18, 0x06, 0xc7, 0x6e, 0x26, 0x03, 0x88,
+     0x63, 0x86, 0x9d, 0xad, 0x09, 0x51, 0x26, 0x49, 0xb2, 0x2e, 0xe9, 0x46,
+     0x5c, 0x0e, 0x4b, 0x9f, 0x5e, 0xc3, 0xe4, 0xce, 0xc4, 0x99, 0xcd, 0xc1,
+     0x43, 0x47, 0x10, 0xfd, 0x64, 0xae, 0xa4, 0x9f, 0xc6, 0x3c, 0x5b, 0x71},
+    {0x03, 0x76, 0x87, 0x5e, 0x50, 0x93, 0x09, 0x00, 0xdb, 0xd5, 0x89, 0x0a,
+     0x98, 0xb6, 0xe8, 0x55, 0x34, 0x4a, 0xaa, 0xe6, 0xb1, 0xe6, 0x8d, 0xec,
+     0xa0, 0xb5, 0xe6, 0xb2, 0xcb, 0x79, 0x36, 0x0c, 0x8f, 0x64, 0x77, 0x77,
+     0xdc, 0xa9, 0xca, 0xa2, 0x3b, 0x8c, 0xd9, 0x0e, 0x0c, 0x1d, 0x73, 0xdd},
+    {0x1b, 0x77, 0xc2, 0xf0, 0x00, 0x4f, 0xb5, 0xf0, 0x98, 0x01, 0x7a, 0xd5,
+     0xc7, 0xaa, 0x0a, 0x83, 0x86, 0x3c, 0x52, 0x32, 0xcb, 0xdd, 0xf5, 0x44,
+     0x2d, 0x0d, 0x1e, 0x2e, 0x22, 0xf7, 0x8d, 0xd0, 0x11, 0x7c, 0x00, 0x29,
+     0xc8, 0x78, 0x6b, 0x68, 0xd2, 0x3a, 0xf2, 0xa5, 0x54, 0xc1, 0x9b, 0x3a},
+    {0x00, 0x2c, 0xe2, 0xe1, 0xcb, 0x2e, 0xf5, 0x56, 0x13, 0xe4, 0x5c, 0x6b,
+     0x11, 0xb2, 0x43, 0xb6, 0x31, 0x48, 0x76, 0x04, 0x15, 0x04, 0xba, 0xf7,
+     0xa9, 0x8e, 0x0b, 0xf5, 0x35, 0x30, 0x43, 0x34, 0xde, 0x14, 0x67, 0x8f,
+     0x83, 0xf6, 0x5d, 0x59, 0xa7, 0xf8, 0x1a, 0x58, 0x28, 0x10, 0xd4, 0x21},
+    {0x18, 0x4c, 0x36, 0xe6, 0xcb, 0xfc, 0xb6, 0x5e, 0x40, 0x59, 0x05, 0x6c,
+     0x94, 0x94, 0xc3, 0xe3, 0xf0, 0x17, 0x57, 0xbd, 0x18, 0x10, 0x5e, 0x85,
+     0x4a, 0x36, 0x21, 0x95, 0xf8, 0x79, 0xbf, 0xd1, 0xe3, 0xf4, 0x76, 0xab,
+     0x8a, 0x33, 0xab, 0xcc, 0xf1, 0x7b, 0x9b, 0x6f, 0x85, 0x3e, 0x64, 0xbe},
+    {0x1b, 0x69, 0xae, 0x9d, 0xdd, 0x09, 0x9d, 0xc3, 0x60, 0x61, 0x5d, 0xac,
+     0xbc, 0x48, 0x3e, 0x40, 0x2e, 0x96, 0xf3, 0x67, 0x9f, 0x4f, 0xc3, 0xcf,
+     0x4b, 0xbe, 0xef, 0x9d, 0xa4, 0x7d, 0x9b, 0xe2, 0x42, 0x11, 0xf8, 0x1a,
+     0x1c, 0x98, 0x33, 0x69, 0x76, 0xbd, 0x1f, 0x6b, 0xcb, 0xcd, 0xe9, 0xa9},
+    {0x22, 0xd8, 0xe5, 0x2a, 0xc7, 0x52, 0x48, 0x68, 0x8f, 0xd7, 0x34, 0xd1,
+     0x51, 0x47, 0x5d, 0x79, 0xcb, 0x1f, 0xdb, 0x9d, 0x60, 0x24, 0xc6, 0xcc,
+     0x69, 0x0f, 0xba, 0x96, 0x26, 0x65, 0xc7, 0xcb, 0x82, 0x84, 0xbf, 0x92,
+     0xe4, 0x7a, 0x82, 0xa6, 0xc0, 0xb1, 0x21, 0xe7, 0x61, 0xc4, 0xcf, 0x5c},
+    {0x05, 0x28, 0x1f, 0x7e, 0x10, 0x0b, 0x77, 0xfc, 0xc4, 0x9c, 0x74, 0xc4,
+     0x72, 0xba, 0x90, 0x89, 0x66, 0xcb, 0x3c, 0x7d, 0x57, 0xef, 0xac, 0x5d,
+     0x6d, 0x78, 0xc2, 0x3a, 0xcc, 0x64, 0x09, 0x6b, 0x40, 0x0b, 0x99, 0x5d,
+     0x9c, 0x09, 0x9d, 0x73, 0x1f, 0x95, 0xaa, 0x0b, 0x6d, 0xa5, 0x81, 0x5d},
+    {0x15, 0xcd, 0xc8, 0x5b, 0xea, 0x39, 0x10, 0xfe, 0xc8, 0x4e, 0xff, 0x95,
+     0x0e, 0xbe, 0xf3, 0x80, 0xfa, 0xf6, 0x0a, 0x98, 0xa7, 0x5a, 0xb8, 0x04,
+     0xc1, 0xeb, 0x19, 0x00, 0x28, 0xc2, 0x8e, 0x9f, 0x43, 0x9c, 0x8f, 0x96,
+     0xd0, 0x45, 0x41, 0x5e, 0x5a, 0xf3, 0x75, 0xe3, 0x87, 0xa2, 0x0f, 0xac},
+    {0x09, 0x59, 0x8f, 0x30, 0xd6, 0x06, 0xd4, 0x2d, 0xdc, 0x7a, 0xa2, 0x10,
+     0x72, 0xd8, 0x2a, 0x89, 0xf8, 0xf0, 0x42, 0x38, 0xf3, 0x72, 0x74, 0x33,
+     0x5c, 0xa2, 0x8f, 0x82, 0x55, 0xa3, 0x91, 0x9c, 0x31, 0x0b, 0xbc, 0xf3,
+     0x11, 0xde, 0x2b, 0x7c, 0x20, 0xff, 0x06, 0xd6, 0x23, 0xfd, 0x44, 0xd1},
+    {0x1e, 0x13, 0xce, 0x4f, 0x61, 0xbe, 0x2d, 0x2b, 0x31, 0xb9, 0x70, 0x66,
+     0x4e, 0xbc, 0x16, 0x13, 0x9a, 0x1f, 0xd9, 0x65, 0xa7, 0x35, 0xc7, 0x50,
+     0x1d, 0x34, 0x7a, 0x5e, 0x30, 0x68, 0xb4, 0x61, 0x7d, 0x74, 0x4f, 0x71,
+     0x12, 0x83, 0xc7, 0x55, 0x4d, 0x21, 0x46, 0xd6, 0x52, 0x2f, 0x13, 0x9b},
+    {0x1c, 0x77, 0xea, 0xae, 0x40, 0x33, 0x87, 0x66, 0xae, 0xdf, 0x80, 0xcf,
+     0x0a, 0x7e, 0xe8, 0x0f, 0x7f, 0xca, 0x1c, 0x54, 0x47, 0xba, 0x04, 0xdc,
+     0x56, 0x88, 0xa7, 0xe5, 0xee, 0xd0, 0xc3, 0x20, 0x9c, 0x45, 0xd9, 0x94,
+     0x8b, 0x24, 0x6c, 0xf7, 0xf3, 0x27, 0x78, 0x6d, 0x8d, 0xfb, 0x71, 0x6f},
+    {0x09, 0xae, 0xae, 0xe1, 0xdc, 0x8a, 0x03, 0x67, 0xb0, 0x99, 0xe8, 0xa6,
+     0xdf, 0x99, 0xc6, 0xd8, 0xf2, 0xfb, 0x16, 0x13, 0x08, 0x84, 0xfd, 0xf6,
+     0xc3, 0x6c, 0x73, 0x8f, 0xe7, 0x10, 0xcf, 0xa0, 0x8f, 0x30, 0x19, 0xa0,
+     0x1d, 0xd3, 0x96, 0x17, 0xf2, 0x11, 0xb3, 0x5c, 0xcd, 0x57, 0xfb, 0x06},
+    {0x10, 0xea, 0x6d, 0x2f, 0x66, 0xbd, 0x35, 0x03, 0x5d, 0xae, 0x76, 0xcb,
+     0xd4, 0xbe, 0xcb, 0x44, 0x6e, 0x60, 0xc4, 0x10, 0x5e, 0x1d, 0x8e, 0x57,
+     0xa7, 0x99, 0x08, 0xc6, 0x4d, 0xbb, 0x49, 0x1d, 0x16, 0xde, 0x23, 0xa0,
+     0x11, 0xa1, 0xc1, 0xd4, 0xa0, 0x83, 0xfc, 0xdd, 0x5a, 0x22, 0x8b, 0xe2},
+    {0x01, 0xfd, 0x1e, 0xa2, 0xeb, 0x62, 0x9a, 0xba, 0xaa, 0xd9, 0x02, 0xd1,
+     0xed, 0xa6, 0x91, 0x34, 0xc5, 0x86, 0x60, 0xa1, 0x43, 0xd6, 0x0e, 0x87,
+     0xbe, 0x1d, 0x30, 0x7f, 0x21, 0x95, 0xe0, 0x6e, 0x0d, 0x01, 0x8b, 0x4e,
+     0xe4, 0x10, 0x22, 0x75, 0xa1, 0x4b, 0x04, 0xbf, 0x46, 0x16, 0x16, 0xcc},
+    {0x0b, 0x53, 0xee, 0xa0, 0x13, 0x21, 0x2a, 0xdc, 0x24, 0x6d, 0xd1, 0x38,
+     0x22, 0xca, 0x77, 0x48, 0xcb, 0x43, 0x6f, 0x6c, 0x0f, 0x1d, 0x04, 0x39,
+     0x17, 0x8d, 0x98, 0xf2, 0x18, 0xaf, 0xa9, 0xcb, 0x68, 0x2c, 0x2c, 0x00,
+     0x58, 0x22, 0x1a, 0xce, 0xbc, 0x45, 0x6f, 0x67, 0x97, 0x60, 0xb8, 0x24},
+    {0x02, 0x33, 0xf5, 0x3f, 0xf4, 0x8c, 0x7c, 0x74, 0xba, 0x35, 0x91, 0x12,
+     0x63, 0x5f, 0x2d, 0xb8, 0x67, 0x5f, 0x69, 0x9c, 0x76, 0xd9, 0xcb, 0xc1,
+     0x7c, 0xbb, 0x30, 0xf7, 0xb1, 0x8e, 0xa9, 0x85, 0xf3, 0x8e, 0xf6, 0x1d,
+     0xe4, 0x49, 0x61, 0x82, 0x8c, 0x73, 0xfa, 0xc2, 0x02, 0x39, 0x6c, 0xa9},
+    {0x12, 0xe2, 0xd7, 0x02, 0xc8, 0xe1, 0x77, 0x0d, 0x99, 0x29, 0x61, 0x70,
+     0x05, 0x58, 0xd4, 0xb9, 0xb5, 0x56, 0x9d, 0x08, 0xbf, 0xf5, 0xe4, 0x2e,
+     0xe9, 0xe3, 0x52, 0x4e, 0x6c, 0x37, 0x59, 0x6f, 0x4a, 0xeb, 0x36, 0x4a,
+     0x2d, 0x7e, 0xa6, 0x8b, 0x48, 0x10, 0xdb, 0xf9, 0x74, 0x81, 0xf7, 0x9d},
+    {0x05, 0xac, 0x1e, 0x40, 0xb5, 0xcb, 0x45, 0xd7, 0xb8, 0x4a, 0xcb, 0x38,
+     0xa3, 0x8b, 0xb1, 0xc7, 0xd7, 0xfa, 0x54, 0x21, 0x7d, 0xf2, 0xcb, 0xeb,
+     0x81, 0x8b, 0x47, 0x32, 0x09, 0xf1, 0x12, 0x3b, 0x55, 0x4f, 0xb4, 0x2a,
+     0xd9, 0x34, 0xef, 0x96, 0x33, 0x19, 0xcd, 0xf6, 0x9c, 0xa3, 0x16, 0x6e},
+    {0x11, 0x96, 0x04, 0x2c, 0xe1, 0x86, 0x04, 0xe8, 0x08, 0xbf, 0x01, 0x7d,
+     0x69, 0x1d, 0xc2, 0xef, 0x64, 0x57, 0x23, 0x3c, 0x85, 0x4f, 0x0c, 0x67,
+     0x44, 0x50, 0x74, 0xad, 0x03, 0xa1, 0x2a, 0x6d, 0x25, 0x83, 0x88, 0x0d,
+     0x0f, 0x87, 0x6a, 0x01, 0x13, 0x74, 0xfc, 0x49, 0x0e, 0x1e, 0xf2, 0x7a},
+    {0x08, 0xd9, 0x9e, 0x42, 0x12, 0xe4, 0xfe, 0x70, 0x27, 0x22, 0x28, 0x55,
+     0xdf, 0xfe, 0xa8, 0x64, 0x92, 0xb6, 0x72, 0xf6, 0x95, 0x0d, 0xcf, 0x58,
+     0x12, 0xe5, 0xe8, 0x3a, 0x7f, 0x0f, 0x2f, 0x78, 0xf5, 0x38, 0x03, 0x08,
+     0xda, 0x0a, 0x07, 0x78, 0x49, 0xd9, 0xa0, 0x76, 0x01, 0xe5, 0x91, 0x7f},
+    {0x1f, 0x4f, 0x0f, 0xc8, 0x68, 0x05, 0xda, 0x1a, 0xb3, 0xdc, 0x1a, 0xf9,
+     0xae, 0xb4, 0x2c, 0x1a, 0x4c, 0xfb, 0x99, 0x49, 0x55, 0x9c, 0x6a, 0xb7,
+     0x0d, 0x96, 0x71, 0xe3, 0xb7, 0xbc, 0xb2, 0xb6, 0x05, 0x6a, 0x1a, 0xb8,
+     0xdf, 0x3c, 0xea, 0xe5, 0x1e, 0xec, 0xcb, 0x71, 0xa7, 0x04, 0xb3, 0x81},
+    {0x0f, 0xf4, 0xa7, 0xdb, 0xb9, 0x0a, 0xda, 0x5d, 0xd5, 0xbe, 0xcc, 0x12,
+     0xd6, 0x28, 0xca, 0xb2, 0xc7, 0x55, 0x7e, 0x56, 0xe4, 0x77, 0x0a, 0xd9,
+     0xc6, 0x15, 0x0c, 0x5d, 0xd1, 0x25, 0xc9, 0x97, 0xd8, 0xfd, 0x1a, 0x13,
+     0xe3, 0xe2, 0x02, 0xff, 0x9d, 0x5b, 0x83, 0x00, 0x66, 0x65, 0x3d, 0x33},
+    {0x21, 0x21, 0x26, 0xd3, 0x57, 0xe6, 0x1b, 0xd1, 0xcf, 0x96, 0x28, 0x4d,
+     0x64, 0x91, 0xf5, 0x43, 0x74, 0x01, 0x76, 0xc5, 0xa1, 0xb1, 0xf2, 0x62,
+     0xd8, 0x3a, 0xeb, 0x70, 0x33, 0x61, 0xe3, 0x9c, 0xfb, 0xa4, 0xdd, 0xb2,
+     0x73, 0xc4, 0xd5, 0x2b, 0xd5, 0x57, 0xf5, 0xd3, 0xee, 0xbe, 0xbf, 0xc6},
+    {0x07, 0x5e, 0xc7, 0xe6, 0xe4, 0x01, 0x79, 0xcb, 0x96, 0x94, 0x7e, 0x08,
+     0x63, 0x12, 0xe6, 0x88, 0x05, 0xfb, 0x03, 0x6d, 0x5c, 0x61, 0xcb, 0x0e,
+     0x64, 0x17, 0x20, 0x9e, 0x29, 0x65, 0x97, 0x6c, 0x97, 0x2e, 0x52, 0x36,
+     0x11, 0x53, 0xbd, 0x7a, 0x47, 0x82, 0x32, 0x1a, 0xeb, 0x4c, 0x39, 0xcb},
+    {0x21, 0x37, 0xad, 0xeb, 0x35, 0x34, 0xfb, 0xc7, 0x34, 0x22, 0xdb, 0x54,
+     0xa8, 0x9a, 0x50, 0xa7, 0xd2, 0xdb, 0x04, 0xc7, 0xe0, 0x00, 0x1f, 0x8a,
+     0x2d, 0x7f, 0xe9, 0x3c, 0xf8, 0xca, 0x6b, 0x50, 0x4f, 0xff, 0xd9, 0x14,
+     0xae, 0x49, 0xba, 0x60, 0x5e, 0xf5, 0x6a, 0xa7, 0x34, 0xb7, 0x01, 0xc3},
+    {0x1c, 0x47, 0xd7, 0x38, 0x11, 0xb9, 0x8b, 0x95, 0x6c, 0xf6, 0xaa, 0x8f,
+     0x79, 0xf9, 0x9b, 0x17, 0xe0, 0xf7, 0xfd, 0x1e, 0xfd, 0xa4, 0xac, 0xaf,
+     0x72, 0xb2, 0x01, 0xf5, 0xc1, 0x8e, 0xaf, 0x89, 0x4c, 0x57, 0xc1, 0xc6,
+     0xff, 0x92, 0x1b, 0x97, 0x66, 0xa5, 0xe2, 0x9b, 0xcf, 0xb7, 0x05, 0xf7},
+    {0x02, 0x86, 0xaa, 0xed, 0xdc, 0x36, 0xe2, 0x6c, 0xe3, 0x4f, 0xa2, 0x02,
+     0xc0, 0x40, 0xaf, 0xde, 0x8c, 0x4a, 0x62, 0x93, 0xef, 0x76, 0x55, 0x3f,
+     0x51, 0xbd, 0x97, 0xac, 0xbb, 0x64, 0xce, 0x5d, 0xe0, 0x95, 0x6a, 0xa4,
+     0x0e, 0xe9, 0x11, 0x74, 0x75, 0xac, 0xec, 0xf7, 0x8a, 0xbc, 0xd4, 0x38},
+    {0x1a, 0x40, 0x6c, 0xe5, 0xfb, 0x9c, 0xc2, 0x15, 0x55, 0x57, 0xda, 0x9a,
+     0x57, 0xfe, 0x77, 0x00, 0xfd, 0x7c, 0x54, 0x03, 0x73, 0xa4, 0x65, 0xab,
+     0xe0, 0x53, 0xa2, 0xd7, 0x00, 0xe9, 0xa6, 0x65, 0x36, 0x67, 0x7a, 0xae,
+     0xc8, 0x80, 0xd5, 0xd1, 0xb5, 0x6b, 0x85, 0x3b, 0x80, 0xd1, 0x49, 0x4f},
+    {0x0d, 0x8a, 0xda, 0xb2, 0xe7, 0x6a, 0xa7, 0xbb, 0x85, 0x09, 0x0d, 0x74,
+     0x70, 0x4b, 0x98, 0xfc, 0xe8, 0x91, 0x88, 0x60, 0xb7, 0x71, 0x2c, 0x78,
+     0xaa, 0xf0, 0x06, 0x50, 0x52, 0x78, 0xd7, 0xce, 0x06, 0x22, 0x70, 0xe8,
+     0x3e, 0x95, 0xa1, 0x05, 0x6c, 0x18, 0x21, 0xa3, 0x28, 0x44, 0x70, 0xb6},
+    {0x0e, 0xf0, 0xa7, 0xb2, 0xd5, 0xdb, 0x80, 0x5a, 0x33, 0xef, 0x52, 0x31,
+     0xf7, 0x7d, 0x6d, 0x40, 0x6a, 0x5d, 0x9d, 0x65, 0xde, 0x39, 0x40, 0x1e,
+     0x13, 0x7b, 0xfd, 0x0d, 0x74, 0x75, 0xf2, 0xd3, 0xaa, 0x1b, 0x48, 0x61,
+     0xc8, 0x90, 0x2f, 0x6e, 0x5c, 0x33, 0x73, 0x0b, 0xff, 0x22, 0xc8, 0xd9},
+    {0x03, 0xd5, 0x70, 0xf2, 0xbe, 0x50, 0xe5, 0x66, 0x4e, 0xd9, 0xa5, 0x9c,
+     0x6f, 0x81, 0x48, 0xee, 0x6d, 0xf0, 0xb0, 0x4d, 0xce, 0xe8, 0x3d, 0x61,
+     0x97, 0x5e, 0xbd, 0xb2, 0x36, 0xfd, 0x9b, 0x77, 0x4c, 0x96, 0xcb, 0x91,
+     0x1a, 0x79, 0xee, 0xe1, 0x4b, 0x24, 0x9f, 0xe4, 0x55, 0x24, 0xde, 0x90},
+    {0x20, 0x24, 0x49, 0xfe, 0xd6, 0xc4, 0x3c, 0x73, 0x8a, 0x81, 0xe3, 0x4d,
+     0x84, 0xed, 0xfc, 0x45, 0xa4, 0x51, 0xb0, 0xa1, 0x44, 0xd8, 0x48, 0x09,
+     0x00, 0x91, 0x23, 0x69, 0x12, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0c,
+     0x00, 0x60, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08}};
+#endif
+
+static const field field_sqrt_e = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x48, 0x93,
+    0xfd, 0xad, 0x88, 0x78, 0xe7, 0x15, 0x03, 0xc6, 0x9b, 0x09, 0xdb, 0xf8,
+    0x8b, 0x48, 0xa3, 0x61, 0x42, 0x89, 0xb0, 0x90, 0x12, 0x01, 0x22, 0x46,
+    0xd2, 0x24, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xc1, 0x81};
+
+#if defined(CODA_HOST)
+static const fe_packed schnorr_state[sponge_size] = {
+    {0xc07f3f33d8281263, 0x81efc8d39903b04f, 0x5b72f2bfe781ac7e,
+     0xd3918f0e15f3f4cc, 0xbc5336ce473cde92, 0x21cb78248c4cd55a},
+    {0x888f7d84ea78726c, 0x5f4002c55f69a839, 0xde08fa7aecfd9607,
+     0xfc292f9f53ec8271, 0x5c587bf7613d2e0a, 0x032b004af390864f},
+    {0xc1cf50b953173d1f, 0xf489a8e71d226f5d, 0x96fae87bd90623fd,
+     0x6d6df84c21772f37, 0xf3fcb142031187db, 0x0964be1e235ee760}};
+#else
+static const fe_packed schnorr_state[sponge_size] = {
+    {0x21, 0xcb, 0x78, 0x24, 0x8c, 0x4c, 0xd5, 0x5a, 0xbc, 0x53, 0x36, 0xce,
+     0x47, 0x3c, 0xde, 0x92, 0xd3, 0x91, 0x8f, 0x0e, 0x15, 0xf3, 0xf4, 0xcc,
+     0x5b, 0x72, 0xf2, 0xbf, 0xe7, 0x81, 0xac, 0x7e, 0x81, 0xef, 0xc8, 0xd3,
+     0x99, 0x03, 0xb0, 0x4f, 0xc0, 0x7f, 0x3f, 0x33, 0xd8, 0x28, 0x12, 0x63},
+    {0x03, 0x2b, 0x00, 0x4a, 0xf3, 0x90, 0x86, 0x4f, 0x5c, 0x58, 0x7b, 0xf7,
+     0x61, 0x3d, 0x2e, 0x0a, 0xfc, 0x29, 0x2f, 0x9f, 0x53, 0xec, 0x82, 0x71,
+     0xde, 0x08, 0xfa, 0x7a, 0xec, 0xfd, 0x96, 0x07, 0x5f, 0x40, 0x02, 0xc5,
+     0x5f, 0x69, 0xa8, 0x39, 0x88, 0x8f, 0x7d, 0x84, 0xea, 0x78, 0x72, 0x6c},
+    {0x09, 0x64, 0xbe, 0x1e, 0x23, 0x5e, 0xe7, 0x60, 0xf3, 0xfc, 0xb1, 0x42,
+     0x03, 0x11, 0x87, 0xdb, 0x6d, 0x6d, 0xf8, 0x4c, 0x21, 0x77, 0x2f, 0x37,
+     0x96, 0xfa, 0xe8, 0x7b, 0xd9, 0x06, 0x23, 0xfd, 0xf4, 0x89, 0xa8, 0xe7,
+     0x1d, 0x22, 0x6f, 0x5d, 0xc1, 0xcf, 0x50, 0xb9, 0x53, 0x17, 0x3d, 0x1f}};
+#endif
+
+// fnv-1a of the tables above, as built, see curve_tables_ok
+#if defined(CODA_HOST)
+#define curve_tables_checksum 0xe2e1f268
+#else
+#define curve_tables_checksum 0xc5e33ccc
+#endif
+
+static inline unsigned int curve_tables_sum(void) {
+  unsigned int h = tables_checksum_init;
+  h = tables_checksum(h, &field_modulus, sizeof(field_modulus));
+  h = tables_checksum(h, &group_order, sizeof(group_order));
+#if !defined(CODA_HOST)
+  h = tables_checksum(h, &field_r2, sizeof(field_r2));
+#endif
+  h = tables_checksum(h, &field_one, sizeof(field_one));
+  h = tables_checksum(h, &group_coeff_b, sizeof(group_coeff_b));
+  h = tables_checksum(h, &group_zero, sizeof(group_zero));
+  h = tables_checksum(h, &group_one, sizeof(group_one));
+  h = tables_checksum(h, &group_comb, sizeof(group_comb));
+#if defined(CODA_HOST)
+  h = tables_checksum(h, &glv_beta, sizeof(glv_beta));
+  h = tables_checksum(h, &glv_a1, sizeof(glv_a1));
+  h = tables_checksum(h, &glv_b1, sizeof(glv_b1));
+  h = tables_checksum(h, &glv_a2, sizeof(glv_a2));
+  h = tables_checksum(h, &glv_b2, sizeof(glv_b2));
+  h = tables_checksum(h, &glv_g1, sizeof(glv_g1));
+  h = tables_checksum(h, &glv_g2, sizeof(glv_g2));
+  h = tables_checksum(h, &glv_half, sizeof(glv_half));
+#endif
+  h = tables_checksum(h, &field_sqrt_roots, sizeof(field_sqrt_roots));
+  h = tables_checksum(h, &field_sqrt_e, sizeof(field_sqrt_e));
+  h = tables_checksum(h, &schnorr_state, sizeof(schnorr_state));
+  return h;
+}
+
+#endif // CURVE_TABLES
@@ -0,0 +1,140 @@
+#include <os.h>
+#include "decimal.h"
+
+// the Cortex-M0 has neither a divider nor a long multiply, so every / and %
+// on a uint64_t is a libgcc loop. everything here divides by constants
+// instead, by multiplying with a precomputed reciprocal.
+
+// returns the high half of the 128 bit product a * b and stores the low half
+// in lo, built from 32 bit partial products
+static uint64_t mul_hi(uint64_t a, uint64_t b, uint64_t *lo) {
+  uint64_t a0 = (uint32_t)a, a1 = a >> 32;
+  uint64_t b0 = (uint32_t)b, b1 = b >> 32;
+  uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+  *lo = (mid << 32) | (uint32_t)p00;
+  return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+}
+
+// chunk = 10^19 is the largest power of ten below 2^64. its top bit is set,
+// so it is already normalized for the 2-by-1 division of Moller and Granlund,
+// "Improved division by invariant integers", with the reciprocal
+// chunk_inv = floor((2^128 - 1) / chunk) - 2^64
+#define chunk_digits 19
+static const uint64_t chunk = 10000000000000000000ULL;
+static const uint64_t chunk_inv = 0xd83c94fb6d2ac34aULL;
+
+// div_chunk divides u1:u0 by chunk, which requires u1 < chunk. it returns
+// the quotient and stores the remainder in r.
+static uint64_t div_chunk(uint64_t u1, uint64_t u0, uint64_t *r) {
+  uint64_t q0;
+  uint64_t q1 = mul_hi(chunk_inv, u1, &q0);
+  q0 += u0;
+  q1 += u1 + 1 + (q0 < u0);
+  uint64_t rem = u0 - q1 * chunk;
+  if (rem > q0) {
+    q1--;
+    rem += chunk;
+  }
+  if (rem >= chunk) {
+    q1++;
+    rem -= chunk;
+  }
+  *r = rem;
+  return q1;
+}
+
+// n / 100, as compilers emit it on 64 bit targets
+static uint64_t div100(uint64_t n) {
+  uint64_t lo;
+  if ((n >> 32) == 0) {
+    return ((uint64_t)(uint32_t)n * 0x51eb851fULL) >> 37;
+  }
+  return mul_hi(n >> 2, 0x28f5c28f5c28f5c3ULL, &lo) >> 2;
+}
+
+static const char digit_pairs[200] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+// put_chunk writes the digits of n < chunk right to left, two at a time,
+// ending just before end, and returns where they start. with pad it writes
+// exactly chunk_digits digits, leading zeros included.
+static uint8_t *put_chunk(uint8_t *end, uint64_t n, int pad) {
+  int digits = 0;
+  while (n >= 100 || (pad && digits < chunk_digits - 1)) {
+    uint64_t q = div100(n);
+    const char *p = digit_pairs + 2 * (n - q * 100);
+    *--end = p[1];
+    *--end = p[0];
+    digits += 2;
+    n = q;
+  }
+  if (n >= 10) {
+    *--end = digit_pairs[2 * n + 1];
+    *--end = digit_pairs[2 * n];
+  } else if (n > 0 || pad || digits == 0) {
+    *--end = '0' + n;
+  }
+  return end;
+}
+
+int nat2dec(uint8_t *dst, uint64_t nat[], int len) {
+  uint8_t buf[dec_digits];
+  uint8_t *p = buf + sizeof(buf);
+  while (len > 0 && nat[len-1] == 0) {
+    len--;
+  }
+
+  // peel off chunk_digits digits at a time, least significant first. every
+  // chunk but the leading one is zero padded.
+  for (;;) {
+    uint64_t r = 0;
+    for (int i = len - 1; i >= 0; i--) {
+      nat[i] = div_chunk(r, nat[i], &r);
+    }
+    while (len > 0 && nat[len-1] == 0) {
+      len--;
+    }
+    p = put_chunk(p, r, len > 0);
+    if (len == 0) {
+      break;
+    }
+  }
+
+  int n = buf + sizeof(buf) - p;
+  os_memmove(dst, p, n);
+  dst[n] = '\0';
+  return n;
+}
+
+int bin2dec(uint8_t *dst, uint64_t n) {
+  uint64_t nat[1] = { n };
+  return nat2dec(dst, nat, 1);
+}
+
+#define ZEROS 24
+
+int format(uint8_t *buf, uint8_t dec_len) {
+  if (dec_len < ZEROS + 1) {
+    // if < 1, pad with leading zeros
+    os_memmove(buf + (ZEROS + 1 - dec_len), buf, dec_len+1);
+    os_memset(buf, '0', ZEROS + 1 - dec_len);
+    dec_len = ZEROS + 1;
+  }
+  // add decimal point; dec_len is now the index of the last digit
+  os_memmove(buf + (dec_len - ZEROS) + 1, buf + (dec_len - ZEROS), ZEROS + 1);
+  buf[dec_len - ZEROS] = '.';
+  // trim trailing zeros, and add units
+  while (buf[dec_len] == '0') {
+    dec_len--;
+  }
+  if (buf[dec_len] == '.') {
+    dec_len--;
+  }
+  os_memmove(buf + dec_len + 1, " CODA", 6);
+  return dec_len + 6;
+}
@@ -0,0 +1,61 @@
+#ifndef CODA_FIELD
+#define CODA_FIELD
+
+// Included from crypto.h, after the sizes.
+//
+// Field elements are handles (fe) on operands that stay resident in the
+// arithmetic backend, in montgomery form: slots of a static limb pool on the
+// host (host/field.c), cx_bn slots of the crypto coprocessor on the device.
+// Handles are only valid inside a session:
+//
+//   fe_begin();                    // locks the coprocessor, sessions nest
+//   unsigned int mark = fe_mark();
+//   fe t = fe_new();               // stack discipline, no free
+//   ...
+//   fe_release(mark);              // gives back everything after mark
+//   fe_end();
+//
+// Values that outlive a session (the constant tables, the poseidon state
+// between apdus) are kept packed, in the same montgomery form, and moved in
+// and out with fe_load and fe_store. Canonical bytes are only seen at the
+// API boundary, through fe_from_bytes and fe_to_bytes.
+
+#if defined(CODA_HOST)
+#include <stdint.h>
+#define field_limbs (field_bytes / 8)
+typedef uint64_t *fe;
+typedef uint64_t fe_packed[field_limbs];      // limbs, least significant first
+#else
+typedef cx_bn_t fe;
+typedef unsigned char fe_packed[field_bytes]; // big endian
+#endif
+
+// enough for the ladder of group_scalar_mul and a poseidon permutation
+#define fe_slots 24
+
+void fe_begin(void);
+void fe_end(void);
+void fe_reset(void); // drops a session left open by an exception
+
+fe fe_new(void);
+unsigned int fe_mark(void);
+void fe_release(unsigned int mark);
+
+void fe_load(fe r, const fe_packed a);
+void fe_store(fe_packed r, const fe a);
+void fe_from_bytes(fe r, const field a); // reduces a mod p
+void fe_to_bytes(field r, const fe a);
+
+void fe_copy(fe r, const fe a);
+unsigned int fe_eq(const fe a, const fe b);
+unsigned int fe_is_zero(const fe a);
+
+void fe_add(fe c, const fe a, const fe b);
+void fe_sub(fe c, const fe a, const fe b);
+void fe_neg(fe c, const fe a);
+void fe_mul(fe c, const fe a, const fe b);
+void fe_sq(fe c, const fe a);
+void fe_inv(fe c, const fe a);
+void fe_pow(fe c, const fe a, const unsigned char *e, unsigned int len_e);
+
+#endif // CODA_FIELD
@@ -6,6 +6,14 @@
 
 static pubkey_context *ctx = &global.pk;
 
+// INS_PUBLIC_KEY replies with x || y, or with P1_COMPRESSED with the
+// compressed form of the key
+#define P1_AFFINE     0x00
+#define P1_COMPRESSED 0x01
+
+// the compare screen scrolls through the hex of the compressed key
+#define compare_chars (2 * compressed_bytes)
+
 static const bagl_element_t ui_pubkey_compare[] = {
   UI_BACKGROUND(),
   UI_ICON_LEFT(0x01, BAGL_GLYPH_ICON_LEFT),
@@ -16,7 +24,7 @@ static const bagl_element_t ui_pubkey_compare[] = {
 
 static const bagl_element_t* ui_prepro_pubkey_compare(const bagl_element_t *element) {
   if ((element->component.userid == 1 && ctx->display_index == 0) ||
-      (element->component.userid == 2 && ctx->display_index == affine_bytes-12)) {
+      (element->component.userid == 2 && ctx->display_index == compare_chars-12)) {
     return NULL;
   }
   return element;
@@ -35,7 +43,7 @@ static unsigned int ui_pubkey_compare_button(unsigned int button_mask, unsigned
 
   case BUTTON_RIGHT:
   case BUTTON_EVT_FAST | BUTTON_RIGHT: // SEEK RIGHT
-    if (ctx->display_index < affine_bytes-12) {
+    if (ctx->display_index < compare_chars-12) {
       ctx->display_index++;
     }
     os_memmove(ctx->partial_str, ctx->full_str+ctx->display_index, 12);
@@ -58,27 +66,6 @@ void bin2hex(uint8_t *dst, uint8_t *data, uint64_t inlen) {
   dst[2*inlen] = '\0';
 }
 
-
-int bin2dec(uint8_t *dst, uint64_t n) {
-  if (n == 0) {
-    dst[0] = '0';
-    dst[1] = '\0';
-    return 1;
-  }
-  // determine final length
-  int len = 0;
-  for (uint64_t nn = n; nn != 0; nn /= 10) {
-    len++;
-  }
-  // write digits in big-endian order
-  for (int i = len-1; i >= 0; i--) {
-    dst[i] = (n % 10) + '0';
-    n /= 10;
-  }
-  dst[len] = '\0';
-  return len;
-}
-
 static const bagl_element_t ui_pubkey_approve[] = {
   UI_BACKGROUND(),
   UI_ICON_LEFT(0x00, BAGL_GLYPH_ICON_CROSS),
@@ -90,7 +77,7 @@ static const bagl_element_t ui_pubkey_approve[] = {
 static unsigned int ui_pubkey_approve_button(unsigned int button_mask, unsigned int button_mask_counter) {
   uint16_t tx = 0;
   affine public_key;
-  scalar priv_key;
+  unsigned char packed[compressed_bytes];
   switch (button_mask) {
   case BUTTON_EVT_RELEASED | BUTTON_LEFT: // REJECT
     io_exchange_with_code(SW_USER_REJECTED, 0);
@@ -98,12 +85,18 @@ static unsigned int ui_pubkey_approve_button(unsigned int button_mask, unsigned
     break;
 
   case BUTTON_EVT_RELEASED | BUTTON_RIGHT: // APPROVE
-    generate_keypair(ctx->key_index, &public_key, priv_key);
-    os_memmove(G_io_apdu_buffer + tx, &public_key, affine_bytes);
-    tx += affine_bytes;
+    get_pubkey(ctx->key_index, &public_key);
+    affine_compress(packed, &public_key);
+    if (ctx->compressed) {
+      os_memmove(G_io_apdu_buffer + tx, packed, compressed_bytes);
+      tx += compressed_bytes;
+    } else {
+      os_memmove(G_io_apdu_buffer + tx, &public_key, affine_bytes);
+      tx += affine_bytes;
+    }
     io_exchange_with_code(SW_OK, tx);
     os_memmove(ctx->type_str, "Compare:", 9);
-    bin2hex(ctx->full_str, G_io_apdu_buffer, field_bytes);
+    bin2hex(ctx->full_str, packed, compressed_bytes);
     os_memmove(ctx->partial_str, ctx->full_str, 12);
     ctx->partial_str[12] = '\0';
     ctx->display_index = 0;
@@ -114,7 +107,12 @@ static unsigned int ui_pubkey_approve_button(unsigned int button_mask, unsigned
 }
 
 void handle_pubkey(uint8_t p1, uint8_t p2, uint8_t *data_buffer, uint16_t data_length, volatile unsigned int *flags, volatile unsigned int *tx) {
+  batch_clear();
 
+  if (p1 != P1_AFFINE && p1 != P1_COMPRESSED) {
+    THROW(SW_INVALID_PARAM);
+  }
+  ctx->compressed = (p1 == P1_COMPRESSED);
   ctx->key_index = U4LE(data_buffer, 0);
   os_memmove(ctx->type_str, "Generate Public", 16);
   os_memmove(ctx->key_str, "Key #", 5);
@@ -124,3 +122,95 @@ void handle_pubkey(uint8_t p1, uint8_t p2, uint8_t *data_buffer, uint16_t data_l
 
   *flags |= IO_ASYNCH_REPLY;
 }
+
+// INS_PUBLIC_KEYS: with P1_FIRST the data is the start index and the count,
+// both u32 little endian, and the user approves the whole range once. the
+// reply holds the first pubkeys_per_reply keys in compressed form, each
+// P1_MORE that follows the next ones, until the range is done
+#define P1_FIRST 0x00
+#define P1_MORE  0x01
+#define pubkeys_per_reply (apdu_data_max / compressed_bytes)
+
+// the approved range, outside of global so that it is not lost to the other
+// commands the host may send between two replies
+static uint32_t batch_next;
+static uint32_t batch_end;
+
+// keys already in the flash table are not derived again, the others are
+// derived with generate_keypair directly so that a long range does not
+// evict the ram cache and the flash table
+static uint16_t pubkeys_reply(void) {
+  uint16_t tx = 0;
+  affine public_key;
+  scalar priv_key;
+  for (unsigned int i = 0; i < pubkeys_per_reply && batch_next < batch_end; i++) {
+    if (!pubkey_store_lookup(batch_next, &public_key)) {
+      generate_keypair(batch_next, &public_key, priv_key);
+      os_memset(priv_key, 0, scalar_bytes);
+    }
+    affine_compress(G_io_apdu_buffer + tx, &public_key);
+    tx += compressed_bytes;
+    batch_next++;
+  }
+  return tx;
+}
+
+static const bagl_element_t ui_pubkeys_approve[] = {
+  UI_BACKGROUND(),
+  UI_ICON_LEFT(0x00, BAGL_GLYPH_ICON_CROSS),
+  UI_ICON_RIGHT(0x00, BAGL_GLYPH_ICON_CHECK),
+  UI_TEXT(0x00, 0, 12, 128, global.pk.type_str),
+  UI_TEXT(0x00, 0, 26, 128, global.pk.key_str),
+};
+
+static unsigned int ui_pubkeys_approve_button(unsigned int button_mask, unsigned int button_mask_counter) {
+  switch (button_mask) {
+  case BUTTON_EVT_RELEASED | BUTTON_LEFT: // REJECT
+    io_exchange_with_code(SW_USER_REJECTED, 0);
+    ui_idle();
+    break;
+
+  case BUTTON_EVT_RELEASED | BUTTON_RIGHT: // APPROVE
+    batch_next = ctx->key_index;
+    batch_end = ctx->key_index + ctx->key_count;
+    io_exchange_with_code(SW_OK, pubkeys_reply());
+    ui_idle();
+    break;
+  }
+  return 0;
+}
+
+void handle_pubkeys(uint8_t p1, uint8_t p2, uint8_t *data_buffer, uint16_t data_length, volatile unsigned int *flags, volatile unsigned int *tx) {
+  batch_clear();
+
+  if (p1 == P1_MORE) {
+    if (batch_next >= batch_end) {
+      THROW(SW_IMPROPER_INIT);
+    }
+    io_exchange_with_code(SW_OK, pubkeys_reply());
+    return;
+  }
+  if (p1 != P1_FIRST || data_length < 8) {
+    THROW(SW_INVALID_PARAM);
+  }
+
+  // accounts are hardened indices, below 2^31
+  ctx->key_index = U4LE(data_buffer, 0);
+  ctx->key_count = U4LE(data_buffer, 4);
+  if (ctx->key_count == 0 || ctx->key_index >= 0x80000000 ||
+      ctx->key_count > 0x80000000 - ctx->key_index) {
+    THROW(SW_INVALID_PARAM);
+  }
+  batch_next = batch_end = 0;
+
+  os_memmove(ctx->type_str, "Export Public Keys", 19);
+  os_memmove(ctx->key_str, "#", 1);
+  int n = 1 + bin2dec(ctx->key_str + 1, ctx->key_index);
+  os_memmove(ctx->key_str + n, " to #", 5);
+  n += 5;
+  n += bin2dec(ctx->key_str + n, ctx->key_index + ctx->key_count - 1);
+  os_memmove(ctx->key_str + n, "?", 2);
+  UX_DISPLAY(ui_pubkeys_approve, NULL);
+
+  *flags |= IO_ASYNCH_REPLY;
+}
@@ -20,6 +20,7 @@
 #include <os_io_seproxyhal.h>
 #include "glyphs.h"
 #include "crypto.h"
+#include "poseidon.h"
 #include "ux.h"
 
 command_context global;
@@ -58,6 +59,7 @@ void ui_idle(void) {
 #define INS_PUBLIC_KEY    0x02
 #define INS_SIGN          0x04
 #define INS_HASH          0x08
+#define INS_PUBLIC_KEYS   0x10
 
 typedef void handler_fn_t(uint8_t p1, uint8_t p2, uint8_t *dataBuffer, uint16_t dataLength, volatile unsigned int *flags, volatile unsigned int *tx);
 
@@ -65,6 +67,7 @@ handler_fn_t handle_version;
 handler_fn_t handle_pubkey;
 handler_fn_t handle_sign;
 handler_fn_t handle_hash;
+handler_fn_t handle_pubkeys;
 
 static handler_fn_t* lookupHandler(uint8_t ins) {
   switch (ins) {
@@ -72,6 +75,7 @@ static handler_fn_t* lookupHandler(uint8_t ins) {
   case INS_PUBLIC_KEY:  return handle_pubkey;
   case INS_SIGN:        return handle_sign;
   case INS_HASH:        return handle_hash;
+  case INS_PUBLIC_KEYS: return handle_pubkeys;
   default:              return NULL;
   }
 }
@@ -117,18 +121,35 @@ static void coda_main(void) {
         if (G_io_apdu_buffer[OFFSET_CLA] != CLA) {
           THROW(0x6E00);
         }
+        // An extended APDU has a zero byte where Lc would be, then the
+        // data length as a big-endian u16. Either way the length has to
+        // match what was received.
+        uint16_t lc = G_io_apdu_buffer[OFFSET_LC];
+        unsigned int cdata = OFFSET_CDATA;
+        if (lc == 0 && rx > OFFSET_CDATA) {
+          if (rx < OFFSET_CDATA + 2) {
+            THROW(0x6700);
+          }
+          lc = U2BE(G_io_apdu_buffer, OFFSET_CDATA);
+          cdata += 2;
+        }
+        if (cdata + lc != rx) {
+          THROW(0x6700);
+        }
         // Lookup and call the requested command handler.
         handler_fn_t *handlerFn = lookupHandler(G_io_apdu_buffer[OFFSET_INS]);
         if (!handlerFn) {
           THROW(0x6D00);
         }
         handlerFn(G_io_apdu_buffer[OFFSET_P1], G_io_apdu_buffer[OFFSET_P2],
-                  G_io_apdu_buffer + OFFSET_CDATA, G_io_apdu_buffer[OFFSET_LC], &flags, &tx);
+                  G_io_apdu_buffer + cdata, lc, &flags, &tx);
       }
       CATCH(EXCEPTION_IO_RESET) {
         THROW(EXCEPTION_IO_RESET);
       }
       CATCH_OTHER(e) {
+        // an exception may leave a field arithmetic session open
+        fe_reset();
         switch (e & 0xF000) {
         case 0x6000:
         case 0x9000:
@@ -180,6 +201,8 @@ unsigned char io_event(unsigned char channel) {
     break;
 
   case SEPROXYHAL_TAG_TICKER_EVENT:
+    key_cache_tick();
+    sign_tick();
     UX_TICKER_EVENT(G_io_seproxyhal_spi_buffer, {});
     break;
 
@@ -221,6 +244,9 @@ unsigned short io_exchange_al(unsigned char channel, unsigned short tx_len) {
 static void app_exit(void) {
   BEGIN_TRY_L(exit) {
     TRY_L(exit) {
+      sign_discard();
+      batch_clear();
+      key_cache_clear();
       os_sched_exit(-1);
     }
     FINALLY_L(exit) {
@@ -238,6 +264,10 @@ __attribute__((section(".boot"))) int main(void) {
     os_boot();
     BEGIN_TRY {
       TRY {
+        // do not sign with tables that differ from what gen_tables.py wrote
+        if (!curve_tables_ok() || !poseidon_tables_ok()) {
+          THROW(SW_DEVELOPER_ERR);
+        }
         io_seproxyhal_init();
         USB_power(0);
         USB_power(1);
@@ -245,7 +275,11 @@ __attribute__((section(".boot"))) int main(void) {
         coda_main();
       }
       CATCH(EXCEPTION_IO_RESET) {
-        // reset IO and UX before continuing
+        // reset IO and UX before continuing, forgetting the cached keys,
+        // any signature under review and any approved batch
+        sign_discard();
+        batch_clear();
+        key_cache_clear();
         continue;
       }
       CATCH_ALL {
@@ -2,6 +2,7 @@
 #include "cx.h"
 #include "crypto.h"
 #include "poseidon.h"
+#include "poseidon_tables.h"
 
 /* poseidon is used to hash to a field in the schnorr signature scheme
  * we use, but due to it being implemented in order to be efficiently
@@ -12,1377 +13,287 @@
  * as a field.
  */
 
-static const field round_keys[rounds][sponge_size] = {
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xac, 0xb6, 0x46, 0x32, 0x16, 0x9b, 0x32, 0xea,
-      0xac, 0xa0, 0x21, 0xd8, 0x5a, 0x37, 0xe6, 0x2b, 0x12, 0x74, 0x4b, 0xd1,
-      0x2a, 0x71, 0xc3, 0x79, 0xa9, 0x40, 0x45, 0x3a, 0xf4, 0x3f, 0xb6, 0x2d},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5c, 0xac, 0xb0, 0xc7, 0x34, 0x9e, 0x78, 0x28,
-      0x1b, 0xb7, 0x87, 0x05, 0x51, 0xe5, 0x52, 0xe6, 0x99, 0xa3, 0xb7, 0x37,
-      0x3f, 0x85, 0xac, 0xd3, 0xc7, 0x90, 0x44, 0x9c, 0x2a, 0x8a, 0x67, 0xa7},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa4, 0xeb, 0x12, 0x2d, 0xcd, 0xaf, 0x65, 0x17,
-      0xb7, 0x07, 0xed, 0x42, 0xd6, 0xcb, 0x7a, 0x07, 0x7d, 0xa7, 0x01, 0x68,
-      0xa7, 0x5c, 0x78, 0xa9, 0x41, 0xc1, 0x1d, 0xc9, 0x80, 0x6f, 0xa1, 0x69}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd4, 0xb8, 0x30, 0xa0, 0xcb, 0x1a, 0x4d, 0x53,
-      0xa3, 0x1b, 0x9b, 0x11, 0xd0, 0xda, 0x41, 0x52, 0x65, 0x71, 0x2e, 0x3d,
-      0xd0, 0x2e, 0xba, 0x24, 0x67, 0xe7, 0x39, 0x5d, 0xee, 0x4d, 0x4c, 0x54},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x8d, 0xa6, 0xac, 0xe6, 0xa2, 0x9e, 0x6c, 0xc4,
-      0x49, 0x3a, 0x58, 0x47, 0x36, 0x2d, 0x00, 0x5b, 0x63, 0xf6, 0x1d, 0xe8,
-      0x1e, 0xc2, 0xd2, 0x86, 0x84, 0x40, 0x6c, 0x7c, 0xdd, 0x65, 0xbb, 0xf7},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf7, 0xe3, 0x7f, 0x99, 0x13, 0x4e, 0xbc, 0x0e,
-      0x76, 0x54, 0x86, 0x9b, 0xed, 0x1e, 0x44, 0x8c, 0xb2, 0x91, 0xf9, 0xcd,
-      0x55, 0x96, 0x73, 0x43, 0xbe, 0x04, 0xe7, 0xa9, 0x4d, 0x59, 0xd2, 0xe5}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xba, 0xfa, 0x31, 0x9e, 0xe4, 0xcf, 0x95, 0xab,
-      0x44, 0x48, 0x5a, 0x9e, 0xb0, 0x12, 0xc3, 0x7c, 0x04, 0xc3, 0xa5, 0x2d,
-      0x13, 0x4a, 0x79, 0x2d, 0x08, 0x74, 0xcd, 0x92, 0x21, 0x1c, 0x4e, 0x06},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x63, 0xee, 0xe9, 0xdb, 0x53, 0xe6, 0x4c, 0xcb,
-      0xf4, 0x17, 0x8e, 0x92, 0xce, 0x48, 0x09, 0xdd, 0xf5, 0x8f, 0x33, 0x8c,
-      0xf3, 0x0b, 0x4e, 0xb9, 0xb0, 0xea, 0xc9, 0x7b, 0x6e, 0xa7, 0x02, 0xc5},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x33, 0xc6, 0xda, 0xfd, 0x93, 0x09, 0x07, 0x51,
-      0xa7, 0x50, 0x84, 0x7a, 0x68, 0x53, 0xca, 0x9d, 0x50, 0xaa, 0x55, 0xf3,
-      0xaf, 0x8c, 0x55, 0x8d, 0xc5, 0x65, 0xab, 0xac, 0x48, 0x4b, 0x6b, 0x08}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x8b, 0xc5, 0xa9, 0x6f, 0x35, 0x38, 0x8c, 0x69,
-      0x62, 0x64, 0x23, 0x74, 0x15, 0x24, 0x8c, 0x1c, 0xdc, 0x12, 0x1c, 0x43,
-      0x62, 0xfe, 0xed, 0x9c, 0x44, 0x9b, 0x38, 0x57, 0xfe, 0x5d, 0x7d, 0xfd},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x96, 0x1e, 0x95, 0xcc, 0x0c, 0xea, 0x64, 0x42,
-      0x7b, 0x33, 0x4b, 0x69, 0xc3, 0x04, 0xdf, 0xc4, 0xe2, 0xac, 0xa6, 0xff,
-      0xa2, 0x28, 0xcb, 0x33, 0x06, 0x56, 0x5b, 0x41, 0x0b, 0x5a, 0x69, 0x63},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x7c, 0xa7, 0x27, 0xf1, 0xd2, 0x23, 0xf7, 0xab,
-      0xcd, 0xe6, 0x98, 0x98, 0x25, 0x8b, 0x03, 0x03, 0xd4, 0x89, 0x99, 0x2f,
-      0xcd, 0xbd, 0xed, 0x70, 0x08, 0xdf, 0xba, 0x26, 0x42, 0xd8, 0x99, 0x53}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xb1, 0x92, 0x4b, 0x2a, 0xd4, 0x3a, 0xc7, 0xee,
-      0xa5, 0xe9, 0x43, 0x00, 0xde, 0x7e, 0x21, 0x9e, 0x7d, 0x5d, 0xbb, 0xc4,
-      0xc4, 0xec, 0xe3, 0x6a, 0xa3, 0xe4, 0x1d, 0xf7, 0x21, 0x06, 0x76, 0xfd},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf5, 0x5a, 0xdc, 0x1b, 0x3e, 0x82, 0xfe, 0x72,
-      0x6c, 0x16, 0xe8, 0x11, 0xdd, 0x5d, 0x7e, 0x52, 0xcc, 0xa3, 0x58, 0x3f,
-      0xef, 0x56, 0x3e, 0x58, 0x6f, 0x11, 0x0c, 0x07, 0x69, 0xaa, 0xef, 0xcf},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x37, 0xb4, 0x4e, 0x88, 0xbd, 0xde, 0xab, 0x5d,
-      0x93, 0x0f, 0x5d, 0xea, 0x63, 0x22, 0x10, 0x85, 0x1e, 0xbf, 0x6a, 0x50,
-      0x2d, 0x46, 0xfc, 0x75, 0x94, 0x93, 0x33, 0x48, 0xbd, 0x19, 0xcd, 0x70}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf0, 0x3d, 0xe4, 0x86, 0x02, 0x0f, 0x0f, 0x7d,
-      0x47, 0xf9, 0x3f, 0xed, 0x5a, 0x6a, 0x72, 0xc0, 0xad, 0x26, 0xea, 0xc8,
-      0x2a, 0x2f, 0x78, 0x9f, 0xca, 0x49, 0xb1, 0x7a, 0x57, 0x14, 0xb3, 0xb8},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x27, 0x05, 0x25, 0x88, 0x91, 0x7d, 0x2a, 0x0b,
-      0x2b, 0x38, 0xa7, 0x76, 0xd7, 0xa4, 0x40, 0xee, 0x78, 0xa7, 0xf9, 0x0a,
-      0x61, 0xab, 0xe3, 0xc0, 0x3d, 0x8d, 0xa2, 0x88, 0xf7, 0x28, 0x8d, 0x96},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd2, 0x8d, 0xe9, 0x78, 0xd2, 0xec, 0x79, 0x3c,
-      0x2d, 0xb1, 0xbe, 0xf3, 0xd8, 0x11, 0x83, 0x0a, 0xab, 0x4b, 0xf9, 0x87,
-      0xa6, 0x8e, 0xb7, 0x4b, 0x1f, 0xa7, 0x98, 0x4d, 0x16, 0x96, 0xf5, 0x34}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5f, 0x66, 0x4d, 0x54, 0x4e, 0xd1, 0xd3, 0x27,
-      0xef, 0x1c, 0x1e, 0xdb, 0xf7, 0xb2, 0x9c, 0x1d, 0xa6, 0x55, 0x0c, 0x4e,
-      0x03, 0xfd, 0xbc, 0x13, 0x6d, 0x56, 0x9e, 0xc4, 0xe3, 0xde, 0xf3, 0x6c},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xab, 0x05, 0xe4, 0xe5, 0xb7, 0xb1, 0x0e, 0xd9,
-      0xa1, 0xae, 0x2b, 0xf7, 0x9f, 0x30, 0xb8, 0xcd, 0xdc, 0x5d, 0xe6, 0xd8,
-      0x46, 0x86, 0x0c, 0x7a, 0xbe, 0x2f, 0x47, 0xe5, 0x7d, 0x9f, 0x0e, 0xb6},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x13, 0x36, 0xc7, 0x2a, 0x14, 0xa1, 0x5e, 0x65,
-      0x28, 0xc3, 0x2f, 0x36, 0x2a, 0xd5, 0xbe, 0x64, 0xb7, 0xc0, 0x18, 0xd7,
-      0x31, 0x77, 0xbb, 0xe4, 0xef, 0x73, 0x98, 0xf3, 0x9c, 0x46, 0xed, 0x40}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf1, 0x5e, 0xfd, 0xd3, 0xda, 0x58, 0x1d, 0x6a,
-      0x9e, 0x93, 0x6c, 0x8d, 0xc1, 0xc5, 0x98, 0x91, 0x8c, 0xb5, 0x07, 0x5a,
-      0x16, 0xc7, 0x3f, 0xed, 0xa9, 0x5c, 0x1d, 0x20, 0xcd, 0x82, 0xe4, 0x9f},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x8f, 0x5c, 0x8c, 0x02, 0x8e, 0x04, 0xa4, 0xe5,
-      0xe6, 0xf1, 0xd1, 0xa0, 0x03, 0x17, 0x65, 0x74, 0xef, 0x61, 0x04, 0xe5,
-      0xd3, 0x54, 0x1d, 0x7c, 0x95, 0xf7, 0xf4, 0x2c, 0xdc, 0x10, 0x6d, 0x13},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5f, 0x97, 0x50, 0xab, 0x5b, 0x96, 0x18, 0x1e,
-      0xe7, 0xb6, 0xd1, 0x16, 0xe9, 0xf3, 0x85, 0x95, 0x85, 0x62, 0x37, 0x0d,
-      0xbb, 0xb5, 0x27, 0x98, 0xdf, 0xdc, 0x15, 0xc9, 0x98, 0x21, 0x51, 0xb7}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x05, 0xfa, 0xa8, 0xcb, 0xc1, 0x51, 0xd9, 0xc8,
-      0x4e, 0x81, 0xd9, 0x75, 0x30, 0x2e, 0x7e, 0x64, 0xf6, 0x7a, 0x0e, 0xef,
-      0xaf, 0x17, 0xb7, 0x13, 0x1f, 0x43, 0x97, 0xcd, 0x91, 0xc2, 0xde, 0xe8},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x93, 0xb3, 0x4c, 0x07, 0xd6, 0xb4, 0x70, 0xd9,
-      0x25, 0x5d, 0x67, 0x73, 0x85, 0x6c, 0x1e, 0xe8, 0x10, 0x67, 0x3c, 0xba,
-      0x0e, 0x16, 0x28, 0x52, 0x45, 0xca, 0x71, 0xc0, 0xec, 0xcc, 0xb0, 0x15},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x38, 0x77, 0xcc, 0xc5, 0xe2, 0xd5, 0x35, 0x0c,
-      0xd0, 0x1b, 0xc1, 0x70, 0xa6, 0x76, 0xd9, 0x73, 0x16, 0xf1, 0x26, 0x05,
-      0xf3, 0xff, 0x74, 0xda, 0x72, 0x47, 0x2f, 0xf8, 0xaf, 0x5f, 0x80, 0xf0}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xc5, 0x6e, 0x5b, 0x18, 0xc5, 0xf2, 0xa9, 0x93,
-      0x78, 0x0f, 0xf4, 0xc7, 0x65, 0x52, 0xac, 0xf1, 0xb4, 0x45, 0x8d, 0x12,
-      0x12, 0xd3, 0xa2, 0xf9, 0xd1, 0x71, 0x79, 0x92, 0x80, 0x74, 0x07, 0x2a},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x51, 0x69, 0xb0, 0x60, 0x58, 0x62, 0xa2, 0xd3,
-      0x41, 0x3f, 0x90, 0xf4, 0x7f, 0xe3, 0x38, 0xed, 0xb5, 0xb6, 0x58, 0x72,
-      0xa1, 0x0b, 0xd4, 0x1b, 0x42, 0xb0, 0xb0, 0x6c, 0x3d, 0xb9, 0xb1, 0x7c},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x98, 0x48, 0xf3, 0xe7, 0x9d, 0x6a, 0xea, 0xb4,
-      0xc5, 0x54, 0xb1, 0x12, 0xd1, 0x7d, 0xc2, 0x90, 0xb5, 0x20, 0x0f, 0x60,
-      0x12, 0x1f, 0x23, 0xdc, 0x81, 0x7b, 0x54, 0x45, 0x75, 0x4b, 0xdc, 0x75}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x97, 0x91, 0xd2, 0xe6, 0xb0, 0xb6, 0x26, 0x72,
-      0x6c, 0xfd, 0x07, 0x96, 0x09, 0xbf, 0x57, 0x64, 0x29, 0x89, 0x6e, 0x76,
-      0xfc, 0xc0, 0xfe, 0x87, 0x68, 0x58, 0x3e, 0xfd, 0x89, 0x70, 0x25, 0xfa},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf6, 0x3e, 0xb4, 0xd2, 0x2d, 0x57, 0xf7, 0xfd,
-      0x77, 0x2d, 0x1b, 0x94, 0x00, 0x10, 0x04, 0x84, 0x23, 0x63, 0x5b, 0x98,
-      0x29, 0xde, 0x36, 0x85, 0x7b, 0x30, 0x28, 0x57, 0x01, 0x7d, 0xc8, 0x11},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xe0, 0x55, 0x86, 0x31, 0x65, 0x8a, 0xdc, 0xc4,
-      0xb7, 0x1c, 0xb4, 0x5b, 0xde, 0x38, 0xf4, 0xe8, 0xd0, 0x2d, 0x42, 0xc9,
-      0x6e, 0x54, 0x66, 0x89, 0xe1, 0x38, 0x15, 0x67, 0x92, 0xe7, 0x2e, 0xe1}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xc2, 0x28, 0x3d, 0xd5, 0x3c, 0xa1, 0xf5, 0xe3,
-      0xc3, 0xe1, 0xd7, 0x2a, 0x1f, 0x10, 0x0a, 0x70, 0x2a, 0xf3, 0x27, 0x44,
-      0xfe, 0x6d, 0x1a, 0x53, 0x48, 0xea, 0x9d, 0x17, 0xa8, 0xa8, 0x1d, 0x12},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x18, 0x71, 0x20, 0x93, 0xa9, 0xb1, 0xf6, 0x4d,
-      0x5b, 0x64, 0xdc, 0x0a, 0xe7, 0x20, 0x11, 0x60, 0x27, 0xa4, 0xdb, 0x31,
-      0xaf, 0xe7, 0x20, 0xe9, 0xd0, 0x69, 0xfb, 0x44, 0xbc, 0xea, 0xd0, 0xcf},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf7, 0x7f, 0x18, 0x79, 0x4b, 0x5b, 0x4b, 0xef,
-      0xf2, 0x00, 0x9d, 0x9d, 0x03, 0x7d, 0x56, 0x48, 0x82, 0x26, 0xe4, 0x7e,
-      0x4a, 0xf4, 0x2d, 0xff, 0xd3, 0xc9, 0x45, 0xf7, 0x73, 0x8e, 0x90, 0x31}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd3, 0x6c, 0xac, 0x1b, 0x7e, 0xe6, 0x10, 0x41,
-      0x30, 0xba, 0xb1, 0xc3, 0xa9, 0xa1, 0x28, 0x00, 0xb6, 0x34, 0x62, 0xd9,
-      0x56, 0xea, 0xa7, 0x56, 0x5c, 0xc2, 0x17, 0x83, 0x8b, 0x69, 0x10, 0x5a},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd1, 0xaa, 0x22, 0x0a, 0x13, 0xf2, 0x96, 0x21,
-      0x2f, 0x1e, 0xdc, 0xaa, 0xf9, 0xb1, 0x8a, 0xe3, 0xea, 0xa9, 0x17, 0x8f,
-      0xcc, 0x42, 0x0f, 0x18, 0x71, 0xc9, 0xc8, 0xa4, 0xe6, 0x58, 0x35, 0x2c},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xab, 0x84, 0x13, 0x4f, 0x82, 0x3d, 0x95, 0x4c,
-      0xaa, 0x59, 0x5e, 0x39, 0x0c, 0x6a, 0xe0, 0xf7, 0x04, 0xd3, 0x1d, 0x6e,
-      0xf0, 0x11, 0xbc, 0xa1, 0x79, 0x1b, 0x03, 0x82, 0x13, 0x9f, 0xac, 0x13}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x3d, 0x76, 0x06, 0x85, 0x96, 0x7f, 0x3c, 0x1e,
-      0xf6, 0x21, 0x02, 0x6c, 0xaa, 0xc2, 0xe0, 0xe9, 0xf1, 0xc6, 0x75, 0x94,
-      0xc8, 0xf3, 0xca, 0xd4, 0x1e, 0x28, 0x28, 0xec, 0x72, 0x49, 0x29, 0x36},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5e, 0x38, 0x15, 0xdf, 0xb5, 0x13, 0xbd, 0x46,
-      0x94, 0x4a, 0x3b, 0xff, 0x8b, 0x0e, 0xc1, 0xec, 0x6f, 0xed, 0x5a, 0xad,
-      0x56, 0x82, 0x1e, 0x27, 0xc2, 0x6e, 0x44, 0xd8, 0x60, 0x39, 0xd0, 0x3e},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd3, 0xfc, 0x79, 0x6a, 0xe9, 0xd3, 0xbf, 0xae,
-      0x59, 0xc5, 0xe9, 0x55, 0xe5, 0x8a, 0x01, 0x94, 0x14, 0xcc, 0x70, 0x41,
-      0xd3, 0x09, 0xd1, 0x7f, 0xc6, 0x4f, 0x21, 0xd1, 0x71, 0x0d, 0x71, 0x12}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xed, 0xbc, 0xac, 0x34, 0xfa, 0x1b, 0xe8, 0x4d,
-      0xcd, 0xa3, 0x41, 0xa8, 0x5b, 0x78, 0xc7, 0x9c, 0xf3, 0xd5, 0xef, 0x77,
-      0x05, 0x1b, 0x63, 0x1c, 0xec, 0x92, 0xc3, 0x89, 0xb7, 0xc9, 0x28, 0xba},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x26, 0x48, 0x99, 0x27, 0x97, 0xef, 0xb6, 0xe6,
-      0xd6, 0x00, 0x73, 0x99, 0x9a, 0x1a, 0x19, 0x6a, 0xd0, 0x94, 0x12, 0x28,
-      0x0e, 0xc2, 0x21, 0x8d, 0x5a, 0x0c, 0x1b, 0xaf, 0x27, 0x9f, 0x6c, 0xda},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x72, 0x22, 0x88, 0x93, 0x30, 0xd3, 0xd8, 0x41,
-      0xa1, 0x8e, 0x7a, 0x42, 0x8a, 0xd7, 0x0d, 0x50, 0x19, 0x6c, 0x88, 0xe3,
-      0xdc, 0x8f, 0x9d, 0xa1, 0xa0, 0x25, 0x08, 0x5d, 0x46, 0xe7, 0x72, 0xe4}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0xc3, 0x3e, 0xa9, 0x5a, 0x5d, 0xe0,
-      0xa4, 0xb5, 0xea, 0x6a, 0x75, 0x76, 0x24, 0xec, 0x35, 0x6e, 0x5e, 0x4e,
-      0x1a, 0x7b, 0xdd, 0x45, 0x6b, 0x1c, 0xbb, 0xd6, 0x8c, 0xbd, 0xb5, 0xe2},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf7, 0x73, 0xba, 0x73, 0xdf, 0x51, 0x3f, 0xd2,
-      0xbb, 0xc2, 0x7d, 0x4b, 0x8f, 0xf5, 0x6d, 0xaf, 0xf1, 0xe2, 0xf7, 0x81,
-      0xc3, 0xcb, 0xed, 0x04, 0xb1, 0x5b, 0x93, 0xff, 0xb9, 0xa1, 0xd0, 0xbb},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x7e, 0x58, 0xef, 0x87, 0x2b, 0x62, 0x28, 0x9d,
-      0xa9, 0xfe, 0xc1, 0x5e, 0x6e, 0x68, 0x6e, 0x6b, 0x6e, 0xe0, 0x7c, 0xdf,
-      0x6d, 0x2b, 0xb5, 0x6c, 0xab, 0x54, 0xbd, 0x59, 0xbf, 0xfe, 0x24, 0xcf}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xcb, 0x67, 0xd6, 0xee, 0x83, 0xb4, 0x42, 0xb4,
-      0x2c, 0x34, 0x78, 0x60, 0x32, 0x2d, 0xe8, 0xcc, 0x00, 0xe8, 0x73, 0x3b,
-      0xb4, 0xea, 0xa9, 0x4f, 0xc0, 0x94, 0x57, 0x86, 0x66, 0xfe, 0xa2, 0xcb},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x82, 0x04, 0x1e, 0xec, 0x89, 0x1b, 0xe8, 0xe9,
-      0x2c, 0xae, 0x8e, 0x7d, 0xf4, 0x8a, 0xbc, 0xe3, 0x5d, 0xb4, 0x45, 0xb8,
-      0x89, 0xeb, 0xba, 0xfa, 0x9a, 0xfa, 0xd0, 0xf3, 0x50, 0x44, 0x2a, 0x6d},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xce, 0xe5, 0x76, 0xa3, 0x63, 0x72, 0x5e, 0x5e,
-      0x2a, 0x49, 0x69, 0xe0, 0x8d, 0xde, 0x67, 0xdd, 0x8b, 0xbd, 0xdd, 0x52,
-      0xca, 0x81, 0x27, 0xba, 0x55, 0x56, 0xd8, 0x5e, 0x09, 0x5f, 0x2a, 0xea}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x67, 0x52, 0xa1, 0x54, 0xba, 0x67, 0xe9, 0x23,
-      0x5b, 0xd4, 0x1b, 0x07, 0x07, 0x37, 0x9f, 0x4b, 0xff, 0x35, 0x67, 0x6f,
-      0x15, 0xaf, 0xf2, 0x67, 0xbe, 0xa9, 0x01, 0xba, 0x18, 0x59, 0x7f, 0x09},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x1b, 0xc7, 0xce, 0xc4, 0x64, 0x6c, 0xfb, 0x0e,
-      0x9e, 0xea, 0x8c, 0xa6, 0x47, 0x6f, 0x2d, 0x8c, 0xb2, 0x20, 0xb4, 0x17,
-      0x6c, 0x9a, 0x2c, 0x04, 0xa2, 0x65, 0xb3, 0xab, 0xd7, 0x8f, 0xbc, 0x75},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x78, 0x04, 0x1d, 0x95, 0x2a, 0x10, 0x47, 0xcc,
-      0x9d, 0xd3, 0x6d, 0x0c, 0x67, 0x54, 0x23, 0xce, 0x36, 0xa8, 0x00, 0xd2,
-      0xb1, 0x53, 0x8b, 0x80, 0x0a, 0x75, 0xca, 0x8f, 0xda, 0x74, 0xfe, 0xa1}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xcb, 0x80, 0x6d, 0xe8, 0xcb, 0xab, 0x16, 0x48,
-      0x49, 0x1d, 0x86, 0x3f, 0xee, 0x79, 0x9d, 0xc6, 0x89, 0x55, 0x7a, 0x55,
-      0x18, 0xde, 0xd8, 0xed, 0x7c, 0x8c, 0xf7, 0x37, 0xab, 0x8e, 0x01, 0x90},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x21, 0x5f, 0xb2, 0xc5, 0x7d, 0x96, 0xa6, 0x89,
-      0x09, 0xa4, 0x3b, 0x43, 0x41, 0x40, 0xb3, 0xb9, 0x20, 0x71, 0xd6, 0xd2,
-      0x41, 0x82, 0x55, 0xfa, 0xf9, 0x04, 0x7d, 0xe9, 0x2a, 0xce, 0x0a, 0xed},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa9, 0x18, 0x54, 0x75, 0xd8, 0xa9, 0x52, 0x20,
-      0xc4, 0x29, 0x67, 0xfc, 0x67, 0x32, 0x5c, 0x6a, 0x25, 0x8e, 0x7b, 0xf6,
-      0x00, 0xf7, 0x4b, 0xd4, 0x71, 0x45, 0xd9, 0x1a, 0x4a, 0xd8, 0x9e, 0xbd}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x53, 0x8e, 0x5e, 0x76, 0x2d, 0xb8, 0x9e, 0xee,
-      0xcf, 0x54, 0x48, 0x15, 0x48, 0x26, 0x8d, 0xc8, 0x70, 0xa9, 0xbe, 0xd6,
-      0x58, 0x81, 0xc1, 0xc2, 0xb1, 0xcc, 0x2a, 0x1b, 0x58, 0xc3, 0xdf, 0x3a},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xbb, 0xd2, 0xc9, 0xf8, 0xa7, 0x0c, 0xed, 0x2c,
-      0xa2, 0x14, 0x68, 0x98, 0x74, 0xaa, 0xf4, 0x1b, 0xe4, 0x1b, 0x36, 0x8c,
-      0x3c, 0x6b, 0xa6, 0xaa, 0xf1, 0x3e, 0xd6, 0xd4, 0xd8, 0xc1, 0x59, 0xd5},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xb3, 0x56, 0x65, 0x76, 0x25, 0x76, 0xb3, 0xd4,
-      0x86, 0xf3, 0x06, 0x83, 0x4b, 0x08, 0xab, 0xe7, 0x70, 0xa7, 0xf2, 0xda,
-      0x80, 0xca, 0x95, 0x1a, 0xc2, 0xa8, 0xa8, 0xf9, 0x73, 0x3b, 0xa6, 0xe0}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x3e, 0x99, 0x11, 0x07, 0x83, 0xd9, 0x24, 0x40,
-      0x6d, 0x5b, 0xd0, 0xf9, 0x7e, 0xe3, 0x44, 0xb1, 0xf6, 0xc5, 0x16, 0xdc,
-      0x7c, 0x7a, 0x93, 0x04, 0x84, 0xc7, 0x6e, 0xa3, 0x1e, 0x75, 0x14, 0xbd},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x26, 0x43, 0xd2, 0x05, 0x73, 0x54, 0xa4, 0x7c,
-      0xb1, 0xca, 0x7a, 0x0a, 0x02, 0x7d, 0xf2, 0x84, 0x70, 0x91, 0xea, 0x74,
-      0x64, 0x17, 0xdd, 0x18, 0x2b, 0xf2, 0x61, 0xb5, 0xbd, 0xb9, 0xd8, 0x59},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x8b, 0x9c, 0xf0, 0x18, 0x5a, 0x5e, 0xc7, 0xdc,
-      0x68, 0x92, 0xbd, 0xbc, 0x30, 0x06, 0xd5, 0xfb, 0xac, 0xa6, 0xcc, 0xa7,
-      0x49, 0xce, 0xac, 0xec, 0xde, 0xcc, 0xe8, 0x52, 0xc0, 0x41, 0x63, 0x01}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x20, 0x8e, 0x05, 0x3d, 0x93, 0x1e, 0xef, 0x69,
-      0x7c, 0x30, 0x40, 0x5c, 0x3d, 0xc1, 0xe8, 0xb7, 0xe6, 0x9e, 0xef, 0x48,
-      0x62, 0x03, 0x34, 0x71, 0xf7, 0xd9, 0xb8, 0x7f, 0x0f, 0x03, 0xf7, 0xb6},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x0a, 0x5b, 0x9d, 0x29, 0x74, 0x36, 0x43, 0x9c,
-      0x6c, 0xda, 0xbf, 0xbc, 0x1f, 0x83, 0x33, 0x96, 0xc0, 0x83, 0x49, 0x57,
-      0xb4, 0x84, 0x09, 0x09, 0xb0, 0x2c, 0xdd, 0x5f, 0xcb, 0x10, 0xbd, 0xf8},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x8c, 0xcb, 0x2a, 0xc2, 0xba, 0x61, 0x93, 0xee,
-      0x9a, 0x5e, 0x43, 0x28, 0x99, 0x5e, 0x24, 0x55, 0xcf, 0x4a, 0x2a, 0x20,
-      0xb3, 0x77, 0x40, 0x13, 0xed, 0xe8, 0x97, 0xcd, 0x9c, 0x84, 0x2b, 0x6b}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x69, 0xa0, 0x5c, 0x02, 0x5e, 0xeb, 0x25, 0xcc,
-      0x57, 0x23, 0x5c, 0xc5, 0xf3, 0xd3, 0x70, 0xcc, 0x60, 0xef, 0xc3, 0x3b,
-      0x28, 0xfa, 0x36, 0x01, 0xac, 0xb8, 0x94, 0x8b, 0xa0, 0x5d, 0x7b, 0x1b},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5c, 0xe5, 0x21, 0x0d, 0xbd, 0x3e, 0xb5, 0x65,
-      0x0d, 0x9d, 0x31, 0x6c, 0x9d, 0xa2, 0x14, 0xab, 0xb7, 0x2a, 0x67, 0xba,
-      0xa5, 0xa4, 0x4d, 0xc8, 0xf9, 0xef, 0x81, 0xd0, 0xef, 0x99, 0xa9, 0x35},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x56, 0x99, 0x49, 0x70, 0xd6, 0x67, 0x29, 0x99,
-      0x62, 0xa9, 0xa4, 0xb5, 0x21, 0x20, 0xa4, 0xd6, 0x9e, 0x86, 0x26, 0x35,
-      0x7f, 0xaf, 0xc6, 0xb8, 0x8c, 0x38, 0xfa, 0x28, 0x9b, 0x07, 0x1c, 0xfe}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x52, 0xf6, 0xf5, 0x54, 0x58, 0x04, 0xef, 0x31,
-      0xce, 0xa7, 0xaf, 0x3f, 0x6f, 0xa9, 0x44, 0xd0, 0x56, 0xc2, 0x4c, 0x57,
-      0xf9, 0x31, 0x60, 0xa5, 0x4a, 0xeb, 0x02, 0xeb, 0xc1, 0x1e, 0xcc, 0x9b},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x95, 0xce, 0x55, 0x44, 0xf0, 0xab, 0x58, 0xd4,
-      0x94, 0x37, 0x34, 0x73, 0xa5, 0xf7, 0x28, 0xf0, 0x69, 0x66, 0xaa, 0xc3,
-      0xf0, 0x63, 0x70, 0x1a, 0x60, 0x42, 0x73, 0xa5, 0x54, 0x66, 0xa9, 0x0e},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x32, 0xf0, 0xd1, 0x9e, 0xe7, 0xb9, 0xc1, 0x7d,
-      0x48, 0x90, 0xa2, 0x1b, 0x43, 0x5d, 0x42, 0xa1, 0xa8, 0x38, 0xa9, 0x1d,
-      0xc4, 0xde, 0xf3, 0xb8, 0x63, 0x1e, 0xb0, 0xf0, 0x59, 0xbb, 0x89, 0x0d}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xab, 0xf5, 0x4b, 0x51, 0x77, 0x39, 0xd0, 0x8a,
-      0xe7, 0x5f, 0x4a, 0x3c, 0x92, 0x16, 0x84, 0xce, 0x74, 0x21, 0x93, 0xe3,
-      0x3a, 0x68, 0x3e, 0x9e, 0xde, 0x9e, 0x30, 0x40, 0xdd, 0xcc, 0xf9, 0x91},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x2e, 0x08, 0x65, 0xac, 0xa2, 0xf4, 0x59, 0xe2,
-      0xc9, 0xc5, 0x4e, 0x11, 0x79, 0x03, 0x7e, 0x01, 0x30, 0xc8, 0x20, 0x39,
-      0xdd, 0xc7, 0x8b, 0xf3, 0xaa, 0x3d, 0x0d, 0x22, 0x48, 0x07, 0x62, 0xb7},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x68, 0x64, 0x03, 0x1d, 0xa7, 0x16, 0x9f, 0x77,
-      0x19, 0x59, 0x72, 0x60, 0xf0, 0xec, 0x16, 0x2d, 0x9b, 0x93, 0xfa, 0x1f,
-      0xb0, 0x58, 0x47, 0xc7, 0xde, 0x8e, 0x32, 0xce, 0x09, 0xd9, 0xa6, 0xaf}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5e, 0xaf, 0x26, 0x70, 0x69, 0x6f, 0xa0, 0xfb,
-      0x2a, 0x41, 0xe8, 0xf2, 0xc6, 0x38, 0x41, 0x69, 0x7f, 0xd6, 0xa2, 0x56,
-      0xd2, 0x63, 0x61, 0xeb, 0x5f, 0x33, 0xc4, 0x2d, 0x24, 0xc7, 0xae, 0xcf},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x13, 0x90, 0xf7, 0xee, 0x39, 0x05, 0xa4, 0x31,
-      0xe4, 0x60, 0xb7, 0x88, 0x0a, 0xca, 0xdd, 0xa8, 0x63, 0x9f, 0x9b, 0xe8,
-      0xc3, 0xfd, 0xbe, 0xb6, 0x4a, 0x6c, 0x24, 0xb2, 0x7b, 0xf4, 0xef, 0x50},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0xe1, 0x34, 0xa1, 0xd7, 0x97, 0x17,
-      0xa1, 0x86, 0x60, 0xab, 0x2f, 0xdd, 0xbc, 0x5c, 0x2a, 0xf0, 0x9f, 0x3d,
-      0xbe, 0xfb, 0x0a, 0xbf, 0x95, 0x4d, 0xe3, 0xf7, 0x6e, 0xd9, 0x7b, 0xb4}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x2e, 0xe9, 0x94, 0xb6, 0x48, 0xec, 0x0d, 0xba,
-      0x5e, 0x33, 0xcd, 0x16, 0x57, 0x60, 0x25, 0x2c, 0x2b, 0x1d, 0xb0, 0x77,
-      0xba, 0x11, 0x5b, 0xc0, 0x7b, 0x61, 0x78, 0xe8, 0x3b, 0x06, 0x28, 0xea},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x4d, 0x76, 0x16, 0x2f, 0x9e, 0xed, 0xb9, 0xc6,
-      0xc3, 0xb9, 0x5e, 0xdc, 0x4f, 0x07, 0xc6, 0x9b, 0xec, 0x19, 0x8b, 0x14,
-      0x63, 0xf8, 0xba, 0x26, 0xd1, 0x7a, 0x3a, 0x67, 0x02, 0x86, 0xda, 0x9a},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x4e, 0x74, 0xf5, 0x77, 0xf5, 0x08, 0x09, 0x2f,
-      0xa2, 0x78, 0x1a, 0x23, 0x97, 0xe9, 0xcd, 0x4f, 0x28, 0x80, 0xc3, 0x48,
-      0x8e, 0xdc, 0x02, 0xc8, 0xb3, 0x8e, 0xf2, 0xbf, 0x99, 0x28, 0xe6, 0xb7}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x8a, 0x50, 0x2a, 0x55, 0x46, 0xa4, 0xbf, 0x50,
-      0x59, 0x07, 0xc3, 0xde, 0xfd, 0x99, 0xd1, 0x21, 0xf4, 0x88, 0x1d, 0x1a,
-      0xb9, 0xa1, 0xfc, 0x03, 0x96, 0xf9, 0xd1, 0xb6, 0xc1, 0xd4, 0x5e, 0x98},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf8, 0x12, 0x2e, 0x22, 0x73, 0xf9, 0x52, 0xe4,
-      0x4c, 0x23, 0x07, 0xee, 0x48, 0xa9, 0x48, 0x16, 0x19, 0x12, 0x99, 0x3e,
-      0xbe, 0x19, 0xef, 0xbe, 0xa6, 0xf3, 0xdd, 0x84, 0x41, 0x05, 0xe4, 0x6c},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf1, 0x2b, 0xc7, 0x65, 0xdf, 0xa3, 0x74, 0xc8,
-      0x11, 0x31, 0x30, 0x01, 0x86, 0x7a, 0x51, 0xaa, 0xf6, 0x44, 0xcd, 0x44,
-      0xd9, 0xd6, 0xdb, 0x4d, 0x68, 0x4b, 0x29, 0x94, 0xc8, 0x4f, 0x82, 0x3f}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x8c, 0xec, 0x0f, 0xde, 0xf0, 0x4c, 0x0c, 0xd0,
-      0xe5, 0xff, 0x7f, 0x43, 0x78, 0xbc, 0xd0, 0x9a, 0x67, 0x15, 0x23, 0x58,
-      0x3f, 0x25, 0xb7, 0x7b, 0xb6, 0x68, 0x75, 0x0f, 0xbf, 0x04, 0xee, 0x38},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x81, 0xf4, 0x42, 0xbb, 0xbc, 0x53, 0xd2, 0xc5,
-      0x38, 0x86, 0xe5, 0x41, 0x1d, 0xbb, 0x27, 0x80, 0xef, 0xf1, 0x0c, 0xcf,
-      0x6e, 0x14, 0xff, 0x5e, 0x74, 0xbf, 0xc8, 0x1f, 0x5d, 0xee, 0x15, 0xa5},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x2d, 0x93, 0x3f, 0x5a, 0xf2, 0x73, 0xaf, 0x51,
-      0xfb, 0xc1, 0x27, 0x20, 0x68, 0x9e, 0xd1, 0xd2, 0xcf, 0x04, 0xbd, 0x83,
-      0x74, 0x93, 0xd8, 0x8f, 0x70, 0xeb, 0x03, 0xaa, 0x11, 0xf5, 0x05, 0x6d}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5c, 0x04, 0xe2, 0x57, 0xa2, 0x90, 0xe8, 0x5f,
-      0x2b, 0xef, 0x9d, 0x35, 0x21, 0x05, 0xb3, 0x83, 0xa7, 0xb5, 0x0d, 0xd0,
-      0xaa, 0x6d, 0x7a, 0xb9, 0x91, 0x45, 0x17, 0x1d, 0x5c, 0x67, 0xf9, 0xc0},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x2d, 0x63, 0xeb, 0x82, 0xc5, 0x1d, 0xef, 0x94,
-      0xe5, 0xc8, 0xdd, 0xf6, 0x95, 0xfa, 0x6b, 0xc6, 0x97, 0x15, 0xa4, 0xd4,
-      0xbb, 0xa5, 0xf6, 0xd3, 0x1d, 0xbc, 0x3b, 0xdb, 0x62, 0xab, 0xef, 0x14},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xdc, 0xe5, 0xa7, 0xb0, 0x8f, 0x34, 0x2a, 0x45,
-      0x7d, 0x39, 0x92, 0xb0, 0x02, 0xbc, 0x0a, 0xa0, 0xb5, 0xfe, 0x09, 0x82,
-      0xe5, 0xed, 0x2a, 0xc5, 0x8f, 0x8d, 0xaa, 0xae, 0xe4, 0xa1, 0x8a, 0x8f}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0x98, 0x63, 0xa4, 0x0f, 0x6a, 0xf6,
-      0xfd, 0xd3, 0xdb, 0x74, 0x35, 0xa9, 0x91, 0xd9, 0x34, 0xe8, 0x7e, 0xdd,
-      0x39, 0x44, 0x84, 0xb3, 0xc8, 0x85, 0x9e, 0x86, 0x2c, 0x22, 0xdc, 0x7d},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x10, 0xb0, 0xb2, 0xe9, 0xda, 0xc1, 0x10, 0x15,
-      0x80, 0x35, 0xdf, 0xd0, 0xf5, 0x98, 0xd7, 0x95, 0x9d, 0x80, 0x1f, 0x4d,
-      0x39, 0x4c, 0x4e, 0xe2, 0x5a, 0x2e, 0x31, 0x10, 0x34, 0x05, 0xb9, 0x05},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x44, 0x50, 0x2a, 0xa2, 0xc8, 0xee, 0xcc, 0x61,
-      0xf2, 0x39, 0xcc, 0x52, 0x3d, 0x11, 0xe7, 0x68, 0x91, 0x8f, 0x4a, 0xf9,
-      0x89, 0x29, 0x45, 0x22, 0xfd, 0x42, 0x4f, 0x6f, 0x5e, 0xbe, 0xb2, 0xd5}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x30, 0x27, 0xef, 0x4d, 0xcf, 0x21,
-      0x7f, 0xaa, 0x63, 0x30, 0xb7, 0xc9, 0xad, 0x5b, 0xde, 0x58, 0xdc, 0x0c,
-      0x44, 0x3b, 0x5b, 0x3a, 0xbf, 0xff, 0x4d, 0x60, 0x74, 0x4a, 0xa6, 0x6f},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa0, 0xe2, 0xfb, 0xbb, 0x19, 0x58, 0xf0, 0xb4,
-      0xcf, 0x7d, 0x2a, 0xd8, 0x17, 0x3a, 0x56, 0xe9, 0xd9, 0x16, 0x76, 0xbd,
-      0x83, 0x24, 0x55, 0x9c, 0xad, 0x58, 0x7a, 0xc1, 0x53, 0xb9, 0x4e, 0x30},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xba, 0xd6, 0xe1, 0x94, 0x24, 0x3f, 0x9b, 0x7f,
-      0x35, 0xc1, 0x10, 0x49, 0xb1, 0xcc, 0xf2, 0x3d, 0xb2, 0xc7, 0xc3, 0x74,
-      0xa4, 0x36, 0x1e, 0x8a, 0xae, 0x77, 0xaf, 0x2a, 0x42, 0x1e, 0x8a, 0x82}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x50, 0xeb, 0x86, 0xba, 0xca, 0x82, 0x40, 0x62,
-      0x2e, 0x3f, 0xc7, 0xf7, 0x11, 0x6e, 0x26, 0xc8, 0x9a, 0xaa, 0x5a, 0x3a,
-      0x17, 0x72, 0x3e, 0x1d, 0x22, 0x44, 0x8c, 0x76, 0x3c, 0xda, 0x72, 0xf0},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x2b, 0x3c, 0x2a, 0xde, 0x08, 0x9a, 0x01, 0xbd,
-      0xd3, 0x13, 0x11, 0xb7, 0xba, 0x1d, 0x23, 0x71, 0x91, 0x88, 0xd7, 0x38,
-      0x3f, 0x05, 0x32, 0x14, 0xba, 0x5c, 0xb6, 0xc6, 0x57, 0xb5, 0x39, 0x7f},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xb7, 0x28, 0x48, 0x5a, 0x47, 0x6e, 0xf7, 0x8e,
-      0x55, 0x17, 0xf1, 0x85, 0x7e, 0xb9, 0x23, 0x7c, 0xf0, 0x9f, 0x7f, 0xeb,
-      0x9d, 0xcf, 0xb5, 0x42, 0x6f, 0xb6, 0xce, 0xad, 0x7f, 0x9c, 0xe6, 0x55}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5a, 0x46, 0xba, 0x0c, 0x7d, 0xf1, 0x5f, 0xd9,
-      0x3f, 0xdb, 0xae, 0x83, 0xb7, 0xa5, 0xfe, 0xd7, 0x4c, 0x77, 0x48, 0x21,
-      0x61, 0x17, 0x2e, 0xe9, 0xd4, 0xbf, 0xee, 0x3f, 0x74, 0x2a, 0x18, 0x91},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x98, 0x60, 0xac, 0x46, 0xf7, 0x38, 0xe7, 0x2a,
-      0xfb, 0xf9, 0xef, 0xe3, 0xfd, 0x13, 0xd6, 0xe4, 0xbe, 0xd1, 0x7f, 0xd4,
-      0x94, 0xd9, 0x52, 0x44, 0x9f, 0x6e, 0x80, 0x5a, 0x11, 0x63, 0x28, 0x27},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xca, 0x54, 0x7c, 0xdf, 0x2a, 0x12, 0x07, 0xc7,
-      0xf5, 0x5d, 0x1a, 0x5f, 0x03, 0x08, 0x8e, 0x02, 0xcd, 0x84, 0xc9, 0xee,
-      0xa9, 0x98, 0xba, 0xa1, 0x21, 0x8b, 0x8d, 0x74, 0xce, 0x92, 0x4a, 0x79}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x2f, 0x1a, 0x0a, 0xd7, 0x59, 0xc3, 0x3c, 0x7b,
-      0x48, 0x06, 0xc1, 0xa6, 0xa5, 0x2a, 0xfc, 0x5a, 0x71, 0x65, 0xa7, 0xd6,
-      0x66, 0x04, 0x35, 0xcb, 0xa0, 0x3a, 0x30, 0x1c, 0x60, 0xc0, 0x11, 0xb5},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xeb, 0x91, 0xdc, 0xfc, 0x2d, 0x69, 0x6b, 0x55,
-      0x10, 0xfa, 0x64, 0xaf, 0x26, 0x87, 0xdc, 0x35, 0xef, 0x69, 0x7d, 0xfd,
-      0x09, 0xa8, 0xae, 0xeb, 0x26, 0x96, 0x75, 0xa9, 0xea, 0xf9, 0xf1, 0x77},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xe6, 0xcc, 0x1d, 0xc0, 0x67, 0xfc, 0xf9, 0x8d,
-      0x26, 0x46, 0xe5, 0x64, 0x2b, 0x0f, 0x8e, 0xc3, 0x43, 0x79, 0x17, 0x07,
-      0xf6, 0xee, 0x96, 0x74, 0xeb, 0x69, 0xd8, 0x7f, 0x95, 0x0d, 0x28, 0xcb}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x25, 0x61, 0x8d, 0xa4, 0xe0, 0xe5, 0xda, 0x96,
-      0xdc, 0x7f, 0x5c, 0x07, 0x61, 0x7b, 0xa0, 0x12, 0xae, 0xc3, 0x06, 0xc0,
-      0xa3, 0x17, 0xb5, 0x65, 0xb1, 0x3f, 0xa7, 0xdd, 0x32, 0x37, 0xd3, 0x76},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x33, 0x41, 0x31, 0x6f, 0xa6, 0x42, 0xc7, 0x51,
-      0x2d, 0xb4, 0x52, 0x5a, 0x14, 0x8f, 0xa3, 0x18, 0x78, 0x80, 0xb3, 0xc6,
-      0xaf, 0x65, 0x87, 0xb2, 0x9f, 0xf8, 0xc3, 0x88, 0xef, 0x32, 0x7b, 0x16},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd5, 0xd8, 0xb3, 0xfa, 0x84, 0x91, 0x63, 0x12,
-      0xe1, 0xc6, 0xdc, 0x45, 0x3d, 0xf3, 0x3b, 0xd1, 0x52, 0x4b, 0x04, 0x0b,
-      0xa5, 0x7b, 0x5f, 0x9f, 0x00, 0xdb, 0x54, 0x42, 0xf2, 0x19, 0xa1, 0x0e}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xba, 0xf1, 0x49, 0x85, 0x1c, 0x5c, 0x18, 0x25,
-      0x63, 0xdf, 0x00, 0xd5, 0xdc, 0xdc, 0x26, 0xc2, 0xb6, 0x6b, 0xd0, 0xcc,
-      0x96, 0x7b, 0x46, 0x56, 0x7a, 0xb6, 0x4c, 0xd7, 0x93, 0xdd, 0x5c, 0x32},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xde, 0x83, 0xea, 0x36, 0x25, 0xfc, 0x21, 0x30,
-      0x37, 0xf6, 0x58, 0xf9, 0x35, 0x83, 0xa2, 0xcc, 0x9c, 0x20, 0xcc, 0x6b,
-      0x6d, 0x1f, 0x32, 0xbc, 0x8e, 0x52, 0x11, 0x2f, 0x30, 0xc1, 0x6d, 0x20},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x6f, 0x3e, 0x29, 0x31, 0xd9, 0x75, 0x39, 0x00,
-      0x93, 0x8e, 0xa9, 0x7a, 0xf0, 0xb8, 0x2b, 0x63, 0x15, 0x05, 0x60, 0xe7,
-      0xeb, 0xe4, 0x9d, 0xff, 0x66, 0xe4, 0x1c, 0x98, 0x76, 0xb9, 0xe4, 0xb3}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xab, 0x0a, 0x35, 0x70, 0xc1, 0x03, 0x6c, 0x5a,
-      0x53, 0x71, 0x72, 0x30, 0x5b, 0x70, 0xe7, 0x65, 0x17, 0xc7, 0x79, 0x36,
-      0xbd, 0x16, 0x17, 0xdb, 0x4c, 0x03, 0x4a, 0x05, 0xa0, 0xea, 0x4c, 0x16},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x79, 0x63, 0x2b, 0x98, 0xde, 0x98, 0x01, 0xf0,
-      0xf1, 0x1b, 0x8c, 0x97, 0xe7, 0x8e, 0x5c, 0x3f, 0xbd, 0x00, 0xfe, 0xf3,
-      0x72, 0x36, 0x48, 0x76, 0x40, 0x3c, 0x35, 0x79, 0xfb, 0x8b, 0x30, 0xb3},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf3, 0x3a, 0xdb, 0x13, 0x0c, 0x9d, 0xb0, 0xc7,
-      0x8f, 0x8c, 0xcb, 0xd8, 0xfb, 0x95, 0x4a, 0xc2, 0xb9, 0x45, 0x87, 0x44,
-      0xfb, 0x90, 0x85, 0x0d, 0xea, 0x3a, 0x68, 0x6c, 0xe5, 0x40, 0xa6, 0x6b}},
-    /*
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x73, 0x0d, 0xac, 0xce, 0xa1, 0x7f, 0x61, 0x08,
-      0x82, 0xaf, 0x2e, 0xa1, 0x83, 0xa7, 0x79, 0xea, 0xcd, 0x77, 0x77, 0xfa,
-      0x53, 0xbf, 0xbf, 0x3d, 0x74, 0x28, 0x09, 0x91, 0xe2, 0x34, 0x19, 0x75},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x78, 0x2d, 0xa2, 0xbf, 0xf7, 0x09,
-      0x55, 0x71, 0xf5, 0x62, 0xf9, 0xb3, 0xd3, 0xd3, 0x9f, 0x12, 0xfb, 0x95,
-      0x87, 0x9e, 0x4c, 0x82, 0xdd, 0xf0, 0x95, 0xba, 0x4d, 0xce, 0x15, 0x47},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x05, 0x96, 0xf6, 0x71, 0x5b, 0xf4, 0x01, 0xf3,
-      0x9e, 0x5f, 0x29, 0x82, 0x34, 0x73, 0x31, 0xb5, 0xa6, 0x02, 0xcd, 0x6e,
-      0xac, 0x3f, 0x44, 0x20, 0x7f, 0xf7, 0xc1, 0x68, 0xaa, 0x0e, 0x72, 0x04}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x51, 0x74, 0x4e, 0xfc, 0x5a, 0xdd, 0x85, 0x03,
-      0xf6, 0x49, 0x28, 0xff, 0x98, 0x5b, 0x15, 0x6b, 0x18, 0x45, 0x49, 0x2f,
-      0x72, 0x81, 0xed, 0xe6, 0x3b, 0xd0, 0xb8, 0x4f, 0x7d, 0x45, 0x25, 0xe1},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf8, 0x4f, 0xc1, 0xcd, 0x5c, 0x74, 0x9a, 0xe8,
-      0x64, 0xdb, 0x63, 0x2d, 0xd4, 0xc4, 0xbc, 0xc5, 0x66, 0x9c, 0x0c, 0x1c,
-      0x80, 0xb5, 0x7f, 0xe3, 0x71, 0xa0, 0xbb, 0x50, 0x1a, 0x6a, 0x0a, 0x25},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x72, 0x32, 0xf7, 0x12, 0x3a, 0xad, 0x49, 0x02,
-      0x3b, 0x2d, 0x1b, 0x09, 0x42, 0xb7, 0xe6, 0x11, 0xd9, 0xd4, 0xcc, 0x78,
-      0x93, 0xd7, 0xca, 0x8c, 0x63, 0xd7, 0xd4, 0xae, 0xca, 0x50, 0xf8, 0xb3}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x3c, 0x16, 0xcc, 0xab, 0xad, 0xd0, 0x30, 0x93,
-      0xff, 0x01, 0x67, 0x75, 0x6b, 0xfc, 0x07, 0xfc, 0xf6, 0x3a, 0x6d, 0xd4,
-      0xf4, 0x0d, 0x0a, 0x40, 0x86, 0xb0, 0x1e, 0x75, 0xe9, 0x82, 0x96, 0x3c},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xce, 0x31, 0xbc, 0xce, 0x34, 0xdc, 0x4d, 0xf3,
-      0x05, 0x68, 0x08, 0x80, 0xca, 0x71, 0xfc, 0x2e, 0x50, 0x30, 0xc7, 0xa0,
-      0xae, 0xf3, 0x5d, 0x06, 0x4d, 0x40, 0x57, 0x18, 0x00, 0xdf, 0xec, 0x2f},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa6, 0x8f, 0x0f, 0x01, 0xb5, 0xb7, 0xcf, 0x01,
-      0x8b, 0x5c, 0xdb, 0xbd, 0x77, 0x6f, 0xf3, 0x21, 0x8f, 0xef, 0xec, 0xfb,
-      0xf4, 0x49, 0x4c, 0xcb, 0x95, 0x9d, 0x56, 0x14, 0xdc, 0x6c, 0x37, 0x53}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5e, 0x0a, 0xcb, 0x10, 0xa6, 0x52, 0x47, 0xcf,
-      0x7f, 0x1b, 0x54, 0xec, 0x24, 0x8a, 0x8a, 0x00, 0x26, 0x2e, 0xc9, 0x68,
-      0xcb, 0xab, 0xd1, 0x89, 0x7e, 0x8f, 0xbb, 0x5c, 0xa9, 0xa1, 0xb7, 0x96},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x64, 0x25, 0x97, 0xfd, 0xfc, 0x14, 0x2b, 0x07,
-      0x2d, 0x8e, 0xe0, 0x6d, 0x7e, 0x82, 0xed, 0xca, 0xc8, 0xd9, 0xca, 0xa3,
-      0x31, 0xf9, 0x99, 0xc6, 0x6f, 0x04, 0xd8, 0x66, 0x52, 0x23, 0xc4, 0x83},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x3e, 0x7c, 0x99, 0x4c, 0x3e, 0x0a, 0x48, 0x42,
-      0x12, 0xbf, 0xe7, 0xc8, 0xea, 0xfc, 0x5f, 0x89, 0x27, 0x68, 0xd7, 0xc8,
-      0xbe, 0x41, 0x56, 0x5c, 0xc5, 0x65, 0xa0, 0xdd, 0x1a, 0x8c, 0x3a, 0x55}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5a, 0x39, 0x59, 0x97, 0x4c, 0x38, 0x4c, 0xbf,
-      0xd8, 0x2d, 0xcd, 0x1b, 0xa6, 0xb9, 0x96, 0xec, 0xee, 0x89, 0x95, 0x80,
-      0x51, 0x58, 0x04, 0x9a, 0x92, 0x3e, 0x07, 0x10, 0x52, 0x4b, 0x4b, 0xf7},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x72, 0x0e, 0xa2, 0x15, 0xb3, 0xf6, 0x65, 0x8b,
-      0x0a, 0x1b, 0x5e, 0xb9, 0x4c, 0xd5, 0xa6, 0x26, 0x2f, 0xae, 0xef, 0xb8,
-      0x33, 0xd6, 0x97, 0x77, 0xc1, 0xd2, 0x40, 0xdd, 0x6a, 0xab, 0x08, 0x2d},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa2, 0x68, 0xd9, 0xd4, 0xd0, 0x6f, 0x89, 0xac,
-      0x5a, 0xb2, 0x87, 0xde, 0x64, 0x59, 0xa0, 0x2b, 0x59, 0x53, 0xf5, 0x75,
-      0xff, 0xc2, 0xa6, 0x13, 0x2d, 0xd6, 0xf3, 0x9a, 0xa7, 0x76, 0xe7, 0x21}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xc1, 0x01, 0x5b, 0x5e, 0x94, 0x2e, 0xc1, 0xb3,
-      0xf8, 0xf2, 0x7e, 0x82, 0x5d, 0x91, 0x67, 0xef, 0x0a, 0x2e, 0x39, 0xb0,
-      0x1a, 0x30, 0xce, 0xbc, 0x25, 0x2d, 0x49, 0x1b, 0xce, 0xc0, 0xc4, 0x4f},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x33, 0x93, 0x7b, 0x89, 0xe6, 0xda, 0x91, 0x22,
-      0x84, 0x09, 0x38, 0x79, 0x25, 0xd3, 0x06, 0xf7, 0x5f, 0xdd, 0x9f, 0x59,
-      0x49, 0x43, 0x35, 0x18, 0xca, 0x9a, 0xf0, 0x29, 0x40, 0xe5, 0xd6, 0xea},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x72, 0x89, 0xeb, 0x91, 0xb0, 0xe0, 0x7c, 0xd6,
-      0xf5, 0xd1, 0xa2, 0x91, 0x97, 0xf3, 0x76, 0x8e, 0x4d, 0x5d, 0xbe, 0x79,
-      0x43, 0x2a, 0xe6, 0xdf, 0xd1, 0xe2, 0x15, 0x46, 0x00, 0x43, 0x01, 0xfc}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x89, 0x14, 0xcf, 0x78, 0x83, 0x62, 0x9e, 0xf7,
-      0x24, 0x77, 0x37, 0xa4, 0x02, 0xdd, 0x28, 0x31, 0x51, 0x10, 0x06, 0x6d,
-      0xfb, 0x6c, 0x44, 0xda, 0x8e, 0x0b, 0x53, 0x1f, 0x94, 0xe2, 0x93, 0xd6},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf1, 0xac, 0x51, 0xb1, 0x5e, 0xe7, 0xa6, 0xb7,
-      0xd5, 0xb1, 0xa7, 0x0b, 0xed, 0x2d, 0x38, 0xc8, 0xf0, 0x08, 0xfe, 0x6d,
-      0xe6, 0x84, 0xbd, 0xed, 0x65, 0x82, 0x71, 0x2e, 0xb2, 0x6d, 0xbf, 0x81},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x04, 0x9c, 0x66, 0xb9, 0x8d, 0xc8, 0xb9, 0x24,
-      0xab, 0x92, 0x70, 0x58, 0xe7, 0xce, 0xdd, 0x47, 0x55, 0x34, 0xe0, 0xa3,
-      0x1a, 0x4b, 0x56, 0xc9, 0x86, 0xaf, 0xfa, 0xf3, 0x59, 0x11, 0xf5, 0x0c}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x15, 0x08, 0x8b, 0x1a, 0x8f, 0x2b, 0xc7, 0xc6,
-      0xf8, 0xa3, 0x37, 0x46, 0x3a, 0xda, 0xc2, 0x91, 0x65, 0x19, 0x57, 0xdf,
-      0xbc, 0x5e, 0xbf, 0x4b, 0x01, 0xe9, 0x42, 0xc9, 0x3b, 0xc8, 0xbd, 0x9e},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xc9, 0x6a, 0xbc, 0x40, 0x9b, 0xb8, 0x39, 0xbb,
-      0xbb, 0xed, 0xe8, 0x1c, 0x9c, 0xac, 0x41, 0x46, 0x10, 0xd8, 0x56, 0x9c,
-      0xb0, 0xf0, 0x2a, 0x7c, 0xf2, 0x15, 0x7d, 0x86, 0xfd, 0x84, 0x75, 0xff},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x57, 0x54, 0x35, 0x3a, 0x95, 0x28, 0xe2, 0xdd,
-      0x4a, 0x6d, 0x1a, 0xe0, 0xb0, 0xfc, 0x38, 0x02, 0x5a, 0xe7, 0x0e, 0xab,
-      0x32, 0x64, 0x60, 0x8d, 0x31, 0x16, 0xa3, 0x49, 0xd9, 0x48, 0x23, 0x7f}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa6, 0x33, 0xb0, 0x89, 0xc1, 0x11, 0x84, 0xc1,
-      0xf1, 0x8e, 0x7c, 0xe8, 0x22, 0x29, 0x2f, 0xcf, 0x7e, 0xa3, 0xa6, 0x08,
-      0x12, 0x66, 0x4c, 0xb6, 0x92, 0x3d, 0xb1, 0x27, 0xf5, 0x71, 0x25, 0x00},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x7d, 0xd9, 0xc6, 0x67, 0xea, 0xbe, 0x07, 0xd8,
-      0x48, 0x17, 0x23, 0x71, 0x46, 0x95, 0x3b, 0x16, 0xc2, 0xf4, 0x6d, 0x06,
-      0x7e, 0x9f, 0xa1, 0x2c, 0x93, 0x8b, 0x18, 0xbf, 0x59, 0xec, 0x5f, 0x7f},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x2e, 0x62, 0xd3, 0xda, 0xf5, 0xe1, 0x33, 0xbd,
-      0xa5, 0x96, 0xa7, 0x1c, 0xe2, 0x42, 0x19, 0x72, 0x3a, 0x3b, 0x94, 0x5c,
-      0xf9, 0xa7, 0xc5, 0x97, 0x39, 0xdc, 0x28, 0xb1, 0xc0, 0xba, 0xd8, 0x03}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa1, 0xc7, 0xb2, 0x90, 0x36, 0x14, 0x66, 0xb3,
-      0x46, 0x08, 0xf0, 0xaa, 0x86, 0xd6, 0x2a, 0xc3, 0x2a, 0x02, 0x49, 0x57,
-      0x11, 0x7c, 0x24, 0x91, 0xe5, 0x7c, 0xac, 0x8e, 0x7a, 0x0f, 0x6a, 0x86},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x63, 0xe6, 0xee, 0x75, 0xb6, 0x00, 0x1c, 0xbf,
-      0xa4, 0xcc, 0x2a, 0xdf, 0x1e, 0x17, 0xad, 0xf1, 0x73, 0x73, 0x49, 0xc2,
-      0x4f, 0xc8, 0x85, 0x64, 0x31, 0x16, 0x38, 0x0d, 0xa7, 0x5c, 0x2a, 0x64},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd4, 0x6d, 0xb0, 0x09, 0x4a, 0x6e, 0xc4, 0x5a,
-      0x1a, 0xab, 0x91, 0xe4, 0x0e, 0x24, 0x36, 0x30, 0x6f, 0xa9, 0x6e, 0x8a,
-      0x2c, 0x36, 0xfa, 0x74, 0x92, 0xcf, 0xd1, 0xe7, 0x84, 0xc5, 0xc4, 0xfc}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x76, 0x59, 0x31, 0x7c, 0x33, 0x20, 0xe6, 0x38,
-      0xe4, 0xaa, 0x9f, 0x77, 0x0e, 0x3c, 0xda, 0x47, 0xab, 0x14, 0x2d, 0x12,
-      0xe9, 0x67, 0x4d, 0x37, 0x53, 0x91, 0x67, 0xd3, 0xa5, 0xd5, 0xb3, 0x0e},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x36, 0x21, 0xd6, 0x0e, 0xbc, 0x64, 0xbb, 0x70,
-      0x7e, 0x97, 0x8d, 0x77, 0x7d, 0xb2, 0x20, 0xf6, 0x53, 0x44, 0xfa, 0xfe,
-      0x38, 0xb8, 0xdc, 0x76, 0x26, 0x10, 0x4b, 0xde, 0xbc, 0x53, 0xe9, 0xc4},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xdc, 0xe6, 0x36, 0x80, 0xf5, 0x06, 0x36, 0x1b,
-      0x33, 0xe8, 0xac, 0xfe, 0x96, 0xdb, 0xf8, 0x6f, 0x7c, 0xe9, 0xe7, 0x53,
-      0x45, 0xef, 0xd9, 0xbe, 0x73, 0x88, 0x6d, 0x71, 0xb8, 0x6e, 0xab, 0x4f}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa1, 0x9d, 0xf3, 0x12, 0x28, 0xd1, 0xff, 0x17,
-      0xc5, 0x15, 0x44, 0x89, 0x9f, 0x23, 0x51, 0x9e, 0xde, 0xa6, 0x3f, 0x40,
-      0xc8, 0xc1, 0xc6, 0x6f, 0xa0, 0x9d, 0x1d, 0x0f, 0xea, 0x69, 0xee, 0x6f},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x7e, 0xfa, 0xfd, 0xdb, 0xab, 0xa8, 0x95, 0x61,
-      0x60, 0x2a, 0x25, 0x25, 0x48, 0xfc, 0x68, 0xc0, 0xfd, 0x4b, 0x62, 0x90,
-      0xff, 0xf1, 0x31, 0x11, 0x16, 0x49, 0x35, 0xe4, 0x94, 0x5e, 0xfc, 0x2d},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa3, 0x3e, 0x46, 0xda, 0x3a, 0x97, 0x7a, 0xfb,
-      0xdc, 0xcb, 0x67, 0xad, 0xa6, 0xf0, 0x3e, 0x5f, 0x6d, 0x9e, 0x2d, 0xc6,
-      0xf3, 0x97, 0xa3, 0x3a, 0x71, 0xdb, 0xae, 0x67, 0x0a, 0xbe, 0xea, 0xef}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x13, 0x06, 0x96, 0xee, 0x65, 0x2b, 0x08, 0x58,
-      0x1f, 0x0f, 0x17, 0xbf, 0x50, 0x69, 0x1c, 0x61, 0x6b, 0x17, 0x0f, 0x63,
-      0x9c, 0x3d, 0xd9, 0xad, 0xbe, 0xe7, 0xce, 0x15, 0xa3, 0x59, 0x23, 0xb0},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x13, 0xad, 0x4d, 0xd6, 0xbc, 0x01, 0xd2, 0x77,
-      0x6f, 0x40, 0x7c, 0x0d, 0x47, 0x91, 0x74, 0x76, 0xf0, 0x6b, 0xa0, 0x83,
-      0xb8, 0xbc, 0x3f, 0xca, 0xa4, 0xcd, 0xba, 0x05, 0x11, 0x43, 0xf1, 0x6d},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa8, 0x52, 0xf0, 0x04, 0x2e, 0x41, 0x07, 0x33,
-      0x8f, 0x34, 0xf8, 0x45, 0x62, 0x04, 0x1b, 0x3b, 0xe4, 0x1d, 0xcf, 0x74,
-      0x20, 0xc3, 0x79, 0xbf, 0xf3, 0xab, 0xf2, 0x52, 0x40, 0x57, 0x37, 0x7a}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xaa, 0x9d, 0x6c, 0xe5, 0x8e, 0xc2, 0xb7, 0x9c,
-      0x90, 0x8f, 0x97, 0x0e, 0x91, 0x60, 0xd9, 0x3d, 0x80, 0x9a, 0xca, 0x30,
-      0xcd, 0x41, 0x6c, 0xe6, 0x94, 0x2e, 0xb4, 0xeb, 0x6f, 0x6e, 0xc7, 0x35},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x27, 0x76, 0x18, 0x51, 0x44, 0xa3, 0xdd, 0xc6,
-      0xcd, 0x1c, 0xfd, 0x7b, 0x48, 0x9d, 0x8e, 0x49, 0xb8, 0x01, 0x39, 0x86,
-      0xf2, 0xb6, 0xcb, 0xd8, 0x4c, 0x71, 0xfd, 0xa9, 0x42, 0x36, 0x6b, 0x54},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xbc, 0x8e, 0x18, 0x21, 0x92, 0x68, 0x8b, 0x82,
-      0xdc, 0x06, 0x8f, 0xd5, 0x09, 0x7b, 0xe8, 0x7a, 0x4c, 0x3c, 0x6e, 0x1d,
-      0x94, 0x9c, 0x55, 0x7c, 0x36, 0xc7, 0x68, 0xcb, 0xad, 0x33, 0x3b, 0xc0}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x4c, 0xd5, 0x66, 0x40, 0x56, 0xae, 0x4a, 0x3a,
-      0x63, 0x5e, 0x12, 0xb0, 0x9e, 0x82, 0x05, 0x06, 0xb1, 0x7b, 0xe1, 0x27,
-      0x34, 0xfd, 0xb0, 0x70, 0x4e, 0x92, 0x9c, 0x9e, 0x2b, 0x15, 0x8c, 0x30},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x88, 0xe7, 0x2d, 0x25, 0xcc, 0x59, 0x4b, 0x41,
-      0xe5, 0x13, 0x8e, 0x39, 0x70, 0x7d, 0xc0, 0x9a, 0x0b, 0xcf, 0xc6, 0x62,
-      0xbe, 0xee, 0x98, 0x6d, 0x67, 0x47, 0xc1, 0x5d, 0x60, 0x25, 0x0b, 0x40},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xe9, 0x1b, 0x64, 0xdd, 0x6c, 0x6b, 0x8f, 0x1f,
-      0xb6, 0xc3, 0xee, 0x65, 0x24, 0xa7, 0xa6, 0xe6, 0xfc, 0x72, 0xc0, 0x08,
-      0x09, 0x12, 0xf0, 0xf4, 0x61, 0xde, 0xc9, 0xc9, 0x55, 0x87, 0xf4, 0x6f}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x52, 0x71, 0xf4, 0x9e, 0x26, 0xb4, 0x0c, 0x33,
-      0x90, 0xf2, 0x88, 0xb7, 0xf4, 0xde, 0x04, 0x15, 0xa6, 0x9d, 0x7b, 0x28,
-      0x92, 0x12, 0x0e, 0x91, 0xac, 0xfa, 0x61, 0x1a, 0x80, 0xaa, 0xd8, 0xfd},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd2, 0x60, 0xd7, 0xc2, 0xac, 0xb7, 0xd3, 0x72,
-      0xbb, 0x47, 0x7c, 0xfa, 0xb9, 0xe1, 0xd4, 0xf6, 0x57, 0xf6, 0xfd, 0xea,
-      0x78, 0xb5, 0xc8, 0x1f, 0x14, 0x4a, 0x84, 0x42, 0x09, 0x67, 0x1a, 0x10},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf7, 0x42, 0x63, 0x00, 0x0a, 0xb4, 0xe2, 0x59,
-      0x6d, 0xc2, 0x37, 0xcd, 0x8c, 0xed, 0xbb, 0x13, 0x64, 0xa1, 0x57, 0x21,
-      0xe1, 0x23, 0x26, 0x9a, 0x60, 0xe3, 0x11, 0xae, 0x06, 0x1a, 0x16, 0xc5}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xfc, 0x3a, 0x4a, 0xc0, 0xf9, 0x51, 0x76, 0x0a,
-      0x2a, 0x0d, 0xb0, 0x37, 0x04, 0xbf, 0xbc, 0xa2, 0xfe, 0x3e, 0xcb, 0x57,
-      0x2c, 0x8f, 0x8c, 0x4e, 0x4b, 0x5c, 0xff, 0x60, 0x15, 0x9a, 0xaa, 0xea},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x3c, 0x07, 0x3c, 0xdc, 0xbc, 0x43, 0xc2, 0xd3,
-      0x26, 0xa8, 0x91, 0x45, 0xa0, 0x0b, 0xc8, 0x2e, 0xc8, 0xfb, 0x06, 0xba,
-      0x7b, 0x4c, 0xf8, 0x1e, 0xfd, 0xab, 0xee, 0xa0, 0xfd, 0xea, 0x90, 0x8e},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x27, 0x50, 0x68, 0xec, 0x36, 0xc1, 0xda, 0xac,
-      0x5a, 0xb8, 0x21, 0xc3, 0xcd, 0x63, 0x91, 0x69, 0x67, 0xc1, 0x44, 0xba,
-      0xaf, 0xf8, 0x40, 0xd9, 0xf7, 0x85, 0x8c, 0x57, 0x88, 0x35, 0x65, 0x42}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa0, 0x1d, 0x6c, 0x09, 0x71, 0xbc, 0x2d, 0x26,
-      0xb4, 0xe0, 0x11, 0x30, 0x9b, 0xe9, 0xf4, 0x06, 0xd2, 0xb6, 0xce, 0x7d,
-      0xe6, 0xc8, 0x53, 0xa7, 0xa5, 0xa8, 0xa0, 0xb2, 0x66, 0x50, 0xf9, 0xb5},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x34, 0x41, 0x3c, 0xd4, 0x53, 0xf1, 0xe6, 0xdd,
-      0x2f, 0x09, 0xf2, 0x13, 0x87, 0xb9, 0x62, 0x4d, 0xac, 0x39, 0xa6, 0x93,
-      0x2b, 0x7c, 0x38, 0x9c, 0xa5, 0xc4, 0x86, 0x52, 0xe1, 0xc0, 0xf4, 0xd1},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x83, 0x54, 0xbe, 0x3e, 0xe9, 0xb6, 0xcd, 0xbb,
-      0x95, 0xfd, 0x3f, 0x6e, 0xc8, 0xfc, 0x75, 0xc0, 0x5e, 0x2f, 0xe2, 0x9e,
-      0x02, 0x3c, 0x78, 0x41, 0xda, 0x45, 0xf4, 0xe9, 0xaa, 0x67, 0x3d, 0x39}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xcc, 0x6e, 0x5b, 0x94, 0xa8, 0x8c, 0x68, 0xff,
-      0xd8, 0x3c, 0xd8, 0xdd, 0x8a, 0x5f, 0xa5, 0xde, 0xfc, 0x44, 0x8a, 0xdc,
-      0xc1, 0x68, 0x19, 0x84, 0xdf, 0x04, 0x02, 0x67, 0xc3, 0xce, 0xf7, 0x31},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x15, 0xd6, 0x88, 0x87, 0xcb, 0x9b, 0x2c, 0x6d,
-      0xc7, 0x9d, 0x39, 0x53, 0x1f, 0xab, 0x3f, 0x8b, 0xc0, 0xc9, 0x09, 0x6d,
-      0xda, 0x2d, 0xe1, 0x1a, 0xd7, 0x38, 0x39, 0x28, 0x88, 0xee, 0x5d, 0x20},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa4, 0xde, 0xa2, 0xfb, 0x58, 0x8a, 0x2f, 0x31,
-      0x0c, 0x68, 0xfb, 0x45, 0x58, 0x40, 0x9e, 0xd0, 0xdc, 0xf5, 0x4f, 0xad,
-      0x7d, 0x12, 0x4b, 0x3c, 0x4b, 0xde, 0x9c, 0x52, 0x1b, 0x4e, 0xdb, 0xc4}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x50, 0xd0, 0x16, 0x00, 0x30, 0x70, 0x66, 0x70,
-      0xf4, 0x9b, 0xf4, 0x42, 0xe3, 0xf1, 0xb7, 0xc5, 0x04, 0x53, 0xee, 0x6a,
-      0x93, 0x16, 0xdf, 0x94, 0xfb, 0x8d, 0xf5, 0xd8, 0x8d, 0xa6, 0x3e, 0x0f},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x3f, 0xe2, 0x71, 0xd8, 0x66, 0xb9, 0xd1, 0xd5,
-      0xd2, 0x3a, 0x5f, 0x11, 0xdc, 0xe4, 0xf5, 0xc6, 0x0c, 0x2c, 0xb7, 0x31,
-      0xb8, 0x15, 0xdf, 0xf1, 0x0f, 0x52, 0x99, 0x8d, 0x8d, 0x22, 0xed, 0xee},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x15, 0xe7, 0x9b, 0x93, 0x0e, 0x98, 0x8d, 0x4d,
-      0x92, 0xbe, 0xe3, 0x90, 0xdf, 0x06, 0x59, 0x30, 0x3d, 0x48, 0x16, 0x19,
-      0xb0, 0x6c, 0x8a, 0x1b, 0xf8, 0x8f, 0x15, 0x84, 0xcb, 0x5a, 0xdd, 0x72}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x41, 0x30, 0x1b, 0x51, 0xc7, 0x3e, 0xf6, 0x74,
-      0x49, 0x5c, 0x80, 0xd8, 0x4c, 0xff, 0xc5, 0x6f, 0x1e, 0x50, 0x10, 0xc2,
-      0x15, 0x01, 0x92, 0x5a, 0xb0, 0x83, 0xb4, 0x92, 0x32, 0x39, 0x26, 0x5a},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x57, 0xfc, 0x81, 0xb5, 0xa8, 0x80, 0xe7, 0xc0,
-      0x59, 0x2d, 0xf8, 0x03, 0x98, 0x4a, 0x8d, 0x28, 0x02, 0x42, 0x32, 0x3b,
-      0x9c, 0xf3, 0x1a, 0x32, 0xdc, 0xbc, 0x52, 0xca, 0x26, 0x23, 0xde, 0xb6},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xed, 0x8f, 0xd2, 0xe7, 0x4e, 0x0c, 0x04, 0xeb,
-      0x4f, 0x37, 0x4c, 0x2a, 0x70, 0x45, 0x6b, 0x5e, 0xc0, 0xb1, 0xa4, 0x3b,
-      0x2e, 0x38, 0xd7, 0xaa, 0x5b, 0x6d, 0x0f, 0x61, 0x0f, 0xae, 0x79, 0x1c}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x36, 0x87, 0xb9, 0x29, 0xce, 0x38, 0x99, 0xd6,
-      0x08, 0xab, 0x94, 0x68, 0x2f, 0xfa, 0x4e, 0xb4, 0xc4, 0x3d, 0xf0, 0xe9,
-      0xeb, 0xd0, 0x16, 0x7f, 0x4c, 0x97, 0x9f, 0x1a, 0x3d, 0x21, 0xf6, 0xa8},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x74, 0x16, 0x79, 0x5c, 0x1a, 0x57, 0x94, 0x40,
-      0xb1, 0x0b, 0xce, 0x15, 0x63, 0xf9, 0xbb, 0x62, 0x84, 0x7f, 0xf1, 0x9c,
-      0xda, 0x85, 0x0a, 0xce, 0x60, 0x30, 0x29, 0x74, 0x5c, 0xd6, 0x06, 0x41},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x9a, 0x9d, 0xec, 0x53, 0x19, 0x8d, 0x06, 0xc9,
-      0x18, 0xab, 0x60, 0x5a, 0xc8, 0x5b, 0x06, 0xb7, 0xa5, 0x7a, 0x86, 0x08,
-      0x16, 0x0b, 0xbb, 0xf0, 0x42, 0xce, 0xcf, 0xad, 0x29, 0x6c, 0x15, 0x95}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x16, 0xf5, 0xa2, 0xa4, 0xd8, 0xc8,
-      0x43, 0x70, 0x59, 0x40, 0x2b, 0x19, 0xbe, 0x6d, 0xbf, 0x68, 0x97, 0x8e,
-      0x3f, 0x70, 0xe1, 0x53, 0xe7, 0x06, 0x3f, 0x14, 0xf5, 0xec, 0x70, 0xd9},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf6, 0x37, 0x44, 0x01, 0xb4, 0xbf, 0x5d, 0xaa,
-      0x32, 0x1c, 0x15, 0x83, 0x77, 0x47, 0xbc, 0xda, 0xb0, 0x2c, 0xce, 0xe9,
-      0xbd, 0x1b, 0x4e, 0x9a, 0xd2, 0xa4, 0x90, 0x3e, 0x10, 0x25, 0x19, 0x56},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x57, 0xb8, 0x97, 0x29, 0xce, 0x39, 0xfe, 0xeb,
-      0xae, 0xab, 0x3a, 0xc6, 0x61, 0xfd, 0xe5, 0x86, 0x2f, 0x21, 0x48, 0x38,
-      0xb6, 0x52, 0xbe, 0x42, 0x1d, 0x3f, 0x1e, 0xa2, 0x50, 0x38, 0xe5, 0x94}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x8e, 0xd3, 0x26, 0x5f, 0xb8, 0x0b, 0x48, 0x3a,
-      0xab, 0x45, 0xaa, 0xb5, 0xbc, 0x9d, 0x6a, 0xf4, 0xd8, 0x7e, 0x43, 0x75,
-      0xf3, 0xea, 0x96, 0x57, 0xee, 0xa9, 0x13, 0x30, 0x69, 0xc0, 0x96, 0xe8},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x4b, 0x83, 0xca, 0x0c, 0x7a, 0xe2, 0x21, 0x18,
-      0x25, 0x36, 0xfe, 0xab, 0xb7, 0x96, 0x8a, 0xcd, 0x73, 0x66, 0x80, 0x45,
-      0xd2, 0xa7, 0x9c, 0xbd, 0xf9, 0xb5, 0x40, 0xdf, 0x20, 0xd7, 0xcf, 0x9d},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa2, 0xe9, 0xbd, 0xf8, 0x50, 0x98, 0x21, 0x2c,
-      0xe5, 0xc6, 0xf7, 0x92, 0x55, 0x1e, 0xcb, 0x88, 0x89, 0xca, 0x46, 0xd1,
-      0x98, 0xc9, 0x6e, 0xaa, 0x76, 0xd3, 0xca, 0x53, 0x05, 0x34, 0x03, 0x60}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x53, 0x96, 0xf5, 0xb2, 0x63, 0x01, 0x2c, 0xaf,
-      0x4d, 0x18, 0x0b, 0x53, 0x6e, 0x04, 0xe0, 0x1b, 0x57, 0x7a, 0x1d, 0xb1,
-      0xa7, 0x24, 0x73, 0x61, 0x6d, 0xec, 0x10, 0xad, 0x27, 0xce, 0x14, 0x59},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x3b, 0x33, 0xee, 0x1b, 0xee, 0xd4, 0x8b, 0xe2,
-      0x6a, 0x7f, 0x7a, 0x59, 0x8f, 0xbe, 0x1f, 0xf3, 0xf5, 0xad, 0x46, 0x30,
-      0x8a, 0xf1, 0xc3, 0xaa, 0xe4, 0x4a, 0x1d, 0x33, 0x0a, 0x5e, 0x9a, 0x59},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x1c, 0xc4, 0x98, 0xa5, 0x69, 0xed, 0x7c, 0xdb,
-      0xe6, 0xd1, 0x86, 0xa4, 0x8c, 0x02, 0x41, 0x2f, 0x5f, 0x80, 0xf8, 0xba,
-      0x3d, 0x1c, 0x8d, 0x92, 0x33, 0xcd, 0x2c, 0x3e, 0xc6, 0x1f, 0xc4, 0x50}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x49, 0x1e, 0xaf, 0xa8, 0xfe, 0x55, 0x98, 0x46,
-      0x5c, 0x12, 0xed, 0x28, 0xec, 0xc3, 0x82, 0xb5, 0x72, 0xa7, 0x33, 0xcf,
-      0x97, 0x31, 0xd5, 0x72, 0xae, 0x35, 0x4f, 0x37, 0x6c, 0x5e, 0x73, 0x33},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa9, 0x51, 0x26, 0xdd, 0x76, 0x43, 0x93, 0x46,
-      0x63, 0x29, 0xa0, 0x63, 0xc7, 0x58, 0x3b, 0xc0, 0x3b, 0x90, 0x14, 0x04,
-      0xfb, 0x94, 0x8d, 0xbf, 0x57, 0x91, 0x32, 0xde, 0x13, 0x7c, 0x7e, 0xc3},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x55, 0x2f, 0xed, 0x15, 0x0e, 0x84, 0x18, 0x7f,
-      0xd3, 0x02, 0x7d, 0x76, 0x6d, 0xb1, 0xc7, 0xeb, 0xb8, 0x04, 0x67, 0x33,
-      0x7a, 0x82, 0x3a, 0x6c, 0x88, 0x0f, 0x76, 0x3e, 0x0c, 0x85, 0xde, 0xb1}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xc7, 0x32, 0xff, 0x7e, 0x1d, 0x19, 0x1f, 0xbf,
-      0x5e, 0x57, 0x69, 0xbe, 0x5f, 0x49, 0xd2, 0xd0, 0xa9, 0xf8, 0x3c, 0x78,
-      0x11, 0x8a, 0x90, 0x11, 0x41, 0x7c, 0xee, 0x3c, 0x85, 0x81, 0x25, 0xf3},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xcd, 0xa4, 0x6c, 0x1e, 0x22, 0x41, 0x5f, 0xa1,
-      0x9a, 0x5a, 0xe9, 0x60, 0xcc, 0xac, 0x13, 0xbd, 0x68, 0x26, 0xa0, 0xf6,
-      0xe1, 0xed, 0x81, 0x9c, 0x17, 0x47, 0x03, 0x64, 0x73, 0xee, 0x8d, 0x79},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf5, 0x38, 0xa0, 0x4f, 0xa5, 0x4e, 0xc0, 0x39,
-      0x0d, 0x6b, 0x15, 0x19, 0x51, 0x72, 0x0c, 0xa9, 0x2e, 0xc1, 0xc3, 0xfd,
-      0xdc, 0x5a, 0x3c, 0xb8, 0xf8, 0x33, 0xdf, 0x95, 0xad, 0x88, 0xb2, 0xf6}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xfd, 0xa4, 0x35, 0x30, 0x8c, 0x29, 0x81, 0x30,
-      0xfb, 0x6f, 0xee, 0xd9, 0xb6, 0x46, 0xaa, 0x18, 0x4a, 0x17, 0xe1, 0x1d,
-      0xa6, 0x84, 0x48, 0xa3, 0xe5, 0x98, 0x1e, 0x22, 0xff, 0x1a, 0x63, 0x5b},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x48, 0xe3, 0x32, 0xe3, 0xff, 0x61, 0x23, 0x59,
-      0x04, 0x3b, 0x78, 0xcb, 0x7a, 0x8e, 0xc2, 0x6c, 0x14, 0x03, 0x79, 0xf5,
-      0xef, 0xc4, 0x2d, 0x92, 0x8e, 0xba, 0x02, 0x45, 0x42, 0xba, 0xb8, 0x80},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xeb, 0x2c, 0xaa, 0x98, 0xe5, 0x48, 0xca, 0x69,
-      0x3b, 0xed, 0xe6, 0x43, 0x0d, 0xcf, 0x30, 0xca, 0x6d, 0xac, 0xba, 0xe2,
-      0xdb, 0xc1, 0x54, 0x68, 0x67, 0xb6, 0xfb, 0xd7, 0xfb, 0xf8, 0xb7, 0x15}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5c, 0xd9, 0x35, 0x56, 0x2f, 0x3e, 0x6f, 0x8a,
-      0x3f, 0x64, 0xb4, 0xd2, 0x9a, 0x5f, 0xdb, 0xd8, 0x41, 0x7c, 0xd9, 0x45,
-      0x92, 0x98, 0xf9, 0xbe, 0x0a, 0x7e, 0x45, 0x70, 0x59, 0xd5, 0x6b, 0x5c},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xea, 0x59, 0x6a, 0x68, 0x71, 0x46, 0xc4, 0x25,
-      0x8a, 0x70, 0xf7, 0x0c, 0x08, 0xac, 0xe8, 0xd7, 0x22, 0xbf, 0xca, 0xe3,
-      0xcc, 0x0f, 0xe4, 0xcb, 0xd3, 0x10, 0x51, 0xd4, 0xb7, 0x82, 0x44, 0x4c},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x24, 0xc7, 0xf0, 0xf4, 0x96, 0xf1, 0x89, 0x94,
-      0xa9, 0x13, 0xd3, 0x1a, 0x85, 0x8d, 0x1d, 0x6f, 0x7d, 0x42, 0x24, 0xa9,
-      0xcb, 0x4a, 0xda, 0x9e, 0x5e, 0xf2, 0xd8, 0x59, 0x16, 0x31, 0x1a, 0xb9}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x60, 0x1a, 0x4c, 0x5d, 0x5f, 0x8d, 0x67, 0x59,
-      0x16, 0x84, 0x69, 0xbe, 0x48, 0x67, 0xec, 0x6d, 0xb2, 0x9c, 0x81, 0x4a,
-      0x85, 0x77, 0xba, 0x76, 0xea, 0xbe, 0x08, 0x2a, 0xce, 0x0d, 0x25, 0xe0},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xe2, 0x1c, 0x67, 0x1a, 0x66, 0x7f, 0x6c, 0xfd,
-      0xf1, 0xad, 0xdd, 0x34, 0x53, 0x22, 0x4b, 0xea, 0xbc, 0x02, 0x43, 0x94,
-      0xeb, 0x59, 0xc1, 0x73, 0x78, 0x14, 0x3b, 0xa1, 0x29, 0xb8, 0x49, 0x45},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x01, 0xc3, 0x4e, 0x11, 0x60, 0x7c, 0xd0, 0x7d,
-      0x27, 0xb3, 0x50, 0x78, 0x4b, 0x2a, 0xd5, 0x14, 0x84, 0x2a, 0x39, 0x2e,
-      0xb3, 0x53, 0x82, 0x5c, 0x65, 0xce, 0x7b, 0xda, 0xc1, 0x1c, 0xc2, 0x74}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd5, 0xe3, 0xb0, 0x15, 0x53, 0x04, 0x96, 0x47,
-      0xef, 0x77, 0x4d, 0x4c, 0x53, 0x3b, 0x5a, 0x94, 0xbf, 0xdc, 0xa6, 0x7b,
-      0x17, 0x0b, 0xe7, 0xf6, 0x56, 0x13, 0x89, 0xaf, 0xfd, 0x20, 0xc9, 0x30},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xdb, 0x05, 0x82, 0xb5, 0x3c, 0x54, 0x3c, 0xbd,
-      0xbb, 0x1b, 0xd9, 0x85, 0x03, 0x7b, 0x98, 0x5e, 0xc9, 0xa3, 0x22, 0x73,
-      0x64, 0x37, 0x45, 0x6f, 0x2c, 0x9f, 0xe2, 0xd9, 0xfd, 0x9c, 0x37, 0xa5},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xdf, 0x53, 0x0a, 0x61, 0x96, 0x4e, 0x91, 0x0b,
-      0x34, 0x5a, 0x46, 0xce, 0x38, 0xe2, 0x05, 0xba, 0x59, 0x53, 0x4c, 0xeb,
-      0xda, 0x98, 0xab, 0x91, 0x89, 0x6c, 0xce, 0x68, 0x7e, 0x9a, 0x4f, 0x0c}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x6d, 0xb0, 0xd7, 0xdf, 0x2a, 0x4a, 0x4b, 0xe4,
-      0xc3, 0x2f, 0xab, 0x02, 0xa1, 0x92, 0x74, 0x08, 0x9c, 0x56, 0xa5, 0xb0,
-      0x5d, 0xa4, 0xf7, 0x8b, 0xd0, 0x71, 0xa0, 0x77, 0x5c, 0x47, 0x16, 0xec},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xb5, 0xfa, 0x20, 0x77, 0xba, 0x1a,
-      0x0b, 0xef, 0x08, 0xaf, 0x43, 0xb9, 0x88, 0xa0, 0x9c, 0x91, 0x59, 0xb9,
-      0xd8, 0xa2, 0xb6, 0xc2, 0x65, 0x49, 0x32, 0x51, 0xd6, 0xf6, 0xb7, 0x38},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x85, 0x7b, 0xb2, 0x9c, 0x8c, 0x9c, 0x01, 0x9c,
-      0x8b, 0xdf, 0x72, 0x16, 0x87, 0x6d, 0xeb, 0xb8, 0xbb, 0x80, 0x49, 0xf9,
-      0x93, 0x59, 0xe3, 0x83, 0x0d, 0x9b, 0x07, 0x96, 0xbe, 0x47, 0xd1, 0x21}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xdc, 0xf1, 0x13, 0x1b, 0x2d, 0x1c, 0x46, 0xab,
-      0x5d, 0xe9, 0x43, 0xc2, 0x76, 0x4e, 0x4f, 0x02, 0x98, 0x1d, 0x6b, 0x94,
-      0x4a, 0x1c, 0xc7, 0xc6, 0x4a, 0xcd, 0x6c, 0x20, 0x2c, 0x99, 0x38, 0xbc},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x9e, 0xe0, 0x19, 0x54, 0x8c, 0xed, 0xf0, 0x48,
-      0x89, 0x44, 0x8f, 0x5d, 0x1e, 0x1b, 0x8a, 0x8f, 0xa3, 0x62, 0x22, 0x9e,
-      0xb5, 0x02, 0x87, 0xfe, 0x9b, 0xff, 0x81, 0x67, 0xf7, 0xb4, 0x6a, 0x52},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xba, 0xb3, 0x4e, 0x08, 0x94, 0xc9, 0xdc, 0x47,
-      0x86, 0xb0, 0x77, 0x0e, 0x36, 0xb3, 0x54, 0x5a, 0xa7, 0xa3, 0x72, 0xa7,
-      0x31, 0x23, 0xcd, 0xb2, 0xe0, 0x4b, 0xe0, 0x0f, 0xb0, 0xae, 0x04, 0x99}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x28, 0x7f, 0x0e, 0x56, 0x55, 0xd0, 0xd1, 0x2d,
-      0x02, 0xea, 0x20, 0x52, 0x1b, 0x14, 0xb4, 0x5b, 0xc3, 0x55, 0x70, 0x63,
-      0x58, 0x1f, 0x07, 0xb7, 0xbc, 0x45, 0x24, 0x1b, 0x8c, 0x20, 0x61, 0x3e},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x32, 0xda, 0x83, 0x65, 0x81, 0x70, 0xf9, 0x4e,
-      0xe9, 0xf0, 0x41, 0xe8, 0x5f, 0x29, 0x81, 0xf3, 0xb6, 0x5f, 0x98, 0x79,
-      0x46, 0xdf, 0xd1, 0x8f, 0xf7, 0x52, 0x1a, 0x78, 0xa8, 0xc6, 0x9f, 0x2b},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x6c, 0x6a, 0x18, 0xea, 0xe8, 0xf9, 0xad, 0xa1,
-      0xd3, 0x76, 0x67, 0x48, 0x36, 0xe4, 0xc0, 0xd0, 0x8f, 0x3a, 0xfd, 0x93,
-      0xe5, 0xc3, 0xb5, 0x62, 0xdb, 0x99, 0x26, 0x61, 0xa1, 0xd2, 0x75, 0x42}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x91, 0x74, 0xfb, 0x2b, 0xfd, 0x6a, 0xb1, 0xa4,
-      0x2e, 0x22, 0xd2, 0x72, 0xbc, 0x81, 0x63, 0x67, 0x81, 0x31, 0x36, 0xad,
-      0xd9, 0x70, 0x2f, 0x18, 0x43, 0x3e, 0xb5, 0xdb, 0x67, 0xfd, 0x1e, 0x0c},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x1c, 0xa5, 0x20, 0xa0, 0x89, 0x00, 0x1c, 0xd7,
-      0xf9, 0x21, 0x4f, 0x3e, 0x9b, 0xce, 0xf0, 0xb4, 0x64, 0x47, 0xfb, 0x1a,
-      0x93, 0x0f, 0xc7, 0xf6, 0xab, 0x25, 0xb9, 0x00, 0xba, 0xca, 0x78, 0xc2},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x54, 0x11, 0xd4, 0x62, 0x40, 0xcc, 0x51, 0x4d,
-      0xf2, 0x81, 0xda, 0xaa, 0xf1, 0x4a, 0x62, 0x66, 0xdc, 0x31, 0xce, 0xd4,
-      0x1a, 0x14, 0xa6, 0x6c, 0xb1, 0x6f, 0xe0, 0x4b, 0x81, 0x7f, 0x74, 0xce}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xda, 0x03, 0x4a, 0xb4, 0x5e, 0x2b, 0xaa, 0x97,
-      0x0b, 0x89, 0x5d, 0x62, 0x61, 0x9a, 0xfa, 0x56, 0x07, 0xf6, 0x84, 0x57,
-      0x90, 0x60, 0x4b, 0x68, 0xe2, 0xf5, 0x72, 0xf1, 0x27, 0x0f, 0xd4, 0xcc},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5e, 0x75, 0x07, 0x41, 0x35, 0x75, 0x0f, 0x37,
-      0x08, 0xa4, 0x12, 0x6e, 0x0d, 0x52, 0x06, 0xdb, 0xae, 0x42, 0x10, 0x74,
-      0x00, 0x59, 0x81, 0xda, 0xa6, 0xc9, 0x21, 0x94, 0x81, 0x30, 0xf3, 0xba},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xdc, 0x03, 0x21, 0xbe, 0xfc, 0x52, 0x3c, 0x11,
-      0x47, 0x0b, 0x00, 0x27, 0x6d, 0x70, 0xd4, 0x55, 0x4a, 0x90, 0x7c, 0x66,
-      0xef, 0x43, 0xaf, 0x01, 0xad, 0x21, 0xbb, 0x05, 0x55, 0xfd, 0x91, 0x69}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf5, 0xec, 0xa8, 0xb7, 0x68, 0x5f, 0xbd, 0x2e,
-      0x7c, 0x62, 0x24, 0x6f, 0x4d, 0x10, 0x2a, 0x93, 0x2c, 0xd3, 0x65, 0xc3,
-      0x8d, 0x90, 0xee, 0x7d, 0xb4, 0x27, 0xf3, 0x48, 0xf6, 0x5e, 0xb7, 0xa9},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x4e, 0x05, 0xbb, 0xb7, 0xe7, 0xa7, 0x15, 0x0d,
-      0x0c, 0x73, 0xff, 0x2e, 0xbe, 0xf3, 0xf3, 0x79, 0x1c, 0x12, 0x7b, 0x8b,
-      0x88, 0x2c, 0x76, 0x9f, 0x18, 0x2f, 0x14, 0xe6, 0x60, 0x13, 0xcd, 0xf5},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x9f, 0x90, 0x59, 0x20, 0x43, 0x61, 0xd4, 0xaf,
-      0x27, 0xd0, 0xc6, 0x89, 0xcc, 0xb7, 0xa1, 0x12, 0x7a, 0xee, 0x18, 0x32,
-      0x31, 0xb7, 0xe8, 0x63, 0x0b, 0xc6, 0x2d, 0xdb, 0x6b, 0x1a, 0x87, 0x21}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x87, 0xb6, 0x55, 0x27, 0x31, 0xef, 0x83, 0xac,
-      0x79, 0x52, 0x96, 0x4e, 0xd2, 0x9c, 0x5b, 0xea, 0x87, 0xc4, 0x2c, 0x56,
-      0x89, 0x69, 0xc1, 0x77, 0x5f, 0x07, 0xb6, 0xda, 0x85, 0x61, 0xe6, 0xeb},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x12, 0x1d, 0xcb, 0x5c, 0x99, 0xf6, 0x72, 0x80,
-      0xa4, 0x27, 0x40, 0x23, 0x11, 0xa1, 0xe5, 0x51, 0x25, 0x20, 0x50, 0xc6,
-      0x4a, 0x15, 0x3b, 0x6e, 0xb6, 0xe0, 0x3a, 0x44, 0x0a, 0x08, 0x74, 0x90},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xb2, 0x53, 0x82, 0x45, 0xf0, 0x5c, 0xd0, 0x19,
-      0xe9, 0xff, 0xc4, 0x0f, 0xbd, 0x1b, 0x37, 0xd6, 0xdf, 0xca, 0x10, 0x59,
-      0x1b, 0x00, 0xdf, 0x74, 0x8d, 0x7a, 0x31, 0x60, 0xc0, 0x24, 0x65, 0x0b}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x89, 0x6b, 0xfe, 0xb0, 0x74, 0x71, 0x6d, 0x10,
-      0x1d, 0xb0, 0xe0, 0xb4, 0xab, 0x86, 0x19, 0xa3, 0xbd, 0xec, 0x2f, 0x36,
-      0x13, 0x8f, 0xe5, 0xeb, 0x49, 0xa7, 0x63, 0x00, 0x65, 0xec, 0x92, 0x72},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa5, 0x7c, 0x55, 0xf8, 0x81, 0x2e, 0xd4, 0xee,
-      0x16, 0x48, 0xd1, 0xd7, 0x76, 0xc9, 0xee, 0xea, 0x5f, 0x89, 0x05, 0x8a,
-      0xda, 0x06, 0x2e, 0x53, 0x11, 0x49, 0x7b, 0xcf, 0xe2, 0xcd, 0xb6, 0x6b},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0xc2, 0x0a, 0xcc, 0xa9, 0x35, 0xec,
-      0xa0, 0x9e, 0x1c, 0x36, 0x2e, 0x32, 0xe1, 0x8e, 0xc7, 0x63, 0x3a, 0xff,
-      0x6a, 0xfa, 0xef, 0x98, 0xc2, 0x10, 0x8c, 0x6d, 0x33, 0x12, 0x3c, 0x98}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5d, 0xdf, 0xc7, 0x4a, 0x7f, 0x57, 0x84, 0x17,
-      0xbd, 0xb0, 0xd7, 0xec, 0x3f, 0x1d, 0xf9, 0xf3, 0x65, 0xd6, 0x18, 0x5c,
-      0x99, 0x96, 0xf5, 0x96, 0x30, 0x92, 0xbd, 0x67, 0x22, 0xf5, 0x54, 0xdb},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xb3, 0x38, 0x6c, 0x00, 0x2e, 0x72, 0xb6, 0x46,
-      0x1b, 0x38, 0x1f, 0x9f, 0x5b, 0xc8, 0xc4, 0xd1, 0x94, 0xf2, 0x6a, 0x42,
-      0xf2, 0x62, 0xe1, 0x05, 0x55, 0x59, 0xaf, 0x9b, 0xc7, 0x76, 0xf7, 0xda},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x71, 0xa5, 0x21, 0x8d, 0x0f, 0xce, 0x9b, 0x69,
-      0xed, 0xd8, 0x3f, 0x84, 0x32, 0x39, 0x42, 0xcc, 0x52, 0x8c, 0x95, 0xa5,
-      0x3d, 0xb3, 0xe8, 0x02, 0x3d, 0xc7, 0x25, 0x66, 0xc3, 0x7c, 0x6c, 0x95}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x6c, 0x56, 0x26, 0x01, 0x24, 0xe5, 0x93, 0xc3,
-      0x3e, 0xc7, 0x45, 0x9b, 0x52, 0xef, 0x80, 0x3f, 0xa4, 0x05, 0x51, 0x88,
-      0x9c, 0xb8, 0x18, 0x7a, 0xa6, 0x35, 0x84, 0xf3, 0xbb, 0xc7, 0xfc, 0x3b},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5e, 0x5e, 0x8c, 0xa2, 0x6e, 0x8a, 0xdd, 0x9c,
-      0x00, 0x94, 0x79, 0x0a, 0x33, 0x79, 0x94, 0x7a, 0x99, 0x23, 0x45, 0xa5,
-      0xd8, 0xab, 0x00, 0x78, 0xce, 0xf4, 0xea, 0x55, 0x47, 0x25, 0x3d, 0x65},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xeb, 0x48, 0x16, 0x4b, 0x67, 0xef, 0x4b, 0x72,
-      0x6c, 0x96, 0x91, 0x2b, 0x3a, 0x5c, 0x97, 0x9e, 0xf2, 0xd3, 0x52, 0xc2,
-      0x58, 0x8d, 0x81, 0x6a, 0xdf, 0x8c, 0x7e, 0x08, 0xce, 0xb4, 0xd1, 0xd5}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf4, 0x5a, 0x57, 0xe9, 0x7f, 0xdc, 0xf4, 0x25,
-      0x2e, 0xdc, 0xb6, 0x01, 0xc2, 0xb8, 0x75, 0xd6, 0x8b, 0x19, 0x7b, 0x4b,
-      0xb7, 0xa2, 0xe6, 0xb8, 0x14, 0x40, 0xd2, 0xce, 0xfb, 0x97, 0x88, 0x43},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x7c, 0xb1, 0x1a, 0xc0, 0xfa, 0xec, 0x27, 0xf9,
-      0x2e, 0x62, 0x67, 0xab, 0x03, 0x1b, 0xee, 0x15, 0x7e, 0x91, 0xcd, 0x11,
-      0x48, 0x01, 0x3c, 0x88, 0x01, 0x5e, 0xfd, 0x75, 0x6c, 0xab, 0x8a, 0xdd},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xdd, 0x53, 0x9b, 0xa5, 0x6c, 0x6b, 0xbc, 0xc5,
-      0x1b, 0x3e, 0x82, 0xfb, 0x1b, 0x3f, 0x09, 0x34, 0xe4, 0x16, 0x96, 0x98,
-      0x0d, 0x9c, 0xd6, 0x75, 0x04, 0xcd, 0xdb, 0xdc, 0x4d, 0x10, 0xba, 0x6e}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x82, 0x88, 0x40, 0xf3, 0x6a, 0x3b, 0x76, 0x86,
-      0xd8, 0x19, 0x2d, 0xa7, 0x0d, 0x93, 0xc1, 0x4f, 0xdf, 0xdb, 0x13, 0x6b,
-      0x3d, 0xd1, 0x8b, 0x16, 0xcf, 0xdf, 0x9a, 0x6d, 0xf0, 0xb2, 0x98, 0x2a},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x1e, 0x5e, 0x45, 0x00, 0x83, 0x9c, 0x81, 0xee,
-      0x75, 0xed, 0x5d, 0xe6, 0xac, 0x05, 0x93, 0xdf, 0x7a, 0x7c, 0xcc, 0xb3,
-      0x1d, 0x52, 0x82, 0x9e, 0xb0, 0x16, 0x06, 0x26, 0x9d, 0xdb, 0x60, 0x63},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x25, 0x3e, 0xaa, 0x70, 0x63, 0xf5, 0x14, 0xa9,
-      0x88, 0xd0, 0xa4, 0x70, 0x01, 0xbf, 0x37, 0x3a, 0xa6, 0x5e, 0x80, 0xc0,
-      0x54, 0x4e, 0x6e, 0x4a, 0x66, 0x3e, 0xfe, 0xfd, 0x46, 0xfe, 0x0c, 0x06}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xfe, 0x2f, 0x26, 0xf6, 0x70, 0x41, 0xcf, 0x28,
-      0x41, 0x5a, 0x56, 0xc1, 0xb3, 0x82, 0x71, 0x06, 0xd7, 0xc8, 0xcf, 0x2b,
-      0xcb, 0xc6, 0xed, 0x3f, 0x8e, 0x5e, 0xb7, 0x64, 0x18, 0x48, 0x59, 0x95},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x27, 0x91, 0x26, 0xd7, 0x0b, 0xf9, 0x40, 0x37,
-      0x3e, 0x03, 0x3f, 0x13, 0x62, 0xaf, 0x4d, 0x5d, 0x74, 0x31, 0x68, 0xee,
-      0xc0, 0xd0, 0x11, 0xff, 0x1a, 0x7a, 0x55, 0x29, 0x9d, 0x5f, 0xf6, 0xc9},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x84, 0x34, 0x6c, 0x0c, 0x33, 0xe8, 0x01,
-      0x4a, 0x40, 0x76, 0xd6, 0x2c, 0x3f, 0x51, 0x85, 0x13, 0xa9, 0x68, 0x12,
-      0x6f, 0x8c, 0xe8, 0x09, 0x0b, 0x67, 0x2e, 0x24, 0xe0, 0xa4, 0xea, 0xf2}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xbd, 0x31, 0xe2, 0x33, 0x3c, 0x1f, 0xe6, 0x58,
-      0x0e, 0xce, 0x3a, 0x72, 0x45, 0xa9, 0x74, 0x28, 0x4f, 0x0a, 0xe0, 0xae,
-      0xc0, 0xbf, 0xef, 0x92, 0xda, 0x58, 0xd7, 0x34, 0xc7, 0xf8, 0xa0, 0x72},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xc1, 0x74, 0x3c, 0x76, 0x65, 0xe7, 0xf7, 0x85,
-      0x3e, 0x0c, 0xef, 0x31, 0x79, 0x58, 0xa9, 0xaa, 0x69, 0x82, 0xae, 0xe8,
-      0xea, 0x86, 0x47, 0x5a, 0x87, 0x38, 0xf3, 0xbd, 0xb8, 0x20, 0x10, 0xa2},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xe9, 0xdb, 0x0a, 0xfc, 0x9d, 0xae, 0xe5, 0x4f,
-      0xb4, 0x0c, 0x08, 0xfc, 0xee, 0xe0, 0x0d, 0x10, 0x8f, 0x9a, 0x17, 0xb3,
-      0xba, 0x40, 0x36, 0xb1, 0x0f, 0x63, 0xe0, 0xae, 0xb3, 0x96, 0x2e, 0x5b}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf5, 0x27, 0x41, 0xda, 0xf7, 0x9a, 0xf7, 0xb4,
-      0xb4, 0x8f, 0x17, 0x99, 0x0e, 0xe9, 0xdb, 0x1b, 0x67, 0x3a, 0x67, 0xe2,
-      0xae, 0x5a, 0x68, 0x31, 0xac, 0xc1, 0x28, 0x1e, 0x12, 0xa4, 0xae, 0x80},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd2, 0xc9, 0xce, 0x25, 0x4f, 0x16, 0x55, 0x44,
-      0x6f, 0xc3, 0xfa, 0x37, 0x1a, 0xd0, 0x1a, 0xf4, 0x30, 0x54, 0x36, 0x7c,
-      0x8f, 0x31, 0xa1, 0x66, 0x1e, 0xa8, 0x22, 0x8a, 0x0a, 0x6c, 0x0a, 0x12},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x06, 0x0b, 0x28, 0x70, 0xb1, 0x50, 0xa5, 0x39,
-      0xa2, 0xfe, 0x20, 0x83, 0xf9, 0x0d, 0xd4, 0x5c, 0x25, 0xb4, 0xf5, 0x08,
-      0x2d, 0xf3, 0x01, 0x03, 0xe2, 0xa2, 0x0d, 0x69, 0xb1, 0xdb, 0xed, 0x61}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x48, 0x43, 0x53, 0x59, 0xce, 0xce, 0x25, 0xd3,
-      0x59, 0x35, 0x27, 0xd1, 0xaa, 0x89, 0xab, 0xa8, 0x3e, 0x5d, 0x9c, 0xf4,
-      0xe9, 0xf1, 0x84, 0xf5, 0x0a, 0xf6, 0x05, 0x7c, 0xa1, 0xea, 0xee, 0xa2},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd4, 0x8d, 0x38, 0x1c, 0x5a, 0xbb, 0x72, 0xc8,
-      0x2d, 0xcb, 0x19, 0x43, 0x9f, 0xb6, 0xdc, 0x6e, 0x9b, 0xe2, 0xd7, 0x36,
-      0x46, 0xd7, 0x5a, 0xae, 0x2d, 0x70, 0x84, 0x06, 0x11, 0x78, 0x39, 0x59},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x25, 0x90, 0x57, 0xa7, 0xcf, 0xfc, 0x7d, 0x2d,
-      0x69, 0xc6, 0x88, 0x84, 0xf4, 0x86, 0x62, 0x0d, 0x17, 0xac, 0xec, 0x7e,
-      0x9f, 0x5b, 0x80, 0x3a, 0xa5, 0x5c, 0x1d, 0x4c, 0xa6, 0x4a, 0xcc, 0x83}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x1e, 0xb3, 0xab, 0x85, 0x1e, 0x6f, 0xa5, 0x02,
-      0xc3, 0x67, 0x8c, 0x21, 0xc5, 0xf8, 0x60, 0x18, 0xdb, 0x50, 0x29, 0xe1,
-      0xe7, 0x5a, 0xfa, 0x81, 0x20, 0x85, 0xed, 0xe5, 0xe1, 0x1b, 0xfe, 0x23},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xb3, 0x28, 0x0d, 0xe3, 0xe6, 0x06, 0xb5, 0x9b,
-      0xbf, 0x1a, 0x4c, 0xac, 0x02, 0x28, 0x13, 0x3e, 0x50, 0x74, 0xcd, 0x5c,
-      0x67, 0x33, 0x92, 0x4e, 0x38, 0xc6, 0xd4, 0x12, 0x97, 0x52, 0xc5, 0x34},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x3b, 0x35, 0x4d, 0x61, 0xf2, 0xa7, 0xdd, 0x88,
-      0x47, 0xa5, 0x1d, 0xa5, 0xf3, 0x93, 0x26, 0x53, 0x65, 0xb7, 0x61, 0xaa,
-      0x79, 0x1a, 0x90, 0xae, 0x88, 0x35, 0x95, 0xc5, 0xad, 0xc8, 0xee, 0xd4}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x1a, 0x8b, 0x57, 0xc1, 0xb9, 0x5f,
-      0x77, 0x59, 0x6d, 0x5a, 0x12, 0x05, 0xc2, 0x84, 0xf5, 0x41, 0x7b, 0xc6,
-      0xae, 0x9d, 0xc2, 0x86, 0xd5, 0x42, 0xf4, 0x65, 0x87, 0xfe, 0x3e, 0xa6},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xba, 0x52, 0xef, 0x4d, 0xe4, 0x5d, 0x78, 0x89,
-      0xcf, 0x2d, 0x74, 0x2b, 0x9f, 0xbc, 0x42, 0x78, 0x36, 0xb4, 0x7d, 0x9a,
-      0x25, 0x3e, 0x75, 0x62, 0x71, 0x52, 0xac, 0xed, 0xa4, 0xcb, 0x35, 0xf2},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5e, 0x1f, 0xed, 0x41, 0x34, 0x02, 0xe3, 0x0d,
-      0x39, 0x1b, 0x29, 0xf8, 0x46, 0xa2, 0xd8, 0x76, 0x26, 0x3a, 0x6d, 0xf9,
-      0xc4, 0xc3, 0x8b, 0x7a, 0xf2, 0x23, 0x30, 0x7a, 0xc1, 0x4f, 0x56, 0xb2}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5c, 0x1a, 0xbf, 0x7a, 0x6a, 0xe1, 0xa0, 0xf0,
-      0x56, 0xae, 0x20, 0xa1, 0x86, 0x64, 0x21, 0xfc, 0x94, 0xdb, 0x81, 0x22,
-      0xe4, 0x2f, 0x90, 0x79, 0x39, 0xb2, 0x47, 0x2e, 0x8a, 0xee, 0x7a, 0x3e},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x0f, 0xea, 0x10, 0x33, 0xf6, 0xbf, 0x19, 0xfb,
-      0x5b, 0x56, 0xb3, 0xae, 0xbc, 0x08, 0xdd, 0xf1, 0x03, 0x94, 0xc6, 0x82,
-      0x5d, 0x09, 0xd2, 0x72, 0x2f, 0xdc, 0x10, 0x3f, 0x5b, 0x55, 0x7c, 0xa1},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xca, 0x76, 0x31, 0x84, 0xa9, 0x69, 0x53, 0x52,
-      0x5e, 0x28, 0xe8, 0xdf, 0x11, 0xc3, 0x7b, 0xfd, 0x4d, 0x85, 0xa5, 0xdb,
-      0x5e, 0x41, 0xb1, 0x4f, 0xde, 0x38, 0x6c, 0x33, 0x14, 0x54, 0xe7, 0x75}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x43, 0x67, 0xde, 0xd1, 0x22, 0xa3, 0x47, 0x47,
-      0x25, 0x94, 0x1c, 0x0c, 0x47, 0x62, 0xca, 0x1b, 0x5c, 0x6a, 0xbb, 0x3c,
-      0xeb, 0x48, 0x7b, 0x04, 0x71, 0xd7, 0x6d, 0x96, 0x96, 0xa9, 0xe4, 0xe4},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x4e, 0x25, 0x26, 0x64, 0xe6, 0xf3, 0x46, 0x02,
-      0x5d, 0x56, 0x8e, 0x5d, 0x7d, 0x77, 0xb5, 0x34, 0xac, 0xbf, 0x0c, 0x10,
-      0x62, 0x05, 0xf4, 0x10, 0x74, 0xfa, 0x39, 0xb6, 0x3b, 0x49, 0x97, 0xfc},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x84, 0x37, 0x4e, 0xb4, 0x64, 0xb8, 0xe9, 0x74,
-      0xb9, 0x45, 0x97, 0x06, 0xb0, 0xf3, 0xe5, 0x43, 0x1c, 0xda, 0xc9, 0x4e,
-      0x3d, 0xe4, 0x2e, 0xba, 0x1a, 0x81, 0x10, 0x98, 0x56, 0xbe, 0x1e, 0x1d}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x26, 0x75, 0x3f, 0xbc, 0x0b, 0x91, 0xb0, 0x47,
-      0x28, 0x83, 0x84, 0x34, 0xf1, 0xad, 0x8f, 0xe8, 0x36, 0xca, 0xe1, 0x92,
-      0x07, 0xf6, 0x1a, 0xbe, 0x46, 0x38, 0xd3, 0x1d, 0x03, 0xfa, 0x1b, 0x19},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd6, 0x37, 0x66, 0x0d, 0xe5, 0x64, 0xbb, 0x9d,
-      0x17, 0x58, 0xab, 0x77, 0x21, 0x72, 0x7c, 0xab, 0x62, 0x89, 0x6b, 0x3c,
-      0xda, 0xad, 0x6c, 0x64, 0xa9, 0x75, 0x76, 0xd5, 0x4d, 0xf8, 0xb8, 0x25},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x67, 0x4d, 0xbe, 0x4b, 0x84, 0x45, 0x16, 0x3a,
-      0xc4, 0x18, 0x20, 0xe3, 0x7e, 0x33, 0xd2, 0xac, 0x49, 0x44, 0x29, 0xaa,
-      0xa9, 0x5c, 0x10, 0xe8, 0x51, 0xcb, 0x83, 0x65, 0xbe, 0x94, 0x99, 0xd0}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x2d, 0x72, 0xb0, 0xee, 0xff, 0x54, 0xc2, 0xc0,
-      0xd2, 0x06, 0xe5, 0x9c, 0xad, 0xa8, 0xd3, 0x4f, 0x9d, 0x5e, 0x89, 0x3e,
-      0xed, 0x37, 0xf8, 0x63, 0x2a, 0xc0, 0xf6, 0x7b, 0x6d, 0xe4, 0xd3, 0x63},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x25, 0xdf, 0x77, 0x4f, 0xfd, 0xc7, 0xac, 0x20,
-      0x5c, 0x7a, 0xdb, 0x92, 0xcf, 0xa1, 0x62, 0xdc, 0xe8, 0x51, 0xa5, 0xc0,
-      0x9a, 0xf1, 0xe5, 0xd6, 0xd3, 0x8a, 0xcb, 0x51, 0xf1, 0x3b, 0xdc, 0x19},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xdc, 0x50, 0xe6, 0x36, 0xf9, 0x6c, 0x43, 0xe1,
-      0x72, 0x7d, 0x4c, 0x99, 0xd6, 0x5d, 0x07, 0x92, 0xa3, 0xa1, 0x08, 0xf4,
-      0xca, 0xe2, 0xba, 0x60, 0x16, 0xc3, 0x92, 0xbd, 0x55, 0xf5, 0xfc, 0xa0}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x27, 0x62, 0xa8, 0xec, 0x8b, 0x1b, 0x7c, 0xd3,
-      0x28, 0x07, 0xca, 0xbf, 0xce, 0x62, 0x3c, 0x0e, 0x4c, 0x19, 0x7f, 0xdd,
-      0x5e, 0x90, 0xdf, 0x48, 0x59, 0x53, 0xd3, 0x80, 0xe0, 0xf6, 0x47, 0x68},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x89, 0x54, 0xd5, 0x97, 0xec, 0x00, 0x49, 0x85,
-      0xb1, 0xf5, 0x7a, 0x8a, 0x2f, 0x1c, 0x97, 0x3d, 0xdd, 0xf5, 0x0a, 0x67,
-      0xa8, 0xfb, 0x65, 0x79, 0xac, 0xef, 0xe6, 0x10, 0x24, 0x39, 0x0a, 0x7e},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x96, 0x77, 0x59, 0x86, 0xa1, 0x0f, 0x98, 0x49,
-      0x1d, 0x45, 0x84, 0x18, 0x98, 0x3d, 0x0f, 0xfa, 0x96, 0xeb, 0x2c, 0x3a,
-      0x4c, 0x94, 0x9f, 0xe4, 0x21, 0xd7, 0xed, 0x30, 0x42, 0xfa, 0xe0, 0x4c}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x39, 0xb4, 0x86, 0x8d, 0x19, 0x92, 0x5c, 0x6a,
-      0x7c, 0xcf, 0xc9, 0x7a, 0x75, 0x46, 0x6e, 0xde, 0x23, 0x9c, 0xd8, 0xd7,
-      0xdc, 0x3b, 0x44, 0xcc, 0xd5, 0xd4, 0x0a, 0x20, 0x52, 0xdb, 0xbe, 0xaa},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x3a, 0x9a, 0xef, 0x54, 0x1f, 0xa2, 0x51, 0x39,
-      0x63, 0xfe, 0xba, 0x1d, 0xaa, 0xb6, 0xe5, 0x8a, 0x2f, 0x7b, 0xf7, 0xac,
-      0x11, 0x9d, 0xbf, 0xc4, 0x92, 0x14, 0x66, 0x4d, 0x1b, 0xf6, 0xe5, 0x91},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x7a, 0xf0, 0x8b, 0xa8, 0x15, 0xba, 0xd9, 0xe1,
-      0x34, 0xfa, 0xd1, 0x23, 0xfe, 0xbf, 0xa6, 0xf6, 0x91, 0xe1, 0x03, 0x95,
-      0x29, 0xe1, 0xd7, 0xbc, 0x8b, 0xf0, 0x1b, 0xe8, 0x0f, 0x2b, 0xeb, 0x9d}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xa6, 0x08, 0x45, 0xc2, 0x05, 0xb2, 0xae, 0x08,
-      0x3a, 0x66, 0xdd, 0x1f, 0x47, 0xe6, 0x49, 0x9f, 0x22, 0x6a, 0x0b, 0x43,
-      0xcf, 0xeb, 0x9a, 0x39, 0x20, 0x64, 0x9d, 0x9c, 0x65, 0xd4, 0xb8, 0x2a},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x8b, 0x11, 0x16, 0x13, 0x50, 0x2e, 0xad, 0xc7,
-      0x6d, 0xa5, 0x78, 0x29, 0xf2, 0x33, 0x98, 0x53, 0xb4, 0xeb, 0x51, 0x33,
-      0x58, 0x88, 0x41, 0x97, 0xf3, 0x34, 0x15, 0xb0, 0x5f, 0x6f, 0xc2, 0x62},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x0d, 0x15, 0xb0, 0x0a, 0xbb, 0xdb, 0x29, 0x04,
-      0x0a, 0x41, 0x8e, 0x3e, 0xfe, 0xe6, 0xd2, 0x5d, 0x8c, 0x33, 0x9a, 0x27,
-      0xe7, 0x56, 0x39, 0xc3, 0x83, 0x79, 0xc9, 0xd6, 0x52, 0x2f, 0x27, 0x2d}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xdb, 0x63, 0x95, 0x1f, 0xc8, 0x52, 0x3f, 0x38,
-      0x7f, 0xd2, 0x1e, 0x88, 0x0d, 0xc8, 0x68, 0xe8, 0x65, 0xe5, 0x68, 0x0f,
-      0xf9, 0x0b, 0x56, 0x41, 0xb2, 0x59, 0x57, 0x13, 0xa3, 0xdd, 0xda, 0x59},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xfe, 0x9d, 0x9d, 0xe0, 0x10, 0xca, 0xf2, 0x07,
-      0xf5, 0x8b, 0x41, 0x7f, 0x31, 0x3d, 0xaa, 0xe9, 0x65, 0x04, 0x2d, 0x0b,
-      0xab, 0xf8, 0x19, 0x9a, 0x49, 0x6f, 0x8d, 0x6d, 0xbf, 0x98, 0x01, 0x54},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x57, 0x3e, 0xb8, 0x98, 0xef, 0x01, 0xba, 0xf7,
-      0xe6, 0xed, 0xfa, 0xdd, 0x64, 0x30, 0xab, 0xbc, 0xd8, 0x51, 0x3e, 0x3d,
-      0x07, 0xa2, 0x3d, 0x9b, 0x77, 0xe1, 0xd0, 0x26, 0x1a, 0x4c, 0x3a, 0x7c}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xf2, 0x95, 0x7c, 0x17, 0x43, 0x38, 0xac, 0xc1,
-      0x99, 0x68, 0x1b, 0x4e, 0x0f, 0x7f, 0xc2, 0x2d, 0xfc, 0x4a, 0xee, 0x1f,
-      0x5d, 0xe5, 0xdc, 0xd3, 0x41, 0x5c, 0xc3, 0x72, 0x72, 0x87, 0xbc, 0x0a},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xc3, 0x35, 0x98, 0x4e, 0xe6, 0xe8, 0x89, 0x02,
-      0x27, 0xf9, 0x20, 0x71, 0xed, 0xec, 0x75, 0xc3, 0xdf, 0xd8, 0x4a, 0xcd,
-      0x4b, 0xfa, 0x87, 0xf3, 0xf6, 0xf3, 0xc0, 0xec, 0xd8, 0x18, 0x49, 0xf4},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x2c, 0xe5, 0x01, 0x05, 0x9e, 0x1e, 0x20, 0x93,
-      0xfd, 0xf6, 0x4b, 0x1e, 0x1a, 0x13, 0xd7, 0x85, 0x1b, 0x2d, 0x26, 0x59,
-      0xde, 0x15, 0x3a, 0x40, 0x04, 0x5d, 0xdd, 0xe0, 0xfe, 0x66, 0x24, 0x95}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x58, 0x68, 0x9b, 0x81, 0x84, 0x66, 0x03, 0xcf,
-      0x7f, 0xa5, 0xb6, 0x9f, 0xca, 0xa1, 0x8f, 0x63, 0xc3, 0xd5, 0x7c, 0xca,
-      0x92, 0xc0, 0xe1, 0xb5, 0x20, 0x57, 0x14, 0x26, 0x86, 0xbd, 0x47, 0x03},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x68, 0xbc, 0x13, 0x48, 0x7f, 0xcf, 0xa5, 0x3a,
-      0xbc, 0x5d, 0x9e, 0xa0, 0xeb, 0x2a, 0xe0, 0x8d, 0x0e, 0x1f, 0x16, 0x3c,
-      0xc0, 0x18, 0x1d, 0x9d, 0x8a, 0xe0, 0x10, 0x52, 0x65, 0xc8, 0x00, 0x4d},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5e, 0x76, 0xaa, 0xfc, 0x67, 0x5e, 0xbd, 0xec,
-      0x4c, 0x55, 0xd6, 0xf0, 0xc3, 0x12, 0xfe, 0x8a, 0xf4, 0x20, 0xc4, 0x54,
-      0x22, 0x43, 0x8a, 0xf4, 0xa6, 0x1e, 0x19, 0xea, 0x9c, 0x0e, 0x0f, 0x2b}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0x25, 0x9b, 0x63, 0x0e, 0xed, 0x9e,
-      0x86, 0x39, 0x5d, 0x58, 0x48, 0x33, 0xcd, 0xf1, 0xf9, 0xfc, 0x6c, 0xc6,
-      0x96, 0xcc, 0xf5, 0x4a, 0x93, 0x10, 0x85, 0x42, 0xdc, 0x99, 0x63, 0x36},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x5b, 0x15, 0x42, 0xd8, 0x54, 0xbe, 0xc9, 0x43,
-      0xa8, 0x82, 0x75, 0x7a, 0xb4, 0xf9, 0x91, 0xa6, 0x71, 0x0c, 0xf2, 0xdd,
-      0x48, 0x73, 0x22, 0xa9, 0x82, 0xe9, 0x05, 0xd9, 0xb4, 0x0d, 0x3b, 0x03},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0xfa, 0xe0, 0x36, 0xdb, 0x96, 0x86,
-      0xa1, 0x36, 0x6c, 0x8b, 0x42, 0x85, 0xcc, 0xa2, 0x65, 0x51, 0x6c, 0x9d,
-      0xfe, 0x22, 0x01, 0x33, 0xcd, 0x56, 0x79, 0x03, 0x19, 0x25, 0x15, 0xbe}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x7b, 0xf9, 0x24, 0xf7, 0xf3, 0x74, 0x7f, 0x5f,
-      0x28, 0x75, 0x91, 0x9b, 0xc9, 0x95, 0xcb, 0xb0, 0xee, 0x0a, 0x33, 0x7a,
-      0xeb, 0x0f, 0x24, 0xc6, 0x54, 0x78, 0xf5, 0xce, 0xda, 0x96, 0x3e, 0x43},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x77, 0xcc, 0xdf, 0x2c, 0xae, 0xcf, 0xba, 0x37,
-      0x8e, 0xbf, 0xce, 0x58, 0x99, 0xde, 0x7f, 0x69, 0x4b, 0x07, 0xf3, 0xed,
-      0x9e, 0xf8, 0x6d, 0x65, 0xd5, 0xb4, 0x1e, 0x89, 0xcc, 0x31, 0x4b, 0x23},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xde, 0xc4, 0x6d, 0x55, 0x9a, 0x33, 0x33, 0x23,
-      0x27, 0x82, 0xa7, 0x4a, 0x46, 0xce, 0xb6, 0x27, 0xcb, 0x3d, 0xcf, 0xd6,
-      0xd8, 0x1b, 0x34, 0x29, 0x82, 0x9d, 0x97, 0x46, 0xb8, 0x74, 0x9b, 0xd3}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x05, 0xcc, 0x5d, 0x0f, 0x73, 0xc0, 0xb6, 0xff,
-      0x8c, 0xed, 0x00, 0xb1, 0x94, 0x34, 0xff, 0x5a, 0x2e, 0x45, 0x84, 0x9d,
-      0xf6, 0x9a, 0xbf, 0xe0, 0xc6, 0x88, 0x99, 0x0a, 0xc7, 0x6c, 0x1e, 0x28},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0xd3, 0x1b, 0xe4, 0x04, 0xd6, 0xd7, 0xdb, 0x38,
-      0x17, 0xb2, 0x68, 0x34, 0x11, 0xd0, 0x9c, 0x50, 0x72, 0x11, 0xe5, 0x44,
-      0xb6, 0x61, 0xd7, 0x5a, 0x29, 0x0e, 0xa7, 0x49, 0x60, 0xbb, 0x98, 0x07},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x14, 0xfd, 0xa3, 0x28, 0xc2, 0xe2, 0xa8, 0xd9,
-      0x30, 0xaf, 0xcd, 0x14, 0x3a, 0x7b, 0xdd, 0x8f, 0x13, 0xc1, 0x2d, 0xe4,
-      0x27, 0xd2, 0x5e, 0xc0, 0x62, 0x89, 0x3e, 0xfb, 0x44, 0x8a, 0x27, 0x60}}
-*/
-};
+#if poseidon_alpha != 17
+#error "to_the_alpha is the addition chain of x^17"
+#endif
 
-// alpha = 17
-static const unsigned char alpha = 0x11;
+// the keys and matrices come from poseidon_tables.h: MDS = MDS_L * MDS_U for
+// the full rounds, and for the partial rounds one key each, MDS_pre and the
+// sparse matrices MDS_sparse (gen_tables.py, partial_rounds_opt)
 
-// 1 0 0
-// 1 1 0
-// 0 1 1
-static const field MDS_L_MNT[sponge_size][sponge_size] = {
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}}};
+// the permutation works on resident field elements, only the calls into it
+// load and store the packed state
+typedef fe sponge[sponge_size];
 
-// 1 0 1
-// 0 1 -1
-// 0 0 2
-static const field MDS_U_MNT[sponge_size][sponge_size] = {
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
-     {0x24, 0x04, 0x89, 0x3f, 0xda, 0xd8, 0x87, 0x8e, 0x71, 0x50, 0x3c, 0x69,
-      0xb0, 0x9d, 0xbf, 0x88, 0xb4, 0x8a, 0x36, 0x14, 0x28, 0x9b, 0x09, 0x01,
-      0x20, 0x12, 0x24, 0x6d, 0x22, 0x42, 0x41, 0x20, 0x00, 0x00, 0x00, 0x01,
-      0x80, 0x0c, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
-    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02}}};
+void matrix_mul_up(sponge s, const fe m[sponge_size][sponge_size]) {
 
-void matrix_mul_up(state s, const state m[sponge_size]) {
+  unsigned int mark = fe_mark();
+  fe t0 = fe_new();
+  fe_mul(t0, m[0][0], s[0]);
+  fe_mul(s[0], m[0][1], s[1]);
+  fe_add(t0, s[0], t0);
+  fe_mul(s[0], m[0][2], s[2]);
+  fe_add(s[0], s[0], t0);
 
-  field t0;
-  field_mul(t0, m[0][0], s[0]);
-  field_mul(s[0], m[0][1], s[1]);
-  field_add(t0, s[0], t0);
-  field_mul(s[0], m[0][2], s[2]);
-  field_add(s[0], s[0], t0);
+  fe_mul(s[1], m[1][1], s[1]);
+  fe_mul(t0, m[1][2], s[2]);
+  fe_add(s[1], s[1], t0);
 
-  field_mul(s[1], m[1][1], s[1]);
-  field_mul(t0, m[1][2], s[2]);
-  field_add(s[1], s[1], t0);
+  fe_mul(s[2], m[2][2], s[2]);
+  fe_release(mark);
+}
+
+void matrix_mul_low(sponge s, const fe m[sponge_size][sponge_size]) {
+  unsigned int mark = fe_mark();
+  fe t0 = fe_new();
+  fe_mul(t0, m[2][2], s[2]);
+  fe_mul(s[2], m[2][1], s[1]);
+  fe_add(t0, s[2], t0);
+  fe_mul(s[2], m[2][0], s[0]);
+  fe_add(s[2], s[2], t0);
+
+  fe_mul(s[1], m[1][1], s[1]);
+  fe_mul(t0, m[1][0], s[0]);
+  fe_add(s[1], s[1], t0);
 
-  field_mul(s[2], m[2][2], s[2]);
+  fe_mul(s[0], m[0][0], s[0]);
+  fe_release(mark);
 }
 
-void matrix_mul_low(state s, const state m[sponge_size]) {
-  field t0;
-  field_mul(t0, m[2][2], s[2]);
-  field_mul(s[2], m[2][1], s[1]);
-  field_add(t0, s[2], t0);
-  field_mul(s[2], m[2][0], s[0]);
-  field_add(s[2], s[2], t0);
+// s[1..2] = MDS_pre s[1..2], what is left of the matrices of the partial
+// rounds once they are sparse, applied before the first of them
+void matrix_mul_pre(sponge s) {
+  unsigned int mark = fe_mark();
+  fe m = fe_new(), t0 = fe_new(), t1 = fe_new();
+  fe_load(m, MDS_pre[0][0]);
+  fe_mul(t0, m, s[1]);
+  fe_load(m, MDS_pre[0][1]);
+  fe_mul(t1, m, s[2]);
+  fe_add(t0, t0, t1);
+
+  fe_load(m, MDS_pre[1][0]);
+  fe_mul(t1, m, s[1]);
+  fe_load(m, MDS_pre[1][1]);
+  fe_mul(s[2], m, s[2]);
+  fe_add(s[2], s[2], t1);
+  fe_copy(s[1], t0);
+  fe_release(mark);
+}
 
-  field_mul(s[1], m[1][1], s[1]);
-  field_mul(t0, m[1][0], s[0]);
-  field_add(s[1], s[1], t0);
+// s = [[m0, m1, m2], [m3, 1, 0], [m4, 0, 1]] s, 5 multiplications instead of
+// the 12 of the dense product
+void matrix_mul_sparse(sponge s, const fe_packed m[2 * sponge_size - 1]) {
+  unsigned int mark = fe_mark();
+  fe c = fe_new(), t0 = fe_new(), t1 = fe_new();
+  fe_load(c, m[0]);
+  fe_mul(t0, c, s[0]);
+  fe_load(c, m[1]);
+  fe_mul(t1, c, s[1]);
+  fe_add(t0, t0, t1);
+  fe_load(c, m[2]);
+  fe_mul(t1, c, s[2]);
+  fe_add(t0, t0, t1);     // m0 s0 + m1 s1 + m2 s2
 
-  field_mul(s[0], m[0][0], s[0]);
+  fe_load(c, m[3]);
+  fe_mul(t1, c, s[0]);
+  fe_add(s[1], s[1], t1); // m3 s0 + s1
+  fe_load(c, m[4]);
+  fe_mul(t1, c, s[0]);
+  fe_add(s[2], s[2], t1); // m4 s0 + s2
+  fe_copy(s[0], t0);
+  fe_release(mark);
 }
 
+// x^17 = (((x^2)^2)^2)^2 x, 5 multiplications where fe_pow over the byte 0x11
+// spends 8 squarings and 2 multiplications, plus the setup of a generic
+// exponentiation
+void to_the_alpha(fe xa, const fe x) {
+  unsigned int mark = fe_mark();
+  fe t = fe_new();
+  fe_sq(t, x);       // x^2
+  fe_sq(t, t);       // x^4
+  fe_sq(t, t);       // x^8
+  fe_sq(t, t);       // x^16
+  fe_mul(xa, t, x);  // x^17
+  fe_release(mark);
+}
 
-// only needs len_e = 1
-void to_the_alpha(field xa, const field x) { field_pow(xa, x, &alpha); }
+void poseidon(sponge s) {
+  unsigned int mark = fe_mark();
+  // only the triangle each product reads is loaded
+  fe u[sponge_size][sponge_size], l[sponge_size][sponge_size];
+  for (unsigned int i = 0; i < sponge_size; i++) {
+    for (unsigned int j = 0; j < sponge_size; j++) {
+      if (j >= i) {
+        u[i][j] = fe_new();
+        fe_load(u[i][j], MDS_U[i][j]);
+      }
+      if (j <= i) {
+        l[i][j] = fe_new();
+        fe_load(l[i][j], MDS_L[i][j]);
+      }
+    }
+  }
+  fe rk = fe_new();
 
-void poseidon(state s) {
   unsigned int half_rounds = full_rounds/2;
   // half of the full rounds
   for (unsigned int r = 0; r < half_rounds; r++) {
     for (unsigned int i = 0; i < sponge_size; i++) {
-      field_add(s[i], s[i], round_keys[r][i]);
+      fe_load(rk, full_round_keys[r][i]);
+      fe_add(s[i], s[i], rk);
       to_the_alpha(s[i], s[i]);
     }
-    matrix_mul_up(s, MDS_U_MNT);
-    matrix_mul_low(s, MDS_L_MNT);
+    matrix_mul_up(s, u);
+    matrix_mul_low(s, l);
   }
 
-  // all partial rounds
-  unsigned int k = half_rounds;
-  for (unsigned int r = k; r < k + partial_rounds; r++) {
-    for (unsigned int i = 0; i < sponge_size; i++) {
-      field_add(s[i], s[i], round_keys[r][i]);
-    }
+  // all partial rounds, the keys of s[1] and s[2] are folded into the
+  // following rounds and the matrices are sparse
+  matrix_mul_pre(s);
+  for (unsigned int r = 0; r < partial_rounds; r++) {
+    fe_load(rk, partial_round_keys[r]);
+    fe_add(s[0], s[0], rk);
     to_the_alpha(s[0], s[0]);
-    matrix_mul_up(s, MDS_U_MNT);
-    matrix_mul_low(s, MDS_L_MNT);
+    matrix_mul_sparse(s, MDS_sparse[r]);
   }
 
   // other half of the full rounds
-  k = half_rounds + partial_rounds;
-  for (unsigned int r = k; r < k + half_rounds; r++) {
+  for (unsigned int r = half_rounds; r < full_rounds; r++) {
     for (unsigned int i = 0; i < sponge_size; i++) {
-      field_add(s[i], s[i], round_keys[r][i]);
+      fe_load(rk, full_round_keys[r][i]);
+      fe_add(s[i], s[i], rk);
       to_the_alpha(s[i], s[i]);
     }
-    matrix_mul_up(s, MDS_U_MNT);
-    matrix_mul_low(s, MDS_L_MNT);
+    matrix_mul_up(s, u);
+    matrix_mul_low(s, l);
+  }
+  fe_release(mark);
+}
+
+static void load_state(sponge s, const state st) {
+  for (unsigned int i = 0; i < sponge_size; i++) {
+    s[i] = fe_new();
+    fe_load(s[i], st[i]);
+  }
+}
+
+static void store_state(state st, const sponge s) {
+  for (unsigned int i = 0; i < sponge_size; i++) {
+    fe_store(st[i], s[i]);
+  }
+}
+
+// adds x into the next free rate element of the resident state s, the
+// permutation runs as soon as the rate is full
+static void absorb(poseidon_sponge *sp, sponge s, const fe x) {
+  fe_add(s[sp->pending], s[sp->pending], x);
+  sp->squeezed = 0;
+  if (++sp->pending == sponge_rate) {
+    poseidon(s);
+    sp->pending = 0;
+  }
+}
+
+void poseidon_init(poseidon_sponge *sp, const state s) {
+  os_memcpy(sp->s, s, sizeof(state));
+  sp->pending = 0;
+  sp->squeezed = 0;
+}
+
+void poseidon_absorb(poseidon_sponge *sp, const scalar in) {
+  poseidon_absorb_many(sp, (const scalar *)in, 1);
+}
+
+void poseidon_absorb_many(poseidon_sponge *sp, const scalar *in,
+                          unsigned int n) {
+  fe_begin();
+  unsigned int mark = fe_mark();
+  sponge s;
+  load_state(s, sp->s);
+  fe t = fe_new();
+  for (unsigned int i = 0; i < n; i++) {
+    fe_from_bytes(t, in[i]);
+    absorb(sp, s, t);
   }
+  store_state(sp->s, s);
+  fe_release(mark);
+  fe_end();
 }
 
+// in is cut into sponge_chunk byte big-endian integers, the last one holding
+// what is left. the length is not absorbed, callers hashing data of varying
+// length absorb it themselves
+void poseidon_absorb_bytes(poseidon_sponge *sp, const unsigned char *in,
+                           unsigned int len) {
+  fe_begin();
+  unsigned int mark = fe_mark();
+  sponge s;
+  load_state(s, sp->s);
+  fe t = fe_new();
+  scalar chunk;
+  while (len > 0) {
+    unsigned int n = len < sponge_chunk ? len : sponge_chunk;
+    os_memset(chunk, 0, scalar_bytes);
+    os_memcpy(chunk + scalar_bytes - n, in, n);
+    fe_from_bytes(t, chunk);
+    absorb(sp, s, t);
+    in += n;
+    len -= n;
+  }
+  store_state(sp->s, s);
+  fe_release(mark);
+  fe_end();
+}
+
+// a pending partial block is permuted before the output is read, as is the
+// state of a repeated squeeze
+void poseidon_squeeze(poseidon_sponge *sp, scalar out) {
+  fe_begin();
+  unsigned int mark = fe_mark();
+  sponge s;
+  load_state(s, sp->s);
+  if (sp->pending != 0 || sp->squeezed) {
+    poseidon(s);
+    sp->pending = 0;
+    store_state(sp->s, s);
+  }
+  sp->squeezed = 1;
+  fe_to_bytes(out, s[0]);
+  fe_release(mark);
+  fe_end();
+}
+
+// inputs and the digest are canonical bytes, the state stays packed in the
+// internal form between calls
 void poseidon_1in(state s, const scalar input) {
-  field_add(s[0], s[0], input);
-  poseidon(s);
+  poseidon_sponge sp;
+  poseidon_init(&sp, s);
+  poseidon_absorb(&sp, input);
+  scalar out;
+  poseidon_squeeze(&sp, out);
+  os_memcpy(s, sp.s, sizeof(state));
 }
 
 void poseidon_2in(state s, const scalar input0, const scalar input1) {
-  field_add(s[0], s[0], input0);
-  field_add(s[1], s[1], input1);
-  poseidon(s);
+  poseidon_sponge sp;
+  poseidon_init(&sp, s);
+  poseidon_absorb(&sp, input0);
+  poseidon_absorb(&sp, input1);
+  os_memcpy(s, sp.s, sizeof(state));
 }
 
 void poseidon_digest(const state s, scalar out) {
-  os_memcpy(out, s[0], field_bytes);
+  fe_begin();
+  unsigned int mark = fe_mark();
+  fe t = fe_new();
+  fe_load(t, s[0]);
+  fe_to_bytes(out, t);
+  fe_release(mark);
+  fe_end();
+}
+
+// the tables as built, against the checksum gen_tables.py wrote with them
+unsigned int poseidon_tables_ok(void) {
+  return poseidon_tables_sum() == poseidon_tables_checksum;
 }
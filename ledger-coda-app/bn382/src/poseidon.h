@@ -10,17 +10,46 @@
 // elements per iteration, and offers log2(cq) bits of security.
 // here alpha = 11, m = 3, r = 1, s = 2 ?
 // we split the full rounds into two and put half before the parital ro
-// and half after. we have full rounds = 8 and partial = 30, totalling 38
+// and half after. the round counts and alpha are those of
+// codaledgercli/poseidon_params.py, defined in poseidon_tables.h
 
-#define rounds 38
-#define full_rounds 8
-#define partial_rounds 30
 #define sponge_size 3
 
-typedef scalar state[sponge_size];
+typedef fe_packed state[sponge_size]; // internal form, see field.h
 
 void poseidon_1in(state s, const scalar in);
 void poseidon_2in(state s, const scalar in0, const scalar in1);
 void poseidon_digest(const state s, scalar out);
+unsigned int poseidon_tables_ok(void);
+
+// incremental sponge with rate 2: absorbed elements are added into the state
+// and the permutation only runs once the rate is full, or on squeeze when a
+// partial block is pending. The same inputs give the same digest as the
+// poseidon_2in / poseidon_1in / poseidon_digest sequence they replace.
+#define sponge_rate 2
+// bytes packed per field element by poseidon_absorb_bytes, one less than
+// field_bytes so that every chunk is below the modulus
+#define sponge_chunk (field_bytes - 1)
+
+typedef struct {
+  state s;
+  unsigned int pending;   // elements absorbed since the last permutation
+  unsigned int squeezed;  // set by poseidon_squeeze, cleared by absorbing
+} poseidon_sponge;
+
+void poseidon_init(poseidon_sponge *sp, const state s);
+void poseidon_absorb(poseidon_sponge *sp, const scalar in);
+void poseidon_absorb_many(poseidon_sponge *sp, const scalar *in,
+                          unsigned int n);
+void poseidon_absorb_bytes(poseidon_sponge *sp, const unsigned char *in,
+                           unsigned int len);
+void poseidon_squeeze(poseidon_sponge *sp, scalar out);
+
+#if defined(CODA_HOST)
+// out[k] = digest of the len elements in[k * len ...] absorbed from init, for
+// k < n; the sponges run in lanes when the cpu has avx-512 IFMA
+void poseidon_xN(scalar *out, const state init, const scalar *in,
+                 unsigned int len, unsigned int n);
+#endif
 
 #endif /* POSEIDON */
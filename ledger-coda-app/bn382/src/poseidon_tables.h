@@ -0,0 +1,1430 @@
+// generated by gen_tables.py, do not edit
+
+#ifndef POSEIDON_TABLES
+#define POSEIDON_TABLES
+
+#include "crypto.h"
+#include "poseidon.h"
+
+// round counts and s-box of codaledgercli/poseidon_params.py
+#define full_rounds 8
+#define partial_rounds 30
+#define rounds (full_rounds + partial_rounds)
+#define poseidon_alpha 17
+
+#if sponge_size != 3
+#error "sponge_size differs from gen_tables.py"
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed full_round_keys[full_rounds][sponge_size] = {
+    {{0xf85d18fd5abd89bf, 0x085cb0335956af8b, 0xfbf9395e48b012fd,
+      0x0da113a3f7b79d32, 0x3326271978968e7d, 0x0b1d74d49aa4f402},
+     {0x230bb1abea318dda, 0x83a1a139dbbf5982, 0xe4d856bef6cce10a,
+      0x1b3ab7bcb8ecdb77, 0x64c6583e863c3c9b, 0x1e8ef22ea36639b9},
+     {0x8916d9e50472f5d2, 0x41cab6da2d6ebbb0, 0xe5fe12ff2b6a0229,
+      0x335564cef326a2e7, 0x4631c86c0685fcf7, 0x1ff8dd4d1b29750f}},
+    {{0xd242580da0a48994, 0xb67f1a6dd4b237bb, 0x19cee07a433156fa,
+      0xc1815134c6ca80bc, 0xefbdcf6f233c01e8, 0x2371642218f24e3c},
+     {0x279e2e9757717acb, 0xe1bcf6047f81e1b7, 0xac42137f4f0bcedc,
+      0xb537eadffed282fc, 0x72df64abcbcf2402, 0x10efe856a8f0683a},
+     {0x5fdf49070265637e, 0x1fa545fe9215d771, 0x2efee14b7700c043,
+      0x6549b0c393fec2c9, 0x8db229b18a786887, 0x0f88d1bcbe44095c}},
+    {{0x2227032bbbdf4432, 0x1eb6ab193d3956c7, 0x32a9be333dbac33e,
+      0x1f8cea41ee1e5a76, 0xc3bfc86a62b6ede7, 0x031e155a7a787fb1},
+     {0x62a7fa7ead78419c, 0xf1a21390e2e5e934, 0xde0b5a083e29ef08,
+      0x1db70d9e2b646a0e, 0x97a6da3799b61a71, 0x208833f7f9785b36},
+     {0xbed482f98bb97133, 0x8bc91219d1508a39, 0xb7ea6e60efb51aaf,
+      0x4925f3a6c73367f7, 0x0806a7e4ba6df435, 0x0f874d6d5cd4ff73}},
+    {{0x2976835172a2efe5, 0x031b39fe007b1ad3, 0x38a315ca95b5bf73,
+      0xbb35aec93277750e, 0x6e6cf352b956a376, 0x0fd690fc306fa1c5},
+     {0x44731ffb30850e96, 0xc766b0326673b69d, 0x6e23414b40e3f145,
+      0x793c6491b9fe91d7, 0x5b00162137320a10, 0x1bad43c2a845222e},
+     {0x92a294eabb9ff94d, 0xa2f4d0405db11c95, 0xb2f2413b8154c854,
+      0xfc77e378a30cf687, 0xf455a732efe19bf9, 0x07223d1c4f03b04f}},
+    {{0xc055c9d714a788ea, 0x039092433f007e77, 0x59077777a79b4dad,
+      0xce0e4ac7357041b5, 0x4304fbf3428ec5ff, 0x10ab9a73974d111a},
+     {0x313597e222bdab7a, 0x7a3085dfab9b032c, 0xd290f47de4b50ea2,
+      0x0516911b1995de8e, 0xdae2390c7c23a55a, 0x15acbeedda1f3ed6},
+     {0x790505397c138c1e, 0x5102e58fe63c8dbf, 0x6757833569fdcae7,
+      0x0976948da85ce6ad, 0xba28f6d77e526e00, 0x017e6f8cf326d8e3}},
+    {{0x44d759bd2cd72ce5, 0x070b6dffe6802da8, 0xbc52fb33ae1ecd8f,
+      0x7472ede12e618d2c, 0xbfca8134f6d7e0d9, 0x1aca305ef1f914a8},
+     {0x1e629e0e9076f01e, 0x79c3ad6809914c42, 0x1ee483276e0f866a,
+      0xdb6b072b032733c1, 0x6e1c5319f630b40d, 0x1d489354ce7008dc},
+     {0x7ea020e5ca2d4552, 0x535f41a340d98224, 0xcc36a085cec884ce,
+      0xc4b656775e6337ad, 0xa01a533e4015f90a, 0x09c66930fb613431}},
+    {{0x29dbe1916659b2d1, 0xa444af61b89aed5c, 0xc2006f28225e87f6,
+      0xcec9714ff5b16cf4, 0x5344d9e8a8075bbf, 0x0013d66d31a87010},
+     {0x7a11ee015d4c2e6c, 0xb18eef17e2297b96, 0xeae4b0e17233dde6,
+      0x9b5af81592f12ce8, 0x3e3fdd2bb793b5a0, 0x063d7d40065a0ed1},
+     {0x8cf38c75a3b7fcde, 0x0ae54d0146d7420e, 0x3c2f1831c959637d,
+      0xb9036f2f8f2e9e31, 0xbbcc52213a02fa0d, 0x0323aa795f0c1bc7}},
+    {{0x44870ce05c0df48a, 0xb38ca5da3f8abbf3, 0x16153525f8c4a015,
+      0xfddcce5dd1b35989, 0x9453e283cb0d50e1, 0x0e2682d23b1897d5},
+     {0xa1c6b41229cba7ee, 0x8e3934bfc86943c2, 0xc7001a043499e734,
+      0x889fe41c283a5d30, 0x160bba05380e2e00, 0x2190fbf80c96796f},
+     {0x94c48a1fa95e99b6, 0xf63a2ceb99840742, 0x919d96a707d59eee,
+      0x040527fcbc4b44e8, 0x189d3a28472937dc, 0x00567f51d81fd204}}};
+#else
+static const fe_packed full_round_keys[full_rounds][sponge_size] = {
+    {{0x0b, 0x1d, 0x74, 0xd4, 0x9a, 0xa4, 0xf4, 0x02, 0x33, 0x26, 0x27, 0x19,
+      0x78, 0x96, 0x8e, 0x7d, 0x0d, 0xa1, 0x13, 0xa3, 0xf7, 0xb7, 0x9d, 0x32,
+      0xfb, 0xf9, 0x39, 0x5e, 0x48, 0xb0, 0x12, 0xfd, 0x08, 0x5c, 0xb0, 0x33,
+      0x59, 0x56, 0xaf, 0x8b, 0xf8, 0x5d, 0x18, 0xfd, 0x5a, 0xbd, 0x89, 0xbf},
+     {0x1e, 0x8e, 0xf2, 0x2e, 0xa3, 0x66, 0x39, 0xb9, 0x64, 0xc6, 0x58, 0x3e,
+      0x86, 0x3c, 0x3c, 0x9b, 0x1b, 0x3a, 0xb7, 0xbc, 0xb8, 0xec, 0xdb, 0x77,
+      0xe4, 0xd8, 0x56, 0xbe, 0xf6, 0xcc, 0xe1, 0x0a, 0x83, 0xa1, 0xa1, 0x39,
+      0xdb, 0xbf, 0x59, 0x82, 0x23, 0x0b, 0xb1, 0xab, 0xea, 0x31, 0x8d, 0xda},
+     {0x1f, 0xf8, 0xdd, 0x4d, 0x1b, 0x29, 0x75, 0x0f, 0x46, 0x31, 0xc8, 0x6c,
+      0x06, 0x85, 0xfc, 0xf7, 0x33, 0x55, 0x64, 0xce, 0xf3, 0x26, 0xa2, 0xe7,
+      0xe5, 0xfe, 0x12, 0xff, 0x2b, 0x6a, 0x02, 0x29, 0x41, 0xca, 0xb6, 0xda,
+      0x2d, 0x6e, 0xbb, 0xb0, 0x89, 0x16, 0xd9, 0xe5, 0x04, 0x72, 0xf5, 0xd2}},
+    {{0x23, 0x71, 0x64, 0x22, 0x18, 0xf2, 0x4e, 0x3c, 0xef, 0xbd, 0xcf, 0x6f,
+      0x23, 0x3c, 0x01, 0xe8, 0xc1, 0x81, 0x51, 0x34, 0xc6, 0xca, 0x80, 0xbc,
+      0x19, 0xce, 0xe0, 0x7a, 0x43, 0x31, 0x56, 0xfa, 0xb6, 0x7f, 0x1a, 0x6d,
+      0xd4, 0xb2, 0x37, 0xbb, 0xd2, 0x42, 0x58, 0x0d, 0xa0, 0xa4, 0x89, 0x94},
+     {0x10, 0xef, 0xe8, 0x56, 0xa8, 0xf0, 0x68, 0x3a, 0x72, 0xdf, 0x64, 0xab,
+      0xcb, 0xcf, 0x24, 0x02, 0xb5, 0x37, 0xea, 0xdf, 0xfe, 0xd2, 0x82, 0xfc,
+      0xac, 0x42, 0x13, 0x7f, 0x4f, 0x0b, 0xce, 0xdc, 0xe1, 0xbc, 0xf6, 0x04,
+      0x7f, 0x81, 0xe1, 0xb7, 0x27, 0x9e, 0x2e, 0x97, 0x57, 0x71, 0x7a, 0xcb},
+     {0x0f, 0x88, 0xd1, 0xbc, 0xbe, 0x44, 0x09, 0x5c, 0x8d, 0xb2, 0x29, 0xb1,
+      0x8a, 0x78, 0x68, 0x87, 0x65, 0x49, 0xb0, 0xc3, 0x93, 0xfe, 0xc2, 0xc9,
+      0x2e, 0xfe, 0xe1, 0x4b, 0x77, 0x00, 0xc0, 0x43, 0x1f, 0xa5, 0x45, 0xfe,
+      0x92, 0x15, 0xd7, 0x71, 0x5f, 0xdf, 0x49, 0x07, 0x02, 0x65, 0x63, 0x7e}},
+    {{0x03, 0x1e, 0x15, 0x5a, 0x7a, 0x78, 0x7f, 0xb1, 0xc3, 0xbf, 0xc8, 0x6a,
+      0x62, 0xb6, 0xed, 0xe7, 0x1f, 0x8c, 0xea, 0x41, 0xee, 0x1e, 0x5a, 0x76,
+      0x32, 0xa9, 0xbe, 0x33, 0x3d, 0xba, 0xc3, 0x3e, 0x1e, 0xb6, 0xab, 0x19,
+      0x3d, 0x39, 0x56, 0xc7, 0x22, 0x27, 0x03, 0x2b, 0xbb, 0xdf, 0x44, 0x32},
+     {0x20, 0x88, 0x33, 0xf7, 0xf9, 0x78, 0x5b, 0x36, 0x97, 0xa6, 0xda, 0x37,
+      0x99, 0xb6, 0x1a, 0x71, 0x1d, 0xb7, 0x0d, 0x9e, 0x2b, 0x64, 0x6a, 0x0e,
+      0xde, 0x0b, 0x5a, 0x08, 0x3e, 0x29, 0xef, 0x08, 0xf1, 0xa2, 0x13, 0x90,
+      0xe2, 0xe5, 0xe9, 0x34, 0x62, 0xa7, 0xfa, 0x7e, 0xad, 0x78, 0x41, 0x9c},
+     {0x0f, 0x87, 0x4d, 0x6d, 0x5c, 0xd4, 0xff, 0x73, 0x08, 0x06, 0xa7, 0xe4,
+      0xba, 0x6d, 0xf4, 0x35, 0x49, 0x25, 0xf3, 0xa6, 0xc7, 0x33, 0x67, 0xf7,
+      0xb7, 0xea, 0x6e, 0x60, 0xef, 0xb5, 0x1a, 0xaf, 0x8b, 0xc9, 0x12, 0x19,
+      0xd1, 0x50, 0x8a, 0x39, 0xbe, 0xd4, 0x82, 0xf9, 0x8b, 0xb9, 0x71, 0x33}},
+    {{0x0f, 0xd6, 0x90, 0xfc, 0x30, 0x6f, 0xa1, 0xc5, 0x6e, 0x6c, 0xf3, 0x52,
+      0xb9, 0x56, 0xa3, 0x76, 0xbb, 0x35, 0xae, 0xc9, 0x32, 0x77, 0x75, 0x0e,
+      0x38, 0xa3, 0x15, 0xca, 0x95, 0xb5, 0xbf, 0x73, 0x03, 0x1b, 0x39, 0xfe,
+      0x00, 0x7b, 0x1a, 0xd3, 0x29, 0x76, 0x83, 0x51, 0x72, 0xa2, 0xef, 0xe5},
+     {0x1b, 0xad, 0x43, 0xc2, 0xa8, 0x45, 0x22, 0x2e, 0x5b, 0x00, 0x16, 0x21,
+      0x37, 0x32, 0x0a, 0x10, 0x79, 0x3c, 0x64, 0x91, 0xb9, 0xfe, 0x91, 0xd7,
+      0x6e, 0x23, 0x41, 0x4b, 0x40, 0xe3, 0xf1, 0x45, 0xc7, 0x66, 0xb0, 0x32,
+      0x66, 0x73, 0xb6, 0x9d, 0x44, 0x73, 0x1f, 0xfb, 0x30, 0x85, 0x0e, 0x96},
+     {0x07, 0x22, 0x3d, 0x1c, 0x4f, 0x03, 0xb0, 0x4f, 0xf4, 0x55, 0xa7, 0x32,
+      0xef, 0xe1, 0x9b, 0xf9, 0xfc, 0x77, 0xe3, 0x78, 0xa3, 0x0c, 0xf6, 0x87,
+      0xb2, 0xf2, 0x41, 0x3b, 0x81, 0x54, 0xc8, 0x54, 0xa2, 0xf4, 0xd0, 0x40,
+      0x5d, 0xb1, 0x1c, 0x95, 0x92, 0xa2, 0x94, 0xea, 0xbb, 0x9f, 0xf9, 0x4d}},
+    {{0x10, 0xab, 0x9a, 0x73, 0x97, 0x4d, 0x11, 0x1a, 0x43, 0x04, 0xfb, 0xf3,
+      0x42, 0x8e, 0xc5, 0xff, 0xce, 0x0e, 0x4a, 0xc7, 0x35, 0x70, 0x41, 0xb5,
+      0x59, 0x07, 0x77, 0x77, 0xa7, 0x9b, 0x4d, 0xad, 0x03, 0x90, 0x92, 0x43,
+      0x3f, 0x00, 0x7e, 0x77, 0xc0, 0x55, 0xc9, 0xd7, 0x14, 0xa7, 0x88, 0xea},
+     {0x15, 0xac, 0xbe, 0xed, 0xda, 0x1f, 0x3e, 0xd6, 0xda, 0xe2, 0x39, 0x0c,
+      0x7c, 0x23, 0xa5, 0x5a, 0x05, 0x16, 0x91, 0x1b, 0x19, 0x95, 0xde, 0x8e,
+      0xd2, 0x90, 0xf4, 0x7d, 0xe4, 0xb5, 0x0e, 0xa2, 0x7a, 0x30, 0x85, 0xdf,
+      0xab, 0x9b, 0x03, 0x2c, 0x31, 0x35, 0x97, 0xe2, 0x22, 0xbd, 0xab, 0x7a},
+     {0x01, 0x7e, 0x6f, 0x8c, 0xf3, 0x26, 0xd8, 0xe3, 0xba, 0x28, 0xf6, 0xd7,
+      0x7e, 0x52, 0x6e, 0x00, 0x09, 0x76, 0x94, 0x8d, 0xa8, 0x5c, 0xe6, 0xad,
+      0x67, 0x57, 0x83, 0x35, 0x69, 0xfd, 0xca, 0xe7, 0x51, 0x02, 0xe5, 0x8f,
+      0xe6, 0x3c, 0x8d, 0xbf, 0x79, 0x05, 0x05, 0x39, 0x7c, 0x13, 0x8c, 0x1e}},
+    {{0x1a, 0xca, 0x30, 0x5e, 0xf1, 0xf9, 0x14, 0xa8, 0xbf, 0xca, 0x81, 0x34,
+      0xf6, 0xd7, 0xe0, 0xd9, 0x74, 0x72, 0xed, 0xe1, 0x2e, 0x61, 0x8d, 0x2c,
+      0xbc, 0x52, 0xfb, 0x33, 0xae, 0x1e, 0xcd, 0x8f, 0x07, 0x0b, 0x6d, 0xff,
+      0xe6, 0x80, 0x2d, 0xa8, 0x44, 0xd7, 0x59, 0xbd, 0x2c, 0xd7, 0x2c, 0xe5},
+     {0x1d, 0x48, 0x93, 0x54, 0xce, 0x70, 0x08, 0xdc, 0x6e, 0x1c, 0x53, 0x19,
+      0xf6, 0x30, 0xb4, 0x0d, 0xdb, 0x6b, 0x07, 0x2b, 0x03, 0x27, 0x33, 0xc1,
+      0x1e, 0xe4, 0x83, 0x27, 0x6e, 0x0f, 0x86, 0x6a, 0x79, 0xc3, 0xad, 0x68,
+      0x09, 0x91, 0x4c, 0x42, 0x1e, 0x62, 0x9e, 0x0e, 0x90, 0x76, 0xf0, 0x1e},
+     {0x09, 0xc6, 0x69, 0x30, 0xfb, 0x61, 0x34, 0x31, 0xa0, 0x1a, 0x53, 0x3e,
+      0x40, 0x15, 0xf9, 0x0a, 0xc4, 0xb6, 0x56, 0x77, 0x5e, 0x63, 0x37, 0xad,
+      0xcc, 0x36, 0xa0, 0x85, 0xce, 0xc8, 0x84, 0xce, 0x53, 0x5f, 0x41, 0xa3,
+      0x40, 0xd9, 0x82, 0x24, 0x7e, 0xa0, 0x20, 0xe5, 0xca, 0x2d, 0x45, 0x52}},
+    {{0x00, 0x13, 0xd6, 0x6d, 0x31, 0xa8, 0x70, 0x10, 0x53, 0x44, 0xd9, 0xe8,
+      0xa8, 0x07, 0x5b, 0xbf, 0xce, 0xc9, 0x71, 0x4f, 0xf5, 0xb1, 0x6c, 0xf4,
+      0xc2, 0x00, 0x6f, 0x28, 0x22, 0x5e, 0x87, 0xf6, 0xa4, 0x44, 0xaf, 0x61,
+      0xb8, 0x9a, 0xed, 0x5c, 0x29, 0xdb, 0xe1, 0x91, 0x66, 0x59, 0xb2, 0xd1},
+     {0x06, 0x3d, 0x7d, 0x40, 0x06, 0x5a, 0x0e, 0xd1, 0x3e, 0x3f, 0xdd, 0x2b,
+      0xb7, 0x93, 0xb5, 0xa0, 0x9b, 0x5a, 0xf8, 0x15, 0x92, 0xf1, 0x2c, 0xe8,
+      0xea, 0xe4, 0xb0, 0xe1, 0x72, 0x33, 0xdd, 0xe6, 0xb1, 0x8e, 0xef, 0x17,
+      0xe2, 0x29, 0x7b, 0x96, 0x7a, 0x11, 0xee, 0x01, 0x5d, 0x4c, 0x2e, 0x6c},
+     {0x03, 0x23, 0xaa, 0x79, 0x5f, 0x0c, 0x1b, 0xc7, 0xbb, 0xcc, 0x52, 0x21,
+      0x3a, 0x02, 0xfa, 0x0d, 0xb9, 0x03, 0x6f, 0x2f, 0x8f, 0x2e, 0x9e, 0x31,
+      0x3c, 0x2f, 0x18, 0x31, 0xc9, 0x59, 0x63, 0x7d, 0x0a, 0xe5, 0x4d, 0x01,
+      0x46, 0xd7, 0x42, 0x0e, 0x8c, 0xf3, 0x8c, 0x75, 0xa3, 0xb7, 0xfc, 0xde}},
+    {{0x0e, 0x26, 0x82, 0xd2, 0x3b, 0x18, 0x97, 0xd5, 0x94, 0x53, 0xe2, 0x83,
+      0xcb, 0x0d, 0x50, 0xe1, 0xfd, 0xdc, 0xce, 0x5d, 0xd1, 0xb3, 0x59, 0x89,
+      0x16, 0x15, 0x35, 0x25, 0xf8, 0xc4, 0xa0, 0x15, 0xb3, 0x8c, 0xa5, 0xda,
+      0x3f, 0x8a, 0xbb, 0xf3, 0x44, 0x87, 0x0c, 0xe0, 0x5c, 0x0d, 0xf4, 0x8a},
+     {0x21, 0x90, 0xfb, 0xf8, 0x0c, 0x96, 0x79, 0x6f, 0x16, 0x0b, 0xba, 0x05,
+      0x38, 0x0e, 0x2e, 0x00, 0x88, 0x9f, 0xe4, 0x1c, 0x28, 0x3a, 0x5d, 0x30,
+      0xc7, 0x00, 0x1a, 0x04, 0x34, 0x99, 0xe7, 0x34, 0x8e, 0x39, 0x34, 0xbf,
+      0xc8, 0x69, 0x43, 0xc2, 0xa1, 0xc6, 0xb4, 0x12, 0x29, 0xcb, 0xa7, 0xee},
+     {0x00, 0x56, 0x7f, 0x51, 0xd8, 0x1f, 0xd2, 0x04, 0x18, 0x9d, 0x3a, 0x28,
+      0x47, 0x29, 0x37, 0xdc, 0x04, 0x05, 0x27, 0xfc, 0xbc, 0x4b, 0x44, 0xe8,
+      0x91, 0x9d, 0x96, 0xa7, 0x07, 0xd5, 0x9e, 0xee, 0xf6, 0x3a, 0x2c, 0xeb,
+      0x99, 0x84, 0x07, 0x42, 0x94, 0xc4, 0x8a, 0x1f, 0xa9, 0x5e, 0x99, 0xb6}}};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed MDS_U[sponge_size][sponge_size] = {
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a}},
+    {{0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000008, 0x0000000c0060c0c0, 0x0091236912120900,
+      0xa451b0a144d84809, 0x8a81e34d84edfc45, 0x202449fed6c43c73}},
+    {{0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0xfffffffffffffff2, 0xffffffeaff56aeaf, 0x3f0202082060703f,
+      0x20710ae5c78581f0, 0xcd9cb238575f8686, 0x07c07e8208289635}}};
+#else
+static const fe_packed MDS_U[sponge_size][sponge_size] = {
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9}},
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x20, 0x24, 0x49, 0xfe, 0xd6, 0xc4, 0x3c, 0x73, 0x8a, 0x81, 0xe3, 0x4d,
+      0x84, 0xed, 0xfc, 0x45, 0xa4, 0x51, 0xb0, 0xa1, 0x44, 0xd8, 0x48, 0x09,
+      0x00, 0x91, 0x23, 0x69, 0x12, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0c,
+      0x00, 0x60, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08}},
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x07, 0xc0, 0x7e, 0x82, 0x08, 0x28, 0x96, 0x35, 0xcd, 0x9c, 0xb2, 0x38,
+      0x57, 0x5f, 0x86, 0x86, 0x20, 0x71, 0x0a, 0xe5, 0xc7, 0x85, 0x81, 0xf0,
+      0x3f, 0x02, 0x02, 0x08, 0x20, 0x60, 0x70, 0x3f, 0xff, 0xff, 0xff, 0xea,
+      0xff, 0x56, 0xae, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2}}};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed MDS_L[sponge_size][sponge_size] = {
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+    {{0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a}}};
+#else
+static const fe_packed MDS_L[sponge_size][sponge_size] = {
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9}}};
+#endif
+
+// partial rounds, see partial_rounds_opt
+#if defined(CODA_HOST)
+static const fe_packed partial_round_keys[partial_rounds] = {
+    {0xd3e813feb3b47778, 0x115bcc0523580f73, 0x539320685240567a,
+     0x0f785e3c31f878e3, 0xf175746a2775b367, 0x0383d845065a7953},
+    {0xbc358434e73a2af1, 0xfd5bc0509300260a, 0xc25fe335b5255723,
+     0xb9e20ac1a4e6976f, 0x60430bc58e180a54, 0x13be79adceaa8aa9},
+    {0xae8cc23cde44cfa4, 0x11dcf73b96ebfe68, 0xcab23dfc7a950d51,
+     0x9404f254d2da345d, 0x37138525020faac2, 0x16b3c55e130fb53b},
+    {0x369c64d30894d184, 0x26e1c88c715fb7c6, 0x4fa92d74f24513df,
+     0xb08c52e6235a1ec0, 0x32593ac4452eb0fe, 0x06e45854e8e4f66f},
+    {0x2049b47ae8fc6558, 0x284cae99f147bb32, 0x60dadac1b7108692,
+     0x012dd955fa3403cd, 0x540963d2b4b28ec7, 0x12ccc6d00488352f},
+    {0x92af3060d8acefcc, 0x11c0177a06ecb9b1, 0xe98119dc8084a12b,
+     0xbb674c47bcb5da89, 0x127d3e94c2b973ac, 0x200819a680bb65aa},
+    {0x80b36d50ea0bd568, 0x000996da218ab57e, 0x3c727b33e4aa8b16,
+     0xa5f7fcb089755486, 0x65f639a6da4f16e8, 0x0b0dd098096dc749},
+    {0x4b16e9f697830380, 0x402c72f67934ffa6, 0xcb5930abab1fcd51,
+     0x15b1577045726adb, 0xce87c1b2daf4c749, 0x10db2d56cfa4299a},
+    {0x503be9f162bdf4ad, 0xfc364174e4297dea, 0x7d17ca726850af1e,
+     0xda4966920189f8b2, 0xa8df15f6e0d3d14e, 0x0feee9dd32374264},
+    {0x7a213d096016f725, 0x6d552a5885e792a9, 0xdcb589ac92215cef,
+     0xbbbc39c7d72c8d5f, 0x1e6552823769a6ad, 0x20c9be03c9672e2c},
+    {0x19ed16048df3464c, 0x666d74db97f3b2f6, 0xa64b7eba7f084cff,
+     0x1c9a953ae363c968, 0xb73e8df6124b7644, 0x081f8c8fbd172d46},
+    {0xe8303f4ff3aeaeee, 0x042371bf7aef64af, 0x234157a121c01ced,
+     0x622c2b6e76717522, 0xddf937f26cf959a3, 0x1d56986f743bb2fb},
+    {0x3faaa4ddf92da858, 0x90518dd78ddd163f, 0x2b482a685b39222a,
+     0xb325b69cb22d3ae8, 0x8fa0e15e157c9167, 0x1d68f1b5b6e24b3a},
+    {0xfba39e2edf6c2d36, 0xd96fd95c27647b2d, 0xf9a5487cf0b5cd7b,
+     0x7873b680933748d9, 0xc1136aa732205649, 0x1efc87f77427c32c},
+    {0x99fd1dabacf9a050, 0x857f78170049bb94, 0x3570a0fa38e68bfe,
+     0xe7221a74ec59a7e9, 0x8970f830bde7a562, 0x06f0403b3f0da803},
+    {0xc827f28d1f1822de, 0x40c7dead928c957c, 0x6037e4dd55c146a1,
+     0x95dd0a13e72f8c45, 0x0ad018c6fd62107a, 0x0984dc70b8c318cc},
+    {0x99fe006708b26dfa, 0xe1e34743d1bb842a, 0x7e7fc0bd2d52a7a7,
+     0xbda59641f2cbeea0, 0x378b6b10300c31c2, 0x13b78d14f2539fa5},
+    {0x30850bacbe2c0fb4, 0x0ccafb990a15a4dc, 0x5b8fd2eb6f805e60,
+     0x47aecf0789a7bf78, 0xb234a339f5cd8f38, 0x0c277eb92c9bb20e},
+    {0xd84431b98d77695c, 0x2665dc41c739863b, 0xcb59c9560b03c42d,
+     0x2cafbc048cb27786, 0xc807c39149fc9fb0, 0x05e9b477983f3268},
+    {0x20ce6e39cb73d283, 0x696c74eced932bb1, 0x70c40fe496e452b4,
+     0x515a26b264f90e0d, 0xf38906cc8464684d, 0x16643ce1faca97f1},
+    {0x3d2e1ae2927bf19b, 0xf8e0060db800d3d2, 0xbf3443a301186db2,
+     0x7a1c8bb41dc879d2, 0x25c7e7c009f9543d, 0x0889eb138101d5d6},
+    {0xbf23e98839452337, 0x91ea067566bdb82e, 0xc79b7b8b7b915bf8,
+     0xf3fa72f5d1ad7998, 0x200e5a0003560cf5, 0x09ec3e475858be23},
+    {0x8745fe88f8c18232, 0x342cd0998daa44f6, 0x47e57fc4f482d664,
+     0x0b32e5fa16f1ad69, 0x1814b0de5495fb10, 0x05c4029bb4f84b4d},
+    {0x6ee0b3cc8545b052, 0xacc025f72e9594c8, 0x07502983b73afb47,
+     0xbf84cb806ef5295a, 0x2632463eebf75171, 0x05b65927831f9fa9},
+    {0x2668eb6b11f604c6, 0x639ccfebbe879245, 0x13213ca8541727d1,
+     0xee5b230fcab7ab7c, 0x51afd74c1e6ca708, 0x17e511501ccbddc6},
+    {0x01b4726d61f065b9, 0x2c97f798cdf515f2, 0x30fa14481ed3f623,
+     0xc05d198e228ccc8e, 0x9567ae0cdc2501af, 0x087b774b803fce4a},
+    {0xafc8ca56ab721463, 0xe43a5c258026fd42, 0xf72507f10f420368,
+     0x89f5f80f0a820923, 0x1cf624ec5c9d1c26, 0x05b50d082267723c},
+    {0x5447b7633f576683, 0xbfed119566800d48, 0x4dfe9f305b7cf55b,
+     0x4c645e0e9b740c41, 0xc9697760037cb75d, 0x20c95eaf3a9b01d4},
+    {0xaf5047bb1f7d0882, 0xb99b9ef45374d143, 0x25c177889a721cda,
+     0xa3340aaa674968b4, 0x17363847fa245def, 0x01bc75b5cf2d5135},
+    {0xe9d243a17bd0371a, 0xcd91c5b27d73b3ce, 0x20a96a957b6cfc44,
+     0x709874b6a4eb826b, 0xd087cddc71892c0d, 0x1a78226bf690f17f}};
+#else
+static const fe_packed partial_round_keys[partial_rounds] = {
+    {0x03, 0x83, 0xd8, 0x45, 0x06, 0x5a, 0x79, 0x53, 0xf1, 0x75, 0x74, 0x6a,
+     0x27, 0x75, 0xb3, 0x67, 0x0f, 0x78, 0x5e, 0x3c, 0x31, 0xf8, 0x78, 0xe3,
+     0x53, 0x93, 0x20, 0x68, 0x52, 0x40, 0x56, 0x7a, 0x11, 0x5b, 0xcc, 0x05,
+     0x23, 0x58, 0x0f, 0x73, 0xd3, 0xe8, 0x13, 0xfe, 0xb3, 0xb4, 0x77, 0x78},
+    {0x13, 0xbe, 0x79, 0xad, 0xce, 0xaa, 0x8a, 0xa9, 0x60, 0x43, 0x0b, 0xc5,
+     0x8e, 0x18, 0x0a, 0x54, 0xb9, 0xe2, 0x0a, 0xc1, 0xa4, 0xe6, 0x97, 0x6f,
+     0xc2, 0x5f, 0xe3, 0x35, 0xb5, 0x25, 0x57, 0x23, 0xfd, 0x5b, 0xc0, 0x50,
+     0x93, 0x00, 0x26, 0x0a, 0xbc, 0x35, 0x84, 0x34, 0xe7, 0x3a, 0x2a, 0xf1},
+    {0x16, 0xb3, 0xc5, 0x5e, 0x13, 0x0f, 0xb5, 0x3b, 0x37, 0x13, 0x85, 0x25,
+     0x02, 0x0f, 0xaa, 0xc2, 0x94, 0x04, 0xf2, 0x54, 0xd2, 0xda, 0x34, 0x5d,
+     0xca, 0xb2, 0x3d, 0xfc, 0x7a, 0x95, 0x0d, 0x51, 0x11, 0xdc, 0xf7, 0x3b,
+     0x96, 0xeb, 0xfe, 0x68, 0xae, 0x8c, 0xc2, 0x3c, 0xde, 0x44, 0xcf, 0xa4},
+    {0x06, 0xe4, 0x58, 0x54, 0xe8, 0xe4, 0xf6, 0x6f, 0x32, 0x59, 0x3a, 0xc4,
+     0x45, 0x2e, 0xb0, 0xfe, 0xb0, 0x8c, 0x52, 0xe6, 0x23, 0x5a, 0x1e, 0xc0,
+     0x4f, 0xa9, 0x2d, 0x74, 0xf2, 0x45, 0x13, 0xdf, 0x26, 0xe1, 0xc8, 0x8c,
+     0x71, 0x5f, 0xb7, 0xc6, 0x36, 0x9c, 0x64, 0xd3, 0x08, 0x94, 0xd1, 0x84},
+    {0x12, 0xcc, 0xc6, 0xd0, 0x04, 0x88, 0x35, 0x2f, 0x54, 0x09, 0x63, 0xd2,
+     0xb4, 0xb2, 0x8e, 0xc7, 0x01, 0x2d, 0xd9, 0x55, 0xfa, 0x34, 0x03, 0xcd,
+     0x60, 0xda, 0xda, 0xc1, 0xb7, 0x10, 0x86, 0x92, 0x28, 0x4c, 0xae, 0x99,
+     0xf1, 0x47, 0xbb, 0x32, 0x20, 0x49, 0xb4, 0x7a, 0xe8, 0xfc, 0x65, 0x58},
+    {0x20, 0x08, 0x19, 0xa6, 0x80, 0xbb, 0x65, 0xaa, 0x12, 0x7d, 0x3e, 0x94,
+     0xc2, 0xb9, 0x73, 0xac, 0xbb, 0x67, 0x4c, 0x47, 0xbc, 0xb5, 0xda, 0x89,
+     0xe9, 0x81, 0x19, 0xdc, 0x80, 0x84, 0xa1, 0x2b, 0x11, 0xc0, 0x17, 0x7a,
+     0x06, 0xec, 0xb9, 0xb1, 0x92, 0xaf, 0x30, 0x60, 0xd8, 0xac, 0xef, 0xcc},
+    {0x0b, 0x0d, 0xd0, 0x98, 0x09, 0x6d, 0xc7, 0x49, 0x65, 0xf6, 0x39, 0xa6,
+     0xda, 0x4f, 0x16, 0xe8, 0xa5, 0xf7, 0xfc, 0xb0, 0x89, 0x75, 0x54, 0x86,
+     0x3c, 0x72, 0x7b, 0x33, 0xe4, 0xaa, 0x8b, 0x16, 0x00, 0x09, 0x96, 0xda,
+     0x21, 0x8a, 0xb5, 0x7e, 0x80, 0xb3, 0x6d, 0x50, 0xea, 0x0b, 0xd5, 0x68},
+    {0x10, 0xdb, 0x2d, 0x56, 0xcf, 0xa4, 0x29, 0x9a, 0xce, 0x87, 0xc1, 0xb2,
+     0xda, 0xf4, 0xc7, 0x49, 0x15, 0xb1, 0x57, 0x70, 0x45, 0x72, 0x6a, 0xdb,
+     0xcb, 0x59, 0x30, 0xab, 0xab, 0x1f, 0xcd, 0x51, 0x40, 0x2c, 0x72, 0xf6,
+     0x79, 0x34, 0xff, 0xa6, 0x4b, 0x16, 0xe9, 0xf6, 0x97, 0x83, 0x03, 0x80},
+    {0x0f, 0xee, 0xe9, 0xdd, 0x32, 0x37, 0x42, 0x64, 0xa8, 0xdf, 0x15, 0xf6,
+     0xe0, 0xd3, 0xd1, 0x4e, 0xda, 0x49, 0x66, 0x92, 0x01, 0x89, 0xf8, 0xb2,
+     0x7d, 0x17, 0xca, 0x72, 0x68, 0x50, 0xaf, 0x1e, 0xfc, 0x36, 0x41, 0x74,
+     0xe4, 0x29, 0x7d, 0xea, 0x50, 0x3b, 0xe9, 0xf1, 0x62, 0xbd, 0xf4, 0xad},
+    {0x20, 0xc9, 0xbe, 0x03, 0xc9, 0x67, 0x2e, 0x2c, 0x1e, 0x65, 0x52, 0x82,
+     0x37, 0x69, 0xa6, 0xad, 0xbb, 0xbc, 0x39, 0xc7, 0xd7, 0x2c, 0x8d, 0x5f,
+     0xdc, 0xb5, 0x89, 0xac, 0x92, 0x21, 0x5c, 0xef, 0x6d, 0x55, 0x2a, 0x58,
+     0x85, 0xe7, 0x92, 0xa9, 0x7a, 0x21, 0x3d, 0x09, 0x60, 0x16, 0xf7, 0x25},
+    {0x08, 0x1f, 0x8c, 0x8f, 0xbd, 0x17, 0x2d, 0x46, 0xb7, 0x3e, 0x8d, 0xf6,
+     0x12, 0x4b, 0x76, 0x44, 0x1c, 0x9a, 0x95, 0x3a, 0xe3, 0x63, 0xc9, 0x68,
+     0xa6, 0x4b, 0x7e, 0xba, 0x7f, 0x08, 0x4c, 0xff, 0x66, 0x6d, 0x74, 0xdb,
+     0x97, 0xf3, 0xb2, 0xf6, 0x19, 0xed, 0x16, 0x04, 0x8d, 0xf3, 0x46, 0x4c},
+    {0x1d, 0x56, 0x98, 0x6f, 0x74, 0x3b, 0xb2, 0xfb, 0xdd, 0xf9, 0x37, 0xf2,
+     0x6c, 0xf9, 0x59, 0xa3, 0x62, 0x2c, 0x2b, 0x6e, 0x76, 0x71, 0x75, 0x22,
+     0x23, 0x41, 0x57, 0xa1, 0x21, 0xc0, 0x1c, 0xed, 0x04, 0x23, 0x71, 0xbf,
+     0x7a, 0xef, 0x64, 0xaf, 0xe8, 0x30, 0x3f, 0x4f, 0xf3, 0xae, 0xae, 0xee},
+    {0x1d, 0x68, 0xf1, 0xb5, 0xb6, 0xe2, 0x4b, 0x3a, 0x8f, 0xa0, 0xe1, 0x5e,
+     0x15, 0x7c, 0x91, 0x67, 0xb3, 0x25, 0xb6, 0x9c, 0xb2, 0x2d, 0x3a, 0xe8,
+     0x2b, 0x48, 0x2a, 0x68, 0x5b, 0x39, 0x22, 0x2a, 0x90, 0x51, 0x8d, 0xd7,
+     0x8d, 0xdd, 0x16, 0x3f, 0x3f, 0xaa, 0xa4, 0xdd, 0xf9, 0x2d, 0xa8, 0x58},
+    {0x1e, 0xfc, 0x87, 0xf7, 0x74, 0x27, 0xc3, 0x2c, 0xc1, 0x13, 0x6a, 0xa7,
+     0x32, 0x20, 0x56, 0x49, 0x78, 0x73, 0xb6, 0x80, 0x93, 0x37, 0x48, 0xd9,
+     0xf9, 0xa5, 0x48, 0x7c, 0xf0, 0xb5, 0xcd, 0x7b, 0xd9, 0x6f, 0xd9, 0x5c,
+     0x27, 0x64, 0x7b, 0x2d, 0xfb, 0xa3, 0x9e, 0x2e, 0xdf, 0x6c, 0x2d, 0x36},
+    {0x06, 0xf0, 0x40, 0x3b, 0x3f, 0x0d, 0xa8, 0x03, 0x89, 0x70, 0xf8, 0x30,
+     0xbd, 0xe7, 0xa5, 0x62, 0xe7, 0x22, 0x1a, 0x74, 0xec, 0x59, 0xa7, 0xe9,
+     0x35, 0x70, 0xa0, 0xfa, 0x38, 0xe6, 0x8b, 0xfe, 0x85, 0x7f, 0x78, 0x17,
+     0x00, 0x49, 0xbb, 0x94, 0x99, 0xfd, 0x1d, 0xab, 0xac, 0xf9, 0xa0, 0x50},
+    {0x09, 0x84, 0xdc, 0x70, 0xb8, 0xc3, 0x18, 0xcc, 0x0a, 0xd0, 0x18, 0xc6,
+     0xfd, 0x62, 0x10, 0x7a, 0x95, 0xdd, 0x0a, 0x13, 0xe7, 0x2f, 0x8c, 0x45,
+     0x60, 0x37, 0xe4, 0xdd, 0x55, 0xc1, 0x46, 0xa1, 0x40, 0xc7, 0xde, 0xad,
+     0x92, 0x8c, 0x95, 0x7c, 0xc8, 0x27, 0xf2, 0x8d, 0x1f, 0x18, 0x22, 0xde},
+    {0x13, 0xb7, 0x8d, 0x14, 0xf2, 0x53, 0x9f, 0xa5, 0x37, 0x8b, 0x6b, 0x10,
+     0x30, 0x0c, 0x31, 0xc2, 0xbd, 0xa5, 0x96, 0x41, 0xf2, 0xcb, 0xee, 0xa0,
+     0x7e, 0x7f, 0xc0, 0xbd, 0x2d, 0x52, 0xa7, 0xa7, 0xe1, 0xe3, 0x47, 0x43,
+     0xd1, 0xbb, 0x84, 0x2a, 0x99, 0xfe, 0x00, 0x67, 0x08, 0xb2, 0x6d, 0xfa},
+    {0x0c, 0x27, 0x7e, 0xb9, 0x2c, 0x9b, 0xb2, 0x0e, 0xb2, 0x34, 0xa3, 0x39,
+     0xf5, 0xcd, 0x8f, 0x38, 0x47, 0xae, 0xcf, 0x07, 0x89, 0xa7, 0xbf, 0x78,
+     0x5b, 0x8f, 0xd2, 0xeb, 0x6f, 0x80, 0x5e, 0x60, 0x0c, 0xca, 0xfb, 0x99,
+     0x0a, 0x15, 0xa4, 0xdc, 0x30, 0x85, 0x0b, 0xac, 0xbe, 0x2c, 0x0f, 0xb4},
+    {0x05, 0xe9, 0xb4, 0x77, 0x98, 0x3f, 0x32, 0x68, 0xc8, 0x07, 0xc3, 0x91,
+     0x49, 0xfc, 0x9f, 0xb0, 0x2c, 0xaf, 0xbc, 0x04, 0x8c, 0xb2, 0x77, 0x86,
+     0xcb, 0x59, 0xc9, 0x56, 0x0b, 0x03, 0xc4, 0x2d, 0x26, 0x65, 0xdc, 0x41,
+     0xc7, 0x39, 0x86, 0x3b, 0xd8, 0x44, 0x31, 0xb9, 0x8d, 0x77, 0x69, 0x5c},
+    {0x16, 0x64, 0x3c, 0xe1, 0xfa, 0xca, 0x97, 0xf1, 0xf3, 0x89, 0x06, 0xcc,
+     0x84, 0x64, 0x68, 0x4d, 0x51, 0x5a, 0x26, 0xb2, 0x64, 0xf9, 0x0e, 0x0d,
+     0x70, 0xc4, 0x0f, 0xe4, 0x96, 0xe4, 0x52, 0xb4, 0x69, 0x6c, 0x74, 0xec,
+     0xed, 0x93, 0x2b, 0xb1, 0x20, 0xce, 0x6e, 0x39, 0xcb, 0x73, 0xd2, 0x83},
+    {0x08, 0x89, 0xeb, 0x13, 0x81, 0x01, 0xd5, 0xd6, 0x25, 0xc7, 0xe7, 0xc0,
+     0x09, 0xf9, 0x54, 0x3d, 0x7a, 0x1c, 0x8b, 0xb4, 0x1d, 0xc8, 0x79, 0xd2,
+     0xbf, 0x34, 0x43, 0xa3, 0x01, 0x18, 0x6d, 0xb2, 0xf8, 0xe0, 0x06, 0x0d,
+     0xb8, 0x00, 0xd3, 0xd2, 0x3d, 0x2e, 0x1a, 0xe2, 0x92, 0x7b, 0xf1, 0x9b},
+    {0x09, 0xec, 0x3e, 0x47, 0x58, 0x58, 0xbe, 0x23, 0x20, 0x0e, 0x5a, 0x00,
+     0x03, 0x56, 0x0c, 0xf5, 0xf3, 0xfa, 0x72, 0xf5, 0xd1, 0xad, 0x79, 0x98,
+     0xc7, 0x9b, 0x7b, 0x8b, 0x7b, 0x91, 0x5b, 0xf8, 0x91, 0xea, 0x06, 0x75,
+     0x66, 0xbd, 0xb8, 0x2e, 0xbf, 0x23, 0xe9, 0x88, 0x39, 0x45, 0x23, 0x37},
+    {0x05, 0xc4, 0x02, 0x9b, 0xb4, 0xf8, 0x4b, 0x4d, 0x18, 0x14, 0xb0, 0xde,
+     0x54, 0x95, 0xfb, 0x10, 0x0b, 0x32, 0xe5, 0xfa, 0x16, 0xf1, 0xad, 0x69,
+     0x47, 0xe5, 0x7f, 0xc4, 0xf4, 0x82, 0xd6, 0x64, 0x34, 0x2c, 0xd0, 0x99,
+     0x8d, 0xaa, 0x44, 0xf6, 0x87, 0x45, 0xfe, 0x88, 0xf8, 0xc1, 0x82, 0x32},
+    {0x05, 0xb6, 0x59, 0x27, 0x83, 0x1f, 0x9f, 0xa9, 0x26, 0x32, 0x46, 0x3e,
+     0xeb, 0xf7, 0x51, 0x71, 0xbf, 0x84, 0xcb, 0x80, 0x6e, 0xf5, 0x29, 0x5a,
+     0x07, 0x50, 0x29, 0x83, 0xb7, 0x3a, 0xfb, 0x47, 0xac, 0xc0, 0x25, 0xf7,
+     0x2e, 0x95, 0x94, 0xc8, 0x6e, 0xe0, 0xb3, 0xcc, 0x85, 0x45, 0xb0, 0x52},
+    {0x17, 0xe5, 0x11, 0x50, 0x1c, 0xcb, 0xdd, 0xc6, 0x51, 0xaf, 0xd7, 0x4c,
+     0x1e, 0x6c, 0xa7, 0x08, 0xee, 0x5b, 0x23, 0x0f, 0xca, 0xb7, 0xab, 0x7c,
+     0x13, 0x21, 0x3c, 0xa8, 0x54, 0x17, 0x27, 0xd1, 0x63, 0x9c, 0xcf, 0xeb,
+     0xbe, 0x87, 0x92, 0x45, 0x26, 0x68, 0xeb, 0x6b, 0x11, 0xf6, 0x04, 0xc6},
+    {0x08, 0x7b, 0x77, 0x4b, 0x80, 0x3f, 0xce, 0x4a, 0x95, 0x67, 0xae, 0x0c,
+     0xdc, 0x25, 0x01, 0xaf, 0xc0, 0x5d, 0x19, 0x8e, 0x22, 0x8c, 0xcc, 0x8e,
+     0x30, 0xfa, 0x14, 0x48, 0x1e, 0xd3, 0xf6, 0x23, 0x2c, 0x97, 0xf7, 0x98,
+     0xcd, 0xf5, 0x15, 0xf2, 0x01, 0xb4, 0x72, 0x6d, 0x61, 0xf0, 0x65, 0xb9},
+    {0x05, 0xb5, 0x0d, 0x08, 0x22, 0x67, 0x72, 0x3c, 0x1c, 0xf6, 0x24, 0xec,
+     0x5c, 0x9d, 0x1c, 0x26, 0x89, 0xf5, 0xf8, 0x0f, 0x0a, 0x82, 0x09, 0x23,
+     0xf7, 0x25, 0x07, 0xf1, 0x0f, 0x42, 0x03, 0x68, 0xe4, 0x3a, 0x5c, 0x25,
+     0x80, 0x26, 0xfd, 0x42, 0xaf, 0xc8, 0xca, 0x56, 0xab, 0x72, 0x14, 0x63},
+    {0x20, 0xc9, 0x5e, 0xaf, 0x3a, 0x9b, 0x01, 0xd4, 0xc9, 0x69, 0x77, 0x60,
+     0x03, 0x7c, 0xb7, 0x5d, 0x4c, 0x64, 0x5e, 0x0e, 0x9b, 0x74, 0x0c, 0x41,
+     0x4d, 0xfe, 0x9f, 0x30, 0x5b, 0x7c, 0xf5, 0x5b, 0xbf, 0xed, 0x11, 0x95,
+     0x66, 0x80, 0x0d, 0x48, 0x54, 0x47, 0xb7, 0x63, 0x3f, 0x57, 0x66, 0x83},
+    {0x01, 0xbc, 0x75, 0xb5, 0xcf, 0x2d, 0x51, 0x35, 0x17, 0x36, 0x38, 0x47,
+     0xfa, 0x24, 0x5d, 0xef, 0xa3, 0x34, 0x0a, 0xaa, 0x67, 0x49, 0x68, 0xb4,
+     0x25, 0xc1, 0x77, 0x88, 0x9a, 0x72, 0x1c, 0xda, 0xb9, 0x9b, 0x9e, 0xf4,
+     0x53, 0x74, 0xd1, 0x43, 0xaf, 0x50, 0x47, 0xbb, 0x1f, 0x7d, 0x08, 0x82},
+    {0x1a, 0x78, 0x22, 0x6b, 0xf6, 0x90, 0xf1, 0x7f, 0xd0, 0x87, 0xcd, 0xdc,
+     0x71, 0x89, 0x2c, 0x0d, 0x70, 0x98, 0x74, 0xb6, 0xa4, 0xeb, 0x82, 0x6b,
+     0x20, 0xa9, 0x6a, 0x95, 0x7b, 0x6c, 0xfc, 0x44, 0xcd, 0x91, 0xc5, 0xb2,
+     0x7d, 0x73, 0xb3, 0xce, 0xe9, 0xd2, 0x43, 0xa1, 0x7b, 0xd0, 0x37, 0x1a}};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed MDS_pre[sponge_size - 1][sponge_size - 1] = {
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+    {{0xffffffffffffff2b, 0xfffffec075eff407, 0x50e7b1327edfd05f,
+      0xc901013a37018210, 0xb83dbc100cbfa341, 0x0839cddee9d7367b},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a}}};
+#else
+static const fe_packed MDS_pre[sponge_size - 1][sponge_size - 1] = {
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+    {{0x08, 0x39, 0xcd, 0xde, 0xe9, 0xd7, 0x36, 0x7b, 0xb8, 0x3d, 0xbc, 0x10,
+      0x0c, 0xbf, 0xa3, 0x41, 0xc9, 0x01, 0x01, 0x3a, 0x37, 0x01, 0x82, 0x10,
+      0x50, 0xe7, 0xb1, 0x32, 0x7e, 0xdf, 0xd0, 0x5f, 0xff, 0xff, 0xfe, 0xc0,
+      0x75, 0xef, 0xf4, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9}}};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed MDS_sparse[partial_rounds][2 * sponge_size - 1] = {
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x00000000000000d6, 0x000001410a1c2410, 0xcf2a733aa36270c0,
+      0xeb8934d9f19986f0, 0xb9128059a3de1c46, 0x1bcabb60f1015112},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff32, 0xfffffecaf6449caf, 0x3166b02e6eaf983f,
+      0xb8c87bc7533ec118, 0xd16f62f3e10fdffe, 0x04598e9de5c2eb60}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x00000000000000cf, 0x0000013689c77b68, 0xeeab743eb392a8e0,
+      0xfbc1ba4cd55c47e8, 0x9fe0d975cf8ddf89, 0x1faafaa1f5159c2d},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff39, 0xfffffed576994557, 0x11e5af2a5e7f601f,
+      0xa88ff6546f7c0020, 0xeaa109d7b5601cbb, 0x00794f5ce1aea045}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x00000000000000c8, 0x0000012c0972d2c0, 0x0e2c7542c3c2e100,
+      0x0bfa3fbfb91f08e1, 0x86af3291fb3da2cd, 0x238b39e2f929e748},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff41, 0xfffffee176fa0617, 0x1276d2937091691f,
+      0x4ce1a6f5b4544829, 0x7522ed253a4e1901, 0x209d995bb872dcb9}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x00000000000000c0, 0x0000012009121200, 0x0d9b51d9b1b0d800,
+      0x67a88f1e7446c0d8, 0xfc2d4f44764fa687, 0x0366efe42265aad4},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff48, 0xfffffeebf74eaebf, 0xf2f5d18f606130ff,
+      0x3ca92182d0918730, 0x8e5494090e9e55be, 0x1cbd5a1ab45e919e}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x00000000000000b9, 0x0000011588bd6958, 0x2d1c52ddc1e11020,
+      0x77e11491580981d0, 0xe2fba860a1ff69ca, 0x07472f252679f5ef},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff4f, 0xfffffef677a35767, 0xd374d08b5030f8df,
+      0x2c709c0feccec638, 0xa7863aece2ee927b, 0x18dd1ad9b04a4683}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x00000000000000b2, 0x0000010b0868c0b0, 0x4c9d53e1d2114840,
+      0x88199a043bcc42c8, 0xc9ca017ccdaf2d0d, 0x0b276e662a8e410a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff56, 0xffffff00f7f8000f, 0xb3f3cf874000c0bf,
+      0x1c38169d090c0540, 0xc0b7e1d0b73ecf38, 0x14fcdb98ac35fb68}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x00000000000000ab, 0x0000010088141808, 0x6c1e54e5e2418060,
+      0x98521f771f8f03c0, 0xb0985a98f95ef050, 0x0f07ada72ea28c25},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff5d, 0xffffff0b784ca8b7, 0x9472ce832fd0889f,
+      0x0bff912a25494448, 0xd9e988b48b8f0bf5, 0x111c9c57a821b04d}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x00000000000000a4, 0x000000f607bf6f60, 0x8b9f55e9f271b880,
+      0xa88aa4ea0351c4b8, 0x9766b3b5250eb393, 0x12e7ece832b6d740},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff64, 0xffffff15f8a1515f, 0x74f1cd7f1fa0507f,
+      0xfbc70bb741868350, 0xf31b2f985fdf48b1, 0x0d3c5d16a40d6532}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x000000000000009d, 0x000000eb876ac6b8, 0xab2056ee02a1f0a0,
+      0xb8c32a5ce71485b0, 0x7e350cd150be76d6, 0x16c82c2936cb225b},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff6b, 0xffffff2078f5fa07, 0x5570cc7b0f70185f,
+      0xeb8e86445dc3c258, 0x0c4cd67c342f856e, 0x095c1dd59ff91a18}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000096, 0x000000e107161e10, 0xcaa157f212d228c0,
+      0xc8fbafcfcad746a8, 0x650365ed7c6e3a19, 0x1aa86b6a3adf6d76},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff72, 0xffffff2af94aa2af, 0x35efcb76ff3fe03f,
+      0xdb5600d17a010160, 0x257e7d60087fc22b, 0x057bde949be4cefd}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x000000000000008f, 0x000000d686c17568, 0xea2258f6230260e0,
+      0xd9343542ae9a07a0, 0x4bd1bf09a81dfd5c, 0x1e88aaab3ef3b891},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff79, 0xffffff35799f4b57, 0x166eca72ef0fa81f,
+      0xcb1d7b5e963e4068, 0x3eb02443dccffee8, 0x019b9f5397d083e2}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000088, 0x000000cc066cccc0, 0x09a359fa33329900,
+      0xe96cbab5925cc899, 0x32a01825d3cdc09f, 0x2268e9ec430803ac},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff81, 0xffffff417a000c17, 0x16ffeddc0121b11f,
+      0x6f6f2bffdb168871, 0xc932079161bdfb2e, 0x21bfe9526e94c055}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000080, 0x000000c0060c0c00, 0x0912369121209000,
+      0x451b0a144d848090, 0xa81e34d84edfc45a, 0x02449fed6c43c738},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff88, 0xffffff4bfa54b4bf, 0xf77eecd7f0f178ff,
+      0x5f36a68cf753c778, 0xe263ae75360e37eb, 0x1ddfaa116a80753a}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000079, 0x000000b585b76358, 0x289337953150c820,
+      0x55538f8731474188, 0x8eec8df47a8f879d, 0x0624df2e70581253},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff8f, 0xffffff567aa95d67, 0xd7fdebd3e0c140df,
+      0x4efe211a13910680, 0xfb9555590a5e74a8, 0x19ff6ad0666c2a1f}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000072, 0x000000ab0562bab0, 0x4814389941810040,
+      0x658c14fa150a0280, 0x75bae710a63f4ae0, 0x0a051e6f746c5d6e},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff96, 0xffffff60fafe060f, 0xb87ceacfd09108bf,
+      0x3ec59ba72fce4588, 0x14c6fc3cdeaeb165, 0x161f2b8f6257df05}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x000000000000006b, 0x000000a0850e1208, 0x6795399d51b13860,
+      0x75c49a6cf8ccc378, 0x5c89402cd1ef0e23, 0x0de55db07880a889},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffff9d, 0xffffff6b7b52aeb7, 0x98fbe9cbc060d09f,
+      0x2e8d16344c0b8490, 0x2df8a320b2feee22, 0x123eec4e5e4393ea}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000064, 0x0000009604b96960, 0x87163aa161e17080,
+      0x85fd1fdfdc8f8470, 0x43579948fd9ed166, 0x11c59cf17c94f3a4},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffa4, 0xffffff75fba7575f, 0x797ae8c7b030987f,
+      0x1e5490c16848c398, 0x472a4a04874f2adf, 0x0e5ead0d5a2f48cf}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x000000000000005d, 0x0000008b8464c0b8, 0xa6973ba57211a8a0,
+      0x9635a552c0524568, 0x2a25f265294e94a9, 0x15a5dc3280a93ebf},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffab, 0xffffff807bfc0007, 0x59f9e7c3a000605f,
+      0x0e1c0b4e848602a0, 0x605bf0e85b9f679c, 0x0a7e6dcc561afdb4}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000056, 0x0000008104101810, 0xc6183ca98241e0c0,
+      0xa66e2ac5a4150660, 0x10f44b8154fe57ec, 0x19861b7384bd89da},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffb2, 0xffffff8afc50a8af, 0x3a78e6bf8fd0283f,
+      0xfde385dba0c341a8, 0x798d97cc2fefa458, 0x069e2e8b5206b299}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x000000000000004f, 0x0000007683bb6f68, 0xe5993dad927218e0,
+      0xb6a6b03887d7c758, 0xf7c2a49d80ae1b2f, 0x1d665ab488d1d4f4},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffb9, 0xffffff957ca55157, 0x1af7e5bb7f9ff01f,
+      0xedab0068bd0080b0, 0x92bf3eb0043fe115, 0x02bdef4a4df2677e}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000048, 0x0000006c0366c6c0, 0x051a3eb1a2a25100,
+      0xc6df35ab6b9a8851, 0xde90fdb9ac5dde72, 0x214699f58ce6200f},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffc1, 0xffffffa17d061217, 0x1b89092491b1f91f,
+      0x91fcb10a01d8c8b9, 0x1d4121fd892ddd5b, 0x22e2394924b6a3f2}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000040, 0x0000006003060600, 0x04891b4890904800,
+      0x228d850a26c24048, 0x540f1a6c276fe22d, 0x01224ff6b621e39c},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffc8, 0xffffffabfd5ababf, 0xfc0808208181c0ff,
+      0x81c42b971e1607c0, 0x3672c8e15d7e1a18, 0x1f01fa0820a258d7}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000039, 0x0000005582b15d58, 0x240a1c4ca0c08020,
+      0x32c60a7d0a850140, 0x3add7388531fa570, 0x05028f37ba362eb7},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffcf, 0xffffffb67daf6367, 0xdc87071c715188df,
+      0x718ba6243a5346c8, 0x4fa46fc531ce56d5, 0x1b21bac71c8e0dbc}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000032, 0x0000004b025cb4b0, 0x438b1d50b0f0b840,
+      0x42fe8fefee47c238, 0x21abcca47ecf68b3, 0x08e2ce78be4a79d2},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffd6, 0xffffffc0fe040c0f, 0xbd060618612150bf,
+      0x615320b1569085d0, 0x68d616a9061e9392, 0x17417b861879c2a1}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x000000000000002b, 0x0000004082080c08, 0x630c1e54c120f060,
+      0x53371562d20a8330, 0x087a25c0aa7f2bf6, 0x0cc30db9c25ec4ed},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffdd, 0xffffffcb7e58b4b7, 0x9d85051450f1189f,
+      0x511a9b3e72cdc4d8, 0x8207bd8cda6ed04f, 0x13613c4514657786}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000024, 0x0000003601b36360, 0x828d1f58d1512880,
+      0x636f9ad5b5cd4428, 0xef487edcd62eef39, 0x10a34cfac6731007},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffe4, 0xffffffd5fead5d5f, 0x7e04041040c0e07f,
+      0x40e215cb8f0b03e0, 0x9b396470aebf0d0c, 0x0f80fd0410512c6b}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x000000000000001d, 0x0000002b815ebab8, 0xa20e205ce18160a0,
+      0x73a8204899900520, 0xd616d7f901deb27c, 0x14838c3bca875b22},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xffffffffffffffeb, 0xffffffe07f020607, 0x5e83030c3090a85f,
+      0x30a99058ab4842e8, 0xb46b0b54830f49c9, 0x0ba0bdc30c3ce150}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000016, 0x00000021010a1210, 0xc18f2160f1b198c0,
+      0x83e0a5bb7d52c618, 0xbce531152d8e75bf, 0x1863cb7cce9ba63d},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff2, 0xffffffeaff56aeaf, 0x3f0202082060703f,
+      0x20710ae5c78581f0, 0xcd9cb238575f8686, 0x07c07e8208289635}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x000000000000000f, 0x0000001680b56968, 0xe110226501e1d0e0,
+      0x94192b2e61158710, 0xa3b38a31593e3902, 0x1c440abdd2aff158},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a}},
+    {{0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000008, 0x0000000c0060c0c0, 0x0091236912120900,
+      0xa451b0a144d84809, 0x8a81e34d84edfc45, 0x202449fed6c43c73},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0xfffffffffffffff9, 0xfffffff57fab5757, 0x1f8101041030381f,
+      0x10388572e3c2c0f8, 0xe6ce591c2bafc343, 0x03e03f4104144b1a},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000}}};
+#else
+static const fe_packed MDS_sparse[partial_rounds][2 * sponge_size - 1] = {
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1b, 0xca, 0xbb, 0x60, 0xf1, 0x01, 0x51, 0x12, 0xb9, 0x12, 0x80, 0x59,
+      0xa3, 0xde, 0x1c, 0x46, 0xeb, 0x89, 0x34, 0xd9, 0xf1, 0x99, 0x86, 0xf0,
+      0xcf, 0x2a, 0x73, 0x3a, 0xa3, 0x62, 0x70, 0xc0, 0x00, 0x00, 0x01, 0x41,
+      0x0a, 0x1c, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x04, 0x59, 0x8e, 0x9d, 0xe5, 0xc2, 0xeb, 0x60, 0xd1, 0x6f, 0x62, 0xf3,
+      0xe1, 0x0f, 0xdf, 0xfe, 0xb8, 0xc8, 0x7b, 0xc7, 0x53, 0x3e, 0xc1, 0x18,
+      0x31, 0x66, 0xb0, 0x2e, 0x6e, 0xaf, 0x98, 0x3f, 0xff, 0xff, 0xfe, 0xca,
+      0xf6, 0x44, 0x9c, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1f, 0xaa, 0xfa, 0xa1, 0xf5, 0x15, 0x9c, 0x2d, 0x9f, 0xe0, 0xd9, 0x75,
+      0xcf, 0x8d, 0xdf, 0x89, 0xfb, 0xc1, 0xba, 0x4c, 0xd5, 0x5c, 0x47, 0xe8,
+      0xee, 0xab, 0x74, 0x3e, 0xb3, 0x92, 0xa8, 0xe0, 0x00, 0x00, 0x01, 0x36,
+      0x89, 0xc7, 0x7b, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x00, 0x79, 0x4f, 0x5c, 0xe1, 0xae, 0xa0, 0x45, 0xea, 0xa1, 0x09, 0xd7,
+      0xb5, 0x60, 0x1c, 0xbb, 0xa8, 0x8f, 0xf6, 0x54, 0x6f, 0x7c, 0x00, 0x20,
+      0x11, 0xe5, 0xaf, 0x2a, 0x5e, 0x7f, 0x60, 0x1f, 0xff, 0xff, 0xfe, 0xd5,
+      0x76, 0x99, 0x45, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x23, 0x8b, 0x39, 0xe2, 0xf9, 0x29, 0xe7, 0x48, 0x86, 0xaf, 0x32, 0x91,
+      0xfb, 0x3d, 0xa2, 0xcd, 0x0b, 0xfa, 0x3f, 0xbf, 0xb9, 0x1f, 0x08, 0xe1,
+      0x0e, 0x2c, 0x75, 0x42, 0xc3, 0xc2, 0xe1, 0x00, 0x00, 0x00, 0x01, 0x2c,
+      0x09, 0x72, 0xd2, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x20, 0x9d, 0x99, 0x5b, 0xb8, 0x72, 0xdc, 0xb9, 0x75, 0x22, 0xed, 0x25,
+      0x3a, 0x4e, 0x19, 0x01, 0x4c, 0xe1, 0xa6, 0xf5, 0xb4, 0x54, 0x48, 0x29,
+      0x12, 0x76, 0xd2, 0x93, 0x70, 0x91, 0x69, 0x1f, 0xff, 0xff, 0xfe, 0xe1,
+      0x76, 0xfa, 0x06, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0x66, 0xef, 0xe4, 0x22, 0x65, 0xaa, 0xd4, 0xfc, 0x2d, 0x4f, 0x44,
+      0x76, 0x4f, 0xa6, 0x87, 0x67, 0xa8, 0x8f, 0x1e, 0x74, 0x46, 0xc0, 0xd8,
+      0x0d, 0x9b, 0x51, 0xd9, 0xb1, 0xb0, 0xd8, 0x00, 0x00, 0x00, 0x01, 0x20,
+      0x09, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1c, 0xbd, 0x5a, 0x1a, 0xb4, 0x5e, 0x91, 0x9e, 0x8e, 0x54, 0x94, 0x09,
+      0x0e, 0x9e, 0x55, 0xbe, 0x3c, 0xa9, 0x21, 0x82, 0xd0, 0x91, 0x87, 0x30,
+      0xf2, 0xf5, 0xd1, 0x8f, 0x60, 0x61, 0x30, 0xff, 0xff, 0xff, 0xfe, 0xeb,
+      0xf7, 0x4e, 0xae, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x07, 0x47, 0x2f, 0x25, 0x26, 0x79, 0xf5, 0xef, 0xe2, 0xfb, 0xa8, 0x60,
+      0xa1, 0xff, 0x69, 0xca, 0x77, 0xe1, 0x14, 0x91, 0x58, 0x09, 0x81, 0xd0,
+      0x2d, 0x1c, 0x52, 0xdd, 0xc1, 0xe1, 0x10, 0x20, 0x00, 0x00, 0x01, 0x15,
+      0x88, 0xbd, 0x69, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x18, 0xdd, 0x1a, 0xd9, 0xb0, 0x4a, 0x46, 0x83, 0xa7, 0x86, 0x3a, 0xec,
+      0xe2, 0xee, 0x92, 0x7b, 0x2c, 0x70, 0x9c, 0x0f, 0xec, 0xce, 0xc6, 0x38,
+      0xd3, 0x74, 0xd0, 0x8b, 0x50, 0x30, 0xf8, 0xdf, 0xff, 0xff, 0xfe, 0xf6,
+      0x77, 0xa3, 0x57, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0b, 0x27, 0x6e, 0x66, 0x2a, 0x8e, 0x41, 0x0a, 0xc9, 0xca, 0x01, 0x7c,
+      0xcd, 0xaf, 0x2d, 0x0d, 0x88, 0x19, 0x9a, 0x04, 0x3b, 0xcc, 0x42, 0xc8,
+      0x4c, 0x9d, 0x53, 0xe1, 0xd2, 0x11, 0x48, 0x40, 0x00, 0x00, 0x01, 0x0b,
+      0x08, 0x68, 0xc0, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x14, 0xfc, 0xdb, 0x98, 0xac, 0x35, 0xfb, 0x68, 0xc0, 0xb7, 0xe1, 0xd0,
+      0xb7, 0x3e, 0xcf, 0x38, 0x1c, 0x38, 0x16, 0x9d, 0x09, 0x0c, 0x05, 0x40,
+      0xb3, 0xf3, 0xcf, 0x87, 0x40, 0x00, 0xc0, 0xbf, 0xff, 0xff, 0xff, 0x00,
+      0xf7, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0f, 0x07, 0xad, 0xa7, 0x2e, 0xa2, 0x8c, 0x25, 0xb0, 0x98, 0x5a, 0x98,
+      0xf9, 0x5e, 0xf0, 0x50, 0x98, 0x52, 0x1f, 0x77, 0x1f, 0x8f, 0x03, 0xc0,
+      0x6c, 0x1e, 0x54, 0xe5, 0xe2, 0x41, 0x80, 0x60, 0x00, 0x00, 0x01, 0x00,
+      0x88, 0x14, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x11, 0x1c, 0x9c, 0x57, 0xa8, 0x21, 0xb0, 0x4d, 0xd9, 0xe9, 0x88, 0xb4,
+      0x8b, 0x8f, 0x0b, 0xf5, 0x0b, 0xff, 0x91, 0x2a, 0x25, 0x49, 0x44, 0x48,
+      0x94, 0x72, 0xce, 0x83, 0x2f, 0xd0, 0x88, 0x9f, 0xff, 0xff, 0xff, 0x0b,
+      0x78, 0x4c, 0xa8, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x12, 0xe7, 0xec, 0xe8, 0x32, 0xb6, 0xd7, 0x40, 0x97, 0x66, 0xb3, 0xb5,
+      0x25, 0x0e, 0xb3, 0x93, 0xa8, 0x8a, 0xa4, 0xea, 0x03, 0x51, 0xc4, 0xb8,
+      0x8b, 0x9f, 0x55, 0xe9, 0xf2, 0x71, 0xb8, 0x80, 0x00, 0x00, 0x00, 0xf6,
+      0x07, 0xbf, 0x6f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0d, 0x3c, 0x5d, 0x16, 0xa4, 0x0d, 0x65, 0x32, 0xf3, 0x1b, 0x2f, 0x98,
+      0x5f, 0xdf, 0x48, 0xb1, 0xfb, 0xc7, 0x0b, 0xb7, 0x41, 0x86, 0x83, 0x50,
+      0x74, 0xf1, 0xcd, 0x7f, 0x1f, 0xa0, 0x50, 0x7f, 0xff, 0xff, 0xff, 0x15,
+      0xf8, 0xa1, 0x51, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x16, 0xc8, 0x2c, 0x29, 0x36, 0xcb, 0x22, 0x5b, 0x7e, 0x35, 0x0c, 0xd1,
+      0x50, 0xbe, 0x76, 0xd6, 0xb8, 0xc3, 0x2a, 0x5c, 0xe7, 0x14, 0x85, 0xb0,
+      0xab, 0x20, 0x56, 0xee, 0x02, 0xa1, 0xf0, 0xa0, 0x00, 0x00, 0x00, 0xeb,
+      0x87, 0x6a, 0xc6, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x09, 0x5c, 0x1d, 0xd5, 0x9f, 0xf9, 0x1a, 0x18, 0x0c, 0x4c, 0xd6, 0x7c,
+      0x34, 0x2f, 0x85, 0x6e, 0xeb, 0x8e, 0x86, 0x44, 0x5d, 0xc3, 0xc2, 0x58,
+      0x55, 0x70, 0xcc, 0x7b, 0x0f, 0x70, 0x18, 0x5f, 0xff, 0xff, 0xff, 0x20,
+      0x78, 0xf5, 0xfa, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1a, 0xa8, 0x6b, 0x6a, 0x3a, 0xdf, 0x6d, 0x76, 0x65, 0x03, 0x65, 0xed,
+      0x7c, 0x6e, 0x3a, 0x19, 0xc8, 0xfb, 0xaf, 0xcf, 0xca, 0xd7, 0x46, 0xa8,
+      0xca, 0xa1, 0x57, 0xf2, 0x12, 0xd2, 0x28, 0xc0, 0x00, 0x00, 0x00, 0xe1,
+      0x07, 0x16, 0x1e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x05, 0x7b, 0xde, 0x94, 0x9b, 0xe4, 0xce, 0xfd, 0x25, 0x7e, 0x7d, 0x60,
+      0x08, 0x7f, 0xc2, 0x2b, 0xdb, 0x56, 0x00, 0xd1, 0x7a, 0x01, 0x01, 0x60,
+      0x35, 0xef, 0xcb, 0x76, 0xff, 0x3f, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0x2a,
+      0xf9, 0x4a, 0xa2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1e, 0x88, 0xaa, 0xab, 0x3e, 0xf3, 0xb8, 0x91, 0x4b, 0xd1, 0xbf, 0x09,
+      0xa8, 0x1d, 0xfd, 0x5c, 0xd9, 0x34, 0x35, 0x42, 0xae, 0x9a, 0x07, 0xa0,
+      0xea, 0x22, 0x58, 0xf6, 0x23, 0x02, 0x60, 0xe0, 0x00, 0x00, 0x00, 0xd6,
+      0x86, 0xc1, 0x75, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x01, 0x9b, 0x9f, 0x53, 0x97, 0xd0, 0x83, 0xe2, 0x3e, 0xb0, 0x24, 0x43,
+      0xdc, 0xcf, 0xfe, 0xe8, 0xcb, 0x1d, 0x7b, 0x5e, 0x96, 0x3e, 0x40, 0x68,
+      0x16, 0x6e, 0xca, 0x72, 0xef, 0x0f, 0xa8, 0x1f, 0xff, 0xff, 0xff, 0x35,
+      0x79, 0x9f, 0x4b, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x22, 0x68, 0xe9, 0xec, 0x43, 0x08, 0x03, 0xac, 0x32, 0xa0, 0x18, 0x25,
+      0xd3, 0xcd, 0xc0, 0x9f, 0xe9, 0x6c, 0xba, 0xb5, 0x92, 0x5c, 0xc8, 0x99,
+      0x09, 0xa3, 0x59, 0xfa, 0x33, 0x32, 0x99, 0x00, 0x00, 0x00, 0x00, 0xcc,
+      0x06, 0x6c, 0xcc, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x21, 0xbf, 0xe9, 0x52, 0x6e, 0x94, 0xc0, 0x55, 0xc9, 0x32, 0x07, 0x91,
+      0x61, 0xbd, 0xfb, 0x2e, 0x6f, 0x6f, 0x2b, 0xff, 0xdb, 0x16, 0x88, 0x71,
+      0x16, 0xff, 0xed, 0xdc, 0x01, 0x21, 0xb1, 0x1f, 0xff, 0xff, 0xff, 0x41,
+      0x7a, 0x00, 0x0c, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x02, 0x44, 0x9f, 0xed, 0x6c, 0x43, 0xc7, 0x38, 0xa8, 0x1e, 0x34, 0xd8,
+      0x4e, 0xdf, 0xc4, 0x5a, 0x45, 0x1b, 0x0a, 0x14, 0x4d, 0x84, 0x80, 0x90,
+      0x09, 0x12, 0x36, 0x91, 0x21, 0x20, 0x90, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x06, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1d, 0xdf, 0xaa, 0x11, 0x6a, 0x80, 0x75, 0x3a, 0xe2, 0x63, 0xae, 0x75,
+      0x36, 0x0e, 0x37, 0xeb, 0x5f, 0x36, 0xa6, 0x8c, 0xf7, 0x53, 0xc7, 0x78,
+      0xf7, 0x7e, 0xec, 0xd7, 0xf0, 0xf1, 0x78, 0xff, 0xff, 0xff, 0xff, 0x4b,
+      0xfa, 0x54, 0xb4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x06, 0x24, 0xdf, 0x2e, 0x70, 0x58, 0x12, 0x53, 0x8e, 0xec, 0x8d, 0xf4,
+      0x7a, 0x8f, 0x87, 0x9d, 0x55, 0x53, 0x8f, 0x87, 0x31, 0x47, 0x41, 0x88,
+      0x28, 0x93, 0x37, 0x95, 0x31, 0x50, 0xc8, 0x20, 0x00, 0x00, 0x00, 0xb5,
+      0x85, 0xb7, 0x63, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x19, 0xff, 0x6a, 0xd0, 0x66, 0x6c, 0x2a, 0x1f, 0xfb, 0x95, 0x55, 0x59,
+      0x0a, 0x5e, 0x74, 0xa8, 0x4e, 0xfe, 0x21, 0x1a, 0x13, 0x91, 0x06, 0x80,
+      0xd7, 0xfd, 0xeb, 0xd3, 0xe0, 0xc1, 0x40, 0xdf, 0xff, 0xff, 0xff, 0x56,
+      0x7a, 0xa9, 0x5d, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0a, 0x05, 0x1e, 0x6f, 0x74, 0x6c, 0x5d, 0x6e, 0x75, 0xba, 0xe7, 0x10,
+      0xa6, 0x3f, 0x4a, 0xe0, 0x65, 0x8c, 0x14, 0xfa, 0x15, 0x0a, 0x02, 0x80,
+      0x48, 0x14, 0x38, 0x99, 0x41, 0x81, 0x00, 0x40, 0x00, 0x00, 0x00, 0xab,
+      0x05, 0x62, 0xba, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x16, 0x1f, 0x2b, 0x8f, 0x62, 0x57, 0xdf, 0x05, 0x14, 0xc6, 0xfc, 0x3c,
+      0xde, 0xae, 0xb1, 0x65, 0x3e, 0xc5, 0x9b, 0xa7, 0x2f, 0xce, 0x45, 0x88,
+      0xb8, 0x7c, 0xea, 0xcf, 0xd0, 0x91, 0x08, 0xbf, 0xff, 0xff, 0xff, 0x60,
+      0xfa, 0xfe, 0x06, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0d, 0xe5, 0x5d, 0xb0, 0x78, 0x80, 0xa8, 0x89, 0x5c, 0x89, 0x40, 0x2c,
+      0xd1, 0xef, 0x0e, 0x23, 0x75, 0xc4, 0x9a, 0x6c, 0xf8, 0xcc, 0xc3, 0x78,
+      0x67, 0x95, 0x39, 0x9d, 0x51, 0xb1, 0x38, 0x60, 0x00, 0x00, 0x00, 0xa0,
+      0x85, 0x0e, 0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x12, 0x3e, 0xec, 0x4e, 0x5e, 0x43, 0x93, 0xea, 0x2d, 0xf8, 0xa3, 0x20,
+      0xb2, 0xfe, 0xee, 0x22, 0x2e, 0x8d, 0x16, 0x34, 0x4c, 0x0b, 0x84, 0x90,
+      0x98, 0xfb, 0xe9, 0xcb, 0xc0, 0x60, 0xd0, 0x9f, 0xff, 0xff, 0xff, 0x6b,
+      0x7b, 0x52, 0xae, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x11, 0xc5, 0x9c, 0xf1, 0x7c, 0x94, 0xf3, 0xa4, 0x43, 0x57, 0x99, 0x48,
+      0xfd, 0x9e, 0xd1, 0x66, 0x85, 0xfd, 0x1f, 0xdf, 0xdc, 0x8f, 0x84, 0x70,
+      0x87, 0x16, 0x3a, 0xa1, 0x61, 0xe1, 0x70, 0x80, 0x00, 0x00, 0x00, 0x96,
+      0x04, 0xb9, 0x69, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0e, 0x5e, 0xad, 0x0d, 0x5a, 0x2f, 0x48, 0xcf, 0x47, 0x2a, 0x4a, 0x04,
+      0x87, 0x4f, 0x2a, 0xdf, 0x1e, 0x54, 0x90, 0xc1, 0x68, 0x48, 0xc3, 0x98,
+      0x79, 0x7a, 0xe8, 0xc7, 0xb0, 0x30, 0x98, 0x7f, 0xff, 0xff, 0xff, 0x75,
+      0xfb, 0xa7, 0x57, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x15, 0xa5, 0xdc, 0x32, 0x80, 0xa9, 0x3e, 0xbf, 0x2a, 0x25, 0xf2, 0x65,
+      0x29, 0x4e, 0x94, 0xa9, 0x96, 0x35, 0xa5, 0x52, 0xc0, 0x52, 0x45, 0x68,
+      0xa6, 0x97, 0x3b, 0xa5, 0x72, 0x11, 0xa8, 0xa0, 0x00, 0x00, 0x00, 0x8b,
+      0x84, 0x64, 0xc0, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0a, 0x7e, 0x6d, 0xcc, 0x56, 0x1a, 0xfd, 0xb4, 0x60, 0x5b, 0xf0, 0xe8,
+      0x5b, 0x9f, 0x67, 0x9c, 0x0e, 0x1c, 0x0b, 0x4e, 0x84, 0x86, 0x02, 0xa0,
+      0x59, 0xf9, 0xe7, 0xc3, 0xa0, 0x00, 0x60, 0x5f, 0xff, 0xff, 0xff, 0x80,
+      0x7b, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x19, 0x86, 0x1b, 0x73, 0x84, 0xbd, 0x89, 0xda, 0x10, 0xf4, 0x4b, 0x81,
+      0x54, 0xfe, 0x57, 0xec, 0xa6, 0x6e, 0x2a, 0xc5, 0xa4, 0x15, 0x06, 0x60,
+      0xc6, 0x18, 0x3c, 0xa9, 0x82, 0x41, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x81,
+      0x04, 0x10, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x06, 0x9e, 0x2e, 0x8b, 0x52, 0x06, 0xb2, 0x99, 0x79, 0x8d, 0x97, 0xcc,
+      0x2f, 0xef, 0xa4, 0x58, 0xfd, 0xe3, 0x85, 0xdb, 0xa0, 0xc3, 0x41, 0xa8,
+      0x3a, 0x78, 0xe6, 0xbf, 0x8f, 0xd0, 0x28, 0x3f, 0xff, 0xff, 0xff, 0x8a,
+      0xfc, 0x50, 0xa8, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1d, 0x66, 0x5a, 0xb4, 0x88, 0xd1, 0xd4, 0xf4, 0xf7, 0xc2, 0xa4, 0x9d,
+      0x80, 0xae, 0x1b, 0x2f, 0xb6, 0xa6, 0xb0, 0x38, 0x87, 0xd7, 0xc7, 0x58,
+      0xe5, 0x99, 0x3d, 0xad, 0x92, 0x72, 0x18, 0xe0, 0x00, 0x00, 0x00, 0x76,
+      0x83, 0xbb, 0x6f, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x02, 0xbd, 0xef, 0x4a, 0x4d, 0xf2, 0x67, 0x7e, 0x92, 0xbf, 0x3e, 0xb0,
+      0x04, 0x3f, 0xe1, 0x15, 0xed, 0xab, 0x00, 0x68, 0xbd, 0x00, 0x80, 0xb0,
+      0x1a, 0xf7, 0xe5, 0xbb, 0x7f, 0x9f, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0x95,
+      0x7c, 0xa5, 0x51, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x21, 0x46, 0x99, 0xf5, 0x8c, 0xe6, 0x20, 0x0f, 0xde, 0x90, 0xfd, 0xb9,
+      0xac, 0x5d, 0xde, 0x72, 0xc6, 0xdf, 0x35, 0xab, 0x6b, 0x9a, 0x88, 0x51,
+      0x05, 0x1a, 0x3e, 0xb1, 0xa2, 0xa2, 0x51, 0x00, 0x00, 0x00, 0x00, 0x6c,
+      0x03, 0x66, 0xc6, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x22, 0xe2, 0x39, 0x49, 0x24, 0xb6, 0xa3, 0xf2, 0x1d, 0x41, 0x21, 0xfd,
+      0x89, 0x2d, 0xdd, 0x5b, 0x91, 0xfc, 0xb1, 0x0a, 0x01, 0xd8, 0xc8, 0xb9,
+      0x1b, 0x89, 0x09, 0x24, 0x91, 0xb1, 0xf9, 0x1f, 0xff, 0xff, 0xff, 0xa1,
+      0x7d, 0x06, 0x12, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x01, 0x22, 0x4f, 0xf6, 0xb6, 0x21, 0xe3, 0x9c, 0x54, 0x0f, 0x1a, 0x6c,
+      0x27, 0x6f, 0xe2, 0x2d, 0x22, 0x8d, 0x85, 0x0a, 0x26, 0xc2, 0x40, 0x48,
+      0x04, 0x89, 0x1b, 0x48, 0x90, 0x90, 0x48, 0x00, 0x00, 0x00, 0x00, 0x60,
+      0x03, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1f, 0x01, 0xfa, 0x08, 0x20, 0xa2, 0x58, 0xd7, 0x36, 0x72, 0xc8, 0xe1,
+      0x5d, 0x7e, 0x1a, 0x18, 0x81, 0xc4, 0x2b, 0x97, 0x1e, 0x16, 0x07, 0xc0,
+      0xfc, 0x08, 0x08, 0x20, 0x81, 0x81, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xab,
+      0xfd, 0x5a, 0xba, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x05, 0x02, 0x8f, 0x37, 0xba, 0x36, 0x2e, 0xb7, 0x3a, 0xdd, 0x73, 0x88,
+      0x53, 0x1f, 0xa5, 0x70, 0x32, 0xc6, 0x0a, 0x7d, 0x0a, 0x85, 0x01, 0x40,
+      0x24, 0x0a, 0x1c, 0x4c, 0xa0, 0xc0, 0x80, 0x20, 0x00, 0x00, 0x00, 0x55,
+      0x82, 0xb1, 0x5d, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1b, 0x21, 0xba, 0xc7, 0x1c, 0x8e, 0x0d, 0xbc, 0x4f, 0xa4, 0x6f, 0xc5,
+      0x31, 0xce, 0x56, 0xd5, 0x71, 0x8b, 0xa6, 0x24, 0x3a, 0x53, 0x46, 0xc8,
+      0xdc, 0x87, 0x07, 0x1c, 0x71, 0x51, 0x88, 0xdf, 0xff, 0xff, 0xff, 0xb6,
+      0x7d, 0xaf, 0x63, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x08, 0xe2, 0xce, 0x78, 0xbe, 0x4a, 0x79, 0xd2, 0x21, 0xab, 0xcc, 0xa4,
+      0x7e, 0xcf, 0x68, 0xb3, 0x42, 0xfe, 0x8f, 0xef, 0xee, 0x47, 0xc2, 0x38,
+      0x43, 0x8b, 0x1d, 0x50, 0xb0, 0xf0, 0xb8, 0x40, 0x00, 0x00, 0x00, 0x4b,
+      0x02, 0x5c, 0xb4, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x17, 0x41, 0x7b, 0x86, 0x18, 0x79, 0xc2, 0xa1, 0x68, 0xd6, 0x16, 0xa9,
+      0x06, 0x1e, 0x93, 0x92, 0x61, 0x53, 0x20, 0xb1, 0x56, 0x90, 0x85, 0xd0,
+      0xbd, 0x06, 0x06, 0x18, 0x61, 0x21, 0x50, 0xbf, 0xff, 0xff, 0xff, 0xc0,
+      0xfe, 0x04, 0x0c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0c, 0xc3, 0x0d, 0xb9, 0xc2, 0x5e, 0xc4, 0xed, 0x08, 0x7a, 0x25, 0xc0,
+      0xaa, 0x7f, 0x2b, 0xf6, 0x53, 0x37, 0x15, 0x62, 0xd2, 0x0a, 0x83, 0x30,
+      0x63, 0x0c, 0x1e, 0x54, 0xc1, 0x20, 0xf0, 0x60, 0x00, 0x00, 0x00, 0x40,
+      0x82, 0x08, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x13, 0x61, 0x3c, 0x45, 0x14, 0x65, 0x77, 0x86, 0x82, 0x07, 0xbd, 0x8c,
+      0xda, 0x6e, 0xd0, 0x4f, 0x51, 0x1a, 0x9b, 0x3e, 0x72, 0xcd, 0xc4, 0xd8,
+      0x9d, 0x85, 0x05, 0x14, 0x50, 0xf1, 0x18, 0x9f, 0xff, 0xff, 0xff, 0xcb,
+      0x7e, 0x58, 0xb4, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x10, 0xa3, 0x4c, 0xfa, 0xc6, 0x73, 0x10, 0x07, 0xef, 0x48, 0x7e, 0xdc,
+      0xd6, 0x2e, 0xef, 0x39, 0x63, 0x6f, 0x9a, 0xd5, 0xb5, 0xcd, 0x44, 0x28,
+      0x82, 0x8d, 0x1f, 0x58, 0xd1, 0x51, 0x28, 0x80, 0x00, 0x00, 0x00, 0x36,
+      0x01, 0xb3, 0x63, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0f, 0x80, 0xfd, 0x04, 0x10, 0x51, 0x2c, 0x6b, 0x9b, 0x39, 0x64, 0x70,
+      0xae, 0xbf, 0x0d, 0x0c, 0x40, 0xe2, 0x15, 0xcb, 0x8f, 0x0b, 0x03, 0xe0,
+      0x7e, 0x04, 0x04, 0x10, 0x40, 0xc0, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xd5,
+      0xfe, 0xad, 0x5d, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x14, 0x83, 0x8c, 0x3b, 0xca, 0x87, 0x5b, 0x22, 0xd6, 0x16, 0xd7, 0xf9,
+      0x01, 0xde, 0xb2, 0x7c, 0x73, 0xa8, 0x20, 0x48, 0x99, 0x90, 0x05, 0x20,
+      0xa2, 0x0e, 0x20, 0x5c, 0xe1, 0x81, 0x60, 0xa0, 0x00, 0x00, 0x00, 0x2b,
+      0x81, 0x5e, 0xba, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x0b, 0xa0, 0xbd, 0xc3, 0x0c, 0x3c, 0xe1, 0x50, 0xb4, 0x6b, 0x0b, 0x54,
+      0x83, 0x0f, 0x49, 0xc9, 0x30, 0xa9, 0x90, 0x58, 0xab, 0x48, 0x42, 0xe8,
+      0x5e, 0x83, 0x03, 0x0c, 0x30, 0x90, 0xa8, 0x5f, 0xff, 0xff, 0xff, 0xe0,
+      0x7f, 0x02, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x18, 0x63, 0xcb, 0x7c, 0xce, 0x9b, 0xa6, 0x3d, 0xbc, 0xe5, 0x31, 0x15,
+      0x2d, 0x8e, 0x75, 0xbf, 0x83, 0xe0, 0xa5, 0xbb, 0x7d, 0x52, 0xc6, 0x18,
+      0xc1, 0x8f, 0x21, 0x60, 0xf1, 0xb1, 0x98, 0xc0, 0x00, 0x00, 0x00, 0x21,
+      0x01, 0x0a, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x07, 0xc0, 0x7e, 0x82, 0x08, 0x28, 0x96, 0x35, 0xcd, 0x9c, 0xb2, 0x38,
+      0x57, 0x5f, 0x86, 0x86, 0x20, 0x71, 0x0a, 0xe5, 0xc7, 0x85, 0x81, 0xf0,
+      0x3f, 0x02, 0x02, 0x08, 0x20, 0x60, 0x70, 0x3f, 0xff, 0xff, 0xff, 0xea,
+      0xff, 0x56, 0xae, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x1c, 0x44, 0x0a, 0xbd, 0xd2, 0xaf, 0xf1, 0x58, 0xa3, 0xb3, 0x8a, 0x31,
+      0x59, 0x3e, 0x39, 0x02, 0x94, 0x19, 0x2b, 0x2e, 0x61, 0x15, 0x87, 0x10,
+      0xe1, 0x10, 0x22, 0x65, 0x01, 0xe1, 0xd0, 0xe0, 0x00, 0x00, 0x00, 0x16,
+      0x80, 0xb5, 0x69, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9}},
+    {{0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x20, 0x24, 0x49, 0xfe, 0xd6, 0xc4, 0x3c, 0x73, 0x8a, 0x81, 0xe3, 0x4d,
+      0x84, 0xed, 0xfc, 0x45, 0xa4, 0x51, 0xb0, 0xa1, 0x44, 0xd8, 0x48, 0x09,
+      0x00, 0x91, 0x23, 0x69, 0x12, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0c,
+      0x00, 0x60, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x03, 0xe0, 0x3f, 0x41, 0x04, 0x14, 0x4b, 0x1a, 0xe6, 0xce, 0x59, 0x1c,
+      0x2b, 0xaf, 0xc3, 0x43, 0x10, 0x38, 0x85, 0x72, 0xe3, 0xc2, 0xc0, 0xf8,
+      0x1f, 0x81, 0x01, 0x04, 0x10, 0x30, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xf5,
+      0x7f, 0xab, 0x57, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}};
+#endif
+
+// fnv-1a of the tables above, as built, see poseidon_tables_ok
+#if defined(CODA_HOST)
+#define poseidon_tables_checksum 0xc506b9fb
+#else
+#define poseidon_tables_checksum 0xbbe15ddf
+#endif
+
+static inline unsigned int poseidon_tables_sum(void) {
+  unsigned int h = tables_checksum_init;
+  h = tables_checksum(h, &full_round_keys, sizeof(full_round_keys));
+  h = tables_checksum(h, &MDS_U, sizeof(MDS_U));
+  h = tables_checksum(h, &MDS_L, sizeof(MDS_L));
+  h = tables_checksum(h, &partial_round_keys, sizeof(partial_round_keys));
+  h = tables_checksum(h, &MDS_pre, sizeof(MDS_pre));
+  h = tables_checksum(h, &MDS_sparse, sizeof(MDS_sparse));
+  return h;
+}
+
+#endif // POSEIDON_TABLES
@@ -29,6 +29,34 @@
 
 static signature_context *ctx = &global.s;
 
+// set while handle_sign's review is on screen and ctx->sig is in use, as
+// global is shared with the other commands
+static unsigned int sign_pending;
+
+// a part of the signature per ticker event, so that little is left to do
+// once the user approves. sign_pending is dropped while a step runs, an
+// exception leaves the state abandoned, and the approval starts it over
+void sign_tick(void) {
+  if (!sign_pending || ctx->sig.step > comb_spacing + 1) {
+    return;
+  }
+  affine public_key;
+  scalar private_key;
+  sign_pending = 0;
+  get_keypair(ctx->key_index, &public_key, private_key);
+  sign_step(&ctx->sig, &public_key, private_key, ctx->msg, ctx->msg + field_bytes);
+  os_memset(private_key, 0, scalar_bytes);
+  sign_pending = 1;
+}
+
+// forgets the nonce of a rejected or interrupted signature
+void sign_discard(void) {
+  if (sign_pending) {
+    os_memset(&ctx->sig, 0, sizeof(ctx->sig));
+    sign_pending = 0;
+  }
+}
+
 // Elements of a screen are declared const, so their fields cannot be
 // modified at runtime. In other words, we can change the *contents* of
 // the text buffer, but we cannot change the *pointer* to the buffer, and
@@ -49,6 +77,7 @@ static unsigned int ui_sign_approve_button(unsigned int button_mask, unsigned in
     // Send an error code to the computer. The application on the computer
     // should recognize this code and display a "user refused to sign"
     // message instead of a generic error.
+    sign_discard();
     io_exchange_with_code(SW_USER_REJECTED, 0);
     // Return to the main screen.
     ui_idle();
@@ -58,8 +87,17 @@ static unsigned int ui_sign_approve_button(unsigned int button_mask, unsigned in
     {
     affine public_key;
     scalar private_key;
-    generate_keypair(ctx->key_index, &public_key, private_key);
-    sign(G_io_apdu_buffer, G_io_apdu_buffer + field_bytes, &public_key, private_key, ctx->msg, ctx->msg + field_bytes);
+    get_keypair(ctx->key_index, &public_key, private_key);
+    if (!sign_pending) {
+      sign_start(&ctx->sig);
+      sign_pending = 1;
+    }
+    // whatever the ticker did not get to
+    while (!sign_step(&ctx->sig, &public_key, private_key, ctx->msg, ctx->msg + field_bytes)) {
+    }
+    sign_finish(G_io_apdu_buffer, G_io_apdu_buffer + field_bytes, &ctx->sig, private_key);
+    os_memset(private_key, 0, scalar_bytes);
+    sign_discard();
     // Send the data in the APDU buffer, along with a special code that
     // indicates approval. 192 is the number of bytes in the response APDU,
     // sans response code. The Ledger can only handle sending less than 260
@@ -149,11 +187,21 @@ static unsigned int ui_sign_compare_button(unsigned int button_mask, unsigned in
 }
 
 void handle_sign(uint8_t p1, uint8_t p2, uint8_t *data_buffer, uint16_t data_length, volatile unsigned int *flags, volatile unsigned int *tx) {
+  batch_clear();
+  if (data_length < 4 + 2 * field_bytes) {
+    THROW(SW_INVALID_PARAM);
+  }
+
   // Read the index of the signing key. U4LE is a helper macro for
   // converting a 4-byte buffer to a uint32_t.
   ctx->key_index = U4LE(data_buffer, 0);
   os_memmove(ctx->msg, data_buffer+4, sizeof(ctx->msg));
 
+  // Start on the signature right away, sign_tick advances it while the
+  // user reads the message.
+  sign_start(&ctx->sig);
+  sign_pending = 1;
+
   // Prepare to display the comparison screen by converting the msg to hex
   // and moving the first 12 characters into the partial_msg_str buffer.
   bin2hex(ctx->hex_msg, ctx->msg, sizeof(ctx->msg));
@@ -22,6 +22,9 @@
  * THE SOFTWARE.
  */
 
+#include "poseidon.h"
+#include "decimal.h"
+
 // exception codes
 #define SW_DEVELOPER_ERR 0x6B00
 #define SW_INVALID_PARAM 0x6B01
@@ -63,19 +66,35 @@ typedef enum {
 
 #define CVAL_LEN 128
 
+// currency values are at most 18 bytes, three limbs; to_tag is what a batch
+// tells recipients apart by
+#define cur_limbs 3
+#define tag_bytes 16
+
+// the most data an APDU carries either way, IO_APDU_BUFFER_SIZE (see the
+// Makefile) less the 7 byte header of an extended APDU
+#define apdu_data_max (IO_APDU_BUFFER_SIZE - 7)
+
+// txn_elem_max is the size of the largest transaction element, a public key.
+// poseidon absorbs two scalars from the start of the signed element, so the
+// carry-over area must hold at least that much as well.
+#define txn_elem_max group_bytes
+
 // txn_state is a helper object for computing the hash of a streamed
 // transaction.
 typedef struct {
-  uint8_t buf[510];           // holds raw tx bytes; large enough for two 0xFF reads
-  uint16_t buf_len;           // number of valid bytes in buf
-  uint16_t pos;               // mid-decode offset; reset to 0 after each elem
+  const uint8_t *in;          // unconsumed part of the current APDU payload
+  uint16_t in_len;            // number of bytes at in
+  uint8_t carry[txn_elem_max]; // start of an element that straddles two APDUs
+  uint16_t carry_len;         // number of bytes in carry; they precede in
+  uint16_t pos;               // mid-decode offset into the element; reset to 0 after each elem
 
   txn_elem_type_e elem_type;  // type of most-recently-seen element
   uint64_t slice_len;         // most-recently-seen slice length prefix
   uint16_t slice_index;       // offset within current element slice
 
   uint16_t sig_index;         // index of TxnSig being computed
-  scalar hash_state[3];       // buffer to hold intermediate hash state
+  poseidon_sponge hash_state; // intermediate hash state, packed internal form
   scalar hash;                // buffer to hold final hash
 
   uint8_t del;                // is delegation : 1 = true, 0 = false
@@ -85,14 +104,22 @@ typedef struct {
   uint8_t fee_val[CVAL_LEN];  // currency value, in decimal
   uint32_t key_index;         // 'from' public key
   scalar out_key;             // 'to' public key
+  uint64_t val_nat[cur_limbs]; // value of the most recent currency element
+  uint8_t to_tag[tag_bytes];  // truncated sha256 of the most recent 'to' key
 } txn_state;
 
 // txn_init initializes a transaction decoder, preparing it to calculate the
 // requested hash.
 void txn_init(txn_state *txn, uint16_t sig_index);
 
-// txn_update adds data to a transaction decoder.
-void txn_update(txn_state *txn, uint8_t *in, uint8_t inlen);
+// txn_update adds data to a transaction decoder. The data is decoded in place,
+// so it must stay untouched until txn_next_elem returns TXN_STATE_PARTIAL;
+// only the bytes of an unfinished element are copied out at that point.
+void txn_update(txn_state *txn, uint8_t *in, uint16_t inlen);
+
+// txn_restart prepares the decoder for the next transaction of a batch,
+// which starts in the rest of the data given to txn_update.
+void txn_restart(txn_state *txn);
 
 // txn_next_elem decodes the next element of the transaction. If the element
 // is ready for display, txn_next_elem returns TXN_STATE_READY. If more data
@@ -109,6 +136,8 @@ txn_decoder_state_e txn_next_elem(txn_state *txn);
 
 typedef struct {
   uint32_t key_index;
+  uint32_t key_count;       // INS_PUBLIC_KEYS only
+  uint8_t compressed;       // INS_PUBLIC_KEY with P1_COMPRESSED
   uint8_t display_index;
   uint8_t type_str[CSTR_LEN];
   uint8_t key_str[CSTR_LEN];
@@ -123,10 +152,16 @@ typedef struct {
   uint32_t display_index;
   uint8_t index_str[CSTR_LEN];
   uint8_t partial_msg_str[CPART_LEN];
+  sign_state sig;        // nonce and challenge, computed during review
 } signature_context;
 
-// TODO get rid of dead code :)
-// this is never used -- we dont hash messages before signing
+// a batch (INS_HASH with P2_SIGN_BATCH, see get_hash.c) returns each hash
+// with a tag. a transaction is longer than its two keys, which bounds how
+// many of them can end in one packet
+#define batch_record_bytes (scalar_bytes + tag_bytes)
+#define batch_per_reply    (apdu_data_max / (2 * txn_elem_max) + 1)
+#define batch_recipients   8
+
 typedef struct {
   uint32_t key_index;
   int sign;
@@ -138,6 +173,17 @@ typedef struct {
   uint8_t full_str[128];
   uint8_t partial_str[CPART_LEN];
   int initialized; // protects against certain attacks
+
+  // P2_SIGN_BATCH only
+  uint16_t batch_count;    // transactions announced by P1_FIRST
+  uint16_t batch_done;     // transactions hashed so far
+  uint64_t total_amount[dec_limbs];
+  uint64_t total_fee[dec_limbs];
+  uint8_t recipients[batch_recipients][tag_bytes];
+  uint8_t recipient_count; // distinct; batch_recipients + 1 means more
+  scalar pending[batch_per_reply]; // hashes not yet returned to the host
+  uint8_t pending_count;
+  uint8_t summary_index;   // summary screen being shown
 } hash_context;
 
 // To save memory, we store all the context types in a single global union,
@@ -152,4 +198,6 @@ extern command_context global;
 void ui_idle(void);
 void io_exchange_with_code(uint16_t code, uint16_t tx);
 void bin2hex(uint8_t *dst, uint8_t *data, uint64_t inlen);
-int bin2dec(uint8_t *dst, uint64_t n);
+void sign_tick(void);
+void sign_discard(void);
+void batch_clear(void);
@@ -1,7 +1,7 @@
 from ledgerblue.comm import getDongle
 from ledgerblue.commException import CommException
 import argparse, sys, struct, os, hashlib, json
-from codaledgercli import decode, schnorr
+from codaledgercli import decode, schnorr, verify
 
 # ledger functions
 
@@ -11,33 +11,90 @@ def get_version(dongle):
     apdu += b'\x00' # P1 byte
     apdu += b'\x00' # P2 byte
     apdu += b'\x00' # LC byte
-    apdu += b'\x00' # DATA byte
     v = dongle.exchange(apdu)
     print( "v" + str(v[0]) + '.' + str(v[1]) + '.' + str(v[2]) )
     return
 
+# with libcoda.so to expand it, the device replies with the compressed key,
+# half the size of x || y, and with x || y otherwise
 def get_publickey(pkno, dongle):
     apdu = b'\xE0'  # CLA byte
     apdu += b'\x02' # INS byte
-    apdu += b'\x00' # P1 byte
+    apdu += b'\x01' if verify.available() else b'\x00' # P1 byte: compressed reply
     apdu += b'\x00' # P2 byte
-    apdu += b'\x00' # LC byte
+    apdu += b'\x04' # LC byte
     apdu += struct.pack('<I', int(pkno)) # DATA bytes
     pubkey = dongle.exchange(apdu)
     decode.handle_pk_reply(pubkey)
     return
 
-# we should have the message stored so we can verify the signature?
-def get_transaction(pkno, txn, dongle):
+# keys a to b - 1 for a range a:b, with a single approval on the device. the
+# first reply comes once the user approves, the rest of the range is asked
+# for with P1 = 0x01, each reply holding as many compressed keys as fit
+def get_publickeys(keyrange, dongle):
+    first, end = (int(i) for i in keyrange.split(':'))
+    apdu = b'\xE0'  # CLA byte
+    apdu += b'\x10' # INS byte
+    apdu += b'\x00' # P1 byte
+    apdu += b'\x00' # P2 byte
+    apdu += b'\x08' # LC byte
+    apdu += struct.pack('<II', first, end - first) # DATA bytes
+    pks = decode.split_compressed(dongle.exchange(apdu))
+    while len(pks) < end - first:
+        apdu = b'\xE0\x10\x01\x00\x00'
+        pks += decode.split_compressed(dongle.exchange(apdu))
+    decode.handle_pks_reply(first, pks)
+    return
+
+# with a public key given, every signature the device returns is checked
+# with schnorr_verify before it is printed, so a bad one never gets sent on
+def check_signature(pk, msgx, msgm, reply):
+    if pk is None:
+        return True
+    if verify.schnorr_verify(msgx, msgm, decode.pk_json_to_bytes(pk), reply):
+        return True
+    report_error('sign', 'Invalid_signature')
+    return False
+
+def get_transaction(pkno, txn, pk, dongle):
     apdu = decode.handle_txn_input(pkno, txn)
     reply = dongle.exchange(apdu)
-    decode.handle_txn_reply(reply)
+    msgx, msgm = decode.txn_to_msg(txn)
+    if check_signature(pk, msgx, msgm, reply):
+        decode.handle_txn_reply(reply)
     return
 
-def get_transaction_from_ints(pkno, msgx, msgm, dongle):
+def get_transaction_from_ints(pkno, msgx, msgm, pk, dongle):
     apdu = decode.handle_ints_input(pkno, msgx, msgm)
     reply = dongle.exchange(apdu)
-    decode.handle_txn_reply(reply)
+    msgx, msgm = decode.ints_to_msg(msgx, msgm)
+    if check_signature(pk, msgx, msgm, reply):
+        decode.handle_txn_reply(reply)
+    return
+
+# signs the transactions in a file, one serialized transaction in hex a line,
+# with a single approval on the device. the hashes come back with tags as the
+# transactions stream in, and are sent back to be signed once approved
+def sign_batch(pkno, path, dongle):
+    with open(path) as f:
+        txns = [bytes.fromhex(line.strip()) for line in f if line.strip()]
+    records = []
+    for apdu in decode.batch_input(pkno, txns):
+        records += decode.split_records(dongle.exchange(apdu))
+    sigs = b''
+    for i in range(0, len(records), decode.batch_per_sign):
+        apdu = decode.batch_sign_input(records[i:i + decode.batch_per_sign])
+        sigs += bytes(dongle.exchange(apdu))
+    decode.handle_batch_reply(sigs)
+    return
+
+# checks a signature printed by a sign request, without the device
+def verify_signature(pk, sig, msgx, msgm):
+    if verify.schnorr_verify(msgx, msgm, decode.pk_json_to_bytes(pk),
+            decode.sig_json_to_bytes(sig)):
+        print(json.dumps({'status': 'Ok'}))
+    else:
+        print(json.dumps({'status': 'Invalid_signature'}))
     return
 
 def report_error(req, err):
@@ -51,28 +108,48 @@ def main():
     try:
         parser = argparse.ArgumentParser(description='Get public keys and signatures from Ledger device.')
         parser.add_argument('--request',
-                help='publickey or sign (for signing a transaction)')
+                help='publickey, publickeys, sign (for signing a transaction), batch or verify')
         parser.add_argument('--nonce',
                 help='the nonce with which to derive the keys')
+        parser.add_argument('--range',
+                help='a:b, the keys a to b - 1 for --request=publickeys')
         parser.add_argument('--msgx',
                 help='the x coordinate of the reciever pk')
         parser.add_argument('--msgm',
                 help='the remaining transaction information to be signed')
         parser.add_argument('--transaction',
                 help='the transaction to sign (in JSON)')
+        parser.add_argument('--transactions',
+                help='a file of serialized transactions in hex, one a line, for --request=batch')
+        parser.add_argument('--publickey',
+                help='the public key (as printed by --request=publickey) to check signatures against')
+        parser.add_argument('--signature',
+                help='the signature (as printed by --request=sign) to check, for --request=verify')
 
         args = parser.parse_args()
 
+        if args.request == 'verify':
+            if args.transaction is not None:
+                msgx, msgm = decode.txn_to_msg(args.transaction)
+            else:
+                msgx, msgm = decode.ints_to_msg(args.msgx, args.msgm)
+            verify_signature(args.publickey, args.signature, msgx, msgm)
+            return
+
         dongle = getDongle(False)
 
         if args.request == 'version':
             get_version(dongle)
         elif args.request == 'publickey':
             get_publickey(args.nonce, dongle)
+        elif args.request == 'publickeys':
+            get_publickeys(args.range, dongle)
         elif args.request == 'transaction':
-            get_transaction(args.nonce, args.transaction, dongle)
+            get_transaction(args.nonce, args.transaction, args.publickey, dongle)
+        elif args.request == 'batch':
+            sign_batch(args.nonce, args.transactions, dongle)
         elif args.request == 'sign':
-            get_transaction_from_ints(args.nonce, args.msgx, args.msgm, dongle)
+            get_transaction_from_ints(args.nonce, args.msgx, args.msgm, args.publickey, dongle)
         else:
             report_error(args.request, 'Computation_aborted')
 
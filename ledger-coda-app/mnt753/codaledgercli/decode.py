@@ -1,5 +1,5 @@
 import hashlib, struct, sys, base58, json, binascii
-from codaledgercli import schnorr
+from codaledgercli import schnorr, verify
 
 # whole version byte tables for coda
 value_to_version_byte = {
@@ -111,27 +111,35 @@ def json_to_transaction(txn):
 # INS_PUBLIC_KEY    0x02
 # INS_SIGN          0x04
 # INS_HASH          0x08
+# INS_PUBLIC_KEYS   0x10
 
-def handle_txn_input(pkno, txn):
+# msgx and msgm as the device gets them, for signing and for verification
+def txn_to_msg(txn):
     to, msg = json_to_transaction(txn)
+    return struct.pack("<96s", to), struct.pack("<96s", msg)
+
+def ints_to_msg(msgx, msgm):
+    return int(msgx).to_bytes(96, byteorder='big'), int(msgm).to_bytes(96, byteorder='big')
+
+def handle_txn_input(pkno, txn):
+    to, msg = txn_to_msg(txn)
     apdu = b'\xE0'  # CLA byte
     apdu += b'\x04' # INS byte
     apdu += b'\x00' # P1 byte
     apdu += b'\x00' # P2 byte
-    apdu += b'\x00' # LC byte
+    apdu += struct.pack('B', 4 + 2 * 96) # LC byte
     apdu += struct.pack('<I', int(pkno)) # DATA bytes
     apdu += struct.pack("<96s", to)
     apdu += struct.pack("<96s", msg)
     return apdu
 
 def handle_ints_input(pkno, msgx, msgm):
-    to = int(msgx).to_bytes(96, byteorder='big')
-    msg = int(msgm).to_bytes(96, byteorder='big')
+    to, msg = ints_to_msg(msgx, msgm)
     apdu = b'\xE0'  # CLA byte
     apdu += b'\x04' # INS byte
     apdu += b'\x00' # P1 byte
     apdu += b'\x00' # P2 byte
-    apdu += b'\x00' # LC byte
+    apdu += struct.pack('B', 4 + 2 * 96) # LC byte
     apdu += struct.pack('<I', int(pkno)) # DATA bytes
     apdu += struct.pack("<96s", to)
     apdu += struct.pack("<96s", msg)
@@ -141,8 +149,102 @@ def handle_txn_reply(reply):
     return sig_encode(reply)
 
 def handle_pk_reply(pk):
+    if len(pk) == 96 + 1:
+        pk = point_from_compressed(pk)
     return pk_encode(pk)
 
+# the JSON printed for a public key or a signature, back to the device bytes
+def pk_json_to_bytes(pk):
+    data = json.loads(pk)
+    return base58.b58decode(data['x']) + base58.b58decode(data['y'])
+
+def sig_json_to_bytes(sig):
+    data = json.loads(sig)
+    return base58.b58decode(data['field']) + base58.b58decode(data['scalar'])
+
+# affine_decompress in python, for when libcoda.so is not built
+def py_point_decompress(bs):
+    assert len(bs) == 96 + 1 and bs[0] in (2, 3)
+    x = int.from_bytes(bytes(bs[1:]), 'big')
+    ys = schnorr.prime_mod_sqrt(x * x * x + schnorr.a * x + schnorr.b)
+    if x >= schnorr.p or not ys:
+        return None
+    y = ys[0]
+    if y % 2 != bs[0] % 2:
+        y = (schnorr.p - y) % schnorr.p
+    return x.to_bytes(96, 'big') + y.to_bytes(96, 'big')
+
+# the device's compressed points: 0x02 or 0x03 for the parity of y, then x,
+# expanded to x || y by affine_decompress in the host build of the app, or in
+# python without it
+def point_from_compressed(bs):
+    if verify.available():
+        pk = verify.point_decompress(bs)
+    else:
+        pk = py_point_decompress(bs)
+    assert pk is not None
+    return pk
+
+def split_compressed(reply):
+    n = 96 + 1
+    assert len(reply) % n == 0
+    return [bytes(reply[i:i + n]) for i in range(0, len(reply), n)]
+
+def handle_pks_reply(first, pks):
+    keys = []
+    for i, pk in enumerate(pks):
+        x, y = split(point_from_compressed(pk), 'pk')
+        keys.append({'index': first + i, 'x': x, 'y': y})
+    print(json.dumps({'status': 'Ok', 'keys': keys}))
+    return
+
+# the most data the device takes in one APDU: IO_APDU_BUFFER_SIZE in the
+# Makefile, less the 7 byte header of an extended APDU
+apdu_data_max = 512
+
+# CLA INS P1 P2, then the length of the data and the data. Up to 255 bytes
+# the length is the one LC byte; past that the APDU is extended, a zero byte
+# and then the length as a big-endian u16.
+def apdu(ins, p1, p2, data=b''):
+    assert len(data) <= apdu_data_max
+    head = struct.pack('BBBB', 0xE0, ins, p1, p2)
+    if len(data) <= 255:
+        return head + struct.pack('B', len(data)) + data
+    return head + struct.pack('>BH', 0, len(data)) + data
+
+# INS_HASH with P2 = 0x03: the key index, the sig index and the number of
+# transactions, then the transactions back to back, cut into packets of
+# apdu_data_max bytes. Each reply holds hash || tag for the transactions that
+# ended in its packet, and up to batch_per_sign of those records go back in
+# each P1 = 0x40 packet to be signed once the batch is approved.
+batch_record_bytes = 96 + 16
+batch_per_sign = 2
+
+def batch_input(pkno, txns):
+    stream = struct.pack('<IHH', int(pkno), 0, len(txns)) + b''.join(txns)
+    p1 = 0x00
+    for i in range(0, len(stream), apdu_data_max):
+        yield apdu(0x08, p1, 0x03, stream[i:i + apdu_data_max])
+        p1 = 0x80
+
+def split_records(reply):
+    n = batch_record_bytes
+    assert len(reply) % n == 0
+    return [bytes(reply[i:i + n]) for i in range(0, len(reply), n)]
+
+def batch_sign_input(records):
+    return apdu(0x08, 0x40, 0x03, b''.join(records))
+
+def handle_batch_reply(sigs):
+    n = 96 + 96
+    assert len(sigs) % n == 0
+    out = []
+    for i in range(0, len(sigs), n):
+        r, s = split(sigs[i:i + n], 'sig')
+        out.append({'field': r, 'scalar': s})
+    print(json.dumps({'status': 'Ok', 'signatures': out}))
+    return
+
 def check_key(x, y):
     assert ((y*y) % schnorr.p == (x*x*x + x*schnorr.a + schnorr.b) % schnorr.p)
 
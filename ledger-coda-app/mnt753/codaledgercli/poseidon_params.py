@@ -1,3 +1,8 @@
+# rounds and s-box x^alpha, for codaledgercli and gen_tables.py
+full_rounds = 8
+partial_rounds = 33
+alpha = 11
+
 inv_alpha = 38089537243562684911222013446582397389246099927230862792530457200932138920519187975508085239809399019470973610807689524839248234083267140972451128958905814696110378477590967674064016488951271336010850653690825603837076796509091
 
 mds = [[ 18008368437737423474309001369890301521976028259557869102888851965525650962978826556079921598599098888590302388431866694591858505845787597588918688371226882207991627422083815074127761663891796146172734531991290402968541914191945,
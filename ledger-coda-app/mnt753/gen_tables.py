@@ -0,0 +1,388 @@
+#!/usr/bin/env python3
+
+"""
+Generates the constant tables of src/poseidon.c and src/crypto.c from
+codaledgercli/poseidon_params.py and the curve parameters below:
+
+ - src/poseidon_tables.h : round counts, round keys and the LU factors of
+                           the MDS matrix for the full rounds, folded round
+                           keys and sparse matrices for the partial rounds
+ - src/curve_tables.h    : moduli, curve coefficients, zero and generator
+                           (jacobian), comb table of the generator, square
+                           root constants, schnorr_hash state
+
+Every table is written packed in the montgomery form of the field
+backends, R = 2^(8 * field_bytes), so loading it is a plain copy:
+
+ - host (CODA_HOST)      : 64-bit limbs, least significant first
+                           (host/field.c)
+ - device                : big endian bytes, for cx_bn_init (cx_bn / cx_mont)
+
+Each header ends with an fnv-1a checksum of its tables, in the layout of
+either backend (host limbs in little endian memory order), which
+curve_tables_ok and poseidon_tables_ok compare with the tables as built.
+Sizes the C code also defines (field_bytes, sponge_size, comb_teeth, ...)
+are checked with #error.
+
+Run after changing the parameters:
+
+  make -C host tables
+"""
+
+import os
+from codaledgercli import poseidon_params
+
+# MNT6-753, E/Fp : y^2 = x^3 + ax + b
+p = 41898490967918953402344214791240637128170709919953949071783502921025352812571106773058893763790338921418070971888458477323173057491593855069696241854796396165721416325350064441470418137846398469611935719059908164220784476160001
+q = 41898490967918953402344214791240637128170709919953949071783502921025352812571106773058893763790338921418070971888253786114353726529584385201591605722013126468931404347949840543007986327743462853720628051692141265303114721689601
+a = 11
+b = 11625908999541321152027340224010374716841167701783584648338908235410859267060079819722747939267925389062611062156601938166010098747920378738927832658133625454260115409075816187555055859490253375704728027944315501122723426879114
+generator = (3458420969484235708806261200128850544017070333833944116801482064540723268149235477762870414664917360605949659630933184751526227993647030875167687492714052872195770088225183259051403087906158701786758441889742618916006546636728,
+             27460508402331965149626600224382137254502975979168371111640924721589127725376473514838234361114855175488242007431439074223827742813911899817930728112297763448010814764117701403540298764970469500339646563344680868495474127850569)
+
+field_bytes = 96
+full_rounds = poseidon_params.full_rounds
+partial_rounds = poseidon_params.partial_rounds
+alpha = poseidon_params.alpha
+sponge_size = len(poseidon_params.mds)
+# group_scalar_mul_base, checked against src/crypto.h
+comb_teeth = 4
+comb_tables = 4
+
+# schnorr_hash starts from the poseidon state after absorbing this salt, its
+# bytes as one little endian integer (see schnorr_state)
+salt = b'CodaSignature*******'
+
+limbs = field_bytes // 8
+R = 1 << (8 * field_bytes)
+here = os.path.dirname(os.path.abspath(__file__))
+
+
+def lu(m):
+    """ m = L U with L unit lower triangular, mod p """
+    n = len(m)
+    L = [[int(i == j) for j in range(n)] for i in range(n)]
+    U = [[0] * n for _ in range(n)]
+    for i in range(n):
+        for j in range(i, n):
+            U[i][j] = (m[i][j] - sum(L[i][k] * U[k][j] for k in range(i))) % p
+        for j in range(i + 1, n):
+            L[j][i] = (m[j][i] - sum(L[j][k] * U[k][i] for k in range(i))) \
+                * pow(U[i][i], p - 2, p) % p
+    return L, U
+
+
+def mat_mul(a, b):
+    return [[sum(x * y for x, y in zip(row, col)) % p for col in zip(*b)]
+            for row in a]
+
+
+def mat_vec(a, v):
+    return [sum(x * y for x, y in zip(row, v)) % p for row in a]
+
+
+def permutation(s, keys, M):
+    """ the textbook permutation, for checking the optimized one """
+    half = full_rounds // 2
+    for r in range(full_rounds + partial_rounds):
+        s = [(x + k) % p for x, k in zip(s, keys[r])]
+        if half <= r < half + partial_rounds:
+            s[0] = pow(s[0], alpha, p)
+        else:
+            s = [pow(x, alpha, p) for x in s]
+        s = mat_vec(M, s)
+    return s
+
+
+def partial_rounds_opt(keys, M):
+    """ the partial rounds in the form of the appendix of the poseidon paper.
+    only s[0] goes through the s-box, so the keys of s[1] and s[2] can be
+    moved through M into the next round: each partial round adds one key,
+    and the last one hands the rest to the next full round.
+
+    M is then factored as B A, B sparse (first row, first column and the
+    identity) and A = diag(1, M^) with M^ the lower right 2x2 block. A leaves
+    s[0] alone, so it commutes with the key and the s-box and moves into
+    the round before, which factors A M the same way. what is left of the
+    first partial round is pre = A^, applied once before them. returns the
+    full round keys, the partial round keys, pre and the sparse matrices
+    as [B00, B01, B02, B10, B20] """
+    half = full_rounds // 2
+    keys = [list(k) for k in keys]
+    for r in range(half, half + partial_rounds):
+        carry = mat_vec(M, [0] + keys[r][1:])
+        keys[r][1:] = [0] * (sponge_size - 1)
+        keys[r + 1] = [(x + y) % p for x, y in zip(keys[r + 1], carry)]
+
+    sparse, N = [], M
+    for _ in range(partial_rounds):
+        (a, b), (c, d) = [row[1:] for row in N[1:]]
+        det = pow(a * d - b * c, p - 2, p)
+        inv = [[d * det % p, -b * det % p], [-c * det % p, a * det % p]]
+        v = mat_vec(list(zip(*inv)), N[0][1:])     # N[0][1:] M^^-1
+        sparse.append([N[0][0]] + v + [N[1][0], N[2][0]])
+        pre = [[a, b], [c, d]]
+        N = mat_mul([[1, 0, 0], [0, a, b], [0, c, d]], M)
+    sparse.reverse()
+
+    full = keys[:half] + keys[half + partial_rounds:]
+    part = [k[0] for k in keys[half:half + partial_rounds]]
+
+    # the same permutation, on an arbitrary state
+    s0 = [3, 5, 7]
+    s = s0
+    for r in range(half):
+        s = mat_vec(M, [pow((x + k) % p, alpha, p) for x, k in zip(s, full[r])])
+    s = [s[0]] + mat_vec(pre, s[1:])
+    for r in range(partial_rounds):
+        s[0] = pow((s[0] + part[r]) % p, alpha, p)
+        m = sparse[r]
+        s = [(m[0] * s[0] + m[1] * s[1] + m[2] * s[2]) % p,
+             (m[3] * s[0] + s[1]) % p, (m[4] * s[0] + s[2]) % p]
+    for r in range(half, full_rounds):
+        s = mat_vec(M, [pow((x + k) % p, alpha, p) for x, k in zip(s, full[r])])
+    assert s == permutation(s0, keys, M)
+    return full, part, pre, sparse
+
+
+def schnorr_state():
+    rounds = full_rounds + partial_rounds
+    return permutation([int.from_bytes(salt, 'little'), 0, 0],
+                       poseidon_params.round_constants[:rounds],
+                       poseidon_params.mds)
+
+
+def point_add(P, Q):
+    """ affine addition, None is the point at infinity """
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    if P[0] == Q[0]:
+        if (P[1] + Q[1]) % p == 0:
+            return None
+        l = (3 * P[0] * P[0] + a) * pow(2 * P[1], p - 2, p) % p
+    else:
+        l = (Q[1] - P[1]) * pow(Q[0] - P[0], p - 2, p) % p
+    x = (l * l - P[0] - Q[0]) % p
+    return (x, (l * (P[0] - x) - P[1]) % p)
+
+
+def point_mul(k, P):
+    R = None
+    while k:
+        if k & 1:
+            R = point_add(R, P)
+        P = point_add(P, P)
+        k >>= 1
+    return R
+
+
+def comb():
+    """ comb[t][j] = sum of +-2^(spacing * (comb_teeth * t + i)) G, with
+    the top tooth positive and tooth i < comb_teeth - 1 positive when bit i
+    of j is set, spacing = scalar_bits / (comb_teeth * comb_tables). the
+    teeth of the other sign are the negated entries """
+    spacing = 8 * field_bytes // (comb_teeth * comb_tables)
+    tables = []
+    for t in range(comb_tables):
+        teeth = [2**(spacing * (comb_teeth * t + i)) for i in range(comb_teeth)]
+        row = []
+        for j in range(2**(comb_teeth - 1)):
+            k = teeth[-1] + sum(teeth[i] if j >> i & 1 else -teeth[i]
+                                for i in range(comb_teeth - 1))
+            row.append(list(point_mul(k % q, generator)))
+        tables.append(row)
+    return tables
+
+
+def sqrt_constants():
+    """ p - 1 = 2^s t with t odd and c = z^t for the first non residue z,
+    for the tonelli-shanks square root of group_lift_x """
+    s, t = 0, p - 1
+    while t % 2 == 0:
+        s, t = s + 1, t // 2
+    z = next(z for z in range(2, 100) if pow(z, (p - 1) // 2, p) == p - 1)
+    return s, t, pow(z, t, p)
+
+
+def host(x):
+    x = x * R % p
+    return [(x >> (64 * i)) & (2**64 - 1) for i in range(limbs)]
+
+
+def device(x):
+    return list((x * R % p).to_bytes(field_bytes, 'big'))
+
+
+def words(x, form):
+    """ one field element as lines of C literals """
+    if form == 'host':
+        w, fmt, per_line = host(x), '0x%016x', 3
+    else:
+        w, fmt, per_line = device(x), '0x%02x', 12
+    return [', '.join(fmt % v for v in w[i:i + per_line])
+            for i in range(0, len(w), per_line)]
+
+
+def initializer(v, form, col):
+    """ v is a field element or a (nested) list of them, col is the column
+    of the opening brace """
+    if isinstance(v, int):
+        return '{' + (',\n' + ' ' * (col + 1)).join(words(v, form)) + '}'
+    return '{' + (',\n' + ' ' * (col + 1)).join(
+        initializer(x, form, col + 1) for x in v) + '}'
+
+
+FNV_BASIS, FNV_PRIME = 0x811c9dc5, 0x01000193
+# per header: the tables in order, with the backends they are built for,
+# and the running checksum of each backend
+checked, sums = [], {}
+
+
+def fnv(h, data):
+    for x in data:
+        h = (h ^ x) * FNV_PRIME & 0xffffffff
+    return h
+
+
+def flatten(v):
+    return [v] if isinstance(v, int) else [x for y in v for x in flatten(y)]
+
+
+def account(decl, forms, v, canonical=False):
+    """ adds the table to the checksums of forms, in memory order """
+    checked.append((decl.split()[1].split('[')[0], forms))
+    for form in forms:
+        for x in flatten(v):
+            if canonical:
+                data = x.to_bytes(field_bytes, 'big')
+            elif form == 'host':
+                data = b''.join(w.to_bytes(8, 'little') for w in host(x))
+            else:
+                data = bytes(device(x))
+            sums[form] = fnv(sums.get(form, FNV_BASIS), data)
+
+
+def constant(decl, x, forms=('host', 'device')):
+    """ canonical bytes, the same in both backends """
+    account(decl, forms, x, canonical=True)
+    w = list(x.to_bytes(field_bytes, 'big'))
+    init = ',\n    '.join(', '.join('0x%02x' % v for v in w[i:i + 12])
+                          for i in range(0, len(w), 12))
+    return 'static const %s = {\n    %s};\n' % (decl, init)
+
+
+def raw(decl, x):
+    """ a device only constant, canonical bytes """
+    return '#if !defined(CODA_HOST)\n%s#endif\n\n' % constant(decl, x,
+                                                               ('device',))
+
+
+def table(decl, v):
+    account(decl, ('host', 'device'), v)
+    out = ''
+    for cond, form in (('#if defined(CODA_HOST)', 'host'), ('#else', 'device')):
+        if isinstance(v, int):
+            init = '\n    ' + ',\n    '.join(words(v, form))
+        else:
+            init = '\n    ' + ',\n    '.join(initializer(x, form, 4)
+                                              for x in v)
+        out += '%s\nstatic const %s = {%s};\n' % (cond, decl, init)
+    return out + '#endif\n\n'
+
+
+def sync(name, value):
+    """ a size the C code defines as well """
+    return '#if %s != %d\n#error "%s differs from gen_tables.py"\n#endif\n' \
+        % (name, value, name)
+
+
+def checksum(prefix):
+    """ the checksums of the tables written so far and the function that
+    recomputes them, for <prefix>_tables_ok """
+    out = '// fnv-1a of the tables above, as built, see %s_tables_ok\n' % prefix
+    out += '#if defined(CODA_HOST)\n#define %s_tables_checksum 0x%08x\n' \
+        % (prefix, sums['host'])
+    out += '#else\n#define %s_tables_checksum 0x%08x\n#endif\n\n' \
+        % (prefix, sums['device'])
+    out += 'static inline unsigned int %s_tables_sum(void) {\n' % prefix
+    out += '  unsigned int h = tables_checksum_init;\n'
+    for name, forms in checked:
+        line = '  h = tables_checksum(h, &%s, sizeof(%s));\n' % (name, name)
+        if forms == ('device',):
+            line = '#if !defined(CODA_HOST)\n%s#endif\n' % line
+        out += line
+    out += '  return h;\n}\n\n'
+    del checked[:]
+    sums.clear()
+    return out
+
+
+def write(name, guard, includes, body):
+    with open(os.path.join(here, 'src', name), 'w') as f:
+        f.write('// generated by gen_tables.py, do not edit\n\n')
+        f.write('#ifndef %s\n#define %s\n\n' % (guard, guard))
+        for i in includes:
+            f.write('#include "%s"\n' % i)
+        f.write('\n' + body)
+        f.write('#endif // %s\n' % guard)
+
+
+def main():
+    rounds = full_rounds + partial_rounds
+    L, U = lu(poseidon_params.mds)
+
+    full, part, pre, sparse = partial_rounds_opt(
+        poseidon_params.round_constants[:rounds], poseidon_params.mds)
+
+    body = '// round counts and s-box of codaledgercli/poseidon_params.py\n'
+    body += '#define full_rounds %d\n' % full_rounds
+    body += '#define partial_rounds %d\n' % partial_rounds
+    body += '#define rounds (full_rounds + partial_rounds)\n'
+    body += '#define poseidon_alpha %d\n\n' % alpha
+    body += sync('sponge_size', sponge_size) + '\n'
+    body += table('fe_packed full_round_keys[full_rounds][sponge_size]', full)
+    body += table('fe_packed MDS_U[sponge_size][sponge_size]', U)
+    body += table('fe_packed MDS_L[sponge_size][sponge_size]', L)
+    body += '// partial rounds, see partial_rounds_opt\n'
+    body += table('fe_packed partial_round_keys[partial_rounds]', part)
+    body += table('fe_packed MDS_pre[sponge_size - 1][sponge_size - 1]', pre)
+    body += table('fe_packed MDS_sparse[partial_rounds][2 * sponge_size - 1]',
+                  sparse)
+    body += checksum('poseidon')
+    write('poseidon_tables.h', 'POSEIDON_TABLES', ['crypto.h', 'poseidon.h'],
+          body)
+
+    body = ''.join(sync(n, v) for n, v in (('field_bytes', field_bytes), ('comb_teeth', comb_teeth),
+                        ('comb_tables', comb_tables)))
+    body += '\n'
+    body += constant('field field_modulus', p)
+    body += constant('scalar group_order', q)
+    body += '\n'
+    body += '// R^2 mod p, for cx_mont_init2\n'
+    body += raw('field field_r2', R * R % p)
+    body += table('fe_packed field_one', 1)
+    body += table('fe_packed group_coeff_a', a)
+    body += table('fe_packed group_coeff_b', b)
+    body += '// (X : Y : Z) = (0 : 1 : 0)\n'
+    body += table('group_packed group_zero', [0, 1, 0])
+    body += table('group_packed group_one', [generator[0], generator[1], 1])
+    body += table('affine_packed group_comb[comb_tables][1 << (comb_teeth - 1)]',
+                  comb())
+    s, t, c = sqrt_constants()
+    body += '// group_lift_x: p - 1 = 2^field_two_adicity t with t odd, c = z^t for\n' \
+        '// a non residue z, roots[j] = c^(2^j), and e = (t - 1) / 2\n'
+    body += '#define field_two_adicity %d\n\n' % s
+    body += table('fe_packed field_sqrt_roots[field_two_adicity]',
+                  [pow(c, 2**j, p) for j in range(s)])
+    body += constant('field field_sqrt_e', (t - 1) // 2)
+    body += '\n'
+    body += table('fe_packed schnorr_state[sponge_size]', schnorr_state())
+    body += checksum('curve')
+    write('curve_tables.h', 'CURVE_TABLES', ['crypto.h',
+                                             'poseidon.h'], body)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,320 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "os.h"
+#include "crypto.h"
+#include "poseidon.h"
+#include "curve_tables.h"
+
+/* Host benchmark for the signing path. Before timing anything it checks
+ * generate_pubkey and sign against a known answer computed with an
+ * independent python model of the scheme, so a broken backend can't
+ * produce good looking numbers.
+ *
+ *   ./bench        known answer test, then timings
+ *   ./bench -k     known answer test only
+ */
+
+// known answer, from the python model
+
+static const scalar kat_priv_key = {
+    0x00, 0x01, 0x0c, 0xd4, 0xa4, 0x0b, 0x91, 0x58, 0x2d, 0xa0, 0xb2, 0x00,
+    0x82, 0xfb, 0x9f, 0xad, 0xa2, 0x49, 0x77, 0x33, 0x47, 0x57, 0xd4, 0xbc,
+    0x70, 0x48, 0x0c, 0x58, 0x50, 0x2b, 0x3f, 0xd5, 0x75, 0x01, 0x79, 0x05,
+    0xdd, 0x72, 0x26, 0xb6, 0x1d, 0x3c, 0x43, 0x34, 0x7c, 0x99, 0x7b, 0x8a,
+    0x1e, 0xa3, 0xf7, 0x3c, 0xac, 0xf8, 0x72, 0x94, 0xa1, 0x27, 0xfd, 0xff,
+    0x08, 0xf4, 0x4e, 0xa7, 0x6b, 0x10, 0x81, 0xae, 0x47, 0x3f, 0x08, 0x02,
+    0x32, 0x0a, 0x70, 0x36, 0x37, 0xc3, 0xf8, 0x92, 0x86, 0xc4, 0x42, 0x17,
+    0x18, 0xbd, 0x0e, 0x9e, 0x9c, 0xd8, 0x56, 0x84, 0xf5, 0x01, 0xe8, 0x83};
+
+static const scalar kat_msgx = {
+    0x00, 0x01, 0x7c, 0x3e, 0x3d, 0xf3, 0xa6, 0xa9, 0xec, 0xdc, 0x48, 0xa5,
+    0xa0, 0x23, 0x72, 0x56, 0x31, 0x13, 0xdb, 0x11, 0x4e, 0xd0, 0x6e, 0x9c,
+    0x69, 0x8c, 0xe1, 0xf4, 0x22, 0x2d, 0x5a, 0x6a, 0x80, 0xcc, 0xfd, 0xc1,
+    0xf9, 0x5c, 0xbc, 0x9e, 0x13, 0x4c, 0x21, 0xc6, 0xa5, 0x7e, 0x73, 0x5d,
+    0xde, 0xb2, 0x71, 0xfc, 0x5c, 0x4b, 0x20, 0x8a, 0x70, 0x49, 0xc2, 0xb6,
+    0x3f, 0x49, 0x10, 0xb6, 0x0e, 0x86, 0xb6, 0x6e, 0x55, 0xb5, 0x33, 0x09,
+    0xd7, 0xbd, 0xa5, 0x78, 0x58, 0x94, 0xea, 0x4d, 0x71, 0xe3, 0x14, 0x16,
+    0x8c, 0xc9, 0xb8, 0x99, 0xc8, 0x25, 0x94, 0xcc, 0x91, 0x11, 0xe7, 0xfe};
+
+static const scalar kat_msgm = {
+    0x00, 0x01, 0xa4, 0x42, 0x12, 0xbe, 0xb3, 0x73, 0xc4, 0xbe, 0xe3, 0xb2,
+    0xe5, 0x01, 0xc3, 0x62, 0x22, 0xee, 0x7a, 0xb2, 0xc2, 0x7c, 0x97, 0x3b,
+    0xd3, 0xa1, 0x84, 0xec, 0xca, 0x83, 0x7e, 0x0a, 0x98, 0x34, 0x12, 0x7c,
+    0x35, 0xdd, 0x6f, 0x6f, 0xd8, 0xbd, 0x10, 0x01, 0xe1, 0x2d, 0x4b, 0xf7,
+    0x97, 0xfc, 0x33, 0x87, 0xf2, 0x39, 0x03, 0x62, 0x8a, 0x42, 0x38, 0xb8,
+    0x2f, 0xa0, 0xf6, 0xdf, 0x17, 0x35, 0xbd, 0xc0, 0x68, 0x10, 0xb3, 0x71,
+    0x8f, 0xb4, 0x24, 0x67, 0xbb, 0x33, 0xa9, 0x4f, 0x7d, 0x18, 0x6d, 0x4d,
+    0x7c, 0x4d, 0x4b, 0xae, 0x33, 0xa8, 0x8a, 0xc1, 0xfa, 0x9d, 0xc7, 0x6d};
+
+static const field kat_pub_x = {
+    0x00, 0x00, 0x3b, 0x50, 0xda, 0xbc, 0x2b, 0xe9, 0xe8, 0xd9, 0x17, 0xd9,
+    0x9d, 0xc9, 0x5d, 0xf1, 0x46, 0x92, 0x1c, 0x0f, 0x26, 0xdb, 0xaa, 0x01,
+    0x15, 0xe7, 0xc2, 0x5a, 0xae, 0xdc, 0x48, 0x7d, 0x85, 0x05, 0xa5, 0x8a,
+    0xb0, 0x3c, 0xd4, 0xac, 0x4a, 0x89, 0x31, 0xf8, 0xdd, 0xa1, 0x89, 0xdf,
+    0x16, 0x26, 0x05, 0x88, 0x34, 0x8a, 0xc8, 0x18, 0x25, 0x13, 0xd3, 0x07,
+    0xec, 0x23, 0x9e, 0x3b, 0xad, 0x1a, 0x43, 0xed, 0xeb, 0xeb, 0x94, 0x92,
+    0xf2, 0xe2, 0xef, 0xd2, 0x12, 0xf8, 0x51, 0x37, 0xe8, 0xec, 0x44, 0x12,
+    0x28, 0xe9, 0x91, 0xc8, 0xed, 0x55, 0x1e, 0x28, 0x00, 0xa2, 0x94, 0xf2};
+
+static const field kat_pub_y = {
+    0x00, 0x01, 0xaf, 0x3c, 0x11, 0xd5, 0x06, 0x16, 0xc1, 0x84, 0x4a, 0xf3,
+    0x75, 0xe5, 0xd4, 0x43, 0x62, 0x86, 0x7e, 0x1e, 0x58, 0x2b, 0x4e, 0x19,
+    0x31, 0x29, 0x93, 0x79, 0x64, 0xf2, 0x0b, 0xad, 0x5f, 0xf7, 0x53, 0xaf,
+    0x37, 0x02, 0xd4, 0xaf, 0x7e, 0xc6, 0x56, 0xf9, 0x7e, 0x37, 0x6d, 0x30,
+    0xea, 0x39, 0x0e, 0x60, 0x2d, 0x1f, 0x3c, 0x53, 0x08, 0xae, 0x08, 0x1b,
+    0x75, 0xe5, 0x71, 0x11, 0x48, 0xc0, 0x73, 0x39, 0x1a, 0xbb, 0xc4, 0x0e,
+    0x2b, 0x2b, 0xc6, 0x2d, 0x67, 0x4c, 0xf4, 0x87, 0x75, 0x93, 0x94, 0xa6,
+    0x6e, 0x4b, 0xd5, 0x15, 0x3e, 0x4c, 0x11, 0x2e, 0x52, 0x8a, 0x8c, 0xd2};
+
+static const field kat_rx = {
+    0x00, 0x01, 0x82, 0x70, 0x50, 0xe1, 0x5d, 0xea, 0x89, 0xa0, 0x85, 0x45,
+    0xa6, 0x69, 0xbb, 0xff, 0x1f, 0xe1, 0x4c, 0x26, 0xe4, 0xdc, 0xa2, 0x4c,
+    0x5d, 0x74, 0x23, 0x32, 0x12, 0x22, 0x82, 0x51, 0xcf, 0x65, 0xd3, 0x5b,
+    0xdc, 0x2c, 0x5f, 0x45, 0xdf, 0xdc, 0xcf, 0x60, 0x67, 0xb3, 0x6e, 0xca,
+    0x02, 0xfa, 0xa5, 0xa9, 0x43, 0x8e, 0xa6, 0x2f, 0xa0, 0x24, 0xf9, 0x2d,
+    0x77, 0xd1, 0x88, 0x28, 0xa1, 0x0f, 0x6c, 0x60, 0x53, 0xd1, 0x2a, 0xa4,
+    0x0f, 0x6f, 0x3e, 0x49, 0x18, 0x0d, 0x1d, 0xa8, 0x8b, 0x91, 0x76, 0xb5,
+    0x50, 0x22, 0x9a, 0x89, 0x99, 0xcc, 0x00, 0x5b, 0xfb, 0x15, 0x3d, 0x65};
+
+static const scalar kat_s = {
+    0x00, 0x00, 0x9a, 0xcf, 0x7f, 0x49, 0xb1, 0x77, 0xb3, 0x55, 0x14, 0x46,
+    0xb7, 0xbc, 0xb7, 0xf8, 0xcc, 0x90, 0xbb, 0xee, 0x69, 0x5d, 0x20, 0xde,
+    0x8a, 0x28, 0x18, 0xcd, 0x6a, 0x06, 0xff, 0xf6, 0x9c, 0x0c, 0xce, 0x4a,
+    0xa1, 0x4d, 0xc9, 0x3a, 0xf5, 0x15, 0x8d, 0x08, 0xca, 0x76, 0x78, 0x9c,
+    0xce, 0x31, 0x74, 0x3d, 0x01, 0x62, 0xca, 0xaf, 0x12, 0xaf, 0xf3, 0xd9,
+    0xeb, 0x20, 0x9d, 0x80, 0x5c, 0x25, 0xd8, 0x3e, 0xde, 0x42, 0x94, 0x9d,
+    0x35, 0x15, 0x37, 0xfb, 0x01, 0xe8, 0x9d, 0x89, 0x9e, 0x3c, 0x33, 0x94,
+    0xc2, 0xc6, 0x2d, 0x7c, 0xec, 0x9d, 0x75, 0xd9, 0xb9, 0x21, 0x53, 0x31};
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// runs stmt until at least 0.5s have passed and prints the time per call,
+// or per item for a stmt that handles items of them
+#define BENCH_N(name, items, stmt)                                             \
+  do {                                                                         \
+    unsigned long n = 0;                                                       \
+    double t0 = now(), t1;                                                     \
+    do {                                                                       \
+      stmt;                                                                    \
+      n++;                                                                     \
+    } while ((t1 = now()) - t0 < 0.5);                                         \
+    printf("%-24s %12.3f us\n", name, (t1 - t0) * 1e6 / (n * (items)));     \
+  } while (0)
+
+#define BENCH(name, stmt) BENCH_N(name, 1, stmt)
+
+// signatures of the kat key on batch_size variants of the kat message
+#define batch_size 64
+static message batch_msgs[batch_size];
+static affine batch_pks[batch_size];
+static signature batch_sigs[batch_size];
+
+static void batch_sign(const affine *pub_key) {
+  for (unsigned int i = 0; i < batch_size; i++) {
+    memcpy(batch_msgs[i].x, kat_msgx, scalar_bytes);
+    memcpy(batch_msgs[i].m, kat_msgm, scalar_bytes);
+    batch_msgs[i].m[scalar_bytes - 1] ^= i;
+    batch_pks[i] = *pub_key;
+    sign(batch_sigs[i].rx, batch_sigs[i].s, pub_key, kat_priv_key,
+         batch_msgs[i].x, batch_msgs[i].m);
+  }
+}
+
+static unsigned int check(const char *name, const unsigned char *got,
+                          const unsigned char *want) {
+  if (memcmp(got, want, field_bytes) != 0) {
+    printf("%s: mismatch\n", name);
+    return 0;
+  }
+  return 1;
+}
+
+static unsigned int known_answer(void) {
+  affine pub_key;
+  field rx;
+  scalar s;
+  unsigned int ok = 1;
+
+  if (!curve_tables_ok() || !poseidon_tables_ok()) {
+    printf("tables: checksum mismatch\n");
+    ok = 0;
+  }
+
+  generate_pubkey(&pub_key, kat_priv_key);
+  ok &= check("pub_key.x", pub_key.x, kat_pub_x);
+  ok &= check("pub_key.y", pub_key.y, kat_pub_y);
+
+  // the top scalar_offset bits of a key are not used, so setting them in the
+  // kat key, whose top bits are clear, gives the same public key
+  scalar high_key;
+  memcpy(high_key, kat_priv_key, scalar_bytes);
+  for (unsigned int i = 0; i < scalar_offset; i++) {
+    high_key[i / 8] |= 0x80 >> (i % 8);
+  }
+  generate_pubkey(&pub_key, high_key);
+  ok &= check("pub_key.x, top bits set", pub_key.x, kat_pub_x);
+  ok &= check("pub_key.y, top bits set", pub_key.y, kat_pub_y);
+  generate_pubkey(&pub_key, kat_priv_key);
+
+  sign(rx, s, &pub_key, kat_priv_key, kat_msgx, kat_msgm);
+  ok &= check("signature.rx", rx, kat_rx);
+  ok &= check("signature.s", s, kat_s);
+  if (!schnorr_verify(rx, s, &pub_key, kat_msgx, kat_msgm)) {
+    printf("schnorr_verify: rejected\n");
+    ok = 0;
+  }
+  s[scalar_bytes - 1] ^= 1;
+  if (schnorr_verify(rx, s, &pub_key, kat_msgx, kat_msgm)) {
+    printf("schnorr_verify: accepted a bad signature\n");
+    ok = 0;
+  }
+
+  // a batch with two bad signatures, which the bisection has to find
+  unsigned char valid[batch_size];
+  batch_sign(&pub_key);
+  batch_sigs[3].s[scalar_bytes - 1] ^= 1;
+  batch_msgs[40].x[scalar_bytes - 1] ^= 1;
+  schnorr_batch_verify(batch_size, batch_msgs, batch_pks, batch_sigs, valid);
+  for (unsigned int i = 0; i < batch_size; i++) {
+    if (valid[i] != (i != 3 && i != 40)) {
+      printf("schnorr_batch_verify: wrong answer for %u\n", i);
+      ok = 0;
+    }
+  }
+
+  // both parities, the key and its negation, through the compressed form
+  unsigned char packed[compressed_bytes];
+  affine q;
+  for (unsigned int neg = 0; neg < 2; neg++) {
+    affine_compress(packed, &pub_key);
+    if (!affine_decompress(&q, packed)) {
+      printf("affine_decompress: rejected a point\n");
+      ok = 0;
+    }
+    ok &= check("affine_decompress", q.y, pub_key.y);
+    fe_begin();
+    fe y = fe_new();
+    fe_from_bytes(y, pub_key.y);
+    fe_neg(y, y);
+    fe_to_bytes(pub_key.y, y);
+    fe_end();
+  }
+  packed[0] = 0x04;
+  if (affine_decompress(&q, packed)) {
+    printf("affine_decompress: accepted a bad prefix\n");
+    ok = 0;
+  }
+
+  // the sponge, fed in one go, against the fixed arity calls
+  scalar in[4], d0, d1;
+  state st;
+  poseidon_sponge sp;
+  memcpy(in[0], kat_msgx, scalar_bytes);
+  memcpy(in[1], pub_key.x, scalar_bytes);
+  memcpy(in[2], pub_key.y, scalar_bytes);
+  memcpy(in[3], kat_msgm, scalar_bytes);
+  memset(st, 0, sizeof(st));
+  poseidon_init(&sp, st);
+  poseidon_2in(st, in[0], in[1]);
+  poseidon_2in(st, in[2], in[3]);
+  poseidon_digest(st, d0);
+  poseidon_absorb_many(&sp, (const scalar *)in, 4);
+  poseidon_squeeze(&sp, d1);
+  ok &= check("poseidon_absorb_many", d1, d0);
+
+  // the lanes against the sponge, messages of 2 and 5 elements out of the
+  // batch, with a partly filled last group for the odd length
+  static scalar digests[batch_size];
+  const scalar *elems = (const scalar *)batch_msgs;
+  for (unsigned int len = 2; len <= 5; len += 3) {
+    unsigned int n = 2 * batch_size / len;
+    poseidon_xN(digests, st, elems, len, n);
+    for (unsigned int k = 0; k < n; k++) {
+      poseidon_init(&sp, st);
+      poseidon_absorb_many(&sp, elems + k * len, len);
+      poseidon_squeeze(&sp, d0);
+      ok &= check("poseidon_xN", digests[k], d0);
+    }
+  }
+
+  fe_begin();
+  group r, g;
+  group_new(&r);
+  group_new(&g);
+  group_load(&g, &group_one);
+  group_scalar_mul(&r, kat_priv_key, &g);
+  projective_to_affine(&pub_key, &r);
+  ok &= check("group_scalar_mul", pub_key.x, kat_pub_x);
+  group_scalar_mul_wnaf(&r, kat_priv_key, &g);
+  projective_to_affine(&pub_key, &r);
+  ok &= check("group_scalar_mul_wnaf", pub_key.x, kat_pub_x);
+  ok &= check("group_scalar_mul_wnaf", pub_key.y, kat_pub_y);
+  fe_end();
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  if (!known_answer()) {
+    printf("known answer test FAILED\n");
+    return 1;
+  }
+  printf("known answer test ok\n");
+  if (argc > 1 && strcmp(argv[1], "-k") == 0) {
+    return 0;
+  }
+
+  state st;
+  affine pub_key;
+  field rx;
+  scalar s;
+  memset(st, 0, sizeof(st));
+  generate_pubkey(&pub_key, kat_priv_key);
+
+  fe_begin();
+  fe a = fe_new(), b = fe_new();
+  fe_from_bytes(a, kat_msgx);
+  fe_from_bytes(b, kat_msgm);
+
+  BENCH("fe_mul", fe_mul(a, a, b));
+  BENCH("fe_inv", fe_inv(a, a));
+  fe_end();
+
+  fe_begin();
+  group r, g;
+  group_new(&r);
+  group_new(&g);
+  group_load(&g, &group_one);
+  BENCH("group_scalar_mul", group_scalar_mul(&r, kat_priv_key, &g));
+  BENCH("group_scalar_mul_wnaf", group_scalar_mul_wnaf(&r, kat_priv_key, &g));
+  fe_end();
+  BENCH("poseidon_2in", poseidon_2in(st, kat_msgx, kat_msgm));
+  poseidon_sponge sp;
+  poseidon_init(&sp, st);
+  BENCH("poseidon_absorb", poseidon_absorb(&sp, kat_msgx));
+  BENCH("generate_pubkey", generate_pubkey(&pub_key, kat_priv_key));
+  unsigned char packed[compressed_bytes];
+  affine q;
+  affine_compress(packed, &pub_key);
+  BENCH("affine_decompress", affine_decompress(&q, packed));
+  BENCH("sign", sign(rx, s, &pub_key, kat_priv_key, kat_msgx, kat_msgm));
+  BENCH("schnorr_verify",
+        schnorr_verify(rx, s, &pub_key, kat_msgx, kat_msgm));
+
+  unsigned char valid[batch_size];
+  batch_sign(&pub_key);
+  BENCH_N("schnorr_batch_verify/64", batch_size,
+          schnorr_batch_verify(batch_size, batch_msgs, batch_pks, batch_sigs,
+                               valid));
+
+  // the 2 element sponge of poseidon_2in, over the batch messages
+  static scalar digests[batch_size];
+  BENCH_N("poseidon_xN/64", batch_size,
+          poseidon_xN(digests, st, (const scalar *)batch_msgs, 2,
+                      batch_size));
+  return 0;
+}
@@ -0,0 +1,321 @@
+#include <stdint.h>
+#include "os.h"
+#include "crypto.h"
+
+/* Host implementation of the field and scalar arithmetic that crypto.c
+ * otherwise gets from the cx_math_* calls of the crypto coprocessor.
+ * Elements are held in 64-bit limbs (least significant first) and
+ * multiplied with montgomery's CIOS method, so the rest of the code
+ * (group law, poseidon, schnorr) can be run and timed off-device.
+ *
+ * Field elements (fe) are slots of a static pool, handed out and given
+ * back in stack order like the coprocessor slots of the device backend,
+ * and stay in montgomery form, R = 2^(64 * field_limbs), from
+ * fe_from_bytes to fe_to_bytes. Scalars only see a handful of operations
+ * per signature and keep the byte interface.
+ */
+
+typedef unsigned __int128 uint128_t;
+
+typedef struct mont {
+  uint64_t m[field_limbs];   // modulus
+  uint64_t r2[field_limbs];  // R^2 mod m, R = 2^(64 * field_limbs)
+  uint64_t n0;               // -1/m mod 2^64
+} mont;
+
+// MNT6753_p
+static const mont fp = {
+    {0xd90776e240000001, 0x4ea099170fa13a4f, 0xd6c381bc3f005797,
+     0xb9dff97634993aa4, 0x3eebca9429212636, 0xb26c5c28c859a99b,
+     0x99d124d9a15af79d, 0x07fdb925e8a0ed8d, 0x5eb7e8f96c97d873,
+     0xb7f997505b8fafed, 0x10229022eee2cdad, 0x0001c4c62d92c411},
+    {0x3f9c69c7b7f4c8d1, 0x70a50fa9ee48d127, 0xcdbe6702009569cb,
+     0x6bd8c6c6c49edc38, 0x7955876cc35ee94e, 0xc7285529be54a3f4,
+     0xded52121ecec77cf, 0x99be80f2ee12ee8e, 0xc8a0ff01493bdcef,
+     0xacc27988f3d9a316, 0xd9e817a8fb44b3c9, 0x000005b58037e0e4},
+    0xc90776e23fffffff};
+
+// MNT6753_q
+static const mont fq = {
+    {0x5e9063de245e8001, 0xe39d54522cdd119f, 0x638810719ac425f0,
+     0x685acce9767254a4, 0xb80f0da5cb537e38, 0xb117e776f218059d,
+     0x99d124d9a15af79d, 0x07fdb925e8a0ed8d, 0x5eb7e8f96c97d873,
+     0xb7f997505b8fafed, 0x10229022eee2cdad, 0x0001c4c62d92c411},
+    {0x84717088cfd190c8, 0xc7d9ff8e7df03c0a, 0xa24bea56242b3507,
+     0xa896a656a0714c7d, 0x80a46659ff6f3ddf, 0x2f47839ef88d7ce8,
+     0xa8c86d4604a3b597, 0xe03c79cac4f7ef07, 0x2505daf1f4a81245,
+     0x8e4605754c381723, 0xb081f15bcbfdacaf, 0x00002a33e89cb485},
+    0xf2044cfbe45e7fff};
+
+static const uint64_t limbs_one[field_limbs] = {1};
+
+// big endian bytes -> limbs
+static void load(uint64_t r[field_limbs], const unsigned char *a) {
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    const unsigned char *b = a + field_bytes - 8 * (i + 1);
+    uint64_t w = 0;
+    for (unsigned int j = 0; j < 8; j++) {
+      w = (w << 8) | b[j];
+    }
+    r[i] = w;
+  }
+}
+
+// limbs -> big endian bytes
+static void store(unsigned char *r, const uint64_t a[field_limbs]) {
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    unsigned char *b = r + field_bytes - 8 * (i + 1);
+    uint64_t w = a[i];
+    for (int j = 7; j >= 0; j--) {
+      b[j] = w & 0xff;
+      w >>= 8;
+    }
+  }
+}
+
+static uint64_t add_n(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                      const uint64_t b[field_limbs]) {
+  uint128_t t = 0;
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    t += (uint128_t)a[i] + b[i];
+    c[i] = (uint64_t)t;
+    t >>= 64;
+  }
+  return (uint64_t)t;
+}
+
+static uint64_t sub_n(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                      const uint64_t b[field_limbs]) {
+  uint64_t borrow = 0;
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    uint128_t t = (uint128_t)a[i] - b[i] - borrow;
+    c[i] = (uint64_t)t;
+    borrow = (uint64_t)(t >> 64) & 1;
+  }
+  return borrow;
+}
+
+static unsigned int geq_n(const uint64_t a[field_limbs],
+                          const uint64_t b[field_limbs]) {
+  for (int i = field_limbs - 1; i >= 0; i--) {
+    if (a[i] != b[i]) {
+      return a[i] > b[i];
+    }
+  }
+  return 1;
+}
+
+// inputs are not always reduced (e.g. a scalar fed to poseidon), so bring
+// anything below 2^(64 * field_limbs) into [0, m)
+static void reduce(uint64_t a[field_limbs], const mont *m) {
+  while (geq_n(a, m->m)) {
+    sub_n(a, a, m->m);
+  }
+}
+
+static void mont_add(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const uint64_t b[field_limbs], const mont *m) {
+  uint64_t carry = add_n(c, a, b);
+  if (carry || geq_n(c, m->m)) {
+    sub_n(c, c, m->m);
+  }
+}
+
+static void mont_sub(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const uint64_t b[field_limbs], const mont *m) {
+  if (sub_n(c, a, b)) {
+    add_n(c, c, m->m);
+  }
+}
+
+// c = a * b / R mod m (CIOS), a and b reduced
+static void mont_mul(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const uint64_t b[field_limbs], const mont *m) {
+  uint64_t t[field_limbs + 2] = {0};
+  for (unsigned int i = 0; i < field_limbs; i++) {
+    uint128_t uv = 0;
+    for (unsigned int j = 0; j < field_limbs; j++) {
+      uv = (uint128_t)a[j] * b[i] + t[j] + (uint64_t)(uv >> 64);
+      t[j] = (uint64_t)uv;
+    }
+    uv = (uint128_t)t[field_limbs] + (uint64_t)(uv >> 64);
+    t[field_limbs] = (uint64_t)uv;
+    t[field_limbs + 1] = (uint64_t)(uv >> 64);
+
+    uint64_t q = t[0] * m->n0;
+    uv = (uint128_t)q * m->m[0] + t[0];
+    for (unsigned int j = 1; j < field_limbs; j++) {
+      uv = (uint128_t)q * m->m[j] + t[j] + (uint64_t)(uv >> 64);
+      t[j - 1] = (uint64_t)uv;
+    }
+    uv = (uint128_t)t[field_limbs] + (uint64_t)(uv >> 64);
+    t[field_limbs - 1] = (uint64_t)uv;
+    t[field_limbs] = t[field_limbs + 1] + (uint64_t)(uv >> 64);
+  }
+  if (t[field_limbs] || geq_n(t, m->m)) {
+    sub_n(t, t, m->m);
+  }
+  os_memcpy(c, t, field_limbs * sizeof(uint64_t));
+}
+
+// c = a^e, a in montgomery form, e given as len big endian bytes
+static void mont_pow(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const unsigned char *e, unsigned int len, const mont *m) {
+  uint64_t r[field_limbs], b[field_limbs];
+  os_memcpy(b, a, sizeof(b));
+  mont_mul(r, limbs_one, m->r2, m); // R mod m
+  for (unsigned int i = 0; i < 8 * len; i++) {
+    mont_mul(r, r, r, m);
+    if (e[i / 8] & (0x80 >> (i % 8))) {
+      mont_mul(r, r, b, m);
+    }
+  }
+  os_memcpy(c, r, sizeof(r));
+}
+
+// c = a^(m - 2) = 1/a by fermat, a in montgomery form
+static void mont_inv(uint64_t c[field_limbs], const uint64_t a[field_limbs],
+                     const mont *m) {
+  uint64_t e[field_limbs];
+  unsigned char eb[field_bytes];
+  const uint64_t two[field_limbs] = {2};
+  sub_n(e, m->m, two);
+  store(eb, e);
+  mont_pow(c, a, eb, field_bytes, m);
+}
+
+static void mod_add(unsigned char *c, const unsigned char *a,
+                    const unsigned char *b, const mont *m) {
+  uint64_t x[field_limbs], y[field_limbs];
+  load(x, a);
+  load(y, b);
+  reduce(x, m);
+  reduce(y, m);
+  mont_add(x, x, y, m);
+  store(c, x);
+}
+
+static void mod_sub(unsigned char *c, const unsigned char *a,
+                    const unsigned char *b, const mont *m) {
+  uint64_t x[field_limbs], y[field_limbs];
+  load(x, a);
+  load(y, b);
+  reduce(x, m);
+  reduce(y, m);
+  mont_sub(x, x, y, m);
+  store(c, x);
+}
+
+// a * b / R, then * R^2 / R to land back on a * b
+static void mod_mul(unsigned char *c, const unsigned char *a,
+                    const unsigned char *b, const mont *m) {
+  uint64_t x[field_limbs], y[field_limbs];
+  load(x, a);
+  load(y, b);
+  reduce(x, m);
+  reduce(y, m);
+  mont_mul(x, x, y, m);
+  mont_mul(x, x, m->r2, m);
+  store(c, x);
+}
+
+static void mod_pow(unsigned char *c, const unsigned char *a,
+                    const unsigned char *e, unsigned int len, const mont *m) {
+  uint64_t x[field_limbs];
+  load(x, a);
+  reduce(x, m);
+  mont_mul(x, x, m->r2, m);
+  mont_pow(x, x, e, len, m);
+  mont_mul(x, x, limbs_one, m);
+  store(c, x);
+}
+
+static uint64_t pool[fe_slots][field_limbs];
+static unsigned int top;
+static unsigned int depth;
+
+void fe_begin(void) {
+  if (depth++ == 0) {
+    top = 0;
+  }
+}
+
+void fe_end(void) { depth--; }
+
+void fe_reset(void) { depth = 0; }
+
+fe fe_new(void) {
+  if (top == fe_slots) {
+    THROW(EXCEPTION_OVERFLOW);
+  }
+  return pool[top++];
+}
+
+unsigned int fe_mark(void) { return top; }
+
+void fe_release(unsigned int mark) { top = mark; }
+
+void fe_load(fe r, const fe_packed a) { os_memcpy(r, a, sizeof(fe_packed)); }
+
+void fe_store(fe_packed r, const fe a) { os_memcpy(r, a, sizeof(fe_packed)); }
+
+void fe_from_bytes(fe r, const field a) {
+  load(r, a);
+  reduce(r, &fp);
+  mont_mul(r, r, fp.r2, &fp);
+}
+
+void fe_to_bytes(field r, const fe a) {
+  uint64_t x[field_limbs];
+  mont_mul(x, a, limbs_one, &fp);
+  store(r, x);
+}
+
+void fe_copy(fe r, const fe a) { os_memcpy(r, a, sizeof(fe_packed)); }
+
+// montgomery form is unique for reduced elements
+unsigned int fe_eq(const fe a, const fe b) {
+  return (os_memcmp(a, b, sizeof(fe_packed)) == 0);
+}
+
+unsigned int fe_is_zero(const fe a) {
+  const fe_packed zero = {0};
+  return (os_memcmp(a, zero, sizeof(fe_packed)) == 0);
+}
+
+void fe_add(fe c, const fe a, const fe b) { mont_add(c, a, b, &fp); }
+
+void fe_sub(fe c, const fe a, const fe b) { mont_sub(c, a, b, &fp); }
+
+void fe_neg(fe c, const fe a) {
+  const fe_packed zero = {0};
+  mont_sub(c, zero, a, &fp);
+}
+
+void fe_mul(fe c, const fe a, const fe b) { mont_mul(c, a, b, &fp); }
+
+void fe_sq(fe c, const fe a) { mont_mul(c, a, a, &fp); }
+
+void fe_inv(fe c, const fe a) { mont_inv(c, a, &fp); }
+
+void fe_pow(fe c, const fe a, const unsigned char *e, unsigned int len_e) {
+  mont_pow(c, a, e, len_e, &fp);
+}
+
+void scalar_add(scalar c, const scalar a, const scalar b) {
+  mod_add(c, a, b, &fq);
+}
+
+void scalar_sub(scalar c, const scalar a, const scalar b) {
+  mod_sub(c, a, b, &fq);
+}
+
+void scalar_mul(scalar c, const scalar a, const scalar b) {
+  mod_mul(c, a, b, &fq);
+}
+
+void scalar_sq(scalar c, const scalar a) { mod_mul(c, a, a, &fq); }
+
+void scalar_pow(scalar c, const scalar a, const scalar e) {
+  mod_pow(c, a, e, 1, &fq);
+}
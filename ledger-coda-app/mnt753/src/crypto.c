@@ -2,41 +2,14 @@
 #include "cx.h"
 #include "crypto.h"
 #include "poseidon.h"
+#include "curve_tables.h"
 
 #define MNT6 1
 #define MNT4 0
 
 #if MNT6
- // mnt6753 params
-static const field field_modulus = {
-    0x00, 0x01, 0xc4, 0xc6, 0x2d, 0x92, 0xc4, 0x11, 0x10, 0x22, 0x90, 0x22,
-    0xee, 0xe2, 0xcd, 0xad, 0xb7, 0xf9, 0x97, 0x50, 0x5b, 0x8f, 0xaf, 0xed,
-    0x5e, 0xb7, 0xe8, 0xf9, 0x6c, 0x97, 0xd8, 0x73, 0x07, 0xfd, 0xb9, 0x25,
-    0xe8, 0xa0, 0xed, 0x8d, 0x99, 0xd1, 0x24, 0xd9, 0xa1, 0x5a, 0xf7, 0x9d,
-    0xb2, 0x6c, 0x5c, 0x28, 0xc8, 0x59, 0xa9, 0x9b, 0x3e, 0xeb, 0xca, 0x94,
-    0x29, 0x21, 0x26, 0x36, 0xb9, 0xdf, 0xf9, 0x76, 0x34, 0x99, 0x3a, 0xa4,
-    0xd6, 0xc3, 0x81, 0xbc, 0x3f, 0x00, 0x57, 0x97, 0x4e, 0xa0, 0x99, 0x17,
-    0x0f, 0xa1, 0x3a, 0x4f, 0xd9, 0x07, 0x76, 0xe2, 0x40, 0x00, 0x00, 0x01};
-
-static const field group_coeff_a = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b};
-
-static const field group_coeff_b = {
-    0x00, 0x00, 0x7d, 0xa2, 0x85, 0xe7, 0x08, 0x63, 0xc7, 0x9d, 0x56, 0x44,
-    0x62, 0x37, 0xce, 0x2e, 0x14, 0x68, 0xd1, 0x4a, 0xe9, 0xbb, 0x64, 0xb2,
-    0xbb, 0x01, 0xb1, 0x0e, 0x60, 0xa5, 0xd5, 0xdf, 0xe0, 0xa2, 0x57, 0x14,
-    0xb7, 0x98, 0x59, 0x93, 0xf6, 0x2f, 0x03, 0xb2, 0x2a, 0x9a, 0x3c, 0x73,
-    0x7a, 0x1a, 0x1e, 0x0f, 0xcf, 0x2c, 0x43, 0xd7, 0xbf, 0x84, 0x79, 0x57,
-    0xc3, 0x4c, 0xca, 0x1e, 0x35, 0x85, 0xf9, 0xa8, 0x0a, 0x95, 0xf4, 0x01,
-    0x86, 0x7c, 0x4e, 0x80, 0xf4, 0x74, 0x7f, 0xde, 0x5a, 0xba, 0x75, 0x05,
-    0xba, 0x6f, 0xcf, 0x24, 0x85, 0x54, 0x0b, 0x13, 0xdf, 0xc8, 0x46, 0x8a};
+// the moduli, a, b, the generator and the schnorr_hash state come from
+// curve_tables.h, see gen_tables.py
 
 // mnt6753 generator
 //  .x =
@@ -48,37 +21,10 @@ static const field group_coeff_b = {
 //  7647351483823436111485517548824200743143907422382774281391189981793072811229
 //  7763448010814764117701403540298764970469500339646563344680868495474127850569"
 
-static const group group_one = {
-    {0x00, 0x00, 0x25, 0x5f, 0x8e, 0x87, 0x6e, 0x83, 0x11, 0x47, 0x41, 0x2c,
-     0xfb, 0x10, 0x02, 0x28, 0x4f, 0x30, 0x33, 0x80, 0x88, 0x13, 0x1c, 0x24,
-     0x37, 0xe8, 0x84, 0xc4, 0x99, 0x7f, 0xd1, 0xdc, 0xb4, 0x09, 0x36, 0x7d,
-     0x0c, 0x0d, 0x5f, 0xc5, 0xe8, 0x18, 0x77, 0x1b, 0x93, 0x1f, 0x1d, 0x5b,
-     0xdd, 0x06, 0x9c, 0xe5, 0xe3, 0xc5, 0x7b, 0x6d, 0xf1, 0x20, 0xce, 0xe3,
-     0xcd, 0x9d, 0x86, 0x7e, 0x66, 0xd1, 0x1a, 0xcb, 0xf7, 0xda, 0x60, 0x89,
-     0x5b, 0x8b, 0x3d, 0x9d, 0x44, 0x2c, 0x4c, 0x41, 0x23, 0x32, 0x9a, 0x6f,
-     0xef, 0xa9, 0xa1, 0xf3, 0xf7, 0xa1, 0xfb, 0xd9, 0x3a, 0x7b, 0xff, 0xb8},
-    {0x00, 0x01, 0x28, 0xc0, 0x2f, 0xff, 0x6e, 0x2e, 0xb3, 0xfc, 0xa7, 0x0d,
-     0xc1, 0x06, 0x3b, 0xac, 0x34, 0x55, 0x18, 0x01, 0x20, 0x2a, 0x35, 0x85,
-     0xbd, 0xd6, 0xd7, 0x72, 0x2c, 0x6c, 0x07, 0xd7, 0x87, 0x3b, 0xb0, 0x2d,
-     0x4c, 0x7a, 0x18, 0xed, 0x9c, 0x4b, 0xd3, 0xc7, 0xed, 0x0f, 0xfb, 0x31,
-     0xc5, 0x7e, 0x61, 0x0d, 0xc7, 0xa5, 0x93, 0xcc, 0xe5, 0xa7, 0x92, 0xe9,
-     0x4d, 0x00, 0x20, 0xc3, 0x35, 0xb7, 0x4d, 0x99, 0x92, 0xf5, 0xcb, 0xf4,
-     0xb2, 0xcc, 0x4c, 0x42, 0xef, 0xf9, 0xa5, 0xa6, 0xc4, 0x52, 0x1d, 0xf9,
-     0x85, 0x56, 0x87, 0x13, 0x9f, 0x0c, 0x51, 0x75, 0x4c, 0x0c, 0xcc, 0x49}};
-
-static const scalar group_order = {
-    0x00, 0x01, 0xc4, 0xc6, 0x2d, 0x92, 0xc4, 0x11, 0x10, 0x22, 0x90, 0x22,
-    0xee, 0xe2, 0xcd, 0xad, 0xb7, 0xf9, 0x97, 0x50, 0x5b, 0x8f, 0xaf, 0xed,
-    0x5e, 0xb7, 0xe8, 0xf9, 0x6c, 0x97, 0xd8, 0x73, 0x07, 0xfd, 0xb9, 0x25,
-    0xe8, 0xa0, 0xed, 0x8d, 0x99, 0xd1, 0x24, 0xd9, 0xa1, 0x5a, 0xf7, 0x9d,
-    0xb1, 0x17, 0xe7, 0x76, 0xf2, 0x18, 0x05, 0x9d, 0xb8, 0x0f, 0x0d, 0xa5,
-    0xcb, 0x53, 0x7e, 0x38, 0x68, 0x5a, 0xcc, 0xe9, 0x76, 0x72, 0x54, 0xa4,
-    0x63, 0x88, 0x10, 0x71, 0x9a, 0xc4, 0x25, 0xf0, 0xe3, 0x9d, 0x54, 0x52,
-    0x2c, 0xdd, 0x11, 0x9f, 0x5e, 0x90, 0x63, 0xde, 0x24, 0x5e, 0x80, 0x01};
-
 #endif // MNT6
 
 #if MNT4
+#error "curve_tables.h and poseidon_tables.h only have the mnt6753 constants"
 // mnt4753 params
 static const field field_modulus = {
     0x00, 0x01, 0xc4, 0xc6, 0x2d, 0x92, 0xc4, 0x11, 0x10, 0x22, 0x90, 0x22,
@@ -146,160 +92,521 @@ static const scalar group_order = {
 
 
 // common
-static const field field_zero = {0};
 static const scalar scalar_zero = {0};
-static const group group_zero = {{0}, {0}};
 
-void field_add(field c, const field a, const field b) {
-  cx_math_addm(c, a, b, field_modulus, field_bytes);
+unsigned int tables_checksum(unsigned int h, const void *p, unsigned int len) {
+  const unsigned char *b = p;
+  for (unsigned int i = 0; i < len; i++) {
+    h = (h ^ b[i]) * 0x01000193;
+  }
+  return h;
 }
 
-void field_sub(field c, const field a, const field b) {
-  cx_math_subm(c, a, b, field_modulus, field_bytes);
+// the tables as built, against the checksum gen_tables.py wrote with them
+unsigned int curve_tables_ok(void) {
+  return curve_tables_sum() == curve_tables_checksum;
 }
 
-void field_mul(field c, const field a, const field b) {
-  cx_math_multm(c, a, b, field_modulus, field_bytes);
+#if !defined(CODA_HOST)
+// field arithmetic on the crypto coprocessor. Operands stay resident in
+// cx_bn slots, in montgomery form, for the whole session instead of being
+// reloaded by every cx_math_* call. host builds get these from host/field.c
+// instead
+
+// cx_bn reports errors by return value, the rest of the app by exception
+#define BN(call)                                                               \
+  do {                                                                         \
+    cx_err_t err = (call);                                                     \
+    if (err != CX_OK) {                                                        \
+      THROW(err);                                                              \
+    }                                                                          \
+  } while (0)
+
+static cx_bn_mont_ctx_t mont; // field modulus and R^2 mod p
+static cx_bn_t order;         // group order, for the scalars
+static cx_bn_t scratch;       // for the conversions
+static cx_bn_t slots[fe_slots];
+static unsigned int top;
+static unsigned int depth;
+
+void fe_begin(void) {
+  if (depth++ > 0) {
+    return;
+  }
+  cx_bn_t n, h;
+  BN(cx_bn_lock(16, 0));
+  BN(cx_bn_alloc_init(&n, field_bytes, field_modulus, field_bytes));
+  BN(cx_bn_alloc_init(&h, field_bytes, field_r2, field_bytes));
+  BN(cx_mont_alloc(&mont, field_bytes));
+  BN(cx_mont_init2(&mont, n, h));
+  BN(cx_bn_destroy(&n));
+  BN(cx_bn_destroy(&h));
+  BN(cx_bn_alloc_init(&order, scalar_bytes, group_order, scalar_bytes));
+  BN(cx_bn_alloc(&scratch, field_bytes));
+  for (unsigned int i = 0; i < fe_slots; i++) {
+    BN(cx_bn_alloc(&slots[i], field_bytes));
+  }
+  top = 0;
 }
 
-void field_sq(field c, const field a) {
-  cx_math_multm(c, a, a, field_modulus, field_bytes);
+// unlocking frees every slot
+void fe_end(void) {
+  if (--depth > 0) {
+    return;
+  }
+  cx_bn_unlock();
+}
+
+void fe_reset(void) {
+  depth = 0;
+  if (cx_bn_is_locked()) {
+    cx_bn_unlock();
+  }
+}
+
+fe fe_new(void) {
+  if (top == fe_slots) {
+    THROW(EXCEPTION_OVERFLOW);
+  }
+  return slots[top++];
+}
+
+unsigned int fe_mark(void) { return top; }
+
+void fe_release(unsigned int mark) { top = mark; }
+
+void fe_load(fe r, const fe_packed a) { BN(cx_bn_init(r, a, field_bytes)); }
+
+void fe_store(fe_packed r, const fe a) {
+  BN(cx_bn_export(a, r, field_bytes));
 }
 
-void field_inv(field c, const field a) {
-  cx_math_invprimem(c, a, field_modulus, field_bytes);
+void fe_from_bytes(fe r, const field a) {
+  BN(cx_bn_init(scratch, a, field_bytes));
+  BN(cx_bn_reduce(r, scratch, mont.n));
+  BN(cx_mont_to_montgomery(scratch, r, &mont));
+  BN(cx_bn_copy(r, scratch));
+}
+
+void fe_to_bytes(field r, const fe a) {
+  BN(cx_mont_from_montgomery(scratch, a, &mont));
+  BN(cx_bn_export(scratch, r, field_bytes));
+}
+
+void fe_copy(fe r, const fe a) { BN(cx_bn_copy(r, a)); }
+
+unsigned int fe_eq(const fe a, const fe b) {
+  int diff;
+  BN(cx_bn_cmp(a, b, &diff));
+  return (diff == 0);
 }
 
-void field_negate(field c, const field a) {
-  cx_math_subm(c, field_modulus, a, field_modulus, field_bytes);
+unsigned int fe_is_zero(const fe a) {
+  int diff;
+  BN(cx_bn_cmp_u32(a, 0, &diff));
+  return (diff == 0);
 }
 
-// c = a^e mod m
-// cx_math_powm(result_pointer, a, e, len_e, m, len(result)  (which is also len(a) and len(m)) )
-void field_pow(field c, const field a, const field e) {
-  cx_math_powm(c, a, e, 1, field_modulus, field_bytes);
+void fe_add(fe c, const fe a, const fe b) {
+  BN(cx_bn_mod_add(c, a, b, mont.n));
 }
 
-unsigned int field_eq(const field a, const field b) {
-  return (os_memcmp(a, b, field_bytes) == 0);
+void fe_sub(fe c, const fe a, const fe b) {
+  BN(cx_bn_mod_sub(c, a, b, mont.n));
+}
+
+void fe_neg(fe c, const fe a) {
+  BN(cx_bn_set_u32(scratch, 0));
+  BN(cx_bn_mod_sub(c, scratch, a, mont.n));
+}
+
+void fe_mul(fe c, const fe a, const fe b) { BN(cx_mont_mul(c, a, b, &mont)); }
+
+void fe_sq(fe c, const fe a) { BN(cx_mont_mul(c, a, a, &mont)); }
+
+void fe_inv(fe c, const fe a) { BN(cx_mont_invert_nprime(c, a, &mont)); }
+
+// c = a^e, e given as len_e big endian bytes
+void fe_pow(fe c, const fe a, const unsigned char *e, unsigned int len_e) {
+  BN(cx_mont_pow(c, a, e, len_e, &mont));
+}
+
+// scalars only see a handful of operations per signature and keep the byte
+// interface: load, reduce mod q, operate, export
+static void scalar_load(cx_bn_t r, const scalar a) {
+  BN(cx_bn_init(scratch, a, scalar_bytes));
+  BN(cx_bn_reduce(r, scratch, order));
 }
 
 void scalar_add(scalar c, const scalar a, const scalar b) {
-  cx_math_addm(c, a, b, group_order, scalar_bytes);
+  fe_begin();
+  unsigned int mark = fe_mark();
+  fe x = fe_new(), y = fe_new();
+  scalar_load(x, a);
+  scalar_load(y, b);
+  BN(cx_bn_mod_add(x, x, y, order));
+  BN(cx_bn_export(x, c, scalar_bytes));
+  fe_release(mark);
+  fe_end();
 }
 
 void scalar_sub(scalar c, const scalar a, const scalar b) {
-  cx_math_subm(c, a, b, group_order, scalar_bytes);
+  fe_begin();
+  unsigned int mark = fe_mark();
+  fe x = fe_new(), y = fe_new();
+  scalar_load(x, a);
+  scalar_load(y, b);
+  BN(cx_bn_mod_sub(x, x, y, order));
+  BN(cx_bn_export(x, c, scalar_bytes));
+  fe_release(mark);
+  fe_end();
 }
 
 void scalar_mul(scalar c, const scalar a, const scalar b) {
-  cx_math_multm(c, a, b, group_order, scalar_bytes);
+  fe_begin();
+  unsigned int mark = fe_mark();
+  fe x = fe_new(), y = fe_new();
+  scalar_load(x, a);
+  scalar_load(y, b);
+  BN(cx_bn_mod_mul(x, x, y, order));
+  BN(cx_bn_export(x, c, scalar_bytes));
+  fe_release(mark);
+  fe_end();
 }
 
-void scalar_sq(scalar c, const scalar a) {
-  cx_math_multm(c, a, a, group_order, scalar_bytes);
-}
+void scalar_sq(scalar c, const scalar a) { scalar_mul(c, a, a); }
 
-// c = a^e mod m
-// cx_math_powm(result_pointer, a, e, len_e, m, len(result)  (which is also len(a) and len(m)) )
+// c = a^e mod q, only the first byte of e is used
 void scalar_pow(scalar c, const scalar a, const scalar e) {
-  cx_math_powm(c, a, e, 1, group_order, scalar_bytes);
+  fe_begin();
+  unsigned int mark = fe_mark();
+  fe x = fe_new();
+  scalar_load(x, a);
+  BN(cx_bn_mod_pow(x, x, e, 1, order));
+  BN(cx_bn_export(x, c, scalar_bytes));
+  fe_release(mark);
+  fe_end();
 }
 
+#endif // CODA_HOST
+
 unsigned int scalar_eq(const scalar a, const scalar b) {
   return (os_memcmp(a, b, scalar_bytes) == 0);
 }
 
-unsigned int is_zero(const group *p) {
-  return (os_memcmp(p->x, field_zero, field_bytes) == 0 &&
-      os_memcmp(p->y, field_zero, field_bytes) == 0);
+void group_new(group *r) {
+  r->X = fe_new();
+  r->Y = fe_new();
+  r->Z = fe_new();
+}
+
+void group_load(group *r, const group_packed *p) {
+  fe_load(r->X, p->X);
+  fe_load(r->Y, p->Y);
+  fe_load(r->Z, p->Z);
+}
+
+void group_copy(group *r, const group *p) {
+  fe_copy(r->X, p->X);
+  fe_copy(r->Y, p->Y);
+  fe_copy(r->Z, p->Z);
+}
+
+void group_store(group_packed *r, const group *p) {
+  fe_store(r->X, p->X);
+  fe_store(r->Y, p->Y);
+  fe_store(r->Z, p->Z);
 }
 
+// zero is the only point with Z = 0 in jacobian coordinates
+unsigned int is_zero(const group *p) { return fe_is_zero(p->Z); }
+
+// y^2 = x^3 + ax + b, with x = X/Z^2 and y = Y/Z^3
+// => Y^2 = X^3 + aXZ^4 + bZ^6
 unsigned int is_on_curve(const group *p) {
 
   if (is_zero(p)) {
     return 1;
   }
 
-  field t0, t1, t2;
-  field_mul(t0, p->y, p->y);                // y^2
-  field_mul(t1, p->x, p->x);                // x^2
-  field_add(t2, t1, group_coeff_a);         // x^2 + a
-  field_mul(t1, t2, p->x);                  // x^3 + ax
-  field_add(t2, t1, group_coeff_b);         // x^3 + ax + b
-  return (os_memcmp(t0, t2, field_bytes) == 0);
+  unsigned int mark = fe_mark();
+  fe lhs = fe_new(), rhs = fe_new(), z4 = fe_new(), t = fe_new();
+  fe_sq(lhs, p->Y);                      // Y^2
+  fe_sq(z4, p->Z);                       // Z^2
+  fe_sq(z4, z4);                         // Z^4
+  fe_load(t, group_coeff_a);
+  fe_mul(t, t, z4);                      // aZ^4
+  fe_sq(rhs, p->X);                      // X^2
+  fe_add(rhs, rhs, t);                   // X^2 + aZ^4
+  fe_mul(rhs, rhs, p->X);                // X^3 + aXZ^4
+  fe_mul(z4, z4, p->Z);                  // Z^5
+  fe_mul(z4, z4, p->Z);                  // Z^6
+  fe_load(t, group_coeff_b);
+  fe_mul(t, t, z4);                      // bZ^6
+  fe_add(rhs, rhs, t);                   // X^3 + aXZ^4 + bZ^6
+  unsigned int on = fe_eq(lhs, rhs);
+  fe_release(mark);
+  return on;
 }
 
-void group_double(group *r, const group *p) {
+// converts into the internal form, (0, 0) is the point at infinity
+void affine_to_projective(group *r, const affine *p) {
+  const field zero = {0};
+  if (os_memcmp(p->x, zero, field_bytes) == 0 &&
+      os_memcmp(p->y, zero, field_bytes) == 0) {
+    group_load(r, &group_zero);
+    return;
+  }
+  fe_from_bytes(r->X, p->x);
+  fe_from_bytes(r->Y, p->y);
+  fe_load(r->Z, field_one);
+  return;
+}
 
+// r = (X/Z^2 : Y/Z^3 : 1), staying in the internal form
+void group_normalize(group *r, const group *p) {
   if (is_zero(p)) {
-    *r = group_zero;
+    group_load(r, &group_zero);
     return;
   }
 
-  field t1;
-  field_mul(r->y, p->x, p->x);              // xp^2
-  field_add(t1, r->y, r->y);                // 2xp^2
-  field_add(r->x, r->y, t1);                // 3xp^2
-  field_add(r->y, r->x, group_coeff_a);     // 3xp^2 + a
-  field_add(t1, p->y, p->y);                // 2yp
-  field_inv(r->x, t1);                      // 1/2yp
-  field_mul(t1, r->y, r->x);                // (3xp^2 + a)/2yp
+  unsigned int mark = fe_mark();
+  fe zi = fe_new(), zi2 = fe_new(), zi3 = fe_new();
+  fe_inv(zi, p->Z);        // 1/Z
+  fe_sq(zi2, zi);          // 1/Z^2
+  fe_mul(zi3, zi2, zi);    // 1/Z^3
+  fe_mul(r->X, p->X, zi2); // X/Z^2
+  fe_mul(r->Y, p->Y, zi3); // Y/Z^3
+  fe_load(r->Z, field_one);
+  fe_release(mark);
+  return;
+}
 
-  field_mul(r->y, t1, t1);                  // lambda^2
-  field_sub(r->x, r->y, p->x);              // lambda^2 - xp
-  field_sub(r->x, r->x, p->x);              // lambda^2 - xp - xp
+// the only inversion of a scalar multiplication, (0, 0) for zero
+void projective_to_affine(affine *r, const group *p) {
+  if (is_zero(p)) {
+    os_memset(r, 0, sizeof(affine));
+    return;
+  }
 
-  field_sub(r->y, p->x, r->x);              // xp - xr
-  field_mul(t1, t1, r->y);                  // lambda(xp - xr)
-  field_sub(r->y, t1, p->y);                // lambda(xp - xr) - yp
+  unsigned int mark = fe_mark();
+  group n;
+  group_new(&n);
+  group_normalize(&n, p);
+  fe_to_bytes(r->x, n.X);
+  fe_to_bytes(r->y, n.Y);
+  fe_release(mark);
   return;
 }
 
+// https://www.hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian/doubling/dbl-2007-bl.op3
+// cost 1M + 8S + 1*a + 10add + 2*2 + 1*3 + 1*8
+void group_dbl(group *r, const group *p) {
+
+  if (is_zero(p)) {
+    group_copy(r, p);
+    return;
+  }
+
+  unsigned int mark = fe_mark();
+  fe xx = fe_new(), yy = fe_new(), yyyy = fe_new(), zz = fe_new();
+  fe_sq(xx, p->X);               // xx = X1^2
+  fe_sq(yy, p->Y);               // yy = Y1^2
+  fe_sq(yyyy, yy);               // yyyy = yy^2
+  fe_sq(zz, p->Z);               // zz = Z1^2
+
+  // Z3 = (Y1 + Z1)^2 - yy - zz, before r->Z can alias p
+  fe s = fe_new(), m = fe_new();
+  fe_add(s, p->Y, p->Z);         // t7 = Y1 + Z1
+  fe_sq(m, s);                   // t8 = t7^2
+  fe_sub(m, m, yy);              // t9 = t8 - yy
+
+  fe_add(s, p->X, yy);           // t0 = X1 + yy
+  fe_sq(s, s);                   // t1 = t0^2
+  fe_sub(s, s, xx);              // t2 = t1 - xx
+  fe_sub(s, s, yyyy);            // t3 = t2 - yyyy
+  fe_add(s, s, s);               // s = 2 * t3
+
+  fe_sub(r->Z, m, zz);           // Z3 = t9 - zz
+
+  fe_sq(zz, zz);                 // t4 = zz^2
+  fe_load(m, group_coeff_a);
+  fe_mul(zz, m, zz);             // t5 = a * t4
+  fe_add(m, xx, xx);
+  fe_add(m, m, xx);              // t6 = 3 * xx
+  fe_add(m, m, zz);              // m = t6 + t5
+
+  fe_sq(xx, m);                  // t = m^2
+  fe_sub(xx, xx, s);
+  fe_sub(r->X, xx, s);           // X3 = t - 2 * s
+
+  fe_sub(s, s, r->X);            // t10 = s - X3
+  fe_add(yyyy, yyyy, yyyy);
+  fe_add(yyyy, yyyy, yyyy);
+  fe_add(yyyy, yyyy, yyyy);      // t11 = 8 * yyyy
+  fe_mul(s, m, s);               // t12 = m * t10
+  fe_sub(r->Y, s, yyyy);         // Y3 = t12 - t11
+  fe_release(mark);
+}
+
+// https://www.hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian/addition/add-2007-bl.op3
+// the formula does not involve a, it is the same as for bn382
+// cost 11M + 5S + 9add + 4*2
 void group_add(group *r, const group *p, const group *q) {
 
   if (is_zero(p)) {
-    *r = *q;
+    group_copy(r, q);
     return;
   }
+
   if (is_zero(q)) {
-    *r = *p;
+    group_copy(r, p);
     return;
   }
 
-  field t1;
-  field_mul(t1, p->x, q->x);
-  if (field_eq(t1, field_zero)) {
-    // if pxqx == 0, either p = q -> p + q = 2p
-    if (field_eq(p->y, q->y)) {
-      group_double(r, p);
-      return;
+  unsigned int mark = fe_mark();
+  fe z1z1 = fe_new(), z2z2 = fe_new();
+  fe_sq(z1z1, p->Z);         // Z1Z1 = Z1^2
+  fe_sq(z2z2, q->Z);         // Z2Z2 = Z2^2
+
+  fe u1 = fe_new(), u2 = fe_new(), s1 = fe_new(), s2 = fe_new();
+  fe_mul(u1, p->X, z2z2);    // u1 = x1 * z2z2
+  fe_mul(u2, q->X, z1z1);    // u2 = x2 * z1z1
+  fe_mul(s1, q->Z, z2z2);    // t0 = z2 * z2z2
+  fe_mul(s1, p->Y, s1);      // s1 = y1 * t0
+  fe_mul(s2, p->Z, z1z1);    // t1 = z1 * z1z1
+  fe_mul(s2, q->Y, s2);      // s2 = y2 * t1
+
+  if (fe_eq(u1, u2)) {
+    // same x, so either p = q -> p + q = 2p
+    if (fe_eq(s1, s2)) {
+      group_dbl(r, p);
     } else {
       // or p = -q -> p + q = 0
-      *r = group_zero;
-      return;
+      group_load(r, &group_zero);
     }
+    fe_release(mark);
+    return;
   }
 
-  field_sub(r->y, q->x, p->x);              // xq - xp
-  field_sub(t1, q->y, p->y);                // yq - yp
-  field_inv(r->x, r->y);                    // 1 / (xq - xp)
-  field_mul(r->y, t1, r->x);                // (yq - yp)/(xq - xp)
+  fe h = fe_new(), i = fe_new(), j = fe_new(), w = fe_new(), v = fe_new();
+  fe_sub(h, u2, u1);         // h = u2 - u1
+  fe_add(i, h, h);           // t2 = 2 * h
+  fe_sq(i, i);               // i = t2^2
+  fe_mul(j, h, i);           // j = h * i
+  fe_sub(w, s2, s1);         // t3 = s2 - s1
+  fe_add(w, w, w);           // w = 2 * t3
+  fe_mul(v, u1, i);          // v = u1 * i
+
+  // Z3 = ((Z1 + Z2)^2 - Z1Z1 - Z2Z2) * h, before r->Z can alias p or q
+  fe_add(u2, p->Z, q->Z);    // t11 = z1 + z2
+  fe_sq(u2, u2);             // t12 = (z1 + z2)^2
+  fe_sub(u2, u2, z1z1);      // t13 = (z1 + z2)^2 - z1z1
+  fe_sub(u2, u2, z2z2);      // t14 = (z1 + z2)^2 - z1z1 - z2z2
+  fe_mul(r->Z, u2, h);       // ((z1 + z2)^2 - z1z1 - z2z2) * h
+
+  // X3 = w^2 - j - 2*v
+  fe_sq(u2, w);              // t4 = w^2
+  fe_sub(u2, u2, j);         // t6 = t4 - j
+  fe_sub(u2, u2, v);
+  fe_sub(r->X, u2, v);       // t6 - 2 * v
+
+  // Y3 = w * (v - X3) - 2*s1*j
+  fe_sub(v, v, r->X);        // t7 = v - X3
+  fe_mul(v, w, v);           // t10 = w * t7
+  fe_mul(s1, s1, j);         // t8 = s1 * j
+  fe_add(s1, s1, s1);        // t9 = 2 * t8
+  fe_sub(r->Y, v, s1);       // w * (v - X3) - 2*s1*j
+  fe_release(mark);
+}
 
-  field_mul(t1, r->y, r->y);                // lambda^2
-  field_sub(r->x, t1, p->x);                // lambda^2 - xp
-  field_sub(r->x, r->x, q->x);              // lambda^2 - xp - xq
+// https://www.hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian/addition/madd-2007-bl.op3
+// for p = (X1, Y1, Z1), q = (X2, Y2, Z2); assumes Z2 = 1
+// cost 7M + 4S + 9add + 3*2 + 1*4
+void group_madd(group *r, const group *p, const group *q) {
 
-  field_sub(t1, p->x, r->x);                // xp - xr
-  field_mul(r->y, r->y, t1);                // lambda(xp - xr)
-  field_sub(r->y, r->y, p->y);              // lambda(xp - xr) - yp
-  return;
+  if (is_zero(p)) {
+    group_copy(r, q);
+    return;
+  }
+  if (is_zero(q)) {
+    group_copy(r, p);
+    return;
+  }
+
+  unsigned int mark = fe_mark();
+  fe z1z1 = fe_new(), u2 = fe_new(), s2 = fe_new();
+  fe_sq(z1z1, p->Z);             // z1z1 = Z1^2
+  fe_mul(u2, q->X, z1z1);        // u2 = X2 * z1z1
+  fe_mul(s2, p->Z, z1z1);        // t0 = Z1 * z1z1
+  fe_mul(s2, q->Y, s2);          // s2 = Y2 * t0
+
+  if (fe_eq(u2, p->X)) {
+    if (fe_eq(s2, p->Y)) {
+      group_dbl(r, p);
+    } else {
+      group_load(r, &group_zero);
+    }
+    fe_release(mark);
+    return;
+  }
+
+  fe h = fe_new(), hh = fe_new(), i = fe_new(), j = fe_new(), w = fe_new(),
+     v = fe_new();
+  fe_sub(h, u2, p->X);           // h = u2 - X1
+  fe_sq(hh, h);                  // hh = h^2
+  fe_add(i, hh, hh);
+  fe_add(i, i, i);               // i = 4 * hh
+  fe_mul(j, h, i);               // j = h * i
+  fe_sub(w, s2, p->Y);           // t1 = s2 - Y1
+  fe_add(w, w, w);               // w = 2 * t1
+  fe_mul(v, p->X, i);            // v = X1 * i
+
+  // Y1 * j, before r->Y can alias p
+  fe_mul(s2, p->Y, j);           // t6 = Y1 * j
+  fe_add(s2, s2, s2);            // t7 = 2 * t6
+
+  // Z3 = (Z1 + H)^2 - Z1Z1 - HH
+  fe_add(u2, p->Z, h);           // t9 = Z1 + h
+  fe_sq(u2, u2);                 // t10 = t9^2
+  fe_sub(u2, u2, z1z1);          // t11 = t10 - z1z1
+  fe_sub(r->Z, u2, hh);          // (Z1 + h)^2 - Z1Z1 - hh = t11 - hh
+
+  // X3 = w^2 - J - 2*V
+  fe_sq(u2, w);                  // t2 = w^2
+  fe_sub(u2, u2, j);             // t4 = t2 - j
+  fe_sub(u2, u2, v);
+  fe_sub(r->X, u2, v);           // X3 = t4 - 2*v
+
+  // Y3 = w * (V - X3) - 2*Y1*J
+  fe_sub(v, v, r->X);            // t5 = v - X3
+  fe_mul(v, w, v);               // t8 = w * t5
+  fe_sub(r->Y, v, s2);           // w * (v - X3) - 2*Y1*j = t8 - t7
+  fe_release(mark);
 }
 
+// bit n of k, counting from the least significant
+static inline unsigned int scalar_bit(const scalar k, unsigned int n) {
+  return (k[scalar_bytes - 1 - n / 8] >> (n % 8)) & 1;
+}
 
+static inline void group_swap(group *a, group *b) {
+  group t = *a;
+  *a = *b;
+  *b = t;
+}
+
+#if defined(CODA_HOST)
+
+// variable-base multiplications that the device never does: keys and
+// nonces use group_scalar_mul_base and verification group_double_scalar_mul.
+// they stay for the bench, which checks them against the comb
+
+// the points are handles, so results are moved into place by swapping them
+// with the scratch point q0 rather than copying
 void group_scalar_mul(group *r, const scalar k, const group *p) {
 
-  *r = group_zero;
+  group_load(r, &group_zero);
   if (is_zero(p)) {
     return;
   }
@@ -307,29 +614,267 @@ void group_scalar_mul(group *r, const scalar k, const group *p) {
     return;
   }
 
+  unsigned int mark = fe_mark();
+  group r0 = *r, q0;
+  group_new(&q0);
   // 96 bytes = 8 * 96 = 768. we want 753, 768 - 753 = 15 bits
   // which means we have an offset of 15 bits
-   for (unsigned int i = scalar_offset; i < scalar_bits; i++) {
+  for (unsigned int i = scalar_offset; i < scalar_bits; i++) {
     unsigned int di = k[i/8] & (1 << (7 - (i % 8)));
-    group q0;
-    group_double(&q0, r);
-    *r = q0;
+    group_dbl(&q0, &r0);
+    group_swap(&r0, &q0);
     if (di != 0) {
-      group_add(&q0, r, p);
-      *r = q0;
+      group_add(&q0, &r0, p);
+      group_swap(&r0, &q0);
+    }
+  }
+  group_copy(r, &r0);
+  fe_release(mark);
+  return;
+}
+
+#endif // CODA_HOST
+
+// signed window digits of k, least significant first: every nonzero digit
+// is odd, below 2^(wnaf_width - 1) in absolute value, and followed by at
+// least wnaf_width - 1 zeros. returns the number of digits
+static unsigned int wnaf_recode(signed char naf[scalar_bits + 1],
+                                const scalar k) {
+  unsigned int carry = 0, n = 0;
+  for (unsigned int i = 0; i < scalar_bits + 1;) {
+    unsigned int bit = (i < scalar_bits) ? scalar_bit(k, i) : 0;
+    if (((bit + carry) & 1) == 0) {
+      carry = (bit + carry) >> 1;
+      naf[i++] = 0;
+      continue;
+    }
+    int v = carry;
+    for (unsigned int j = 0; j < wnaf_width; j++) {
+      if (i + j < scalar_bits) {
+        v += scalar_bit(k, i + j) << j;
+      }
+    }
+    carry = 0;
+    if (v >= (1 << (wnaf_width - 1))) {
+      v -= (1 << wnaf_width);
+      carry = 1;
+    }
+    naf[i] = v;
+    n = i + 1;
+    for (unsigned int j = 1; j < wnaf_width && i + j < scalar_bits + 1; j++) {
+      naf[i + j] = 0;
+    }
+    i += wnaf_width;
+  }
+  return n;
+}
+
+// odd[i] = (2i + 1)p, with r0, q0 and t as scratch
+static void wnaf_table(group_packed odd[1 << (wnaf_width - 2)],
+                       const group_packed *p, group *r0, group *q0, group *t) {
+  group_load(r0, p);
+  odd[0] = *p;
+  group_dbl(t, r0);
+  for (unsigned int i = 1; i < (1 << (wnaf_width - 2)); i++) {
+    group_add(q0, r0, t);
+    group_swap(r0, q0);
+    group_store(&odd[i], r0);
+  }
+}
+
+// r0 += d*p for a nonzero digit d, from the odd multiples of p
+static void wnaf_add(group *r0, group *q0, group *t,
+                     const group_packed odd[1 << (wnaf_width - 2)], int d) {
+  group_load(t, &odd[((d > 0) ? d : -d) / 2]);
+  if (d < 0) {
+    fe_neg(t->Y, t->Y);
+  }
+  group_add(q0, r0, t);
+  group_swap(r0, q0);
+}
+
+#if defined(CODA_HOST)
+// k*p for any base, with the width-w NAF of k and the odd multiples
+// p, 3p, ..., (2^(wnaf_width - 1) - 1)p kept packed on the stack. about
+// scalar_bits / (wnaf_width + 1) additions instead of one per set bit,
+// but the sequence of additions follows k: only for public scalars
+void group_scalar_mul_wnaf(group *r, const scalar k, const group *p) {
+
+  group_load(r, &group_zero);
+  if (is_zero(p)) {
+    return;
+  }
+
+  signed char naf[scalar_bits + 1];
+  unsigned int n = wnaf_recode(naf, k);
+  if (n == 0) {
+    return;
+  }
+
+  group_packed base, odd[1 << (wnaf_width - 2)];
+  group_store(&base, p);
+  unsigned int mark = fe_mark();
+  group r0 = *r, q0, t;
+  group_new(&q0);
+  group_new(&t);
+  wnaf_table(odd, &base, &r0, &q0, &t);
+
+  group_load(&r0, &group_zero);
+  for (int i = n - 1; i >= 0; i--) {
+    group_dbl(&q0, &r0);
+    group_swap(&r0, &q0);
+    if (naf[i] != 0) {
+      wnaf_add(&r0, &q0, &t, odd, naf[i]);
+    }
+  }
+  group_copy(r, &r0);
+  fe_release(mark);
+  return;
+}
+#endif // CODA_HOST
+
+// k1*p1 + k2*p2 in one pass (straus): both width-w NAFs are walked together
+// so the two products share their doublings. the bases come packed, which
+// keeps the caller's resident points out of the slot budget. variable time
+// like group_scalar_mul_wnaf, for public scalars only
+void group_double_scalar_mul(group *r, const scalar k1, const group_packed *p1,
+                             const scalar k2, const group_packed *p2) {
+
+  signed char naf1[scalar_bits + 1], naf2[scalar_bits + 1];
+  unsigned int n1 = wnaf_recode(naf1, k1);
+  unsigned int n2 = wnaf_recode(naf2, k2);
+  unsigned int n = (n1 > n2) ? n1 : n2;
+
+  group_load(r, &group_zero);
+  if (n == 0) {
+    return;
+  }
+
+  group_packed odd1[1 << (wnaf_width - 2)], odd2[1 << (wnaf_width - 2)];
+  unsigned int mark = fe_mark();
+  group r0 = *r, q0, t;
+  group_new(&q0);
+  group_new(&t);
+  wnaf_table(odd1, p1, &r0, &q0, &t);
+  wnaf_table(odd2, p2, &r0, &q0, &t);
+
+  group_load(&r0, &group_zero);
+  for (int i = n - 1; i >= 0; i--) {
+    group_dbl(&q0, &r0);
+    group_swap(&r0, &q0);
+    if (naf1[i] != 0) {
+      wnaf_add(&r0, &q0, &t, odd1, naf1[i]);
+    }
+    if (naf2[i] != 0) {
+      wnaf_add(&r0, &q0, &t, odd2, naf2[i]);
+    }
+  }
+  group_copy(r, &r0);
+  fe_release(mark);
+  return;
+}
+
+// the digits of k for the comb: k + q when k is even, so that the sum is
+// odd, then d = (k - 1) / 2 + 2^(scalar_bits - 1). k = sum (2 d_i - 1) 2^i,
+// so every digit is +1 or -1 and every column adds one entry per table.
+// k + q has to stay below 2^scalar_bits, which the scalar_offset spare bits
+// guarantee. branch free, k is secret
+static void comb_recode(scalar d, const scalar k) {
+  unsigned char even = (k[scalar_bytes - 1] & 1) - 1;  // 0xff if k is even
+  unsigned int carry = 0;
+  for (int i = scalar_bytes - 1; i >= 0; i--) {
+    carry += k[i] + (group_order[i] & even);
+    d[i] = carry;
+    carry >>= 8;
+  }
+  for (unsigned int i = scalar_bytes - 1; i > 0; i--) {
+    d[i] = (d[i] >> 1) | (d[i - 1] << 7);
+  }
+  d[0] = (d[0] >> 1) | 0x80;
+}
+
+// r = a if flag, else r is unchanged, without branching on flag
+static inline void ct_copy(void *r, const void *a, unsigned int len,
+                           unsigned int flag) {
+  unsigned char m = -(unsigned char)(flag & 1);
+  unsigned char *x = r;
+  const unsigned char *y = a;
+  for (unsigned int i = 0; i < len; i++) {
+    x[i] ^= (x[i] ^ y[i]) & m;
+  }
+}
+
+// t = group_comb[c][j], negated if neg. j and neg come from the secret, so
+// every entry of the table is read and the one kept is picked with a mask
+static void comb_lookup(group *t, unsigned int c, unsigned int j,
+                        unsigned int neg) {
+  affine_packed e;
+  fe_packed y;
+  os_memset(&e, 0, sizeof(e));
+  for (unsigned int i = 0; i < comb_entries; i++) {
+    unsigned int x = i ^ j;
+    ct_copy(&e, &group_comb[c][i], sizeof(e),
+            1 ^ ((x | -x) >> (sizeof(x) * 8 - 1)));
+  }
+  fe_load(t->X, e.X);
+  fe_load(t->Y, e.Y);
+  fe_neg(t->Y, t->Y);
+  fe_store(y, t->Y);
+  ct_copy(e.Y, y, sizeof(y), neg);
+  fe_load(t->Y, e.Y);
+}
+
+// k*G with the comb table of the generator. column i of the comb gathers
+// the digits i, i + comb_spacing, i + 2*comb_spacing, ... into one entry per
+// table, so the whole product costs comb_spacing - 1 doublings and
+// comb_tables mixed additions per column, whatever k is
+// columns from, from - 1, ..., from - n + 1 of the comb, added into r
+static void comb_columns(group *r, const scalar k, int from, unsigned int n) {
+
+  scalar d;
+  comb_recode(d, k);
+  unsigned int mark = fe_mark();
+  group r0 = *r, q0, t;
+  group_new(&q0);
+  group_new(&t);
+  fe_load(t.Z, field_one);
+  for (int i = from; i > from - (int)n; i--) {
+    group_dbl(&q0, &r0);
+    group_swap(&r0, &q0);
+    for (unsigned int c = 0; c < comb_tables; c++) {
+      unsigned int j = 0;
+      for (unsigned int b = 0; b < comb_teeth; b++) {
+        j |= scalar_bit(d, comb_spacing * (comb_teeth * c + b) + i) << b;
+      }
+      // with the top digit -1 the entry is the negated one of the other
+      // digits flipped
+      unsigned int top = j >> (comb_teeth - 1);
+      comb_lookup(&t, c, (j ^ (top - 1)) & (comb_entries - 1), top ^ 1);
+      group_madd(&q0, &r0, &t);
+      group_swap(&r0, &q0);
     }
   }
+  group_copy(r, &r0);
+  fe_release(mark);
+  os_memset(d, 0, sizeof(d));
+  return;
+}
+
+void group_scalar_mul_base(group *r, const scalar k) {
+  group_load(r, &group_zero);
+  comb_columns(r, k, comb_spacing - 1, comb_spacing);
   return;
 }
 
 
+#if !defined(CODA_HOST)
 // Ledger uses:
 // - BIP 39 to generate and interpret the master seed, which
 //   produces the 24 words shown on the device at startup.
 // - BIP 32 for HD key derivation (using the child key derivation function)
 // - BIP 44 for HD account derivation (so e.g. btc and coda keys don't clash)
 
-void generate_keypair(unsigned int index, group *pub_key, scalar priv_key) {
+void generate_keypair(unsigned int index, affine *pub_key, scalar priv_key) {
 
   unsigned int bip32_path[5];
   unsigned char chain[32];
@@ -346,77 +891,653 @@ void generate_keypair(unsigned int index, group *pub_key, scalar priv_key) {
                              chain);
   os_memcpy(priv_key + 32, chain, 32);
   os_memcpy(priv_key + 64, chain, 32);
-  priv_key[0] = 0;
-  priv_key[1] &= 0x01;
-  group_scalar_mul(pub_key, priv_key, &group_one);
+  scalar_clear_offset(priv_key);
+  generate_pubkey(pub_key, priv_key);
   return;
 }
 
-void generate_pubkey(group *pub_key, const scalar priv_key) {
-  group_scalar_mul(pub_key, priv_key, &group_one);
+typedef struct key_cache_entry {
+  unsigned int index;
+  unsigned int used;  // key_cache_clock at the last lookup, 0 if free
+  affine pub_key;
+  scalar priv_key;
+} key_cache_entry;
+
+static key_cache_entry key_cache[key_cache_size];
+static unsigned int key_cache_clock;
+static unsigned int key_cache_idle;
+
+// a hit skips the bip32 derivation and the scalar multiplication of the
+// public key, a miss evicts the least recently used entry
+void get_keypair(unsigned int index, affine *pub_key, scalar priv_key) {
+  key_cache_entry *e = &key_cache[0];
+  key_cache_idle = 0;
+  for (unsigned int i = 0; i < key_cache_size; i++) {
+    if (key_cache[i].used && key_cache[i].index == index) {
+      e = &key_cache[i];
+      break;
+    }
+    if (key_cache[i].used < e->used) {
+      e = &key_cache[i];
+    }
+  }
+  if (!e->used || e->index != index) {
+    e->used = 0;
+    generate_keypair(index, &e->pub_key, e->priv_key);
+    e->index = index;
+  }
+  e->used = ++key_cache_clock;
+  os_memcpy(pub_key, &e->pub_key, sizeof(affine));
+  os_memcpy(priv_key, e->priv_key, scalar_bytes);
+}
+
+void key_cache_clear(void) {
+  os_memset(key_cache, 0, sizeof(key_cache));
+  key_cache_clock = 0;
+  key_cache_idle = 0;
+}
+
+void key_cache_tick(void) {
+  if (key_cache_clock != 0 && ++key_cache_idle >= key_cache_timeout) {
+    key_cache_clear();
+  }
+}
+
+// public keys are not secret, so unlike the ram cache they may outlive the
+// session. an entry is written with a single nvm_write, and check ties it to
+// the seed: it is the start of sha256(fingerprint || index || pub_key), so a
+// torn write, an entry of another seed and the zeroed table all fail it
+typedef struct pubkey_store_entry {
+  unsigned int index;
+  affine pub_key;
+  unsigned char check[8];
+} pubkey_store_entry;
+
+typedef struct pubkey_store {
+  pubkey_store_entry entries[pubkey_store_size];
+} pubkey_store;
+
+// public key table in flash. const and N_ variable name are mandatory here
+static const pubkey_store N_pubkey_store_real;
+#define N_pubkey_store (*(volatile pubkey_store *)PIC(&N_pubkey_store_real))
+
+static unsigned char pubkey_store_fingerprint[32];
+static unsigned int pubkey_store_bound;
+
+// sha256 of the secp256k1 public key of the 44'/49370' node, the parent of
+// every account: it changes with the seed, and only a public value of it is
+// hashed. once per launch, the seed cannot change while the app runs
+static void pubkey_store_bind(void) {
+  unsigned int bip32_path[2];
+  unsigned char node[64];
+  cx_ecfp_private_key_t sk;
+  cx_ecfp_public_key_t pk;
+
+  bip32_path[0] = 44 | 0x80000000;
+  bip32_path[1] = 49370 | 0x80000000;
+
+  os_perso_derive_node_bip32(CX_CURVE_256K1, bip32_path,
+                             sizeof(bip32_path) / sizeof(bip32_path[0]),
+                             node, node + 32);
+  cx_ecfp_init_private_key(CX_CURVE_256K1, node, 32, &sk);
+  cx_ecfp_generate_pair(CX_CURVE_256K1, &pk, &sk, 1);
+  os_memset(node, 0, sizeof(node));
+  os_memset(&sk, 0, sizeof(sk));
+  cx_hash_sha256(pk.W, pk.W_len, pubkey_store_fingerprint, 32);
+  pubkey_store_bound = 1;
+}
+
+static void pubkey_store_check(unsigned char check[8], const pubkey_store_entry *e) {
+  unsigned char in[32 + sizeof(e->index) + sizeof(affine)];
+  unsigned char h[32];
+  os_memmove(in, pubkey_store_fingerprint, 32);
+  os_memmove(in + 32, &e->index, sizeof(e->index));
+  os_memmove(in + 32 + sizeof(e->index), &e->pub_key, sizeof(affine));
+  cx_hash_sha256(in, sizeof(in), h, sizeof(h));
+  os_memmove(check, h, 8);
+}
+
+static unsigned int pubkey_store_valid(unsigned int i) {
+  pubkey_store_entry e;
+  unsigned char check[8];
+  os_memmove(&e, (const void *)&N_pubkey_store.entries[i], sizeof(e));
+  pubkey_store_check(check, &e);
+  return os_memcmp(check, e.check, sizeof(check)) == 0;
+}
+
+unsigned int pubkey_store_lookup(unsigned int index, affine *pub_key) {
+  if (!pubkey_store_bound) {
+    pubkey_store_bind();
+  }
+  for (unsigned int i = 0; i < pubkey_store_size; i++) {
+    if (N_pubkey_store.entries[i].index == index && pubkey_store_valid(i)) {
+      os_memcpy(pub_key, (const void *)&N_pubkey_store.entries[i].pub_key, sizeof(affine));
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// a miss costs one nvm_write: the key goes to the first entry that fails its
+// check, or, with the table full, to the entry index % pubkey_store_size
+void get_pubkey(unsigned int index, affine *pub_key) {
+  pubkey_store_entry e;
+  scalar priv_key;
+  unsigned int slot = index % pubkey_store_size;
+
+  if (pubkey_store_lookup(index, pub_key)) {
+    return;
+  }
+
+  // derived here rather than through get_keypair, so that showing an
+  // address leaves no private key in the ram cache
+  generate_keypair(index, pub_key, priv_key);
+  os_memset(priv_key, 0, scalar_bytes);
+
+  for (unsigned int i = 0; i < pubkey_store_size; i++) {
+    if (!pubkey_store_valid(i)) {
+      slot = i;
+      break;
+    }
+  }
+  os_memset(&e, 0, sizeof(e));
+  e.index = index;
+  os_memcpy(&e.pub_key, pub_key, sizeof(affine));
+  pubkey_store_check(e.check, &e);
+  nvm_write((void *)&N_pubkey_store.entries[slot], &e, sizeof(e));
+}
+
+#endif // CODA_HOST
+
+// keys have scalar_bits - scalar_offset used bits, as in the double-and-add
+// that generate_pubkey used before the comb, which skipped the top
+// scalar_offset bits. the comb reads every bit, so they are cleared first and
+// keys derived with them set keep the public keys they always had
+void scalar_clear_offset(scalar k) {
+  for (unsigned int i = 0; i < scalar_offset; i++) {
+    k[i / 8] &= ~(0x80 >> (i % 8));
+  }
+}
+
+void generate_pubkey(affine *pub_key, const scalar priv_key) {
+  scalar k;
+  os_memcpy(k, priv_key, scalar_bytes);
+  scalar_clear_offset(k);
+  fe_begin();
+  group r;
+  group_new(&r);
+  group_scalar_mul_base(&r, k);
+  projective_to_affine(pub_key, &r);
+  fe_end();
   return;
 }
 
-inline unsigned int is_odd(const field y) {
+static inline unsigned int is_odd(const field y) {
   return (y[field_bytes - 1] & 1);
 }
 
+// r = sqrt(a) by tonelli-shanks, p - 1 = 2^field_two_adicity t. returns 0,
+// with r left undefined, if a is not a square. the powers c^(2^j) the steps
+// need come from field_sqrt_roots rather than from squaring c again
+static unsigned int fe_sqrt(fe r, const fe a) {
+  if (fe_is_zero(a)) {
+    fe_copy(r, a);
+    return 1;
+  }
+
+  unsigned int mark = fe_mark();
+  fe b = fe_new(), g = fe_new(), one = fe_new();
+  fe_load(one, field_one);
+  fe_pow(g, a, field_sqrt_e, field_bytes); // a^((t - 1)/2)
+  fe_mul(r, a, g);                         // r = a^((t + 1)/2)
+  fe_mul(b, r, g);                         // b = a^t, r^2 = ab
+
+  // b has order 2^i < 2^m, each step keeps r^2 = ab and lowers the order.
+  // c, of order 2^m, is c^(2^(field_two_adicity - m)) of the table's c
+  unsigned int m = field_two_adicity, ok = 1;
+  while (!fe_eq(b, one)) {
+    unsigned int i = 0;
+    fe_copy(g, b);
+    do {
+      fe_sq(g, g);
+      i++;
+    } while (!fe_eq(g, one) && i < m);
+    if (i == m) {
+      ok = 0;                              // a^((p - 1)/2) = -1
+      break;
+    }
+    fe_load(g, field_sqrt_roots[field_two_adicity - i - 1]);
+    fe_mul(r, r, g);                       // r c^(2^(m - i - 1))
+    fe_load(g, field_sqrt_roots[field_two_adicity - i]);
+    fe_mul(b, b, g);                       // b c^(2^(m - i))
+    m = i;
+  }
+  fe_release(mark);
+  return ok;
+}
+
+// (x : y : 1) with the even y of y^2 = x^3 + ax + b, the point of which a
+// signature only carries x. returns 0 if x is not reduced or not the x of a
+// point
+unsigned int group_lift_x(group *r, const field x) {
+  if (os_memcmp(x, field_modulus, field_bytes) >= 0) {
+    return 0;
+  }
+
+  unsigned int mark = fe_mark();
+  fe t = fe_new();
+  fe_from_bytes(r->X, x);
+  fe_load(r->Z, group_coeff_a);
+  fe_sq(t, r->X);
+  fe_add(t, t, r->Z);                  // x^2 + a
+  fe_mul(t, t, r->X);                  // x^3 + ax
+  fe_load(r->Z, group_coeff_b);
+  fe_add(t, t, r->Z);                  // x^3 + ax + b
+  unsigned int ok = fe_sqrt(r->Y, t);
+  if (ok) {
+    field y;
+    fe_to_bytes(y, r->Y);
+    if (is_odd(y)) {
+      fe_neg(r->Y, r->Y);
+    }
+    fe_load(r->Z, field_one);
+  }
+  fe_release(mark);
+  return ok;
+}
+
+// 0x02 or 0x03 for the parity of y, then x, as in sec1
+void affine_compress(unsigned char *out, const affine *p) {
+  out[0] = 0x02 | is_odd(p->y);
+  os_memcpy(out + 1, p->x, field_bytes);
+  return;
+}
+
+// group_lift_x, with y negated when its parity is not the one asked for
+unsigned int affine_decompress(affine *p, const unsigned char *in) {
+  if ((in[0] & 0xfe) != 0x02) {
+    return 0;
+  }
+  fe_begin();
+  group r;
+  group_new(&r);
+  unsigned int ok = group_lift_x(&r, in + 1);
+  if (ok) {
+    if (in[0] & 1) {
+      fe_neg(r.Y, r.Y);
+    }
+    fe_to_bytes(p->x, r.X);
+    fe_to_bytes(p->y, r.Y);
+  }
+  fe_end();
+  return ok;
+}
+
 void schnorr_hash(scalar out, const scalar in0, const scalar in1, const scalar in2, const scalar in3, const scalar in4) {
 
-  // state after applying {{0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x65, 0x72, 0x75,
-  //             0x74, 0x61, 0x6e, 0x67, 0x69, 0x53, 0x61, 0x64, 0x6f, 0x43}, {0}};
-
-  state pos = {
-    {0x00, 0x00, 0x7f, 0x09, 0x99, 0x18, 0x66, 0x1d, 0x97, 0xba, 0x00, 0x3b,
-     0x4f, 0x1f, 0x75, 0x89, 0xa3, 0x6d, 0x78, 0x34, 0x9f, 0xe8, 0x71, 0x4a,
-     0x54, 0x82, 0x50, 0x16, 0x91, 0xe7, 0x5d, 0x2c, 0x9b, 0x80, 0xa8, 0xe7,
-     0x19, 0xce, 0x79, 0x0f, 0xb6, 0xa6, 0x18, 0xbf, 0x74, 0x17, 0x1c, 0xad,
-     0x89, 0x8d, 0x6d, 0x88, 0x40, 0x22, 0xdc, 0x0c, 0xfc, 0xb1, 0x5d, 0x26,
-     0x35, 0x7f, 0x60, 0x33, 0xaa, 0xb8, 0xea, 0x63, 0xac, 0x4f, 0x5f, 0x4a,
-     0xcf, 0x81, 0x22, 0xff, 0x95, 0x65, 0x50, 0xb5, 0xc1, 0x2a, 0x5b, 0x77,
-     0xd0, 0xc4, 0x0b, 0x46, 0xd4, 0x30, 0xd1, 0x25, 0x20, 0x42, 0x5c, 0x0e},
-    {0x00, 0x01, 0x29, 0x57, 0xcc, 0x2b, 0x6a, 0x18, 0x70, 0x5d, 0x87, 0x83,
-     0x6b, 0xe5, 0xd2, 0x5e, 0xc0, 0x0f, 0x48, 0x47, 0xcc, 0x28, 0x06, 0x11,
-     0xbf, 0xaa, 0xc3, 0x4e, 0xf9, 0x1b, 0xfe, 0x8c, 0xa1, 0x0d, 0x50, 0x73,
-     0x17, 0x53, 0x62, 0xe7, 0x16, 0x43, 0xb1, 0x36, 0x5b, 0x7a, 0x2e, 0xf6,
-     0xaf, 0xf9, 0x54, 0x39, 0x62, 0x73, 0xab, 0x3d, 0xff, 0x49, 0xcf, 0xc4,
-     0x2e, 0x48, 0x15, 0xde, 0xc4, 0x99, 0xfe, 0x23, 0x52, 0xac, 0x0f, 0x06,
-     0x9f, 0x71, 0x3a, 0x81, 0x4b, 0x2a, 0x18, 0x4f, 0xfe, 0x37, 0xfa, 0x7b,
-     0xa6, 0x1b, 0x8b, 0xc0, 0x4d, 0x91, 0x6b, 0x1c, 0x4c, 0xcf, 0xaa, 0x3b},
-    {0x00, 0x00, 0x19, 0xe6, 0x2b, 0x5c, 0xdc, 0xc0, 0x0d, 0x53, 0x68, 0x94,
-     0xc2, 0xfe, 0x86, 0x86, 0x5e, 0x15, 0xde, 0xea, 0x59, 0xc9, 0x7d, 0x6a,
-     0xe8, 0xd4, 0xba, 0xcb, 0x6f, 0xe2, 0xda, 0x03, 0xa7, 0xd2, 0xe0, 0x17,
-     0x47, 0xb7, 0xe4, 0x1f, 0xd6, 0x4e, 0xce, 0xf2, 0x49, 0x56, 0xa8, 0xdb,
-     0x2f, 0xfd, 0x2a, 0x96, 0x1d, 0x3c, 0x37, 0x0b, 0x47, 0x85, 0xb0, 0xb0,
-     0x6f, 0x11, 0xaa, 0xfa, 0x68, 0xf6, 0xcf, 0x97, 0x99, 0xc1, 0xf7, 0x4d,
-     0x27, 0x01, 0x79, 0xb5, 0x26, 0x1c, 0x35, 0xfc, 0x31, 0x71, 0x59, 0xd9,
-     0x43, 0xad, 0x1f, 0xa4, 0x9f, 0xe8, 0xc9, 0x48, 0x13, 0xdd, 0x24, 0x0a}};
-
-  poseidon_2in(pos, in0, in1);
-  poseidon_2in(pos, in2, in3);
-  poseidon_1in(pos, in4);
-  poseidon_digest(pos, out);
+  poseidon_sponge pos;
+  poseidon_init(&pos, schnorr_state);
+  poseidon_absorb(&pos, in0);
+  poseidon_absorb(&pos, in1);
+  poseidon_absorb(&pos, in2);
+  poseidon_absorb(&pos, in3);
+  poseidon_absorb(&pos, in4);
+  poseidon_squeeze(&pos, out);
   return;
 }
 
-void sign(field rx, scalar s, const group *public_key, const scalar private_key, const scalar msgx, const scalar msgm) {
-  scalar k_prime;
-  /* rx is G_io_apdu_buffer so we can take 192 bytes from it */
-  {
-    group *r;
-    r = (group *) rx;
-    schnorr_hash(k_prime, msgx, msgm, public_key->x, public_key->y, private_key);   // k = hash(m || pkx || pky || sk)
-    group_scalar_mul(r, k_prime, &group_one);                                       // r = k*g
+// step 0 is the nonce, steps 1 to comb_spacing are the columns of k*G,
+// sign_step_columns at a time, and the last one the challenge
+void sign_start(sign_state *st) {
+  os_memset(st, 0, sizeof(sign_state));
+  os_memcpy(&st->u.r, &group_zero, sizeof(group_packed));
+  return;
+}
 
-    if (is_odd(r->y)) {
-      scalar_sub(k_prime, group_order, k_prime);                                    // if ry is odd, k = - k'
+unsigned int sign_step(sign_state *st, const affine *public_key,
+                       const scalar private_key, const scalar msgx,
+                       const scalar msgm) {
+  if (st->step > comb_spacing + 1) {
+    return 1;
+  }
+  fe_begin();
+  if (st->step == 0) {
+    schnorr_hash(st->k, msgx, msgm, public_key->x, public_key->y,
+                 private_key);                    // k = hash(m || pkx || pky || sk)
+    st->step = 1;
+  } else if (st->step <= comb_spacing) {
+    unsigned int n = comb_spacing + 1 - st->step;
+    if (n > sign_step_columns) {
+      n = sign_step_columns;
+    }
+    group r;
+    group_new(&r);
+    group_load(&r, &st->u.r);
+    comb_columns(&r, st->k, comb_spacing - st->step, n);  // r = k*g
+    group_store(&st->u.r, &r);
+    st->step += n;
+  } else {
+    // into locals first: an exception here leaves st as it was, so the step
+    // can be run again without negating k twice
+    scalar k, e;
+    field rx;
+    group r;
+    group_new(&r);
+    group_load(&r, &st->u.r);
+    group_normalize(&r, &r);
+
+    os_memcpy(k, st->k, scalar_bytes);
+    fe_to_bytes(rx, r.Y);
+    if (is_odd(rx)) {
+      scalar_sub(k, group_order, k);              // if ry is odd, k = - k'
     }
-    /* store so we don't need group *r anymore */
-    os_memcpy(rx, r->x, field_bytes);
+    fe_to_bytes(rx, r.X);
+    schnorr_hash(e, msgx, public_key->x, public_key->y, rx,
+                 msgm);                           // e = hash(x || pkx || pky || xr || m)
+    os_memcpy(e, scalar_zero, (scalar_bytes - 16)); // use 128 LSB as challenge
+
+    os_memcpy(st->k, k, scalar_bytes);
+    os_memcpy(st->u.c.e, e, scalar_bytes);
+    os_memcpy(st->u.c.rx, rx, field_bytes);
+    st->step++;
+  }
+  fe_end();
+  return st->step > comb_spacing + 1;
+}
+
+void sign_finish(field rx, scalar s, const sign_state *st,
+                 const scalar private_key) {
+  os_memcpy(rx, st->u.c.rx, field_bytes);
+  scalar_mul(s, st->u.c.e, private_key);              // e*sk
+  scalar_add(s, st->k, s);                        // k + e*sk
+  return;
+}
+
+void sign(field rx, scalar s, const affine *public_key,
+          const scalar private_key, const scalar msgx, const scalar msgm) {
+  sign_state st;
+  sign_start(&st);
+  while (!sign_step(&st, public_key, private_key, msgx, msgm)) {
   }
-  schnorr_hash(s, msgx, public_key->x, public_key->y, rx, msgm);                    // e = hash(x || pkx || pky || xr || m)
-  os_memcpy(s, scalar_zero, (scalar_bytes - 16));                                   // use 128 LSB as challenge
-  scalar_mul(s, s, private_key);                                                    // e*sk
-  scalar_add(s, k_prime, s);                                                        // k + e*sk
+  sign_finish(rx, s, &st, private_key);
+  os_memset(&st, 0, sizeof(st));
   return;
 }
+
+// the check of the verifier, with the same challenge as sign: R = s*G - e*P
+// must not be zero, must have an even y, and must have x = rx. s*G and e*(-P)
+// are computed together by group_double_scalar_mul
+unsigned int schnorr_verify(const field rx, const scalar s,
+                            const affine *public_key, const scalar msgx,
+                            const scalar msgm) {
+  if (os_memcmp(s, group_order, scalar_bytes) >= 0) {
+    return 0;
+  }
+
+  scalar e;
+  schnorr_hash(e, msgx, public_key->x, public_key->y, rx,
+               msgm);                             // e = hash(x || pkx || pky || xr || m)
+  os_memcpy(e, scalar_zero, (scalar_bytes - 16)); // use 128 LSB as challenge
+
+  unsigned int ok;
+  field ry;
+  fe_begin();
+  {
+    unsigned int mark = fe_mark();
+    group r;
+    group_new(&r);
+
+    group_packed neg_pub_key;
+    affine_to_projective(&r, public_key);
+    ok = !is_zero(&r) && is_on_curve(&r);
+    fe_neg(r.Y, r.Y);                             // -P
+    group_store(&neg_pub_key, &r);
+
+    if (ok) {
+      group_double_scalar_mul(&r, s, &group_one, e, &neg_pub_key);
+      ok = !is_zero(&r);
+    }
+    if (ok) {
+      group_normalize(&r, &r);
+      fe_to_bytes(ry, r.Y);
+      ok = !is_odd(ry);
+      fe_to_bytes(ry, r.X);
+      ok = ok && (os_memcmp(ry, rx, field_bytes) == 0);
+    }
+    fe_release(mark);
+  }
+  fe_end();
+  return ok;
+}
+
+#if defined(CODA_HOST)
+
+// batch verification, for a backend that checks many signatures at a time.
+// it allocates, so it is only built on the host
+
+// the pippenger window for n points, about log2(n) - 2 bits
+static unsigned int msm_window(unsigned int n) {
+  unsigned int c = 2;
+  while (c < 16 && (1u << (c + 3)) <= n) {
+    c++;
+  }
+  return c;
+}
+
+// bits lo, ..., lo + c - 1 of k
+static unsigned int scalar_window(const scalar k, unsigned int lo,
+                                  unsigned int c) {
+  unsigned int d = 0;
+  for (unsigned int i = c; i-- > 0;) {
+    d = (d << 1) | ((lo + i < scalar_bits) ? scalar_bit(k, lo + i) : 0);
+  }
+  return d;
+}
+
+// r = sum k[i] p[i] with pippenger's buckets: each window of c bits sorts
+// the points by their digit into 2^c - 1 buckets, one mixed addition per
+// point, and a running sum over the buckets from the top weighs bucket d by
+// d with two additions per bucket. the buckets and the result stay packed in
+// memory so only four points are resident
+static void msm(group_packed *r, unsigned int n, const scalar *k,
+                const affine_packed *p) {
+  unsigned int c = msm_window(n), buckets = (1 << c) - 1;
+  group_packed *bucket = malloc(buckets * sizeof(group_packed));
+  unsigned char *used = malloc(buckets);
+  if (bucket == NULL || used == NULL) {
+    THROW(EXCEPTION_OVERFLOW);
+  }
+
+  group_packed acc = group_zero;
+  unsigned int mark = fe_mark();
+  group a, b, t, q0;
+  group_new(&a);
+  group_new(&b);
+  group_new(&t);
+  group_new(&q0);
+
+  for (int w = (scalar_bits + c - 1) / c - 1; w >= 0; w--) {
+    os_memset(used, 0, buckets);
+    for (unsigned int i = 0; i < n; i++) {
+      unsigned int d = scalar_window(k[i], w * c, c);
+      if (d == 0) {
+        continue;
+      }
+      fe_load(b.X, p[i].X);
+      fe_load(b.Y, p[i].Y);
+      fe_load(b.Z, field_one);
+      if (used[d - 1]) {
+        group_load(&a, &bucket[d - 1]);
+        group_madd(&t, &a, &b);
+        group_store(&bucket[d - 1], &t);
+      } else {
+        group_store(&bucket[d - 1], &b);
+        used[d - 1] = 1;
+      }
+    }
+
+    // a = the buckets from d up, t = the sum of a over d
+    group_load(&a, &group_zero);
+    group_load(&t, &group_zero);
+    for (unsigned int d = buckets; d > 0; d--) {
+      if (used[d - 1]) {
+        group_load(&b, &bucket[d - 1]);
+        group_add(&q0, &a, &b);
+        group_swap(&a, &q0);
+      }
+      group_add(&q0, &t, &a);
+      group_swap(&t, &q0);
+    }
+
+    // acc = 2^c acc + t
+    group_load(&a, &acc);
+    for (unsigned int i = 0; i < c; i++) {
+      group_dbl(&q0, &a);
+      group_swap(&a, &q0);
+    }
+    group_add(&q0, &a, &t);
+    group_store(&acc, &q0);
+  }
+  *r = acc;
+  fe_release(mark);
+  free(bucket);
+  free(used);
+}
+
+// what the batch equation needs of one signature: its weight z, z*e and z*s
+// mod q, and the points -P and -R
+typedef struct batch_term {
+  scalar z;
+  scalar ze;
+  scalar zs;
+  affine_packed np;
+  affine_packed nr;
+} batch_term;
+
+// whether sum z_i (s_i G - e_i P_i - R_i) = 0 over the signatures idx[0..m),
+// as one msm of 2m + 1 points
+static unsigned int batch_check(const batch_term *term,
+                                const unsigned int *idx, unsigned int m) {
+  unsigned int n = 2 * m + 1;
+  scalar *k = malloc(n * sizeof(scalar));
+  affine_packed *p = malloc(n * sizeof(affine_packed));
+  if (k == NULL || p == NULL) {
+    THROW(EXCEPTION_OVERFLOW);
+  }
+
+  os_memcpy(k[0], scalar_zero, scalar_bytes);
+  os_memcpy(p[0].X, group_one.X, sizeof(fe_packed));
+  os_memcpy(p[0].Y, group_one.Y, sizeof(fe_packed));
+  for (unsigned int i = 0; i < m; i++) {
+    const batch_term *b = &term[idx[i]];
+    scalar_add(k[0], k[0], b->zs);
+    os_memcpy(k[2 * i + 1], b->ze, scalar_bytes);
+    p[2 * i + 1] = b->np;
+    os_memcpy(k[2 * i + 2], b->z, scalar_bytes);
+    p[2 * i + 2] = b->nr;
+  }
+
+  group_packed sum;
+  msm(&sum, n, k, p);
+  unsigned int mark = fe_mark();
+  group r;
+  group_new(&r);
+  group_load(&r, &sum);
+  unsigned int zero = is_zero(&r);
+  fe_release(mark);
+  free(k);
+  free(p);
+  return zero;
+}
+
+// sets ok[] for the signatures idx[0..m): a half that sums to zero is all
+// good, a single signature that does not is bad. known_bad skips the check
+// of a half that has to fail because its sibling passed. returns 1 if all
+// of idx[] are good
+static unsigned int batch_bisect(const batch_term *term,
+                                 const unsigned int *idx, unsigned int m,
+                                 unsigned int known_bad, unsigned char *ok) {
+  if (m == 0) {
+    return 1;
+  }
+  if (!known_bad && batch_check(term, idx, m)) {
+    for (unsigned int i = 0; i < m; i++) {
+      ok[idx[i]] = 1;
+    }
+    return 1;
+  }
+  if (m == 1) {
+    ok[idx[0]] = 0;
+    return 0;
+  }
+  unsigned int half = m / 2;
+  unsigned int left = batch_bisect(term, idx, half, 0, ok);
+  batch_bisect(term, idx + half, m - half, left, ok);
+  return 0;
+}
+
+// checks n signatures at once. with random 128 bit weights z_i they are all
+// valid, but with probability about 2^-128, iff
+//   (sum z_i s_i) G - sum (z_i e_i) P_i - sum z_i R_i = 0
+// where R_i is rx_i lifted with the even y: one msm of 2n + 1 points instead
+// of n double scalar multiplications. a batch that fails is bisected to find
+// the bad signatures. ok[i] tells each one, the result is 1 iff all are valid
+unsigned int schnorr_batch_verify(unsigned int n, const message *msgs,
+                                  const affine *pks, const signature *sigs,
+                                  unsigned char *ok) {
+  batch_term *term = malloc(n * sizeof(batch_term));
+  unsigned int *idx = malloc(n * sizeof(unsigned int));
+  FILE *rng = fopen("/dev/urandom", "rb");
+  if (term == NULL || idx == NULL || rng == NULL) {
+    THROW(EXCEPTION_OVERFLOW);
+  }
+
+  // the checks of schnorr_verify that do not need the msm
+  unsigned int m = 0;
+  fe_begin();
+  unsigned int mark = fe_mark();
+  group g;
+  group_new(&g);
+  for (unsigned int i = 0; i < n; i++) {
+    batch_term *b = &term[i];
+    ok[i] = 0;
+    if (os_memcmp(sigs[i].s, group_order, scalar_bytes) >= 0) {
+      continue;
+    }
+    affine_to_projective(&g, &pks[i]);
+    if (is_zero(&g) || !is_on_curve(&g)) {
+      continue;
+    }
+    fe_neg(g.Y, g.Y);
+    fe_store(b->np.X, g.X);
+    fe_store(b->np.Y, g.Y);
+    if (!group_lift_x(&g, sigs[i].rx)) {
+      continue;
+    }
+    fe_neg(g.Y, g.Y);
+    fe_store(b->nr.X, g.X);
+    fe_store(b->nr.Y, g.Y);
+
+    scalar e;
+    schnorr_hash(e, msgs[i].x, pks[i].x, pks[i].y, sigs[i].rx, msgs[i].m);
+    os_memcpy(e, scalar_zero, (scalar_bytes - 16));
+    os_memset(b->z, 0, scalar_bytes);
+    if (fread(b->z + scalar_bytes - 16, 1, 16, rng) != 16) {
+      THROW(EXCEPTION_OVERFLOW);
+    }
+    b->z[scalar_bytes - 1] |= 1;                  // z != 0
+    scalar_mul(b->ze, b->z, e);
+    scalar_mul(b->zs, b->z, sigs[i].s);
+    idx[m++] = i;
+  }
+  fe_release(mark);
+
+  unsigned int all = batch_bisect(term, idx, m, 0, ok) && (m == n);
+  fe_end();
+  fclose(rng);
+  free(term);
+  free(idx);
+  return all;
+}
+
+#endif // CODA_HOST
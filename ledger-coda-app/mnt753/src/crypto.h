@@ -3,32 +3,155 @@
 
 #define field_bytes 96
 #define scalar_bytes 96
-#define group_bytes 192
+#define group_bytes 288
+#define affine_bytes 192
 #define scalar_bits 768   // scalar_bytes * 8
 #define scalar_offset 15  // scalars have 753 ( = 768 - 15 ) used bits
 
 typedef unsigned char field[field_bytes];
 typedef unsigned char scalar[scalar_bytes];
 
+#include "field.h"
+
+// jacobian coordinates, resident field elements (see field.h)
 typedef struct group {
+  fe X;
+  fe Y;
+  fe Z;
+} group;
+
+// the same, packed, for the constant tables
+typedef struct group_packed {
+  fe_packed X;
+  fe_packed Y;
+  fe_packed Z;
+} group_packed;
+
+// a Z = 1 point, packed, for the comb table of group_scalar_mul_base
+typedef struct affine_packed {
+  fe_packed X;
+  fe_packed Y;
+} affine_packed;
+
+// the comb splits a scalar into comb_teeth * comb_tables teeth, comb_spacing
+// bits apart (gen_tables.py has the same values)
+#define comb_teeth   4
+#define comb_tables  4
+#define comb_spacing (scalar_bits / (comb_teeth * comb_tables))
+#define comb_entries (1 << (comb_teeth - 1))
+
+// window of group_scalar_mul_wnaf: 2^(wnaf_width - 2) odd multiples of the
+// base, 288 bytes each, on the stack
+#define wnaf_width   3
+
+// canonical bytes, what goes over the wire
+typedef struct affine {
   field x;
   field y;
-} group;
+} affine;
 
 typedef struct signature {
   field rx;
   scalar s;
 } signature;
 
-void field_add(field c, const field a, const field b);
-void field_mul(field c, const field a, const field b);
-void field_pow(field c, const field a, const field e);
+// the two message fields sign hashes, msgx and msgm
+typedef struct message {
+  scalar x;
+  scalar m;
+} message;
 
+// fnv-1a, for the checksums gen_tables.py writes with the constant tables
+#define tables_checksum_init 0x811c9dc5
+unsigned int tables_checksum(unsigned int h, const void *p, unsigned int len);
+unsigned int curve_tables_ok(void);
+
+void scalar_add(scalar c, const scalar a, const scalar b);
+void scalar_sub(scalar c, const scalar a, const scalar b);
+void scalar_mul(scalar c, const scalar a, const scalar b);
+void scalar_sq(scalar c, const scalar a);
+void scalar_pow(scalar c, const scalar a, const scalar e);
+
+void group_new(group *r);
+void group_load(group *r, const group_packed *p);
+void group_copy(group *r, const group *p);
+void group_store(group_packed *r, const group *p);
+void group_add(group *c, const group *a, const group *b);
+void group_madd(group *c, const group *a, const group *b);
+void group_dbl(group *c, const group *a);
+void group_scalar_mul_base(group *r, const scalar k);
+#if defined(CODA_HOST)
 void group_scalar_mul(group *r, const scalar k, const group *p);
-void generate_pubkey(group *pub_key, const scalar priv_key);
-void generate_keypair(unsigned int index, group *pub_key, scalar priv_key);
+void group_scalar_mul_wnaf(group *r, const scalar k, const group *p);
+#endif
+void group_double_scalar_mul(group *r, const scalar k1, const group_packed *p1,
+    const scalar k2, const group_packed *p2);
+void affine_to_projective(group *r, const affine *p);
+void projective_to_affine(affine *p, const group *r);
+void group_normalize(group *r, const group *p);
+unsigned int group_lift_x(group *r, const field x);
+
+// a point in compressed_bytes, the parity of y then x. affine_decompress
+// returns 0 if in is not the encoding of a point
+#define compressed_bytes (field_bytes + 1)
+void affine_compress(unsigned char *out, const affine *p);
+unsigned int affine_decompress(affine *p, const unsigned char *in);
+void scalar_clear_offset(scalar k);
+void generate_pubkey(affine *pub_key, const scalar priv_key);
+void generate_keypair(unsigned int index, affine *pub_key, scalar priv_key);
+
+// get_keypair is generate_keypair behind a cache of the last key_cache_size
+// accounts, about 600 bytes of ram. the cache is zeroized by key_cache_clear
+// (app exit, usb reset) and by key_cache_tick after key_cache_timeout ticks
+// of 100 ms without a lookup, 5 minutes unless set from the Makefile
+#define key_cache_size 2
+#ifndef key_cache_timeout
+#define key_cache_timeout 3000
+#endif
+void get_keypair(unsigned int index, affine *pub_key, scalar priv_key);
+void key_cache_clear(void);
+void key_cache_tick(void);
 
-void sign(field rx, scalar s, const group *public_key, const scalar private_key,
+// get_pubkey answers from a table of pubkey_store_size public keys kept in
+// flash across launches, falling back to get_keypair and filling the table.
+// each entry is bound to a fingerprint of the seed and ignored on a mismatch
+#define pubkey_store_size 4
+void get_pubkey(unsigned int index, affine *pub_key);
+// the table alone, without deriving or filling it on a miss
+unsigned int pubkey_store_lookup(unsigned int index, affine *pub_key);
+
+// sign in parts, for the device to compute the nonce and the challenge while
+// the message is on screen: sign_start, sign_step until it returns 1, then
+// sign_finish once approved. each step is its own field arithmetic session
+// and at most a hash or sign_step_columns columns of the comb. sign runs the
+// three back to back
+typedef struct sign_state {
+  unsigned int step;
+  scalar k;
+  union {
+    group_packed r;  // k*G so far, until the last step
+    struct {
+      scalar e;
+      field rx;
+    } c;             // the challenge and r.x, written by the last step
+  } u;
+} sign_state;
+
+#define sign_step_columns 2
+
+void sign_start(sign_state *st);
+unsigned int sign_step(sign_state *st, const affine *public_key,
+    const scalar private_key, const scalar msgx, const scalar msgm);
+void sign_finish(field rx, scalar s, const sign_state *st,
+    const scalar private_key);
+void sign(field rx, scalar s, const affine *public_key, const scalar private_key,
     const scalar msgx, const scalar msgm);
+unsigned int schnorr_verify(const field rx, const scalar s,
+    const affine *public_key, const scalar msgx, const scalar msgm);
+
+#if defined(CODA_HOST)
+unsigned int schnorr_batch_verify(unsigned int n, const message *msgs,
+    const affine *pks, const signature *sigs, unsigned char *ok);
+#endif
 
 #endif // CODA_CRYPTO
@@ -0,0 +1,1412 @@
+// generated by gen_tables.py, do not edit
+
+#ifndef CURVE_TABLES
+#define CURVE_TABLES
+
+#include "crypto.h"
+#include "poseidon.h"
+
+#if field_bytes != 96
+#error "field_bytes differs from gen_tables.py"
+#endif
+#if comb_teeth != 4
+#error "comb_teeth differs from gen_tables.py"
+#endif
+#if comb_tables != 4
+#error "comb_tables differs from gen_tables.py"
+#endif
+
+static const field field_modulus = {
+    0x00, 0x01, 0xc4, 0xc6, 0x2d, 0x92, 0xc4, 0x11, 0x10, 0x22, 0x90, 0x22,
+    0xee, 0xe2, 0xcd, 0xad, 0xb7, 0xf9, 0x97, 0x50, 0x5b, 0x8f, 0xaf, 0xed,
+    0x5e, 0xb7, 0xe8, 0xf9, 0x6c, 0x97, 0xd8, 0x73, 0x07, 0xfd, 0xb9, 0x25,
+    0xe8, 0xa0, 0xed, 0x8d, 0x99, 0xd1, 0x24, 0xd9, 0xa1, 0x5a, 0xf7, 0x9d,
+    0xb2, 0x6c, 0x5c, 0x28, 0xc8, 0x59, 0xa9, 0x9b, 0x3e, 0xeb, 0xca, 0x94,
+    0x29, 0x21, 0x26, 0x36, 0xb9, 0xdf, 0xf9, 0x76, 0x34, 0x99, 0x3a, 0xa4,
+    0xd6, 0xc3, 0x81, 0xbc, 0x3f, 0x00, 0x57, 0x97, 0x4e, 0xa0, 0x99, 0x17,
+    0x0f, 0xa1, 0x3a, 0x4f, 0xd9, 0x07, 0x76, 0xe2, 0x40, 0x00, 0x00, 0x01};
+static const scalar group_order = {
+    0x00, 0x01, 0xc4, 0xc6, 0x2d, 0x92, 0xc4, 0x11, 0x10, 0x22, 0x90, 0x22,
+    0xee, 0xe2, 0xcd, 0xad, 0xb7, 0xf9, 0x97, 0x50, 0x5b, 0x8f, 0xaf, 0xed,
+    0x5e, 0xb7, 0xe8, 0xf9, 0x6c, 0x97, 0xd8, 0x73, 0x07, 0xfd, 0xb9, 0x25,
+    0xe8, 0xa0, 0xed, 0x8d, 0x99, 0xd1, 0x24, 0xd9, 0xa1, 0x5a, 0xf7, 0x9d,
+    0xb1, 0x17, 0xe7, 0x76, 0xf2, 0x18, 0x05, 0x9d, 0xb8, 0x0f, 0x0d, 0xa5,
+    0xcb, 0x53, 0x7e, 0x38, 0x68, 0x5a, 0xcc, 0xe9, 0x76, 0x72, 0x54, 0xa4,
+    0x63, 0x88, 0x10, 0x71, 0x9a, 0xc4, 0x25, 0xf0, 0xe3, 0x9d, 0x54, 0x52,
+    0x2c, 0xdd, 0x11, 0x9f, 0x5e, 0x90, 0x63, 0xde, 0x24, 0x5e, 0x80, 0x01};
+
+// R^2 mod p, for cx_mont_init2
+#if !defined(CODA_HOST)
+static const field field_r2 = {
+    0x00, 0x00, 0x05, 0xb5, 0x80, 0x37, 0xe0, 0xe4, 0xd9, 0xe8, 0x17, 0xa8,
+    0xfb, 0x44, 0xb3, 0xc9, 0xac, 0xc2, 0x79, 0x88, 0xf3, 0xd9, 0xa3, 0x16,
+    0xc8, 0xa0, 0xff, 0x01, 0x49, 0x3b, 0xdc, 0xef, 0x99, 0xbe, 0x80, 0xf2,
+    0xee, 0x12, 0xee, 0x8e, 0xde, 0xd5, 0x21, 0x21, 0xec, 0xec, 0x77, 0xcf,
+    0xc7, 0x28, 0x55, 0x29, 0xbe, 0x54, 0xa3, 0xf4, 0x79, 0x55, 0x87, 0x6c,
+    0xc3, 0x5e, 0xe9, 0x4e, 0x6b, 0xd8, 0xc6, 0xc6, 0xc4, 0x9e, 0xdc, 0x38,
+    0xcd, 0xbe, 0x67, 0x02, 0x00, 0x95, 0x69, 0xcb, 0x70, 0xa5, 0x0f, 0xa9,
+    0xee, 0x48, 0xd1, 0x27, 0x3f, 0x9c, 0x69, 0xc7, 0xb7, 0xf4, 0xc8, 0xd1};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed field_one = {
+    0xb99680147fff6f42, 0x4eb16817b589cea8, 0xa1ebd2d90c79e179,
+    0x0f725caec549c0da, 0xab0c4ee6d3e6dad4, 0x9fbca908de0ccb62,
+    0x320c3bb713338498, 0x598b4302d2f00a62, 0x4074c9cbfd8ca621,
+    0x0fa47edb3865e88c, 0x95455fb31ff9a195, 0x00007b479ec8e242};
+#else
+static const fe_packed field_one = {
+    0x00, 0x00, 0x7b, 0x47, 0x9e, 0xc8, 0xe2, 0x42, 0x95, 0x45, 0x5f, 0xb3,
+    0x1f, 0xf9, 0xa1, 0x95, 0x0f, 0xa4, 0x7e, 0xdb, 0x38, 0x65, 0xe8, 0x8c,
+    0x40, 0x74, 0xc9, 0xcb, 0xfd, 0x8c, 0xa6, 0x21, 0x59, 0x8b, 0x43, 0x02,
+    0xd2, 0xf0, 0x0a, 0x62, 0x32, 0x0c, 0x3b, 0xb7, 0x13, 0x33, 0x84, 0x98,
+    0x9f, 0xbc, 0xa9, 0x08, 0xde, 0x0c, 0xcb, 0x62, 0xab, 0x0c, 0x4e, 0xe6,
+    0xd3, 0xe6, 0xda, 0xd4, 0x0f, 0x72, 0x5c, 0xae, 0xc5, 0x49, 0xc0, 0xda,
+    0xa1, 0xeb, 0xd2, 0xd9, 0x0c, 0x79, 0xe1, 0x79, 0x4e, 0xb1, 0x68, 0x17,
+    0xb5, 0x89, 0xce, 0xa8, 0xb9, 0x96, 0x80, 0x14, 0x7f, 0xff, 0x6f, 0x42};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed group_coeff_a = {
+    0x4768931cfff9c7d4, 0xc45e46d6ada96ca0, 0x479b0bdb0b3c0107,
+    0x362a089610f8d41b, 0xdbafcec2c8a91aaf, 0x78428b0ff9d96a06,
+    0xf2e4472a9080c353, 0xc9006ed33f0e971c, 0x0794d9d10bdb7288,
+    0x3c1e44cab5419e2c, 0x49b5fc6c81f4560c, 0x0001c287777c30ba};
+#else
+static const fe_packed group_coeff_a = {
+    0x00, 0x01, 0xc2, 0x87, 0x77, 0x7c, 0x30, 0xba, 0x49, 0xb5, 0xfc, 0x6c,
+    0x81, 0xf4, 0x56, 0x0c, 0x3c, 0x1e, 0x44, 0xca, 0xb5, 0x41, 0x9e, 0x2c,
+    0x07, 0x94, 0xd9, 0xd1, 0x0b, 0xdb, 0x72, 0x88, 0xc9, 0x00, 0x6e, 0xd3,
+    0x3f, 0x0e, 0x97, 0x1c, 0xf2, 0xe4, 0x47, 0x2a, 0x90, 0x80, 0xc3, 0x53,
+    0x78, 0x42, 0x8b, 0x0f, 0xf9, 0xd9, 0x6a, 0x06, 0xdb, 0xaf, 0xce, 0xc2,
+    0xc8, 0xa9, 0x1a, 0xaf, 0x36, 0x2a, 0x08, 0x96, 0x10, 0xf8, 0xd4, 0x1b,
+    0x47, 0x9b, 0x0b, 0xdb, 0x0b, 0x3c, 0x01, 0x07, 0xc4, 0x5e, 0x46, 0xd6,
+    0xad, 0xa9, 0x6c, 0xa0, 0x47, 0x68, 0x93, 0x1c, 0xff, 0xf9, 0xc7, 0xd4};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed group_coeff_b = {
+    0x7a85e23c6984298a, 0xb08f89f10deb6f43, 0x1ff8d652bcdd2b90,
+    0x6fe8b22127f7f097, 0x57007df447700e3e, 0x2f8aca277da9258d,
+    0x14385d51ca5422fb, 0x47d8f3de65c79d1d, 0xfa9ac2fe4bd09711,
+    0x9175a8b5ef915920, 0xf83fa70b67d17c00, 0x00010804126ecf16};
+#else
+static const fe_packed group_coeff_b = {
+    0x00, 0x01, 0x08, 0x04, 0x12, 0x6e, 0xcf, 0x16, 0xf8, 0x3f, 0xa7, 0x0b,
+    0x67, 0xd1, 0x7c, 0x00, 0x91, 0x75, 0xa8, 0xb5, 0xef, 0x91, 0x59, 0x20,
+    0xfa, 0x9a, 0xc2, 0xfe, 0x4b, 0xd0, 0x97, 0x11, 0x47, 0xd8, 0xf3, 0xde,
+    0x65, 0xc7, 0x9d, 0x1d, 0x14, 0x38, 0x5d, 0x51, 0xca, 0x54, 0x22, 0xfb,
+    0x2f, 0x8a, 0xca, 0x27, 0x7d, 0xa9, 0x25, 0x8d, 0x57, 0x00, 0x7d, 0xf4,
+    0x47, 0x70, 0x0e, 0x3e, 0x6f, 0xe8, 0xb2, 0x21, 0x27, 0xf7, 0xf0, 0x97,
+    0x1f, 0xf8, 0xd6, 0x52, 0xbc, 0xdd, 0x2b, 0x90, 0xb0, 0x8f, 0x89, 0xf1,
+    0x0d, 0xeb, 0x6f, 0x43, 0x7a, 0x85, 0xe2, 0x3c, 0x69, 0x84, 0x29, 0x8a};
+#endif
+
+// (X : Y : Z) = (0 : 1 : 0)
+#if defined(CODA_HOST)
+static const group_packed group_zero = {
+    {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+     0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+     0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+     0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+    {0xb99680147fff6f42, 0x4eb16817b589cea8, 0xa1ebd2d90c79e179,
+     0x0f725caec549c0da, 0xab0c4ee6d3e6dad4, 0x9fbca908de0ccb62,
+     0x320c3bb713338498, 0x598b4302d2f00a62, 0x4074c9cbfd8ca621,
+     0x0fa47edb3865e88c, 0x95455fb31ff9a195, 0x00007b479ec8e242},
+    {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+     0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+     0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+     0x0000000000000000, 0x0000000000000000, 0x0000000000000000}};
+#else
+static const group_packed group_zero = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7b, 0x47, 0x9e, 0xc8, 0xe2, 0x42, 0x95, 0x45, 0x5f, 0xb3,
+     0x1f, 0xf9, 0xa1, 0x95, 0x0f, 0xa4, 0x7e, 0xdb, 0x38, 0x65, 0xe8, 0x8c,
+     0x40, 0x74, 0xc9, 0xcb, 0xfd, 0x8c, 0xa6, 0x21, 0x59, 0x8b, 0x43, 0x02,
+     0xd2, 0xf0, 0x0a, 0x62, 0x32, 0x0c, 0x3b, 0xb7, 0x13, 0x33, 0x84, 0x98,
+     0x9f, 0xbc, 0xa9, 0x08, 0xde, 0x0c, 0xcb, 0x62, 0xab, 0x0c, 0x4e, 0xe6,
+     0xd3, 0xe6, 0xda, 0xd4, 0x0f, 0x72, 0x5c, 0xae, 0xc5, 0x49, 0xc0, 0xda,
+     0xa1, 0xeb, 0xd2, 0xd9, 0x0c, 0x79, 0xe1, 0x79, 0x4e, 0xb1, 0x68, 0x17,
+     0xb5, 0x89, 0xce, 0xa8, 0xb9, 0x96, 0x80, 0x14, 0x7f, 0xff, 0x6f, 0x42},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+#endif
+
+#if defined(CODA_HOST)
+static const group_packed group_one = {
+    {0xe3a856605652f582, 0xea2ad6adb232d3cc, 0x006917a62cf94e5d,
+     0xb0cf88593f1f8d9c, 0xdf4294279d098622, 0xd1805f5f25762cae,
+     0x0ce84eed156d448a, 0x092939a0aaa29f11, 0x4851f2bd56e6d412,
+     0xd6a3f94887cc2c08, 0xa3870d376b51b4de, 0x00001262a0793b60},
+    {0xa17be03d3de9993a, 0xd23d47f834d6e6a7, 0xc835b816dad2a400,
+     0xb067d33661cbda12, 0x34917ee69c71eaa3, 0x69dcbdab27c304e6,
+     0xeea1a2a6d6c76015, 0x5e60253078c4f3e3, 0x1eee46f45880e189,
+     0xd8de606656eb5e1c, 0xbf48f43a878dac3a, 0x000037d7e759d51c},
+    {0xb99680147fff6f42, 0x4eb16817b589cea8, 0xa1ebd2d90c79e179,
+     0x0f725caec549c0da, 0xab0c4ee6d3e6dad4, 0x9fbca908de0ccb62,
+     0x320c3bb713338498, 0x598b4302d2f00a62, 0x4074c9cbfd8ca621,
+     0x0fa47edb3865e88c, 0x95455fb31ff9a195, 0x00007b479ec8e242}};
+#else
+static const group_packed group_one = {
+    {0x00, 0x00, 0x12, 0x62, 0xa0, 0x79, 0x3b, 0x60, 0xa3, 0x87, 0x0d, 0x37,
+     0x6b, 0x51, 0xb4, 0xde, 0xd6, 0xa3, 0xf9, 0x48, 0x87, 0xcc, 0x2c, 0x08,
+     0x48, 0x51, 0xf2, 0xbd, 0x56, 0xe6, 0xd4, 0x12, 0x09, 0x29, 0x39, 0xa0,
+     0xaa, 0xa2, 0x9f, 0x11, 0x0c, 0xe8, 0x4e, 0xed, 0x15, 0x6d, 0x44, 0x8a,
+     0xd1, 0x80, 0x5f, 0x5f, 0x25, 0x76, 0x2c, 0xae, 0xdf, 0x42, 0x94, 0x27,
+     0x9d, 0x09, 0x86, 0x22, 0xb0, 0xcf, 0x88, 0x59, 0x3f, 0x1f, 0x8d, 0x9c,
+     0x00, 0x69, 0x17, 0xa6, 0x2c, 0xf9, 0x4e, 0x5d, 0xea, 0x2a, 0xd6, 0xad,
+     0xb2, 0x32, 0xd3, 0xcc, 0xe3, 0xa8, 0x56, 0x60, 0x56, 0x52, 0xf5, 0x82},
+    {0x00, 0x00, 0x37, 0xd7, 0xe7, 0x59, 0xd5, 0x1c, 0xbf, 0x48, 0xf4, 0x3a,
+     0x87, 0x8d, 0xac, 0x3a, 0xd8, 0xde, 0x60, 0x66, 0x56, 0xeb, 0x5e, 0x1c,
+     0x1e, 0xee, 0x46, 0xf4, 0x58, 0x80, 0xe1, 0x89, 0x5e, 0x60, 0x25, 0x30,
+     0x78, 0xc4, 0xf3, 0xe3, 0xee, 0xa1, 0xa2, 0xa6, 0xd6, 0xc7, 0x60, 0x15,
+     0x69, 0xdc, 0xbd, 0xab, 0x27, 0xc3, 0x04, 0xe6, 0x34, 0x91, 0x7e, 0xe6,
+     0x9c, 0x71, 0xea, 0xa3, 0xb0, 0x67, 0xd3, 0x36, 0x61, 0xcb, 0xda, 0x12,
+     0xc8, 0x35, 0xb8, 0x16, 0xda, 0xd2, 0xa4, 0x00, 0xd2, 0x3d, 0x47, 0xf8,
+     0x34, 0xd6, 0xe6, 0xa7, 0xa1, 0x7b, 0xe0, 0x3d, 0x3d, 0xe9, 0x99, 0x3a},
+    {0x00, 0x00, 0x7b, 0x47, 0x9e, 0xc8, 0xe2, 0x42, 0x95, 0x45, 0x5f, 0xb3,
+     0x1f, 0xf9, 0xa1, 0x95, 0x0f, 0xa4, 0x7e, 0xdb, 0x38, 0x65, 0xe8, 0x8c,
+     0x40, 0x74, 0xc9, 0xcb, 0xfd, 0x8c, 0xa6, 0x21, 0x59, 0x8b, 0x43, 0x02,
+     0xd2, 0xf0, 0x0a, 0x62, 0x32, 0x0c, 0x3b, 0xb7, 0x13, 0x33, 0x84, 0x98,
+     0x9f, 0xbc, 0xa9, 0x08, 0xde, 0x0c, 0xcb, 0x62, 0xab, 0x0c, 0x4e, 0xe6,
+     0xd3, 0xe6, 0xda, 0xd4, 0x0f, 0x72, 0x5c, 0xae, 0xc5, 0x49, 0xc0, 0xda,
+     0xa1, 0xeb, 0xd2, 0xd9, 0x0c, 0x79, 0xe1, 0x79, 0x4e, 0xb1, 0x68, 0x17,
+     0xb5, 0x89, 0xce, 0xa8, 0xb9, 0x96, 0x80, 0x14, 0x7f, 0xff, 0x6f, 0x42}};
+#endif
+
+#if defined(CODA_HOST)
+static const affine_packed group_comb[comb_tables][1 << (comb_teeth - 1)] = {
+    {{{0xc8c4b1dc63301340, 0xf02879be8e057a95, 0xdc6d1a97878d3e43,
+       0x70d27452cad74c93, 0xfa8f282d64e913bd, 0xa1019022a20e63c5,
+       0x2aa05b4e34263459, 0xac975987a9ffb0cc, 0x5bc15830474511fa,
+       0xc8977a44a95e921f, 0xf128b4da0f746f8b, 0x000048929d63378b},
+      {0xd9c00b53d5e794af, 0x2b2624cd45d51a0f, 0xaa8a0f27bbc5a349,
+       0x9a1374133a0c5724, 0x9035967363dc0cb8, 0x73f1c20cad4a3744,
+       0x704718927078f86f, 0x30c7046e3d22e51b, 0xa2b5a880e03477d7,
+       0xe19d683d04170633, 0x7ba53e53d3a2fe0c, 0x0001aa72d6d1ebc1}},
+     {{0x9a75b6df14b23ff6, 0x831f182fe03d9fa8, 0x47c7003141993c47,
+       0xa1d797978d02e441, 0x5fcdcd18057777aa, 0x3131559e8b45f0ea,
+       0x65811e77b78dfa9a, 0x70282011671d4c7a, 0x507fa41551137ed2,
+       0x929b0e25763adf68, 0x36d8b712b67d4d1d, 0x000025147adc2669},
+      {0x80494b4feff12162, 0x314d14bd73d5ab03, 0x1f9d610b70b66a12,
+       0x0b6f935bb9a2f106, 0xa87e6d7af990ce81, 0x819e833ef0596ae3,
+       0x52b93e3063de43e1, 0x344b0ff05fe104ac, 0x51ecd4e82c07a1c8,
+       0x5002072684c0dcbb, 0x6f6791838c190885, 0x00006a074ae7c198}},
+     {{0x9813a6fa8d746118, 0x73e40bd665c7cf2b, 0x5bf218908ddc6bf5,
+       0xa170811a98378492, 0xe67a50514a25823c, 0x246d8cc7d5aa416b,
+       0xf3bed4726c614f09, 0xa395df023bb623f5, 0xc5d7cae26c3a4389,
+       0x3202233d1f873050, 0xfa35ef6c28133f6b, 0x00004535c7f5600f},
+      {0x5d1fed30b383fd43, 0xd4605ffea760ff9d, 0xb151fcf9c5fef19e,
+       0x6f4ff562e255bf82, 0x4af31bf8d06781cf, 0xa0cc86455fc85043,
+       0xb191e720fdf005df, 0xd005dca36474dbe8, 0x99c32e491c161d3d,
+       0x846ac0b783e7ec01, 0x97429ed584a9b46e, 0x0000a39ca7393456}},
+     {{0x618e9fbd55b233ba, 0x0ca81e5f946a9abc, 0x09cdf49c537ab2ac,
+       0x0d105ec27583dd61, 0x04cc739b1c5bb1ab, 0xf7d1c8940949076c,
+       0xcd71076c51819db5, 0xc411fbb9eff380a8, 0x490c7db4cbffec66,
+       0x1b355eb5a06a61db, 0xbd7eeaa7602a353f, 0x000130dff6d1fe53},
+      {0x2ae06b79d536a9f2, 0x52b5680cd96f3baf, 0x9f5c80274101b638,
+       0x0ea66c397b039e3d, 0xdb73e2a6062f7488, 0xd4718d37f5247272,
+       0x9c1e7854cca2dfec, 0x2b06a28e60f83bc2, 0x7caf921a5e7e433f,
+       0x44f40dc782596ab7, 0xf7c4492452b76fd6, 0x0001271463b346f3}},
+     {{0xe104482610b98769, 0x475e5f140c553e32, 0x2fce5a5acd13c772,
+       0xc8e0645e1969e5d8, 0x7c6ab6542e70690b, 0x8a4d027afa2425ca,
+       0x8b62938147f05f0b, 0xbe074c6fb66af5ff, 0x2dd924cf07547868,
+       0x0ad0dc093e5193a0, 0xeaae9b1752c3f7b2, 0x00001986ef66d991},
+      {0xd3d72b1d9364488e, 0x089739306e4d2a52, 0x93704d2f95fb031d,
+       0xa5576e8912ef218b, 0x736925e1b6f73e64, 0x771b805411538845,
+       0x7e3602a82f00ba3a, 0xdfcaae87c292dc70, 0xf90c219cc29ebd5a,
+       0x398bbdc4af5a5ba8, 0x2c55f8c077bc9c7d, 0x0001b38a6654c553}},
+     {{0xc3f9bce2d0196df7, 0x5983013b896c2d78, 0xd8f4e31f1aa7f781,
+       0x0cb6ca3a5d16b57a, 0x29aa2453d0e13f93, 0x76e08a4590968678,
+       0xfc223da4fc24630f, 0xa8b3b001bf7d5013, 0x4b69ae7f8720ff23,
+       0x408fab147ea8d15a, 0x09fa977e8025fb84, 0x00008b7aede62b2e},
+      {0x31d0f5a0b233101e, 0x8a3b0bd88bb351b2, 0xd4d80856b67fa18e,
+       0x416b3f7f21ad7739, 0xe90c5f7b8edc7922, 0x48f8585cfe0b1545,
+       0xf5869ecb6b3bbbde, 0x06d5df8a540f04d9, 0xce126f808fb0ce98,
+       0x685076b4870e7122, 0xdba0c0da1a0a466c, 0x00015da8ff4bd259}},
+     {{0xf93ac82b1cc2aefa, 0xbe9eb2afe9bddbb6, 0x186357043110feb1,
+       0xf22cab6aa99e6401, 0xfab21d469bb45884, 0xc71e6282f391ca68,
+       0x7fcca1e6361a12bf, 0x02e48ca01133dc2f, 0x3254f6bc1778f925,
+       0x9a55cfaa51b4d6c7, 0xeedf430d7fc4fafb, 0x0001b0bf16fa49c6},
+      {0xde3ea3f2ae84e611, 0xc3eb2fc124238dec, 0x5c7e9c2aaeefd64e,
+       0xf7488e05198a355d, 0xb8cf887189f424e7, 0xddf0c0b85d603e2a,
+       0x876121e63fba41dd, 0x4ea319bf889b5438, 0x75c09c3577d719cc,
+       0xc11519b81b9fb977, 0x2e139945ab056b1a, 0x0001abe718228d46}},
+     {{0x797fb74a47f37eb6, 0x979334933a7fa967, 0x50b4d87b9dcdf687,
+       0xdea24f27f875b613, 0xe6ca4b9cd5fd85f2, 0x8e7ddeec76cf790b,
+       0x3f093ef38f2280f3, 0x1c61222b5cd52917, 0xdfdc80ffc3cd4f6d,
+       0x3c08862c369384d8, 0xf52007b387e07f73, 0x0001b567f499ddda},
+      {0xa2160d668cd63ce4, 0x4a9dc75e010b3213, 0xe5a202efd8cdc804,
+       0x5103e116d381251a, 0xf004b64f10a4f44e, 0x1696e5191fe4d2ac,
+       0x90a17119dcda3bea, 0x5316c7a88e1daa5a, 0x72244a98070b6dbb,
+       0xc45cc71e00b265eb, 0xd0aa02aac7520f33, 0x0000f49078492374}}},
+    {{{0x862c83817c010422, 0x2679ae80c1463b4f, 0x739e676c43607429,
+       0xe2fc50a0aff39372, 0xd74043e72a8c247e, 0x438a7ae091594233,
+       0x4b570132cf4a7a02, 0x0ee57cb96be79b9e, 0x5b77e5f7b7b1279f,
+       0x933bf863933ad5c6, 0x55c165508291a012, 0x0001416d00c856cf},
+      {0x2e0f0ccfb9393629, 0xcdac3a54522414c8, 0x32ad5dd478fd7e5f,
+       0x988a24c82ec41dd4, 0xa30aa07dce3a430a, 0x9aa48b01f7eb7ab2,
+       0xbe5095237672f198, 0xd5968cd6f2805763, 0x81eb28fce0220ae7,
+       0x39b1080998abba04, 0x8776f4d58bf96014, 0x00010867a0d55aba}},
+     {{0x2ee5fbfcf1c3bade, 0x831d9775dd0ee326, 0x82da6b70be543bcb,
+       0x8f9be89944f7260d, 0x43b2134bcc798060, 0x013afd0c907f5b13,
+       0x49927e58d7173ef0, 0xda779da2805f4540, 0x94a69ffa646227bd,
+       0x1262ef3804a23909, 0x16edd53db1747a4c, 0x0000e5eebd3ffbe9},
+      {0xa6fdc314d9dd8797, 0xfb7d73d594ad686e, 0x766a86e2b69aa2db,
+       0x4af186d2c0d51ac2, 0xddd0fc01262441b9, 0xa3c227d313d79bf5,
+       0x3912fc58920b3fd0, 0x261e896ce9d865a4, 0xfef25b35337bed86,
+       0x6b24c2ca95c4e626, 0xd086f09dd486af0a, 0x000049064a157594}},
+     {{0xb8d961da8f85a8b4, 0xc81b6fea01a157bb, 0xc91e51f09b2ef131,
+       0x0ae28429b55bae88, 0x822180a24704fbae, 0x75a614fa6cbbef73,
+       0xdbdd5f8ebe504727, 0x01953407b01b990f, 0x680617d2d8585ad5,
+       0xc0d00c87d0fb9dcd, 0x646ee5edcb980d40, 0x0000584b9652b7cc},
+      {0x8324f7ee306b9fdd, 0x652de519448a49bb, 0x54334aadf7c71364,
+       0x33baa218e90e2aad, 0x39420d401b3f057e, 0xff6ded553ae7bfaa,
+       0xbe46b8c6a05815c5, 0x7182b6344140870f, 0xe7235cc686336c4c,
+       0x86c212aa523ebf94, 0xf149f71c19a1f3d0, 0x000027b459e719cc}},
+     {{0x8a9f41c97b7f6a39, 0x456e3f2e34db3969, 0xb20ee543e70c8d36,
+       0x8714cfd17bd060d9, 0xda67d0b582ada1c1, 0xa047cf362af2f98f,
+       0x5f31d894fd97cf2e, 0xb7788da5a7a79ffe, 0xfb724d54166328ba,
+       0xe3c24a2f0bac587d, 0xe737212c567aed92, 0x00017afc1219b35f},
+      {0xd81ef48bfe8d201a, 0x82ef0f34c75ba5fb, 0x68331ae52b313ffd,
+       0xd694d44fe8b314b7, 0x17280e603dadffdf, 0x13baa34f5efa2b6d,
+       0x73a60a92c73c112c, 0xec7950b2e2942bc1, 0x839b6d764b9899d0,
+       0xc620a48c864cbb75, 0x9b966d6d6ca4b433, 0x000007a9928a013a}},
+     {{0x8fd83ad06d7b0c16, 0x1212f7e1d7e69d9a, 0xebe8a65fe6e90f58,
+       0x94570ecde866c05d, 0xcb140258e37aa34b, 0xae79c291e75ddd1a,
+       0xded72057c371ab3b, 0x4649f8b4170d7a0a, 0xf71ebbe7d3ea2e5b,
+       0x99027dabb4700d69, 0x0e118fa8e3849da6, 0x0000c5e21958675e},
+      {0x9c9cca5367b5ba23, 0xcbbf2d2f88bdf9d8, 0xb63bbcdfccf7dffd,
+       0xc0540f4764c9136f, 0x969e0fe4635f12da, 0x05c3992423c530c4,
+       0x2981b2adfec72659, 0xb4af468293f9d647, 0x773a1d107067502d,
+       0xef0b32d0ea6860d5, 0xbd4710af6ea2fbc4, 0x000169e23307957c}},
+     {{0x6ed7fdbc4a80a5ba, 0x3ce0730ccb3f3879, 0x97fe0ab66228f6ac,
+       0x393633006255a1f0, 0x469cb9e83420f453, 0x3e05ee043d4f377d,
+       0x4eb67e57c3f2cdd2, 0xec159537063488b9, 0x61ab07434c5e5bbe,
+       0x9e3f075b4c524339, 0x5901ae1144326da0, 0x00009635d5595117},
+      {0x92da7fe5e7582c27, 0xbafe6d94a95b2092, 0x773a4fac475ff248,
+       0xe246094a0eaa5d05, 0x04fe6d28aa4308f3, 0xa08e4337aa9dcaaf,
+       0x5a314368f6f3f9c3, 0xc704cb9c455232cc, 0xff486b2ee3da2b6e,
+       0x0ba7d12586ed30c4, 0x56e5c2f8555bb08e, 0x0001186d69edff94}},
+     {{0x22b357876c39cb6d, 0xe3c4b2cb8cdf0c1d, 0xf305af2b1db9f285,
+       0xd576959bf3c1707f, 0x45f2cbf9a36c4877, 0x6c2dbf1cb77dab1b,
+       0x73ffa141bfa8949e, 0x51231d83eef323c9, 0x02e15c9c76578dbe,
+       0xe577d14bdab4b258, 0xe60bbff7a4335634, 0x0000dc6521ee3c5e},
+      {0x6d8c1629e5a50aa8, 0xeebbea6fc7b29264, 0x6aef727c61e6571b,
+       0xc36076d1c33a22c4, 0x30ec254a5868e7b8, 0x64cb206225a1911f,
+       0x605f965ab5aef413, 0x5a326acddcb34a78, 0xea9c15b9edbcc964,
+       0x27c6acbdf8cb07f7, 0xb152b18ca3311a9b, 0x00009b733e32f205}},
+     {{0x628b5e7da233b660, 0x797daddeb936b9ca, 0xe92268f3ecf903b4,
+       0x84759a32d0f721b7, 0xcb6dd9a3fa2aa2b2, 0xde85977619719e60,
+       0x1d6bb0c193dbae04, 0x03568ea64b9b2414, 0x686bc577585de9f1,
+       0xbbe211793e4cc8f9, 0xec88e0f9f1d53a62, 0x00013e1f4990f4d4},
+      {0x6b815923fc8c4fb3, 0x8288f385e0dc891a, 0x525e634cbe732f87,
+       0xb5d6d9d6c5b16cfc, 0x7b2cc73aed0da392, 0x07a64dd48036d56b,
+       0x8c8abe5f96c2c215, 0x4a432f35402ba1f9, 0xa4e3b52a45cf8587,
+       0x208f3599fd96d5f1, 0x6384b55ee80d3485, 0x000162402d2ed94a}}},
+    {{{0x09f5343a96bd1364, 0x37733a1171650327, 0xbd3829dfca4babd7,
+       0xff2bdf47a9a517c7, 0xddeff61555fdc15f, 0x7f70728c77a61bab,
+       0x14338d51d7658a4e, 0x2523510b1cde799c, 0x34319a8692efcad7,
+       0x12dd3158f56afb08, 0x2030a9b130153c97, 0x0000aa6fd5a98bde},
+      {0x480a5492439ba56c, 0x3cf0aa2628dce6ed, 0x99ae026fa6a8559e,
+       0xe382576606dd80b2, 0x5774ca2a0fcf74e9, 0x81e6a1a37d89f1d2,
+       0x24a5da40afc9783b, 0xc1befb2f390c3a63, 0xc504cf7737513e6f,
+       0x51ed13aefcdeadb3, 0xd96d88bb61b3c64c, 0x000188a81e7166f1}},
+     {{0xa111a8277910c4c1, 0xb0c076d929d153d3, 0x75c2da32e2cbd75e,
+       0x8fdece5491ebd670, 0x562f7b8f78204d60, 0xa6f82f674cad7a85,
+       0xd0c36b93507ddbb6, 0x589aa0a2fcf3e1a7, 0x99275fdf4cbc2f1e,
+       0x660366e67cf73a87, 0xad60558f3de9fb72, 0x00003884fe67c8e3},
+      {0x41df5c42f5100df5, 0x5d8e36ddd60f28aa, 0x081e7f95d10ff47c,
+       0x80e3ef0a784f3bdd, 0x3001b92cf5e18a68, 0x6db3096438d14665,
+       0xe1ab82632af4ac1d, 0x8db582380679a7c8, 0x60fb43b7b04d23a1,
+       0xc25d626707126654, 0x784a41d5ccaa2186, 0x00016834cbfb7d32}},
+     {{0xfaeea21431b598a6, 0xc75d093cc84da270, 0x1bec23d813d74fc2,
+       0x3ee186f54d04a2d4, 0xa0ea7fbb20f72478, 0x9731d296a60bbde2,
+       0x5064ae00b513cd23, 0x0eb2040916404060, 0xac35ff732815df14,
+       0x22cc09114c82bd41, 0x50e078c3998e701d, 0x00017b6c4ba85571},
+      {0x0635b8a48fb291cc, 0x7b12d2665c569b3b, 0x2d2a3e91e4b75a9c,
+       0xc087483c69672263, 0x5f4a918086d8ec65, 0xefe7348d1d54dc38,
+       0x1f5d7664b4dc1497, 0xad8c1cce86f38c56, 0x9f662e690476f144,
+       0xcdeffdb139d42644, 0x331ce594b5e2c2bd, 0x00013a8fc1c56dd6}},
+     {{0x9ec80984a98f52cb, 0xc7a86974db6d4129, 0x4643987f9b5ea24b,
+       0xf8f660ca72416092, 0xe5a7ab24dce8ffe3, 0x5ad5ca3e6cdb114f,
+       0x67561afc25e6f48a, 0x594790f027179236, 0xde99771552a0b849,
+       0xc0df6556c816b097, 0xa31e85ef9bff0fb4, 0x0001936aa1ee1c9f},
+      {0xd23722ea5495bc0b, 0xb1a5841768eddb9e, 0x5ec51ae0006a0154,
+       0xdae406d1d1c2960a, 0x79005e6bf7152882, 0xdaab96f90afde7c6,
+       0xdaf98a9540ca4542, 0xac6d543a03894808, 0x5e2d06369343a203,
+       0x0b518dad2a9ed555, 0x471d5b8d712375dc, 0x000014766704342e}},
+     {{0x76970e4f32974445, 0xde7864a8d7f387cf, 0x8095df478f308625,
+       0x546504173373b15a, 0x7596b68af402ea11, 0xb2b28c55e7e0b27a,
+       0x7ea03d642fb98ec9, 0x52db3b255b2ec8c0, 0xa0a3afa928804c77,
+       0xe26423be7136d978, 0x26aebb87d2f7d880, 0x00016ffc3bd1541f},
+      {0x133b1d62ad7596b9, 0xf6ba250ee33215cf, 0x48a10d3c90ddb6b4,
+       0xa2e81b1479af7c3f, 0xec89c5cac4caad4d, 0x7a31c6d27b0413a7,
+       0xf408fe20fba60774, 0x533e4d9c47e2fd2f, 0x87d19b4cf0d7524f,
+       0x20e771111ecdae1c, 0xb04a93aff115e0b9, 0x00001ce8bc40cd47}},
+     {{0xbff96bb7314ee6ea, 0xcbcbef6a095c43e9, 0xa0700664fb452be7,
+       0x1307be8ab1dbe787, 0x240c34228814ea39, 0x69d6ebda001564f2,
+       0xd1f63a0bbe6c50c8, 0xe4dc0e39687a06fd, 0x7723aff1795c2244,
+       0x6aa711a4c9379d5e, 0x24cde09cc4847743, 0x00004101fe49a5c8},
+      {0xaac8a7d52a5d621c, 0x05f7739ac15b5ba4, 0xa566016fc1959a65,
+       0x7ab455ae611d7668, 0x21508549c711a97a, 0xb27666ab7ed5ec54,
+       0x9b16a28b489f2d16, 0x76da677a3fae78c5, 0x0227a77e9fe70f88,
+       0xaa1fafb22f3c7298, 0x33c6fcbf76234953, 0x0001b155bb18e335}},
+     {{0x28a93fb1bf2647e2, 0x69c7bc16fbd4f878, 0x0fefc1b5749bf18f,
+       0xf9092305cfc74515, 0xad6e2252bd03de33, 0xcc8b266bb05302a1,
+       0xe88411a77a1d244c, 0x10544323d05d7c4b, 0xff21a428f02dbe09,
+       0xfc9f6f1d68466f0a, 0x36cd72e2ebee152a, 0x000058de604144fa},
+      {0x5ec0159ecd63dcdd, 0x17b9f7f5a26b9c52, 0xdd38ce5c26e3fdec,
+       0x8ef5ee39f6e872c0, 0x97c44b4fcbb6d175, 0xcb32e9d6ab56f893,
+       0xfe1e790542025dbd, 0xbeaebd2bd2d2bff8, 0x77005444e94b5b70,
+       0xc935236e93b6fcf6, 0xfcde1844841d1dcb, 0x000004580ba987fd}},
+     {{0xc9ec97a98a9ed149, 0xc48293c03fc2847c, 0x3a7c5c9f2099245a,
+       0x9f28f6254db102f9, 0xb19de038aa563bd9, 0x82998e6b101a682e,
+       0xfa06d0f2e95ddc88, 0x5e659313f01211a3, 0x50ba27af2631f410,
+       0x3c4681a0a5201c46, 0xbe0d5e6121e14214, 0x00000f1475a4607c},
+      {0x0213ca67dae0ad92, 0xac563d63c60886c8, 0x0e4eda8514130bf6,
+       0x44bbe9e1e7a50268, 0x077f6eae15be4698, 0x002b41cf1aadad4e,
+       0x15ebbdd7281a76fc, 0x561a1232dd87e5b6, 0x7f48510a61bfbcd5,
+       0x9dd07bae0e26987f, 0x6007ee1a7297e797, 0x0000e31b9eadad85}}},
+    {{{0xb296fc8162ee1a66, 0xd7bc56d8c804cfc2, 0x077b19f895953634,
+       0x8139b9e2efb3c20f, 0xa67e5be364d0cff3, 0x3a5ee290224eda63,
+       0xe67124197576e0c0, 0x1cea9ccb0dd946e0, 0x8d0940b5f2ed305e,
+       0xa136aa7262971f8d, 0x81e0005773098be3, 0x000134a84df25f63},
+      {0x9fb6b2c132083354, 0xaae1fda79fddbd0f, 0xb48a59ca95962aa8,
+       0x1ad03d45a551e45f, 0x9eb028876eae63df, 0x910606b5aa26e9e8,
+       0x02d61f7f9af91d03, 0x87d7371ff34bb332, 0xf4ec00b67dc2b97e,
+       0x67faae7f6c561172, 0xc39445ef5f3ba3fc, 0x000001fa99e44a4c}},
+     {{0x19b293a76591d345, 0xf5ed40d73ffebcf3, 0xadeaa531d19a5d73,
+       0x97bf2982d1a2d5a8, 0x8ce6c331d8b71d32, 0xecd79bdb0fbd3367,
+       0xeabeeb82c9a5177f, 0x9900d596a67f0922, 0x2ca607781f838d15,
+       0x0178ed6616f4099d, 0xb52b7f475592fd00, 0x000125531d996192},
+      {0xe74fd4b732bd50a2, 0xe623b0c83d310839, 0xc49e96c462ad1560,
+       0x82cfa44695483298, 0x2112d0957f5181c5, 0xefe56ee2432dd4c3,
+       0x1f4107bbc523dc08, 0x1d367dbf49ae794b, 0x9796f171882619bb,
+       0x9d05a2a002122f29, 0xadf7a21a43a61f79, 0x0000c6dfe52a09ba}},
+     {{0x257ab2488af43fb1, 0xc6bc3721cc3ee99a, 0xcf92ef86d292fef8,
+       0xf1a0b06c7c5ced35, 0x0a0b0bc14fe03280, 0x7c11a2806bca5e06,
+       0x707a5b0ab3962dd7, 0x9c6e3686de6e1110, 0x1f37e0bbdb4cf6fb,
+       0x67a8bafbdfb70aca, 0xdcfad92bd11bb375, 0x00002252a338183d},
+      {0xf1a8658720969545, 0xb9b3c537fab4a690, 0x894719560a8058a3,
+       0x99917a87bf6a08cc, 0x9c06ac23f53a08ae, 0x3e979b21ebb72c32,
+       0x5693d88fd8f93006, 0xadf802999cd59725, 0x8a3af41774f5d6de,
+       0xe47f667dfb08e34c, 0x626788f71d185a7f, 0x00015c47a89ab683}},
+     {{0x5f565e16fa28fcd0, 0xfac1a3dbbbf2e8dc, 0xb07a3c5a19632921,
+       0x373fda95a29225a7, 0xa962b26c96778a3e, 0x280ed8d7491cc253,
+       0x5df06da7be437eea, 0x5e2b11a1b8b1ea32, 0xa8c0216207a59937,
+       0xc6bc042b305741f2, 0x168a5135a9df3804, 0x0001a93d541fa0b8},
+      {0x97087012337c0f5f, 0x8c4cfa2a1da61f71, 0x91192517e982f8f1,
+       0xa791f207502c2e92, 0x52afa88b347e2ce7, 0x97cdd29ba5a00ad9,
+       0x1c0026b8601f041f, 0x643da72d6c656983, 0x5b46098603c3c877,
+       0x0d36d779d6a73527, 0x7139289fc171d923, 0x00018814fa59109b}},
+     {{0xe8c1dad2cfe6ea08, 0xa081507534ed759e, 0xd4aa9e86e4eb0bf0,
+       0x53be51b19ee40b9f, 0xb384b1ce1c31d659, 0x70d97fe4e793af1b,
+       0x09337ad101f1d342, 0x905bcede6f4dd53e, 0xa558b5204250a99c,
+       0x46c5e57912ba5651, 0xe4a933b3f1e9687f, 0x0000781b465ea0b7},
+      {0xbff3d603a0b5e32c, 0xd2ba81f9c961fdb8, 0x3df7160ae9c3cd28,
+       0x442fa7fba4c93df8, 0x076f67fe775b791f, 0x89bc7e07fc2385de,
+       0xabb267be29137ea3, 0x460616dd516bd5a2, 0xf2ac562c0ce6f228,
+       0x369af2fbd124d616, 0x9ad88b233bf5bc0d, 0x0000e06a4dc0f48b}},
+     {{0xbe40b20ee45a2168, 0x2fcf550c74fbe54e, 0xa46bdfb2e8262bc5,
+       0xf76985d9872ed736, 0x75a9fcdf43f219c4, 0xc5de15f83dca0246,
+       0x101ad7fb6aa6dfab, 0xbbc96a13e73be383, 0xa5863d38fd46ea28,
+       0x00afdcb08ffd87bf, 0xbdf1f0c365a00f68, 0x0000074b053a0130},
+      {0x182e1333a759a3a9, 0x60b346b3266bbfab, 0x9928c4dceaa1c95d,
+       0xbff7239a0a258f8d, 0x786c9ea8d2fc59ff, 0xf2c9704f7f2ac77f,
+       0x3c7821718c3ea94e, 0x090d198744215daf, 0xb4ad47f986bfcb1b,
+       0xfc407bda26219898, 0x89fa1237d53127cd, 0x0001aba4f7eba199}},
+     {{0x30b25fdda9db7d1b, 0x00f6eaab68bf9b2c, 0xd0c6c4336fece810,
+       0x80c59ebdcd05be81, 0x80ae0513dca07983, 0xcc9c503bba218805,
+       0x663b1aa8a0ed30de, 0x6e40e4368a88a8e5, 0xec29d01405f3374f,
+       0xe1ae3a4a6f68c3d1, 0x9bf3596566068834, 0x000087b7a7501635},
+      {0xe14b95b585dbdb7e, 0xb5429eb0b623e5b0, 0xd8d6670759505032,
+       0xa26d162e04ef4004, 0x5cd1170c8c4896c9, 0x979f78bd2e887192,
+       0xba815a4bf6a16c51, 0x823cd81933d0ecd3, 0x319022f6cf7fb527,
+       0x29192e7b39ea3252, 0xd6c0f9934dfc6630, 0x000111c20e741e9c}},
+     {{0xc08a02d6d3ce2497, 0x00dc506d391f3a75, 0xc48be98d052fefd2,
+       0x39c21b7fee696d64, 0xae39f5d720016c6d, 0x81de2c1c1064d610,
+       0x87d0fffb83496bb1, 0xf991af56a78de19a, 0xe00daefc4ee78a41,
+       0x7c15728f0d0d658b, 0xd62dd71e2d88002a, 0x0001393f644074d6},
+      {0xc80bb05b5ac2bed9, 0xcb75003daa9c0d1f, 0x64068e7239cc2a10,
+       0xb054b0fcd8ad5374, 0x16d993547a7ff16a, 0x5327a857f08993e0,
+       0x6bf59770b3ecbbc1, 0x4772a32d42ede3dc, 0x8ec0579d1166b55a,
+       0x063e562128f817f0, 0x2f6c931988ccc920, 0x00013ee79b8df7f4}}}};
+#else
+static const affine_packed group_comb[comb_tables][1 << (comb_teeth - 1)] = {
+    {{{0x00, 0x00, 0x48, 0x92, 0x9d, 0x63, 0x37, 0x8b, 0xf1, 0x28, 0xb4, 0xda,
+       0x0f, 0x74, 0x6f, 0x8b, 0xc8, 0x97, 0x7a, 0x44, 0xa9, 0x5e, 0x92, 0x1f,
+       0x5b, 0xc1, 0x58, 0x30, 0x47, 0x45, 0x11, 0xfa, 0xac, 0x97, 0x59, 0x87,
+       0xa9, 0xff, 0xb0, 0xcc, 0x2a, 0xa0, 0x5b, 0x4e, 0x34, 0x26, 0x34, 0x59,
+       0xa1, 0x01, 0x90, 0x22, 0xa2, 0x0e, 0x63, 0xc5, 0xfa, 0x8f, 0x28, 0x2d,
+       0x64, 0xe9, 0x13, 0xbd, 0x70, 0xd2, 0x74, 0x52, 0xca, 0xd7, 0x4c, 0x93,
+       0xdc, 0x6d, 0x1a, 0x97, 0x87, 0x8d, 0x3e, 0x43, 0xf0, 0x28, 0x79, 0xbe,
+       0x8e, 0x05, 0x7a, 0x95, 0xc8, 0xc4, 0xb1, 0xdc, 0x63, 0x30, 0x13, 0x40},
+      {0x00, 0x01, 0xaa, 0x72, 0xd6, 0xd1, 0xeb, 0xc1, 0x7b, 0xa5, 0x3e, 0x53,
+       0xd3, 0xa2, 0xfe, 0x0c, 0xe1, 0x9d, 0x68, 0x3d, 0x04, 0x17, 0x06, 0x33,
+       0xa2, 0xb5, 0xa8, 0x80, 0xe0, 0x34, 0x77, 0xd7, 0x30, 0xc7, 0x04, 0x6e,
+       0x3d, 0x22, 0xe5, 0x1b, 0x70, 0x47, 0x18, 0x92, 0x70, 0x78, 0xf8, 0x6f,
+       0x73, 0xf1, 0xc2, 0x0c, 0xad, 0x4a, 0x37, 0x44, 0x90, 0x35, 0x96, 0x73,
+       0x63, 0xdc, 0x0c, 0xb8, 0x9a, 0x13, 0x74, 0x13, 0x3a, 0x0c, 0x57, 0x24,
+       0xaa, 0x8a, 0x0f, 0x27, 0xbb, 0xc5, 0xa3, 0x49, 0x2b, 0x26, 0x24, 0xcd,
+       0x45, 0xd5, 0x1a, 0x0f, 0xd9, 0xc0, 0x0b, 0x53, 0xd5, 0xe7, 0x94, 0xaf}},
+     {{0x00, 0x00, 0x25, 0x14, 0x7a, 0xdc, 0x26, 0x69, 0x36, 0xd8, 0xb7, 0x12,
+       0xb6, 0x7d, 0x4d, 0x1d, 0x92, 0x9b, 0x0e, 0x25, 0x76, 0x3a, 0xdf, 0x68,
+       0x50, 0x7f, 0xa4, 0x15, 0x51, 0x13, 0x7e, 0xd2, 0x70, 0x28, 0x20, 0x11,
+       0x67, 0x1d, 0x4c, 0x7a, 0x65, 0x81, 0x1e, 0x77, 0xb7, 0x8d, 0xfa, 0x9a,
+       0x31, 0x31, 0x55, 0x9e, 0x8b, 0x45, 0xf0, 0xea, 0x5f, 0xcd, 0xcd, 0x18,
+       0x05, 0x77, 0x77, 0xaa, 0xa1, 0xd7, 0x97, 0x97, 0x8d, 0x02, 0xe4, 0x41,
+       0x47, 0xc7, 0x00, 0x31, 0x41, 0x99, 0x3c, 0x47, 0x83, 0x1f, 0x18, 0x2f,
+       0xe0, 0x3d, 0x9f, 0xa8, 0x9a, 0x75, 0xb6, 0xdf, 0x14, 0xb2, 0x3f, 0xf6},
+      {0x00, 0x00, 0x6a, 0x07, 0x4a, 0xe7, 0xc1, 0x98, 0x6f, 0x67, 0x91, 0x83,
+       0x8c, 0x19, 0x08, 0x85, 0x50, 0x02, 0x07, 0x26, 0x84, 0xc0, 0xdc, 0xbb,
+       0x51, 0xec, 0xd4, 0xe8, 0x2c, 0x07, 0xa1, 0xc8, 0x34, 0x4b, 0x0f, 0xf0,
+       0x5f, 0xe1, 0x04, 0xac, 0x52, 0xb9, 0x3e, 0x30, 0x63, 0xde, 0x43, 0xe1,
+       0x81, 0x9e, 0x83, 0x3e, 0xf0, 0x59, 0x6a, 0xe3, 0xa8, 0x7e, 0x6d, 0x7a,
+       0xf9, 0x90, 0xce, 0x81, 0x0b, 0x6f, 0x93, 0x5b, 0xb9, 0xa2, 0xf1, 0x06,
+       0x1f, 0x9d, 0x61, 0x0b, 0x70, 0xb6, 0x6a, 0x12, 0x31, 0x4d, 0x14, 0xbd,
+       0x73, 0xd5, 0xab, 0x03, 0x80, 0x49, 0x4b, 0x4f, 0xef, 0xf1, 0x21, 0x62}},
+     {{0x00, 0x00, 0x45, 0x35, 0xc7, 0xf5, 0x60, 0x0f, 0xfa, 0x35, 0xef, 0x6c,
+       0x28, 0x13, 0x3f, 0x6b, 0x32, 0x02, 0x23, 0x3d, 0x1f, 0x87, 0x30, 0x50,
+       0xc5, 0xd7, 0xca, 0xe2, 0x6c, 0x3a, 0x43, 0x89, 0xa3, 0x95, 0xdf, 0x02,
+       0x3b, 0xb6, 0x23, 0xf5, 0xf3, 0xbe, 0xd4, 0x72, 0x6c, 0x61, 0x4f, 0x09,
+       0x24, 0x6d, 0x8c, 0xc7, 0xd5, 0xaa, 0x41, 0x6b, 0xe6, 0x7a, 0x50, 0x51,
+       0x4a, 0x25, 0x82, 0x3c, 0xa1, 0x70, 0x81, 0x1a, 0x98, 0x37, 0x84, 0x92,
+       0x5b, 0xf2, 0x18, 0x90, 0x8d, 0xdc, 0x6b, 0xf5, 0x73, 0xe4, 0x0b, 0xd6,
+       0x65, 0xc7, 0xcf, 0x2b, 0x98, 0x13, 0xa6, 0xfa, 0x8d, 0x74, 0x61, 0x18},
+      {0x00, 0x00, 0xa3, 0x9c, 0xa7, 0x39, 0x34, 0x56, 0x97, 0x42, 0x9e, 0xd5,
+       0x84, 0xa9, 0xb4, 0x6e, 0x84, 0x6a, 0xc0, 0xb7, 0x83, 0xe7, 0xec, 0x01,
+       0x99, 0xc3, 0x2e, 0x49, 0x1c, 0x16, 0x1d, 0x3d, 0xd0, 0x05, 0xdc, 0xa3,
+       0x64, 0x74, 0xdb, 0xe8, 0xb1, 0x91, 0xe7, 0x20, 0xfd, 0xf0, 0x05, 0xdf,
+       0xa0, 0xcc, 0x86, 0x45, 0x5f, 0xc8, 0x50, 0x43, 0x4a, 0xf3, 0x1b, 0xf8,
+       0xd0, 0x67, 0x81, 0xcf, 0x6f, 0x4f, 0xf5, 0x62, 0xe2, 0x55, 0xbf, 0x82,
+       0xb1, 0x51, 0xfc, 0xf9, 0xc5, 0xfe, 0xf1, 0x9e, 0xd4, 0x60, 0x5f, 0xfe,
+       0xa7, 0x60, 0xff, 0x9d, 0x5d, 0x1f, 0xed, 0x30, 0xb3, 0x83, 0xfd, 0x43}},
+     {{0x00, 0x01, 0x30, 0xdf, 0xf6, 0xd1, 0xfe, 0x53, 0xbd, 0x7e, 0xea, 0xa7,
+       0x60, 0x2a, 0x35, 0x3f, 0x1b, 0x35, 0x5e, 0xb5, 0xa0, 0x6a, 0x61, 0xdb,
+       0x49, 0x0c, 0x7d, 0xb4, 0xcb, 0xff, 0xec, 0x66, 0xc4, 0x11, 0xfb, 0xb9,
+       0xef, 0xf3, 0x80, 0xa8, 0xcd, 0x71, 0x07, 0x6c, 0x51, 0x81, 0x9d, 0xb5,
+       0xf7, 0xd1, 0xc8, 0x94, 0x09, 0x49, 0x07, 0x6c, 0x04, 0xcc, 0x73, 0x9b,
+       0x1c, 0x5b, 0xb1, 0xab, 0x0d, 0x10, 0x5e, 0xc2, 0x75, 0x83, 0xdd, 0x61,
+       0x09, 0xcd, 0xf4, 0x9c, 0x53, 0x7a, 0xb2, 0xac, 0x0c, 0xa8, 0x1e, 0x5f,
+       0x94, 0x6a, 0x9a, 0xbc, 0x61, 0x8e, 0x9f, 0xbd, 0x55, 0xb2, 0x33, 0xba},
+      {0x00, 0x01, 0x27, 0x14, 0x63, 0xb3, 0x46, 0xf3, 0xf7, 0xc4, 0x49, 0x24,
+       0x52, 0xb7, 0x6f, 0xd6, 0x44, 0xf4, 0x0d, 0xc7, 0x82, 0x59, 0x6a, 0xb7,
+       0x7c, 0xaf, 0x92, 0x1a, 0x5e, 0x7e, 0x43, 0x3f, 0x2b, 0x06, 0xa2, 0x8e,
+       0x60, 0xf8, 0x3b, 0xc2, 0x9c, 0x1e, 0x78, 0x54, 0xcc, 0xa2, 0xdf, 0xec,
+       0xd4, 0x71, 0x8d, 0x37, 0xf5, 0x24, 0x72, 0x72, 0xdb, 0x73, 0xe2, 0xa6,
+       0x06, 0x2f, 0x74, 0x88, 0x0e, 0xa6, 0x6c, 0x39, 0x7b, 0x03, 0x9e, 0x3d,
+       0x9f, 0x5c, 0x80, 0x27, 0x41, 0x01, 0xb6, 0x38, 0x52, 0xb5, 0x68, 0x0c,
+       0xd9, 0x6f, 0x3b, 0xaf, 0x2a, 0xe0, 0x6b, 0x79, 0xd5, 0x36, 0xa9, 0xf2}},
+     {{0x00, 0x00, 0x19, 0x86, 0xef, 0x66, 0xd9, 0x91, 0xea, 0xae, 0x9b, 0x17,
+       0x52, 0xc3, 0xf7, 0xb2, 0x0a, 0xd0, 0xdc, 0x09, 0x3e, 0x51, 0x93, 0xa0,
+       0x2d, 0xd9, 0x24, 0xcf, 0x07, 0x54, 0x78, 0x68, 0xbe, 0x07, 0x4c, 0x6f,
+       0xb6, 0x6a, 0xf5, 0xff, 0x8b, 0x62, 0x93, 0x81, 0x47, 0xf0, 0x5f, 0x0b,
+       0x8a, 0x4d, 0x02, 0x7a, 0xfa, 0x24, 0x25, 0xca, 0x7c, 0x6a, 0xb6, 0x54,
+       0x2e, 0x70, 0x69, 0x0b, 0xc8, 0xe0, 0x64, 0x5e, 0x19, 0x69, 0xe5, 0xd8,
+       0x2f, 0xce, 0x5a, 0x5a, 0xcd, 0x13, 0xc7, 0x72, 0x47, 0x5e, 0x5f, 0x14,
+       0x0c, 0x55, 0x3e, 0x32, 0xe1, 0x04, 0x48, 0x26, 0x10, 0xb9, 0x87, 0x69},
+      {0x00, 0x01, 0xb3, 0x8a, 0x66, 0x54, 0xc5, 0x53, 0x2c, 0x55, 0xf8, 0xc0,
+       0x77, 0xbc, 0x9c, 0x7d, 0x39, 0x8b, 0xbd, 0xc4, 0xaf, 0x5a, 0x5b, 0xa8,
+       0xf9, 0x0c, 0x21, 0x9c, 0xc2, 0x9e, 0xbd, 0x5a, 0xdf, 0xca, 0xae, 0x87,
+       0xc2, 0x92, 0xdc, 0x70, 0x7e, 0x36, 0x02, 0xa8, 0x2f, 0x00, 0xba, 0x3a,
+       0x77, 0x1b, 0x80, 0x54, 0x11, 0x53, 0x88, 0x45, 0x73, 0x69, 0x25, 0xe1,
+       0xb6, 0xf7, 0x3e, 0x64, 0xa5, 0x57, 0x6e, 0x89, 0x12, 0xef, 0x21, 0x8b,
+       0x93, 0x70, 0x4d, 0x2f, 0x95, 0xfb, 0x03, 0x1d, 0x08, 0x97, 0x39, 0x30,
+       0x6e, 0x4d, 0x2a, 0x52, 0xd3, 0xd7, 0x2b, 0x1d, 0x93, 0x64, 0x48, 0x8e}},
+     {{0x00, 0x00, 0x8b, 0x7a, 0xed, 0xe6, 0x2b, 0x2e, 0x09, 0xfa, 0x97, 0x7e,
+       0x80, 0x25, 0xfb, 0x84, 0x40, 0x8f, 0xab, 0x14, 0x7e, 0xa8, 0xd1, 0x5a,
+       0x4b, 0x69, 0xae, 0x7f, 0x87, 0x20, 0xff, 0x23, 0xa8, 0xb3, 0xb0, 0x01,
+       0xbf, 0x7d, 0x50, 0x13, 0xfc, 0x22, 0x3d, 0xa4, 0xfc, 0x24, 0x63, 0x0f,
+       0x76, 0xe0, 0x8a, 0x45, 0x90, 0x96, 0x86, 0x78, 0x29, 0xaa, 0x24, 0x53,
+       0xd0, 0xe1, 0x3f, 0x93, 0x0c, 0xb6, 0xca, 0x3a, 0x5d, 0x16, 0xb5, 0x7a,
+       0xd8, 0xf4, 0xe3, 0x1f, 0x1a, 0xa7, 0xf7, 0x81, 0x59, 0x83, 0x01, 0x3b,
+       0x89, 0x6c, 0x2d, 0x78, 0xc3, 0xf9, 0xbc, 0xe2, 0xd0, 0x19, 0x6d, 0xf7},
+      {0x00, 0x01, 0x5d, 0xa8, 0xff, 0x4b, 0xd2, 0x59, 0xdb, 0xa0, 0xc0, 0xda,
+       0x1a, 0x0a, 0x46, 0x6c, 0x68, 0x50, 0x76, 0xb4, 0x87, 0x0e, 0x71, 0x22,
+       0xce, 0x12, 0x6f, 0x80, 0x8f, 0xb0, 0xce, 0x98, 0x06, 0xd5, 0xdf, 0x8a,
+       0x54, 0x0f, 0x04, 0xd9, 0xf5, 0x86, 0x9e, 0xcb, 0x6b, 0x3b, 0xbb, 0xde,
+       0x48, 0xf8, 0x58, 0x5c, 0xfe, 0x0b, 0x15, 0x45, 0xe9, 0x0c, 0x5f, 0x7b,
+       0x8e, 0xdc, 0x79, 0x22, 0x41, 0x6b, 0x3f, 0x7f, 0x21, 0xad, 0x77, 0x39,
+       0xd4, 0xd8, 0x08, 0x56, 0xb6, 0x7f, 0xa1, 0x8e, 0x8a, 0x3b, 0x0b, 0xd8,
+       0x8b, 0xb3, 0x51, 0xb2, 0x31, 0xd0, 0xf5, 0xa0, 0xb2, 0x33, 0x10, 0x1e}},
+     {{0x00, 0x01, 0xb0, 0xbf, 0x16, 0xfa, 0x49, 0xc6, 0xee, 0xdf, 0x43, 0x0d,
+       0x7f, 0xc4, 0xfa, 0xfb, 0x9a, 0x55, 0xcf, 0xaa, 0x51, 0xb4, 0xd6, 0xc7,
+       0x32, 0x54, 0xf6, 0xbc, 0x17, 0x78, 0xf9, 0x25, 0x02, 0xe4, 0x8c, 0xa0,
+       0x11, 0x33, 0xdc, 0x2f, 0x7f, 0xcc, 0xa1, 0xe6, 0x36, 0x1a, 0x12, 0xbf,
+       0xc7, 0x1e, 0x62, 0x82, 0xf3, 0x91, 0xca, 0x68, 0xfa, 0xb2, 0x1d, 0x46,
+       0x9b, 0xb4, 0x58, 0x84, 0xf2, 0x2c, 0xab, 0x6a, 0xa9, 0x9e, 0x64, 0x01,
+       0x18, 0x63, 0x57, 0x04, 0x31, 0x10, 0xfe, 0xb1, 0xbe, 0x9e, 0xb2, 0xaf,
+       0xe9, 0xbd, 0xdb, 0xb6, 0xf9, 0x3a, 0xc8, 0x2b, 0x1c, 0xc2, 0xae, 0xfa},
+      {0x00, 0x01, 0xab, 0xe7, 0x18, 0x22, 0x8d, 0x46, 0x2e, 0x13, 0x99, 0x45,
+       0xab, 0x05, 0x6b, 0x1a, 0xc1, 0x15, 0x19, 0xb8, 0x1b, 0x9f, 0xb9, 0x77,
+       0x75, 0xc0, 0x9c, 0x35, 0x77, 0xd7, 0x19, 0xcc, 0x4e, 0xa3, 0x19, 0xbf,
+       0x88, 0x9b, 0x54, 0x38, 0x87, 0x61, 0x21, 0xe6, 0x3f, 0xba, 0x41, 0xdd,
+       0xdd, 0xf0, 0xc0, 0xb8, 0x5d, 0x60, 0x3e, 0x2a, 0xb8, 0xcf, 0x88, 0x71,
+       0x89, 0xf4, 0x24, 0xe7, 0xf7, 0x48, 0x8e, 0x05, 0x19, 0x8a, 0x35, 0x5d,
+       0x5c, 0x7e, 0x9c, 0x2a, 0xae, 0xef, 0xd6, 0x4e, 0xc3, 0xeb, 0x2f, 0xc1,
+       0x24, 0x23, 0x8d, 0xec, 0xde, 0x3e, 0xa3, 0xf2, 0xae, 0x84, 0xe6, 0x11}},
+     {{0x00, 0x01, 0xb5, 0x67, 0xf4, 0x99, 0xdd, 0xda, 0xf5, 0x20, 0x07, 0xb3,
+       0x87, 0xe0, 0x7f, 0x73, 0x3c, 0x08, 0x86, 0x2c, 0x36, 0x93, 0x84, 0xd8,
+       0xdf, 0xdc, 0x80, 0xff, 0xc3, 0xcd, 0x4f, 0x6d, 0x1c, 0x61, 0x22, 0x2b,
+       0x5c, 0xd5, 0x29, 0x17, 0x3f, 0x09, 0x3e, 0xf3, 0x8f, 0x22, 0x80, 0xf3,
+       0x8e, 0x7d, 0xde, 0xec, 0x76, 0xcf, 0x79, 0x0b, 0xe6, 0xca, 0x4b, 0x9c,
+       0xd5, 0xfd, 0x85, 0xf2, 0xde, 0xa2, 0x4f, 0x27, 0xf8, 0x75, 0xb6, 0x13,
+       0x50, 0xb4, 0xd8, 0x7b, 0x9d, 0xcd, 0xf6, 0x87, 0x97, 0x93, 0x34, 0x93,
+       0x3a, 0x7f, 0xa9, 0x67, 0x79, 0x7f, 0xb7, 0x4a, 0x47, 0xf3, 0x7e, 0xb6},
+      {0x00, 0x00, 0xf4, 0x90, 0x78, 0x49, 0x23, 0x74, 0xd0, 0xaa, 0x02, 0xaa,
+       0xc7, 0x52, 0x0f, 0x33, 0xc4, 0x5c, 0xc7, 0x1e, 0x00, 0xb2, 0x65, 0xeb,
+       0x72, 0x24, 0x4a, 0x98, 0x07, 0x0b, 0x6d, 0xbb, 0x53, 0x16, 0xc7, 0xa8,
+       0x8e, 0x1d, 0xaa, 0x5a, 0x90, 0xa1, 0x71, 0x19, 0xdc, 0xda, 0x3b, 0xea,
+       0x16, 0x96, 0xe5, 0x19, 0x1f, 0xe4, 0xd2, 0xac, 0xf0, 0x04, 0xb6, 0x4f,
+       0x10, 0xa4, 0xf4, 0x4e, 0x51, 0x03, 0xe1, 0x16, 0xd3, 0x81, 0x25, 0x1a,
+       0xe5, 0xa2, 0x02, 0xef, 0xd8, 0xcd, 0xc8, 0x04, 0x4a, 0x9d, 0xc7, 0x5e,
+       0x01, 0x0b, 0x32, 0x13, 0xa2, 0x16, 0x0d, 0x66, 0x8c, 0xd6, 0x3c, 0xe4}}},
+    {{{0x00, 0x01, 0x41, 0x6d, 0x00, 0xc8, 0x56, 0xcf, 0x55, 0xc1, 0x65, 0x50,
+       0x82, 0x91, 0xa0, 0x12, 0x93, 0x3b, 0xf8, 0x63, 0x93, 0x3a, 0xd5, 0xc6,
+       0x5b, 0x77, 0xe5, 0xf7, 0xb7, 0xb1, 0x27, 0x9f, 0x0e, 0xe5, 0x7c, 0xb9,
+       0x6b, 0xe7, 0x9b, 0x9e, 0x4b, 0x57, 0x01, 0x32, 0xcf, 0x4a, 0x7a, 0x02,
+       0x43, 0x8a, 0x7a, 0xe0, 0x91, 0x59, 0x42, 0x33, 0xd7, 0x40, 0x43, 0xe7,
+       0x2a, 0x8c, 0x24, 0x7e, 0xe2, 0xfc, 0x50, 0xa0, 0xaf, 0xf3, 0x93, 0x72,
+       0x73, 0x9e, 0x67, 0x6c, 0x43, 0x60, 0x74, 0x29, 0x26, 0x79, 0xae, 0x80,
+       0xc1, 0x46, 0x3b, 0x4f, 0x86, 0x2c, 0x83, 0x81, 0x7c, 0x01, 0x04, 0x22},
+      {0x00, 0x01, 0x08, 0x67, 0xa0, 0xd5, 0x5a, 0xba, 0x87, 0x76, 0xf4, 0xd5,
+       0x8b, 0xf9, 0x60, 0x14, 0x39, 0xb1, 0x08, 0x09, 0x98, 0xab, 0xba, 0x04,
+       0x81, 0xeb, 0x28, 0xfc, 0xe0, 0x22, 0x0a, 0xe7, 0xd5, 0x96, 0x8c, 0xd6,
+       0xf2, 0x80, 0x57, 0x63, 0xbe, 0x50, 0x95, 0x23, 0x76, 0x72, 0xf1, 0x98,
+       0x9a, 0xa4, 0x8b, 0x01, 0xf7, 0xeb, 0x7a, 0xb2, 0xa3, 0x0a, 0xa0, 0x7d,
+       0xce, 0x3a, 0x43, 0x0a, 0x98, 0x8a, 0x24, 0xc8, 0x2e, 0xc4, 0x1d, 0xd4,
+       0x32, 0xad, 0x5d, 0xd4, 0x78, 0xfd, 0x7e, 0x5f, 0xcd, 0xac, 0x3a, 0x54,
+       0x52, 0x24, 0x14, 0xc8, 0x2e, 0x0f, 0x0c, 0xcf, 0xb9, 0x39, 0x36, 0x29}},
+     {{0x00, 0x00, 0xe5, 0xee, 0xbd, 0x3f, 0xfb, 0xe9, 0x16, 0xed, 0xd5, 0x3d,
+       0xb1, 0x74, 0x7a, 0x4c, 0x12, 0x62, 0xef, 0x38, 0x04, 0xa2, 0x39, 0x09,
+       0x94, 0xa6, 0x9f, 0xfa, 0x64, 0x62, 0x27, 0xbd, 0xda, 0x77, 0x9d, 0xa2,
+       0x80, 0x5f, 0x45, 0x40, 0x49, 0x92, 0x7e, 0x58, 0xd7, 0x17, 0x3e, 0xf0,
+       0x01, 0x3a, 0xfd, 0x0c, 0x90, 0x7f, 0x5b, 0x13, 0x43, 0xb2, 0x13, 0x4b,
+       0xcc, 0x79, 0x80, 0x60, 0x8f, 0x9b, 0xe8, 0x99, 0x44, 0xf7, 0x26, 0x0d,
+       0x82, 0xda, 0x6b, 0x70, 0xbe, 0x54, 0x3b, 0xcb, 0x83, 0x1d, 0x97, 0x75,
+       0xdd, 0x0e, 0xe3, 0x26, 0x2e, 0xe5, 0xfb, 0xfc, 0xf1, 0xc3, 0xba, 0xde},
+      {0x00, 0x00, 0x49, 0x06, 0x4a, 0x15, 0x75, 0x94, 0xd0, 0x86, 0xf0, 0x9d,
+       0xd4, 0x86, 0xaf, 0x0a, 0x6b, 0x24, 0xc2, 0xca, 0x95, 0xc4, 0xe6, 0x26,
+       0xfe, 0xf2, 0x5b, 0x35, 0x33, 0x7b, 0xed, 0x86, 0x26, 0x1e, 0x89, 0x6c,
+       0xe9, 0xd8, 0x65, 0xa4, 0x39, 0x12, 0xfc, 0x58, 0x92, 0x0b, 0x3f, 0xd0,
+       0xa3, 0xc2, 0x27, 0xd3, 0x13, 0xd7, 0x9b, 0xf5, 0xdd, 0xd0, 0xfc, 0x01,
+       0x26, 0x24, 0x41, 0xb9, 0x4a, 0xf1, 0x86, 0xd2, 0xc0, 0xd5, 0x1a, 0xc2,
+       0x76, 0x6a, 0x86, 0xe2, 0xb6, 0x9a, 0xa2, 0xdb, 0xfb, 0x7d, 0x73, 0xd5,
+       0x94, 0xad, 0x68, 0x6e, 0xa6, 0xfd, 0xc3, 0x14, 0xd9, 0xdd, 0x87, 0x97}},
+     {{0x00, 0x00, 0x58, 0x4b, 0x96, 0x52, 0xb7, 0xcc, 0x64, 0x6e, 0xe5, 0xed,
+       0xcb, 0x98, 0x0d, 0x40, 0xc0, 0xd0, 0x0c, 0x87, 0xd0, 0xfb, 0x9d, 0xcd,
+       0x68, 0x06, 0x17, 0xd2, 0xd8, 0x58, 0x5a, 0xd5, 0x01, 0x95, 0x34, 0x07,
+       0xb0, 0x1b, 0x99, 0x0f, 0xdb, 0xdd, 0x5f, 0x8e, 0xbe, 0x50, 0x47, 0x27,
+       0x75, 0xa6, 0x14, 0xfa, 0x6c, 0xbb, 0xef, 0x73, 0x82, 0x21, 0x80, 0xa2,
+       0x47, 0x04, 0xfb, 0xae, 0x0a, 0xe2, 0x84, 0x29, 0xb5, 0x5b, 0xae, 0x88,
+       0xc9, 0x1e, 0x51, 0xf0, 0x9b, 0x2e, 0xf1, 0x31, 0xc8, 0x1b, 0x6f, 0xea,
+       0x01, 0xa1, 0x57, 0xbb, 0xb8, 0xd9, 0x61, 0xda, 0x8f, 0x85, 0xa8, 0xb4},
+      {0x00, 0x00, 0x27, 0xb4, 0x59, 0xe7, 0x19, 0xcc, 0xf1, 0x49, 0xf7, 0x1c,
+       0x19, 0xa1, 0xf3, 0xd0, 0x86, 0xc2, 0x12, 0xaa, 0x52, 0x3e, 0xbf, 0x94,
+       0xe7, 0x23, 0x5c, 0xc6, 0x86, 0x33, 0x6c, 0x4c, 0x71, 0x82, 0xb6, 0x34,
+       0x41, 0x40, 0x87, 0x0f, 0xbe, 0x46, 0xb8, 0xc6, 0xa0, 0x58, 0x15, 0xc5,
+       0xff, 0x6d, 0xed, 0x55, 0x3a, 0xe7, 0xbf, 0xaa, 0x39, 0x42, 0x0d, 0x40,
+       0x1b, 0x3f, 0x05, 0x7e, 0x33, 0xba, 0xa2, 0x18, 0xe9, 0x0e, 0x2a, 0xad,
+       0x54, 0x33, 0x4a, 0xad, 0xf7, 0xc7, 0x13, 0x64, 0x65, 0x2d, 0xe5, 0x19,
+       0x44, 0x8a, 0x49, 0xbb, 0x83, 0x24, 0xf7, 0xee, 0x30, 0x6b, 0x9f, 0xdd}},
+     {{0x00, 0x01, 0x7a, 0xfc, 0x12, 0x19, 0xb3, 0x5f, 0xe7, 0x37, 0x21, 0x2c,
+       0x56, 0x7a, 0xed, 0x92, 0xe3, 0xc2, 0x4a, 0x2f, 0x0b, 0xac, 0x58, 0x7d,
+       0xfb, 0x72, 0x4d, 0x54, 0x16, 0x63, 0x28, 0xba, 0xb7, 0x78, 0x8d, 0xa5,
+       0xa7, 0xa7, 0x9f, 0xfe, 0x5f, 0x31, 0xd8, 0x94, 0xfd, 0x97, 0xcf, 0x2e,
+       0xa0, 0x47, 0xcf, 0x36, 0x2a, 0xf2, 0xf9, 0x8f, 0xda, 0x67, 0xd0, 0xb5,
+       0x82, 0xad, 0xa1, 0xc1, 0x87, 0x14, 0xcf, 0xd1, 0x7b, 0xd0, 0x60, 0xd9,
+       0xb2, 0x0e, 0xe5, 0x43, 0xe7, 0x0c, 0x8d, 0x36, 0x45, 0x6e, 0x3f, 0x2e,
+       0x34, 0xdb, 0x39, 0x69, 0x8a, 0x9f, 0x41, 0xc9, 0x7b, 0x7f, 0x6a, 0x39},
+      {0x00, 0x00, 0x07, 0xa9, 0x92, 0x8a, 0x01, 0x3a, 0x9b, 0x96, 0x6d, 0x6d,
+       0x6c, 0xa4, 0xb4, 0x33, 0xc6, 0x20, 0xa4, 0x8c, 0x86, 0x4c, 0xbb, 0x75,
+       0x83, 0x9b, 0x6d, 0x76, 0x4b, 0x98, 0x99, 0xd0, 0xec, 0x79, 0x50, 0xb2,
+       0xe2, 0x94, 0x2b, 0xc1, 0x73, 0xa6, 0x0a, 0x92, 0xc7, 0x3c, 0x11, 0x2c,
+       0x13, 0xba, 0xa3, 0x4f, 0x5e, 0xfa, 0x2b, 0x6d, 0x17, 0x28, 0x0e, 0x60,
+       0x3d, 0xad, 0xff, 0xdf, 0xd6, 0x94, 0xd4, 0x4f, 0xe8, 0xb3, 0x14, 0xb7,
+       0x68, 0x33, 0x1a, 0xe5, 0x2b, 0x31, 0x3f, 0xfd, 0x82, 0xef, 0x0f, 0x34,
+       0xc7, 0x5b, 0xa5, 0xfb, 0xd8, 0x1e, 0xf4, 0x8b, 0xfe, 0x8d, 0x20, 0x1a}},
+     {{0x00, 0x00, 0xc5, 0xe2, 0x19, 0x58, 0x67, 0x5e, 0x0e, 0x11, 0x8f, 0xa8,
+       0xe3, 0x84, 0x9d, 0xa6, 0x99, 0x02, 0x7d, 0xab, 0xb4, 0x70, 0x0d, 0x69,
+       0xf7, 0x1e, 0xbb, 0xe7, 0xd3, 0xea, 0x2e, 0x5b, 0x46, 0x49, 0xf8, 0xb4,
+       0x17, 0x0d, 0x7a, 0x0a, 0xde, 0xd7, 0x20, 0x57, 0xc3, 0x71, 0xab, 0x3b,
+       0xae, 0x79, 0xc2, 0x91, 0xe7, 0x5d, 0xdd, 0x1a, 0xcb, 0x14, 0x02, 0x58,
+       0xe3, 0x7a, 0xa3, 0x4b, 0x94, 0x57, 0x0e, 0xcd, 0xe8, 0x66, 0xc0, 0x5d,
+       0xeb, 0xe8, 0xa6, 0x5f, 0xe6, 0xe9, 0x0f, 0x58, 0x12, 0x12, 0xf7, 0xe1,
+       0xd7, 0xe6, 0x9d, 0x9a, 0x8f, 0xd8, 0x3a, 0xd0, 0x6d, 0x7b, 0x0c, 0x16},
+      {0x00, 0x01, 0x69, 0xe2, 0x33, 0x07, 0x95, 0x7c, 0xbd, 0x47, 0x10, 0xaf,
+       0x6e, 0xa2, 0xfb, 0xc4, 0xef, 0x0b, 0x32, 0xd0, 0xea, 0x68, 0x60, 0xd5,
+       0x77, 0x3a, 0x1d, 0x10, 0x70, 0x67, 0x50, 0x2d, 0xb4, 0xaf, 0x46, 0x82,
+       0x93, 0xf9, 0xd6, 0x47, 0x29, 0x81, 0xb2, 0xad, 0xfe, 0xc7, 0x26, 0x59,
+       0x05, 0xc3, 0x99, 0x24, 0x23, 0xc5, 0x30, 0xc4, 0x96, 0x9e, 0x0f, 0xe4,
+       0x63, 0x5f, 0x12, 0xda, 0xc0, 0x54, 0x0f, 0x47, 0x64, 0xc9, 0x13, 0x6f,
+       0xb6, 0x3b, 0xbc, 0xdf, 0xcc, 0xf7, 0xdf, 0xfd, 0xcb, 0xbf, 0x2d, 0x2f,
+       0x88, 0xbd, 0xf9, 0xd8, 0x9c, 0x9c, 0xca, 0x53, 0x67, 0xb5, 0xba, 0x23}},
+     {{0x00, 0x00, 0x96, 0x35, 0xd5, 0x59, 0x51, 0x17, 0x59, 0x01, 0xae, 0x11,
+       0x44, 0x32, 0x6d, 0xa0, 0x9e, 0x3f, 0x07, 0x5b, 0x4c, 0x52, 0x43, 0x39,
+       0x61, 0xab, 0x07, 0x43, 0x4c, 0x5e, 0x5b, 0xbe, 0xec, 0x15, 0x95, 0x37,
+       0x06, 0x34, 0x88, 0xb9, 0x4e, 0xb6, 0x7e, 0x57, 0xc3, 0xf2, 0xcd, 0xd2,
+       0x3e, 0x05, 0xee, 0x04, 0x3d, 0x4f, 0x37, 0x7d, 0x46, 0x9c, 0xb9, 0xe8,
+       0x34, 0x20, 0xf4, 0x53, 0x39, 0x36, 0x33, 0x00, 0x62, 0x55, 0xa1, 0xf0,
+       0x97, 0xfe, 0x0a, 0xb6, 0x62, 0x28, 0xf6, 0xac, 0x3c, 0xe0, 0x73, 0x0c,
+       0xcb, 0x3f, 0x38, 0x79, 0x6e, 0xd7, 0xfd, 0xbc, 0x4a, 0x80, 0xa5, 0xba},
+      {0x00, 0x01, 0x18, 0x6d, 0x69, 0xed, 0xff, 0x94, 0x56, 0xe5, 0xc2, 0xf8,
+       0x55, 0x5b, 0xb0, 0x8e, 0x0b, 0xa7, 0xd1, 0x25, 0x86, 0xed, 0x30, 0xc4,
+       0xff, 0x48, 0x6b, 0x2e, 0xe3, 0xda, 0x2b, 0x6e, 0xc7, 0x04, 0xcb, 0x9c,
+       0x45, 0x52, 0x32, 0xcc, 0x5a, 0x31, 0x43, 0x68, 0xf6, 0xf3, 0xf9, 0xc3,
+       0xa0, 0x8e, 0x43, 0x37, 0xaa, 0x9d, 0xca, 0xaf, 0x04, 0xfe, 0x6d, 0x28,
+       0xaa, 0x43, 0x08, 0xf3, 0xe2, 0x46, 0x09, 0x4a, 0x0e, 0xaa, 0x5d, 0x05,
+       0x77, 0x3a, 0x4f, 0xac, 0x47, 0x5f, 0xf2, 0x48, 0xba, 0xfe, 0x6d, 0x94,
+       0xa9, 0x5b, 0x20, 0x92, 0x92, 0xda, 0x7f, 0xe5, 0xe7, 0x58, 0x2c, 0x27}},
+     {{0x00, 0x00, 0xdc, 0x65, 0x21, 0xee, 0x3c, 0x5e, 0xe6, 0x0b, 0xbf, 0xf7,
+       0xa4, 0x33, 0x56, 0x34, 0xe5, 0x77, 0xd1, 0x4b, 0xda, 0xb4, 0xb2, 0x58,
+       0x02, 0xe1, 0x5c, 0x9c, 0x76, 0x57, 0x8d, 0xbe, 0x51, 0x23, 0x1d, 0x83,
+       0xee, 0xf3, 0x23, 0xc9, 0x73, 0xff, 0xa1, 0x41, 0xbf, 0xa8, 0x94, 0x9e,
+       0x6c, 0x2d, 0xbf, 0x1c, 0xb7, 0x7d, 0xab, 0x1b, 0x45, 0xf2, 0xcb, 0xf9,
+       0xa3, 0x6c, 0x48, 0x77, 0xd5, 0x76, 0x95, 0x9b, 0xf3, 0xc1, 0x70, 0x7f,
+       0xf3, 0x05, 0xaf, 0x2b, 0x1d, 0xb9, 0xf2, 0x85, 0xe3, 0xc4, 0xb2, 0xcb,
+       0x8c, 0xdf, 0x0c, 0x1d, 0x22, 0xb3, 0x57, 0x87, 0x6c, 0x39, 0xcb, 0x6d},
+      {0x00, 0x00, 0x9b, 0x73, 0x3e, 0x32, 0xf2, 0x05, 0xb1, 0x52, 0xb1, 0x8c,
+       0xa3, 0x31, 0x1a, 0x9b, 0x27, 0xc6, 0xac, 0xbd, 0xf8, 0xcb, 0x07, 0xf7,
+       0xea, 0x9c, 0x15, 0xb9, 0xed, 0xbc, 0xc9, 0x64, 0x5a, 0x32, 0x6a, 0xcd,
+       0xdc, 0xb3, 0x4a, 0x78, 0x60, 0x5f, 0x96, 0x5a, 0xb5, 0xae, 0xf4, 0x13,
+       0x64, 0xcb, 0x20, 0x62, 0x25, 0xa1, 0x91, 0x1f, 0x30, 0xec, 0x25, 0x4a,
+       0x58, 0x68, 0xe7, 0xb8, 0xc3, 0x60, 0x76, 0xd1, 0xc3, 0x3a, 0x22, 0xc4,
+       0x6a, 0xef, 0x72, 0x7c, 0x61, 0xe6, 0x57, 0x1b, 0xee, 0xbb, 0xea, 0x6f,
+       0xc7, 0xb2, 0x92, 0x64, 0x6d, 0x8c, 0x16, 0x29, 0xe5, 0xa5, 0x0a, 0xa8}},
+     {{0x00, 0x01, 0x3e, 0x1f, 0x49, 0x90, 0xf4, 0xd4, 0xec, 0x88, 0xe0, 0xf9,
+       0xf1, 0xd5, 0x3a, 0x62, 0xbb, 0xe2, 0x11, 0x79, 0x3e, 0x4c, 0xc8, 0xf9,
+       0x68, 0x6b, 0xc5, 0x77, 0x58, 0x5d, 0xe9, 0xf1, 0x03, 0x56, 0x8e, 0xa6,
+       0x4b, 0x9b, 0x24, 0x14, 0x1d, 0x6b, 0xb0, 0xc1, 0x93, 0xdb, 0xae, 0x04,
+       0xde, 0x85, 0x97, 0x76, 0x19, 0x71, 0x9e, 0x60, 0xcb, 0x6d, 0xd9, 0xa3,
+       0xfa, 0x2a, 0xa2, 0xb2, 0x84, 0x75, 0x9a, 0x32, 0xd0, 0xf7, 0x21, 0xb7,
+       0xe9, 0x22, 0x68, 0xf3, 0xec, 0xf9, 0x03, 0xb4, 0x79, 0x7d, 0xad, 0xde,
+       0xb9, 0x36, 0xb9, 0xca, 0x62, 0x8b, 0x5e, 0x7d, 0xa2, 0x33, 0xb6, 0x60},
+      {0x00, 0x01, 0x62, 0x40, 0x2d, 0x2e, 0xd9, 0x4a, 0x63, 0x84, 0xb5, 0x5e,
+       0xe8, 0x0d, 0x34, 0x85, 0x20, 0x8f, 0x35, 0x99, 0xfd, 0x96, 0xd5, 0xf1,
+       0xa4, 0xe3, 0xb5, 0x2a, 0x45, 0xcf, 0x85, 0x87, 0x4a, 0x43, 0x2f, 0x35,
+       0x40, 0x2b, 0xa1, 0xf9, 0x8c, 0x8a, 0xbe, 0x5f, 0x96, 0xc2, 0xc2, 0x15,
+       0x07, 0xa6, 0x4d, 0xd4, 0x80, 0x36, 0xd5, 0x6b, 0x7b, 0x2c, 0xc7, 0x3a,
+       0xed, 0x0d, 0xa3, 0x92, 0xb5, 0xd6, 0xd9, 0xd6, 0xc5, 0xb1, 0x6c, 0xfc,
+       0x52, 0x5e, 0x63, 0x4c, 0xbe, 0x73, 0x2f, 0x87, 0x82, 0x88, 0xf3, 0x85,
+       0xe0, 0xdc, 0x89, 0x1a, 0x6b, 0x81, 0x59, 0x23, 0xfc, 0x8c, 0x4f, 0xb3}}},
+    {{{0x00, 0x00, 0xaa, 0x6f, 0xd5, 0xa9, 0x8b, 0xde, 0x20, 0x30, 0xa9, 0xb1,
+       0x30, 0x15, 0x3c, 0x97, 0x12, 0xdd, 0x31, 0x58, 0xf5, 0x6a, 0xfb, 0x08,
+       0x34, 0x31, 0x9a, 0x86, 0x92, 0xef, 0xca, 0xd7, 0x25, 0x23, 0x51, 0x0b,
+       0x1c, 0xde, 0x79, 0x9c, 0x14, 0x33, 0x8d, 0x51, 0xd7, 0x65, 0x8a, 0x4e,
+       0x7f, 0x70, 0x72, 0x8c, 0x77, 0xa6, 0x1b, 0xab, 0xdd, 0xef, 0xf6, 0x15,
+       0x55, 0xfd, 0xc1, 0x5f, 0xff, 0x2b, 0xdf, 0x47, 0xa9, 0xa5, 0x17, 0xc7,
+       0xbd, 0x38, 0x29, 0xdf, 0xca, 0x4b, 0xab, 0xd7, 0x37, 0x73, 0x3a, 0x11,
+       0x71, 0x65, 0x03, 0x27, 0x09, 0xf5, 0x34, 0x3a, 0x96, 0xbd, 0x13, 0x64},
+      {0x00, 0x01, 0x88, 0xa8, 0x1e, 0x71, 0x66, 0xf1, 0xd9, 0x6d, 0x88, 0xbb,
+       0x61, 0xb3, 0xc6, 0x4c, 0x51, 0xed, 0x13, 0xae, 0xfc, 0xde, 0xad, 0xb3,
+       0xc5, 0x04, 0xcf, 0x77, 0x37, 0x51, 0x3e, 0x6f, 0xc1, 0xbe, 0xfb, 0x2f,
+       0x39, 0x0c, 0x3a, 0x63, 0x24, 0xa5, 0xda, 0x40, 0xaf, 0xc9, 0x78, 0x3b,
+       0x81, 0xe6, 0xa1, 0xa3, 0x7d, 0x89, 0xf1, 0xd2, 0x57, 0x74, 0xca, 0x2a,
+       0x0f, 0xcf, 0x74, 0xe9, 0xe3, 0x82, 0x57, 0x66, 0x06, 0xdd, 0x80, 0xb2,
+       0x99, 0xae, 0x02, 0x6f, 0xa6, 0xa8, 0x55, 0x9e, 0x3c, 0xf0, 0xaa, 0x26,
+       0x28, 0xdc, 0xe6, 0xed, 0x48, 0x0a, 0x54, 0x92, 0x43, 0x9b, 0xa5, 0x6c}},
+     {{0x00, 0x00, 0x38, 0x84, 0xfe, 0x67, 0xc8, 0xe3, 0xad, 0x60, 0x55, 0x8f,
+       0x3d, 0xe9, 0xfb, 0x72, 0x66, 0x03, 0x66, 0xe6, 0x7c, 0xf7, 0x3a, 0x87,
+       0x99, 0x27, 0x5f, 0xdf, 0x4c, 0xbc, 0x2f, 0x1e, 0x58, 0x9a, 0xa0, 0xa2,
+       0xfc, 0xf3, 0xe1, 0xa7, 0xd0, 0xc3, 0x6b, 0x93, 0x50, 0x7d, 0xdb, 0xb6,
+       0xa6, 0xf8, 0x2f, 0x67, 0x4c, 0xad, 0x7a, 0x85, 0x56, 0x2f, 0x7b, 0x8f,
+       0x78, 0x20, 0x4d, 0x60, 0x8f, 0xde, 0xce, 0x54, 0x91, 0xeb, 0xd6, 0x70,
+       0x75, 0xc2, 0xda, 0x32, 0xe2, 0xcb, 0xd7, 0x5e, 0xb0, 0xc0, 0x76, 0xd9,
+       0x29, 0xd1, 0x53, 0xd3, 0xa1, 0x11, 0xa8, 0x27, 0x79, 0x10, 0xc4, 0xc1},
+      {0x00, 0x01, 0x68, 0x34, 0xcb, 0xfb, 0x7d, 0x32, 0x78, 0x4a, 0x41, 0xd5,
+       0xcc, 0xaa, 0x21, 0x86, 0xc2, 0x5d, 0x62, 0x67, 0x07, 0x12, 0x66, 0x54,
+       0x60, 0xfb, 0x43, 0xb7, 0xb0, 0x4d, 0x23, 0xa1, 0x8d, 0xb5, 0x82, 0x38,
+       0x06, 0x79, 0xa7, 0xc8, 0xe1, 0xab, 0x82, 0x63, 0x2a, 0xf4, 0xac, 0x1d,
+       0x6d, 0xb3, 0x09, 0x64, 0x38, 0xd1, 0x46, 0x65, 0x30, 0x01, 0xb9, 0x2c,
+       0xf5, 0xe1, 0x8a, 0x68, 0x80, 0xe3, 0xef, 0x0a, 0x78, 0x4f, 0x3b, 0xdd,
+       0x08, 0x1e, 0x7f, 0x95, 0xd1, 0x0f, 0xf4, 0x7c, 0x5d, 0x8e, 0x36, 0xdd,
+       0xd6, 0x0f, 0x28, 0xaa, 0x41, 0xdf, 0x5c, 0x42, 0xf5, 0x10, 0x0d, 0xf5}},
+     {{0x00, 0x01, 0x7b, 0x6c, 0x4b, 0xa8, 0x55, 0x71, 0x50, 0xe0, 0x78, 0xc3,
+       0x99, 0x8e, 0x70, 0x1d, 0x22, 0xcc, 0x09, 0x11, 0x4c, 0x82, 0xbd, 0x41,
+       0xac, 0x35, 0xff, 0x73, 0x28, 0x15, 0xdf, 0x14, 0x0e, 0xb2, 0x04, 0x09,
+       0x16, 0x40, 0x40, 0x60, 0x50, 0x64, 0xae, 0x00, 0xb5, 0x13, 0xcd, 0x23,
+       0x97, 0x31, 0xd2, 0x96, 0xa6, 0x0b, 0xbd, 0xe2, 0xa0, 0xea, 0x7f, 0xbb,
+       0x20, 0xf7, 0x24, 0x78, 0x3e, 0xe1, 0x86, 0xf5, 0x4d, 0x04, 0xa2, 0xd4,
+       0x1b, 0xec, 0x23, 0xd8, 0x13, 0xd7, 0x4f, 0xc2, 0xc7, 0x5d, 0x09, 0x3c,
+       0xc8, 0x4d, 0xa2, 0x70, 0xfa, 0xee, 0xa2, 0x14, 0x31, 0xb5, 0x98, 0xa6},
+      {0x00, 0x01, 0x3a, 0x8f, 0xc1, 0xc5, 0x6d, 0xd6, 0x33, 0x1c, 0xe5, 0x94,
+       0xb5, 0xe2, 0xc2, 0xbd, 0xcd, 0xef, 0xfd, 0xb1, 0x39, 0xd4, 0x26, 0x44,
+       0x9f, 0x66, 0x2e, 0x69, 0x04, 0x76, 0xf1, 0x44, 0xad, 0x8c, 0x1c, 0xce,
+       0x86, 0xf3, 0x8c, 0x56, 0x1f, 0x5d, 0x76, 0x64, 0xb4, 0xdc, 0x14, 0x97,
+       0xef, 0xe7, 0x34, 0x8d, 0x1d, 0x54, 0xdc, 0x38, 0x5f, 0x4a, 0x91, 0x80,
+       0x86, 0xd8, 0xec, 0x65, 0xc0, 0x87, 0x48, 0x3c, 0x69, 0x67, 0x22, 0x63,
+       0x2d, 0x2a, 0x3e, 0x91, 0xe4, 0xb7, 0x5a, 0x9c, 0x7b, 0x12, 0xd2, 0x66,
+       0x5c, 0x56, 0x9b, 0x3b, 0x06, 0x35, 0xb8, 0xa4, 0x8f, 0xb2, 0x91, 0xcc}},
+     {{0x00, 0x01, 0x93, 0x6a, 0xa1, 0xee, 0x1c, 0x9f, 0xa3, 0x1e, 0x85, 0xef,
+       0x9b, 0xff, 0x0f, 0xb4, 0xc0, 0xdf, 0x65, 0x56, 0xc8, 0x16, 0xb0, 0x97,
+       0xde, 0x99, 0x77, 0x15, 0x52, 0xa0, 0xb8, 0x49, 0x59, 0x47, 0x90, 0xf0,
+       0x27, 0x17, 0x92, 0x36, 0x67, 0x56, 0x1a, 0xfc, 0x25, 0xe6, 0xf4, 0x8a,
+       0x5a, 0xd5, 0xca, 0x3e, 0x6c, 0xdb, 0x11, 0x4f, 0xe5, 0xa7, 0xab, 0x24,
+       0xdc, 0xe8, 0xff, 0xe3, 0xf8, 0xf6, 0x60, 0xca, 0x72, 0x41, 0x60, 0x92,
+       0x46, 0x43, 0x98, 0x7f, 0x9b, 0x5e, 0xa2, 0x4b, 0xc7, 0xa8, 0x69, 0x74,
+       0xdb, 0x6d, 0x41, 0x29, 0x9e, 0xc8, 0x09, 0x84, 0xa9, 0x8f, 0x52, 0xcb},
+      {0x00, 0x00, 0x14, 0x76, 0x67, 0x04, 0x34, 0x2e, 0x47, 0x1d, 0x5b, 0x8d,
+       0x71, 0x23, 0x75, 0xdc, 0x0b, 0x51, 0x8d, 0xad, 0x2a, 0x9e, 0xd5, 0x55,
+       0x5e, 0x2d, 0x06, 0x36, 0x93, 0x43, 0xa2, 0x03, 0xac, 0x6d, 0x54, 0x3a,
+       0x03, 0x89, 0x48, 0x08, 0xda, 0xf9, 0x8a, 0x95, 0x40, 0xca, 0x45, 0x42,
+       0xda, 0xab, 0x96, 0xf9, 0x0a, 0xfd, 0xe7, 0xc6, 0x79, 0x00, 0x5e, 0x6b,
+       0xf7, 0x15, 0x28, 0x82, 0xda, 0xe4, 0x06, 0xd1, 0xd1, 0xc2, 0x96, 0x0a,
+       0x5e, 0xc5, 0x1a, 0xe0, 0x00, 0x6a, 0x01, 0x54, 0xb1, 0xa5, 0x84, 0x17,
+       0x68, 0xed, 0xdb, 0x9e, 0xd2, 0x37, 0x22, 0xea, 0x54, 0x95, 0xbc, 0x0b}},
+     {{0x00, 0x01, 0x6f, 0xfc, 0x3b, 0xd1, 0x54, 0x1f, 0x26, 0xae, 0xbb, 0x87,
+       0xd2, 0xf7, 0xd8, 0x80, 0xe2, 0x64, 0x23, 0xbe, 0x71, 0x36, 0xd9, 0x78,
+       0xa0, 0xa3, 0xaf, 0xa9, 0x28, 0x80, 0x4c, 0x77, 0x52, 0xdb, 0x3b, 0x25,
+       0x5b, 0x2e, 0xc8, 0xc0, 0x7e, 0xa0, 0x3d, 0x64, 0x2f, 0xb9, 0x8e, 0xc9,
+       0xb2, 0xb2, 0x8c, 0x55, 0xe7, 0xe0, 0xb2, 0x7a, 0x75, 0x96, 0xb6, 0x8a,
+       0xf4, 0x02, 0xea, 0x11, 0x54, 0x65, 0x04, 0x17, 0x33, 0x73, 0xb1, 0x5a,
+       0x80, 0x95, 0xdf, 0x47, 0x8f, 0x30, 0x86, 0x25, 0xde, 0x78, 0x64, 0xa8,
+       0xd7, 0xf3, 0x87, 0xcf, 0x76, 0x97, 0x0e, 0x4f, 0x32, 0x97, 0x44, 0x45},
+      {0x00, 0x00, 0x1c, 0xe8, 0xbc, 0x40, 0xcd, 0x47, 0xb0, 0x4a, 0x93, 0xaf,
+       0xf1, 0x15, 0xe0, 0xb9, 0x20, 0xe7, 0x71, 0x11, 0x1e, 0xcd, 0xae, 0x1c,
+       0x87, 0xd1, 0x9b, 0x4c, 0xf0, 0xd7, 0x52, 0x4f, 0x53, 0x3e, 0x4d, 0x9c,
+       0x47, 0xe2, 0xfd, 0x2f, 0xf4, 0x08, 0xfe, 0x20, 0xfb, 0xa6, 0x07, 0x74,
+       0x7a, 0x31, 0xc6, 0xd2, 0x7b, 0x04, 0x13, 0xa7, 0xec, 0x89, 0xc5, 0xca,
+       0xc4, 0xca, 0xad, 0x4d, 0xa2, 0xe8, 0x1b, 0x14, 0x79, 0xaf, 0x7c, 0x3f,
+       0x48, 0xa1, 0x0d, 0x3c, 0x90, 0xdd, 0xb6, 0xb4, 0xf6, 0xba, 0x25, 0x0e,
+       0xe3, 0x32, 0x15, 0xcf, 0x13, 0x3b, 0x1d, 0x62, 0xad, 0x75, 0x96, 0xb9}},
+     {{0x00, 0x00, 0x41, 0x01, 0xfe, 0x49, 0xa5, 0xc8, 0x24, 0xcd, 0xe0, 0x9c,
+       0xc4, 0x84, 0x77, 0x43, 0x6a, 0xa7, 0x11, 0xa4, 0xc9, 0x37, 0x9d, 0x5e,
+       0x77, 0x23, 0xaf, 0xf1, 0x79, 0x5c, 0x22, 0x44, 0xe4, 0xdc, 0x0e, 0x39,
+       0x68, 0x7a, 0x06, 0xfd, 0xd1, 0xf6, 0x3a, 0x0b, 0xbe, 0x6c, 0x50, 0xc8,
+       0x69, 0xd6, 0xeb, 0xda, 0x00, 0x15, 0x64, 0xf2, 0x24, 0x0c, 0x34, 0x22,
+       0x88, 0x14, 0xea, 0x39, 0x13, 0x07, 0xbe, 0x8a, 0xb1, 0xdb, 0xe7, 0x87,
+       0xa0, 0x70, 0x06, 0x64, 0xfb, 0x45, 0x2b, 0xe7, 0xcb, 0xcb, 0xef, 0x6a,
+       0x09, 0x5c, 0x43, 0xe9, 0xbf, 0xf9, 0x6b, 0xb7, 0x31, 0x4e, 0xe6, 0xea},
+      {0x00, 0x01, 0xb1, 0x55, 0xbb, 0x18, 0xe3, 0x35, 0x33, 0xc6, 0xfc, 0xbf,
+       0x76, 0x23, 0x49, 0x53, 0xaa, 0x1f, 0xaf, 0xb2, 0x2f, 0x3c, 0x72, 0x98,
+       0x02, 0x27, 0xa7, 0x7e, 0x9f, 0xe7, 0x0f, 0x88, 0x76, 0xda, 0x67, 0x7a,
+       0x3f, 0xae, 0x78, 0xc5, 0x9b, 0x16, 0xa2, 0x8b, 0x48, 0x9f, 0x2d, 0x16,
+       0xb2, 0x76, 0x66, 0xab, 0x7e, 0xd5, 0xec, 0x54, 0x21, 0x50, 0x85, 0x49,
+       0xc7, 0x11, 0xa9, 0x7a, 0x7a, 0xb4, 0x55, 0xae, 0x61, 0x1d, 0x76, 0x68,
+       0xa5, 0x66, 0x01, 0x6f, 0xc1, 0x95, 0x9a, 0x65, 0x05, 0xf7, 0x73, 0x9a,
+       0xc1, 0x5b, 0x5b, 0xa4, 0xaa, 0xc8, 0xa7, 0xd5, 0x2a, 0x5d, 0x62, 0x1c}},
+     {{0x00, 0x00, 0x58, 0xde, 0x60, 0x41, 0x44, 0xfa, 0x36, 0xcd, 0x72, 0xe2,
+       0xeb, 0xee, 0x15, 0x2a, 0xfc, 0x9f, 0x6f, 0x1d, 0x68, 0x46, 0x6f, 0x0a,
+       0xff, 0x21, 0xa4, 0x28, 0xf0, 0x2d, 0xbe, 0x09, 0x10, 0x54, 0x43, 0x23,
+       0xd0, 0x5d, 0x7c, 0x4b, 0xe8, 0x84, 0x11, 0xa7, 0x7a, 0x1d, 0x24, 0x4c,
+       0xcc, 0x8b, 0x26, 0x6b, 0xb0, 0x53, 0x02, 0xa1, 0xad, 0x6e, 0x22, 0x52,
+       0xbd, 0x03, 0xde, 0x33, 0xf9, 0x09, 0x23, 0x05, 0xcf, 0xc7, 0x45, 0x15,
+       0x0f, 0xef, 0xc1, 0xb5, 0x74, 0x9b, 0xf1, 0x8f, 0x69, 0xc7, 0xbc, 0x16,
+       0xfb, 0xd4, 0xf8, 0x78, 0x28, 0xa9, 0x3f, 0xb1, 0xbf, 0x26, 0x47, 0xe2},
+      {0x00, 0x00, 0x04, 0x58, 0x0b, 0xa9, 0x87, 0xfd, 0xfc, 0xde, 0x18, 0x44,
+       0x84, 0x1d, 0x1d, 0xcb, 0xc9, 0x35, 0x23, 0x6e, 0x93, 0xb6, 0xfc, 0xf6,
+       0x77, 0x00, 0x54, 0x44, 0xe9, 0x4b, 0x5b, 0x70, 0xbe, 0xae, 0xbd, 0x2b,
+       0xd2, 0xd2, 0xbf, 0xf8, 0xfe, 0x1e, 0x79, 0x05, 0x42, 0x02, 0x5d, 0xbd,
+       0xcb, 0x32, 0xe9, 0xd6, 0xab, 0x56, 0xf8, 0x93, 0x97, 0xc4, 0x4b, 0x4f,
+       0xcb, 0xb6, 0xd1, 0x75, 0x8e, 0xf5, 0xee, 0x39, 0xf6, 0xe8, 0x72, 0xc0,
+       0xdd, 0x38, 0xce, 0x5c, 0x26, 0xe3, 0xfd, 0xec, 0x17, 0xb9, 0xf7, 0xf5,
+       0xa2, 0x6b, 0x9c, 0x52, 0x5e, 0xc0, 0x15, 0x9e, 0xcd, 0x63, 0xdc, 0xdd}},
+     {{0x00, 0x00, 0x0f, 0x14, 0x75, 0xa4, 0x60, 0x7c, 0xbe, 0x0d, 0x5e, 0x61,
+       0x21, 0xe1, 0x42, 0x14, 0x3c, 0x46, 0x81, 0xa0, 0xa5, 0x20, 0x1c, 0x46,
+       0x50, 0xba, 0x27, 0xaf, 0x26, 0x31, 0xf4, 0x10, 0x5e, 0x65, 0x93, 0x13,
+       0xf0, 0x12, 0x11, 0xa3, 0xfa, 0x06, 0xd0, 0xf2, 0xe9, 0x5d, 0xdc, 0x88,
+       0x82, 0x99, 0x8e, 0x6b, 0x10, 0x1a, 0x68, 0x2e, 0xb1, 0x9d, 0xe0, 0x38,
+       0xaa, 0x56, 0x3b, 0xd9, 0x9f, 0x28, 0xf6, 0x25, 0x4d, 0xb1, 0x02, 0xf9,
+       0x3a, 0x7c, 0x5c, 0x9f, 0x20, 0x99, 0x24, 0x5a, 0xc4, 0x82, 0x93, 0xc0,
+       0x3f, 0xc2, 0x84, 0x7c, 0xc9, 0xec, 0x97, 0xa9, 0x8a, 0x9e, 0xd1, 0x49},
+      {0x00, 0x00, 0xe3, 0x1b, 0x9e, 0xad, 0xad, 0x85, 0x60, 0x07, 0xee, 0x1a,
+       0x72, 0x97, 0xe7, 0x97, 0x9d, 0xd0, 0x7b, 0xae, 0x0e, 0x26, 0x98, 0x7f,
+       0x7f, 0x48, 0x51, 0x0a, 0x61, 0xbf, 0xbc, 0xd5, 0x56, 0x1a, 0x12, 0x32,
+       0xdd, 0x87, 0xe5, 0xb6, 0x15, 0xeb, 0xbd, 0xd7, 0x28, 0x1a, 0x76, 0xfc,
+       0x00, 0x2b, 0x41, 0xcf, 0x1a, 0xad, 0xad, 0x4e, 0x07, 0x7f, 0x6e, 0xae,
+       0x15, 0xbe, 0x46, 0x98, 0x44, 0xbb, 0xe9, 0xe1, 0xe7, 0xa5, 0x02, 0x68,
+       0x0e, 0x4e, 0xda, 0x85, 0x14, 0x13, 0x0b, 0xf6, 0xac, 0x56, 0x3d, 0x63,
+       0xc6, 0x08, 0x86, 0xc8, 0x02, 0x13, 0xca, 0x67, 0xda, 0xe0, 0xad, 0x92}}},
+    {{{0x00, 0x01, 0x34, 0xa8, 0x4d, 0xf2, 0x5f, 0x63, 0x81, 0xe0, 0x00, 0x57,
+       0x73, 0x09, 0x8b, 0xe3, 0xa1, 0x36, 0xaa, 0x72, 0x62, 0x97, 0x1f, 0x8d,
+       0x8d, 0x09, 0x40, 0xb5, 0xf2, 0xed, 0x30, 0x5e, 0x1c, 0xea, 0x9c, 0xcb,
+       0x0d, 0xd9, 0x46, 0xe0, 0xe6, 0x71, 0x24, 0x19, 0x75, 0x76, 0xe0, 0xc0,
+       0x3a, 0x5e, 0xe2, 0x90, 0x22, 0x4e, 0xda, 0x63, 0xa6, 0x7e, 0x5b, 0xe3,
+       0x64, 0xd0, 0xcf, 0xf3, 0x81, 0x39, 0xb9, 0xe2, 0xef, 0xb3, 0xc2, 0x0f,
+       0x07, 0x7b, 0x19, 0xf8, 0x95, 0x95, 0x36, 0x34, 0xd7, 0xbc, 0x56, 0xd8,
+       0xc8, 0x04, 0xcf, 0xc2, 0xb2, 0x96, 0xfc, 0x81, 0x62, 0xee, 0x1a, 0x66},
+      {0x00, 0x00, 0x01, 0xfa, 0x99, 0xe4, 0x4a, 0x4c, 0xc3, 0x94, 0x45, 0xef,
+       0x5f, 0x3b, 0xa3, 0xfc, 0x67, 0xfa, 0xae, 0x7f, 0x6c, 0x56, 0x11, 0x72,
+       0xf4, 0xec, 0x00, 0xb6, 0x7d, 0xc2, 0xb9, 0x7e, 0x87, 0xd7, 0x37, 0x1f,
+       0xf3, 0x4b, 0xb3, 0x32, 0x02, 0xd6, 0x1f, 0x7f, 0x9a, 0xf9, 0x1d, 0x03,
+       0x91, 0x06, 0x06, 0xb5, 0xaa, 0x26, 0xe9, 0xe8, 0x9e, 0xb0, 0x28, 0x87,
+       0x6e, 0xae, 0x63, 0xdf, 0x1a, 0xd0, 0x3d, 0x45, 0xa5, 0x51, 0xe4, 0x5f,
+       0xb4, 0x8a, 0x59, 0xca, 0x95, 0x96, 0x2a, 0xa8, 0xaa, 0xe1, 0xfd, 0xa7,
+       0x9f, 0xdd, 0xbd, 0x0f, 0x9f, 0xb6, 0xb2, 0xc1, 0x32, 0x08, 0x33, 0x54}},
+     {{0x00, 0x01, 0x25, 0x53, 0x1d, 0x99, 0x61, 0x92, 0xb5, 0x2b, 0x7f, 0x47,
+       0x55, 0x92, 0xfd, 0x00, 0x01, 0x78, 0xed, 0x66, 0x16, 0xf4, 0x09, 0x9d,
+       0x2c, 0xa6, 0x07, 0x78, 0x1f, 0x83, 0x8d, 0x15, 0x99, 0x00, 0xd5, 0x96,
+       0xa6, 0x7f, 0x09, 0x22, 0xea, 0xbe, 0xeb, 0x82, 0xc9, 0xa5, 0x17, 0x7f,
+       0xec, 0xd7, 0x9b, 0xdb, 0x0f, 0xbd, 0x33, 0x67, 0x8c, 0xe6, 0xc3, 0x31,
+       0xd8, 0xb7, 0x1d, 0x32, 0x97, 0xbf, 0x29, 0x82, 0xd1, 0xa2, 0xd5, 0xa8,
+       0xad, 0xea, 0xa5, 0x31, 0xd1, 0x9a, 0x5d, 0x73, 0xf5, 0xed, 0x40, 0xd7,
+       0x3f, 0xfe, 0xbc, 0xf3, 0x19, 0xb2, 0x93, 0xa7, 0x65, 0x91, 0xd3, 0x45},
+      {0x00, 0x00, 0xc6, 0xdf, 0xe5, 0x2a, 0x09, 0xba, 0xad, 0xf7, 0xa2, 0x1a,
+       0x43, 0xa6, 0x1f, 0x79, 0x9d, 0x05, 0xa2, 0xa0, 0x02, 0x12, 0x2f, 0x29,
+       0x97, 0x96, 0xf1, 0x71, 0x88, 0x26, 0x19, 0xbb, 0x1d, 0x36, 0x7d, 0xbf,
+       0x49, 0xae, 0x79, 0x4b, 0x1f, 0x41, 0x07, 0xbb, 0xc5, 0x23, 0xdc, 0x08,
+       0xef, 0xe5, 0x6e, 0xe2, 0x43, 0x2d, 0xd4, 0xc3, 0x21, 0x12, 0xd0, 0x95,
+       0x7f, 0x51, 0x81, 0xc5, 0x82, 0xcf, 0xa4, 0x46, 0x95, 0x48, 0x32, 0x98,
+       0xc4, 0x9e, 0x96, 0xc4, 0x62, 0xad, 0x15, 0x60, 0xe6, 0x23, 0xb0, 0xc8,
+       0x3d, 0x31, 0x08, 0x39, 0xe7, 0x4f, 0xd4, 0xb7, 0x32, 0xbd, 0x50, 0xa2}},
+     {{0x00, 0x00, 0x22, 0x52, 0xa3, 0x38, 0x18, 0x3d, 0xdc, 0xfa, 0xd9, 0x2b,
+       0xd1, 0x1b, 0xb3, 0x75, 0x67, 0xa8, 0xba, 0xfb, 0xdf, 0xb7, 0x0a, 0xca,
+       0x1f, 0x37, 0xe0, 0xbb, 0xdb, 0x4c, 0xf6, 0xfb, 0x9c, 0x6e, 0x36, 0x86,
+       0xde, 0x6e, 0x11, 0x10, 0x70, 0x7a, 0x5b, 0x0a, 0xb3, 0x96, 0x2d, 0xd7,
+       0x7c, 0x11, 0xa2, 0x80, 0x6b, 0xca, 0x5e, 0x06, 0x0a, 0x0b, 0x0b, 0xc1,
+       0x4f, 0xe0, 0x32, 0x80, 0xf1, 0xa0, 0xb0, 0x6c, 0x7c, 0x5c, 0xed, 0x35,
+       0xcf, 0x92, 0xef, 0x86, 0xd2, 0x92, 0xfe, 0xf8, 0xc6, 0xbc, 0x37, 0x21,
+       0xcc, 0x3e, 0xe9, 0x9a, 0x25, 0x7a, 0xb2, 0x48, 0x8a, 0xf4, 0x3f, 0xb1},
+      {0x00, 0x01, 0x5c, 0x47, 0xa8, 0x9a, 0xb6, 0x83, 0x62, 0x67, 0x88, 0xf7,
+       0x1d, 0x18, 0x5a, 0x7f, 0xe4, 0x7f, 0x66, 0x7d, 0xfb, 0x08, 0xe3, 0x4c,
+       0x8a, 0x3a, 0xf4, 0x17, 0x74, 0xf5, 0xd6, 0xde, 0xad, 0xf8, 0x02, 0x99,
+       0x9c, 0xd5, 0x97, 0x25, 0x56, 0x93, 0xd8, 0x8f, 0xd8, 0xf9, 0x30, 0x06,
+       0x3e, 0x97, 0x9b, 0x21, 0xeb, 0xb7, 0x2c, 0x32, 0x9c, 0x06, 0xac, 0x23,
+       0xf5, 0x3a, 0x08, 0xae, 0x99, 0x91, 0x7a, 0x87, 0xbf, 0x6a, 0x08, 0xcc,
+       0x89, 0x47, 0x19, 0x56, 0x0a, 0x80, 0x58, 0xa3, 0xb9, 0xb3, 0xc5, 0x37,
+       0xfa, 0xb4, 0xa6, 0x90, 0xf1, 0xa8, 0x65, 0x87, 0x20, 0x96, 0x95, 0x45}},
+     {{0x00, 0x01, 0xa9, 0x3d, 0x54, 0x1f, 0xa0, 0xb8, 0x16, 0x8a, 0x51, 0x35,
+       0xa9, 0xdf, 0x38, 0x04, 0xc6, 0xbc, 0x04, 0x2b, 0x30, 0x57, 0x41, 0xf2,
+       0xa8, 0xc0, 0x21, 0x62, 0x07, 0xa5, 0x99, 0x37, 0x5e, 0x2b, 0x11, 0xa1,
+       0xb8, 0xb1, 0xea, 0x32, 0x5d, 0xf0, 0x6d, 0xa7, 0xbe, 0x43, 0x7e, 0xea,
+       0x28, 0x0e, 0xd8, 0xd7, 0x49, 0x1c, 0xc2, 0x53, 0xa9, 0x62, 0xb2, 0x6c,
+       0x96, 0x77, 0x8a, 0x3e, 0x37, 0x3f, 0xda, 0x95, 0xa2, 0x92, 0x25, 0xa7,
+       0xb0, 0x7a, 0x3c, 0x5a, 0x19, 0x63, 0x29, 0x21, 0xfa, 0xc1, 0xa3, 0xdb,
+       0xbb, 0xf2, 0xe8, 0xdc, 0x5f, 0x56, 0x5e, 0x16, 0xfa, 0x28, 0xfc, 0xd0},
+      {0x00, 0x01, 0x88, 0x14, 0xfa, 0x59, 0x10, 0x9b, 0x71, 0x39, 0x28, 0x9f,
+       0xc1, 0x71, 0xd9, 0x23, 0x0d, 0x36, 0xd7, 0x79, 0xd6, 0xa7, 0x35, 0x27,
+       0x5b, 0x46, 0x09, 0x86, 0x03, 0xc3, 0xc8, 0x77, 0x64, 0x3d, 0xa7, 0x2d,
+       0x6c, 0x65, 0x69, 0x83, 0x1c, 0x00, 0x26, 0xb8, 0x60, 0x1f, 0x04, 0x1f,
+       0x97, 0xcd, 0xd2, 0x9b, 0xa5, 0xa0, 0x0a, 0xd9, 0x52, 0xaf, 0xa8, 0x8b,
+       0x34, 0x7e, 0x2c, 0xe7, 0xa7, 0x91, 0xf2, 0x07, 0x50, 0x2c, 0x2e, 0x92,
+       0x91, 0x19, 0x25, 0x17, 0xe9, 0x82, 0xf8, 0xf1, 0x8c, 0x4c, 0xfa, 0x2a,
+       0x1d, 0xa6, 0x1f, 0x71, 0x97, 0x08, 0x70, 0x12, 0x33, 0x7c, 0x0f, 0x5f}},
+     {{0x00, 0x00, 0x78, 0x1b, 0x46, 0x5e, 0xa0, 0xb7, 0xe4, 0xa9, 0x33, 0xb3,
+       0xf1, 0xe9, 0x68, 0x7f, 0x46, 0xc5, 0xe5, 0x79, 0x12, 0xba, 0x56, 0x51,
+       0xa5, 0x58, 0xb5, 0x20, 0x42, 0x50, 0xa9, 0x9c, 0x90, 0x5b, 0xce, 0xde,
+       0x6f, 0x4d, 0xd5, 0x3e, 0x09, 0x33, 0x7a, 0xd1, 0x01, 0xf1, 0xd3, 0x42,
+       0x70, 0xd9, 0x7f, 0xe4, 0xe7, 0x93, 0xaf, 0x1b, 0xb3, 0x84, 0xb1, 0xce,
+       0x1c, 0x31, 0xd6, 0x59, 0x53, 0xbe, 0x51, 0xb1, 0x9e, 0xe4, 0x0b, 0x9f,
+       0xd4, 0xaa, 0x9e, 0x86, 0xe4, 0xeb, 0x0b, 0xf0, 0xa0, 0x81, 0x50, 0x75,
+       0x34, 0xed, 0x75, 0x9e, 0xe8, 0xc1, 0xda, 0xd2, 0xcf, 0xe6, 0xea, 0x08},
+      {0x00, 0x00, 0xe0, 0x6a, 0x4d, 0xc0, 0xf4, 0x8b, 0x9a, 0xd8, 0x8b, 0x23,
+       0x3b, 0xf5, 0xbc, 0x0d, 0x36, 0x9a, 0xf2, 0xfb, 0xd1, 0x24, 0xd6, 0x16,
+       0xf2, 0xac, 0x56, 0x2c, 0x0c, 0xe6, 0xf2, 0x28, 0x46, 0x06, 0x16, 0xdd,
+       0x51, 0x6b, 0xd5, 0xa2, 0xab, 0xb2, 0x67, 0xbe, 0x29, 0x13, 0x7e, 0xa3,
+       0x89, 0xbc, 0x7e, 0x07, 0xfc, 0x23, 0x85, 0xde, 0x07, 0x6f, 0x67, 0xfe,
+       0x77, 0x5b, 0x79, 0x1f, 0x44, 0x2f, 0xa7, 0xfb, 0xa4, 0xc9, 0x3d, 0xf8,
+       0x3d, 0xf7, 0x16, 0x0a, 0xe9, 0xc3, 0xcd, 0x28, 0xd2, 0xba, 0x81, 0xf9,
+       0xc9, 0x61, 0xfd, 0xb8, 0xbf, 0xf3, 0xd6, 0x03, 0xa0, 0xb5, 0xe3, 0x2c}},
+     {{0x00, 0x00, 0x07, 0x4b, 0x05, 0x3a, 0x01, 0x30, 0xbd, 0xf1, 0xf0, 0xc3,
+       0x65, 0xa0, 0x0f, 0x68, 0x00, 0xaf, 0xdc, 0xb0, 0x8f, 0xfd, 0x87, 0xbf,
+       0xa5, 0x86, 0x3d, 0x38, 0xfd, 0x46, 0xea, 0x28, 0xbb, 0xc9, 0x6a, 0x13,
+       0xe7, 0x3b, 0xe3, 0x83, 0x10, 0x1a, 0xd7, 0xfb, 0x6a, 0xa6, 0xdf, 0xab,
+       0xc5, 0xde, 0x15, 0xf8, 0x3d, 0xca, 0x02, 0x46, 0x75, 0xa9, 0xfc, 0xdf,
+       0x43, 0xf2, 0x19, 0xc4, 0xf7, 0x69, 0x85, 0xd9, 0x87, 0x2e, 0xd7, 0x36,
+       0xa4, 0x6b, 0xdf, 0xb2, 0xe8, 0x26, 0x2b, 0xc5, 0x2f, 0xcf, 0x55, 0x0c,
+       0x74, 0xfb, 0xe5, 0x4e, 0xbe, 0x40, 0xb2, 0x0e, 0xe4, 0x5a, 0x21, 0x68},
+      {0x00, 0x01, 0xab, 0xa4, 0xf7, 0xeb, 0xa1, 0x99, 0x89, 0xfa, 0x12, 0x37,
+       0xd5, 0x31, 0x27, 0xcd, 0xfc, 0x40, 0x7b, 0xda, 0x26, 0x21, 0x98, 0x98,
+       0xb4, 0xad, 0x47, 0xf9, 0x86, 0xbf, 0xcb, 0x1b, 0x09, 0x0d, 0x19, 0x87,
+       0x44, 0x21, 0x5d, 0xaf, 0x3c, 0x78, 0x21, 0x71, 0x8c, 0x3e, 0xa9, 0x4e,
+       0xf2, 0xc9, 0x70, 0x4f, 0x7f, 0x2a, 0xc7, 0x7f, 0x78, 0x6c, 0x9e, 0xa8,
+       0xd2, 0xfc, 0x59, 0xff, 0xbf, 0xf7, 0x23, 0x9a, 0x0a, 0x25, 0x8f, 0x8d,
+       0x99, 0x28, 0xc4, 0xdc, 0xea, 0xa1, 0xc9, 0x5d, 0x60, 0xb3, 0x46, 0xb3,
+       0x26, 0x6b, 0xbf, 0xab, 0x18, 0x2e, 0x13, 0x33, 0xa7, 0x59, 0xa3, 0xa9}},
+     {{0x00, 0x00, 0x87, 0xb7, 0xa7, 0x50, 0x16, 0x35, 0x9b, 0xf3, 0x59, 0x65,
+       0x66, 0x06, 0x88, 0x34, 0xe1, 0xae, 0x3a, 0x4a, 0x6f, 0x68, 0xc3, 0xd1,
+       0xec, 0x29, 0xd0, 0x14, 0x05, 0xf3, 0x37, 0x4f, 0x6e, 0x40, 0xe4, 0x36,
+       0x8a, 0x88, 0xa8, 0xe5, 0x66, 0x3b, 0x1a, 0xa8, 0xa0, 0xed, 0x30, 0xde,
+       0xcc, 0x9c, 0x50, 0x3b, 0xba, 0x21, 0x88, 0x05, 0x80, 0xae, 0x05, 0x13,
+       0xdc, 0xa0, 0x79, 0x83, 0x80, 0xc5, 0x9e, 0xbd, 0xcd, 0x05, 0xbe, 0x81,
+       0xd0, 0xc6, 0xc4, 0x33, 0x6f, 0xec, 0xe8, 0x10, 0x00, 0xf6, 0xea, 0xab,
+       0x68, 0xbf, 0x9b, 0x2c, 0x30, 0xb2, 0x5f, 0xdd, 0xa9, 0xdb, 0x7d, 0x1b},
+      {0x00, 0x01, 0x11, 0xc2, 0x0e, 0x74, 0x1e, 0x9c, 0xd6, 0xc0, 0xf9, 0x93,
+       0x4d, 0xfc, 0x66, 0x30, 0x29, 0x19, 0x2e, 0x7b, 0x39, 0xea, 0x32, 0x52,
+       0x31, 0x90, 0x22, 0xf6, 0xcf, 0x7f, 0xb5, 0x27, 0x82, 0x3c, 0xd8, 0x19,
+       0x33, 0xd0, 0xec, 0xd3, 0xba, 0x81, 0x5a, 0x4b, 0xf6, 0xa1, 0x6c, 0x51,
+       0x97, 0x9f, 0x78, 0xbd, 0x2e, 0x88, 0x71, 0x92, 0x5c, 0xd1, 0x17, 0x0c,
+       0x8c, 0x48, 0x96, 0xc9, 0xa2, 0x6d, 0x16, 0x2e, 0x04, 0xef, 0x40, 0x04,
+       0xd8, 0xd6, 0x67, 0x07, 0x59, 0x50, 0x50, 0x32, 0xb5, 0x42, 0x9e, 0xb0,
+       0xb6, 0x23, 0xe5, 0xb0, 0xe1, 0x4b, 0x95, 0xb5, 0x85, 0xdb, 0xdb, 0x7e}},
+     {{0x00, 0x01, 0x39, 0x3f, 0x64, 0x40, 0x74, 0xd6, 0xd6, 0x2d, 0xd7, 0x1e,
+       0x2d, 0x88, 0x00, 0x2a, 0x7c, 0x15, 0x72, 0x8f, 0x0d, 0x0d, 0x65, 0x8b,
+       0xe0, 0x0d, 0xae, 0xfc, 0x4e, 0xe7, 0x8a, 0x41, 0xf9, 0x91, 0xaf, 0x56,
+       0xa7, 0x8d, 0xe1, 0x9a, 0x87, 0xd0, 0xff, 0xfb, 0x83, 0x49, 0x6b, 0xb1,
+       0x81, 0xde, 0x2c, 0x1c, 0x10, 0x64, 0xd6, 0x10, 0xae, 0x39, 0xf5, 0xd7,
+       0x20, 0x01, 0x6c, 0x6d, 0x39, 0xc2, 0x1b, 0x7f, 0xee, 0x69, 0x6d, 0x64,
+       0xc4, 0x8b, 0xe9, 0x8d, 0x05, 0x2f, 0xef, 0xd2, 0x00, 0xdc, 0x50, 0x6d,
+       0x39, 0x1f, 0x3a, 0x75, 0xc0, 0x8a, 0x02, 0xd6, 0xd3, 0xce, 0x24, 0x97},
+      {0x00, 0x01, 0x3e, 0xe7, 0x9b, 0x8d, 0xf7, 0xf4, 0x2f, 0x6c, 0x93, 0x19,
+       0x88, 0xcc, 0xc9, 0x20, 0x06, 0x3e, 0x56, 0x21, 0x28, 0xf8, 0x17, 0xf0,
+       0x8e, 0xc0, 0x57, 0x9d, 0x11, 0x66, 0xb5, 0x5a, 0x47, 0x72, 0xa3, 0x2d,
+       0x42, 0xed, 0xe3, 0xdc, 0x6b, 0xf5, 0x97, 0x70, 0xb3, 0xec, 0xbb, 0xc1,
+       0x53, 0x27, 0xa8, 0x57, 0xf0, 0x89, 0x93, 0xe0, 0x16, 0xd9, 0x93, 0x54,
+       0x7a, 0x7f, 0xf1, 0x6a, 0xb0, 0x54, 0xb0, 0xfc, 0xd8, 0xad, 0x53, 0x74,
+       0x64, 0x06, 0x8e, 0x72, 0x39, 0xcc, 0x2a, 0x10, 0xcb, 0x75, 0x00, 0x3d,
+       0xaa, 0x9c, 0x0d, 0x1f, 0xc8, 0x0b, 0xb0, 0x5b, 0x5a, 0xc2, 0xbe, 0xd9}}}};
+#endif
+
+// group_lift_x: p - 1 = 2^field_two_adicity t with t odd, c = z^t for
+// a non residue z, roots[j] = c^(2^j), and e = (t - 1) / 2
+#define field_two_adicity 30
+
+#if defined(CODA_HOST)
+static const fe_packed field_sqrt_roots[field_two_adicity] = {
+    {0x34d7cf286b8dd9be, 0xda483963c0868e44, 0xd92dbc3470c94665,
+     0x914e79efdfdf3183, 0xf3cbdf139b08199c, 0x363ce0de02bcdfb1,
+     0xceb2c2f9fd093e17, 0xcf1b85bab0518d6b, 0x2010a7fda396adc5,
+     0x3746ba361256fe6e, 0x10fa2b3d06f2e6c9, 0x00003b4035800a00},
+    {0xbbe86851bf2a078a, 0x43b2a1a636c35143, 0xd61a3baf773a4012,
+     0xa94b1a66345772a9, 0x8ae15a8411b951f7, 0xac159bfdc0c56832,
+     0x853402206e9dfad0, 0x887bc3dd89ebcd55, 0x8875b2a0f1d7f97f,
+     0x74a9b3f13d0bb794, 0x45c2570dbbea00e6, 0x0001955c838b9f1c},
+    {0x8f9ad4e5a1193d8d, 0x1ac7e70cb8285517, 0x265e9701f236907a,
+     0xd47fce30f37d85de, 0xbbd1c627d0460499, 0xbbd6640654161b3a,
+     0x58c38586f47936eb, 0x56ea05719c806a4a, 0x67e1796f352a38d2,
+     0x20f79a394f89968d, 0xd0ad7ca8890fc0b1, 0x00011f2b87c44ddf},
+    {0x2044bce77fc390c4, 0x1fea7245f4068ee3, 0x73257fac9d8d6474,
+     0x177faf3028e92e43, 0x4dc9ede45088f1f0, 0x17eb9a39bd40e49f,
+     0xfb6ad8f40f8af5f4, 0x0cc237fbc8f82f3c, 0x2ac4d108e46eed6c,
+     0x61d298d7defff28d, 0x85651b93941859c2, 0x00008b16b8b0efdb},
+    {0xccef8a5bc62f4dcc, 0x282584eca91bf2cd, 0x1638dbcfa349f0b5,
+     0x4482f8431eb80386, 0xe1e517665b18eccf, 0x302d5295457dade4,
+     0x363957990e6bc702, 0x946d973357a067e5, 0x0c579e4b93802ed0,
+     0x64ea83366213d448, 0x29963f9f3e423754, 0x00017cdce8c047f6},
+    {0xfd0d6c32f76c4738, 0x033d1a30bd80170f, 0x1982d9a2534b8383,
+     0xace51c1f67cdf49f, 0xc8547e709045a523, 0x92d90b7bc3a43b92,
+     0xc563fc156975b6be, 0x594715ab657f2a34, 0xb0c1e072ee4d0b43,
+     0x56429f3d1bcf87a5, 0x813e4c5958328782, 0x0000f05d5f58ddba},
+    {0x88e38520c26342e4, 0xdb65de8819a86299, 0x73127f6905185df1,
+     0xcaea431b9980124b, 0xfeca6558f8f15762, 0x574ebae805c388d8,
+     0xb847eda75bf39b94, 0x2c0aa31fa1973ebb, 0x43349f59ecae5c8b,
+     0xfdbcbf5e465b510c, 0x0d3435557ec5725f, 0x0000f20906e033d5},
+    {0xda785d1b3916ca2a, 0xf772d13425130480, 0x1e9ca455d6a63341,
+     0x4b8f59e061d89f22, 0x753abe72a49bb171, 0x1127815d553874d4,
+     0x8b4db416a1653068, 0xab6a6b2c5e15c4f3, 0x92fead7cdd493b61,
+     0xc7e04a6d535ca61a, 0x8f483d9b681c0f28, 0x0000972ef11ed1c1},
+    {0xe2b43f296efe43f6, 0x47a7ef84f52df7a4, 0x5a9de57022fecde4,
+     0xc2627b61ae03b536, 0x14758c45f810f8df, 0x445694f47043e8c0,
+     0x64232e22ba478a79, 0x214c268a5953ce71, 0x3d04c3400228adb1,
+     0x46a08b258953ec50, 0x9d76e1e36504b197, 0x00000d1389d8c7e9},
+    {0x3c766a263a9264ec, 0x1b2420033a7c70f0, 0xa2ba8d762253120f,
+     0x75014fde7449526e, 0x130d51bf0e2f3d31, 0x4409c16c1807e8fd,
+     0xb4f9b3b0813eefb7, 0x77e6fc0992970316, 0x5762e0ff77d456ba,
+     0x71ede2d6ceee5b78, 0x9e48aa904e516429, 0x00008dbe0cbe95c4},
+    {0xe39610ee79784a6f, 0x129a8e84178a943a, 0x1669350113a22043,
+     0x1521aaceee0f6620, 0x5618cd0ce47a3d5e, 0x72b21b82d3b40013,
+     0x2fbb29f0d73d5ad7, 0xdf767b023f5374d2, 0x991bc28e6a00a142,
+     0xe895fde6aeb02b6b, 0xd9293176b1e5ce55, 0x0001253f3ddaa3aa},
+    {0x88923a3d83c48d2e, 0x972cb26d58f4ed7e, 0xf055e41b229eda53,
+     0x5303ae4204497e4c, 0x8a8b24a1aac738df, 0x08b2c8bca75a4f70,
+     0x451056fb3898f27d, 0x48e997ecd0485a99, 0x4908de4e130eeb36,
+     0xf53056ce19229d20, 0x770941bb9fb79580, 0x0000b115ba9dcbec},
+    {0xc1486df6db98737f, 0xe58d3f6c02b09a17, 0x6b86ddda846b41ce,
+     0x70f525130b1f8d02, 0x4df10f27c4d7aaa0, 0x624df2aabe51c51d,
+     0x7cc682db9df99f6e, 0x22e5419490d7b13c, 0x22714a7e7a53a8c9,
+     0x9a9d61c1f851d0e4, 0x3e72abf899a79bba, 0x00010e29b67acead},
+    {0x81964ec54c769c0a, 0xae557b86f4d25041, 0x6e4998a77242bdaf,
+     0x4e67d60f4c796b32, 0x3c65dd8b80d57d0c, 0x31bdbbad2ad99420,
+     0x209ba8c9684d1b23, 0x17b3a570dea1b523, 0x735da257862b81eb,
+     0x27239c3953eef4e6, 0x996f15ae77f91327, 0x000151004208e448},
+    {0xdf68a77beb9d8fdd, 0x5262c648f5fd4652, 0x58e465930ad893fb,
+     0x05982f9addf0ea1c, 0x61f3bbd0f1f1f5cb, 0x5d362ff93e9f8460,
+     0xd18fb8f0ed7c0906, 0x9efbe37e44853bde, 0x25c14a2f472e556b,
+     0x35295f4f3def4a0a, 0xce2cf15f33174c54, 0x0001737cf27df592},
+    {0x7e7b8ff292a1d078, 0x4bd153f581a38a05, 0xbfcb6250320ad79d,
+     0x3e21858c530b0260, 0x3170a5ad394b6b39, 0xcc9b58cef0cdcfa6,
+     0x97c196a7e926b740, 0xa7ca2174a10d0bd9, 0x3192fdbf9419991d,
+     0x5482691610ae1de0, 0x529e5df0acf86817, 0x000000cfe5245dc5},
+    {0xbac27f3c9bc25f17, 0x096564f0a167975b, 0xdf0b3fd5a5150705,
+     0x60d1e18c359fd00c, 0xa6ef36cba3f7cbe1, 0xf15c95bfb7d0ba32,
+     0x3c33c9cdaa705e73, 0xe1ff54ef7710b10a, 0x7901607ade5e5d9f,
+     0xb2f992c77ab5446c, 0x4b52bead06b1f345, 0x0001702f53aeb0ee},
+    {0xaab946ba46aca5e4, 0xb720eae1cba634ae, 0x6bc79a15b2244af5,
+     0xb2b61c961cb5b35d, 0xa2aefa784e72590f, 0x5edd06bb37dedabc,
+     0x6c56dbb39282a7af, 0x80209cbd2fb4b385, 0x33d2cedd42aaa35a,
+     0x4e612d45ca5bcca5, 0x9fad514b3fed437c, 0x00001eba708f13e7},
+    {0x138ff1c35827fc14, 0x684d3d035bbd9112, 0x3f10889bd6783123,
+     0xa110f3a75586d64b, 0xab7742e1c86b2ee6, 0x2576bcc1cbb63225,
+     0x23e6ced80238fb49, 0x7d60f28ac2389028, 0x7544f10fb3776043,
+     0x6959e40400246767, 0x5a594a2af0830400, 0x0001b91b96197331},
+    {0xee3460effac80553, 0x1d259fc7bb787045, 0x73d70c836791c97c,
+     0x126d95621ae9bda2, 0xe1bd1c33b562a274, 0xd74665f080d2254a,
+     0x34db30e8894ab95b, 0x60e381d1dcda277b, 0x301d3a9383fb7fcc,
+     0x6062d46be51f2ed8, 0xba7a61b4d2f3eef0, 0x00015c0e5ba64fc4},
+    {0x6d117e3bc9d4523d, 0x3684978c514515de, 0x7969097c1674bb86,
+     0xe9cd8dc4072c70b7, 0x3a92e67267d998f5, 0xc72d15ab73366b81,
+     0x549cdf3f62bcbe54, 0xb266fd3746ab822a, 0xa7b62f13de160fec,
+     0x66c6430dd36e387f, 0x2881cefcb33c0663, 0x0001b70ca545df97},
+    {0x1f827b1ea11c7877, 0x6e8da31e050d1604, 0xeffd6d589c662053,
+     0x7921fbaf24f518b6, 0xcaad3dbbf0242c7c, 0xa9efef94ac890692,
+     0xc162e26a90cc5423, 0xa07784f5c2791bf7, 0xa53bd30edf727121,
+     0x63bc5d206b3b0800, 0xe680bc6d4c22eaa9, 0x0001a62e5cdc0053},
+    {0x0672ecbfc1cb36a8, 0x4d8bf45d3b2adabb, 0x21a44d6c19c26e3a,
+     0x3c393493f2e941a6, 0x632a30fb786b6f7e, 0x631ea38f59da7f0b,
+     0x9b170d12df359efc, 0xe4211b87918506f4, 0x10824155c4b3d6ce,
+     0xf817f0e9fc3da561, 0xe76b977de9262731, 0x000029bfb16a057f},
+    {0x23e9c124d73a931a, 0xc48089cad6525b0a, 0xf43f4c25e9997f12,
+     0x949fe41cf1b3bb8e, 0x67a3fa6b642d5c86, 0x54494f2bd02cdd16,
+     0xf2cbb7e33f3f8938, 0x630ebbbb44e32312, 0x635ff21be4af8939,
+     0x21e259a7cf10da9f, 0x875c19f5f38a1130, 0x00017f9759078dd6},
+    {0xb4ba1339e94c3140, 0xb0b9c2d8e4218604, 0xce811bf90306b308,
+     0xa55c17a1a2eabe09, 0x25aa3b25554f0298, 0xe98d01dd55435987,
+     0xad82fb7f664c3b75, 0xb377af3e30b8503f, 0x152c92c9d609e807,
+     0xb516960af62158bb, 0xa80afa401838e129, 0x0001b31ffaad2947},
+    {0xd3397c7e39c17243, 0x0500b3c4a1be0032, 0x55f024525c366612,
+     0x2eccc0bf1d273a46, 0x4b645c14dd946547, 0x07af63e7b00cbd56,
+     0x9e624a269e36913e, 0x72ce79371579bf32, 0x9c2b347996559802,
+     0xb29c515ed64c0c35, 0x2fd08c6fc4be9f15, 0x0000c38960fbdea7},
+    {0x0bb45b4d1f8b6d42, 0x7218992e4d4b8d8a, 0x512c2decf7477a72,
+     0x607fe93efa42ffa8, 0xc9dc390c2c9958f5, 0x9b49cc0132ecef23,
+     0x86e9c575b3853cd4, 0x5e0ad2b6736d01e9, 0x40f17f9ae4a172bd,
+     0x99027bfea0256f98, 0x3153d99cf55aceac, 0x00012e581ee96e2e},
+    {0xb6d1250a3e399b78, 0xfba43c8dc00e6b67, 0x22ec4657515bc074,
+     0x32c329f34ddd53b2, 0x380da83068ae28f3, 0x9c31209d3dd8577a,
+     0xe216dc4c39148548, 0x01bceb90b0dad0dd, 0x7b98db728c5c0eb7,
+     0x3a96ac94e90eb45e, 0xd2f36359980dacd9, 0x00009964fd69e84d},
+    {0x3429df286e5b7854, 0xdc03429a1eab5a00, 0xb2ab5672415fbc9a,
+     0xcf305faf197e8664, 0xd97e7279c2e02c21, 0xa2239a0f493ac369,
+     0xcb028a4e35b62153, 0x5c455e1879430e27, 0x6ba4ef8440d5da44,
+     0xf6d898825ed759a0, 0xd1c382139f8a2c93, 0x00008e8e0b14b884},
+    {0x1f70f6cdc00090bf, 0xffef30ff5a176ba7, 0x34d7aee33286761d,
+     0xaa6d9cc76f4f79ca, 0x93df7bad553a4b62, 0x12afb31fea4cde38,
+     0x67c4e9228e277305, 0xae72762315b0e32b, 0x1e431f2d6f0b3251,
+     0xa85518752329c761, 0x7add306fcee92c18, 0x0001497e8ec9e1ce}};
+#else
+static const fe_packed field_sqrt_roots[field_two_adicity] = {
+    {0x00, 0x00, 0x3b, 0x40, 0x35, 0x80, 0x0a, 0x00, 0x10, 0xfa, 0x2b, 0x3d,
+     0x06, 0xf2, 0xe6, 0xc9, 0x37, 0x46, 0xba, 0x36, 0x12, 0x56, 0xfe, 0x6e,
+     0x20, 0x10, 0xa7, 0xfd, 0xa3, 0x96, 0xad, 0xc5, 0xcf, 0x1b, 0x85, 0xba,
+     0xb0, 0x51, 0x8d, 0x6b, 0xce, 0xb2, 0xc2, 0xf9, 0xfd, 0x09, 0x3e, 0x17,
+     0x36, 0x3c, 0xe0, 0xde, 0x02, 0xbc, 0xdf, 0xb1, 0xf3, 0xcb, 0xdf, 0x13,
+     0x9b, 0x08, 0x19, 0x9c, 0x91, 0x4e, 0x79, 0xef, 0xdf, 0xdf, 0x31, 0x83,
+     0xd9, 0x2d, 0xbc, 0x34, 0x70, 0xc9, 0x46, 0x65, 0xda, 0x48, 0x39, 0x63,
+     0xc0, 0x86, 0x8e, 0x44, 0x34, 0xd7, 0xcf, 0x28, 0x6b, 0x8d, 0xd9, 0xbe},
+    {0x00, 0x01, 0x95, 0x5c, 0x83, 0x8b, 0x9f, 0x1c, 0x45, 0xc2, 0x57, 0x0d,
+     0xbb, 0xea, 0x00, 0xe6, 0x74, 0xa9, 0xb3, 0xf1, 0x3d, 0x0b, 0xb7, 0x94,
+     0x88, 0x75, 0xb2, 0xa0, 0xf1, 0xd7, 0xf9, 0x7f, 0x88, 0x7b, 0xc3, 0xdd,
+     0x89, 0xeb, 0xcd, 0x55, 0x85, 0x34, 0x02, 0x20, 0x6e, 0x9d, 0xfa, 0xd0,
+     0xac, 0x15, 0x9b, 0xfd, 0xc0, 0xc5, 0x68, 0x32, 0x8a, 0xe1, 0x5a, 0x84,
+     0x11, 0xb9, 0x51, 0xf7, 0xa9, 0x4b, 0x1a, 0x66, 0x34, 0x57, 0x72, 0xa9,
+     0xd6, 0x1a, 0x3b, 0xaf, 0x77, 0x3a, 0x40, 0x12, 0x43, 0xb2, 0xa1, 0xa6,
+     0x36, 0xc3, 0x51, 0x43, 0xbb, 0xe8, 0x68, 0x51, 0xbf, 0x2a, 0x07, 0x8a},
+    {0x00, 0x01, 0x1f, 0x2b, 0x87, 0xc4, 0x4d, 0xdf, 0xd0, 0xad, 0x7c, 0xa8,
+     0x89, 0x0f, 0xc0, 0xb1, 0x20, 0xf7, 0x9a, 0x39, 0x4f, 0x89, 0x96, 0x8d,
+     0x67, 0xe1, 0x79, 0x6f, 0x35, 0x2a, 0x38, 0xd2, 0x56, 0xea, 0x05, 0x71,
+     0x9c, 0x80, 0x6a, 0x4a, 0x58, 0xc3, 0x85, 0x86, 0xf4, 0x79, 0x36, 0xeb,
+     0xbb, 0xd6, 0x64, 0x06, 0x54, 0x16, 0x1b, 0x3a, 0xbb, 0xd1, 0xc6, 0x27,
+     0xd0, 0x46, 0x04, 0x99, 0xd4, 0x7f, 0xce, 0x30, 0xf3, 0x7d, 0x85, 0xde,
+     0x26, 0x5e, 0x97, 0x01, 0xf2, 0x36, 0x90, 0x7a, 0x1a, 0xc7, 0xe7, 0x0c,
+     0xb8, 0x28, 0x55, 0x17, 0x8f, 0x9a, 0xd4, 0xe5, 0xa1, 0x19, 0x3d, 0x8d},
+    {0x00, 0x00, 0x8b, 0x16, 0xb8, 0xb0, 0xef, 0xdb, 0x85, 0x65, 0x1b, 0x93,
+     0x94, 0x18, 0x59, 0xc2, 0x61, 0xd2, 0x98, 0xd7, 0xde, 0xff, 0xf2, 0x8d,
+     0x2a, 0xc4, 0xd1, 0x08, 0xe4, 0x6e, 0xed, 0x6c, 0x0c, 0xc2, 0x37, 0xfb,
+     0xc8, 0xf8, 0x2f, 0x3c, 0xfb, 0x6a, 0xd8, 0xf4, 0x0f, 0x8a, 0xf5, 0xf4,
+     0x17, 0xeb, 0x9a, 0x39, 0xbd, 0x40, 0xe4, 0x9f, 0x4d, 0xc9, 0xed, 0xe4,
+     0x50, 0x88, 0xf1, 0xf0, 0x17, 0x7f, 0xaf, 0x30, 0x28, 0xe9, 0x2e, 0x43,
+     0x73, 0x25, 0x7f, 0xac, 0x9d, 0x8d, 0x64, 0x74, 0x1f, 0xea, 0x72, 0x45,
+     0xf4, 0x06, 0x8e, 0xe3, 0x20, 0x44, 0xbc, 0xe7, 0x7f, 0xc3, 0x90, 0xc4},
+    {0x00, 0x01, 0x7c, 0xdc, 0xe8, 0xc0, 0x47, 0xf6, 0x29, 0x96, 0x3f, 0x9f,
+     0x3e, 0x42, 0x37, 0x54, 0x64, 0xea, 0x83, 0x36, 0x62, 0x13, 0xd4, 0x48,
+     0x0c, 0x57, 0x9e, 0x4b, 0x93, 0x80, 0x2e, 0xd0, 0x94, 0x6d, 0x97, 0x33,
+     0x57, 0xa0, 0x67, 0xe5, 0x36, 0x39, 0x57, 0x99, 0x0e, 0x6b, 0xc7, 0x02,
+     0x30, 0x2d, 0x52, 0x95, 0x45, 0x7d, 0xad, 0xe4, 0xe1, 0xe5, 0x17, 0x66,
+     0x5b, 0x18, 0xec, 0xcf, 0x44, 0x82, 0xf8, 0x43, 0x1e, 0xb8, 0x03, 0x86,
+     0x16, 0x38, 0xdb, 0xcf, 0xa3, 0x49, 0xf0, 0xb5, 0x28, 0x25, 0x84, 0xec,
+     0xa9, 0x1b, 0xf2, 0xcd, 0xcc, 0xef, 0x8a, 0x5b, 0xc6, 0x2f, 0x4d, 0xcc},
+    {0x00, 0x00, 0xf0, 0x5d, 0x5f, 0x58, 0xdd, 0xba, 0x81, 0x3e, 0x4c, 0x59,
+     0x58, 0x32, 0x87, 0x82, 0x56, 0x42, 0x9f, 0x3d, 0x1b, 0xcf, 0x87, 0xa5,
+     0xb0, 0xc1, 0xe0, 0x72, 0xee, 0x4d, 0x0b, 0x43, 0x59, 0x47, 0x15, 0xab,
+     0x65, 0x7f, 0x2a, 0x34, 0xc5, 0x63, 0xfc, 0x15, 0x69, 0x75, 0xb6, 0xbe,
+     0x92, 0xd9, 0x0b, 0x7b, 0xc3, 0xa4, 0x3b, 0x92, 0xc8, 0x54, 0x7e, 0x70,
+     0x90, 0x45, 0xa5, 0x23, 0xac, 0xe5, 0x1c, 0x1f, 0x67, 0xcd, 0xf4, 0x9f,
+     0x19, 0x82, 0xd9, 0xa2, 0x53, 0x4b, 0x83, 0x83, 0x03, 0x3d, 0x1a, 0x30,
+     0xbd, 0x80, 0x17, 0x0f, 0xfd, 0x0d, 0x6c, 0x32, 0xf7, 0x6c, 0x47, 0x38},
+    {0x00, 0x00, 0xf2, 0x09, 0x06, 0xe0, 0x33, 0xd5, 0x0d, 0x34, 0x35, 0x55,
+     0x7e, 0xc5, 0x72, 0x5f, 0xfd, 0xbc, 0xbf, 0x5e, 0x46, 0x5b, 0x51, 0x0c,
+     0x43, 0x34, 0x9f, 0x59, 0xec, 0xae, 0x5c, 0x8b, 0x2c, 0x0a, 0xa3, 0x1f,
+     0xa1, 0x97, 0x3e, 0xbb, 0xb8, 0x47, 0xed, 0xa7, 0x5b, 0xf3, 0x9b, 0x94,
+     0x57, 0x4e, 0xba, 0xe8, 0x05, 0xc3, 0x88, 0xd8, 0xfe, 0xca, 0x65, 0x58,
+     0xf8, 0xf1, 0x57, 0x62, 0xca, 0xea, 0x43, 0x1b, 0x99, 0x80, 0x12, 0x4b,
+     0x73, 0x12, 0x7f, 0x69, 0x05, 0x18, 0x5d, 0xf1, 0xdb, 0x65, 0xde, 0x88,
+     0x19, 0xa8, 0x62, 0x99, 0x88, 0xe3, 0x85, 0x20, 0xc2, 0x63, 0x42, 0xe4},
+    {0x00, 0x00, 0x97, 0x2e, 0xf1, 0x1e, 0xd1, 0xc1, 0x8f, 0x48, 0x3d, 0x9b,
+     0x68, 0x1c, 0x0f, 0x28, 0xc7, 0xe0, 0x4a, 0x6d, 0x53, 0x5c, 0xa6, 0x1a,
+     0x92, 0xfe, 0xad, 0x7c, 0xdd, 0x49, 0x3b, 0x61, 0xab, 0x6a, 0x6b, 0x2c,
+     0x5e, 0x15, 0xc4, 0xf3, 0x8b, 0x4d, 0xb4, 0x16, 0xa1, 0x65, 0x30, 0x68,
+     0x11, 0x27, 0x81, 0x5d, 0x55, 0x38, 0x74, 0xd4, 0x75, 0x3a, 0xbe, 0x72,
+     0xa4, 0x9b, 0xb1, 0x71, 0x4b, 0x8f, 0x59, 0xe0, 0x61, 0xd8, 0x9f, 0x22,
+     0x1e, 0x9c, 0xa4, 0x55, 0xd6, 0xa6, 0x33, 0x41, 0xf7, 0x72, 0xd1, 0x34,
+     0x25, 0x13, 0x04, 0x80, 0xda, 0x78, 0x5d, 0x1b, 0x39, 0x16, 0xca, 0x2a},
+    {0x00, 0x00, 0x0d, 0x13, 0x89, 0xd8, 0xc7, 0xe9, 0x9d, 0x76, 0xe1, 0xe3,
+     0x65, 0x04, 0xb1, 0x97, 0x46, 0xa0, 0x8b, 0x25, 0x89, 0x53, 0xec, 0x50,
+     0x3d, 0x04, 0xc3, 0x40, 0x02, 0x28, 0xad, 0xb1, 0x21, 0x4c, 0x26, 0x8a,
+     0x59, 0x53, 0xce, 0x71, 0x64, 0x23, 0x2e, 0x22, 0xba, 0x47, 0x8a, 0x79,
+     0x44, 0x56, 0x94, 0xf4, 0x70, 0x43, 0xe8, 0xc0, 0x14, 0x75, 0x8c, 0x45,
+     0xf8, 0x10, 0xf8, 0xdf, 0xc2, 0x62, 0x7b, 0x61, 0xae, 0x03, 0xb5, 0x36,
+     0x5a, 0x9d, 0xe5, 0x70, 0x22, 0xfe, 0xcd, 0xe4, 0x47, 0xa7, 0xef, 0x84,
+     0xf5, 0x2d, 0xf7, 0xa4, 0xe2, 0xb4, 0x3f, 0x29, 0x6e, 0xfe, 0x43, 0xf6},
+    {0x00, 0x00, 0x8d, 0xbe, 0x0c, 0xbe, 0x95, 0xc4, 0x9e, 0x48, 0xaa, 0x90,
+     0x4e, 0x51, 0x64, 0x29, 0x71, 0xed, 0xe2, 0xd6, 0xce, 0xee, 0x5b, 0x78,
+     0x57, 0x62, 0xe0, 0xff, 0x77, 0xd4, 0x56, 0xba, 0x77, 0xe6, 0xfc, 0x09,
+     0x92, 0x97, 0x03, 0x16, 0xb4, 0xf9, 0xb3, 0xb0, 0x81, 0x3e, 0xef, 0xb7,
+     0x44, 0x09, 0xc1, 0x6c, 0x18, 0x07, 0xe8, 0xfd, 0x13, 0x0d, 0x51, 0xbf,
+     0x0e, 0x2f, 0x3d, 0x31, 0x75, 0x01, 0x4f, 0xde, 0x74, 0x49, 0x52, 0x6e,
+     0xa2, 0xba, 0x8d, 0x76, 0x22, 0x53, 0x12, 0x0f, 0x1b, 0x24, 0x20, 0x03,
+     0x3a, 0x7c, 0x70, 0xf0, 0x3c, 0x76, 0x6a, 0x26, 0x3a, 0x92, 0x64, 0xec},
+    {0x00, 0x01, 0x25, 0x3f, 0x3d, 0xda, 0xa3, 0xaa, 0xd9, 0x29, 0x31, 0x76,
+     0xb1, 0xe5, 0xce, 0x55, 0xe8, 0x95, 0xfd, 0xe6, 0xae, 0xb0, 0x2b, 0x6b,
+     0x99, 0x1b, 0xc2, 0x8e, 0x6a, 0x00, 0xa1, 0x42, 0xdf, 0x76, 0x7b, 0x02,
+     0x3f, 0x53, 0x74, 0xd2, 0x2f, 0xbb, 0x29, 0xf0, 0xd7, 0x3d, 0x5a, 0xd7,
+     0x72, 0xb2, 0x1b, 0x82, 0xd3, 0xb4, 0x00, 0x13, 0x56, 0x18, 0xcd, 0x0c,
+     0xe4, 0x7a, 0x3d, 0x5e, 0x15, 0x21, 0xaa, 0xce, 0xee, 0x0f, 0x66, 0x20,
+     0x16, 0x69, 0x35, 0x01, 0x13, 0xa2, 0x20, 0x43, 0x12, 0x9a, 0x8e, 0x84,
+     0x17, 0x8a, 0x94, 0x3a, 0xe3, 0x96, 0x10, 0xee, 0x79, 0x78, 0x4a, 0x6f},
+    {0x00, 0x00, 0xb1, 0x15, 0xba, 0x9d, 0xcb, 0xec, 0x77, 0x09, 0x41, 0xbb,
+     0x9f, 0xb7, 0x95, 0x80, 0xf5, 0x30, 0x56, 0xce, 0x19, 0x22, 0x9d, 0x20,
+     0x49, 0x08, 0xde, 0x4e, 0x13, 0x0e, 0xeb, 0x36, 0x48, 0xe9, 0x97, 0xec,
+     0xd0, 0x48, 0x5a, 0x99, 0x45, 0x10, 0x56, 0xfb, 0x38, 0x98, 0xf2, 0x7d,
+     0x08, 0xb2, 0xc8, 0xbc, 0xa7, 0x5a, 0x4f, 0x70, 0x8a, 0x8b, 0x24, 0xa1,
+     0xaa, 0xc7, 0x38, 0xdf, 0x53, 0x03, 0xae, 0x42, 0x04, 0x49, 0x7e, 0x4c,
+     0xf0, 0x55, 0xe4, 0x1b, 0x22, 0x9e, 0xda, 0x53, 0x97, 0x2c, 0xb2, 0x6d,
+     0x58, 0xf4, 0xed, 0x7e, 0x88, 0x92, 0x3a, 0x3d, 0x83, 0xc4, 0x8d, 0x2e},
+    {0x00, 0x01, 0x0e, 0x29, 0xb6, 0x7a, 0xce, 0xad, 0x3e, 0x72, 0xab, 0xf8,
+     0x99, 0xa7, 0x9b, 0xba, 0x9a, 0x9d, 0x61, 0xc1, 0xf8, 0x51, 0xd0, 0xe4,
+     0x22, 0x71, 0x4a, 0x7e, 0x7a, 0x53, 0xa8, 0xc9, 0x22, 0xe5, 0x41, 0x94,
+     0x90, 0xd7, 0xb1, 0x3c, 0x7c, 0xc6, 0x82, 0xdb, 0x9d, 0xf9, 0x9f, 0x6e,
+     0x62, 0x4d, 0xf2, 0xaa, 0xbe, 0x51, 0xc5, 0x1d, 0x4d, 0xf1, 0x0f, 0x27,
+     0xc4, 0xd7, 0xaa, 0xa0, 0x70, 0xf5, 0x25, 0x13, 0x0b, 0x1f, 0x8d, 0x02,
+     0x6b, 0x86, 0xdd, 0xda, 0x84, 0x6b, 0x41, 0xce, 0xe5, 0x8d, 0x3f, 0x6c,
+     0x02, 0xb0, 0x9a, 0x17, 0xc1, 0x48, 0x6d, 0xf6, 0xdb, 0x98, 0x73, 0x7f},
+    {0x00, 0x01, 0x51, 0x00, 0x42, 0x08, 0xe4, 0x48, 0x99, 0x6f, 0x15, 0xae,
+     0x77, 0xf9, 0x13, 0x27, 0x27, 0x23, 0x9c, 0x39, 0x53, 0xee, 0xf4, 0xe6,
+     0x73, 0x5d, 0xa2, 0x57, 0x86, 0x2b, 0x81, 0xeb, 0x17, 0xb3, 0xa5, 0x70,
+     0xde, 0xa1, 0xb5, 0x23, 0x20, 0x9b, 0xa8, 0xc9, 0x68, 0x4d, 0x1b, 0x23,
+     0x31, 0xbd, 0xbb, 0xad, 0x2a, 0xd9, 0x94, 0x20, 0x3c, 0x65, 0xdd, 0x8b,
+     0x80, 0xd5, 0x7d, 0x0c, 0x4e, 0x67, 0xd6, 0x0f, 0x4c, 0x79, 0x6b, 0x32,
+     0x6e, 0x49, 0x98, 0xa7, 0x72, 0x42, 0xbd, 0xaf, 0xae, 0x55, 0x7b, 0x86,
+     0xf4, 0xd2, 0x50, 0x41, 0x81, 0x96, 0x4e, 0xc5, 0x4c, 0x76, 0x9c, 0x0a},
+    {0x00, 0x01, 0x73, 0x7c, 0xf2, 0x7d, 0xf5, 0x92, 0xce, 0x2c, 0xf1, 0x5f,
+     0x33, 0x17, 0x4c, 0x54, 0x35, 0x29, 0x5f, 0x4f, 0x3d, 0xef, 0x4a, 0x0a,
+     0x25, 0xc1, 0x4a, 0x2f, 0x47, 0x2e, 0x55, 0x6b, 0x9e, 0xfb, 0xe3, 0x7e,
+     0x44, 0x85, 0x3b, 0xde, 0xd1, 0x8f, 0xb8, 0xf0, 0xed, 0x7c, 0x09, 0x06,
+     0x5d, 0x36, 0x2f, 0xf9, 0x3e, 0x9f, 0x84, 0x60, 0x61, 0xf3, 0xbb, 0xd0,
+     0xf1, 0xf1, 0xf5, 0xcb, 0x05, 0x98, 0x2f, 0x9a, 0xdd, 0xf0, 0xea, 0x1c,
+     0x58, 0xe4, 0x65, 0x93, 0x0a, 0xd8, 0x93, 0xfb, 0x52, 0x62, 0xc6, 0x48,
+     0xf5, 0xfd, 0x46, 0x52, 0xdf, 0x68, 0xa7, 0x7b, 0xeb, 0x9d, 0x8f, 0xdd},
+    {0x00, 0x00, 0x00, 0xcf, 0xe5, 0x24, 0x5d, 0xc5, 0x52, 0x9e, 0x5d, 0xf0,
+     0xac, 0xf8, 0x68, 0x17, 0x54, 0x82, 0x69, 0x16, 0x10, 0xae, 0x1d, 0xe0,
+     0x31, 0x92, 0xfd, 0xbf, 0x94, 0x19, 0x99, 0x1d, 0xa7, 0xca, 0x21, 0x74,
+     0xa1, 0x0d, 0x0b, 0xd9, 0x97, 0xc1, 0x96, 0xa7, 0xe9, 0x26, 0xb7, 0x40,
+     0xcc, 0x9b, 0x58, 0xce, 0xf0, 0xcd, 0xcf, 0xa6, 0x31, 0x70, 0xa5, 0xad,
+     0x39, 0x4b, 0x6b, 0x39, 0x3e, 0x21, 0x85, 0x8c, 0x53, 0x0b, 0x02, 0x60,
+     0xbf, 0xcb, 0x62, 0x50, 0x32, 0x0a, 0xd7, 0x9d, 0x4b, 0xd1, 0x53, 0xf5,
+     0x81, 0xa3, 0x8a, 0x05, 0x7e, 0x7b, 0x8f, 0xf2, 0x92, 0xa1, 0xd0, 0x78},
+    {0x00, 0x01, 0x70, 0x2f, 0x53, 0xae, 0xb0, 0xee, 0x4b, 0x52, 0xbe, 0xad,
+     0x06, 0xb1, 0xf3, 0x45, 0xb2, 0xf9, 0x92, 0xc7, 0x7a, 0xb5, 0x44, 0x6c,
+     0x79, 0x01, 0x60, 0x7a, 0xde, 0x5e, 0x5d, 0x9f, 0xe1, 0xff, 0x54, 0xef,
+     0x77, 0x10, 0xb1, 0x0a, 0x3c, 0x33, 0xc9, 0xcd, 0xaa, 0x70, 0x5e, 0x73,
+     0xf1, 0x5c, 0x95, 0xbf, 0xb7, 0xd0, 0xba, 0x32, 0xa6, 0xef, 0x36, 0xcb,
+     0xa3, 0xf7, 0xcb, 0xe1, 0x60, 0xd1, 0xe1, 0x8c, 0x35, 0x9f, 0xd0, 0x0c,
+     0xdf, 0x0b, 0x3f, 0xd5, 0xa5, 0x15, 0x07, 0x05, 0x09, 0x65, 0x64, 0xf0,
+     0xa1, 0x67, 0x97, 0x5b, 0xba, 0xc2, 0x7f, 0x3c, 0x9b, 0xc2, 0x5f, 0x17},
+    {0x00, 0x00, 0x1e, 0xba, 0x70, 0x8f, 0x13, 0xe7, 0x9f, 0xad, 0x51, 0x4b,
+     0x3f, 0xed, 0x43, 0x7c, 0x4e, 0x61, 0x2d, 0x45, 0xca, 0x5b, 0xcc, 0xa5,
+     0x33, 0xd2, 0xce, 0xdd, 0x42, 0xaa, 0xa3, 0x5a, 0x80, 0x20, 0x9c, 0xbd,
+     0x2f, 0xb4, 0xb3, 0x85, 0x6c, 0x56, 0xdb, 0xb3, 0x92, 0x82, 0xa7, 0xaf,
+     0x5e, 0xdd, 0x06, 0xbb, 0x37, 0xde, 0xda, 0xbc, 0xa2, 0xae, 0xfa, 0x78,
+     0x4e, 0x72, 0x59, 0x0f, 0xb2, 0xb6, 0x1c, 0x96, 0x1c, 0xb5, 0xb3, 0x5d,
+     0x6b, 0xc7, 0x9a, 0x15, 0xb2, 0x24, 0x4a, 0xf5, 0xb7, 0x20, 0xea, 0xe1,
+     0xcb, 0xa6, 0x34, 0xae, 0xaa, 0xb9, 0x46, 0xba, 0x46, 0xac, 0xa5, 0xe4},
+    {0x00, 0x01, 0xb9, 0x1b, 0x96, 0x19, 0x73, 0x31, 0x5a, 0x59, 0x4a, 0x2a,
+     0xf0, 0x83, 0x04, 0x00, 0x69, 0x59, 0xe4, 0x04, 0x00, 0x24, 0x67, 0x67,
+     0x75, 0x44, 0xf1, 0x0f, 0xb3, 0x77, 0x60, 0x43, 0x7d, 0x60, 0xf2, 0x8a,
+     0xc2, 0x38, 0x90, 0x28, 0x23, 0xe6, 0xce, 0xd8, 0x02, 0x38, 0xfb, 0x49,
+     0x25, 0x76, 0xbc, 0xc1, 0xcb, 0xb6, 0x32, 0x25, 0xab, 0x77, 0x42, 0xe1,
+     0xc8, 0x6b, 0x2e, 0xe6, 0xa1, 0x10, 0xf3, 0xa7, 0x55, 0x86, 0xd6, 0x4b,
+     0x3f, 0x10, 0x88, 0x9b, 0xd6, 0x78, 0x31, 0x23, 0x68, 0x4d, 0x3d, 0x03,
+     0x5b, 0xbd, 0x91, 0x12, 0x13, 0x8f, 0xf1, 0xc3, 0x58, 0x27, 0xfc, 0x14},
+    {0x00, 0x01, 0x5c, 0x0e, 0x5b, 0xa6, 0x4f, 0xc4, 0xba, 0x7a, 0x61, 0xb4,
+     0xd2, 0xf3, 0xee, 0xf0, 0x60, 0x62, 0xd4, 0x6b, 0xe5, 0x1f, 0x2e, 0xd8,
+     0x30, 0x1d, 0x3a, 0x93, 0x83, 0xfb, 0x7f, 0xcc, 0x60, 0xe3, 0x81, 0xd1,
+     0xdc, 0xda, 0x27, 0x7b, 0x34, 0xdb, 0x30, 0xe8, 0x89, 0x4a, 0xb9, 0x5b,
+     0xd7, 0x46, 0x65, 0xf0, 0x80, 0xd2, 0x25, 0x4a, 0xe1, 0xbd, 0x1c, 0x33,
+     0xb5, 0x62, 0xa2, 0x74, 0x12, 0x6d, 0x95, 0x62, 0x1a, 0xe9, 0xbd, 0xa2,
+     0x73, 0xd7, 0x0c, 0x83, 0x67, 0x91, 0xc9, 0x7c, 0x1d, 0x25, 0x9f, 0xc7,
+     0xbb, 0x78, 0x70, 0x45, 0xee, 0x34, 0x60, 0xef, 0xfa, 0xc8, 0x05, 0x53},
+    {0x00, 0x01, 0xb7, 0x0c, 0xa5, 0x45, 0xdf, 0x97, 0x28, 0x81, 0xce, 0xfc,
+     0xb3, 0x3c, 0x06, 0x63, 0x66, 0xc6, 0x43, 0x0d, 0xd3, 0x6e, 0x38, 0x7f,
+     0xa7, 0xb6, 0x2f, 0x13, 0xde, 0x16, 0x0f, 0xec, 0xb2, 0x66, 0xfd, 0x37,
+     0x46, 0xab, 0x82, 0x2a, 0x54, 0x9c, 0xdf, 0x3f, 0x62, 0xbc, 0xbe, 0x54,
+     0xc7, 0x2d, 0x15, 0xab, 0x73, 0x36, 0x6b, 0x81, 0x3a, 0x92, 0xe6, 0x72,
+     0x67, 0xd9, 0x98, 0xf5, 0xe9, 0xcd, 0x8d, 0xc4, 0x07, 0x2c, 0x70, 0xb7,
+     0x79, 0x69, 0x09, 0x7c, 0x16, 0x74, 0xbb, 0x86, 0x36, 0x84, 0x97, 0x8c,
+     0x51, 0x45, 0x15, 0xde, 0x6d, 0x11, 0x7e, 0x3b, 0xc9, 0xd4, 0x52, 0x3d},
+    {0x00, 0x01, 0xa6, 0x2e, 0x5c, 0xdc, 0x00, 0x53, 0xe6, 0x80, 0xbc, 0x6d,
+     0x4c, 0x22, 0xea, 0xa9, 0x63, 0xbc, 0x5d, 0x20, 0x6b, 0x3b, 0x08, 0x00,
+     0xa5, 0x3b, 0xd3, 0x0e, 0xdf, 0x72, 0x71, 0x21, 0xa0, 0x77, 0x84, 0xf5,
+     0xc2, 0x79, 0x1b, 0xf7, 0xc1, 0x62, 0xe2, 0x6a, 0x90, 0xcc, 0x54, 0x23,
+     0xa9, 0xef, 0xef, 0x94, 0xac, 0x89, 0x06, 0x92, 0xca, 0xad, 0x3d, 0xbb,
+     0xf0, 0x24, 0x2c, 0x7c, 0x79, 0x21, 0xfb, 0xaf, 0x24, 0xf5, 0x18, 0xb6,
+     0xef, 0xfd, 0x6d, 0x58, 0x9c, 0x66, 0x20, 0x53, 0x6e, 0x8d, 0xa3, 0x1e,
+     0x05, 0x0d, 0x16, 0x04, 0x1f, 0x82, 0x7b, 0x1e, 0xa1, 0x1c, 0x78, 0x77},
+    {0x00, 0x00, 0x29, 0xbf, 0xb1, 0x6a, 0x05, 0x7f, 0xe7, 0x6b, 0x97, 0x7d,
+     0xe9, 0x26, 0x27, 0x31, 0xf8, 0x17, 0xf0, 0xe9, 0xfc, 0x3d, 0xa5, 0x61,
+     0x10, 0x82, 0x41, 0x55, 0xc4, 0xb3, 0xd6, 0xce, 0xe4, 0x21, 0x1b, 0x87,
+     0x91, 0x85, 0x06, 0xf4, 0x9b, 0x17, 0x0d, 0x12, 0xdf, 0x35, 0x9e, 0xfc,
+     0x63, 0x1e, 0xa3, 0x8f, 0x59, 0xda, 0x7f, 0x0b, 0x63, 0x2a, 0x30, 0xfb,
+     0x78, 0x6b, 0x6f, 0x7e, 0x3c, 0x39, 0x34, 0x93, 0xf2, 0xe9, 0x41, 0xa6,
+     0x21, 0xa4, 0x4d, 0x6c, 0x19, 0xc2, 0x6e, 0x3a, 0x4d, 0x8b, 0xf4, 0x5d,
+     0x3b, 0x2a, 0xda, 0xbb, 0x06, 0x72, 0xec, 0xbf, 0xc1, 0xcb, 0x36, 0xa8},
+    {0x00, 0x01, 0x7f, 0x97, 0x59, 0x07, 0x8d, 0xd6, 0x87, 0x5c, 0x19, 0xf5,
+     0xf3, 0x8a, 0x11, 0x30, 0x21, 0xe2, 0x59, 0xa7, 0xcf, 0x10, 0xda, 0x9f,
+     0x63, 0x5f, 0xf2, 0x1b, 0xe4, 0xaf, 0x89, 0x39, 0x63, 0x0e, 0xbb, 0xbb,
+     0x44, 0xe3, 0x23, 0x12, 0xf2, 0xcb, 0xb7, 0xe3, 0x3f, 0x3f, 0x89, 0x38,
+     0x54, 0x49, 0x4f, 0x2b, 0xd0, 0x2c, 0xdd, 0x16, 0x67, 0xa3, 0xfa, 0x6b,
+     0x64, 0x2d, 0x5c, 0x86, 0x94, 0x9f, 0xe4, 0x1c, 0xf1, 0xb3, 0xbb, 0x8e,
+     0xf4, 0x3f, 0x4c, 0x25, 0xe9, 0x99, 0x7f, 0x12, 0xc4, 0x80, 0x89, 0xca,
+     0xd6, 0x52, 0x5b, 0x0a, 0x23, 0xe9, 0xc1, 0x24, 0xd7, 0x3a, 0x93, 0x1a},
+    {0x00, 0x01, 0xb3, 0x1f, 0xfa, 0xad, 0x29, 0x47, 0xa8, 0x0a, 0xfa, 0x40,
+     0x18, 0x38, 0xe1, 0x29, 0xb5, 0x16, 0x96, 0x0a, 0xf6, 0x21, 0x58, 0xbb,
+     0x15, 0x2c, 0x92, 0xc9, 0xd6, 0x09, 0xe8, 0x07, 0xb3, 0x77, 0xaf, 0x3e,
+     0x30, 0xb8, 0x50, 0x3f, 0xad, 0x82, 0xfb, 0x7f, 0x66, 0x4c, 0x3b, 0x75,
+     0xe9, 0x8d, 0x01, 0xdd, 0x55, 0x43, 0x59, 0x87, 0x25, 0xaa, 0x3b, 0x25,
+     0x55, 0x4f, 0x02, 0x98, 0xa5, 0x5c, 0x17, 0xa1, 0xa2, 0xea, 0xbe, 0x09,
+     0xce, 0x81, 0x1b, 0xf9, 0x03, 0x06, 0xb3, 0x08, 0xb0, 0xb9, 0xc2, 0xd8,
+     0xe4, 0x21, 0x86, 0x04, 0xb4, 0xba, 0x13, 0x39, 0xe9, 0x4c, 0x31, 0x40},
+    {0x00, 0x00, 0xc3, 0x89, 0x60, 0xfb, 0xde, 0xa7, 0x2f, 0xd0, 0x8c, 0x6f,
+     0xc4, 0xbe, 0x9f, 0x15, 0xb2, 0x9c, 0x51, 0x5e, 0xd6, 0x4c, 0x0c, 0x35,
+     0x9c, 0x2b, 0x34, 0x79, 0x96, 0x55, 0x98, 0x02, 0x72, 0xce, 0x79, 0x37,
+     0x15, 0x79, 0xbf, 0x32, 0x9e, 0x62, 0x4a, 0x26, 0x9e, 0x36, 0x91, 0x3e,
+     0x07, 0xaf, 0x63, 0xe7, 0xb0, 0x0c, 0xbd, 0x56, 0x4b, 0x64, 0x5c, 0x14,
+     0xdd, 0x94, 0x65, 0x47, 0x2e, 0xcc, 0xc0, 0xbf, 0x1d, 0x27, 0x3a, 0x46,
+     0x55, 0xf0, 0x24, 0x52, 0x5c, 0x36, 0x66, 0x12, 0x05, 0x00, 0xb3, 0xc4,
+     0xa1, 0xbe, 0x00, 0x32, 0xd3, 0x39, 0x7c, 0x7e, 0x39, 0xc1, 0x72, 0x43},
+    {0x00, 0x01, 0x2e, 0x58, 0x1e, 0xe9, 0x6e, 0x2e, 0x31, 0x53, 0xd9, 0x9c,
+     0xf5, 0x5a, 0xce, 0xac, 0x99, 0x02, 0x7b, 0xfe, 0xa0, 0x25, 0x6f, 0x98,
+     0x40, 0xf1, 0x7f, 0x9a, 0xe4, 0xa1, 0x72, 0xbd, 0x5e, 0x0a, 0xd2, 0xb6,
+     0x73, 0x6d, 0x01, 0xe9, 0x86, 0xe9, 0xc5, 0x75, 0xb3, 0x85, 0x3c, 0xd4,
+     0x9b, 0x49, 0xcc, 0x01, 0x32, 0xec, 0xef, 0x23, 0xc9, 0xdc, 0x39, 0x0c,
+     0x2c, 0x99, 0x58, 0xf5, 0x60, 0x7f, 0xe9, 0x3e, 0xfa, 0x42, 0xff, 0xa8,
+     0x51, 0x2c, 0x2d, 0xec, 0xf7, 0x47, 0x7a, 0x72, 0x72, 0x18, 0x99, 0x2e,
+     0x4d, 0x4b, 0x8d, 0x8a, 0x0b, 0xb4, 0x5b, 0x4d, 0x1f, 0x8b, 0x6d, 0x42},
+    {0x00, 0x00, 0x99, 0x64, 0xfd, 0x69, 0xe8, 0x4d, 0xd2, 0xf3, 0x63, 0x59,
+     0x98, 0x0d, 0xac, 0xd9, 0x3a, 0x96, 0xac, 0x94, 0xe9, 0x0e, 0xb4, 0x5e,
+     0x7b, 0x98, 0xdb, 0x72, 0x8c, 0x5c, 0x0e, 0xb7, 0x01, 0xbc, 0xeb, 0x90,
+     0xb0, 0xda, 0xd0, 0xdd, 0xe2, 0x16, 0xdc, 0x4c, 0x39, 0x14, 0x85, 0x48,
+     0x9c, 0x31, 0x20, 0x9d, 0x3d, 0xd8, 0x57, 0x7a, 0x38, 0x0d, 0xa8, 0x30,
+     0x68, 0xae, 0x28, 0xf3, 0x32, 0xc3, 0x29, 0xf3, 0x4d, 0xdd, 0x53, 0xb2,
+     0x22, 0xec, 0x46, 0x57, 0x51, 0x5b, 0xc0, 0x74, 0xfb, 0xa4, 0x3c, 0x8d,
+     0xc0, 0x0e, 0x6b, 0x67, 0xb6, 0xd1, 0x25, 0x0a, 0x3e, 0x39, 0x9b, 0x78},
+    {0x00, 0x00, 0x8e, 0x8e, 0x0b, 0x14, 0xb8, 0x84, 0xd1, 0xc3, 0x82, 0x13,
+     0x9f, 0x8a, 0x2c, 0x93, 0xf6, 0xd8, 0x98, 0x82, 0x5e, 0xd7, 0x59, 0xa0,
+     0x6b, 0xa4, 0xef, 0x84, 0x40, 0xd5, 0xda, 0x44, 0x5c, 0x45, 0x5e, 0x18,
+     0x79, 0x43, 0x0e, 0x27, 0xcb, 0x02, 0x8a, 0x4e, 0x35, 0xb6, 0x21, 0x53,
+     0xa2, 0x23, 0x9a, 0x0f, 0x49, 0x3a, 0xc3, 0x69, 0xd9, 0x7e, 0x72, 0x79,
+     0xc2, 0xe0, 0x2c, 0x21, 0xcf, 0x30, 0x5f, 0xaf, 0x19, 0x7e, 0x86, 0x64,
+     0xb2, 0xab, 0x56, 0x72, 0x41, 0x5f, 0xbc, 0x9a, 0xdc, 0x03, 0x42, 0x9a,
+     0x1e, 0xab, 0x5a, 0x00, 0x34, 0x29, 0xdf, 0x28, 0x6e, 0x5b, 0x78, 0x54},
+    {0x00, 0x01, 0x49, 0x7e, 0x8e, 0xc9, 0xe1, 0xce, 0x7a, 0xdd, 0x30, 0x6f,
+     0xce, 0xe9, 0x2c, 0x18, 0xa8, 0x55, 0x18, 0x75, 0x23, 0x29, 0xc7, 0x61,
+     0x1e, 0x43, 0x1f, 0x2d, 0x6f, 0x0b, 0x32, 0x51, 0xae, 0x72, 0x76, 0x23,
+     0x15, 0xb0, 0xe3, 0x2b, 0x67, 0xc4, 0xe9, 0x22, 0x8e, 0x27, 0x73, 0x05,
+     0x12, 0xaf, 0xb3, 0x1f, 0xea, 0x4c, 0xde, 0x38, 0x93, 0xdf, 0x7b, 0xad,
+     0x55, 0x3a, 0x4b, 0x62, 0xaa, 0x6d, 0x9c, 0xc7, 0x6f, 0x4f, 0x79, 0xca,
+     0x34, 0xd7, 0xae, 0xe3, 0x32, 0x86, 0x76, 0x1d, 0xff, 0xef, 0x30, 0xff,
+     0x5a, 0x17, 0x6b, 0xa7, 0x1f, 0x70, 0xf6, 0xcd, 0xc0, 0x00, 0x90, 0xbf}};
+#endif
+
+static const field field_sqrt_e = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x89, 0x8c, 0x5b, 0x25, 0x88, 0x22,
+    0x20, 0x45, 0x20, 0x45, 0xdd, 0xc5, 0x9b, 0x5b, 0x6f, 0xf3, 0x2e, 0xa0,
+    0xb7, 0x1f, 0x5f, 0xda, 0xbd, 0x6f, 0xd1, 0xf2, 0xd9, 0x2f, 0xb0, 0xe6,
+    0x0f, 0xfb, 0x72, 0x4b, 0xd1, 0x41, 0xdb, 0x1b, 0x33, 0xa2, 0x49, 0xb3,
+    0x42, 0xb5, 0xef, 0x3b, 0x64, 0xd8, 0xb8, 0x51, 0x90, 0xb3, 0x53, 0x36,
+    0x7d, 0xd7, 0x95, 0x28, 0x52, 0x42, 0x4c, 0x6d, 0x73, 0xbf, 0xf2, 0xec,
+    0x69, 0x32, 0x75, 0x49, 0xad, 0x87, 0x03, 0x78, 0x7e, 0x00, 0xaf, 0x2e,
+    0x9d, 0x41, 0x32, 0x2e, 0x1f, 0x42, 0x74, 0x9f, 0xb2, 0x0e, 0xed, 0xc4};
+
+#if defined(CODA_HOST)
+static const fe_packed schnorr_state[sponge_size] = {
+    {0x61f8102d091a52d9, 0xee9126d70e19a6b3, 0x0698fb57484e6f65,
+     0x84be5f1986ffeadc, 0x4ba71fe1fc707970, 0x9dde5f7ceff4f64a,
+     0xdbb50dfebeeae434, 0xcae5046d98d9a8f1, 0xf0e4091b422c49d9,
+     0xc3b19cdaad8cd8f2, 0xe2ce41eacafa71b4, 0x000040f7c24f23d4},
+    {0xdffa6ac48daff67d, 0xeb533f54c817f6a5, 0x1e1714768549064e,
+     0xbce8971bb266bf53, 0x1f6b9840e9a87ecb, 0x56fa98a88043775a,
+     0xe885d41d512776bd, 0x06c7ab35e3245e1f, 0x92ce5c490472c23f,
+     0x3e568c8fddf3fa8f, 0x9ba51d807d291f44, 0x00016d084666426d},
+    {0xb8faa30d906fdb91, 0x6f23d94737d2a69f, 0x57e1bc3376da23a2,
+     0x03ba01b079f27619, 0x70f2462d77d868b2, 0xd19a55c4b6502341,
+     0x4dc72304dca48ccd, 0x6b9a2cdc987c42b1, 0xe24b0c526c8d44b0,
+     0x38175b6381404e2d, 0x9358971f5b8da915, 0x00014c3cd0a660d2}};
+#else
+static const fe_packed schnorr_state[sponge_size] = {
+    {0x00, 0x00, 0x40, 0xf7, 0xc2, 0x4f, 0x23, 0xd4, 0xe2, 0xce, 0x41, 0xea,
+     0xca, 0xfa, 0x71, 0xb4, 0xc3, 0xb1, 0x9c, 0xda, 0xad, 0x8c, 0xd8, 0xf2,
+     0xf0, 0xe4, 0x09, 0x1b, 0x42, 0x2c, 0x49, 0xd9, 0xca, 0xe5, 0x04, 0x6d,
+     0x98, 0xd9, 0xa8, 0xf1, 0xdb, 0xb5, 0x0d, 0xfe, 0xbe, 0xea, 0xe4, 0x34,
+     0x9d, 0xde, 0x5f, 0x7c, 0xef, 0xf4, 0xf6, 0x4a, 0x4b, 0xa7, 0x1f, 0xe1,
+     0xfc, 0x70, 0x79, 0x70, 0x84, 0xbe, 0x5f, 0x19, 0x86, 0xff, 0xea, 0xdc,
+     0x06, 0x98, 0xfb, 0x57, 0x48, 0x4e, 0x6f, 0x65, 0xee, 0x91, 0x26, 0xd7,
+     0x0e, 0x19, 0xa6, 0xb3, 0x61, 0xf8, 0x10, 0x2d, 0x09, 0x1a, 0x52, 0xd9},
+    {0x00, 0x01, 0x6d, 0x08, 0x46, 0x66, 0x42, 0x6d, 0x9b, 0xa5, 0x1d, 0x80,
+     0x7d, 0x29, 0x1f, 0x44, 0x3e, 0x56, 0x8c, 0x8f, 0xdd, 0xf3, 0xfa, 0x8f,
+     0x92, 0xce, 0x5c, 0x49, 0x04, 0x72, 0xc2, 0x3f, 0x06, 0xc7, 0xab, 0x35,
+     0xe3, 0x24, 0x5e, 0x1f, 0xe8, 0x85, 0xd4, 0x1d, 0x51, 0x27, 0x76, 0xbd,
+     0x56, 0xfa, 0x98, 0xa8, 0x80, 0x43, 0x77, 0x5a, 0x1f, 0x6b, 0x98, 0x40,
+     0xe9, 0xa8, 0x7e, 0xcb, 0xbc, 0xe8, 0x97, 0x1b, 0xb2, 0x66, 0xbf, 0x53,
+     0x1e, 0x17, 0x14, 0x76, 0x85, 0x49, 0x06, 0x4e, 0xeb, 0x53, 0x3f, 0x54,
+     0xc8, 0x17, 0xf6, 0xa5, 0xdf, 0xfa, 0x6a, 0xc4, 0x8d, 0xaf, 0xf6, 0x7d},
+    {0x00, 0x01, 0x4c, 0x3c, 0xd0, 0xa6, 0x60, 0xd2, 0x93, 0x58, 0x97, 0x1f,
+     0x5b, 0x8d, 0xa9, 0x15, 0x38, 0x17, 0x5b, 0x63, 0x81, 0x40, 0x4e, 0x2d,
+     0xe2, 0x4b, 0x0c, 0x52, 0x6c, 0x8d, 0x44, 0xb0, 0x6b, 0x9a, 0x2c, 0xdc,
+     0x98, 0x7c, 0x42, 0xb1, 0x4d, 0xc7, 0x23, 0x04, 0xdc, 0xa4, 0x8c, 0xcd,
+     0xd1, 0x9a, 0x55, 0xc4, 0xb6, 0x50, 0x23, 0x41, 0x70, 0xf2, 0x46, 0x2d,
+     0x77, 0xd8, 0x68, 0xb2, 0x03, 0xba, 0x01, 0xb0, 0x79, 0xf2, 0x76, 0x19,
+     0x57, 0xe1, 0xbc, 0x33, 0x76, 0xda, 0x23, 0xa2, 0x6f, 0x23, 0xd9, 0x47,
+     0x37, 0xd2, 0xa6, 0x9f, 0xb8, 0xfa, 0xa3, 0x0d, 0x90, 0x6f, 0xdb, 0x91}};
+#endif
+
+// fnv-1a of the tables above, as built, see curve_tables_ok
+#if defined(CODA_HOST)
+#define curve_tables_checksum 0xfbfaa846
+#else
+#define curve_tables_checksum 0x6aea9890
+#endif
+
+static inline unsigned int curve_tables_sum(void) {
+  unsigned int h = tables_checksum_init;
+  h = tables_checksum(h, &field_modulus, sizeof(field_modulus));
+  h = tables_checksum(h, &group_order, sizeof(group_order));
+#if !defined(CODA_HOST)
+  h = tables_checksum(h, &field_r2, sizeof(field_r2));
+#endif
+  h = tables_checksum(h, &field_one, sizeof(field_one));
+  h = tables_checksum(h, &group_coeff_a, sizeof(group_coeff_a));
+  h = tables_checksum(h, &group_coeff_b, sizeof(group_coeff_b));
+  h = tables_checksum(h, &group_zero, sizeof(group_zero));
+  h = tables_checksum(h, &group_one, sizeof(group_one));
+  h = tables_checksum(h, &group_comb, sizeof(group_comb));
+  h = tables_checksum(h, &field_sqrt_roots, sizeof(field_sqrt_roots));
+  h = tables_checksum(h, &field_sqrt_e, sizeof(field_sqrt_e));
+  h = tables_checksum(h, &schnorr_state, sizeof(schnorr_state));
+  return h;
+}
+
+#endif // CURVE_TABLES
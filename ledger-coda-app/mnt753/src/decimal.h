@@ -0,0 +1,24 @@
+#ifndef CODA_DECIMAL
+#define CODA_DECIMAL
+
+#include <stdint.h>
+
+// largest nat2dec input, in 64 bit limbs, and the digits it can produce
+#define dec_limbs  4
+#define dec_digits 78
+
+// bin2dec writes n in decimal to dst and appends a NUL byte. It returns the
+// length of the string.
+int bin2dec(uint8_t *dst, uint64_t n);
+
+// nat2dec is bin2dec for the little-endian len limb number nat, which it
+// destroys. len must be at most dec_limbs, and dst must have room for
+// dec_digits + 1 bytes.
+int nat2dec(uint8_t *dst, uint64_t nat[], int len);
+
+// format turns the decimal string in buf, of length dec_len, into an amount
+// of CODA: the last 24 digits become the fraction, trailing zeros are trimmed
+// and " CODA" is appended. It returns the new length.
+int format(uint8_t *buf, uint8_t dec_len);
+
+#endif
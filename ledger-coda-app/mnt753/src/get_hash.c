@@ -24,6 +24,7 @@
 
 #include <os.h>
 #include <os_io_seproxyhal.h>
+#include <cx.h>
 #include "crypto.h"
 #include "ux.h"
 
@@ -46,30 +47,6 @@ static const bagl_element_t* ui_prepro_hash_compare(const bagl_element_t *elemen
   return element;
 }
 
-#define ZEROS 24
-
-int format(uint8_t *buf, uint8_t dec_len) {
-  if (dec_len < ZEROS + 1) {
-    // if < 1, pad with leading zeros
-    os_memmove(buf + (ZEROS - dec_len) + 2, buf, dec_len+1);
-    os_memset(buf, '0', ZEROS + 2 - dec_len);
-    dec_len = ZEROS + 1;
-  } else {
-    os_memmove(buf + (dec_len - ZEROS)+2, buf + (dec_len - ZEROS + 1), ZEROS + 1);
-  }
-  // add decimal point, trim trailing zeros, and add units
-  buf[dec_len - ZEROS] = '.';
-  while (dec_len > 0 && buf[dec_len] == '0') {
-    dec_len--;
-  }
-  if (buf[dec_len] == '.') {
-    dec_len--;
-  }
-  os_memmove(buf + dec_len + 1, " CODA", 6);
-  return dec_len + 6;
-}
-
-
 static unsigned int ui_hash_compare_button(unsigned int button_mask, unsigned int button_mask_counter) {
   switch (button_mask) {
   case BUTTON_LEFT:
@@ -116,8 +93,8 @@ static unsigned int ui_hash_sign_button(unsigned int button_mask, unsigned int b
     // APPROVE
     case BUTTON_EVT_RELEASED | BUTTON_RIGHT: {
       scalar sk;
-      group pk;
-      generate_keypair(ctx->key_index, &pk, sk);
+      affine pk;
+      get_keypair(ctx->key_index, &pk, sk);
       sign(G_io_apdu_buffer, G_io_apdu_buffer + field_bytes, &pk, sk, ctx->txn.hash, ctx->txn.hash);
       io_exchange_with_code(SW_OK, field_bytes + scalar_bytes);
       ui_idle();
@@ -185,13 +162,14 @@ static void format_txn_elem(hash_context *ctx) {
 
     case TXN_ELEM_AMOUNT:
       os_memmove(ctx->label_str, "Amount", 7);
+      os_memmove(ctx->full_str, txn->out_val, txn->val_len + 1);
       ctx->elem_len = format(ctx->full_str, txn->val_len);
-      os_memmove(ctx->full_str, txn->out_val, txn->val_len);
       break;
 
     case TXN_ELEM_FEE:
       os_memmove(ctx->label_str, "Fee", 4);
-      os_memmove(ctx->full_str, txn->fee_val, sizeof(txn->fee_val));
+      os_memmove(ctx->full_str, txn->fee_val, txn->val_len + 1);
+      ctx->elem_len = format(ctx->full_str, txn->val_len);
       break;
 
     // memo should not be present
@@ -295,11 +273,355 @@ static unsigned int ui_hash_elem_button(unsigned int button_mask, unsigned int b
 #define P2_DISPLAY_HASH 0x00 // display transaction hash
 #define P2_SIGN_HASH    0x01 // sign transaction hash
 
+// INS_HASH with P2_SIGN_BATCH signs a run of transactions from one key with a
+// single approval. P1_FIRST carries the key index (u32), the sig index (u16)
+// and the number of transactions (u16), followed by the transactions back to
+// back; P1_MORE packets carry the rest. Nothing is displayed while they
+// stream in: the reply to each packet holds hash || tag for every
+// transaction that ended in it. After the last one the user reviews a
+// summary (count, total amount, total fees, distinct recipients) and
+// approves once. The host then sends P1_SIGN packets of up to batch_per_sign
+// hash || tag records, and each reply holds their signatures, rx || s.
+//
+// The tag is a MAC of the hash under a key drawn for the batch. It lets the
+// host hold the hashes, so a batch can be any length, and only what the
+// summary shows is kept on the device. The summary has no room for stake
+// delegations, so a batch with one in it fails; they are signed one at a time.
+#define P2_SIGN_BATCH   0x03 // sign a batch of transaction hashes
+#define P1_SIGN         0x40 // sign hashes of an approved batch
+#define batch_sig_bytes (field_bytes + scalar_bytes)
+#define batch_per_sign  batch_per_reply // the hashes are staged in pending
+
+// the state of a batch that has to outlive a single command, outside of
+// global. batch_open is set while the transactions stream in, and their
+// decoder and summary in global.h are only valid while it is. the approval
+// covers batch_count signatures, batch_unsigned of them still to go
+static uint8_t batch_key[32];
+static uint8_t batch_open;
+static uint8_t batch_approved;
+static uint32_t batch_key_index;
+static uint16_t batch_unsigned;
+
+// ends the batch, voiding the tags and the approval: once the batch is
+// signed, on app exit and usb reset, and in every other command, since they
+// all take over global
+void batch_clear(void) {
+  os_memset(batch_key, 0, sizeof(batch_key));
+  batch_open = 0;
+  batch_approved = 0;
+  batch_key_index = 0;
+  batch_unsigned = 0;
+}
+
+static void batch_tag(uint8_t *tag, const scalar hash) {
+  uint8_t in[sizeof(batch_key) + scalar_bytes];
+  uint8_t mac[32];
+  os_memmove(in, batch_key, sizeof(batch_key));
+  os_memmove(in + sizeof(batch_key), hash, scalar_bytes);
+  cx_hash_sha256(in, sizeof(in), mac, sizeof(mac));
+  os_memmove(tag, mac, tag_bytes);
+}
+
+// the pending hashes with their tags, at the start of G_io_apdu_buffer
+static uint16_t batch_reply(void) {
+  uint16_t tx = 0;
+  for (unsigned int i = 0; i < ctx->pending_count; i++) {
+    os_memmove(G_io_apdu_buffer + tx, ctx->pending[i], scalar_bytes);
+    batch_tag(G_io_apdu_buffer + tx + scalar_bytes, ctx->pending[i]);
+    tx += batch_record_bytes;
+  }
+  ctx->pending_count = 0;
+  return tx;
+}
+
+// a bad packet ends the batch; the host has to start over with P1_FIRST
+static void batch_fail(void) {
+  batch_clear();
+  THROW(SW_INVALID_PARAM);
+}
+
+static void batch_add(uint64_t total[dec_limbs], const uint64_t val[cur_limbs]) {
+  uint64_t carry = 0;
+  for (int i = 0; i < dec_limbs; i++) {
+    uint64_t v = (i < cur_limbs) ? val[i] : 0;
+    uint64_t t = total[i] + carry;
+    carry = (t < carry);
+    total[i] = t + v;
+    carry += (total[i] < v);
+  }
+}
+
+static void batch_recipient(const uint8_t *tag) {
+  unsigned int n = ctx->recipient_count;
+  if (n > batch_recipients) {
+    return;
+  }
+  for (unsigned int i = 0; i < n && i < batch_recipients; i++) {
+    if (os_memcmp(ctx->recipients[i], tag, tag_bytes) == 0) {
+      return;
+    }
+  }
+  if (n < batch_recipients) {
+    os_memmove(ctx->recipients[n], tag, tag_bytes);
+  }
+  ctx->recipient_count++;
+}
+
+// batch_decode runs the decoder over the packet given to txn_update, adding
+// up the summary as it goes, until it needs more data or the last
+// transaction is done.
+static void batch_decode(void) {
+  txn_state *txn = &ctx->txn;
+  for (;;) {
+    switch (txn_next_elem(txn)) {
+      case TXN_STATE_ERR:
+        batch_fail();
+      case TXN_STATE_PARTIAL:
+        return;
+      case TXN_STATE_READY:
+        if (txn->elem_type == TXN_ELEM_IS_DELEGATION) {
+          if (txn->del) {
+            batch_fail();
+          }
+        } else if (txn->elem_type == TXN_ELEM_AMOUNT) {
+          batch_add(ctx->total_amount, txn->val_nat);
+        } else if (txn->elem_type == TXN_ELEM_FEE) {
+          batch_add(ctx->total_fee, txn->val_nat);
+        } else if (txn->elem_type == TXN_ELEM_TO) {
+          batch_recipient(txn->to_tag);
+        }
+        break;
+      case TXN_STATE_FINISHED:
+        if (ctx->pending_count == batch_per_reply) {
+          // more transactions ended in this packet than its reply can hold
+          batch_fail();
+        }
+        os_memmove(ctx->pending[ctx->pending_count++], txn->hash, scalar_bytes);
+        if (++ctx->batch_done == ctx->batch_count) {
+          if (txn->in_len != 0) {
+            batch_fail();
+          }
+          return;
+        }
+        txn_restart(txn);
+        break;
+    }
+  }
+}
+
+// batch_amount formats a total in CODA into full_str
+static void batch_amount(const uint64_t total[dec_limbs]) {
+  uint64_t nat[dec_limbs];
+  os_memmove(nat, total, sizeof(nat));
+  ctx->elem_len = format(ctx->full_str, nat2dec(ctx->full_str, nat, dec_limbs));
+}
+
+// batch_summary prepares summary screen summary_index for display, like
+// format_txn_elem does for the elements of a single transaction
+static void batch_summary(void) {
+  switch (ctx->summary_index) {
+    case 0:
+      os_memmove(ctx->label_str, "Transactions", 13);
+      ctx->elem_len = bin2dec(ctx->full_str, ctx->batch_count);
+      break;
+    case 1:
+      os_memmove(ctx->label_str, "Total amount", 13);
+      batch_amount(ctx->total_amount);
+      break;
+    case 2:
+      os_memmove(ctx->label_str, "Total fees", 11);
+      batch_amount(ctx->total_fee);
+      break;
+    case 3:
+      os_memmove(ctx->label_str, "Recipients", 11);
+      if (ctx->recipient_count > batch_recipients) {
+        os_memmove(ctx->full_str, "more than ", 10);
+        ctx->elem_len = 10 + bin2dec(ctx->full_str + 10, batch_recipients);
+      } else {
+        ctx->elem_len = bin2dec(ctx->full_str, ctx->recipient_count);
+      }
+      break;
+  }
+  os_memmove(ctx->partial_str, ctx->full_str, 12);
+  ctx->display_index = 0;
+}
+
+static const bagl_element_t ui_batch_sign[] = {
+  UI_BACKGROUND(),
+  UI_ICON_LEFT(0x00, BAGL_GLYPH_ICON_CROSS),
+  UI_ICON_RIGHT(0x00, BAGL_GLYPH_ICON_CHECK),
+  UI_TEXT(0x00, 0, 12, 128, "Sign all Txns"),
+  UI_TEXT(0x00, 0, 26, 128, global.h.full_str), // "with Key #123?"
+};
+
+static unsigned int ui_batch_sign_button(unsigned int button_mask, unsigned int button_mask_counter) {
+  switch (button_mask) {
+    // REJECT
+    case BUTTON_EVT_RELEASED | BUTTON_LEFT:
+      batch_clear();
+      io_exchange_with_code(SW_USER_REJECTED, 0);
+      ui_idle();
+      break;
+
+    // APPROVE
+    case BUTTON_EVT_RELEASED | BUTTON_RIGHT:
+      batch_approved = 1;
+      batch_key_index = ctx->key_index;
+      batch_unsigned = ctx->batch_count;
+      io_exchange_with_code(SW_OK, batch_reply());
+      ui_idle();
+      break;
+  }
+  return 0;
+}
+
+static const bagl_element_t ui_batch_elem[] = {
+  UI_BACKGROUND(),
+  UI_ICON_LEFT(0x01, BAGL_GLYPH_ICON_LEFT),
+  UI_ICON_RIGHT(0x02, BAGL_GLYPH_ICON_RIGHT),
+  UI_TEXT(0x00, 0, 12, 128, global.h.label_str),
+  UI_TEXT(0x00, 0, 26, 128, global.h.partial_str),
+};
+
+static unsigned int ui_batch_elem_button(unsigned int button_mask, unsigned int button_mask_counter) {
+  switch (button_mask) {
+    case BUTTON_LEFT:
+    case BUTTON_EVT_FAST | BUTTON_LEFT: // SEEK LEFT
+      if (ctx->display_index > 0) {
+        ctx->display_index--;
+      }
+      os_memmove(ctx->partial_str, ctx->full_str+ctx->display_index, 12);
+      UX_REDISPLAY();
+      break;
+
+    case BUTTON_RIGHT:
+    case BUTTON_EVT_FAST | BUTTON_RIGHT: // SEEK RIGHT
+      if (ctx->display_index < ctx->elem_len-12) {
+        ctx->display_index++;
+      }
+      os_memmove(ctx->partial_str, ctx->full_str+ctx->display_index, 12);
+      UX_REDISPLAY();
+      break;
+
+    case BUTTON_EVT_RELEASED | BUTTON_LEFT | BUTTON_RIGHT: // PROCEED
+      if (++ctx->summary_index < 4) {
+        batch_summary();
+        UX_REDISPLAY();
+        break;
+      }
+      os_memmove(ctx->full_str, "with Key #", 10);
+      os_memmove(ctx->full_str+10+(bin2dec(ctx->full_str+10, ctx->key_index)), "?", 2);
+      UX_DISPLAY(ui_batch_sign, NULL);
+      break;
+  }
+  return 0;
+}
+
+// batch_sign checks the tags of the records in a P1_SIGN packet and replies
+// with the signatures of their hashes
+static void batch_sign(uint8_t *data_buffer, uint16_t data_length) {
+  if (!batch_approved) {
+    THROW(SW_IMPROPER_INIT);
+  }
+  unsigned int n = data_length / batch_record_bytes;
+  if (n == 0 || n > batch_per_sign || n > batch_unsigned ||
+      data_length != n * batch_record_bytes) {
+    THROW(SW_INVALID_PARAM);
+  }
+
+  // the signatures overwrite the packet, so the hashes are checked and moved
+  // out of the way first
+  uint8_t tag[tag_bytes];
+  for (unsigned int i = 0; i < n; i++) {
+    uint8_t *record = data_buffer + i * batch_record_bytes;
+    uint8_t diff = 0;
+    batch_tag(tag, record);
+    for (unsigned int j = 0; j < tag_bytes; j++) {
+      diff |= tag[j] ^ record[scalar_bytes + j];
+    }
+    if (diff != 0) {
+      THROW(SW_INVALID_PARAM);
+    }
+    os_memmove(ctx->pending[i], record, scalar_bytes);
+  }
+
+  scalar sk;
+  affine pk;
+  get_keypair(batch_key_index, &pk, sk);
+  for (unsigned int i = 0; i < n; i++) {
+    uint8_t *sig = G_io_apdu_buffer + i * batch_sig_bytes;
+    sign(sig, sig + field_bytes, &pk, sk, ctx->pending[i], ctx->pending[i]);
+  }
+  os_memset(sk, 0, sizeof(sk));
+  batch_unsigned -= n;
+  if (batch_unsigned == 0) {
+    batch_clear();
+  }
+  io_exchange_with_code(SW_OK, n * batch_sig_bytes);
+}
+
+static void handle_batch(uint8_t p1, uint8_t *data_buffer, uint16_t data_length, volatile unsigned int *flags) {
+  if (p1 == P1_SIGN) {
+    batch_sign(data_buffer, data_length);
+    return;
+  }
+  if (p1 != P1_FIRST && p1 != P1_MORE) {
+    THROW(SW_INVALID_PARAM);
+  }
+
+  if (p1 == P1_FIRST) {
+    if (data_length < 8) {
+      THROW(SW_INVALID_PARAM);
+    }
+    ctx->key_index = U4LE(data_buffer, 0);
+    uint16_t sig_index = U2LE(data_buffer, 4);
+    uint16_t count = U2LE(data_buffer, 6);
+    if (count == 0) {
+      THROW(SW_INVALID_PARAM);
+    }
+    data_buffer += 8; data_length -= 8;
+
+    // a new batch voids the tags and the approval of the previous one
+    batch_clear();
+    cx_rng(batch_key, sizeof(batch_key));
+
+    txn_init(&ctx->txn, sig_index);
+    ctx->batch_count = count;
+    ctx->batch_done = ctx->pending_count = ctx->recipient_count = 0;
+    os_memset(ctx->total_amount, 0, sizeof(ctx->total_amount));
+    os_memset(ctx->total_fee, 0, sizeof(ctx->total_fee));
+    ctx->partial_str[12] = '\0';
+    batch_open = 1;
+  } else if (!batch_open) {
+    THROW(SW_IMPROPER_INIT);
+  }
+
+  txn_update(&ctx->txn, data_buffer, data_length);
+  batch_decode();
+  if (ctx->batch_done < ctx->batch_count) {
+    io_exchange_with_code(SW_OK, batch_reply());
+    return;
+  }
+
+  // all transactions are hashed; the hashes of the last packet are returned
+  // once the summary is approved
+  batch_open = 0;
+  ctx->summary_index = 0;
+  batch_summary();
+  UX_DISPLAY(ui_batch_elem, ui_prepro_hash_elem);
+  *flags |= IO_ASYNCH_REPLY;
+}
+
 // handle_hash reads a signature index and a transaction, calculates the
 // SigHash of the transaction, and optionally signs the hash using a specified
 // key. The transaction is processed in a streaming fashion and displayed
 // piece-wise to the user.
 void handle_hash(uint8_t p1, uint8_t p2, uint8_t *data_buffer, uint16_t data_length, volatile unsigned int *flags, volatile unsigned int *tx) {
+  if (p2 == P2_SIGN_BATCH) {
+    handle_batch(p1, data_buffer, data_length, flags);
+    return;
+  }
+  batch_clear();
   ctx->initialized = 0;
 
   if ((p1 != P1_FIRST && p1 != P1_MORE) || (p2 != P2_DISPLAY_HASH && p2 != P2_SIGN_HASH)) {
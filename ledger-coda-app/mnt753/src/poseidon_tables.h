@@ -0,0 +1,3002 @@
+// generated by gen_tables.py, do not edit
+
+#ifndef POSEIDON_TABLES
+#define POSEIDON_TABLES
+
+#include "crypto.h"
+#include "poseidon.h"
+
+// round counts and s-box of codaledgercli/poseidon_params.py
+#define full_rounds 8
+#define partial_rounds 33
+#define rounds (full_rounds + partial_rounds)
+#define poseidon_alpha 11
+
+#if sponge_size != 3
+#error "sponge_size differs from gen_tables.py"
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed full_round_keys[full_rounds][sponge_size] = {
+    {{0x521efe41d8b7664f, 0x71214830e7a882c9, 0xe738265baf312931,
+      0x6558a0382a1e935d, 0x86ee6a04f119eb02, 0x8e4740d9bfcb8bb1,
+      0xa6dffa07c3ba7eb8, 0x67fbd808ccd7f3ec, 0xf1099b70afb57a3c,
+      0xadaf6cc2379b79f2, 0x1e68f4c0502383ae, 0x0001381e76d04349},
+     {0x56c864c6bb926967, 0x4ce78a19e877445b, 0xee853ba34c3a1f28,
+      0x01fb726bc6a8cd69, 0x70d5a6e88381abc2, 0xfef05a8be364853b,
+      0x70a2657fbdb310c3, 0xc734724958ba737b, 0x8e12713fe2550a79,
+      0xf3c816fce4f0125c, 0x5b51e3e31ce8fa00, 0x000016f7e7a12914},
+     {0x5b380c27074d25ba, 0xc727ba4b976e7ece, 0x94a3f05f27ebded5,
+      0xecdfb5ea1d0ddc08, 0xb86cf7dc37cb406d, 0x28acacda5ece980a,
+      0x32c77e2fcdd90670, 0xdbe9db8592d180e2, 0x10b399c1b1438325,
+      0x365f77fb5e476f4c, 0x3c8baabb9f6f4f11, 0x000178ed1f587d1d}},
+    {{0x9ea0c265f7b303a0, 0xbaf1a4fe3a160a45, 0xe76a0ac5426b28a6,
+      0x633211bbf265dd57, 0xfcef912ec07bb12f, 0x71fea8d09b38dbd3,
+      0x7c483653ef3a1d49, 0x897ad34f9ebfbcf1, 0xc11ed327d8841689,
+      0xec5613d472f706c7, 0xb54a4aa34bce218b, 0x0000acaed56583ce},
+     {0x1787f92f4e606d0c, 0xfc22d67b718f9267, 0x3c63020ed566df45,
+      0xc172b488d0ce5f6e, 0xf7275b9bb8a03c5d, 0x087aa31d6940a3c0,
+      0x259c1ce95b950dc7, 0xfd96fb3aadc001f8, 0xa72cdd4857c97f38,
+      0xa0c779f51da11535, 0x5ddb3d74c98e412a, 0x0000a4a9977e431f},
+     {0x5522eeee7ea472eb, 0x384a89058f6b29d5, 0x1672c8d412a79358,
+      0xc5cda71996b6fd78, 0x9a3a87aa8b495e79, 0xf9c04380105dd7c1,
+      0x4e2979c16a556ece, 0x4aa8187e922a7241, 0xa76b0dd1082eae56,
+      0xc31630058b12c000, 0x1384f53d7cd9a98b, 0x000063f4a2534166}},
+    {{0xdd8c9c6251883a9c, 0x6df1e0fa88bce07d, 0xc34d7297b15df834,
+      0x7f1800925382ce64, 0xcec184ca915f6266, 0x4b7c87849eb2f926,
+      0xdb9b16be7ec98aef, 0x5fde2601228b6cd1, 0x476dbeec64eb7d15,
+      0x498e0cd1f538e30a, 0xe394fdc18df8d11f, 0x0000a06ef09f4fe9},
+     {0xf913361236f905a1, 0x9df98bf9714aeb04, 0xbc84e1c042eff7a9,
+      0x5dd72297b6aba0df, 0x98b1cd9317d0f440, 0x40fe757cf4428671,
+      0xc8a38be3d3338531, 0xc4dda72a4580865d, 0x830453925caac48c,
+      0x7428ae95c11e06dc, 0xf3394a454697d4a8, 0x00007fc318b893d2},
+     {0x6f4ece4d05be9ff3, 0xfebe684156562e58, 0x2c8a83303711b716,
+      0x2661e0c9bf28dc25, 0x2c5e26324bba1897, 0x54ffa82a42bb2a57,
+      0x667a697833e51c95, 0xbdc43adee4a2f9ce, 0xdc8bda3b6a798d68,
+      0x976f76df76fac755, 0x07a6e0feb40d9885, 0x0000a0a1297eafa7}},
+    {{0xda151a1af9a909ef, 0xbe97901f95a74f90, 0xe54106ad7fabceea,
+      0x01d04a18c4463eb9, 0x590a054735a3c05f, 0xe93f2c21b35d41ad,
+      0xf78fd60dd01ba997, 0x9368aa62655161cf, 0x2fa053344366e73a,
+      0xb5da84c4ff3984fa, 0xcb54c7b223d56136, 0x0000b50569ecdb23},
+     {0xf01815673649e350, 0xf3c325c7cef77fc1, 0xe633a72ad967ad7b,
+      0x607377dcaf401db4, 0x5f11491998b2def0, 0xc149f93bbe7a3924,
+      0xe7cc9c0d3ecb25f1, 0x35d9d0dddbb8400b, 0x442fa7f93bbcbfa4,
+      0x9eec4fb0c5e004eb, 0xecd0590a0b8c1197, 0x00009bd418e1e151},
+     {0x21108f99251f3e55, 0xacba2a14fb0cd9e8, 0x2811b6df33854865,
+      0xc1fb361b428e2153, 0x837617f3dc22e43a, 0x893cf26abada25cc,
+      0xc62f55188330f7b2, 0x3a42af8bd1daf985, 0xe7a194f18c39c348,
+      0x412064342b3e8cf4, 0x91695a44ce63117b, 0x00009c20d5de611e}},
+    {{0xbc48241452c168bd, 0xfb5e6bd4bcac777a, 0xb9228a0ddb4bbc26,
+      0x9b9f6b81e499d670, 0xcd09a3f43662fb93, 0xe041aa37c735ef68,
+      0xaf536279c7d2da44, 0x4dd33c079e267a4d, 0x190670ed2b558966,
+      0xfb012b5f8dea2e1c, 0xa0fcc2820917da54, 0x00010331a1b1f83b},
+     {0xd80c80311357b758, 0x8da625013f7cdbc5, 0x5b4ce6e270e6e353,
+      0xeb234303527a6465, 0x9aa19f05f2d774f3, 0x2ba9bf54e424ab80,
+      0xc88a1083bd584b63, 0x29fe284f10a1f582, 0x6f43ab349d96927b,
+      0x081ceb112cfca609, 0xf5bb9e456c8c654c, 0x000028a3fa329189},
+     {0xcd1e0ee5437ad9e9, 0x753ecb4be21d9bb9, 0xdd72500d9dd9abb0,
+      0x234f8dd598ca7650, 0x922f318cb7393b69, 0x23054bf53f47efe4,
+      0xca86614ee934591b, 0xbf81b1d0e1f55bd7, 0x7fe92741e01f1fe4,
+      0x5854fc8545286238, 0xe5f0d48b01fa6f08, 0x00016645dad69672}},
+    {{0xe87b710ae585bd26, 0xd140b06450e707e1, 0xb26ba324a9438227,
+      0xe442a6dbf9f3d087, 0x6ea184f703fa3af4, 0x6649850baae9cc30,
+      0x56c39363f2696493, 0xeabb5c502bd7fb9a, 0x028b9da9a9cf9961,
+      0x967d3005362fab8b, 0x74c89f0180bcf9f5, 0x00009233b5daed54},
+     {0x8539aa7c7f21b982, 0x2d4e9889d771608c, 0x2a17de616342fa30,
+      0xa1fd0002efde7c8c, 0xd2dd64e629f8868e, 0x957808d7e54250d7,
+      0x945e8b9d2f938e72, 0x92b668007853d16f, 0x89b556010c43f91b,
+      0x6d3f5d9c0f520d24, 0x330c80da21aac996, 0x0001738d90e77259},
+     {0x56859e88298e08ee, 0x9909eaa959f67a7c, 0x2a0f80ef3747793f,
+      0x8543be2f9f6ed7f7, 0xa56559d277643105, 0x19c946ad4de01853,
+      0x4655659477fda1cc, 0x0fb2a6d30e96f523, 0x03656714b441bc83,
+      0x956736ae58960ec5, 0x6a21b9ed3294d7db, 0x0000c8704013d6ce}},
+    {{0xd3a2cbdb9fc57991, 0xe78be58167272a20, 0x3105a69e90ddb917,
+      0x409d843aaafd299f, 0x26ffd0be04a958b4, 0x3c106a84ee0cfe03,
+      0x94e46c889de509ef, 0xbacf9e656e6f27df, 0xe9e8a6153cbe6426,
+      0x8bd84cce278e62e3, 0xab9cdeb094e2b55e, 0x0000becb4dab9d45},
+     {0xcc2412dbfb426e49, 0x0926d27737852548, 0x3e4b93d606411693,
+      0x06acc2b7a0658663, 0x89a8785cfc947bec, 0x4af6463fdf0c5974,
+      0xa2b254e64f151d82, 0x3012888ed030a1ed, 0x006ad320ad338b7b,
+      0xe4c7779e9aa0ebed, 0x78508e260b0e6d29, 0x0001c416df91d13f},
+     {0x20e7e5ad4dc03fc7, 0xfd20bb026d3260d7, 0x2ae5ea0890522cae,
+      0xaf2f06a6356a5c15, 0x0907e74b15af50ea, 0x6fd2dafb82e54798,
+      0xded14669a6c92ba1, 0x6f6491bee1f5d882, 0x68533856ce1eeff9,
+      0xb709ad38004acd89, 0x35f1a566795a9304, 0x00018cd95cfb486c}},
+    {{0xc36508ca5c7a6988, 0x18dd28117763fec2, 0x4f656cb6e717c659,
+      0xb87c4b0de8c60aa5, 0x9194953a6ddacdf2, 0x94312b5bef505d19,
+      0xa1ee1062a19b87c9, 0x6f8a2744b91f7652, 0x291901a015af4290,
+      0xa7f1c77e4089028e, 0xfaf3078b4e58b21e, 0x0000169231f0312d},
+     {0xf4645165ebc57e1c, 0xee30b74e8f4239ee, 0x497f2161eec7ee44,
+      0xb891caea82b81a15, 0x3ebad525a1474454, 0xabbfb56ffe892da3,
+      0x6779e8674b63d582, 0x8c475bf35446e79c, 0x6deec2f59aef97dd,
+      0xc91b084e400cc400, 0x2eb449f4d58f01b3, 0x0001abf03a5385a2},
+     {0x459827b57ed24a52, 0xcaa657ca4d3c7846, 0xa5d0be1f6db81a58,
+      0x559e04dfb0f62b0e, 0x96bd83ea3adffbf1, 0x69ce8965178df63c,
+      0x0de58a7469fa9368, 0x4a2d7314a433ec36, 0xb9d980b1bfac262f,
+      0x15eb0a075f084b8b, 0x2494d87764a94141, 0x00009f10155ddd84}}};
+#else
+static const fe_packed full_round_keys[full_rounds][sponge_size] = {
+    {{0x00, 0x01, 0x38, 0x1e, 0x76, 0xd0, 0x43, 0x49, 0x1e, 0x68, 0xf4, 0xc0,
+      0x50, 0x23, 0x83, 0xae, 0xad, 0xaf, 0x6c, 0xc2, 0x37, 0x9b, 0x79, 0xf2,
+      0xf1, 0x09, 0x9b, 0x70, 0xaf, 0xb5, 0x7a, 0x3c, 0x67, 0xfb, 0xd8, 0x08,
+      0xcc, 0xd7, 0xf3, 0xec, 0xa6, 0xdf, 0xfa, 0x07, 0xc3, 0xba, 0x7e, 0xb8,
+      0x8e, 0x47, 0x40, 0xd9, 0xbf, 0xcb, 0x8b, 0xb1, 0x86, 0xee, 0x6a, 0x04,
+      0xf1, 0x19, 0xeb, 0x02, 0x65, 0x58, 0xa0, 0x38, 0x2a, 0x1e, 0x93, 0x5d,
+      0xe7, 0x38, 0x26, 0x5b, 0xaf, 0x31, 0x29, 0x31, 0x71, 0x21, 0x48, 0x30,
+      0xe7, 0xa8, 0x82, 0xc9, 0x52, 0x1e, 0xfe, 0x41, 0xd8, 0xb7, 0x66, 0x4f},
+     {0x00, 0x00, 0x16, 0xf7, 0xe7, 0xa1, 0x29, 0x14, 0x5b, 0x51, 0xe3, 0xe3,
+      0x1c, 0xe8, 0xfa, 0x00, 0xf3, 0xc8, 0x16, 0xfc, 0xe4, 0xf0, 0x12, 0x5c,
+      0x8e, 0x12, 0x71, 0x3f, 0xe2, 0x55, 0x0a, 0x79, 0xc7, 0x34, 0x72, 0x49,
+      0x58, 0xba, 0x73, 0x7b, 0x70, 0xa2, 0x65, 0x7f, 0xbd, 0xb3, 0x10, 0xc3,
+      0xfe, 0xf0, 0x5a, 0x8b, 0xe3, 0x64, 0x85, 0x3b, 0x70, 0xd5, 0xa6, 0xe8,
+      0x83, 0x81, 0xab, 0xc2, 0x01, 0xfb, 0x72, 0x6b, 0xc6, 0xa8, 0xcd, 0x69,
+      0xee, 0x85, 0x3b, 0xa3, 0x4c, 0x3a, 0x1f, 0x28, 0x4c, 0xe7, 0x8a, 0x19,
+      0xe8, 0x77, 0x44, 0x5b, 0x56, 0xc8, 0x64, 0xc6, 0xbb, 0x92, 0x69, 0x67},
+     {0x00, 0x01, 0x78, 0xed, 0x1f, 0x58, 0x7d, 0x1d, 0x3c, 0x8b, 0xaa, 0xbb,
+      0x9f, 0x6f, 0x4f, 0x11, 0x36, 0x5f, 0x77, 0xfb, 0x5e, 0x47, 0x6f, 0x4c,
+      0x10, 0xb3, 0x99, 0xc1, 0xb1, 0x43, 0x83, 0x25, 0xdb, 0xe9, 0xdb, 0x85,
+      0x92, 0xd1, 0x80, 0xe2, 0x32, 0xc7, 0x7e, 0x2f, 0xcd, 0xd9, 0x06, 0x70,
+      0x28, 0xac, 0xac, 0xda, 0x5e, 0xce, 0x98, 0x0a, 0xb8, 0x6c, 0xf7, 0xdc,
+      0x37, 0xcb, 0x40, 0x6d, 0xec, 0xdf, 0xb5, 0xea, 0x1d, 0x0d, 0xdc, 0x08,
+      0x94, 0xa3, 0xf0, 0x5f, 0x27, 0xeb, 0xde, 0xd5, 0xc7, 0x27, 0xba, 0x4b,
+      0x97, 0x6e, 0x7e, 0xce, 0x5b, 0x38, 0x0c, 0x27, 0x07, 0x4d, 0x25, 0xba}},
+    {{0x00, 0x00, 0xac, 0xae, 0xd5, 0x65, 0x83, 0xce, 0xb5, 0x4a, 0x4a, 0xa3,
+      0x4b, 0xce, 0x21, 0x8b, 0xec, 0x56, 0x13, 0xd4, 0x72, 0xf7, 0x06, 0xc7,
+      0xc1, 0x1e, 0xd3, 0x27, 0xd8, 0x84, 0x16, 0x89, 0x89, 0x7a, 0xd3, 0x4f,
+      0x9e, 0xbf, 0xbc, 0xf1, 0x7c, 0x48, 0x36, 0x53, 0xef, 0x3a, 0x1d, 0x49,
+      0x71, 0xfe, 0xa8, 0xd0, 0x9b, 0x38, 0xdb, 0xd3, 0xfc, 0xef, 0x91, 0x2e,
+      0xc0, 0x7b, 0xb1, 0x2f, 0x63, 0x32, 0x11, 0xbb, 0xf2, 0x65, 0xdd, 0x57,
+      0xe7, 0x6a, 0x0a, 0xc5, 0x42, 0x6b, 0x28, 0xa6, 0xba, 0xf1, 0xa4, 0xfe,
+      0x3a, 0x16, 0x0a, 0x45, 0x9e, 0xa0, 0xc2, 0x65, 0xf7, 0xb3, 0x03, 0xa0},
+     {0x00, 0x00, 0xa4, 0xa9, 0x97, 0x7e, 0x43, 0x1f, 0x5d, 0xdb, 0x3d, 0x74,
+      0xc9, 0x8e, 0x41, 0x2a, 0xa0, 0xc7, 0x79, 0xf5, 0x1d, 0xa1, 0x15, 0x35,
+      0xa7, 0x2c, 0xdd, 0x48, 0x57, 0xc9, 0x7f, 0x38, 0xfd, 0x96, 0xfb, 0x3a,
+      0xad, 0xc0, 0x01, 0xf8, 0x25, 0x9c, 0x1c, 0xe9, 0x5b, 0x95, 0x0d, 0xc7,
+      0x08, 0x7a, 0xa3, 0x1d, 0x69, 0x40, 0xa3, 0xc0, 0xf7, 0x27, 0x5b, 0x9b,
+      0xb8, 0xa0, 0x3c, 0x5d, 0xc1, 0x72, 0xb4, 0x88, 0xd0, 0xce, 0x5f, 0x6e,
+      0x3c, 0x63, 0x02, 0x0e, 0xd5, 0x66, 0xdf, 0x45, 0xfc, 0x22, 0xd6, 0x7b,
+      0x71, 0x8f, 0x92, 0x67, 0x17, 0x87, 0xf9, 0x2f, 0x4e, 0x60, 0x6d, 0x0c},
+     {0x00, 0x00, 0x63, 0xf4, 0xa2, 0x53, 0x41, 0x66, 0x13, 0x84, 0xf5, 0x3d,
+      0x7c, 0xd9, 0xa9, 0x8b, 0xc3, 0x16, 0x30, 0x05, 0x8b, 0x12, 0xc0, 0x00,
+      0xa7, 0x6b, 0x0d, 0xd1, 0x08, 0x2e, 0xae, 0x56, 0x4a, 0xa8, 0x18, 0x7e,
+      0x92, 0x2a, 0x72, 0x41, 0x4e, 0x29, 0x79, 0xc1, 0x6a, 0x55, 0x6e, 0xce,
+      0xf9, 0xc0, 0x43, 0x80, 0x10, 0x5d, 0xd7, 0xc1, 0x9a, 0x3a, 0x87, 0xaa,
+      0x8b, 0x49, 0x5e, 0x79, 0xc5, 0xcd, 0xa7, 0x19, 0x96, 0xb6, 0xfd, 0x78,
+      0x16, 0x72, 0xc8, 0xd4, 0x12, 0xa7, 0x93, 0x58, 0x38, 0x4a, 0x89, 0x05,
+      0x8f, 0x6b, 0x29, 0xd5, 0x55, 0x22, 0xee, 0xee, 0x7e, 0xa4, 0x72, 0xeb}},
+    {{0x00, 0x00, 0xa0, 0x6e, 0xf0, 0x9f, 0x4f, 0xe9, 0xe3, 0x94, 0xfd, 0xc1,
+      0x8d, 0xf8, 0xd1, 0x1f, 0x49, 0x8e, 0x0c, 0xd1, 0xf5, 0x38, 0xe3, 0x0a,
+      0x47, 0x6d, 0xbe, 0xec, 0x64, 0xeb, 0x7d, 0x15, 0x5f, 0xde, 0x26, 0x01,
+      0x22, 0x8b, 0x6c, 0xd1, 0xdb, 0x9b, 0x16, 0xbe, 0x7e, 0xc9, 0x8a, 0xef,
+      0x4b, 0x7c, 0x87, 0x84, 0x9e, 0xb2, 0xf9, 0x26, 0xce, 0xc1, 0x84, 0xca,
+      0x91, 0x5f, 0x62, 0x66, 0x7f, 0x18, 0x00, 0x92, 0x53, 0x82, 0xce, 0x64,
+      0xc3, 0x4d, 0x72, 0x97, 0xb1, 0x5d, 0xf8, 0x34, 0x6d, 0xf1, 0xe0, 0xfa,
+      0x88, 0xbc, 0xe0, 0x7d, 0xdd, 0x8c, 0x9c, 0x62, 0x51, 0x88, 0x3a, 0x9c},
+     {0x00, 0x00, 0x7f, 0xc3, 0x18, 0xb8, 0x93, 0xd2, 0xf3, 0x39, 0x4a, 0x45,
+      0x46, 0x97, 0xd4, 0xa8, 0x74, 0x28, 0xae, 0x95, 0xc1, 0x1e, 0x06, 0xdc,
+      0x83, 0x04, 0x53, 0x92, 0x5c, 0xaa, 0xc4, 0x8c, 0xc4, 0xdd, 0xa7, 0x2a,
+      0x45, 0x80, 0x86, 0x5d, 0xc8, 0xa3, 0x8b, 0xe3, 0xd3, 0x33, 0x85, 0x31,
+      0x40, 0xfe, 0x75, 0x7c, 0xf4, 0x42, 0x86, 0x71, 0x98, 0xb1, 0xcd, 0x93,
+      0x17, 0xd0, 0xf4, 0x40, 0x5d, 0xd7, 0x22, 0x97, 0xb6, 0xab, 0xa0, 0xdf,
+      0xbc, 0x84, 0xe1, 0xc0, 0x42, 0xef, 0xf7, 0xa9, 0x9d, 0xf9, 0x8b, 0xf9,
+      0x71, 0x4a, 0xeb, 0x04, 0xf9, 0x13, 0x36, 0x12, 0x36, 0xf9, 0x05, 0xa1},
+     {0x00, 0x00, 0xa0, 0xa1, 0x29, 0x7e, 0xaf, 0xa7, 0x07, 0xa6, 0xe0, 0xfe,
+      0xb4, 0x0d, 0x98, 0x85, 0x97, 0x6f, 0x76, 0xdf, 0x76, 0xfa, 0xc7, 0x55,
+      0xdc, 0x8b, 0xda, 0x3b, 0x6a, 0x79, 0x8d, 0x68, 0xbd, 0xc4, 0x3a, 0xde,
+      0xe4, 0xa2, 0xf9, 0xce, 0x66, 0x7a, 0x69, 0x78, 0x33, 0xe5, 0x1c, 0x95,
+      0x54, 0xff, 0xa8, 0x2a, 0x42, 0xbb, 0x2a, 0x57, 0x2c, 0x5e, 0x26, 0x32,
+      0x4b, 0xba, 0x18, 0x97, 0x26, 0x61, 0xe0, 0xc9, 0xbf, 0x28, 0xdc, 0x25,
+      0x2c, 0x8a, 0x83, 0x30, 0x37, 0x11, 0xb7, 0x16, 0xfe, 0xbe, 0x68, 0x41,
+      0x56, 0x56, 0x2e, 0x58, 0x6f, 0x4e, 0xce, 0x4d, 0x05, 0xbe, 0x9f, 0xf3}},
+    {{0x00, 0x00, 0xb5, 0x05, 0x69, 0xec, 0xdb, 0x23, 0xcb, 0x54, 0xc7, 0xb2,
+      0x23, 0xd5, 0x61, 0x36, 0xb5, 0xda, 0x84, 0xc4, 0xff, 0x39, 0x84, 0xfa,
+      0x2f, 0xa0, 0x53, 0x34, 0x43, 0x66, 0xe7, 0x3a, 0x93, 0x68, 0xaa, 0x62,
+      0x65, 0x51, 0x61, 0xcf, 0xf7, 0x8f, 0xd6, 0x0d, 0xd0, 0x1b, 0xa9, 0x97,
+      0xe9, 0x3f, 0x2c, 0x21, 0xb3, 0x5d, 0x41, 0xad, 0x59, 0x0a, 0x05, 0x47,
+      0x35, 0xa3, 0xc0, 0x5f, 0x01, 0xd0, 0x4a, 0x18, 0xc4, 0x46, 0x3e, 0xb9,
+      0xe5, 0x41, 0x06, 0xad, 0x7f, 0xab, 0xce, 0xea, 0xbe, 0x97, 0x90, 0x1f,
+      0x95, 0xa7, 0x4f, 0x90, 0xda, 0x15, 0x1a, 0x1a, 0xf9, 0xa9, 0x09, 0xef},
+     {0x00, 0x00, 0x9b, 0xd4, 0x18, 0xe1, 0xe1, 0x51, 0xec, 0xd0, 0x59, 0x0a,
+      0x0b, 0x8c, 0x11, 0x97, 0x9e, 0xec, 0x4f, 0xb0, 0xc5, 0xe0, 0x04, 0xeb,
+      0x44, 0x2f, 0xa7, 0xf9, 0x3b, 0xbc, 0xbf, 0xa4, 0x35, 0xd9, 0xd0, 0xdd,
+      0xdb, 0xb8, 0x40, 0x0b, 0xe7, 0xcc, 0x9c, 0x0d, 0x3e, 0xcb, 0x25, 0xf1,
+      0xc1, 0x49, 0xf9, 0x3b, 0xbe, 0x7a, 0x39, 0x24, 0x5f, 0x11, 0x49, 0x19,
+      0x98, 0xb2, 0xde, 0xf0, 0x60, 0x73, 0x77, 0xdc, 0xaf, 0x40, 0x1d, 0xb4,
+      0xe6, 0x33, 0xa7, 0x2a, 0xd9, 0x67, 0xad, 0x7b, 0xf3, 0xc3, 0x25, 0xc7,
+      0xce, 0xf7, 0x7f, 0xc1, 0xf0, 0x18, 0x15, 0x67, 0x36, 0x49, 0xe3, 0x50},
+     {0x00, 0x00, 0x9c, 0x20, 0xd5, 0xde, 0x61, 0x1e, 0x91, 0x69, 0x5a, 0x44,
+      0xce, 0x63, 0x11, 0x7b, 0x41, 0x20, 0x64, 0x34, 0x2b, 0x3e, 0x8c, 0xf4,
+      0xe7, 0xa1, 0x94, 0xf1, 0x8c, 0x39, 0xc3, 0x48, 0x3a, 0x42, 0xaf, 0x8b,
+      0xd1, 0xda, 0xf9, 0x85, 0xc6, 0x2f, 0x55, 0x18, 0x83, 0x30, 0xf7, 0xb2,
+      0x89, 0x3c, 0xf2, 0x6a, 0xba, 0xda, 0x25, 0xcc, 0x83, 0x76, 0x17, 0xf3,
+      0xdc, 0x22, 0xe4, 0x3a, 0xc1, 0xfb, 0x36, 0x1b, 0x42, 0x8e, 0x21, 0x53,
+      0x28, 0x11, 0xb6, 0xdf, 0x33, 0x85, 0x48, 0x65, 0xac, 0xba, 0x2a, 0x14,
+      0xfb, 0x0c, 0xd9, 0xe8, 0x21, 0x10, 0x8f, 0x99, 0x25, 0x1f, 0x3e, 0x55}},
+    {{0x00, 0x01, 0x03, 0x31, 0xa1, 0xb1, 0xf8, 0x3b, 0xa0, 0xfc, 0xc2, 0x82,
+      0x09, 0x17, 0xda, 0x54, 0xfb, 0x01, 0x2b, 0x5f, 0x8d, 0xea, 0x2e, 0x1c,
+      0x19, 0x06, 0x70, 0xed, 0x2b, 0x55, 0x89, 0x66, 0x4d, 0xd3, 0x3c, 0x07,
+      0x9e, 0x26, 0x7a, 0x4d, 0xaf, 0x53, 0x62, 0x79, 0xc7, 0xd2, 0xda, 0x44,
+      0xe0, 0x41, 0xaa, 0x37, 0xc7, 0x35, 0xef, 0x68, 0xcd, 0x09, 0xa3, 0xf4,
+      0x36, 0x62, 0xfb, 0x93, 0x9b, 0x9f, 0x6b, 0x81, 0xe4, 0x99, 0xd6, 0x70,
+      0xb9, 0x22, 0x8a, 0x0d, 0xdb, 0x4b, 0xbc, 0x26, 0xfb, 0x5e, 0x6b, 0xd4,
+      0xbc, 0xac, 0x77, 0x7a, 0xbc, 0x48, 0x24, 0x14, 0x52, 0xc1, 0x68, 0xbd},
+     {0x00, 0x00, 0x28, 0xa3, 0xfa, 0x32, 0x91, 0x89, 0xf5, 0xbb, 0x9e, 0x45,
+      0x6c, 0x8c, 0x65, 0x4c, 0x08, 0x1c, 0xeb, 0x11, 0x2c, 0xfc, 0xa6, 0x09,
+      0x6f, 0x43, 0xab, 0x34, 0x9d, 0x96, 0x92, 0x7b, 0x29, 0xfe, 0x28, 0x4f,
+      0x10, 0xa1, 0xf5, 0x82, 0xc8, 0x8a, 0x10, 0x83, 0xbd, 0x58, 0x4b, 0x63,
+      0x2b, 0xa9, 0xbf, 0x54, 0xe4, 0x24, 0xab, 0x80, 0x9a, 0xa1, 0x9f, 0x05,
+      0xf2, 0xd7, 0x74, 0xf3, 0xeb, 0x23, 0x43, 0x03, 0x52, 0x7a, 0x64, 0x65,
+      0x5b, 0x4c, 0xe6, 0xe2, 0x70, 0xe6, 0xe3, 0x53, 0x8d, 0xa6, 0x25, 0x01,
+      0x3f, 0x7c, 0xdb, 0xc5, 0xd8, 0x0c, 0x80, 0x31, 0x13, 0x57, 0xb7, 0x58},
+     {0x00, 0x01, 0x66, 0x45, 0xda, 0xd6, 0x96, 0x72, 0xe5, 0xf0, 0xd4, 0x8b,
+      0x01, 0xfa, 0x6f, 0x08, 0x58, 0x54, 0xfc, 0x85, 0x45, 0x28, 0x62, 0x38,
+      0x7f, 0xe9, 0x27, 0x41, 0xe0, 0x1f, 0x1f, 0xe4, 0xbf, 0x81, 0xb1, 0xd0,
+      0xe1, 0xf5, 0x5b, 0xd7, 0xca, 0x86, 0x61, 0x4e, 0xe9, 0x34, 0x59, 0x1b,
+      0x23, 0x05, 0x4b, 0xf5, 0x3f, 0x47, 0xef, 0xe4, 0x92, 0x2f, 0x31, 0x8c,
+      0xb7, 0x39, 0x3b, 0x69, 0x23, 0x4f, 0x8d, 0xd5, 0x98, 0xca, 0x76, 0x50,
+      0xdd, 0x72, 0x50, 0x0d, 0x9d, 0xd9, 0xab, 0xb0, 0x75, 0x3e, 0xcb, 0x4b,
+      0xe2, 0x1d, 0x9b, 0xb9, 0xcd, 0x1e, 0x0e, 0xe5, 0x43, 0x7a, 0xd9, 0xe9}},
+    {{0x00, 0x00, 0x92, 0x33, 0xb5, 0xda, 0xed, 0x54, 0x74, 0xc8, 0x9f, 0x01,
+      0x80, 0xbc, 0xf9, 0xf5, 0x96, 0x7d, 0x30, 0x05, 0x36, 0x2f, 0xab, 0x8b,
+      0x02, 0x8b, 0x9d, 0xa9, 0xa9, 0xcf, 0x99, 0x61, 0xea, 0xbb, 0x5c, 0x50,
+      0x2b, 0xd7, 0xfb, 0x9a, 0x56, 0xc3, 0x93, 0x63, 0xf2, 0x69, 0x64, 0x93,
+      0x66, 0x49, 0x85, 0x0b, 0xaa, 0xe9, 0xcc, 0x30, 0x6e, 0xa1, 0x84, 0xf7,
+      0x03, 0xfa, 0x3a, 0xf4, 0xe4, 0x42, 0xa6, 0xdb, 0xf9, 0xf3, 0xd0, 0x87,
+      0xb2, 0x6b, 0xa3, 0x24, 0xa9, 0x43, 0x82, 0x27, 0xd1, 0x40, 0xb0, 0x64,
+      0x50, 0xe7, 0x07, 0xe1, 0xe8, 0x7b, 0x71, 0x0a, 0xe5, 0x85, 0xbd, 0x26},
+     {0x00, 0x01, 0x73, 0x8d, 0x90, 0xe7, 0x72, 0x59, 0x33, 0x0c, 0x80, 0xda,
+      0x21, 0xaa, 0xc9, 0x96, 0x6d, 0x3f, 0x5d, 0x9c, 0x0f, 0x52, 0x0d, 0x24,
+      0x89, 0xb5, 0x56, 0x01, 0x0c, 0x43, 0xf9, 0x1b, 0x92, 0xb6, 0x68, 0x00,
+      0x78, 0x53, 0xd1, 0x6f, 0x94, 0x5e, 0x8b, 0x9d, 0x2f, 0x93, 0x8e, 0x72,
+      0x95, 0x78, 0x08, 0xd7, 0xe5, 0x42, 0x50, 0xd7, 0xd2, 0xdd, 0x64, 0xe6,
+      0x29, 0xf8, 0x86, 0x8e, 0xa1, 0xfd, 0x00, 0x02, 0xef, 0xde, 0x7c, 0x8c,
+      0x2a, 0x17, 0xde, 0x61, 0x63, 0x42, 0xfa, 0x30, 0x2d, 0x4e, 0x98, 0x89,
+      0xd7, 0x71, 0x60, 0x8c, 0x85, 0x39, 0xaa, 0x7c, 0x7f, 0x21, 0xb9, 0x82},
+     {0x00, 0x00, 0xc8, 0x70, 0x40, 0x13, 0xd6, 0xce, 0x6a, 0x21, 0xb9, 0xed,
+      0x32, 0x94, 0xd7, 0xdb, 0x95, 0x67, 0x36, 0xae, 0x58, 0x96, 0x0e, 0xc5,
+      0x03, 0x65, 0x67, 0x14, 0xb4, 0x41, 0xbc, 0x83, 0x0f, 0xb2, 0xa6, 0xd3,
+      0x0e, 0x96, 0xf5, 0x23, 0x46, 0x55, 0x65, 0x94, 0x77, 0xfd, 0xa1, 0xcc,
+      0x19, 0xc9, 0x46, 0xad, 0x4d, 0xe0, 0x18, 0x53, 0xa5, 0x65, 0x59, 0xd2,
+      0x77, 0x64, 0x31, 0x05, 0x85, 0x43, 0xbe, 0x2f, 0x9f, 0x6e, 0xd7, 0xf7,
+      0x2a, 0x0f, 0x80, 0xef, 0x37, 0x47, 0x79, 0x3f, 0x99, 0x09, 0xea, 0xa9,
+      0x59, 0xf6, 0x7a, 0x7c, 0x56, 0x85, 0x9e, 0x88, 0x29, 0x8e, 0x08, 0xee}},
+    {{0x00, 0x00, 0xbe, 0xcb, 0x4d, 0xab, 0x9d, 0x45, 0xab, 0x9c, 0xde, 0xb0,
+      0x94, 0xe2, 0xb5, 0x5e, 0x8b, 0xd8, 0x4c, 0xce, 0x27, 0x8e, 0x62, 0xe3,
+      0xe9, 0xe8, 0xa6, 0x15, 0x3c, 0xbe, 0x64, 0x26, 0xba, 0xcf, 0x9e, 0x65,
+      0x6e, 0x6f, 0x27, 0xdf, 0x94, 0xe4, 0x6c, 0x88, 0x9d, 0xe5, 0x09, 0xef,
+      0x3c, 0x10, 0x6a, 0x84, 0xee, 0x0c, 0xfe, 0x03, 0x26, 0xff, 0xd0, 0xbe,
+      0x04, 0xa9, 0x58, 0xb4, 0x40, 0x9d, 0x84, 0x3a, 0xaa, 0xfd, 0x29, 0x9f,
+      0x31, 0x05, 0xa6, 0x9e, 0x90, 0xdd, 0xb9, 0x17, 0xe7, 0x8b, 0xe5, 0x81,
+      0x67, 0x27, 0x2a, 0x20, 0xd3, 0xa2, 0xcb, 0xdb, 0x9f, 0xc5, 0x79, 0x91},
+     {0x00, 0x01, 0xc4, 0x16, 0xdf, 0x91, 0xd1, 0x3f, 0x78, 0x50, 0x8e, 0x26,
+      0x0b, 0x0e, 0x6d, 0x29, 0xe4, 0xc7, 0x77, 0x9e, 0x9a, 0xa0, 0xeb, 0xed,
+      0x00, 0x6a, 0xd3, 0x20, 0xad, 0x33, 0x8b, 0x7b, 0x30, 0x12, 0x88, 0x8e,
+      0xd0, 0x30, 0xa1, 0xed, 0xa2, 0xb2, 0x54, 0xe6, 0x4f, 0x15, 0x1d, 0x82,
+      0x4a, 0xf6, 0x46, 0x3f, 0xdf, 0x0c, 0x59, 0x74, 0x89, 0xa8, 0x78, 0x5c,
+      0xfc, 0x94, 0x7b, 0xec, 0x06, 0xac, 0xc2, 0xb7, 0xa0, 0x65, 0x86, 0x63,
+      0x3e, 0x4b, 0x93, 0xd6, 0x06, 0x41, 0x16, 0x93, 0x09, 0x26, 0xd2, 0x77,
+      0x37, 0x85, 0x25, 0x48, 0xcc, 0x24, 0x12, 0xdb, 0xfb, 0x42, 0x6e, 0x49},
+     {0x00, 0x01, 0x8c, 0xd9, 0x5c, 0xfb, 0x48, 0x6c, 0x35, 0xf1, 0xa5, 0x66,
+      0x79, 0x5a, 0x93, 0x04, 0xb7, 0x09, 0xad, 0x38, 0x00, 0x4a, 0xcd, 0x89,
+      0x68, 0x53, 0x38, 0x56, 0xce, 0x1e, 0xef, 0xf9, 0x6f, 0x64, 0x91, 0xbe,
+      0xe1, 0xf5, 0xd8, 0x82, 0xde, 0xd1, 0x46, 0x69, 0xa6, 0xc9, 0x2b, 0xa1,
+      0x6f, 0xd2, 0xda, 0xfb, 0x82, 0xe5, 0x47, 0x98, 0x09, 0x07, 0xe7, 0x4b,
+      0x15, 0xaf, 0x50, 0xea, 0xaf, 0x2f, 0x06, 0xa6, 0x35, 0x6a, 0x5c, 0x15,
+      0x2a, 0xe5, 0xea, 0x08, 0x90, 0x52, 0x2c, 0xae, 0xfd, 0x20, 0xbb, 0x02,
+      0x6d, 0x32, 0x60, 0xd7, 0x20, 0xe7, 0xe5, 0xad, 0x4d, 0xc0, 0x3f, 0xc7}},
+    {{0x00, 0x00, 0x16, 0x92, 0x31, 0xf0, 0x31, 0x2d, 0xfa, 0xf3, 0x07, 0x8b,
+      0x4e, 0x58, 0xb2, 0x1e, 0xa7, 0xf1, 0xc7, 0x7e, 0x40, 0x89, 0x02, 0x8e,
+      0x29, 0x19, 0x01, 0xa0, 0x15, 0xaf, 0x42, 0x90, 0x6f, 0x8a, 0x27, 0x44,
+      0xb9, 0x1f, 0x76, 0x52, 0xa1, 0xee, 0x10, 0x62, 0xa1, 0x9b, 0x87, 0xc9,
+      0x94, 0x31, 0x2b, 0x5b, 0xef, 0x50, 0x5d, 0x19, 0x91, 0x94, 0x95, 0x3a,
+      0x6d, 0xda, 0xcd, 0xf2, 0xb8, 0x7c, 0x4b, 0x0d, 0xe8, 0xc6, 0x0a, 0xa5,
+      0x4f, 0x65, 0x6c, 0xb6, 0xe7, 0x17, 0xc6, 0x59, 0x18, 0xdd, 0x28, 0x11,
+      0x77, 0x63, 0xfe, 0xc2, 0xc3, 0x65, 0x08, 0xca, 0x5c, 0x7a, 0x69, 0x88},
+     {0x00, 0x01, 0xab, 0xf0, 0x3a, 0x53, 0x85, 0xa2, 0x2e, 0xb4, 0x49, 0xf4,
+      0xd5, 0x8f, 0x01, 0xb3, 0xc9, 0x1b, 0x08, 0x4e, 0x40, 0x0c, 0xc4, 0x00,
+      0x6d, 0xee, 0xc2, 0xf5, 0x9a, 0xef, 0x97, 0xdd, 0x8c, 0x47, 0x5b, 0xf3,
+      0x54, 0x46, 0xe7, 0x9c, 0x67, 0x79, 0xe8, 0x67, 0x4b, 0x63, 0xd5, 0x82,
+      0xab, 0xbf, 0xb5, 0x6f, 0xfe, 0x89, 0x2d, 0xa3, 0x3e, 0xba, 0xd5, 0x25,
+      0xa1, 0x47, 0x44, 0x54, 0xb8, 0x91, 0xca, 0xea, 0x82, 0xb8, 0x1a, 0x15,
+      0x49, 0x7f, 0x21, 0x61, 0xee, 0xc7, 0xee, 0x44, 0xee, 0x30, 0xb7, 0x4e,
+      0x8f, 0x42, 0x39, 0xee, 0xf4, 0x64, 0x51, 0x65, 0xeb, 0xc5, 0x7e, 0x1c},
+     {0x00, 0x00, 0x9f, 0x10, 0x15, 0x5d, 0xdd, 0x84, 0x24, 0x94, 0xd8, 0x77,
+      0x64, 0xa9, 0x41, 0x41, 0x15, 0xeb, 0x0a, 0x07, 0x5f, 0x08, 0x4b, 0x8b,
+      0xb9, 0xd9, 0x80, 0xb1, 0xbf, 0xac, 0x26, 0x2f, 0x4a, 0x2d, 0x73, 0x14,
+      0xa4, 0x33, 0xec, 0x36, 0x0d, 0xe5, 0x8a, 0x74, 0x69, 0xfa, 0x93, 0x68,
+      0x69, 0xce, 0x89, 0x65, 0x17, 0x8d, 0xf6, 0x3c, 0x96, 0xbd, 0x83, 0xea,
+      0x3a, 0xdf, 0xfb, 0xf1, 0x55, 0x9e, 0x04, 0xdf, 0xb0, 0xf6, 0x2b, 0x0e,
+      0xa5, 0xd0, 0xbe, 0x1f, 0x6d, 0xb8, 0x1a, 0x58, 0xca, 0xa6, 0x57, 0xca,
+      0x4d, 0x3c, 0x78, 0x46, 0x45, 0x98, 0x27, 0xb5, 0x7e, 0xd2, 0x4a, 0x52}}};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed MDS_U[sponge_size][sponge_size] = {
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x933c7b7cb99e8143, 0x1d9a97d7a0cdd97c, 0x84aaa9151eb101aa,
+      0xeae445215a0dad8e, 0x34d60001305c8f1b, 0x769f40c2291add55,
+      0xbd814fc213f04f7c, 0x04ed78a6109815ad, 0xf766f76af480e308,
+      0x65de0c0776f58be7, 0x482a33011baa5fb0, 0x000134561b8a8046},
+     {0x15fc76a583faca16, 0x1cc192a271b0aa91, 0x087b0b292780edbb,
+      0x0024c15ebebf8292, 0xb60f6e3faad4f923, 0xaa4659b4b46462c3,
+      0x82a2cb9fae39bd58, 0xc74c8e82b068c6a5, 0x9c6f686a7ae07152,
+      0x030815a447b6305f, 0x21bcc4aa152e0721, 0x00017e580208a7ad}},
+    {{0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0x90e755fc3bb806a9, 0x0cd9fb492b989005, 0x6e355486b7142280,
+      0x8e92c09a50658157, 0x3d3e21c58cf0ca69, 0xd0931cbe79e4d884,
+      0x36f994498d94afc2, 0xb6ba70f7accfeb16, 0xedb93ceab41a558d,
+      0x52ae8a63b27b6043, 0xd0e55eb8c0fd6da2, 0x000127712bfac6cd},
+     {0xcfcb468663f0beb7, 0xa2e95e282fdf74a7, 0x751486b61c0c8986,
+      0x79ca3146e8fb2e55, 0xe8431dffdf136e16, 0x23254cda1c2de8c9,
+      0xc4372d9db96118e6, 0x223f1c46a79f2d27, 0x10aa01849b4e7ab2,
+      0xfef9191c3a31bedc, 0xcf8ff36b08eef95b, 0x000131b53da4be5f}},
+    {{0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0xb5692b61229802b1, 0x8e99c181fc9d59f1, 0xf5bb34a077bf4475,
+      0xafdde99725af23a1, 0x9d02be504e3c2dea, 0xc9e7f90dd81ba37c,
+      0xb1edf5614c52ca2e, 0xec2d87c202f9bf02, 0x92fcf2a8b67bfecf,
+      0x7eb488cef2cf2fb3, 0x41fbdafbe0af9368, 0x00005d75a0c74db7}}};
+#else
+static const fe_packed MDS_U[sponge_size][sponge_size] = {
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x34, 0x56, 0x1b, 0x8a, 0x80, 0x46, 0x48, 0x2a, 0x33, 0x01,
+      0x1b, 0xaa, 0x5f, 0xb0, 0x65, 0xde, 0x0c, 0x07, 0x76, 0xf5, 0x8b, 0xe7,
+      0xf7, 0x66, 0xf7, 0x6a, 0xf4, 0x80, 0xe3, 0x08, 0x04, 0xed, 0x78, 0xa6,
+      0x10, 0x98, 0x15, 0xad, 0xbd, 0x81, 0x4f, 0xc2, 0x13, 0xf0, 0x4f, 0x7c,
+      0x76, 0x9f, 0x40, 0xc2, 0x29, 0x1a, 0xdd, 0x55, 0x34, 0xd6, 0x00, 0x01,
+      0x30, 0x5c, 0x8f, 0x1b, 0xea, 0xe4, 0x45, 0x21, 0x5a, 0x0d, 0xad, 0x8e,
+      0x84, 0xaa, 0xa9, 0x15, 0x1e, 0xb1, 0x01, 0xaa, 0x1d, 0x9a, 0x97, 0xd7,
+      0xa0, 0xcd, 0xd9, 0x7c, 0x93, 0x3c, 0x7b, 0x7c, 0xb9, 0x9e, 0x81, 0x43},
+     {0x00, 0x01, 0x7e, 0x58, 0x02, 0x08, 0xa7, 0xad, 0x21, 0xbc, 0xc4, 0xaa,
+      0x15, 0x2e, 0x07, 0x21, 0x03, 0x08, 0x15, 0xa4, 0x47, 0xb6, 0x30, 0x5f,
+      0x9c, 0x6f, 0x68, 0x6a, 0x7a, 0xe0, 0x71, 0x52, 0xc7, 0x4c, 0x8e, 0x82,
+      0xb0, 0x68, 0xc6, 0xa5, 0x82, 0xa2, 0xcb, 0x9f, 0xae, 0x39, 0xbd, 0x58,
+      0xaa, 0x46, 0x59, 0xb4, 0xb4, 0x64, 0x62, 0xc3, 0xb6, 0x0f, 0x6e, 0x3f,
+      0xaa, 0xd4, 0xf9, 0x23, 0x00, 0x24, 0xc1, 0x5e, 0xbe, 0xbf, 0x82, 0x92,
+      0x08, 0x7b, 0x0b, 0x29, 0x27, 0x80, 0xed, 0xbb, 0x1c, 0xc1, 0x92, 0xa2,
+      0x71, 0xb0, 0xaa, 0x91, 0x15, 0xfc, 0x76, 0xa5, 0x83, 0xfa, 0xca, 0x16}},
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x00, 0x01, 0x27, 0x71, 0x2b, 0xfa, 0xc6, 0xcd, 0xd0, 0xe5, 0x5e, 0xb8,
+      0xc0, 0xfd, 0x6d, 0xa2, 0x52, 0xae, 0x8a, 0x63, 0xb2, 0x7b, 0x60, 0x43,
+      0xed, 0xb9, 0x3c, 0xea, 0xb4, 0x1a, 0x55, 0x8d, 0xb6, 0xba, 0x70, 0xf7,
+      0xac, 0xcf, 0xeb, 0x16, 0x36, 0xf9, 0x94, 0x49, 0x8d, 0x94, 0xaf, 0xc2,
+      0xd0, 0x93, 0x1c, 0xbe, 0x79, 0xe4, 0xd8, 0x84, 0x3d, 0x3e, 0x21, 0xc5,
+      0x8c, 0xf0, 0xca, 0x69, 0x8e, 0x92, 0xc0, 0x9a, 0x50, 0x65, 0x81, 0x57,
+      0x6e, 0x35, 0x54, 0x86, 0xb7, 0x14, 0x22, 0x80, 0x0c, 0xd9, 0xfb, 0x49,
+      0x2b, 0x98, 0x90, 0x05, 0x90, 0xe7, 0x55, 0xfc, 0x3b, 0xb8, 0x06, 0xa9},
+     {0x00, 0x01, 0x31, 0xb5, 0x3d, 0xa4, 0xbe, 0x5f, 0xcf, 0x8f, 0xf3, 0x6b,
+      0x08, 0xee, 0xf9, 0x5b, 0xfe, 0xf9, 0x19, 0x1c, 0x3a, 0x31, 0xbe, 0xdc,
+      0x10, 0xaa, 0x01, 0x84, 0x9b, 0x4e, 0x7a, 0xb2, 0x22, 0x3f, 0x1c, 0x46,
+      0xa7, 0x9f, 0x2d, 0x27, 0xc4, 0x37, 0x2d, 0x9d, 0xb9, 0x61, 0x18, 0xe6,
+      0x23, 0x25, 0x4c, 0xda, 0x1c, 0x2d, 0xe8, 0xc9, 0xe8, 0x43, 0x1d, 0xff,
+      0xdf, 0x13, 0x6e, 0x16, 0x79, 0xca, 0x31, 0x46, 0xe8, 0xfb, 0x2e, 0x55,
+      0x75, 0x14, 0x86, 0xb6, 0x1c, 0x0c, 0x89, 0x86, 0xa2, 0xe9, 0x5e, 0x28,
+      0x2f, 0xdf, 0x74, 0xa7, 0xcf, 0xcb, 0x46, 0x86, 0x63, 0xf0, 0xbe, 0xb7}},
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x5d, 0x75, 0xa0, 0xc7, 0x4d, 0xb7, 0x41, 0xfb, 0xda, 0xfb,
+      0xe0, 0xaf, 0x93, 0x68, 0x7e, 0xb4, 0x88, 0xce, 0xf2, 0xcf, 0x2f, 0xb3,
+      0x92, 0xfc, 0xf2, 0xa8, 0xb6, 0x7b, 0xfe, 0xcf, 0xec, 0x2d, 0x87, 0xc2,
+      0x02, 0xf9, 0xbf, 0x02, 0xb1, 0xed, 0xf5, 0x61, 0x4c, 0x52, 0xca, 0x2e,
+      0xc9, 0xe7, 0xf9, 0x0d, 0xd8, 0x1b, 0xa3, 0x7c, 0x9d, 0x02, 0xbe, 0x50,
+      0x4e, 0x3c, 0x2d, 0xea, 0xaf, 0xdd, 0xe9, 0x97, 0x25, 0xaf, 0x23, 0xa1,
+      0xf5, 0xbb, 0x34, 0xa0, 0x77, 0xbf, 0x44, 0x75, 0x8e, 0x99, 0xc1, 0x81,
+      0xfc, 0x9d, 0x59, 0xf1, 0xb5, 0x69, 0x2b, 0x61, 0x22, 0x98, 0x02, 0xb1}}};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed MDS_L[sponge_size][sponge_size] = {
+    {{0xb99680147fff6f42, 0x4eb16817b589cea8, 0xa1ebd2d90c79e179,
+      0x0f725caec549c0da, 0xab0c4ee6d3e6dad4, 0x9fbca908de0ccb62,
+      0x320c3bb713338498, 0x598b4302d2f00a62, 0x4074c9cbfd8ca621,
+      0x0fa47edb3865e88c, 0x95455fb31ff9a195, 0x00007b479ec8e242},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+    {{0xf3582775679a5c07, 0xb485054374437084, 0x3828d6fb7e40ac77,
+      0x020877f63b940686, 0xf416c314ecf7bb3d, 0x6e44a478a8a8b76d,
+      0x712afdfcf8234a7f, 0xc47e735a4ba5a9be, 0x5c5578fed2c5f2b1,
+      0x1ba5da5fefb05d83, 0xebd5427d70b025f9, 0x00010a4d5b11a6c6},
+     {0xb99680147fff6f42, 0x4eb16817b589cea8, 0xa1ebd2d90c79e179,
+      0x0f725caec549c0da, 0xab0c4ee6d3e6dad4, 0x9fbca908de0ccb62,
+      0x320c3bb713338498, 0x598b4302d2f00a62, 0x4074c9cbfd8ca621,
+      0x0fa47edb3865e88c, 0x95455fb31ff9a195, 0x00007b479ec8e242},
+     {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+    {{0x04c14d472fc1b278, 0xa3956dfde7ada0cb, 0xc9a3f8e4d3730bc8,
+      0x346ba6ed8644dca7, 0x50e87c0b1a943b53, 0x3c5bfb4e6542deaf,
+      0xb7cddf7893eb329d, 0x964952d65171e3c5, 0xd5c51c3f70fbe1c1,
+      0xabf1ca1bb4c5bf85, 0x71eb3fa174b25a5f, 0x00010f282a5c6e6f},
+     {0x39a9d86546205f26, 0xabad946fe6b2d925, 0x93b052dc5681701b,
+      0x45567f368469361e, 0xdedee9c35231b5f7, 0xc70d879c1a8b2253,
+      0xa37a6602f456a31b, 0x0bc404145dfd870b, 0xae591711d681891e,
+      0xc04ee58d5d1e4322, 0x1ef697e9a1cb58dd, 0x00003346704d4482},
+     {0xb99680147fff6f42, 0x4eb16817b589cea8, 0xa1ebd2d90c79e179,
+      0x0f725caec549c0da, 0xab0c4ee6d3e6dad4, 0x9fbca908de0ccb62,
+      0x320c3bb713338498, 0x598b4302d2f00a62, 0x4074c9cbfd8ca621,
+      0x0fa47edb3865e88c, 0x95455fb31ff9a195, 0x00007b479ec8e242}}};
+#else
+static const fe_packed MDS_L[sponge_size][sponge_size] = {
+    {{0x00, 0x00, 0x7b, 0x47, 0x9e, 0xc8, 0xe2, 0x42, 0x95, 0x45, 0x5f, 0xb3,
+      0x1f, 0xf9, 0xa1, 0x95, 0x0f, 0xa4, 0x7e, 0xdb, 0x38, 0x65, 0xe8, 0x8c,
+      0x40, 0x74, 0xc9, 0xcb, 0xfd, 0x8c, 0xa6, 0x21, 0x59, 0x8b, 0x43, 0x02,
+      0xd2, 0xf0, 0x0a, 0x62, 0x32, 0x0c, 0x3b, 0xb7, 0x13, 0x33, 0x84, 0x98,
+      0x9f, 0xbc, 0xa9, 0x08, 0xde, 0x0c, 0xcb, 0x62, 0xab, 0x0c, 0x4e, 0xe6,
+      0xd3, 0xe6, 0xda, 0xd4, 0x0f, 0x72, 0x5c, 0xae, 0xc5, 0x49, 0xc0, 0xda,
+      0xa1, 0xeb, 0xd2, 0xd9, 0x0c, 0x79, 0xe1, 0x79, 0x4e, 0xb1, 0x68, 0x17,
+      0xb5, 0x89, 0xce, 0xa8, 0xb9, 0x96, 0x80, 0x14, 0x7f, 0xff, 0x6f, 0x42},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+    {{0x00, 0x01, 0x0a, 0x4d, 0x5b, 0x11, 0xa6, 0xc6, 0xeb, 0xd5, 0x42, 0x7d,
+      0x70, 0xb0, 0x25, 0xf9, 0x1b, 0xa5, 0xda, 0x5f, 0xef, 0xb0, 0x5d, 0x83,
+      0x5c, 0x55, 0x78, 0xfe, 0xd2, 0xc5, 0xf2, 0xb1, 0xc4, 0x7e, 0x73, 0x5a,
+      0x4b, 0xa5, 0xa9, 0xbe, 0x71, 0x2a, 0xfd, 0xfc, 0xf8, 0x23, 0x4a, 0x7f,
+      0x6e, 0x44, 0xa4, 0x78, 0xa8, 0xa8, 0xb7, 0x6d, 0xf4, 0x16, 0xc3, 0x14,
+      0xec, 0xf7, 0xbb, 0x3d, 0x02, 0x08, 0x77, 0xf6, 0x3b, 0x94, 0x06, 0x86,
+      0x38, 0x28, 0xd6, 0xfb, 0x7e, 0x40, 0xac, 0x77, 0xb4, 0x85, 0x05, 0x43,
+      0x74, 0x43, 0x70, 0x84, 0xf3, 0x58, 0x27, 0x75, 0x67, 0x9a, 0x5c, 0x07},
+     {0x00, 0x00, 0x7b, 0x47, 0x9e, 0xc8, 0xe2, 0x42, 0x95, 0x45, 0x5f, 0xb3,
+      0x1f, 0xf9, 0xa1, 0x95, 0x0f, 0xa4, 0x7e, 0xdb, 0x38, 0x65, 0xe8, 0x8c,
+      0x40, 0x74, 0xc9, 0xcb, 0xfd, 0x8c, 0xa6, 0x21, 0x59, 0x8b, 0x43, 0x02,
+      0xd2, 0xf0, 0x0a, 0x62, 0x32, 0x0c, 0x3b, 0xb7, 0x13, 0x33, 0x84, 0x98,
+      0x9f, 0xbc, 0xa9, 0x08, 0xde, 0x0c, 0xcb, 0x62, 0xab, 0x0c, 0x4e, 0xe6,
+      0xd3, 0xe6, 0xda, 0xd4, 0x0f, 0x72, 0x5c, 0xae, 0xc5, 0x49, 0xc0, 0xda,
+      0xa1, 0xeb, 0xd2, 0xd9, 0x0c, 0x79, 0xe1, 0x79, 0x4e, 0xb1, 0x68, 0x17,
+      0xb5, 0x89, 0xce, 0xa8, 0xb9, 0x96, 0x80, 0x14, 0x7f, 0xff, 0x6f, 0x42},
+     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+    {{0x00, 0x01, 0x0f, 0x28, 0x2a, 0x5c, 0x6e, 0x6f, 0x71, 0xeb, 0x3f, 0xa1,
+      0x74, 0xb2, 0x5a, 0x5f, 0xab, 0xf1, 0xca, 0x1b, 0xb4, 0xc5, 0xbf, 0x85,
+      0xd5, 0xc5, 0x1c, 0x3f, 0x70, 0xfb, 0xe1, 0xc1, 0x96, 0x49, 0x52, 0xd6,
+      0x51, 0x71, 0xe3, 0xc5, 0xb7, 0xcd, 0xdf, 0x78, 0x93, 0xeb, 0x32, 0x9d,
+      0x3c, 0x5b, 0xfb, 0x4e, 0x65, 0x42, 0xde, 0xaf, 0x50, 0xe8, 0x7c, 0x0b,
+      0x1a, 0x94, 0x3b, 0x53, 0x34, 0x6b, 0xa6, 0xed, 0x86, 0x44, 0xdc, 0xa7,
+      0xc9, 0xa3, 0xf8, 0xe4, 0xd3, 0x73, 0x0b, 0xc8, 0xa3, 0x95, 0x6d, 0xfd,
+      0xe7, 0xad, 0xa0, 0xcb, 0x04, 0xc1, 0x4d, 0x47, 0x2f, 0xc1, 0xb2, 0x78},
+     {0x00, 0x00, 0x33, 0x46, 0x70, 0x4d, 0x44, 0x82, 0x1e, 0xf6, 0x97, 0xe9,
+      0xa1, 0xcb, 0x58, 0xdd, 0xc0, 0x4e, 0xe5, 0x8d, 0x5d, 0x1e, 0x43, 0x22,
+      0xae, 0x59, 0x17, 0x11, 0xd6, 0x81, 0x89, 0x1e, 0x0b, 0xc4, 0x04, 0x14,
+      0x5d, 0xfd, 0x87, 0x0b, 0xa3, 0x7a, 0x66, 0x02, 0xf4, 0x56, 0xa3, 0x1b,
+      0xc7, 0x0d, 0x87, 0x9c, 0x1a, 0x8b, 0x22, 0x53, 0xde, 0xde, 0xe9, 0xc3,
+      0x52, 0x31, 0xb5, 0xf7, 0x45, 0x56, 0x7f, 0x36, 0x84, 0x69, 0x36, 0x1e,
+      0x93, 0xb0, 0x52, 0xdc, 0x56, 0x81, 0x70, 0x1b, 0xab, 0xad, 0x94, 0x6f,
+      0xe6, 0xb2, 0xd9, 0x25, 0x39, 0xa9, 0xd8, 0x65, 0x46, 0x20, 0x5f, 0x26},
+     {0x00, 0x00, 0x7b, 0x47, 0x9e, 0xc8, 0xe2, 0x42, 0x95, 0x45, 0x5f, 0xb3,
+      0x1f, 0xf9, 0xa1, 0x95, 0x0f, 0xa4, 0x7e, 0xdb, 0x38, 0x65, 0xe8, 0x8c,
+      0x40, 0x74, 0xc9, 0xcb, 0xfd, 0x8c, 0xa6, 0x21, 0x59, 0x8b, 0x43, 0x02,
+      0xd2, 0xf0, 0x0a, 0x62, 0x32, 0x0c, 0x3b, 0xb7, 0x13, 0x33, 0x84, 0x98,
+      0x9f, 0xbc, 0xa9, 0x08, 0xde, 0x0c, 0xcb, 0x62, 0xab, 0x0c, 0x4e, 0xe6,
+      0xd3, 0xe6, 0xda, 0xd4, 0x0f, 0x72, 0x5c, 0xae, 0xc5, 0x49, 0xc0, 0xda,
+      0xa1, 0xeb, 0xd2, 0xd9, 0x0c, 0x79, 0xe1, 0x79, 0x4e, 0xb1, 0x68, 0x17,
+      0xb5, 0x89, 0xce, 0xa8, 0xb9, 0x96, 0x80, 0x14, 0x7f, 0xff, 0x6f, 0x42}}};
+#endif
+
+// partial rounds, see partial_rounds_opt
+#if defined(CODA_HOST)
+static const fe_packed partial_round_keys[partial_rounds] = {
+    {0x0b41587c6d4f74c0, 0x41a7185c738ecf77, 0x64268a5adc24d3d6,
+     0x6d7510ec545c089f, 0xe7345f557019a182, 0x2e4ded0d38277ff4,
+     0xe0b8f7ba48b1a0da, 0xfb25372b95272fc7, 0x4fc24d2989455510,
+     0x89eea59698da0ede, 0x0a6642988d01537e, 0x00019903b9314ba1},
+    {0xcf7381927bc739d0, 0x447383eeb153c1ca, 0x80608d9ff9b6b908,
+     0xe326910c1d193466, 0x3cb8764ffa7afab5, 0xa2ac5722844d0895,
+     0x499552554aca9b8c, 0x25f8c8762aae734f, 0xd51112f1c7b5f6a2,
+     0x9150fd0ee1889b89, 0x8e2c77243ccef52f, 0x000195d0e5be21ee},
+    {0x8354c4de3ac5f762, 0x7acd5455ef5d4c52, 0xf7ae711a5c4983ee,
+     0x38cfd4be0626f769, 0xa6fe3513abfab322, 0xabbdff19acadd71b,
+     0xf8123dac479a168c, 0x566a50a258a18ca8, 0xcaa5124466fc1b5b,
+     0x09f92a8a778ff12f, 0x51f09b7f1b9c942d, 0x000194a3327d7347},
+    {0xf4a2ca1d9135dbf2, 0x13e72daa4c4d3fa4, 0x84739bd7910a1596,
+     0xdf5e364af13a0b7d, 0x3095549d6c91ac12, 0xec85188a392a2844,
+     0x768e7ffd70b98337, 0xd2286c73e19c1cf7, 0xfeac0263ccd8fa03,
+     0xe72e1467cba8e7e1, 0xb681d7c7cbb32842, 0x0000d56895c3f59a},
+    {0x4c5ec931d85073c8, 0x19a15bb538e9880b, 0x5c24fdbaeec08835,
+     0x07ab23cbe4164953, 0x2e330f9c319e175b, 0x72efb198322bd93f,
+     0x14645843ee38ba36, 0x526e3c5e6b1792ec, 0xfaff6e2c8d317c46,
+     0x572465bcd6333b8f, 0x4a4186b28e474606, 0x0000e59912aa8e3c},
+    {0x29ee987920224a64, 0x99b3e757fe95886c, 0xcab760988f6bb48d,
+     0xf98f45ecb059d11f, 0x8172444a522bd01b, 0xd96334fd7ac7fc6b,
+     0x3343912d58b7c1c8, 0x7ff79b263587baf1, 0xf5a37431b21c6f7a,
+     0xe8e0980009935736, 0x6c60662c3d876943, 0x00015d6285f3cc9d},
+    {0x295494d2bb8b30a6, 0x4f1aae67ff162a51, 0x920251551e67762f,
+     0x6a54031cd3a24029, 0xa66a2ce8eaacc31f, 0x7996cd7c1ff280d1,
+     0xf6b94a90e59be959, 0x696bb9766f59e314, 0xdf275ed1e6e7a74f,
+     0xf63aaa4114095d48, 0xa5825a49bd0dfd44, 0x00017d93959ca547},
+    {0x8a40ee3db59a1d3f, 0x5265488920988b04, 0xba5fa64b7823fead,
+     0x07ed11f806d01c20, 0xb47eabb8adc617cb, 0x2109341acc1c7aab,
+     0x6e53e206ec20cdd3, 0xe912cfc2e6ffdbcb, 0x40597e067272049c,
+     0x76a90d9fa727a9a6, 0x4f78e90c24e9d9bd, 0x0000a7e74312228a},
+    {0x0cf2e870cc6573e0, 0xa6e2ece5187e02a1, 0x40de85be84a0ba72,
+     0x3de59a38d5bbdf0b, 0x397b2bf69e6fe2a0, 0xa0b5052248d9d85b,
+     0x52a39d13205e1eab, 0x213d2330070352c7, 0x8ff334864996f1bf,
+     0xc58e16acba0c3d55, 0x25f13e9473c92609, 0x0001042c3eab9dc7},
+    {0x2e85d1b107fea274, 0x23a66ef12b3f6e00, 0x8ac12af27f13e736,
+     0x0a985dfb8bd8ed6a, 0x2b3b6e844d86bb6b, 0xcaf36782d0fd128e,
+     0x6f7cab970e3be407, 0x7e84ee9549c20755, 0xc12671d744295915,
+     0x9de9d299e4cfbe3b, 0xd31d7e79c67ab267, 0x000146cff874c176},
+    {0xe41cb3333ecbb070, 0xe9d6e620671a2fb5, 0x34c03fdcefa0e617,
+     0xbae6f3f8d1c4a3cc, 0xa21ac73e57cb8c6b, 0xa5faa1d20d75409e,
+     0xa638e2069197e7b0, 0xb9fde3b0445487ef, 0x53647ec82b20b9b8,
+     0x7be5f68b639556c7, 0x2c9a2e7375c97b98, 0x00011d617bbbb0dc},
+    {0x7868e06b7cbcfe13, 0xbcca961617ac833a, 0xc11b4b5fb9b1b231,
+     0x36482b2fac4c1334, 0xa239e9fe18aa695a, 0xc4fe10c76874893e,
+     0xa9507f392a3bf1dd, 0x3d0198c3b639b5c2, 0x3dbbde085a563415,
+     0xce5a3c45d6e65ef6, 0x057fdc33a382855c, 0x00005db9ec77074f},
+    {0x9e0407f3421a65b0, 0xe565f1acd905031e, 0xbf7b9024f6b1241f,
+     0x5e462b80c8445157, 0x87ab0432439e383b, 0x00ebfb9d9115ffc3,
+     0x7fb4e7919734e9c4, 0x4255ec590a6bc7bb, 0xfc5c6a13ddf5f916,
+     0x8f5a3ca9ebd16235, 0xda206f11a22f432d, 0x0001b9384969c322},
+    {0x0f02180d68cfe173, 0xc39811c9bdd38cbf, 0x9a75977c29c0e076,
+     0xf450586edaa7a4ce, 0xc95d13f5be02c0c8, 0xc77a356d9e15af20,
+     0xe39e84bd514451bb, 0xc9be2df8ae84fd30, 0x879c8581150f5f32,
+     0xa306c77bb4d3499a, 0x8e61d131a01de777, 0x00016a12e8ff0db0},
+    {0x80331a2f82a05229, 0x09bdfb5928520b1b, 0x0c201bcfd3aa7f68,
+     0x1a87163dd6886f3e, 0x76b0e0d548fafc2d, 0x25abe02641be3fc8,
+     0xee239feaf962ee46, 0xf496510e3c53c354, 0xbb977b98559d407f,
+     0xbf67ac2538177946, 0xccebfda986c0d8c6, 0x00007fadb6efb16d},
+    {0x09dead2c11246e20, 0xccf90e1cc5dda5fa, 0x488be5ae26e414d6,
+     0x4740eaec7e0efa93, 0x316cec89e2fa8e62, 0x620a4267877faeb7,
+     0xc7c6371057ad8151, 0xeae7d99a1d6ac6f8, 0x6081831543169123,
+     0xba69b04d59f4bc32, 0xdf0732b8895c9c9c, 0x00001acbca2881c5},
+    {0xbba04a804c22e1c7, 0x84c59904b0bdeaa2, 0x58dc57ec8ba96a49,
+     0xcc8ea40bda507439, 0xd698ffa5d516fe03, 0x81c24318d937bdd7,
+     0x2373b3950576be27, 0xa4979e1c000e47eb, 0xbcf80da7d5d64b8a,
+     0x200e0f961833083e, 0x2ed5c9529a905d17, 0x00006b48d19df2e8},
+    {0xfa24cf34ee82fd6e, 0x28563bbe701b48f0, 0x7958981f8e0aa1ee,
+     0xd9bb8b7e91a10762, 0x6b0a770f45dfcc81, 0x6c947674521e90c2,
+     0xc8b73c5064b37beb, 0x4d5807a22e681cd1, 0x0c3e9b6bae29ba19,
+     0xdf9146f26be6cb85, 0xed0ee1d6ff728f25, 0x0001aaa47177c55f},
+    {0x1a643a1073c70ff1, 0x1d4f89d93df327eb, 0x5f7cda34349d899a,
+     0x85245b0d247a6208, 0x36fe2d5178723ec4, 0x6cbdb488a1b6b01e,
+     0xda94ff8ac7d2bbd9, 0x8fea99fa809ccd39, 0x95b54aa0a3894b02,
+     0xd7a2f21a02988edd, 0x9379e887910c7b25, 0x00018c25ce3bede9},
+    {0x5c2230de1a3e10d3, 0xae0ebb9d10e86eb3, 0x03bbe2a9e671be55,
+     0xaa31eeb023dc0525, 0x0fbb786f00749243, 0xd9df5c1804a54855,
+     0x13c939a3652c406d, 0x8097b47984a8fabd, 0x246804d681427748,
+     0xce7669affc8ab3b4, 0x1f851cc8c523e347, 0x0000703b48df495f},
+    {0x0e62aa06d9d4372c, 0x01a170695ddc1ad1, 0x1045d324df663615,
+     0x4253f39e245ff426, 0x874b26519254cb22, 0xfbb0b0cc5873acf8,
+     0xad5b64c89303bffc, 0x56aed32d33b11ccc, 0xd8ccc7db2db0f65d,
+     0x955b4348fe0641a4, 0x671aff362ea06753, 0x000025d8e05ac4f7},
+    {0xfe63b9a9045155d5, 0x1096591440236a9a, 0xab0be53f34c14a90,
+     0xa07120e73710c89b, 0xcd8792f9b19f31f4, 0xb0509141e669b923,
+     0x46138ae6e3906fbb, 0xe264d0cde8f688e3, 0x96ddbabec0e5312e,
+     0x0235358ba6e8ff72, 0xb9af35958e05db63, 0x0000e51fcfc23fda},
+    {0x8f0da9126a0a635d, 0xf0ea62d6d82527a4, 0xcd4eb0341fee014d,
+     0x9539d44fd89fcddc, 0x4f5189a1550500a2, 0x016af2f8c308665e,
+     0xb1de89a33c8ab6ba, 0xeb2fb0d4e71e47f2, 0x41936735b138cea5,
+     0xe76a47f210ba89b1, 0xa584c3cb167e90ad, 0x000031c48aebdd0d},
+    {0xed6c3d5f20a424a8, 0xcf89a7f6548856c1, 0xcbc643159a17bb58,
+     0xd204484e1feddb10, 0xee1fd5b349010a36, 0x761be046330e99a1,
+     0xf7e5efa7a735f2b7, 0xe12d3ec6e2c961d5, 0xbbc463e383f071ad,
+     0xefad7d3ca57636ff, 0x670bd76fa122136d, 0x0001946165c63a60},
+    {0x22d62e247debbce9, 0x7b2b0b4271842c8d, 0xec4c1fbfb90696f3,
+     0xae9d345e5ce18894, 0x6d2a191e4635722b, 0x9ee5f7cd236d240f,
+     0xd37bc84f01f632a2, 0x5e9c1a69d9d502c9, 0xfdd1f5d3b99e9128,
+     0x3b4aa03290149ea9, 0x17c3286bfc629006, 0x0001c3309ce82fff},
+    {0x91702753792f7523, 0x8aca8b4d9981924f, 0x4d17af0da94c6d59,
+     0x3b7f1e7856986eae, 0x1c1d7dac45812554, 0x4a7c666a4960b01a,
+     0x17af6bcbb890a9ff, 0xf83d76a84d3fa6c6, 0xaef77186a72c3c91,
+     0xe55fcef3798c4ac5, 0x63832c1b95522c1a, 0x00019ec253ffd379},
+    {0xb8150d122072d296, 0xfede405f013aeb6e, 0xb4e8e22fa9d203ab,
+     0xe285ff9da7ea83af, 0x3212553d5cce647b, 0xe247c7875e2f9a56,
+     0xf8897750efbb47e6, 0x4ac2f0b80fc84666, 0x430c62dbc1f7b868,
+     0xad0974887114abd1, 0xcfa0aff77106a814, 0x00002307d2f598e3},
+    {0xe2c4577a8bf4db1e, 0x9c85827077dc84ac, 0x420a3551cf6d805f,
+     0xda1d7e55ac0597e2, 0x456239a9d78877de, 0x7cd3ccfcdb99d460,
+     0xfe6103217bf42066, 0x3f89a59076d80892, 0x8b0560db8b04f768,
+     0xaba3c8feb2ea3068, 0x1871ddc89d5ffefc, 0x00001b92c7427cb8},
+    {0xbcfa3d1a7abf5001, 0x1a0a342de438776e, 0xc2136865b2a53740,
+     0x7a2baffba5a46b0d, 0x5919b8af7a476570, 0x8d3329599e3a02a5,
+     0xeebb78f841428f12, 0x3fe593d2d830f661, 0x1d4fb5eb48363844,
+     0xe0b0d9797fa1f2da, 0x0febca984057bbe0, 0x00005975caa0fae7},
+    {0x18de263396c7659f, 0x94e1b19441269b9a, 0xae9b06b3081fa611,
+     0xebdc73806852de7d, 0xd783f1db49f37b8e, 0x279c1e6a0d89bc86,
+     0x36fed0f0eeb27861, 0x225d8908ec0d62f3, 0x4283aec7d76b0251,
+     0xdb4fbc5ea3d135d3, 0x5044a91a18e6894c, 0x00002071fa1b6a11},
+    {0x560d3604eaffb1e0, 0xaef876e681906f3e, 0x6295e0c41edae6d7,
+     0x037ef0cbf8f5355c, 0xeb7441df967e7042, 0x20e1cb7643e37525,
+     0x26bc04eb692c7a29, 0x3decd0ce0583f4c8, 0xb872cceefaef4a27,
+     0xf21bc59a96333138, 0x711a9309af61d3ea, 0x0001a4ac7047f2fe},
+    {0x7242b682dd87551f, 0xe376d00c95c246de, 0x38b1463b395601b3,
+     0x2a73f1b07cace655, 0xbba2fa5562dda1c0, 0x9c313966c0435035,
+     0x893f9be0172c461e, 0xd4220a2ac3932033, 0x4e44dd5fb90051d2,
+     0x9478f5040c6133b6, 0x7063c8ff25909b24, 0x00008f04426bb4ad},
+    {0x264e8753b5cd3379, 0x337b080227c2b2b7, 0x8e0e7c1a7f35a0bc,
+     0xd512fc9a0ecb8a25, 0x159108eebd211246, 0x256684d4e585cf8b,
+     0xc5fdc382631e7d4d, 0x9341ba7b9bf6c87a, 0x54fb2e01765cfea1,
+     0xf13ce0b070ed259c, 0xad5ec87db3bc4256, 0x00001e24e0713b4b}};
+#else
+static const fe_packed partial_round_keys[partial_rounds] = {
+    {0x00, 0x01, 0x99, 0x03, 0xb9, 0x31, 0x4b, 0xa1, 0x0a, 0x66, 0x42, 0x98,
+     0x8d, 0x01, 0x53, 0x7e, 0x89, 0xee, 0xa5, 0x96, 0x98, 0xda, 0x0e, 0xde,
+     0x4f, 0xc2, 0x4d, 0x29, 0x89, 0x45, 0x55, 0x10, 0xfb, 0x25, 0x37, 0x2b,
+     0x95, 0x27, 0x2f, 0xc7, 0xe0, 0xb8, 0xf7, 0xba, 0x48, 0xb1, 0xa0, 0xda,
+     0x2e, 0x4d, 0xed, 0x0d, 0x38, 0x27, 0x7f, 0xf4, 0xe7, 0x34, 0x5f, 0x55,
+     0x70, 0x19, 0xa1, 0x82, 0x6d, 0x75, 0x10, 0xec, 0x54, 0x5c, 0x08, 0x9f,
+     0x64, 0x26, 0x8a, 0x5a, 0xdc, 0x24, 0xd3, 0xd6, 0x41, 0xa7, 0x18, 0x5c,
+     0x73, 0x8e, 0xcf, 0x77, 0x0b, 0x41, 0x58, 0x7c, 0x6d, 0x4f, 0x74, 0xc0},
+    {0x00, 0x01, 0x95, 0xd0, 0xe5, 0xbe, 0x21, 0xee, 0x8e, 0x2c, 0x77, 0x24,
+     0x3c, 0xce, 0xf5, 0x2f, 0x91, 0x50, 0xfd, 0x0e, 0xe1, 0x88, 0x9b, 0x89,
+     0xd5, 0x11, 0x12, 0xf1, 0xc7, 0xb5, 0xf6, 0xa2, 0x25, 0xf8, 0xc8, 0x76,
+     0x2a, 0xae, 0x73, 0x4f, 0x49, 0x95, 0x52, 0x55, 0x4a, 0xca, 0x9b, 0x8c,
+     0xa2, 0xac, 0x57, 0x22, 0x84, 0x4d, 0x08, 0x95, 0x3c, 0xb8, 0x76, 0x4f,
+     0xfa, 0x7a, 0xfa, 0xb5, 0xe3, 0x26, 0x91, 0x0c, 0x1d, 0x19, 0x34, 0x66,
+     0x80, 0x60, 0x8d, 0x9f, 0xf9, 0xb6, 0xb9, 0x08, 0x44, 0x73, 0x83, 0xee,
+     0xb1, 0x53, 0xc1, 0xca, 0xcf, 0x73, 0x81, 0x92, 0x7b, 0xc7, 0x39, 0xd0},
+    {0x00, 0x01, 0x94, 0xa3, 0x32, 0x7d, 0x73, 0x47, 0x51, 0xf0, 0x9b, 0x7f,
+     0x1b, 0x9c, 0x94, 0x2d, 0x09, 0xf9, 0x2a, 0x8a, 0x77, 0x8f, 0xf1, 0x2f,
+     0xca, 0xa5, 0x12, 0x44, 0x66, 0xfc, 0x1b, 0x5b, 0x56, 0x6a, 0x50, 0xa2,
+     0x58, 0xa1, 0x8c, 0xa8, 0xf8, 0x12, 0x3d, 0xac, 0x47, 0x9a, 0x16, 0x8c,
+     0xab, 0xbd, 0xff, 0x19, 0xac, 0xad, 0xd7, 0x1b, 0xa6, 0xfe, 0x35, 0x13,
+     0xab, 0xfa, 0xb3, 0x22, 0x38, 0xcf, 0xd4, 0xbe, 0x06, 0x26, 0xf7, 0x69,
+     0xf7, 0xae, 0x71, 0x1a, 0x5c, 0x49, 0x83, 0xee, 0x7a, 0xcd, 0x54, 0x55,
+     0xef, 0x5d, 0x4c, 0x52, 0x83, 0x54, 0xc4, 0xde, 0x3a, 0xc5, 0xf7, 0x62},
+    {0x00, 0x00, 0xd5, 0x68, 0x95, 0xc3, 0xf5, 0x9a, 0xb6, 0x81, 0xd7, 0xc7,
+     0xcb, 0xb3, 0x28, 0x42, 0xe7, 0x2e, 0x14, 0x67, 0xcb, 0xa8, 0xe7, 0xe1,
+     0xfe, 0xac, 0x02, 0x63, 0xcc, 0xd8, 0xfa, 0x03, 0xd2, 0x28, 0x6c, 0x73,
+     0xe1, 0x9c, 0x1c, 0xf7, 0x76, 0x8e, 0x7f, 0xfd, 0x70, 0xb9, 0x83, 0x37,
+     0xec, 0x85, 0x18, 0x8a, 0x39, 0x2a, 0x28, 0x44, 0x30, 0x95, 0x54, 0x9d,
+     0x6c, 0x91, 0xac, 0x12, 0xdf, 0x5e, 0x36, 0x4a, 0xf1, 0x3a, 0x0b, 0x7d,
+     0x84, 0x73, 0x9b, 0xd7, 0x91, 0x0a, 0x15, 0x96, 0x13, 0xe7, 0x2d, 0xaa,
+     0x4c, 0x4d, 0x3f, 0xa4, 0xf4, 0xa2, 0xca, 0x1d, 0x91, 0x35, 0xdb, 0xf2},
+    {0x00, 0x00, 0xe5, 0x99, 0x12, 0xaa, 0x8e, 0x3c, 0x4a, 0x41, 0x86, 0xb2,
+     0x8e, 0x47, 0x46, 0x06, 0x57, 0x24, 0x65, 0xbc, 0xd6, 0x33, 0x3b, 0x8f,
+     0xfa, 0xff, 0x6e, 0x2c, 0x8d, 0x31, 0x7c, 0x46, 0x52, 0x6e, 0x3c, 0x5e,
+     0x6b, 0x17, 0x92, 0xec, 0x14, 0x64, 0x58, 0x43, 0xee, 0x38, 0xba, 0x36,
+     0x72, 0xef, 0xb1, 0x98, 0x32, 0x2b, 0xd9, 0x3f, 0x2e, 0x33, 0x0f, 0x9c,
+     0x31, 0x9e, 0x17, 0x5b, 0x07, 0xab, 0x23, 0xcb, 0xe4, 0x16, 0x49, 0x53,
+     0x5c, 0x24, 0xfd, 0xba, 0xee, 0xc0, 0x88, 0x35, 0x19, 0xa1, 0x5b, 0xb5,
+     0x38, 0xe9, 0x88, 0x0b, 0x4c, 0x5e, 0xc9, 0x31, 0xd8, 0x50, 0x73, 0xc8},
+    {0x00, 0x01, 0x5d, 0x62, 0x85, 0xf3, 0xcc, 0x9d, 0x6c, 0x60, 0x66, 0x2c,
+     0x3d, 0x87, 0x69, 0x43, 0xe8, 0xe0, 0x98, 0x00, 0x09, 0x93, 0x57, 0x36,
+     0xf5, 0xa3, 0x74, 0x31, 0xb2, 0x1c, 0x6f, 0x7a, 0x7f, 0xf7, 0x9b, 0x26,
+     0x35, 0x87, 0xba, 0xf1, 0x33, 0x43, 0x91, 0x2d, 0x58, 0xb7, 0xc1, 0xc8,
+     0xd9, 0x63, 0x34, 0xfd, 0x7a, 0xc7, 0xfc, 0x6b, 0x81, 0x72, 0x44, 0x4a,
+     0x52, 0x2b, 0xd0, 0x1b, 0xf9, 0x8f, 0x45, 0xec, 0xb0, 0x59, 0xd1, 0x1f,
+     0xca, 0xb7, 0x60, 0x98, 0x8f, 0x6b, 0xb4, 0x8d, 0x99, 0xb3, 0xe7, 0x57,
+     0xfe, 0x95, 0x88, 0x6c, 0x29, 0xee, 0x98, 0x79, 0x20, 0x22, 0x4a, 0x64},
+    {0x00, 0x01, 0x7d, 0x93, 0x95, 0x9c, 0xa5, 0x47, 0xa5, 0x82, 0x5a, 0x49,
+     0xbd, 0x0d, 0xfd, 0x44, 0xf6, 0x3a, 0xaa, 0x41, 0x14, 0x09, 0x5d, 0x48,
+     0xdf, 0x27, 0x5e, 0xd1, 0xe6, 0xe7, 0xa7, 0x4f, 0x69, 0x6b, 0xb9, 0x76,
+     0x6f, 0x59, 0xe3, 0x14, 0xf6, 0xb9, 0x4a, 0x90, 0xe5, 0x9b, 0xe9, 0x59,
+     0x79, 0x96, 0xcd, 0x7c, 0x1f, 0xf2, 0x80, 0xd1, 0xa6, 0x6a, 0x2c, 0xe8,
+     0xea, 0xac, 0xc3, 0x1f, 0x6a, 0x54, 0x03, 0x1c, 0xd3, 0xa2, 0x40, 0x29,
+     0x92, 0x02, 0x51, 0x55, 0x1e, 0x67, 0x76, 0x2f, 0x4f, 0x1a, 0xae, 0x67,
+     0xff, 0x16, 0x2a, 0x51, 0x29, 0x54, 0x94, 0xd2, 0xbb, 0x8b, 0x30, 0xa6},
+    {0x00, 0x00, 0xa7, 0xe7, 0x43, 0x12, 0x22, 0x8a, 0x4f, 0x78, 0xe9, 0x0c,
+     0x24, 0xe9, 0xd9, 0xbd, 0x76, 0xa9, 0x0d, 0x9f, 0xa7, 0x27, 0xa9, 0xa6,
+     0x40, 0x59, 0x7e, 0x06, 0x72, 0x72, 0x04, 0x9c, 0xe9, 0x12, 0xcf, 0xc2,
+     0xe6, 0xff, 0xdb, 0xcb, 0x6e, 0x53, 0xe2, 0x06, 0xec, 0x20, 0xcd, 0xd3,
+     0x21, 0x09, 0x34, 0x1a, 0xcc, 0x1c, 0x7a, 0xab, 0xb4, 0x7e, 0xab, 0xb8,
+     0xad, 0xc6, 0x17, 0xcb, 0x07, 0xed, 0x11, 0xf8, 0x06, 0xd0, 0x1c, 0x20,
+     0xba, 0x5f, 0xa6, 0x4b, 0x78, 0x23, 0xfe, 0xad, 0x52, 0x65, 0x48, 0x89,
+     0x20, 0x98, 0x8b, 0x04, 0x8a, 0x40, 0xee, 0x3d, 0xb5, 0x9a, 0x1d, 0x3f},
+    {0x00, 0x01, 0x04, 0x2c, 0x3e, 0xab, 0x9d, 0xc7, 0x25, 0xf1, 0x3e, 0x94,
+     0x73, 0xc9, 0x26, 0x09, 0xc5, 0x8e, 0x16, 0xac, 0xba, 0x0c, 0x3d, 0x55,
+     0x8f, 0xf3, 0x34, 0x86, 0x49, 0x96, 0xf1, 0xbf, 0x21, 0x3d, 0x23, 0x30,
+     0x07, 0x03, 0x52, 0xc7, 0x52, 0xa3, 0x9d, 0x13, 0x20, 0x5e, 0x1e, 0xab,
+     0xa0, 0xb5, 0x05, 0x22, 0x48, 0xd9, 0xd8, 0x5b, 0x39, 0x7b, 0x2b, 0xf6,
+     0x9e, 0x6f, 0xe2, 0xa0, 0x3d, 0xe5, 0x9a, 0x38, 0xd5, 0xbb, 0xdf, 0x0b,
+     0x40, 0xde, 0x85, 0xbe, 0x84, 0xa0, 0xba, 0x72, 0xa6, 0xe2, 0xec, 0xe5,
+     0x18, 0x7e, 0x02, 0xa1, 0x0c, 0xf2, 0xe8, 0x70, 0xcc, 0x65, 0x73, 0xe0},
+    {0x00, 0x01, 0x46, 0xcf, 0xf8, 0x74, 0xc1, 0x76, 0xd3, 0x1d, 0x7e, 0x79,
+     0xc6, 0x7a, 0xb2, 0x67, 0x9d, 0xe9, 0xd2, 0x99, 0xe4, 0xcf, 0xbe, 0x3b,
+     0xc1, 0x26, 0x71, 0xd7, 0x44, 0x29, 0x59, 0x15, 0x7e, 0x84, 0xee, 0x95,
+     0x49, 0xc2, 0x07, 0x55, 0x6f, 0x7c, 0xab, 0x97, 0x0e, 0x3b, 0xe4, 0x07,
+     0xca, 0xf3, 0x67, 0x82, 0xd0, 0xfd, 0x12, 0x8e, 0x2b, 0x3b, 0x6e, 0x84,
+     0x4d, 0x86, 0xbb, 0x6b, 0x0a, 0x98, 0x5d, 0xfb, 0x8b, 0xd8, 0xed, 0x6a,
+     0x8a, 0xc1, 0x2a, 0xf2, 0x7f, 0x13, 0xe7, 0x36, 0x23, 0xa6, 0x6e, 0xf1,
+     0x2b, 0x3f, 0x6e, 0x00, 0x2e, 0x85, 0xd1, 0xb1, 0x07, 0xfe, 0xa2, 0x74},
+    {0x00, 0x01, 0x1d, 0x61, 0x7b, 0xbb, 0xb0, 0xdc, 0x2c, 0x9a, 0x2e, 0x73,
+     0x75, 0xc9, 0x7b, 0x98, 0x7b, 0xe5, 0xf6, 0x8b, 0x63, 0x95, 0x56, 0xc7,
+     0x53, 0x64, 0x7e, 0xc8, 0x2b, 0x20, 0xb9, 0xb8, 0xb9, 0xfd, 0xe3, 0xb0,
+     0x44, 0x54, 0x87, 0xef, 0xa6, 0x38, 0xe2, 0x06, 0x91, 0x97, 0xe7, 0xb0,
+     0xa5, 0xfa, 0xa1, 0xd2, 0x0d, 0x75, 0x40, 0x9e, 0xa2, 0x1a, 0xc7, 0x3e,
+     0x57, 0xcb, 0x8c, 0x6b, 0xba, 0xe6, 0xf3, 0xf8, 0xd1, 0xc4, 0xa3, 0xcc,
+     0x34, 0xc0, 0x3f, 0xdc, 0xef, 0xa0, 0xe6, 0x17, 0xe9, 0xd6, 0xe6, 0x20,
+     0x67, 0x1a, 0x2f, 0xb5, 0xe4, 0x1c, 0xb3, 0x33, 0x3e, 0xcb, 0xb0, 0x70},
+    {0x00, 0x00, 0x5d, 0xb9, 0xec, 0x77, 0x07, 0x4f, 0x05, 0x7f, 0xdc, 0x33,
+     0xa3, 0x82, 0x85, 0x5c, 0xce, 0x5a, 0x3c, 0x45, 0xd6, 0xe6, 0x5e, 0xf6,
+     0x3d, 0xbb, 0xde, 0x08, 0x5a, 0x56, 0x34, 0x15, 0x3d, 0x01, 0x98, 0xc3,
+     0xb6, 0x39, 0xb5, 0xc2, 0xa9, 0x50, 0x7f, 0x39, 0x2a, 0x3b, 0xf1, 0xdd,
+     0xc4, 0xfe, 0x10, 0xc7, 0x68, 0x74, 0x89, 0x3e, 0xa2, 0x39, 0xe9, 0xfe,
+     0x18, 0xaa, 0x69, 0x5a, 0x36, 0x48, 0x2b, 0x2f, 0xac, 0x4c, 0x13, 0x34,
+     0xc1, 0x1b, 0x4b, 0x5f, 0xb9, 0xb1, 0xb2, 0x31, 0xbc, 0xca, 0x96, 0x16,
+     0x17, 0xac, 0x83, 0x3a, 0x78, 0x68, 0xe0, 0x6b, 0x7c, 0xbc, 0xfe, 0x13},
+    {0x00, 0x01, 0xb9, 0x38, 0x49, 0x69, 0xc3, 0x22, 0xda, 0x20, 0x6f, 0x11,
+     0xa2, 0x2f, 0x43, 0x2d, 0x8f, 0x5a, 0x3c, 0xa9, 0xeb, 0xd1, 0x62, 0x35,
+     0xfc, 0x5c, 0x6a, 0x13, 0xdd, 0xf5, 0xf9, 0x16, 0x42, 0x55, 0xec, 0x59,
+     0x0a, 0x6b, 0xc7, 0xbb, 0x7f, 0xb4, 0xe7, 0x91, 0x97, 0x34, 0xe9, 0xc4,
+     0x00, 0xeb, 0xfb, 0x9d, 0x91, 0x15, 0xff, 0xc3, 0x87, 0xab, 0x04, 0x32,
+     0x43, 0x9e, 0x38, 0x3b, 0x5e, 0x46, 0x2b, 0x80, 0xc8, 0x44, 0x51, 0x57,
+     0xbf, 0x7b, 0x90, 0x24, 0xf6, 0xb1, 0x24, 0x1f, 0xe5, 0x65, 0xf1, 0xac,
+     0xd9, 0x05, 0x03, 0x1e, 0x9e, 0x04, 0x07, 0xf3, 0x42, 0x1a, 0x65, 0xb0},
+    {0x00, 0x01, 0x6a, 0x12, 0xe8, 0xff, 0x0d, 0xb0, 0x8e, 0x61, 0xd1, 0x31,
+     0xa0, 0x1d, 0xe7, 0x77, 0xa3, 0x06, 0xc7, 0x7b, 0xb4, 0xd3, 0x49, 0x9a,
+     0x87, 0x9c, 0x85, 0x81, 0x15, 0x0f, 0x5f, 0x32, 0xc9, 0xbe, 0x2d, 0xf8,
+     0xae, 0x84, 0xfd, 0x30, 0xe3, 0x9e, 0x84, 0xbd, 0x51, 0x44, 0x51, 0xbb,
+     0xc7, 0x7a, 0x35, 0x6d, 0x9e, 0x15, 0xaf, 0x20, 0xc9, 0x5d, 0x13, 0xf5,
+     0xbe, 0x02, 0xc0, 0xc8, 0xf4, 0x50, 0x58, 0x6e, 0xda, 0xa7, 0xa4, 0xce,
+     0x9a, 0x75, 0x97, 0x7c, 0x29, 0xc0, 0xe0, 0x76, 0xc3, 0x98, 0x11, 0xc9,
+     0xbd, 0xd3, 0x8c, 0xbf, 0x0f, 0x02, 0x18, 0x0d, 0x68, 0xcf, 0xe1, 0x73},
+    {0x00, 0x00, 0x7f, 0xad, 0xb6, 0xef, 0xb1, 0x6d, 0xcc, 0xeb, 0xfd, 0xa9,
+     0x86, 0xc0, 0xd8, 0xc6, 0xbf, 0x67, 0xac, 0x25, 0x38, 0x17, 0x79, 0x46,
+     0xbb, 0x97, 0x7b, 0x98, 0x55, 0x9d, 0x40, 0x7f, 0xf4, 0x96, 0x51, 0x0e,
+     0x3c, 0x53, 0xc3, 0x54, 0xee, 0x23, 0x9f, 0xea, 0xf9, 0x62, 0xee, 0x46,
+     0x25, 0xab, 0xe0, 0x26, 0x41, 0xbe, 0x3f, 0xc8, 0x76, 0xb0, 0xe0, 0xd5,
+     0x48, 0xfa, 0xfc, 0x2d, 0x1a, 0x87, 0x16, 0x3d, 0xd6, 0x88, 0x6f, 0x3e,
+     0x0c, 0x20, 0x1b, 0xcf, 0xd3, 0xaa, 0x7f, 0x68, 0x09, 0xbd, 0xfb, 0x59,
+     0x28, 0x52, 0x0b, 0x1b, 0x80, 0x33, 0x1a, 0x2f, 0x82, 0xa0, 0x52, 0x29},
+    {0x00, 0x00, 0x1a, 0xcb, 0xca, 0x28, 0x81, 0xc5, 0xdf, 0x07, 0x32, 0xb8,
+     0x89, 0x5c, 0x9c, 0x9c, 0xba, 0x69, 0xb0, 0x4d, 0x59, 0xf4, 0xbc, 0x32,
+     0x60, 0x81, 0x83, 0x15, 0x43, 0x16, 0x91, 0x23, 0xea, 0xe7, 0xd9, 0x9a,
+     0x1d, 0x6a, 0xc6, 0xf8, 0xc7, 0xc6, 0x37, 0x10, 0x57, 0xad, 0x81, 0x51,
+     0x62, 0x0a, 0x42, 0x67, 0x87, 0x7f, 0xae, 0xb7, 0x31, 0x6c, 0xec, 0x89,
+     0xe2, 0xfa, 0x8e, 0x62, 0x47, 0x40, 0xea, 0xec, 0x7e, 0x0e, 0xfa, 0x93,
+     0x48, 0x8b, 0xe5, 0xae, 0x26, 0xe4, 0x14, 0xd6, 0xcc, 0xf9, 0x0e, 0x1c,
+     0xc5, 0xdd, 0xa5, 0xfa, 0x09, 0xde, 0xad, 0x2c, 0x11, 0x24, 0x6e, 0x20},
+    {0x00, 0x00, 0x6b, 0x48, 0xd1, 0x9d, 0xf2, 0xe8, 0x2e, 0xd5, 0xc9, 0x52,
+     0x9a, 0x90, 0x5d, 0x17, 0x20, 0x0e, 0x0f, 0x96, 0x18, 0x33, 0x08, 0x3e,
+     0xbc, 0xf8, 0x0d, 0xa7, 0xd5, 0xd6, 0x4b, 0x8a, 0xa4, 0x97, 0x9e, 0x1c,
+     0x00, 0x0e, 0x47, 0xeb, 0x23, 0x73, 0xb3, 0x95, 0x05, 0x76, 0xbe, 0x27,
+     0x81, 0xc2, 0x43, 0x18, 0xd9, 0x37, 0xbd, 0xd7, 0xd6, 0x98, 0xff, 0xa5,
+     0xd5, 0x16, 0xfe, 0x03, 0xcc, 0x8e, 0xa4, 0x0b, 0xda, 0x50, 0x74, 0x39,
+     0x58, 0xdc, 0x57, 0xec, 0x8b, 0xa9, 0x6a, 0x49, 0x84, 0xc5, 0x99, 0x04,
+     0xb0, 0xbd, 0xea, 0xa2, 0xbb, 0xa0, 0x4a, 0x80, 0x4c, 0x22, 0xe1, 0xc7},
+    {0x00, 0x01, 0xaa, 0xa4, 0x71, 0x77, 0xc5, 0x5f, 0xed, 0x0e, 0xe1, 0xd6,
+     0xff, 0x72, 0x8f, 0x25, 0xdf, 0x91, 0x46, 0xf2, 0x6b, 0xe6, 0xcb, 0x85,
+     0x0c, 0x3e, 0x9b, 0x6b, 0xae, 0x29, 0xba, 0x19, 0x4d, 0x58, 0x07, 0xa2,
+     0x2e, 0x68, 0x1c, 0xd1, 0xc8, 0xb7, 0x3c, 0x50, 0x64, 0xb3, 0x7b, 0xeb,
+     0x6c, 0x94, 0x76, 0x74, 0x52, 0x1e, 0x90, 0xc2, 0x6b, 0x0a, 0x77, 0x0f,
+     0x45, 0xdf, 0xcc, 0x81, 0xd9, 0xbb, 0x8b, 0x7e, 0x91, 0xa1, 0x07, 0x62,
+     0x79, 0x58, 0x98, 0x1f, 0x8e, 0x0a, 0xa1, 0xee, 0x28, 0x56, 0x3b, 0xbe,
+     0x70, 0x1b, 0x48, 0xf0, 0xfa, 0x24, 0xcf, 0x34, 0xee, 0x82, 0xfd, 0x6e},
+    {0x00, 0x01, 0x8c, 0x25, 0xce, 0x3b, 0xed, 0xe9, 0x93, 0x79, 0xe8, 0x87,
+     0x91, 0x0c, 0x7b, 0x25, 0xd7, 0xa2, 0xf2, 0x1a, 0x02, 0x98, 0x8e, 0xdd,
+     0x95, 0xb5, 0x4a, 0xa0, 0xa3, 0x89, 0x4b, 0x02, 0x8f, 0xea, 0x99, 0xfa,
+     0x80, 0x9c, 0xcd, 0x39, 0xda, 0x94, 0xff, 0x8a, 0xc7, 0xd2, 0xbb, 0xd9,
+     0x6c, 0xbd, 0xb4, 0x88, 0xa1, 0xb6, 0xb0, 0x1e, 0x36, 0xfe, 0x2d, 0x51,
+     0x78, 0x72, 0x3e, 0xc4, 0x85, 0x24, 0x5b, 0x0d, 0x24, 0x7a, 0x62, 0x08,
+     0x5f, 0x7c, 0xda, 0x34, 0x34, 0x9d, 0x89, 0x9a, 0x1d, 0x4f, 0x89, 0xd9,
+     0x3d, 0xf3, 0x27, 0xeb, 0x1a, 0x64, 0x3a, 0x10, 0x73, 0xc7, 0x0f, 0xf1},
+    {0x00, 0x00, 0x70, 0x3b, 0x48, 0xdf, 0x49, 0x5f, 0x1f, 0x85, 0x1c, 0xc8,
+     0xc5, 0x23, 0xe3, 0x47, 0xce, 0x76, 0x69, 0xaf, 0xfc, 0x8a, 0xb3, 0xb4,
+     0x24, 0x68, 0x04, 0xd6, 0x81, 0x42, 0x77, 0x48, 0x80, 0x97, 0xb4, 0x79,
+     0x84, 0xa8, 0xfa, 0xbd, 0x13, 0xc9, 0x39, 0xa3, 0x65, 0x2c, 0x40, 0x6d,
+     0xd9, 0xdf, 0x5c, 0x18, 0x04, 0xa5, 0x48, 0x55, 0x0f, 0xbb, 0x78, 0x6f,
+     0x00, 0x74, 0x92, 0x43, 0xaa, 0x31, 0xee, 0xb0, 0x23, 0xdc, 0x05, 0x25,
+     0x03, 0xbb, 0xe2, 0xa9, 0xe6, 0x71, 0xbe, 0x55, 0xae, 0x0e, 0xbb, 0x9d,
+     0x10, 0xe8, 0x6e, 0xb3, 0x5c, 0x22, 0x30, 0xde, 0x1a, 0x3e, 0x10, 0xd3},
+    {0x00, 0x00, 0x25, 0xd8, 0xe0, 0x5a, 0xc4, 0xf7, 0x67, 0x1a, 0xff, 0x36,
+     0x2e, 0xa0, 0x67, 0x53, 0x95, 0x5b, 0x43, 0x48, 0xfe, 0x06, 0x41, 0xa4,
+     0xd8, 0xcc, 0xc7, 0xdb, 0x2d, 0xb0, 0xf6, 0x5d, 0x56, 0xae, 0xd3, 0x2d,
+     0x33, 0xb1, 0x1c, 0xcc, 0xad, 0x5b, 0x64, 0xc8, 0x93, 0x03, 0xbf, 0xfc,
+     0xfb, 0xb0, 0xb0, 0xcc, 0x58, 0x73, 0xac, 0xf8, 0x87, 0x4b, 0x26, 0x51,
+     0x92, 0x54, 0xcb, 0x22, 0x42, 0x53, 0xf3, 0x9e, 0x24, 0x5f, 0xf4, 0x26,
+     0x10, 0x45, 0xd3, 0x24, 0xdf, 0x66, 0x36, 0x15, 0x01, 0xa1, 0x70, 0x69,
+     0x5d, 0xdc, 0x1a, 0xd1, 0x0e, 0x62, 0xaa, 0x06, 0xd9, 0xd4, 0x37, 0x2c},
+    {0x00, 0x00, 0xe5, 0x1f, 0xcf, 0xc2, 0x3f, 0xda, 0xb9, 0xaf, 0x35, 0x95,
+     0x8e, 0x05, 0xdb, 0x63, 0x02, 0x35, 0x35, 0x8b, 0xa6, 0xe8, 0xff, 0x72,
+     0x96, 0xdd, 0xba, 0xbe, 0xc0, 0xe5, 0x31, 0x2e, 0xe2, 0x64, 0xd0, 0xcd,
+     0xe8, 0xf6, 0x88, 0xe3, 0x46, 0x13, 0x8a, 0xe6, 0xe3, 0x90, 0x6f, 0xbb,
+     0xb0, 0x50, 0x91, 0x41, 0xe6, 0x69, 0xb9, 0x23, 0xcd, 0x87, 0x92, 0xf9,
+     0xb1, 0x9f, 0x31, 0xf4, 0xa0, 0x71, 0x20, 0xe7, 0x37, 0x10, 0xc8, 0x9b,
+     0xab, 0x0b, 0xe5, 0x3f, 0x34, 0xc1, 0x4a, 0x90, 0x10, 0x96, 0x59, 0x14,
+     0x40, 0x23, 0x6a, 0x9a, 0xfe, 0x63, 0xb9, 0xa9, 0x04, 0x51, 0x55, 0xd5},
+    {0x00, 0x00, 0x31, 0xc4, 0x8a, 0xeb, 0xdd, 0x0d, 0xa5, 0x84, 0xc3, 0xcb,
+     0x16, 0x7e, 0x90, 0xad, 0xe7, 0x6a, 0x47, 0xf2, 0x10, 0xba, 0x89, 0xb1,
+     0x41, 0x93, 0x67, 0x35, 0xb1, 0x38, 0xce, 0xa5, 0xeb, 0x2f, 0xb0, 0xd4,
+     0xe7, 0x1e, 0x47, 0xf2, 0xb1, 0xde, 0x89, 0xa3, 0x3c, 0x8a, 0xb6, 0xba,
+     0x01, 0x6a, 0xf2, 0xf8, 0xc3, 0x08, 0x66, 0x5e, 0x4f, 0x51, 0x89, 0xa1,
+     0x55, 0x05, 0x00, 0xa2, 0x95, 0x39, 0xd4, 0x4f, 0xd8, 0x9f, 0xcd, 0xdc,
+     0xcd, 0x4e, 0xb0, 0x34, 0x1f, 0xee, 0x01, 0x4d, 0xf0, 0xea, 0x62, 0xd6,
+     0xd8, 0x25, 0x27, 0xa4, 0x8f, 0x0d, 0xa9, 0x12, 0x6a, 0x0a, 0x63, 0x5d},
+    {0x00, 0x01, 0x94, 0x61, 0x65, 0xc6, 0x3a, 0x60, 0x67, 0x0b, 0xd7, 0x6f,
+     0xa1, 0x22, 0x13, 0x6d, 0xef, 0xad, 0x7d, 0x3c, 0xa5, 0x76, 0x36, 0xff,
+     0xbb, 0xc4, 0x63, 0xe3, 0x83, 0xf0, 0x71, 0xad, 0xe1, 0x2d, 0x3e, 0xc6,
+     0xe2, 0xc9, 0x61, 0xd5, 0xf7, 0xe5, 0xef, 0xa7, 0xa7, 0x35, 0xf2, 0xb7,
+     0x76, 0x1b, 0xe0, 0x46, 0x33, 0x0e, 0x99, 0xa1, 0xee, 0x1f, 0xd5, 0xb3,
+     0x49, 0x01, 0x0a, 0x36, 0xd2, 0x04, 0x48, 0x4e, 0x1f, 0xed, 0xdb, 0x10,
+     0xcb, 0xc6, 0x43, 0x15, 0x9a, 0x17, 0xbb, 0x58, 0xcf, 0x89, 0xa7, 0xf6,
+     0x54, 0x88, 0x56, 0xc1, 0xed, 0x6c, 0x3d, 0x5f, 0x20, 0xa4, 0x24, 0xa8},
+    {0x00, 0x01, 0xc3, 0x30, 0x9c, 0xe8, 0x2f, 0xff, 0x17, 0xc3, 0x28, 0x6b,
+     0xfc, 0x62, 0x90, 0x06, 0x3b, 0x4a, 0xa0, 0x32, 0x90, 0x14, 0x9e, 0xa9,
+     0xfd, 0xd1, 0xf5, 0xd3, 0xb9, 0x9e, 0x91, 0x28, 0x5e, 0x9c, 0x1a, 0x69,
+     0xd9, 0xd5, 0x02, 0xc9, 0xd3, 0x7b, 0xc8, 0x4f, 0x01, 0xf6, 0x32, 0xa2,
+     0x9e, 0xe5, 0xf7, 0xcd, 0x23, 0x6d, 0x24, 0x0f, 0x6d, 0x2a, 0x19, 0x1e,
+     0x46, 0x35, 0x72, 0x2b, 0xae, 0x9d, 0x34, 0x5e, 0x5c, 0xe1, 0x88, 0x94,
+     0xec, 0x4c, 0x1f, 0xbf, 0xb9, 0x06, 0x96, 0xf3, 0x7b, 0x2b, 0x0b, 0x42,
+     0x71, 0x84, 0x2c, 0x8d, 0x22, 0xd6, 0x2e, 0x24, 0x7d, 0xeb, 0xbc, 0xe9},
+    {0x00, 0x01, 0x9e, 0xc2, 0x53, 0xff, 0xd3, 0x79, 0x63, 0x83, 0x2c, 0x1b,
+     0x95, 0x52, 0x2c, 0x1a, 0xe5, 0x5f, 0xce, 0xf3, 0x79, 0x8c, 0x4a, 0xc5,
+     0xae, 0xf7, 0x71, 0x86, 0xa7, 0x2c, 0x3c, 0x91, 0xf8, 0x3d, 0x76, 0xa8,
+     0x4d, 0x3f, 0xa6, 0xc6, 0x17, 0xaf, 0x6b, 0xcb, 0xb8, 0x90, 0xa9, 0xff,
+     0x4a, 0x7c, 0x66, 0x6a, 0x49, 0x60, 0xb0, 0x1a, 0x1c, 0x1d, 0x7d, 0xac,
+     0x45, 0x81, 0x25, 0x54, 0x3b, 0x7f, 0x1e, 0x78, 0x56, 0x98, 0x6e, 0xae,
+     0x4d, 0x17, 0xaf, 0x0d, 0xa9, 0x4c, 0x6d, 0x59, 0x8a, 0xca, 0x8b, 0x4d,
+     0x99, 0x81, 0x92, 0x4f, 0x91, 0x70, 0x27, 0x53, 0x79, 0x2f, 0x75, 0x23},
+    {0x00, 0x00, 0x23, 0x07, 0xd2, 0xf5, 0x98, 0xe3, 0xcf, 0xa0, 0xaf, 0xf7,
+     0x71, 0x06, 0xa8, 0x14, 0xad, 0x09, 0x74, 0x88, 0x71, 0x14, 0xab, 0xd1,
+     0x43, 0x0c, 0x62, 0xdb, 0xc1, 0xf7, 0xb8, 0x68, 0x4a, 0xc2, 0xf0, 0xb8,
+     0x0f, 0xc8, 0x46, 0x66, 0xf8, 0x89, 0x77, 0x50, 0xef, 0xbb, 0x47, 0xe6,
+     0xe2, 0x47, 0xc7, 0x87, 0x5e, 0x2f, 0x9a, 0x56, 0x32, 0x12, 0x55, 0x3d,
+     0x5c, 0xce, 0x64, 0x7b, 0xe2, 0x85, 0xff, 0x9d, 0xa7, 0xea, 0x83, 0xaf,
+     0xb4, 0xe8, 0xe2, 0x2f, 0xa9, 0xd2, 0x03, 0xab, 0xfe, 0xde, 0x40, 0x5f,
+     0x01, 0x3a, 0xeb, 0x6e, 0xb8, 0x15, 0x0d, 0x12, 0x20, 0x72, 0xd2, 0x96},
+    {0x00, 0x00, 0x1b, 0x92, 0xc7, 0x42, 0x7c, 0xb8, 0x18, 0x71, 0xdd, 0xc8,
+     0x9d, 0x5f, 0xfe, 0xfc, 0xab, 0xa3, 0xc8, 0xfe, 0xb2, 0xea, 0x30, 0x68,
+     0x8b, 0x05, 0x60, 0xdb, 0x8b, 0x04, 0xf7, 0x68, 0x3f, 0x89, 0xa5, 0x90,
+     0x76, 0xd8, 0x08, 0x92, 0xfe, 0x61, 0x03, 0x21, 0x7b, 0xf4, 0x20, 0x66,
+     0x7c, 0xd3, 0xcc, 0xfc, 0xdb, 0x99, 0xd4, 0x60, 0x45, 0x62, 0x39, 0xa9,
+     0xd7, 0x88, 0x77, 0xde, 0xda, 0x1d, 0x7e, 0x55, 0xac, 0x05, 0x97, 0xe2,
+     0x42, 0x0a, 0x35, 0x51, 0xcf, 0x6d, 0x80, 0x5f, 0x9c, 0x85, 0x82, 0x70,
+     0x77, 0xdc, 0x84, 0xac, 0xe2, 0xc4, 0x57, 0x7a, 0x8b, 0xf4, 0xdb, 0x1e},
+    {0x00, 0x00, 0x59, 0x75, 0xca, 0xa0, 0xfa, 0xe7, 0x0f, 0xeb, 0xca, 0x98,
+     0x40, 0x57, 0xbb, 0xe0, 0xe0, 0xb0, 0xd9, 0x79, 0x7f, 0xa1, 0xf2, 0xda,
+     0x1d, 0x4f, 0xb5, 0xeb, 0x48, 0x36, 0x38, 0x44, 0x3f, 0xe5, 0x93, 0xd2,
+     0xd8, 0x30, 0xf6, 0x61, 0xee, 0xbb, 0x78, 0xf8, 0x41, 0x42, 0x8f, 0x12,
+     0x8d, 0x33, 0x29, 0x59, 0x9e, 0x3a, 0x02, 0xa5, 0x59, 0x19, 0xb8, 0xaf,
+     0x7a, 0x47, 0x65, 0x70, 0x7a, 0x2b, 0xaf, 0xfb, 0xa5, 0xa4, 0x6b, 0x0d,
+     0xc2, 0x13, 0x68, 0x65, 0xb2, 0xa5, 0x37, 0x40, 0x1a, 0x0a, 0x34, 0x2d,
+     0xe4, 0x38, 0x77, 0x6e, 0xbc, 0xfa, 0x3d, 0x1a, 0x7a, 0xbf, 0x50, 0x01},
+    {0x00, 0x00, 0x20, 0x71, 0xfa, 0x1b, 0x6a, 0x11, 0x50, 0x44, 0xa9, 0x1a,
+     0x18, 0xe6, 0x89, 0x4c, 0xdb, 0x4f, 0xbc, 0x5e, 0xa3, 0xd1, 0x35, 0xd3,
+     0x42, 0x83, 0xae, 0xc7, 0xd7, 0x6b, 0x02, 0x51, 0x22, 0x5d, 0x89, 0x08,
+     0xec, 0x0d, 0x62, 0xf3, 0x36, 0xfe, 0xd0, 0xf0, 0xee, 0xb2, 0x78, 0x61,
+     0x27, 0x9c, 0x1e, 0x6a, 0x0d, 0x89, 0xbc, 0x86, 0xd7, 0x83, 0xf1, 0xdb,
+     0x49, 0xf3, 0x7b, 0x8e, 0xeb, 0xdc, 0x73, 0x80, 0x68, 0x52, 0xde, 0x7d,
+     0xae, 0x9b, 0x06, 0xb3, 0x08, 0x1f, 0xa6, 0x11, 0x94, 0xe1, 0xb1, 0x94,
+     0x41, 0x26, 0x9b, 0x9a, 0x18, 0xde, 0x26, 0x33, 0x96, 0xc7, 0x65, 0x9f},
+    {0x00, 0x01, 0xa4, 0xac, 0x70, 0x47, 0xf2, 0xfe, 0x71, 0x1a, 0x93, 0x09,
+     0xaf, 0x61, 0xd3, 0xea, 0xf2, 0x1b, 0xc5, 0x9a, 0x96, 0x33, 0x31, 0x38,
+     0xb8, 0x72, 0xcc, 0xee, 0xfa, 0xef, 0x4a, 0x27, 0x3d, 0xec, 0xd0, 0xce,
+     0x05, 0x83, 0xf4, 0xc8, 0x26, 0xbc, 0x04, 0xeb, 0x69, 0x2c, 0x7a, 0x29,
+     0x20, 0xe1, 0xcb, 0x76, 0x43, 0xe3, 0x75, 0x25, 0xeb, 0x74, 0x41, 0xdf,
+     0x96, 0x7e, 0x70, 0x42, 0x03, 0x7e, 0xf0, 0xcb, 0xf8, 0xf5, 0x35, 0x5c,
+     0x62, 0x95, 0xe0, 0xc4, 0x1e, 0xda, 0xe6, 0xd7, 0xae, 0xf8, 0x76, 0xe6,
+     0x81, 0x90, 0x6f, 0x3e, 0x56, 0x0d, 0x36, 0x04, 0xea, 0xff, 0xb1, 0xe0},
+    {0x00, 0x00, 0x8f, 0x04, 0x42, 0x6b, 0xb4, 0xad, 0x70, 0x63, 0xc8, 0xff,
+     0x25, 0x90, 0x9b, 0x24, 0x94, 0x78, 0xf5, 0x04, 0x0c, 0x61, 0x33, 0xb6,
+     0x4e, 0x44, 0xdd, 0x5f, 0xb9, 0x00, 0x51, 0xd2, 0xd4, 0x22, 0x0a, 0x2a,
+     0xc3, 0x93, 0x20, 0x33, 0x89, 0x3f, 0x9b, 0xe0, 0x17, 0x2c, 0x46, 0x1e,
+     0x9c, 0x31, 0x39, 0x66, 0xc0, 0x43, 0x50, 0x35, 0xbb, 0xa2, 0xfa, 0x55,
+     0x62, 0xdd, 0xa1, 0xc0, 0x2a, 0x73, 0xf1, 0xb0, 0x7c, 0xac, 0xe6, 0x55,
+     0x38, 0xb1, 0x46, 0x3b, 0x39, 0x56, 0x01, 0xb3, 0xe3, 0x76, 0xd0, 0x0c,
+     0x95, 0xc2, 0x46, 0xde, 0x72, 0x42, 0xb6, 0x82, 0xdd, 0x87, 0x55, 0x1f},
+    {0x00, 0x00, 0x1e, 0x24, 0xe0, 0x71, 0x3b, 0x4b, 0xad, 0x5e, 0xc8, 0x7d,
+     0xb3, 0xbc, 0x42, 0x56, 0xf1, 0x3c, 0xe0, 0xb0, 0x70, 0xed, 0x25, 0x9c,
+     0x54, 0xfb, 0x2e, 0x01, 0x76, 0x5c, 0xfe, 0xa1, 0x93, 0x41, 0xba, 0x7b,
+     0x9b, 0xf6, 0xc8, 0x7a, 0xc5, 0xfd, 0xc3, 0x82, 0x63, 0x1e, 0x7d, 0x4d,
+     0x25, 0x66, 0x84, 0xd4, 0xe5, 0x85, 0xcf, 0x8b, 0x15, 0x91, 0x08, 0xee,
+     0xbd, 0x21, 0x12, 0x46, 0xd5, 0x12, 0xfc, 0x9a, 0x0e, 0xcb, 0x8a, 0x25,
+     0x8e, 0x0e, 0x7c, 0x1a, 0x7f, 0x35, 0xa0, 0xbc, 0x33, 0x7b, 0x08, 0x02,
+     0x27, 0xc2, 0xb2, 0xb7, 0x26, 0x4e, 0x87, 0x53, 0xb5, 0xcd, 0x33, 0x79}};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed MDS_pre[sponge_size - 1][sponge_size - 1] = {
+    {{0xf8790f991e2898d1, 0xb242aa8fe76905f0, 0x6f19344ca4db8c5e,
+      0xab4d3dbb8017f9ef, 0x26279b8e4004f7cb, 0xcdf02353e6bd91b1,
+      0x5fbb911ba1d5efe0, 0xce131dc769364d32, 0xd74eaa28fcfa03da,
+      0x5888170f8d353800, 0x15ccb1d0f367f704, 0x000070d86247583e},
+     {0x657fedaccf0a7d51, 0x6de8e1737a5e208c, 0x9dea7efbb7bf319c,
+      0xae8bdff64bd7eb1b, 0x1aed5bf9d0e2b10e, 0x7f8148f2a0fd9125,
+      0x5e9830fa4d1e3bfd, 0xf134385aae9d6bd0, 0xa823bdcd464924c4,
+      0xdb3f04ed9d789765, 0x0a60576238644e90, 0x0000b62933777e15}},
+    {{0x2ac9e725ef05c41b, 0x9bd3b396dcf2aa02, 0xbc38bc21cb0c20e2,
+      0x254e26209232a7eb, 0xe2f1d22453aa8991, 0x100b72b6db4702a3,
+      0x1c28e9ed5369a902, 0x15e3ec97830ba640, 0xb622ec521e047f71,
+      0x077d9ca7cf4ea51f, 0x8ec1850de7a349d8, 0x0001a347e9d048ea},
+     {0x7e51d2527865542d, 0x25e575626b66cd4c, 0x3bd3f320bb9b7b2d,
+      0x564c4ce727e5795a, 0xf549c66e55413fbf, 0x360d97882c65011a,
+      0x3065406670dcfbf1, 0x97702a60aef877e8, 0x63e21cadc41c1c92,
+      0x79cea973e6ca93a4, 0x2494414b76c258d7, 0x000110373525e007}}};
+#else
+static const fe_packed MDS_pre[sponge_size - 1][sponge_size - 1] = {
+    {{0x00, 0x00, 0x70, 0xd8, 0x62, 0x47, 0x58, 0x3e, 0x15, 0xcc, 0xb1, 0xd0,
+      0xf3, 0x67, 0xf7, 0x04, 0x58, 0x88, 0x17, 0x0f, 0x8d, 0x35, 0x38, 0x00,
+      0xd7, 0x4e, 0xaa, 0x28, 0xfc, 0xfa, 0x03, 0xda, 0xce, 0x13, 0x1d, 0xc7,
+      0x69, 0x36, 0x4d, 0x32, 0x5f, 0xbb, 0x91, 0x1b, 0xa1, 0xd5, 0xef, 0xe0,
+      0xcd, 0xf0, 0x23, 0x53, 0xe6, 0xbd, 0x91, 0xb1, 0x26, 0x27, 0x9b, 0x8e,
+      0x40, 0x04, 0xf7, 0xcb, 0xab, 0x4d, 0x3d, 0xbb, 0x80, 0x17, 0xf9, 0xef,
+      0x6f, 0x19, 0x34, 0x4c, 0xa4, 0xdb, 0x8c, 0x5e, 0xb2, 0x42, 0xaa, 0x8f,
+      0xe7, 0x69, 0x05, 0xf0, 0xf8, 0x79, 0x0f, 0x99, 0x1e, 0x28, 0x98, 0xd1},
+     {0x00, 0x00, 0xb6, 0x29, 0x33, 0x77, 0x7e, 0x15, 0x0a, 0x60, 0x57, 0x62,
+      0x38, 0x64, 0x4e, 0x90, 0xdb, 0x3f, 0x04, 0xed, 0x9d, 0x78, 0x97, 0x65,
+      0xa8, 0x23, 0xbd, 0xcd, 0x46, 0x49, 0x24, 0xc4, 0xf1, 0x34, 0x38, 0x5a,
+      0xae, 0x9d, 0x6b, 0xd0, 0x5e, 0x98, 0x30, 0xfa, 0x4d, 0x1e, 0x3b, 0xfd,
+      0x7f, 0x81, 0x48, 0xf2, 0xa0, 0xfd, 0x91, 0x25, 0x1a, 0xed, 0x5b, 0xf9,
+      0xd0, 0xe2, 0xb1, 0x0e, 0xae, 0x8b, 0xdf, 0xf6, 0x4b, 0xd7, 0xeb, 0x1b,
+      0x9d, 0xea, 0x7e, 0xfb, 0xb7, 0xbf, 0x31, 0x9c, 0x6d, 0xe8, 0xe1, 0x73,
+      0x7a, 0x5e, 0x20, 0x8c, 0x65, 0x7f, 0xed, 0xac, 0xcf, 0x0a, 0x7d, 0x51}},
+    {{0x00, 0x01, 0xa3, 0x47, 0xe9, 0xd0, 0x48, 0xea, 0x8e, 0xc1, 0x85, 0x0d,
+      0xe7, 0xa3, 0x49, 0xd8, 0x07, 0x7d, 0x9c, 0xa7, 0xcf, 0x4e, 0xa5, 0x1f,
+      0xb6, 0x22, 0xec, 0x52, 0x1e, 0x04, 0x7f, 0x71, 0x15, 0xe3, 0xec, 0x97,
+      0x83, 0x0b, 0xa6, 0x40, 0x1c, 0x28, 0xe9, 0xed, 0x53, 0x69, 0xa9, 0x02,
+      0x10, 0x0b, 0x72, 0xb6, 0xdb, 0x47, 0x02, 0xa3, 0xe2, 0xf1, 0xd2, 0x24,
+      0x53, 0xaa, 0x89, 0x91, 0x25, 0x4e, 0x26, 0x20, 0x92, 0x32, 0xa7, 0xeb,
+      0xbc, 0x38, 0xbc, 0x21, 0xcb, 0x0c, 0x20, 0xe2, 0x9b, 0xd3, 0xb3, 0x96,
+      0xdc, 0xf2, 0xaa, 0x02, 0x2a, 0xc9, 0xe7, 0x25, 0xef, 0x05, 0xc4, 0x1b},
+     {0x00, 0x01, 0x10, 0x37, 0x35, 0x25, 0xe0, 0x07, 0x24, 0x94, 0x41, 0x4b,
+      0x76, 0xc2, 0x58, 0xd7, 0x79, 0xce, 0xa9, 0x73, 0xe6, 0xca, 0x93, 0xa4,
+      0x63, 0xe2, 0x1c, 0xad, 0xc4, 0x1c, 0x1c, 0x92, 0x97, 0x70, 0x2a, 0x60,
+      0xae, 0xf8, 0x77, 0xe8, 0x30, 0x65, 0x40, 0x66, 0x70, 0xdc, 0xfb, 0xf1,
+      0x36, 0x0d, 0x97, 0x88, 0x2c, 0x65, 0x01, 0x1a, 0xf5, 0x49, 0xc6, 0x6e,
+      0x55, 0x41, 0x3f, 0xbf, 0x56, 0x4c, 0x4c, 0xe7, 0x27, 0xe5, 0x79, 0x5a,
+      0x3b, 0xd3, 0xf3, 0x20, 0xbb, 0x9b, 0x7b, 0x2d, 0x25, 0xe5, 0x75, 0x62,
+      0x6b, 0x66, 0xcd, 0x4c, 0x7e, 0x51, 0xd2, 0x52, 0x78, 0x65, 0x54, 0x2d}}};
+#endif
+
+#if defined(CODA_HOST)
+static const fe_packed MDS_sparse[partial_rounds][2 * sponge_size - 1] = {
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x2918013171708581, 0x0cc30ccb0be25a04, 0x7c0a3a968996c2fc,
+      0xfaf861dc9c2aa09d, 0x3e6799a046aa097f, 0x2898a71cac3d0597,
+      0xcc299945eaa7c815, 0x769f0be0c2802c2c, 0x54b19862287c1c3c,
+      0x882d5d1c0e60a1b7, 0x53fbb783d7c43c6d, 0x00001c12c0e95b9d},
+     {0xd49a9c4aa74055b4, 0x84442dec29aebf68, 0xdfe6ffe7f23ce67d,
+      0x4b06a0a8dc666bb2, 0x58efe7e3351fd199, 0xe066e34bc571f3a5,
+      0xfd43480a1856ebb6, 0xfc95c9dc3ea2d1a5, 0xc38bd13c67acc913,
+      0xf907ba7191ec54ff, 0x57356fefe44d00eb, 0x000141011c470f39},
+     {0x54c6e44a592a4fae, 0xa7784144767267af, 0xbbe36d58da2b6bf7,
+      0x8444d554a389283f, 0xc4016320f6981915, 0xd72b23c73c249c7a,
+      0x4b7e541dc19b01d1, 0x096a43385978a377, 0x8469df43f1c3bab1,
+      0x754444aec6472ca0, 0xd50e8fbaa4e69805, 0x00018c52bb239f0a},
+     {0x4bba45da9fc84c7b, 0x53a95b0593c7d345, 0x08e07362fd2d0e80,
+      0x81a3c2c6413b32f0, 0xe2762dd9a3cc5980, 0x8becdb9d03186811,
+      0x76ba3de328a09fd0, 0xd602d48cc569442d, 0xb866b23e94516f0a,
+      0x69523ba872472cc8, 0x93ef4b3905b8fb81, 0x00000144f09e4616}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xab2eadb7ad62b05a, 0x749a9c92c6bf8187, 0x8465e4c19233b046,
+      0x9b1d6ebf7e52cc7b, 0xfefee6ec11e543ed, 0xd60b83b92199c4ff,
+      0x8c5af268abd604b9, 0x752df37981545dcb, 0x60c062dd557422a5,
+      0x527c23c7db2de17c, 0x0a681ab2c79211dd, 0x00004f55425db024},
+     {0x19b9bccda86131bb, 0x5b0beec3308fb663, 0x4760710409503b69,
+      0xda2415d6bc1ec1cd, 0xc274aeb8d822f357, 0x35ca0e4b2a7a2916,
+      0x9f862957e851877c, 0x82209d00d8709281, 0xdea9be043831ef82,
+      0xedbd4ca3554a6c27, 0x9ed23daaca8b9285, 0x0000476ce0f8a613},
+     {0xfe8cbda9d7659676, 0xfab6adeac2e0a7ec, 0x723d5673fc6ca78e,
+      0x87897fc8704f67f9, 0x624506695c51b670, 0xddbd7455d5e17fb5,
+      0xf303172906ad38a2, 0x0fbefa40274a8a32, 0xd7ca33dbc53d395d,
+      0xcff817aca6e51aa2, 0xcd4177d2906660de, 0x000196d2b1116fc1},
+     {0xfcf962598b87a127, 0x2733a04298d99ad6, 0x5b25ff55677122b8,
+      0xf5a7a9eb26a6795f, 0x46483b5e39fb23e3, 0x3285294857669abd,
+      0xec0fca8a8e363249, 0x8177507739a39775, 0x92b72d9d5a584371,
+      0x853fff62971e26e7, 0xd8674abbc35367d5, 0x0000800f1c3a1992}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xfd29055b87eb0ad3, 0x1a29fb3b35545a2c, 0x1620c01504e2bbea,
+      0x63aa046108c213f4, 0xd6987a17cf2a79e6, 0x78e90b2a31f366e2,
+      0xbf465cdedf0e5d01, 0x10cd7231ca044dda, 0x8547d2782a54a79d,
+      0xfa322072b67b3f46, 0x1629af54be810312, 0x00007281ebdf2a66},
+     {0x0d877cdfda0fc738, 0x1eaa81c5d4dc246d, 0x980304413511a1e8,
+      0xb46428e69f8a577c, 0xb556eabfb4d09ad0, 0xa3e621e7aa402d6b,
+      0xdf0c6c92179fb41a, 0xaa689b26086c7c8d, 0x7a5eee9d1e053a4a,
+      0xeee03c4bcf66d732, 0xe0df140cb6eae0cd, 0x000085ed2c3b0e4d},
+     {0x9fa89b1b64840368, 0xd72d2c6c7af3b60a, 0x0a1679a1fbcfb6eb,
+      0x3d62072d31db9bc5, 0xad81ec9f56937f4a, 0x448438dc27cd62a1,
+      0x3ed33824e9b0b1e0, 0xc3c5f983d736ac4e, 0xe43f8128f891b995,
+      0x55b260b1cf596b08, 0x4716a201e5fdf1fb, 0x00009de8ff469f7f},
+     {0x64aad9c43db5a8e2, 0xfb2b500149f6bb5b, 0x49c99a915d642099,
+      0xe9d26c9a04150367, 0xeadbfa84af5ac1c1, 0xadfb56f9965feb7a,
+      0x5a4dc09ab6a1e09f, 0xc664f9845e904f9f, 0x93890f52534652f4,
+      0x1cfa7a2d418302e8, 0xd1a0ea2dce0ca6ce, 0x00018f6194efb3c0}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xeca324580564ff35, 0xf8588b53132c743d, 0xe335af83a4d291ba,
+      0x93162aeb1a91b028, 0x99689059b110651a, 0xdffd36f4276c25d7,
+      0x3d1b72091b1a8887, 0xc217c6216b5327a4, 0x58cd32f500bbfdd9,
+      0x86575fe10dd955ca, 0xe7d3a932d5c1b04e, 0x000013decf9a6bb0},
+     {0xb219bf7c226ef46c, 0x0f95fa181a4ddf03, 0x8dfa335a5e420238,
+      0x4791ecd2a7d761e9, 0xb61c3cc3ce56bbb8, 0x1ea158c8e99157a7,
+      0x36c9b5c0e864f961, 0x5162c8695bea0040, 0xfcba536dd766a42a,
+      0x7a8586cbbde8c921, 0xfe0f2ab32b5c392b, 0x00000e1220d1562b},
+     {0x9355b2ad39c4011b, 0xd73c873c81129409, 0x7f42d71624b1ed4a,
+      0x5fbfead6b685e132, 0x448396769b931bd1, 0xd61269d7febea2c5,
+      0x3aec4e22c48ea994, 0xda30d041d8ff2a86, 0x3fb820a3802ab220,
+      0x1bf31ef74ea5bb29, 0x84162efde0507e8a, 0x00018008b20fe0ce},
+     {0xf39aacba434e2f5d, 0xc15e0a6a41342817, 0x24e29b796e118962,
+      0x1f7272cb483c226f, 0xffcf2624f54279f3, 0x1231d92d7bbe7ccd,
+      0x4b32389d8a48458d, 0x681951fa7f2a1f0f, 0xfa605feaff781aca,
+      0xd9ee1dcb500224d2, 0x4e25cbb58c015587, 0x0000d7b9d86a583c}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x2032bb1270e3126f, 0x2bae960c06ddb0da, 0xc22152421bc5cac5,
+      0x21620dd99ef8d8bb, 0x1cde778c1584049c, 0x2961ac01298f4325,
+      0x5b667e2aae7e0990, 0xc2ecfab732941206, 0x32726fbd68c0b43b,
+      0x2aca946db8d94d60, 0x907e54b0d979ca0e, 0x00002f12804e9765},
+     {0x4c42bff30d673667, 0x65d7bf0836d3900a, 0xc018b4c3bbffe2ed,
+      0x7e5a60f2bdccd728, 0x03f69e4af8467a1d, 0x05525a88872d4466,
+      0x568ad9f74ed34f2d, 0xa40e88cc966324ea, 0x17b8cc62a0d0c602,
+      0xb305809f593f2378, 0x33c1ea24d238681a, 0x0000b55becd930f0},
+     {0x66ab3b3c4c88d594, 0x91eef977d61d618c, 0x43c9338b57be863d,
+      0x323f3204db968a90, 0x9ec4e0a22a8a9595, 0xee000c8da2b2a6d5,
+      0x1e41009fc45379af, 0xee548a17ecd2b593, 0x055d7debd4be2fd1,
+      0xe125b070c7e50e7b, 0x1709c591478ba1ae, 0x0000d107bdf6b448},
+     {0xe4e046bca5dc7125, 0x97fb9e1f3b37bbd7, 0xf21fe35d22ab7ece,
+      0xaa26dbeafad819ba, 0xd92aef5f4af7519e, 0x849a332ea4665b78,
+      0xc93d3fbf4fd91f59, 0xe69b82973a12cec0, 0xdf8c034fc49f9cc3,
+      0xca87ead1e8e9968e, 0x05fa3168ac140294, 0x00018a123292f0fa}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xa97fc0fb04d46a81, 0x72ba8b4081018e8c, 0x991ddc6dc4bc3523,
+      0xa84e743bad13e734, 0xc7137b98191c00fd, 0x24ab82384f94ec9f,
+      0x74c9e8576fe1c62c, 0x649da67dcf00e806, 0xe11346c2df397373,
+      0x1516c103624f3a12, 0xd3f78f8b6c3dbe78, 0x0001a302d98e43d6},
+     {0xee436a9768472d28, 0x363c5c376319850f, 0xe75139ad05ab0ffa,
+      0xfe8b024660bff648, 0xa2c06e13953bfc8c, 0x5a6868d27e1d9939,
+      0x888afe2aeb0376d2, 0x43ecc6a7196fafa2, 0xafa4123fcaf31a21,
+      0x68a506c275bbc460, 0x78d5fe7439d5d18e, 0x0001a9927068a9d6},
+     {0x2ea84a8925c0e897, 0x1381d7031c678836, 0x57d0e4888fc1d206,
+      0x44b7bae339a5dbca, 0xf4ddb79656e01f3b, 0x840fad5382c2a568,
+      0x6e979dca0ebc5506, 0xa719cf91d1ceaa34, 0xb4ab6456648f4ae0,
+      0x7f583288c59a48ea, 0x28af429554660b56, 0x000004f8eed1c4e5},
+     {0x3c6a55b38e7c5f44, 0x2516a2ce592c6cf3, 0x8f492a25d2d7661d,
+      0x6aa8b85fd8f9cfc1, 0x0ee98d75279c5ec2, 0xa7a5aea1696ebb9e,
+      0x76dd764af7f17b3b, 0xc37b32c73a8a3dbf, 0x8a071d71819f4486,
+      0xb77a83d22c5d956b, 0x2984529608ecb680, 0x000180267ac0b49d}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x6512be92eea521a0, 0x95e9cd76856f4c3c, 0xa580beea7b1e3e55,
+      0x3b68bdb74722c4e3, 0xfc435e5d2ca63b10, 0xf3593455aa0c7a41,
+      0xa32c0d66ade59f59, 0x5d70f50f02a681fe, 0x329e0723e125ce2c,
+      0x96f83b58cbe667cb, 0xb7d2ed6955bd2101, 0x0000c4be67a8d4aa},
+     {0xb9c5e66f55fc5729, 0x550f67e5c22c7c1d, 0xaa2ec1a66ab29b80,
+      0xd364be57cde1b2d6, 0xc983080d260da069, 0x4c05fdaffd8147a1,
+      0xe0419652a810103f, 0x9348719601e02bd9, 0x3dcdc4b1a3def9a7,
+      0x23e04a5b678595a9, 0xff7b8f1fb64161a2, 0x000036a1cf29cf30},
+     {0xeed103ffaf3dcd64, 0x14b91ee50c505288, 0x0ea7f26c93548ee9,
+      0xd482709a9bfcef62, 0xc5d3877228413ce9, 0x786c8bf95b45fdc3,
+      0x71ca76c0c71d498f, 0x18dc6cda696f7294, 0xe38957ffe8fc840b,
+      0x5e05f6e9e6205449, 0x63c95609d4744407, 0x000079889410da29},
+     {0xa317f292b3edac8b, 0x076679133230c930, 0xbead8e31d953b68c,
+      0x1b7863c00ca88dfe, 0xa7422e1d8bdbcfe5, 0x76a061d4da6ce8d7,
+      0x9e759bd4798c56ab, 0x150b313f77dcda02, 0xfa63d21033a90957,
+      0x09ce2d1798f32732, 0x417c81cf9cfe6c64, 0x0001872dee589161}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x947998de0c62f36a, 0x8eb7d0220044c80f, 0x998f1a9105c0ebe1,
+      0xdecf81184353e578, 0x5f46bc5f4608f00f, 0xd29fb1c867c8ff25,
+      0xb3ab31b220a7bc3b, 0x95b21a47228e01cf, 0xe50423ca7d18a3e8,
+      0xd58a62b04b212243, 0x220e417e0db1e4f7, 0x0001ad1d709ff75c},
+     {0xe80e653015f8170d, 0x2e40da0cd35bde46, 0x22423c45b3f3fb83,
+      0x9cbde54a32c54d08, 0x02d1fc05f77ff5df, 0x553d7aa2905e621e,
+      0x3ff39d42a2042db5, 0x430f700af785820e, 0xbfa4e48f9a32289c,
+      0xd50bd4b41c8f38c2, 0xc3b6d82fce3e64f7, 0x00013889eef25bdb},
+     {0x48670ba3a5c8bde2, 0x94b19cef7f47d1e9, 0x0169628a6a7b03e2,
+      0xd75abf14b5758640, 0xf5dcd217284a6024, 0x4751c70495c57f98,
+      0x2488c6be4c6d731d, 0xda49c3c456cff28f, 0xaa148d117641db90,
+      0x023d5a1fc058628d, 0x73491b830f28dfc1, 0x000175d3665e5276},
+     {0xcd7e0a373107aa71, 0x8bdc5d9cc4a03cb7, 0x9c300eeeae81cdff,
+      0x85c21ea70897efd4, 0xeb0c86498ef697cb, 0x66e0cfc323bf9147,
+      0x83c24b114e2b7f13, 0x79879b8797d1c4b3, 0x1e64e0640ee6979f,
+      0x713c1f6a8623702b, 0x4adad7a8fe324a32, 0x000190bccbe703af}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x49bd855e5cb41773, 0x38ce906bc5bc6499, 0xb2ccde8679034ec1,
+      0xa1b78ae41e5cec1b, 0xfe58338492e2f866, 0x38e8c4db79a7b707,
+      0x74b7f3e91a93ddce, 0x90c867f8ef0c64c4, 0xe45e0eea09f2b1fa,
+      0x2ee10c43d2cf86fd, 0x7adfb2b5395ef534, 0x00014ba74b1da238},
+     {0x503ce1d6bd5dffe0, 0x8f04a5bfa7619f49, 0x53f9591fc5de2f02,
+      0x4836371b4d212dda, 0x4d42f2929b0cade6, 0x305aa6136efeb626,
+      0x30c03179071038ac, 0x6f8000c0bada13fd, 0x723e05b2fec31431,
+      0x51fd35782d8b8bdc, 0xac828c8217abd562, 0x000083d5052e5451},
+     {0x90740871da4f6af9, 0xe966d49eddccdbbe, 0x6c446a48e34ad864,
+      0xb87484ddccc4fe9e, 0x4cf1de6be5068ab3, 0x304f5ee4c796c3e7,
+      0x28366fbcf4754aa6, 0x3bd6c8b9eae1ef24, 0x3b7a2a29fd2c6ba2,
+      0xa765c8d30c6fdee9, 0xb0082689817ab28b, 0x00019780261b5a71},
+     {0x3ee11625b80c5739, 0x33e830de40ff1a75, 0x0ddc967e1b1525df,
+      0xa341946ac09f3fa8, 0x5b69aa05e40422a2, 0xe41fba0739a8c702,
+      0xf4ff7cc7421f1a84, 0xc29d0809577ee5b5, 0xa0b5e6b9d15bf3f0,
+      0xfcc198338050c2dc, 0x9370e34585cc190a, 0x000122da2cf07ed0}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xe37a9de6a7e4d313, 0x5c2100b944aeb31a, 0xbbd23eff4b1b146c,
+      0xef38f2ad6ba6dddf, 0x0a2598d07edb88ff, 0x956dc088b1f6d2a4,
+      0xfb767294bd79d914, 0xeb0e9e4753c58564, 0x5e2b8192e8c8b95a,
+      0x21c8c9a4224dccaf, 0x88970a2be12df9f9, 0x0000b216fc6901ab},
+     {0xa13a0d1335ed74ca, 0xc0812591e891a0a7, 0x7487bface04dfa1c,
+      0x3b9f550a2681179b, 0xf55e28e2165e2b55, 0x7528e7cb6a851493,
+      0x4a36e6eae5039650, 0x57417b5278656fff, 0x24278015bed370b5,
+      0x0d64222c1b8dc505, 0xfa0d6a02eb3c0ece, 0x0000ea01e887b051},
+     {0xf625492a33d1e772, 0xce16285d2df86072, 0x4c4fd5d2ec68cc25,
+      0x077030f66c0699c4, 0x947057bde455811a, 0xbb52c1978ebe4c29,
+      0xcac0d7ff4a34b468, 0x5bb39e27f4e55de4, 0x58e353065cef86d5,
+      0x71bb24701fe461c1, 0x1956cf7e9e5ca2e9, 0x00019d1a00255dbe},
+     {0xff1ad0dd2aec1b8d, 0x7d3cbfd8c9d81060, 0x286cf5f758501edc,
+      0xb10958d097494a46, 0x6cec2d837405c9eb, 0xb4856be02388f240,
+      0x810a08b103ea06c7, 0xa8f86cadb55cee20, 0xf2feb7d2a07a3a12,
+      0xd3f207072f68fd37, 0x06c72e0ba541a083, 0x0000769d760125fd}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x2dea0daf7b13354f, 0xe8008ae93f1ab360, 0xb603238ea55c3e4a,
+      0xf78189e08bf5e393, 0xc8c555c33777845b, 0x29edf61d26be5325,
+      0xbde825bee977d5e0, 0x0abcf037863afefb, 0xa724f3e603c1013c,
+      0x9ff5463f4407d3f7, 0xa309f415a565d615, 0x00011218ec5efa24},
+     {0xf7983b0f6fb806f4, 0x8aa4756c79e4d735, 0x3776441065ca716a,
+      0xe963e84d4abb347a, 0x567e375698721fb2, 0x3e3f51864eff40c8,
+      0xf62a86194079a0b0, 0x43b4b95a8221c87b, 0x547816c9e6b9c6b0,
+      0x0b45a329dd8bd4b6, 0x0afe146e4be7590d, 0x000157ddce9b01c0},
+     {0x1fdeb265a63c47c2, 0x05735e0a5063d357, 0xfd735860fd53b157,
+      0xa260e6d28c0a4a24, 0x62c3d692f37724dd, 0x877d2bf2c2a7b586,
+      0xfc5e093cea075e64, 0x58134e623b620ebc, 0x5de6bb366f60a506,
+      0x90ee7c294ed0d536, 0x9feb0e5072789750, 0x00006ffc4106f64f},
+     {0x038e2d0f57846dcc, 0xf9041fd2f3411680, 0x2d650f4d5ad72793,
+      0x175771e4bdcd264e, 0x66e82dee152df0ca, 0xebbb8f5b03636714,
+      0x4918839889c79ba9, 0xc0c7699ba4f7ce8c, 0x1da86ba58b1f8c27,
+      0x79268b3583ecbf79, 0xbafe4519cce87612, 0x00011731022a2d1f}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xdc17059917ae74e2, 0xe1863755642ea09c, 0x5c2767649e83d967,
+      0xb1d9e72ef199fb14, 0x434357a0e2dda45b, 0x7609644dceff1b0e,
+      0x2177fb3e5cbdf8bf, 0x9cdd1f1e660cd9f7, 0xe889183c1e529c4a,
+      0x6a0bdb034816e519, 0x93bee702bab3d0bb, 0x000190247879caa4},
+     {0x92063b054bc273ee, 0xd9e96eded82c7e6f, 0xee0650ca9e304bbc,
+      0x4f3defed8da81b6f, 0xc10c21ea3871b8ed, 0xbe852c76aaeb2d50,
+      0xd5ec8e3e03e35e59, 0x5cd24ae7c4f8bb57, 0x4672cf12f25081ef,
+      0x68336418ed44641c, 0x23b13689b42a8221, 0x0000e70be75a780e},
+     {0x232b1943f3db04ea, 0xf95baf22392fd003, 0x711ce0a3c67584bb,
+      0xb82f4f80b4e8ccb4, 0xba82d1aeb1ce7755, 0xc73a1135ed4de68f,
+      0xd2783fb88fe02218, 0x21cd2816cb08cbe1, 0x747e77c72a2356f9,
+      0xc2f7814634391494, 0xabf3052a8203bb3d, 0x0001c366b8597899},
+     {0x0b459dabd43fb84c, 0x1b2b8b72c2b1af4f, 0x558fb48c93d4548f,
+      0x4870f55fc26051ee, 0xb7266b45922063a6, 0x281f4e018b7a5819,
+      0x4d34fd6ef52c84ba, 0xa4a421a43d645033, 0xe3b1c24ed90e0a5e,
+      0x52f02eea7b755ea6, 0xf4a27e504ea5462d, 0x00009476d8493355}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xbf7109edc645c328, 0x2457c02b9e69435b, 0x663aff19847265be,
+      0x1192888e1bca4041, 0xac5394ea4ff15d14, 0x7559d348d0850be0,
+      0x696bba8d206bcc3f, 0xb99b556eb7a0aade, 0xe8f2360fc4bd750b,
+      0x01821af26351520a, 0x2a29c88ef8f347f3, 0x000003bfecd44cb1},
+     {0x9fb3d1735a0f6491, 0x139acff4e650b227, 0xc59f9f9da160cf44,
+      0xc847f3dab32073c5, 0x74dc2b2422364acc, 0x56034d43aebe0cbd,
+      0xad19e33c510e42fd, 0xeb99d036005280e4, 0xed2584aec3458b33,
+      0xcc625763f6b23566, 0xf6391c51a2a4b6b6, 0x000175bd414742c1},
+     {0x2a582afa21ff924a, 0xa6ba55c173c447de, 0x0de0b173fc4b900a,
+      0xd5601b078a247600, 0x2550b2526c927256, 0xe51e60aeaf5edd3d,
+      0xf307c67f1061626f, 0xf674f0df35bdf662, 0x67f59dd3dbd6504b,
+      0x53babf6bf727b967, 0xddc0eda113ef9c32, 0x00013442931510a9},
+     {0x718136a5f854d9cf, 0x3604ecf89132beaa, 0xb6012eaa85da0b03,
+      0xc6350e40e5ae8726, 0x67ef2876ffbbbb8a, 0x0815b4ef85c82828,
+      0xc396434840d71565, 0x56b715dfd07f8cc3, 0xfe9199f481c96b04,
+      0x61a7d60d5812245b, 0x94fe637f6bf56093, 0x0000e66134871cbd}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xa6b3b9c6486fcf42, 0xe5dcbbf31e42c784, 0x23edaf6b47480641,
+      0x612d192044fc43d2, 0x6e230cfcd5016cb9, 0x15f529403a53c458,
+      0x700698585bb56f63, 0x1276d3039cbc9286, 0xd1511d5d773f779a,
+      0xa959b316b3ea3622, 0x35f958611e8ba16d, 0x0001a4e6a6e8b764},
+     {0xe736a44cb009f332, 0xf84a1f88454605b2, 0xa2c338f866148169,
+      0xb4fd5643a49ff527, 0xbe3e4e27413ef3e1, 0x6b6bc774244cb75b,
+      0x9945d4ba28aabf2c, 0x5ba837b51790465b, 0xa51d3ae317984395,
+      0x09eaf5b87a0a22aa, 0x70635ebcc84dcb92, 0x00001279eafbca47},
+     {0xe5ff62ad33a2f39e, 0xdd2f7ae2ba3d1d02, 0xcf6533425bd56d10,
+      0xf2d336a9047e17df, 0x6a7507cf352c384c, 0x715266acdbd66faf,
+      0x3bdb97f66c976d83, 0xf16dd35d85c824ea, 0xc182108289b1f1a7,
+      0x630a048a4d357f43, 0xeb67ef868b6b0505, 0x00001fff69d390cd},
+     {0xd7d9fc2a76d37633, 0xebb42de3ff47ed9c, 0x66f010c5bb931dfa,
+      0x3053171c1fd17bc0, 0x6822b2c8f73411df, 0x3c257aeba5ab9cf2,
+      0x60b40ce92ec05ca8, 0xb1a8f6e45e34c350, 0x9f0b9752bc6e68de,
+      0x8f1a7d89c7cb289e, 0x029dd8670696bc06, 0x000165bcf043be17}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x4eabad76aefae1b4, 0xf77f54c5141fa4f1, 0x9aada5a033d9f7d7,
+      0x0ea5433e33bce885, 0x18a59cae219b184d, 0x31b9e011d0e50a9d,
+      0xbec19cc044960d05, 0x5e84d388fea6d76f, 0x5326e27947286571,
+      0x269c0f4dc68b30bf, 0x0c71dbbd3b4034c9, 0x000123d894a34d30},
+     {0x4949a9b3e4023812, 0xdfb308bb1420ea22, 0x7bbeac4280b9755b,
+      0xedf29c63fa2f66c1, 0x84affce142b95f03, 0x978c2423b29fced4,
+      0x33f56535f4469c3e, 0xd7c88d724cd27fb9, 0xd35c2f351c7d843c,
+      0x1f20793df064d345, 0x245dd429b9d868e5, 0x0000331685708f91},
+     {0x4495b55ee452711c, 0xda08c12f56f89ec3, 0xd4c019fe18834804,
+      0xe35b0db3b6307418, 0x6f451c52ad553c92, 0x71b060821cc5e403,
+      0x67b2e17182ef90de, 0x134c5723256ba0e5, 0x5e21d66f15546271,
+      0x03dfccd57e262aec, 0x158fe43bec59356c, 0x00002717b4690b5e},
+     {0xb4da71aae1d1d281, 0x9ed62c023e74a31f, 0x9f1372b2ba03c21f,
+      0xa70557ab5f3ce510, 0x1539d9e29c9b5594, 0x5ad0f920b2b9ac83,
+      0xe4ac75c8b220bda5, 0xbe819c6e9308cbc9, 0x69cc73a1f46ae69a,
+      0x3fa813e82d85aff1, 0xa68c1a748abf5466, 0x0000acde91dba723}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xc947a9d2fc3b02fb, 0x9d225e98dcfdf03a, 0xfb242ec2f58520c7,
+      0x0f5f2ef9e0776e48, 0x2e4ecb6cdf96cb52, 0xdf1a8d8eb5bed09a,
+      0x52e054d978f2ff2c, 0x5498fe2749c1dcaa, 0x82906499abc672a5,
+      0xc2065c253787287e, 0x9ad093264a9fc9c0, 0x00001b38db5a20d2},
+     {0x03685ccecb2cb64e, 0xd6b451d36ad04e97, 0xfd3b614515f217b6,
+      0x7ae1a93865b026bf, 0xd99755168c764e8b, 0xb10b271a6ce52839,
+      0x8fc8a842716cf356, 0x208cf1994162dbf2, 0xed777eb093f0ed5a,
+      0x31123fcd7dca93a5, 0x67615bfeefcff792, 0x000115c172cbc17f},
+     {0xd00033dfcda73c54, 0xc95897a3378539a7, 0x7a0c4edaae443bb1,
+      0x9c9e5547755257ea, 0xa67ed9383ed9118c, 0x28a490401c141f19,
+      0x5dd699fdaed62825, 0xee6a13e021b880f6, 0x9867841438498e0e,
+      0xfacb0cd7c47d290c, 0xedd24c1fe385145b, 0x000076533dc770f6},
+     {0x7dcedb2a62b0730d, 0xa1dc1a2963ce16a6, 0x109fcd507a3424f0,
+      0xfd78000d3328c895, 0x03ebb6e84a0edc83, 0x1261c21dd328383b,
+      0x6a78c9ca0b1a05c3, 0x4361ea686c9b0207, 0xc83e382f95a6f880,
+      0x5e06a972926a33c0, 0xeabafd5055c302b1, 0x000185d7b44cc730}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xfedef7632539a9c1, 0x8d991e248d221e4f, 0x69c55828a84faad4,
+      0xff7008aeefcf9782, 0xb0d4dc8e15e5083a, 0x1b398f8df1954582,
+      0xdb60607c1c58f131, 0x3d1d48767439c7b6, 0xc3423ee475cbe859,
+      0x73792319ee9e346f, 0x6ace87a21561b986, 0x00000c1748f8c574},
+     {0x49677092fd0f1492, 0x63b411db120ca0d7, 0x66515d8032c022d7,
+      0xccd49ccf25b759c9, 0x30f3140be7bb4499, 0x4966124b265a888a,
+      0x1ed0a3a7f9100824, 0xbdf081d6e2e234cb, 0x70b5199df24be101,
+      0x55da410cdf1f59e4, 0x1987a1016570b33c, 0x00005b7e48657841},
+     {0x1f873d61814cc746, 0x9bb5aba2ab727ba6, 0xa6d7b10ba526c0a5,
+      0xffdb1a4c40a4720c, 0xdf191594308e3d14, 0xe9e00411923db05b,
+      0x37d9c7b52e36df44, 0xd48c2fdee7915db9, 0x40ac137defb3ed5c,
+      0xa1935343dd584eaf, 0x12a8c4afee09543e, 0x0000fe6044f0ece0},
+     {0xcf43e685a8a09daf, 0x49774def5d505694, 0x15b82b9bcc67c6ba,
+      0x504d6777e8c2db3a, 0xd52e2f182e7d2768, 0x47fc6913bbeb99bd,
+      0xdb1c32d62357a944, 0x29ee40fad7443817, 0xd72947276598fd75,
+      0x87ea55d60ac43238, 0xaf73d4b27ad86294, 0x0001047b61093f1f}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x68fd38a6b98134c4, 0xffee4ec8ff264afe, 0x4cb7e23ea2079b01,
+      0x71ed3979cfef7c6e, 0xc5a6cb8c77473a52, 0x2772fc52f7be1c0e,
+      0xc4d6ec1f526a50c8, 0x93aa5bb55faebc78, 0xa6c35ff7b4d9fc60,
+      0xabcbcb200af6b8e3, 0xb68533d33388b9ea, 0x000099e14d73366c},
+     {0xa505f9ff58c051aa, 0x9f4b28bc2409186a, 0xe120d8745b340ee5,
+      0xc56cbb23cd8f661e, 0x415ee25dc3b090a7, 0x23a754b795c2cb4f,
+      0xf6032598e37a1fc2, 0x14d0b5c5aa5cec04, 0xc8bbb1d49d10e28d,
+      0x10190d6c6c1db8c5, 0x0ccd72de0ab24ef3, 0x000044057ecd0699},
+     {0xa649c74d2ba26a3a, 0x3872187bdaf5d6d1, 0xb227d7bffb5debfa,
+      0x9eca2acc86f7700f, 0x0aeb100578fa4b4a, 0x10588c6e09843582,
+      0x3cc493bd74d48fac, 0xcee198e128414fad, 0x7f2d3c6c286becec,
+      0x9809de4636087e55, 0xe56a3cc6bfc15393, 0x000018d021b4909c},
+     {0x2d9cb66fe80f7e04, 0x5327751774b3c8e3, 0x19a24d708ebeb225,
+      0x3a01015f228b7bba, 0x1482ca951af31acd, 0xd5a43e235d2df8ce,
+      0xc04cea03a1a92c96, 0x4783172053f10e1a, 0x8cea4ef52e877f17,
+      0xc7ab9ecce523ce75, 0x0ff5405f5951367f, 0x000090a2200cf7de}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xa0198fa74f527833, 0x36b73fe0569652ae, 0xda9c8ad6ba1d167f,
+      0x36b44428ebc1c1d0, 0x532d63d4ce21f2b0, 0x4b6766b56d4bf8e9,
+      0x39633187aa342a49, 0x821f765cac0f12e7, 0x9a4a2b6c405ee88c,
+      0xf9a620c25dfaaf82, 0x69473073e1cc8142, 0x000132ab4b1a4a57},
+     {0xfe667711b3284fd6, 0x382320336b99e46d, 0x016916bd4ed5f231,
+      0x7ee6c21abd234f0c, 0x3c23d75310045b9a, 0xee869944874849fb,
+      0xf6080ddea2d56fc1, 0x6612d112159105b2, 0xb50657849e30a0ca,
+      0x1c1f6faddcf367bb, 0x68d008c49b6e073d, 0x000137a310a46e79},
+     {0x564eb13d145b2fb6, 0x2281d5a96292d695, 0xe3610425f6b98084,
+      0x17bc4b618f76fff1, 0x78ea9894f52b2512, 0xa332270138c1c3dd,
+      0xef3e8e0ecfc6c585, 0x16a97b10fb1d2c6e, 0x6d99f1f49280786f,
+      0x4ca4214e4a613eb5, 0x5c1a6f61f3b8cedb, 0x000170bb01021374},
+     {0x0ba3bb71175770f7, 0x5aeb8429e627167a, 0xe3035210af159ff3,
+      0xe9c075fe5fb43d8f, 0x66085cfe19a5c958, 0x1ce4ea363b5ded3d,
+      0x54e562bba4e47c5d, 0xff8eede82b81f8d3, 0x4916e698d6e2277e,
+      0xf0fd770038110977, 0xe047b05e6b612902, 0x000023d9fc168a3d}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xb9808108919f7c25, 0xb8ea91c824a75b66, 0xde084c3b1116cf12,
+      0x2d30f973875fe81d, 0x7eab4bde7dca2e8a, 0x2a2ac44597cd5e6f,
+      0x011496f60eb6e2d7, 0xbec9bc68fc7056f3, 0x36250738faf15100,
+      0x97e83cd5c8b33973, 0xfea09cce4bbfd75a, 0x000073f2910ae331},
+     {0xddf7e3cec1548746, 0xad989f6150a8ee79, 0x5c4477fe4e0a0af5,
+      0x25f84e2b613c5ddc, 0xd9fdf690881c1c99, 0xac440e149a0ff9c4,
+      0x5ff8ecdb466674b5, 0x1fe0880d47a717f3, 0xd1fd0e043486e235,
+      0x566af415e3993c69, 0x90d13df6d29916cc, 0x00017a357c45c9f2},
+     {0x0b8aab714a8b501e, 0xf77511a48e4a3253, 0xf2791b1a731780cc,
+      0xfd4ead56ab04c3e2, 0x4d0602574d423171, 0x8120835365fbef11,
+      0x6113a873bbc3d300, 0x1b7f8e08417da24a, 0xabdd42f07c5abc69,
+      0x52857b2f22be3f93, 0x2cc7239a12ae2396, 0x00013cafdcaadce6},
+     {0xdad55ccc4b107853, 0x9db2c7c97a022829, 0x3c65dec289e38037,
+      0x2b4ea90f79ea2a77, 0xde93a9ef932206a5, 0x86772f18d8dd4551,
+      0x3a48a07d41f348f4, 0xfc03dfad4c80c001, 0x97aa83ba38e3d4be,
+      0x163f9a518996a93a, 0xeb4fdaea0d1a4e33, 0x0000facf29a0c13e}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xdcb59e4b19cff3db, 0xc7fcf85be58e11c5, 0x5a74b560ecf8a84f,
+      0x1129576f14d1eef4, 0x3685c880420e0635, 0x64291faa3e51bd08,
+      0x28c4f503da657236, 0xe1c393aabaa1f97b, 0x575752feb3cf0a18,
+      0xc773da7b9cc6a384, 0x4168f6d855e54428, 0x0001b8242fed5e81},
+     {0x45973658d1032a60, 0x0f7f9d6194034696, 0x5338656e839347f5,
+      0xa4f9aedaa57b8226, 0xef6bfaef6f4b0171, 0x0753c696f11e7ff4,
+      0xad6321b5b01348e3, 0x1810274151028bef, 0xccea41cbde468840,
+      0x267d934b0829c387, 0x4102270b2bde53d2, 0x000186f410460720},
+     {0x1e067968ebeda554, 0x31bcb3cb4ff3c4d9, 0x707aa7e1637519bb,
+      0xada91db0ec6cea20, 0xb6217fd796110c1c, 0x1f2a0fba55283a58,
+      0xf1fd0e4df3c7f613, 0x1fc084b107c6f72d, 0x5b0e370d320a1413,
+      0xfd519672b3ead0a3, 0x103a2a6d581611eb, 0x0001428c7b494699},
+     {0xdb28e70c7da09a6a, 0xf577f49d4a873264, 0xee945db2091a8784,
+      0x886e1bb8d35490cb, 0xf42b64708ac92888, 0xc97a763506d58dad,
+      0xb8d03aa9b434cc2f, 0xa4ecae547d0441b9, 0xe560f491238d14a2,
+      0x32d51e6b52b987fb, 0x4e2756cc306d09a5, 0x00000d0f5a8ec32e}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xed5b2c180c4e2b64, 0xdf2032070a414581, 0xa5d36007bbf4abab,
+      0x2b0cefc175b19f19, 0x50cdd3ac623b85ae, 0x77855162539cbaa5,
+      0xa1f94313000767bc, 0xf2cefbefd2579df9, 0x1db100b3b1ee51fe,
+      0x1b3fb45b96f87223, 0xb9f36724aa893cf4, 0x0001bca163b354cb},
+     {0x2384620941633de0, 0x20596c88436bc7cd, 0xa7a6b77a816458cb,
+      0x64697abb6ece279c, 0x319993b9f44f1dbe, 0x15bf9bdd8038ab13,
+      0xce4ae1a1a9ba1e7e, 0xb79d372a5cf9a4e0, 0x95c6c45ba9809b0b,
+      0xf2e67cc4d9feb45e, 0x08e73d4f3c07dd95, 0x00000ce0a7e64227},
+     {0x9ed2837927e9805e, 0x83552f809a735f78, 0x72da0e2b2a167e8d,
+      0xa520b71be02cc293, 0xdefc051003a5dec8, 0xcd4328184c637a7a,
+      0xf4127a63459586af, 0xddd78225546ed6a2, 0x11739b7cdb0398b9,
+      0x44d6105aa5e424c3, 0x61fcb2a09ebdd077, 0x000007a4b89a4c2c},
+     {0xcacd5d16a0de3c54, 0x6c5a3bc7063d8b6e, 0x54ca6ef09c9962f8,
+      0x3ebd10f20e464bdb, 0xa4a81405841e4837, 0xfad16132a9793f13,
+      0x00b481ab258444ef, 0x3ba51675a4c83b03, 0x4f1f2470b163aa8d,
+      0x8eac9ec5d092a7f0, 0x04965bce1f3c5020, 0x00003055c2682810}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x4204c0b551c14a1f, 0x19a2ac209c9c261b, 0xfc0e1f21bafa3cbf,
+      0x9222978472cd2c14, 0xd5d5bb740c5af2d0, 0x7017c5d24570db79,
+      0xca3f5fbbc0c35a3d, 0x7a4e431e91b1e14c, 0x432835ac79631b2e,
+      0xac7f5f20b72e4075, 0x3acf51af29b56b13, 0x000191ca030af2ee},
+     {0x8cfcd2ee484fcd8a, 0xcb8dba029be6cc2b, 0xb0d30f64574bfb77,
+      0x4a022e1bb210e137, 0xdb26ce1c9b3db84a, 0x9044b9b851ff6133,
+      0x93a1c0861b8a17c4, 0x83473f88520b69a7, 0x1c88bdfa85c9446c,
+      0xb2dc9b3d2a6ea0b8, 0x815f243ec299762a, 0x0001a7fac57b095c},
+     {0xb96cb21dde61d65e, 0xb9e2029cee815dd1, 0x9eea8385e6be733f,
+      0x6d0e9a4b2533e92b, 0x41a9f66ca9ecdf07, 0x768f0ef16e6b61eb,
+      0x9c94cd7e46bc30a6, 0x1986ca93b8a900dc, 0xa8794918d28ff35f,
+      0x5f30bc9cd1da191b, 0x3cd76c5672c111f6, 0x0000edd68707cc0c},
+     {0x2a35dd2528d2c9b9, 0xd44da1b2f3b9fc61, 0x1ad0cfc56b07e07c,
+      0x0b6e5caa491be4bf, 0xae39d1cd6b54e242, 0x9d0fa70c43ee0237,
+      0x0c5a14ea1f840321, 0x28a16aefe524dc87, 0x526905b46f45f7bd,
+      0x1b87e9a64b836d41, 0xca9a67e12246a5b6, 0x0001badf686567fe}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x6ac96d5d4009edb9, 0x98facd2428ef5b1e, 0x02ed1569fd7baed0,
+      0x0709e6b923b0edfb, 0xf94c235e662b7aac, 0x8cdb6d066896d649,
+      0x797bc996e8180689, 0x52f1208598535a48, 0xd1298d5b50af9f51,
+      0x3417bc00d2167284, 0xc303e4eac8cbd644, 0x00010f0b46b8e4bd},
+     {0x77053b0bf8fcabf7, 0x2ccc6007480c0a54, 0x0a715fdcb5fb1040,
+      0x408f495409ec9e2c, 0xc96fd4e37e7963d4, 0x588a22e862f716fe,
+      0x4a9fbe88f7868700, 0x369145598fed59f7, 0x3748eed9cec5f552,
+      0x277a0f63f0f4ee0e, 0x98e86b395868c6a8, 0x00007e3999b25719},
+     {0x0ea67e106f326e78, 0x652e5510bad37f5f, 0x36997ac26d3e08b8,
+      0x74e0491874cecf39, 0x785adc196db1c967, 0x8eea9dd1a38ee9a3,
+      0x4dcb502947f50fea, 0x8eb530ebab1fb1de, 0xb44ea12a7605f88a,
+      0x895cad7581a00f31, 0x7bc68415386aec41, 0x0000d2d065ee7743},
+     {0x952328e2cfec3e6b, 0x715506c79a879f15, 0xcdc3e68ebf6664ca,
+      0xe2d3c60d107da30a, 0x28b133894e182211, 0x41deb8fc87373077,
+      0x4a189df628610a14, 0xdbbff9d5775785ba, 0xd2a1825344d09043,
+      0x6da20757cc2f483f, 0x09c38482194268e8, 0x000126d458d985fd}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xd01bd09ca8be5a51, 0x8a077842dabb6ead, 0x1745e318b4a6569b,
+      0x27cc51be303d9b34, 0x053ce8f45cb67418, 0x319e0ec5338af36e,
+      0x115de69436c273c3, 0x6b97098bdd8959e2, 0xfa6c496dee410ce9,
+      0xee628f047d1b1c95, 0x9fdfd2ed352460e4, 0x000130bbfd54c179},
+     {0x80f60c4e6b022588, 0x211263330af4ddb9, 0xeca25bf0353abfb0,
+      0x50fd1b0815f5dedd, 0x48e12008d2cca4dd, 0x7882b6f6c6b73939,
+      0xb58ffb76578e81db, 0x49cc2f02ae13e227, 0xe82922a27a54042a,
+      0xe5bbbad4a2dec49e, 0x6cb1271b94099a45, 0x000003cd7765100d},
+     {0x62ebbe20c16bda83, 0xd929974810f61e1c, 0xa0e321f1435df4aa,
+      0x8f89993df8fafc68, 0x5b023fe2eae52f85, 0x4b6a538414e1dcfe,
+      0xf06c2e59d16013da, 0x506f90d37af858b5, 0x80d63f82962bfd77,
+      0x6cb72dc1b161ca71, 0x3d6a079011e337ba, 0x0000dc1551710f38},
+     {0x5c239420efd5b3fe, 0x515bf6b91edca3ba, 0xf3b96bfd666f9281,
+      0xa8393a8df8c3c1e6, 0x7ba148465c2afc31, 0x5ca2066a90bee9cd,
+      0xbb971fba488cd9ab, 0xb29d82b9b2348b3f, 0xe919b58191f93c35,
+      0x2c23bab62d1f1b2c, 0x26a413d8b99b1b08, 0x00002a34f102055e}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xd84c2af0cd54d44f, 0x18329bbf93d1c921, 0x688fab2b9b3d4742,
+      0xcda26570226d4ace, 0x0477418f671e569e, 0xa5a5924406d5eded,
+      0x60da2ce37a1dadd5, 0x129c8f58db4e9469, 0xde4382156958568a,
+      0x9854d9a81a5abf15, 0x4bf0fad4dffde9a7, 0x0001275dc8a29f1a},
+     {0x94c621ad97870b0e, 0x7a9531ec7f2c0470, 0xf892d13d8e9095f7,
+      0x7825d33015a25f2c, 0x8333ceecc2af8eef, 0x19f6d2e19138712c,
+      0x610922e98c0eebe4, 0x20d8bc37b868c4d2, 0x4ad013ab8a185fff,
+      0x3c29b627b3efa980, 0x0902864aa7186327, 0x00010e8db96a4005},
+     {0xa0b3c4af90a95ffc, 0x7957aa56e6382ea2, 0xb56ed322144477db,
+      0x9bc86e48958f15a4, 0x04e0d1b555dd0eda, 0x8a33b0338da5ad5d,
+      0xca2149e95d21ff1f, 0xfa045a83589096a4, 0xd328e86b8e17c3b9,
+      0x0451eda7c804293a, 0x4ab3cb272cde1a9d, 0x00016497e3ec888b},
+     {0xaac914d97ee7c1e1, 0x955fc94934d8d1dd, 0x9180c0fec9004572,
+      0xf81c7ff6d44b0c99, 0x859fa966f8e39f5e, 0x9a4ac2fcb73f9df7,
+      0x97a39dd9553299e2, 0x6db2fb8615eae55e, 0x767c20383fd6afa3,
+      0xa696c4233f5930b3, 0xbe6c90478be146a3, 0x000068270c84c752}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x69286fbeb010e788, 0x44853ac79b143816, 0x95315d97ad2be787,
+      0x4addd78914a1f54f, 0x3192872168acd338, 0x7d3bb9101b0112b0,
+      0x4733ff9b7d3b9401, 0x3a931adc1b032261, 0xe334bf569fce6617,
+      0x6f749d158329b585, 0x2da182e98e623cf3, 0x00008bc774675e19},
+     {0x25578783f1583973, 0x1178054fc3473937, 0x788297f718c494bd,
+      0x16266f0424e43f30, 0x80bc4322f39a10b3, 0xe8c6b49f326dcd95,
+      0xb9292b33ef092861, 0xf2d9864a1b512637, 0x55973ac9453e734d,
+      0xcaaddb03d841a5f5, 0xe8db82bef0aff235, 0x0001222974bfe9c6},
+     {0x7a52dcef999183d2, 0xcea9007e31d95437, 0xfddccb9a101f6052,
+      0xa5135b9551d6cb1d, 0x0fb0e0e2f3649919, 0xd2fb90f4f99a62f1,
+      0x721c7ae907b31d13, 0x8c09336011f4ddae, 0xc09d812ec07a9467,
+      0xb21b9bdee3dc2e26, 0x264d6b4b93b979df, 0x0000ca2af096187c},
+     {0x49515f8aaaafa0d3, 0x6051db73eba744ce, 0xc2e8156f94ccb60e,
+      0x32e8b10c5056afc7, 0x613c17d978577a6e, 0xcc90b8b7331bb9d9,
+      0x078fd97930e10650, 0x28f702d04f142e97, 0x5df4802b83a8ffbd,
+      0xd51fcd21e8b5a2ce, 0x2576f9d0da8e4258, 0x000153feac2a897c}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xb3ffb8d69bb7a0bc, 0xbdf988f76cefc871, 0xc9e3ef769a61d083,
+      0xb7427a6b8eb9a0d3, 0xef91c77a148c2226, 0x6a52b0646f8b6733,
+      0xba2b62cd74fe43d9, 0xd2f74bb6cb1fc716, 0xa431d22fd303f54d,
+      0xd5c4a05b6804ce8f, 0x367f689a9e9427b3, 0x0000e7c31bc608bc},
+     {0x4d354de77534a0fe, 0x2c72b5fcd523c718, 0x50180e935262bd24,
+      0xfe76682efac87a79, 0x4a45aa7119b28cb3, 0xa19465fcb7f60a86,
+      0xe602120670fb1279, 0xe9caff4d9020ca67, 0xe447d4a826d4653d,
+      0x176bd4ff0bd987d6, 0x9bac964077e97213, 0x00016743d6f78978},
+     {0xe395eb299ab0edbb, 0xfca57e3f576c0792, 0x8b5b4786777d11ac,
+      0x401b64b9ba06f2ba, 0xfd087ec11a40ca3d, 0x5eec028762b6cdd6,
+      0xce3f69e0f2d18c54, 0x4104f3cf65b90887, 0x170d480972e66635,
+      0x2e808235e3b47455, 0x68a99837f8d93f6a, 0x00013a9a5371ca3f},
+     {0xd64fc8ac98db4e26, 0xc02f71f5fc34be0b, 0xc1e817d329c4b084,
+      0xdd0c744c8dd953fd, 0x941603cb5335878d, 0xb2f61c55e79b9a42,
+      0xe8224908f1224e6e, 0xb02c58580376bee7, 0xb749b3ac05cddabd,
+      0x2779d0b2f300647c, 0xf9095cd9e01708ee, 0x0001802f7b750194}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x50e50a92a13a489b, 0x3afc3791e9e80e9d, 0xb7b11fe6ff9d5e44,
+      0x850ca1103e150854, 0x1378305392eaeddd, 0xe76dc953bd9c17f3,
+      0x335796f64d46ef9d, 0xd544b48436a9e254, 0xfa6998065941a37d,
+      0xbd639c41427e838c, 0x16c1a19f358d32b6, 0x0000586e29d452c0},
+     {0xde097f292b288247, 0x06c28f783a8a3653, 0x62bf2d15159cf158,
+      0xd15d67d452817534, 0x2d5a7121b039497f, 0x15442182bd1af7b9,
+      0x220e01c664e414cb, 0xc0848473e3c4d0c5, 0xaf1b14fe9cbe8dd1,
+      0x3e3c5789740b799b, 0xfc41de5d118d50bd, 0x000018c57870fc60},
+     {0x1aeacdb75ae19f59, 0x2d0ac33847809fc6, 0xed9bfc831bc06e58,
+      0x94d93697f73b08cd, 0xf28a67dde701c5f9, 0x95fa036e74919bdb,
+      0xd1302c30462f3433, 0x73e046408db564ec, 0x9e0e589e4b64b0d3,
+      0x6335041096eeefc6, 0x397a34f31cd63070, 0x00008a1d810a79cf},
+     {0x0519832d5ce2d843, 0xbc9a6875a3af80ce, 0x06aca92a790ea3a8,
+      0xa040edd4babcbe45, 0x4ebe5ffec5acbdaf, 0x301793b59877c284,
+      0xc37ff53006c2b7cb, 0xfd762469e77c3d92, 0xe1128cd76adf89eb,
+      0x6cc721b2543577cb, 0x436339c54d3a689e, 0x00012b1b8c0c0f07}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0xf542b7786a8e773d, 0xb2fefe22a377ac32, 0xc911f6121aae021d,
+      0x9bcff5ae71930287, 0x1c23cf3b0996f4a7, 0x314cd211831f5812,
+      0x34176aae124dbe61, 0xafecfed38d54a5f7, 0x92c6b83353b4e34d,
+      0xca326e0a8e765dbc, 0x8a5a1e838dbd3f26, 0x000050428d378d97},
+     {0xfc1ca8881ee4aa70, 0x74b56786708d29a2, 0x2e2db9dbbad23848,
+      0xcf2f387573c508fa, 0x93e38923b14f5a3d, 0xcd815172cdc5d02a,
+      0x5699303774c73505, 0x28a3718bbb77c804, 0xbb4db87732633fc4,
+      0xf8c8836453a83df0, 0x41f4f2e6b3fc4a4d, 0x00000bdd746ac70f},
+     {0x889e83c82da1fde9, 0xf276a60a3874c866, 0x3044d6452721bf49,
+      0xe42582ff25e34d32, 0x6caddebe3b8ef40b, 0xc95c74fb55f6ea8a,
+      0xf06d264c818a7363, 0x3aebf7f0d2435381, 0x2e674f48d17e82e8,
+      0x1fbe931f44d632f5, 0xe279d19295bafa00, 0x00013f76a21d62aa},
+     {0xa26d11286b333d40, 0x6100eb5ee3f8890c, 0x1165907dcd528c85,
+      0x17538f66d448af4a, 0x2e96cff0c3995957, 0xc18c15f4b06cb45e,
+      0x061882cb3e1cf0a2, 0x8e3f9ad151b87d94, 0x11ea843b2c43b40a,
+      0x8dfe66d934b8638e, 0x139b12123bc022ea, 0x00003a4efd38e318}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x8b7b82500bb6381f, 0x3e01a99d88afc38b, 0x2039b8304975c5d9,
+      0x446b9d1feab58bab, 0x622df9f339376780, 0x924b6805707031c3,
+      0xd2bf62b0825a413f, 0xcf5011e483452fd7, 0x1a48395b43faedbd,
+      0xabab3a993c6c2279, 0xb4036a12642b0866, 0x00018cb85f431405},
+     {0x0aacf55ca282a775, 0x3178ba3b8eb95d74, 0x2c2994317dbe4b26,
+      0x25d1a2a3a870abc2, 0x72b544d8429669c6, 0x876589d7911ca254,
+      0x93fcac953007b5ac, 0xe740bd574dbf6642, 0xf40ad73d9025e275,
+      0x514893e5c1dd20c7, 0x0325384ec6eed2fd, 0x000167836a4b6e4c},
+     {0xca419aaa00546f02, 0x93dfd9440ca88c7b, 0xa1da98697d78a709,
+      0x438917c5e2e57f39, 0xb8ca51730a96b799, 0xf895cd9a0a0a67c7,
+      0xb6dddb9b6e449939, 0xaca8e16a0447872e, 0x231ea270dd9d84ef,
+      0x261fa1fe73772157, 0x5b326a58fd9343b6, 0x0000c71fd6818652},
+     {0x4f139f97c863c455, 0x14c5009f84c5b3a4, 0x4d8dd66c02535e1e,
+      0xf60e75c887dd44e0, 0x41ee635cfa286d9c, 0x274e4c76be98df77,
+      0x245a37046ea93f91, 0x49410ed7544cef6e, 0xffd816606360c066,
+      0xc930f815cb57a9af, 0x174f97c40989c430, 0x0001918719fffbe1}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x70307a204d0b9abf, 0x21d2676e004b826c, 0xc0225e6c86e315b0,
+      0xcac7b8709eca81fc, 0xcfefdd76d7772dad, 0x594fb03fd9406ace,
+      0xd70581224bf46ef3, 0x7c24c8de0780704d, 0x5e8993fc49517db0,
+      0x88db56232c854898, 0xa57201610c3c0040, 0x00004b074b1e7340},
+     {0x8b8059583e5a76ce, 0xf0110b76e526b788, 0xc301436d4ce44a69,
+      0x8ca3ce97ff41c32f, 0x87b1c696d83a2128, 0x8345a54b3e2f930c,
+      0xdbce97425389b081, 0xe18a588328ca8b68, 0x6a0ca823d41eb9de,
+      0xe65b2a23c38108e6, 0xadb5a3b9714e1eb9, 0x00002c734a965e65},
+     {0x8a014f9c3c0e3813, 0x1c151c8e25539545, 0xf907f500e4267b7f,
+      0x4aad12e1d99735e3, 0x9b269e22c36b3953, 0x7dd6ddfd7659b2aa,
+      0x036b470a033ebd40, 0x44c3c61ad4ac324a, 0x2a9de9c513aa9107,
+      0xd4a2c15abac39b68, 0xbbaf55be53325ee9, 0x0000c99bb7694c86},
+     {0x213dd576224b2532, 0x0dcb837101b07bb1, 0x5598f246700a41be,
+      0x0a5df395aae895a2, 0x87cc11b3c92675af, 0x88d7d7f16cb1cdc7,
+      0x00caae8487775e66, 0xa0249d0935e042ef, 0x9316fd9e8c447026,
+      0xbc71757ec235b7a7, 0x1a9dc6730b9077aa, 0x0001b0ec4457d655}},
+    {{0x9420b1d00ba64494, 0x9f0cf8a568174abb, 0x77a9300bb0970e9b,
+      0x7c2a0642df7a1cce, 0x329ea97aeeb30b50, 0xd1a3064840998df6,
+      0x1c8558ce61cf3948, 0xb98d5fb5114a4f5c, 0x056289c8f0178f87,
+      0x96bfe21cb5967778, 0x26d8252712fe0424, 0x0000cef8f1aa3bb2},
+     {0x3b53e099a3880fb5, 0x4f421bd66a8bf68a, 0xc8053b26fba16148,
+      0xf4b62f7a03d58ce4, 0xaf662d273a44604a, 0xa2e6b29dece698cd,
+      0xfabc4cb9f3189941, 0xc6874deab7a5549c, 0x15d338d31cc65c8a,
+      0x06e9ae6d96f73af4, 0xf40188ecc891e053, 0x000063cbc7233b2d},
+     {0x1558994df18ba997, 0x4ef0f62de744a365, 0x131067c304145fd4,
+      0xaffbd7cacd515120, 0x17a26bed490253c9, 0xa8c02b4400b32e30,
+      0x9c6ba26000558a39, 0x69b19d2cdc9e7809, 0x51d7467a24ab2111,
+      0xc32d531b69d922e7, 0xf0a82e2cd14fc500, 0x0001047c1a7d6e84},
+     {0x044b22320934a749, 0x3dff1549196681f8, 0x98f33755a0fff976,
+      0xb4ab61fba49dc1b8, 0xac77951b14ce2019, 0x0723cb6fee90f1fb,
+      0x13144c0504517ad2, 0xcae8799a11d8ef3c, 0x8a8118a9895636a5,
+      0x3405755c663c887a, 0x792ac369603a1611, 0x00012f8c9e89cd08},
+     {0xb89f2aaa6309d675, 0x73f614541576ddc2, 0x54f5665da649f667,
+      0x40a4aa81b019aa2c, 0x4d37980f6598fbaa, 0xd4320c13c33b43a1,
+      0x7aa4a93f831b4ab5, 0x273d93444c6257a5, 0x46f62db219c75e05,
+      0x26537782cabce70c, 0x3e2a4db309a018df, 0x0000e0aae7a279cc}}};
+#else
+static const fe_packed MDS_sparse[partial_rounds][2 * sponge_size - 1] = {
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x1c, 0x12, 0xc0, 0xe9, 0x5b, 0x9d, 0x53, 0xfb, 0xb7, 0x83,
+      0xd7, 0xc4, 0x3c, 0x6d, 0x88, 0x2d, 0x5d, 0x1c, 0x0e, 0x60, 0xa1, 0xb7,
+      0x54, 0xb1, 0x98, 0x62, 0x28, 0x7c, 0x1c, 0x3c, 0x76, 0x9f, 0x0b, 0xe0,
+      0xc2, 0x80, 0x2c, 0x2c, 0xcc, 0x29, 0x99, 0x45, 0xea, 0xa7, 0xc8, 0x15,
+      0x28, 0x98, 0xa7, 0x1c, 0xac, 0x3d, 0x05, 0x97, 0x3e, 0x67, 0x99, 0xa0,
+      0x46, 0xaa, 0x09, 0x7f, 0xfa, 0xf8, 0x61, 0xdc, 0x9c, 0x2a, 0xa0, 0x9d,
+      0x7c, 0x0a, 0x3a, 0x96, 0x89, 0x96, 0xc2, 0xfc, 0x0c, 0xc3, 0x0c, 0xcb,
+      0x0b, 0xe2, 0x5a, 0x04, 0x29, 0x18, 0x01, 0x31, 0x71, 0x70, 0x85, 0x81},
+     {0x00, 0x01, 0x41, 0x01, 0x1c, 0x47, 0x0f, 0x39, 0x57, 0x35, 0x6f, 0xef,
+      0xe4, 0x4d, 0x00, 0xeb, 0xf9, 0x07, 0xba, 0x71, 0x91, 0xec, 0x54, 0xff,
+      0xc3, 0x8b, 0xd1, 0x3c, 0x67, 0xac, 0xc9, 0x13, 0xfc, 0x95, 0xc9, 0xdc,
+      0x3e, 0xa2, 0xd1, 0xa5, 0xfd, 0x43, 0x48, 0x0a, 0x18, 0x56, 0xeb, 0xb6,
+      0xe0, 0x66, 0xe3, 0x4b, 0xc5, 0x71, 0xf3, 0xa5, 0x58, 0xef, 0xe7, 0xe3,
+      0x35, 0x1f, 0xd1, 0x99, 0x4b, 0x06, 0xa0, 0xa8, 0xdc, 0x66, 0x6b, 0xb2,
+      0xdf, 0xe6, 0xff, 0xe7, 0xf2, 0x3c, 0xe6, 0x7d, 0x84, 0x44, 0x2d, 0xec,
+      0x29, 0xae, 0xbf, 0x68, 0xd4, 0x9a, 0x9c, 0x4a, 0xa7, 0x40, 0x55, 0xb4},
+     {0x00, 0x01, 0x8c, 0x52, 0xbb, 0x23, 0x9f, 0x0a, 0xd5, 0x0e, 0x8f, 0xba,
+      0xa4, 0xe6, 0x98, 0x05, 0x75, 0x44, 0x44, 0xae, 0xc6, 0x47, 0x2c, 0xa0,
+      0x84, 0x69, 0xdf, 0x43, 0xf1, 0xc3, 0xba, 0xb1, 0x09, 0x6a, 0x43, 0x38,
+      0x59, 0x78, 0xa3, 0x77, 0x4b, 0x7e, 0x54, 0x1d, 0xc1, 0x9b, 0x01, 0xd1,
+      0xd7, 0x2b, 0x23, 0xc7, 0x3c, 0x24, 0x9c, 0x7a, 0xc4, 0x01, 0x63, 0x20,
+      0xf6, 0x98, 0x19, 0x15, 0x84, 0x44, 0xd5, 0x54, 0xa3, 0x89, 0x28, 0x3f,
+      0xbb, 0xe3, 0x6d, 0x58, 0xda, 0x2b, 0x6b, 0xf7, 0xa7, 0x78, 0x41, 0x44,
+      0x76, 0x72, 0x67, 0xaf, 0x54, 0xc6, 0xe4, 0x4a, 0x59, 0x2a, 0x4f, 0xae},
+     {0x00, 0x00, 0x01, 0x44, 0xf0, 0x9e, 0x46, 0x16, 0x93, 0xef, 0x4b, 0x39,
+      0x05, 0xb8, 0xfb, 0x81, 0x69, 0x52, 0x3b, 0xa8, 0x72, 0x47, 0x2c, 0xc8,
+      0xb8, 0x66, 0xb2, 0x3e, 0x94, 0x51, 0x6f, 0x0a, 0xd6, 0x02, 0xd4, 0x8c,
+      0xc5, 0x69, 0x44, 0x2d, 0x76, 0xba, 0x3d, 0xe3, 0x28, 0xa0, 0x9f, 0xd0,
+      0x8b, 0xec, 0xdb, 0x9d, 0x03, 0x18, 0x68, 0x11, 0xe2, 0x76, 0x2d, 0xd9,
+      0xa3, 0xcc, 0x59, 0x80, 0x81, 0xa3, 0xc2, 0xc6, 0x41, 0x3b, 0x32, 0xf0,
+      0x08, 0xe0, 0x73, 0x62, 0xfd, 0x2d, 0x0e, 0x80, 0x53, 0xa9, 0x5b, 0x05,
+      0x93, 0xc7, 0xd3, 0x45, 0x4b, 0xba, 0x45, 0xda, 0x9f, 0xc8, 0x4c, 0x7b}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x4f, 0x55, 0x42, 0x5d, 0xb0, 0x24, 0x0a, 0x68, 0x1a, 0xb2,
+      0xc7, 0x92, 0x11, 0xdd, 0x52, 0x7c, 0x23, 0xc7, 0xdb, 0x2d, 0xe1, 0x7c,
+      0x60, 0xc0, 0x62, 0xdd, 0x55, 0x74, 0x22, 0xa5, 0x75, 0x2d, 0xf3, 0x79,
+      0x81, 0x54, 0x5d, 0xcb, 0x8c, 0x5a, 0xf2, 0x68, 0xab, 0xd6, 0x04, 0xb9,
+      0xd6, 0x0b, 0x83, 0xb9, 0x21, 0x99, 0xc4, 0xff, 0xfe, 0xfe, 0xe6, 0xec,
+      0x11, 0xe5, 0x43, 0xed, 0x9b, 0x1d, 0x6e, 0xbf, 0x7e, 0x52, 0xcc, 0x7b,
+      0x84, 0x65, 0xe4, 0xc1, 0x92, 0x33, 0xb0, 0x46, 0x74, 0x9a, 0x9c, 0x92,
+      0xc6, 0xbf, 0x81, 0x87, 0xab, 0x2e, 0xad, 0xb7, 0xad, 0x62, 0xb0, 0x5a},
+     {0x00, 0x00, 0x47, 0x6c, 0xe0, 0xf8, 0xa6, 0x13, 0x9e, 0xd2, 0x3d, 0xaa,
+      0xca, 0x8b, 0x92, 0x85, 0xed, 0xbd, 0x4c, 0xa3, 0x55, 0x4a, 0x6c, 0x27,
+      0xde, 0xa9, 0xbe, 0x04, 0x38, 0x31, 0xef, 0x82, 0x82, 0x20, 0x9d, 0x00,
+      0xd8, 0x70, 0x92, 0x81, 0x9f, 0x86, 0x29, 0x57, 0xe8, 0x51, 0x87, 0x7c,
+      0x35, 0xca, 0x0e, 0x4b, 0x2a, 0x7a, 0x29, 0x16, 0xc2, 0x74, 0xae, 0xb8,
+      0xd8, 0x22, 0xf3, 0x57, 0xda, 0x24, 0x15, 0xd6, 0xbc, 0x1e, 0xc1, 0xcd,
+      0x47, 0x60, 0x71, 0x04, 0x09, 0x50, 0x3b, 0x69, 0x5b, 0x0b, 0xee, 0xc3,
+      0x30, 0x8f, 0xb6, 0x63, 0x19, 0xb9, 0xbc, 0xcd, 0xa8, 0x61, 0x31, 0xbb},
+     {0x00, 0x01, 0x96, 0xd2, 0xb1, 0x11, 0x6f, 0xc1, 0xcd, 0x41, 0x77, 0xd2,
+      0x90, 0x66, 0x60, 0xde, 0xcf, 0xf8, 0x17, 0xac, 0xa6, 0xe5, 0x1a, 0xa2,
+      0xd7, 0xca, 0x33, 0xdb, 0xc5, 0x3d, 0x39, 0x5d, 0x0f, 0xbe, 0xfa, 0x40,
+      0x27, 0x4a, 0x8a, 0x32, 0xf3, 0x03, 0x17, 0x29, 0x06, 0xad, 0x38, 0xa2,
+      0xdd, 0xbd, 0x74, 0x55, 0xd5, 0xe1, 0x7f, 0xb5, 0x62, 0x45, 0x06, 0x69,
+      0x5c, 0x51, 0xb6, 0x70, 0x87, 0x89, 0x7f, 0xc8, 0x70, 0x4f, 0x67, 0xf9,
+      0x72, 0x3d, 0x56, 0x73, 0xfc, 0x6c, 0xa7, 0x8e, 0xfa, 0xb6, 0xad, 0xea,
+      0xc2, 0xe0, 0xa7, 0xec, 0xfe, 0x8c, 0xbd, 0xa9, 0xd7, 0x65, 0x96, 0x76},
+     {0x00, 0x00, 0x80, 0x0f, 0x1c, 0x3a, 0x19, 0x92, 0xd8, 0x67, 0x4a, 0xbb,
+      0xc3, 0x53, 0x67, 0xd5, 0x85, 0x3f, 0xff, 0x62, 0x97, 0x1e, 0x26, 0xe7,
+      0x92, 0xb7, 0x2d, 0x9d, 0x5a, 0x58, 0x43, 0x71, 0x81, 0x77, 0x50, 0x77,
+      0x39, 0xa3, 0x97, 0x75, 0xec, 0x0f, 0xca, 0x8a, 0x8e, 0x36, 0x32, 0x49,
+      0x32, 0x85, 0x29, 0x48, 0x57, 0x66, 0x9a, 0xbd, 0x46, 0x48, 0x3b, 0x5e,
+      0x39, 0xfb, 0x23, 0xe3, 0xf5, 0xa7, 0xa9, 0xeb, 0x26, 0xa6, 0x79, 0x5f,
+      0x5b, 0x25, 0xff, 0x55, 0x67, 0x71, 0x22, 0xb8, 0x27, 0x33, 0xa0, 0x42,
+      0x98, 0xd9, 0x9a, 0xd6, 0xfc, 0xf9, 0x62, 0x59, 0x8b, 0x87, 0xa1, 0x27}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x72, 0x81, 0xeb, 0xdf, 0x2a, 0x66, 0x16, 0x29, 0xaf, 0x54,
+      0xbe, 0x81, 0x03, 0x12, 0xfa, 0x32, 0x20, 0x72, 0xb6, 0x7b, 0x3f, 0x46,
+      0x85, 0x47, 0xd2, 0x78, 0x2a, 0x54, 0xa7, 0x9d, 0x10, 0xcd, 0x72, 0x31,
+      0xca, 0x04, 0x4d, 0xda, 0xbf, 0x46, 0x5c, 0xde, 0xdf, 0x0e, 0x5d, 0x01,
+      0x78, 0xe9, 0x0b, 0x2a, 0x31, 0xf3, 0x66, 0xe2, 0xd6, 0x98, 0x7a, 0x17,
+      0xcf, 0x2a, 0x79, 0xe6, 0x63, 0xaa, 0x04, 0x61, 0x08, 0xc2, 0x13, 0xf4,
+      0x16, 0x20, 0xc0, 0x15, 0x04, 0xe2, 0xbb, 0xea, 0x1a, 0x29, 0xfb, 0x3b,
+      0x35, 0x54, 0x5a, 0x2c, 0xfd, 0x29, 0x05, 0x5b, 0x87, 0xeb, 0x0a, 0xd3},
+     {0x00, 0x00, 0x85, 0xed, 0x2c, 0x3b, 0x0e, 0x4d, 0xe0, 0xdf, 0x14, 0x0c,
+      0xb6, 0xea, 0xe0, 0xcd, 0xee, 0xe0, 0x3c, 0x4b, 0xcf, 0x66, 0xd7, 0x32,
+      0x7a, 0x5e, 0xee, 0x9d, 0x1e, 0x05, 0x3a, 0x4a, 0xaa, 0x68, 0x9b, 0x26,
+      0x08, 0x6c, 0x7c, 0x8d, 0xdf, 0x0c, 0x6c, 0x92, 0x17, 0x9f, 0xb4, 0x1a,
+      0xa3, 0xe6, 0x21, 0xe7, 0xaa, 0x40, 0x2d, 0x6b, 0xb5, 0x56, 0xea, 0xbf,
+      0xb4, 0xd0, 0x9a, 0xd0, 0xb4, 0x64, 0x28, 0xe6, 0x9f, 0x8a, 0x57, 0x7c,
+      0x98, 0x03, 0x04, 0x41, 0x35, 0x11, 0xa1, 0xe8, 0x1e, 0xaa, 0x81, 0xc5,
+      0xd4, 0xdc, 0x24, 0x6d, 0x0d, 0x87, 0x7c, 0xdf, 0xda, 0x0f, 0xc7, 0x38},
+     {0x00, 0x00, 0x9d, 0xe8, 0xff, 0x46, 0x9f, 0x7f, 0x47, 0x16, 0xa2, 0x01,
+      0xe5, 0xfd, 0xf1, 0xfb, 0x55, 0xb2, 0x60, 0xb1, 0xcf, 0x59, 0x6b, 0x08,
+      0xe4, 0x3f, 0x81, 0x28, 0xf8, 0x91, 0xb9, 0x95, 0xc3, 0xc5, 0xf9, 0x83,
+      0xd7, 0x36, 0xac, 0x4e, 0x3e, 0xd3, 0x38, 0x24, 0xe9, 0xb0, 0xb1, 0xe0,
+      0x44, 0x84, 0x38, 0xdc, 0x27, 0xcd, 0x62, 0xa1, 0xad, 0x81, 0xec, 0x9f,
+      0x56, 0x93, 0x7f, 0x4a, 0x3d, 0x62, 0x07, 0x2d, 0x31, 0xdb, 0x9b, 0xc5,
+      0x0a, 0x16, 0x79, 0xa1, 0xfb, 0xcf, 0xb6, 0xeb, 0xd7, 0x2d, 0x2c, 0x6c,
+      0x7a, 0xf3, 0xb6, 0x0a, 0x9f, 0xa8, 0x9b, 0x1b, 0x64, 0x84, 0x03, 0x68},
+     {0x00, 0x01, 0x8f, 0x61, 0x94, 0xef, 0xb3, 0xc0, 0xd1, 0xa0, 0xea, 0x2d,
+      0xce, 0x0c, 0xa6, 0xce, 0x1c, 0xfa, 0x7a, 0x2d, 0x41, 0x83, 0x02, 0xe8,
+      0x93, 0x89, 0x0f, 0x52, 0x53, 0x46, 0x52, 0xf4, 0xc6, 0x64, 0xf9, 0x84,
+      0x5e, 0x90, 0x4f, 0x9f, 0x5a, 0x4d, 0xc0, 0x9a, 0xb6, 0xa1, 0xe0, 0x9f,
+      0xad, 0xfb, 0x56, 0xf9, 0x96, 0x5f, 0xeb, 0x7a, 0xea, 0xdb, 0xfa, 0x84,
+      0xaf, 0x5a, 0xc1, 0xc1, 0xe9, 0xd2, 0x6c, 0x9a, 0x04, 0x15, 0x03, 0x67,
+      0x49, 0xc9, 0x9a, 0x91, 0x5d, 0x64, 0x20, 0x99, 0xfb, 0x2b, 0x50, 0x01,
+      0x49, 0xf6, 0xbb, 0x5b, 0x64, 0xaa, 0xd9, 0xc4, 0x3d, 0xb5, 0xa8, 0xe2}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x13, 0xde, 0xcf, 0x9a, 0x6b, 0xb0, 0xe7, 0xd3, 0xa9, 0x32,
+      0xd5, 0xc1, 0xb0, 0x4e, 0x86, 0x57, 0x5f, 0xe1, 0x0d, 0xd9, 0x55, 0xca,
+      0x58, 0xcd, 0x32, 0xf5, 0x00, 0xbb, 0xfd, 0xd9, 0xc2, 0x17, 0xc6, 0x21,
+      0x6b, 0x53, 0x27, 0xa4, 0x3d, 0x1b, 0x72, 0x09, 0x1b, 0x1a, 0x88, 0x87,
+      0xdf, 0xfd, 0x36, 0xf4, 0x27, 0x6c, 0x25, 0xd7, 0x99, 0x68, 0x90, 0x59,
+      0xb1, 0x10, 0x65, 0x1a, 0x93, 0x16, 0x2a, 0xeb, 0x1a, 0x91, 0xb0, 0x28,
+      0xe3, 0x35, 0xaf, 0x83, 0xa4, 0xd2, 0x91, 0xba, 0xf8, 0x58, 0x8b, 0x53,
+      0x13, 0x2c, 0x74, 0x3d, 0xec, 0xa3, 0x24, 0x58, 0x05, 0x64, 0xff, 0x35},
+     {0x00, 0x00, 0x0e, 0x12, 0x20, 0xd1, 0x56, 0x2b, 0xfe, 0x0f, 0x2a, 0xb3,
+      0x2b, 0x5c, 0x39, 0x2b, 0x7a, 0x85, 0x86, 0xcb, 0xbd, 0xe8, 0xc9, 0x21,
+      0xfc, 0xba, 0x53, 0x6d, 0xd7, 0x66, 0xa4, 0x2a, 0x51, 0x62, 0xc8, 0x69,
+      0x5b, 0xea, 0x00, 0x40, 0x36, 0xc9, 0xb5, 0xc0, 0xe8, 0x64, 0xf9, 0x61,
+      0x1e, 0xa1, 0x58, 0xc8, 0xe9, 0x91, 0x57, 0xa7, 0xb6, 0x1c, 0x3c, 0xc3,
+      0xce, 0x56, 0xbb, 0xb8, 0x47, 0x91, 0xec, 0xd2, 0xa7, 0xd7, 0x61, 0xe9,
+      0x8d, 0xfa, 0x33, 0x5a, 0x5e, 0x42, 0x02, 0x38, 0x0f, 0x95, 0xfa, 0x18,
+      0x1a, 0x4d, 0xdf, 0x03, 0xb2, 0x19, 0xbf, 0x7c, 0x22, 0x6e, 0xf4, 0x6c},
+     {0x00, 0x01, 0x80, 0x08, 0xb2, 0x0f, 0xe0, 0xce, 0x84, 0x16, 0x2e, 0xfd,
+      0xe0, 0x50, 0x7e, 0x8a, 0x1b, 0xf3, 0x1e, 0xf7, 0x4e, 0xa5, 0xbb, 0x29,
+      0x3f, 0xb8, 0x20, 0xa3, 0x80, 0x2a, 0xb2, 0x20, 0xda, 0x30, 0xd0, 0x41,
+      0xd8, 0xff, 0x2a, 0x86, 0x3a, 0xec, 0x4e, 0x22, 0xc4, 0x8e, 0xa9, 0x94,
+      0xd6, 0x12, 0x69, 0xd7, 0xfe, 0xbe, 0xa2, 0xc5, 0x44, 0x83, 0x96, 0x76,
+      0x9b, 0x93, 0x1b, 0xd1, 0x5f, 0xbf, 0xea, 0xd6, 0xb6, 0x85, 0xe1, 0x32,
+      0x7f, 0x42, 0xd7, 0x16, 0x24, 0xb1, 0xed, 0x4a, 0xd7, 0x3c, 0x87, 0x3c,
+      0x81, 0x12, 0x94, 0x09, 0x93, 0x55, 0xb2, 0xad, 0x39, 0xc4, 0x01, 0x1b},
+     {0x00, 0x00, 0xd7, 0xb9, 0xd8, 0x6a, 0x58, 0x3c, 0x4e, 0x25, 0xcb, 0xb5,
+      0x8c, 0x01, 0x55, 0x87, 0xd9, 0xee, 0x1d, 0xcb, 0x50, 0x02, 0x24, 0xd2,
+      0xfa, 0x60, 0x5f, 0xea, 0xff, 0x78, 0x1a, 0xca, 0x68, 0x19, 0x51, 0xfa,
+      0x7f, 0x2a, 0x1f, 0x0f, 0x4b, 0x32, 0x38, 0x9d, 0x8a, 0x48, 0x45, 0x8d,
+      0x12, 0x31, 0xd9, 0x2d, 0x7b, 0xbe, 0x7c, 0xcd, 0xff, 0xcf, 0x26, 0x24,
+      0xf5, 0x42, 0x79, 0xf3, 0x1f, 0x72, 0x72, 0xcb, 0x48, 0x3c, 0x22, 0x6f,
+      0x24, 0xe2, 0x9b, 0x79, 0x6e, 0x11, 0x89, 0x62, 0xc1, 0x5e, 0x0a, 0x6a,
+      0x41, 0x34, 0x28, 0x17, 0xf3, 0x9a, 0xac, 0xba, 0x43, 0x4e, 0x2f, 0x5d}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x2f, 0x12, 0x80, 0x4e, 0x97, 0x65, 0x90, 0x7e, 0x54, 0xb0,
+      0xd9, 0x79, 0xca, 0x0e, 0x2a, 0xca, 0x94, 0x6d, 0xb8, 0xd9, 0x4d, 0x60,
+      0x32, 0x72, 0x6f, 0xbd, 0x68, 0xc0, 0xb4, 0x3b, 0xc2, 0xec, 0xfa, 0xb7,
+      0x32, 0x94, 0x12, 0x06, 0x5b, 0x66, 0x7e, 0x2a, 0xae, 0x7e, 0x09, 0x90,
+      0x29, 0x61, 0xac, 0x01, 0x29, 0x8f, 0x43, 0x25, 0x1c, 0xde, 0x77, 0x8c,
+      0x15, 0x84, 0x04, 0x9c, 0x21, 0x62, 0x0d, 0xd9, 0x9e, 0xf8, 0xd8, 0xbb,
+      0xc2, 0x21, 0x52, 0x42, 0x1b, 0xc5, 0xca, 0xc5, 0x2b, 0xae, 0x96, 0x0c,
+      0x06, 0xdd, 0xb0, 0xda, 0x20, 0x32, 0xbb, 0x12, 0x70, 0xe3, 0x12, 0x6f},
+     {0x00, 0x00, 0xb5, 0x5b, 0xec, 0xd9, 0x30, 0xf0, 0x33, 0xc1, 0xea, 0x24,
+      0xd2, 0x38, 0x68, 0x1a, 0xb3, 0x05, 0x80, 0x9f, 0x59, 0x3f, 0x23, 0x78,
+      0x17, 0xb8, 0xcc, 0x62, 0xa0, 0xd0, 0xc6, 0x02, 0xa4, 0x0e, 0x88, 0xcc,
+      0x96, 0x63, 0x24, 0xea, 0x56, 0x8a, 0xd9, 0xf7, 0x4e, 0xd3, 0x4f, 0x2d,
+      0x05, 0x52, 0x5a, 0x88, 0x87, 0x2d, 0x44, 0x66, 0x03, 0xf6, 0x9e, 0x4a,
+      0xf8, 0x46, 0x7a, 0x1d, 0x7e, 0x5a, 0x60, 0xf2, 0xbd, 0xcc, 0xd7, 0x28,
+      0xc0, 0x18, 0xb4, 0xc3, 0xbb, 0xff, 0xe2, 0xed, 0x65, 0xd7, 0xbf, 0x08,
+      0x36, 0xd3, 0x90, 0x0a, 0x4c, 0x42, 0xbf, 0xf3, 0x0d, 0x67, 0x36, 0x67},
+     {0x00, 0x00, 0xd1, 0x07, 0xbd, 0xf6, 0xb4, 0x48, 0x17, 0x09, 0xc5, 0x91,
+      0x47, 0x8b, 0xa1, 0xae, 0xe1, 0x25, 0xb0, 0x70, 0xc7, 0xe5, 0x0e, 0x7b,
+      0x05, 0x5d, 0x7d, 0xeb, 0xd4, 0xbe, 0x2f, 0xd1, 0xee, 0x54, 0x8a, 0x17,
+      0xec, 0xd2, 0xb5, 0x93, 0x1e, 0x41, 0x00, 0x9f, 0xc4, 0x53, 0x79, 0xaf,
+      0xee, 0x00, 0x0c, 0x8d, 0xa2, 0xb2, 0xa6, 0xd5, 0x9e, 0xc4, 0xe0, 0xa2,
+      0x2a, 0x8a, 0x95, 0x95, 0x32, 0x3f, 0x32, 0x04, 0xdb, 0x96, 0x8a, 0x90,
+      0x43, 0xc9, 0x33, 0x8b, 0x57, 0xbe, 0x86, 0x3d, 0x91, 0xee, 0xf9, 0x77,
+      0xd6, 0x1d, 0x61, 0x8c, 0x66, 0xab, 0x3b, 0x3c, 0x4c, 0x88, 0xd5, 0x94},
+     {0x00, 0x01, 0x8a, 0x12, 0x32, 0x92, 0xf0, 0xfa, 0x05, 0xfa, 0x31, 0x68,
+      0xac, 0x14, 0x02, 0x94, 0xca, 0x87, 0xea, 0xd1, 0xe8, 0xe9, 0x96, 0x8e,
+      0xdf, 0x8c, 0x03, 0x4f, 0xc4, 0x9f, 0x9c, 0xc3, 0xe6, 0x9b, 0x82, 0x97,
+      0x3a, 0x12, 0xce, 0xc0, 0xc9, 0x3d, 0x3f, 0xbf, 0x4f, 0xd9, 0x1f, 0x59,
+      0x84, 0x9a, 0x33, 0x2e, 0xa4, 0x66, 0x5b, 0x78, 0xd9, 0x2a, 0xef, 0x5f,
+      0x4a, 0xf7, 0x51, 0x9e, 0xaa, 0x26, 0xdb, 0xea, 0xfa, 0xd8, 0x19, 0xba,
+      0xf2, 0x1f, 0xe3, 0x5d, 0x22, 0xab, 0x7e, 0xce, 0x97, 0xfb, 0x9e, 0x1f,
+      0x3b, 0x37, 0xbb, 0xd7, 0xe4, 0xe0, 0x46, 0xbc, 0xa5, 0xdc, 0x71, 0x25}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0xa3, 0x02, 0xd9, 0x8e, 0x43, 0xd6, 0xd3, 0xf7, 0x8f, 0x8b,
+      0x6c, 0x3d, 0xbe, 0x78, 0x15, 0x16, 0xc1, 0x03, 0x62, 0x4f, 0x3a, 0x12,
+      0xe1, 0x13, 0x46, 0xc2, 0xdf, 0x39, 0x73, 0x73, 0x64, 0x9d, 0xa6, 0x7d,
+      0xcf, 0x00, 0xe8, 0x06, 0x74, 0xc9, 0xe8, 0x57, 0x6f, 0xe1, 0xc6, 0x2c,
+      0x24, 0xab, 0x82, 0x38, 0x4f, 0x94, 0xec, 0x9f, 0xc7, 0x13, 0x7b, 0x98,
+      0x19, 0x1c, 0x00, 0xfd, 0xa8, 0x4e, 0x74, 0x3b, 0xad, 0x13, 0xe7, 0x34,
+      0x99, 0x1d, 0xdc, 0x6d, 0xc4, 0xbc, 0x35, 0x23, 0x72, 0xba, 0x8b, 0x40,
+      0x81, 0x01, 0x8e, 0x8c, 0xa9, 0x7f, 0xc0, 0xfb, 0x04, 0xd4, 0x6a, 0x81},
+     {0x00, 0x01, 0xa9, 0x92, 0x70, 0x68, 0xa9, 0xd6, 0x78, 0xd5, 0xfe, 0x74,
+      0x39, 0xd5, 0xd1, 0x8e, 0x68, 0xa5, 0x06, 0xc2, 0x75, 0xbb, 0xc4, 0x60,
+      0xaf, 0xa4, 0x12, 0x3f, 0xca, 0xf3, 0x1a, 0x21, 0x43, 0xec, 0xc6, 0xa7,
+      0x19, 0x6f, 0xaf, 0xa2, 0x88, 0x8a, 0xfe, 0x2a, 0xeb, 0x03, 0x76, 0xd2,
+      0x5a, 0x68, 0x68, 0xd2, 0x7e, 0x1d, 0x99, 0x39, 0xa2, 0xc0, 0x6e, 0x13,
+      0x95, 0x3b, 0xfc, 0x8c, 0xfe, 0x8b, 0x02, 0x46, 0x60, 0xbf, 0xf6, 0x48,
+      0xe7, 0x51, 0x39, 0xad, 0x05, 0xab, 0x0f, 0xfa, 0x36, 0x3c, 0x5c, 0x37,
+      0x63, 0x19, 0x85, 0x0f, 0xee, 0x43, 0x6a, 0x97, 0x68, 0x47, 0x2d, 0x28},
+     {0x00, 0x00, 0x04, 0xf8, 0xee, 0xd1, 0xc4, 0xe5, 0x28, 0xaf, 0x42, 0x95,
+      0x54, 0x66, 0x0b, 0x56, 0x7f, 0x58, 0x32, 0x88, 0xc5, 0x9a, 0x48, 0xea,
+      0xb4, 0xab, 0x64, 0x56, 0x64, 0x8f, 0x4a, 0xe0, 0xa7, 0x19, 0xcf, 0x91,
+      0xd1, 0xce, 0xaa, 0x34, 0x6e, 0x97, 0x9d, 0xca, 0x0e, 0xbc, 0x55, 0x06,
+      0x84, 0x0f, 0xad, 0x53, 0x82, 0xc2, 0xa5, 0x68, 0xf4, 0xdd, 0xb7, 0x96,
+      0x56, 0xe0, 0x1f, 0x3b, 0x44, 0xb7, 0xba, 0xe3, 0x39, 0xa5, 0xdb, 0xca,
+      0x57, 0xd0, 0xe4, 0x88, 0x8f, 0xc1, 0xd2, 0x06, 0x13, 0x81, 0xd7, 0x03,
+      0x1c, 0x67, 0x88, 0x36, 0x2e, 0xa8, 0x4a, 0x89, 0x25, 0xc0, 0xe8, 0x97},
+     {0x00, 0x01, 0x80, 0x26, 0x7a, 0xc0, 0xb4, 0x9d, 0x29, 0x84, 0x52, 0x96,
+      0x08, 0xec, 0xb6, 0x80, 0xb7, 0x7a, 0x83, 0xd2, 0x2c, 0x5d, 0x95, 0x6b,
+      0x8a, 0x07, 0x1d, 0x71, 0x81, 0x9f, 0x44, 0x86, 0xc3, 0x7b, 0x32, 0xc7,
+      0x3a, 0x8a, 0x3d, 0xbf, 0x76, 0xdd, 0x76, 0x4a, 0xf7, 0xf1, 0x7b, 0x3b,
+      0xa7, 0xa5, 0xae, 0xa1, 0x69, 0x6e, 0xbb, 0x9e, 0x0e, 0xe9, 0x8d, 0x75,
+      0x27, 0x9c, 0x5e, 0xc2, 0x6a, 0xa8, 0xb8, 0x5f, 0xd8, 0xf9, 0xcf, 0xc1,
+      0x8f, 0x49, 0x2a, 0x25, 0xd2, 0xd7, 0x66, 0x1d, 0x25, 0x16, 0xa2, 0xce,
+      0x59, 0x2c, 0x6c, 0xf3, 0x3c, 0x6a, 0x55, 0xb3, 0x8e, 0x7c, 0x5f, 0x44}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0xc4, 0xbe, 0x67, 0xa8, 0xd4, 0xaa, 0xb7, 0xd2, 0xed, 0x69,
+      0x55, 0xbd, 0x21, 0x01, 0x96, 0xf8, 0x3b, 0x58, 0xcb, 0xe6, 0x67, 0xcb,
+      0x32, 0x9e, 0x07, 0x23, 0xe1, 0x25, 0xce, 0x2c, 0x5d, 0x70, 0xf5, 0x0f,
+      0x02, 0xa6, 0x81, 0xfe, 0xa3, 0x2c, 0x0d, 0x66, 0xad, 0xe5, 0x9f, 0x59,
+      0xf3, 0x59, 0x34, 0x55, 0xaa, 0x0c, 0x7a, 0x41, 0xfc, 0x43, 0x5e, 0x5d,
+      0x2c, 0xa6, 0x3b, 0x10, 0x3b, 0x68, 0xbd, 0xb7, 0x47, 0x22, 0xc4, 0xe3,
+      0xa5, 0x80, 0xbe, 0xea, 0x7b, 0x1e, 0x3e, 0x55, 0x95, 0xe9, 0xcd, 0x76,
+      0x85, 0x6f, 0x4c, 0x3c, 0x65, 0x12, 0xbe, 0x92, 0xee, 0xa5, 0x21, 0xa0},
+     {0x00, 0x00, 0x36, 0xa1, 0xcf, 0x29, 0xcf, 0x30, 0xff, 0x7b, 0x8f, 0x1f,
+      0xb6, 0x41, 0x61, 0xa2, 0x23, 0xe0, 0x4a, 0x5b, 0x67, 0x85, 0x95, 0xa9,
+      0x3d, 0xcd, 0xc4, 0xb1, 0xa3, 0xde, 0xf9, 0xa7, 0x93, 0x48, 0x71, 0x96,
+      0x01, 0xe0, 0x2b, 0xd9, 0xe0, 0x41, 0x96, 0x52, 0xa8, 0x10, 0x10, 0x3f,
+      0x4c, 0x05, 0xfd, 0xaf, 0xfd, 0x81, 0x47, 0xa1, 0xc9, 0x83, 0x08, 0x0d,
+      0x26, 0x0d, 0xa0, 0x69, 0xd3, 0x64, 0xbe, 0x57, 0xcd, 0xe1, 0xb2, 0xd6,
+      0xaa, 0x2e, 0xc1, 0xa6, 0x6a, 0xb2, 0x9b, 0x80, 0x55, 0x0f, 0x67, 0xe5,
+      0xc2, 0x2c, 0x7c, 0x1d, 0xb9, 0xc5, 0xe6, 0x6f, 0x55, 0xfc, 0x57, 0x29},
+     {0x00, 0x00, 0x79, 0x88, 0x94, 0x10, 0xda, 0x29, 0x63, 0xc9, 0x56, 0x09,
+      0xd4, 0x74, 0x44, 0x07, 0x5e, 0x05, 0xf6, 0xe9, 0xe6, 0x20, 0x54, 0x49,
+      0xe3, 0x89, 0x57, 0xff, 0xe8, 0xfc, 0x84, 0x0b, 0x18, 0xdc, 0x6c, 0xda,
+      0x69, 0x6f, 0x72, 0x94, 0x71, 0xca, 0x76, 0xc0, 0xc7, 0x1d, 0x49, 0x8f,
+      0x78, 0x6c, 0x8b, 0xf9, 0x5b, 0x45, 0xfd, 0xc3, 0xc5, 0xd3, 0x87, 0x72,
+      0x28, 0x41, 0x3c, 0xe9, 0xd4, 0x82, 0x70, 0x9a, 0x9b, 0xfc, 0xef, 0x62,
+      0x0e, 0xa7, 0xf2, 0x6c, 0x93, 0x54, 0x8e, 0xe9, 0x14, 0xb9, 0x1e, 0xe5,
+      0x0c, 0x50, 0x52, 0x88, 0xee, 0xd1, 0x03, 0xff, 0xaf, 0x3d, 0xcd, 0x64},
+     {0x00, 0x01, 0x87, 0x2d, 0xee, 0x58, 0x91, 0x61, 0x41, 0x7c, 0x81, 0xcf,
+      0x9c, 0xfe, 0x6c, 0x64, 0x09, 0xce, 0x2d, 0x17, 0x98, 0xf3, 0x27, 0x32,
+      0xfa, 0x63, 0xd2, 0x10, 0x33, 0xa9, 0x09, 0x57, 0x15, 0x0b, 0x31, 0x3f,
+      0x77, 0xdc, 0xda, 0x02, 0x9e, 0x75, 0x9b, 0xd4, 0x79, 0x8c, 0x56, 0xab,
+      0x76, 0xa0, 0x61, 0xd4, 0xda, 0x6c, 0xe8, 0xd7, 0xa7, 0x42, 0x2e, 0x1d,
+      0x8b, 0xdb, 0xcf, 0xe5, 0x1b, 0x78, 0x63, 0xc0, 0x0c, 0xa8, 0x8d, 0xfe,
+      0xbe, 0xad, 0x8e, 0x31, 0xd9, 0x53, 0xb6, 0x8c, 0x07, 0x66, 0x79, 0x13,
+      0x32, 0x30, 0xc9, 0x30, 0xa3, 0x17, 0xf2, 0x92, 0xb3, 0xed, 0xac, 0x8b}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0xad, 0x1d, 0x70, 0x9f, 0xf7, 0x5c, 0x22, 0x0e, 0x41, 0x7e,
+      0x0d, 0xb1, 0xe4, 0xf7, 0xd5, 0x8a, 0x62, 0xb0, 0x4b, 0x21, 0x22, 0x43,
+      0xe5, 0x04, 0x23, 0xca, 0x7d, 0x18, 0xa3, 0xe8, 0x95, 0xb2, 0x1a, 0x47,
+      0x22, 0x8e, 0x01, 0xcf, 0xb3, 0xab, 0x31, 0xb2, 0x20, 0xa7, 0xbc, 0x3b,
+      0xd2, 0x9f, 0xb1, 0xc8, 0x67, 0xc8, 0xff, 0x25, 0x5f, 0x46, 0xbc, 0x5f,
+      0x46, 0x08, 0xf0, 0x0f, 0xde, 0xcf, 0x81, 0x18, 0x43, 0x53, 0xe5, 0x78,
+      0x99, 0x8f, 0x1a, 0x91, 0x05, 0xc0, 0xeb, 0xe1, 0x8e, 0xb7, 0xd0, 0x22,
+      0x00, 0x44, 0xc8, 0x0f, 0x94, 0x79, 0x98, 0xde, 0x0c, 0x62, 0xf3, 0x6a},
+     {0x00, 0x01, 0x38, 0x89, 0xee, 0xf2, 0x5b, 0xdb, 0xc3, 0xb6, 0xd8, 0x2f,
+      0xce, 0x3e, 0x64, 0xf7, 0xd5, 0x0b, 0xd4, 0xb4, 0x1c, 0x8f, 0x38, 0xc2,
+      0xbf, 0xa4, 0xe4, 0x8f, 0x9a, 0x32, 0x28, 0x9c, 0x43, 0x0f, 0x70, 0x0a,
+      0xf7, 0x85, 0x82, 0x0e, 0x3f, 0xf3, 0x9d, 0x42, 0xa2, 0x04, 0x2d, 0xb5,
+      0x55, 0x3d, 0x7a, 0xa2, 0x90, 0x5e, 0x62, 0x1e, 0x02, 0xd1, 0xfc, 0x05,
+      0xf7, 0x7f, 0xf5, 0xdf, 0x9c, 0xbd, 0xe5, 0x4a, 0x32, 0xc5, 0x4d, 0x08,
+      0x22, 0x42, 0x3c, 0x45, 0xb3, 0xf3, 0xfb, 0x83, 0x2e, 0x40, 0xda, 0x0c,
+      0xd3, 0x5b, 0xde, 0x46, 0xe8, 0x0e, 0x65, 0x30, 0x15, 0xf8, 0x17, 0x0d},
+     {0x00, 0x01, 0x75, 0xd3, 0x66, 0x5e, 0x52, 0x76, 0x73, 0x49, 0x1b, 0x83,
+      0x0f, 0x28, 0xdf, 0xc1, 0x02, 0x3d, 0x5a, 0x1f, 0xc0, 0x58, 0x62, 0x8d,
+      0xaa, 0x14, 0x8d, 0x11, 0x76, 0x41, 0xdb, 0x90, 0xda, 0x49, 0xc3, 0xc4,
+      0x56, 0xcf, 0xf2, 0x8f, 0x24, 0x88, 0xc6, 0xbe, 0x4c, 0x6d, 0x73, 0x1d,
+      0x47, 0x51, 0xc7, 0x04, 0x95, 0xc5, 0x7f, 0x98, 0xf5, 0xdc, 0xd2, 0x17,
+      0x28, 0x4a, 0x60, 0x24, 0xd7, 0x5a, 0xbf, 0x14, 0xb5, 0x75, 0x86, 0x40,
+      0x01, 0x69, 0x62, 0x8a, 0x6a, 0x7b, 0x03, 0xe2, 0x94, 0xb1, 0x9c, 0xef,
+      0x7f, 0x47, 0xd1, 0xe9, 0x48, 0x67, 0x0b, 0xa3, 0xa5, 0xc8, 0xbd, 0xe2},
+     {0x00, 0x01, 0x90, 0xbc, 0xcb, 0xe7, 0x03, 0xaf, 0x4a, 0xda, 0xd7, 0xa8,
+      0xfe, 0x32, 0x4a, 0x32, 0x71, 0x3c, 0x1f, 0x6a, 0x86, 0x23, 0x70, 0x2b,
+      0x1e, 0x64, 0xe0, 0x64, 0x0e, 0xe6, 0x97, 0x9f, 0x79, 0x87, 0x9b, 0x87,
+      0x97, 0xd1, 0xc4, 0xb3, 0x83, 0xc2, 0x4b, 0x11, 0x4e, 0x2b, 0x7f, 0x13,
+      0x66, 0xe0, 0xcf, 0xc3, 0x23, 0xbf, 0x91, 0x47, 0xeb, 0x0c, 0x86, 0x49,
+      0x8e, 0xf6, 0x97, 0xcb, 0x85, 0xc2, 0x1e, 0xa7, 0x08, 0x97, 0xef, 0xd4,
+      0x9c, 0x30, 0x0e, 0xee, 0xae, 0x81, 0xcd, 0xff, 0x8b, 0xdc, 0x5d, 0x9c,
+      0xc4, 0xa0, 0x3c, 0xb7, 0xcd, 0x7e, 0x0a, 0x37, 0x31, 0x07, 0xaa, 0x71}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x4b, 0xa7, 0x4b, 0x1d, 0xa2, 0x38, 0x7a, 0xdf, 0xb2, 0xb5,
+      0x39, 0x5e, 0xf5, 0x34, 0x2e, 0xe1, 0x0c, 0x43, 0xd2, 0xcf, 0x86, 0xfd,
+      0xe4, 0x5e, 0x0e, 0xea, 0x09, 0xf2, 0xb1, 0xfa, 0x90, 0xc8, 0x67, 0xf8,
+      0xef, 0x0c, 0x64, 0xc4, 0x74, 0xb7, 0xf3, 0xe9, 0x1a, 0x93, 0xdd, 0xce,
+      0x38, 0xe8, 0xc4, 0xdb, 0x79, 0xa7, 0xb7, 0x07, 0xfe, 0x58, 0x33, 0x84,
+      0x92, 0xe2, 0xf8, 0x66, 0xa1, 0xb7, 0x8a, 0xe4, 0x1e, 0x5c, 0xec, 0x1b,
+      0xb2, 0xcc, 0xde, 0x86, 0x79, 0x03, 0x4e, 0xc1, 0x38, 0xce, 0x90, 0x6b,
+      0xc5, 0xbc, 0x64, 0x99, 0x49, 0xbd, 0x85, 0x5e, 0x5c, 0xb4, 0x17, 0x73},
+     {0x00, 0x00, 0x83, 0xd5, 0x05, 0x2e, 0x54, 0x51, 0xac, 0x82, 0x8c, 0x82,
+      0x17, 0xab, 0xd5, 0x62, 0x51, 0xfd, 0x35, 0x78, 0x2d, 0x8b, 0x8b, 0xdc,
+      0x72, 0x3e, 0x05, 0xb2, 0xfe, 0xc3, 0x14, 0x31, 0x6f, 0x80, 0x00, 0xc0,
+      0xba, 0xda, 0x13, 0xfd, 0x30, 0xc0, 0x31, 0x79, 0x07, 0x10, 0x38, 0xac,
+      0x30, 0x5a, 0xa6, 0x13, 0x6e, 0xfe, 0xb6, 0x26, 0x4d, 0x42, 0xf2, 0x92,
+      0x9b, 0x0c, 0xad, 0xe6, 0x48, 0x36, 0x37, 0x1b, 0x4d, 0x21, 0x2d, 0xda,
+      0x53, 0xf9, 0x59, 0x1f, 0xc5, 0xde, 0x2f, 0x02, 0x8f, 0x04, 0xa5, 0xbf,
+      0xa7, 0x61, 0x9f, 0x49, 0x50, 0x3c, 0xe1, 0xd6, 0xbd, 0x5d, 0xff, 0xe0},
+     {0x00, 0x01, 0x97, 0x80, 0x26, 0x1b, 0x5a, 0x71, 0xb0, 0x08, 0x26, 0x89,
+      0x81, 0x7a, 0xb2, 0x8b, 0xa7, 0x65, 0xc8, 0xd3, 0x0c, 0x6f, 0xde, 0xe9,
+      0x3b, 0x7a, 0x2a, 0x29, 0xfd, 0x2c, 0x6b, 0xa2, 0x3b, 0xd6, 0xc8, 0xb9,
+      0xea, 0xe1, 0xef, 0x24, 0x28, 0x36, 0x6f, 0xbc, 0xf4, 0x75, 0x4a, 0xa6,
+      0x30, 0x4f, 0x5e, 0xe4, 0xc7, 0x96, 0xc3, 0xe7, 0x4c, 0xf1, 0xde, 0x6b,
+      0xe5, 0x06, 0x8a, 0xb3, 0xb8, 0x74, 0x84, 0xdd, 0xcc, 0xc4, 0xfe, 0x9e,
+      0x6c, 0x44, 0x6a, 0x48, 0xe3, 0x4a, 0xd8, 0x64, 0xe9, 0x66, 0xd4, 0x9e,
+      0xdd, 0xcc, 0xdb, 0xbe, 0x90, 0x74, 0x08, 0x71, 0xda, 0x4f, 0x6a, 0xf9},
+     {0x00, 0x01, 0x22, 0xda, 0x2c, 0xf0, 0x7e, 0xd0, 0x93, 0x70, 0xe3, 0x45,
+      0x85, 0xcc, 0x19, 0x0a, 0xfc, 0xc1, 0x98, 0x33, 0x80, 0x50, 0xc2, 0xdc,
+      0xa0, 0xb5, 0xe6, 0xb9, 0xd1, 0x5b, 0xf3, 0xf0, 0xc2, 0x9d, 0x08, 0x09,
+      0x57, 0x7e, 0xe5, 0xb5, 0xf4, 0xff, 0x7c, 0xc7, 0x42, 0x1f, 0x1a, 0x84,
+      0xe4, 0x1f, 0xba, 0x07, 0x39, 0xa8, 0xc7, 0x02, 0x5b, 0x69, 0xaa, 0x05,
+      0xe4, 0x04, 0x22, 0xa2, 0xa3, 0x41, 0x94, 0x6a, 0xc0, 0x9f, 0x3f, 0xa8,
+      0x0d, 0xdc, 0x96, 0x7e, 0x1b, 0x15, 0x25, 0xdf, 0x33, 0xe8, 0x30, 0xde,
+      0x40, 0xff, 0x1a, 0x75, 0x3e, 0xe1, 0x16, 0x25, 0xb8, 0x0c, 0x57, 0x39}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0xb2, 0x16, 0xfc, 0x69, 0x01, 0xab, 0x88, 0x97, 0x0a, 0x2b,
+      0xe1, 0x2d, 0xf9, 0xf9, 0x21, 0xc8, 0xc9, 0xa4, 0x22, 0x4d, 0xcc, 0xaf,
+      0x5e, 0x2b, 0x81, 0x92, 0xe8, 0xc8, 0xb9, 0x5a, 0xeb, 0x0e, 0x9e, 0x47,
+      0x53, 0xc5, 0x85, 0x64, 0xfb, 0x76, 0x72, 0x94, 0xbd, 0x79, 0xd9, 0x14,
+      0x95, 0x6d, 0xc0, 0x88, 0xb1, 0xf6, 0xd2, 0xa4, 0x0a, 0x25, 0x98, 0xd0,
+      0x7e, 0xdb, 0x88, 0xff, 0xef, 0x38, 0xf2, 0xad, 0x6b, 0xa6, 0xdd, 0xdf,
+      0xbb, 0xd2, 0x3e, 0xff, 0x4b, 0x1b, 0x14, 0x6c, 0x5c, 0x21, 0x00, 0xb9,
+      0x44, 0xae, 0xb3, 0x1a, 0xe3, 0x7a, 0x9d, 0xe6, 0xa7, 0xe4, 0xd3, 0x13},
+     {0x00, 0x00, 0xea, 0x01, 0xe8, 0x87, 0xb0, 0x51, 0xfa, 0x0d, 0x6a, 0x02,
+      0xeb, 0x3c, 0x0e, 0xce, 0x0d, 0x64, 0x22, 0x2c, 0x1b, 0x8d, 0xc5, 0x05,
+      0x24, 0x27, 0x80, 0x15, 0xbe, 0xd3, 0x70, 0xb5, 0x57, 0x41, 0x7b, 0x52,
+      0x78, 0x65, 0x6f, 0xff, 0x4a, 0x36, 0xe6, 0xea, 0xe5, 0x03, 0x96, 0x50,
+      0x75, 0x28, 0xe7, 0xcb, 0x6a, 0x85, 0x14, 0x93, 0xf5, 0x5e, 0x28, 0xe2,
+      0x16, 0x5e, 0x2b, 0x55, 0x3b, 0x9f, 0x55, 0x0a, 0x26, 0x81, 0x17, 0x9b,
+      0x74, 0x87, 0xbf, 0xac, 0xe0, 0x4d, 0xfa, 0x1c, 0xc0, 0x81, 0x25, 0x91,
+      0xe8, 0x91, 0xa0, 0xa7, 0xa1, 0x3a, 0x0d, 0x13, 0x35, 0xed, 0x74, 0xca},
+     {0x00, 0x01, 0x9d, 0x1a, 0x00, 0x25, 0x5d, 0xbe, 0x19, 0x56, 0xcf, 0x7e,
+      0x9e, 0x5c, 0xa2, 0xe9, 0x71, 0xbb, 0x24, 0x70, 0x1f, 0xe4, 0x61, 0xc1,
+      0x58, 0xe3, 0x53, 0x06, 0x5c, 0xef, 0x86, 0xd5, 0x5b, 0xb3, 0x9e, 0x27,
+      0xf4, 0xe5, 0x5d, 0xe4, 0xca, 0xc0, 0xd7, 0xff, 0x4a, 0x34, 0xb4, 0x68,
+      0xbb, 0x52, 0xc1, 0x97, 0x8e, 0xbe, 0x4c, 0x29, 0x94, 0x70, 0x57, 0xbd,
+      0xe4, 0x55, 0x81, 0x1a, 0x07, 0x70, 0x30, 0xf6, 0x6c, 0x06, 0x99, 0xc4,
+      0x4c, 0x4f, 0xd5, 0xd2, 0xec, 0x68, 0xcc, 0x25, 0xce, 0x16, 0x28, 0x5d,
+      0x2d, 0xf8, 0x60, 0x72, 0xf6, 0x25, 0x49, 0x2a, 0x33, 0xd1, 0xe7, 0x72},
+     {0x00, 0x00, 0x76, 0x9d, 0x76, 0x01, 0x25, 0xfd, 0x06, 0xc7, 0x2e, 0x0b,
+      0xa5, 0x41, 0xa0, 0x83, 0xd3, 0xf2, 0x07, 0x07, 0x2f, 0x68, 0xfd, 0x37,
+      0xf2, 0xfe, 0xb7, 0xd2, 0xa0, 0x7a, 0x3a, 0x12, 0xa8, 0xf8, 0x6c, 0xad,
+      0xb5, 0x5c, 0xee, 0x20, 0x81, 0x0a, 0x08, 0xb1, 0x03, 0xea, 0x06, 0xc7,
+      0xb4, 0x85, 0x6b, 0xe0, 0x23, 0x88, 0xf2, 0x40, 0x6c, 0xec, 0x2d, 0x83,
+      0x74, 0x05, 0xc9, 0xeb, 0xb1, 0x09, 0x58, 0xd0, 0x97, 0x49, 0x4a, 0x46,
+      0x28, 0x6c, 0xf5, 0xf7, 0x58, 0x50, 0x1e, 0xdc, 0x7d, 0x3c, 0xbf, 0xd8,
+      0xc9, 0xd8, 0x10, 0x60, 0xff, 0x1a, 0xd0, 0xdd, 0x2a, 0xec, 0x1b, 0x8d}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x12, 0x18, 0xec, 0x5e, 0xfa, 0x24, 0xa3, 0x09, 0xf4, 0x15,
+      0xa5, 0x65, 0xd6, 0x15, 0x9f, 0xf5, 0x46, 0x3f, 0x44, 0x07, 0xd3, 0xf7,
+      0xa7, 0x24, 0xf3, 0xe6, 0x03, 0xc1, 0x01, 0x3c, 0x0a, 0xbc, 0xf0, 0x37,
+      0x86, 0x3a, 0xfe, 0xfb, 0xbd, 0xe8, 0x25, 0xbe, 0xe9, 0x77, 0xd5, 0xe0,
+      0x29, 0xed, 0xf6, 0x1d, 0x26, 0xbe, 0x53, 0x25, 0xc8, 0xc5, 0x55, 0xc3,
+      0x37, 0x77, 0x84, 0x5b, 0xf7, 0x81, 0x89, 0xe0, 0x8b, 0xf5, 0xe3, 0x93,
+      0xb6, 0x03, 0x23, 0x8e, 0xa5, 0x5c, 0x3e, 0x4a, 0xe8, 0x00, 0x8a, 0xe9,
+      0x3f, 0x1a, 0xb3, 0x60, 0x2d, 0xea, 0x0d, 0xaf, 0x7b, 0x13, 0x35, 0x4f},
+     {0x00, 0x01, 0x57, 0xdd, 0xce, 0x9b, 0x01, 0xc0, 0x0a, 0xfe, 0x14, 0x6e,
+      0x4b, 0xe7, 0x59, 0x0d, 0x0b, 0x45, 0xa3, 0x29, 0xdd, 0x8b, 0xd4, 0xb6,
+      0x54, 0x78, 0x16, 0xc9, 0xe6, 0xb9, 0xc6, 0xb0, 0x43, 0xb4, 0xb9, 0x5a,
+      0x82, 0x21, 0xc8, 0x7b, 0xf6, 0x2a, 0x86, 0x19, 0x40, 0x79, 0xa0, 0xb0,
+      0x3e, 0x3f, 0x51, 0x86, 0x4e, 0xff, 0x40, 0xc8, 0x56, 0x7e, 0x37, 0x56,
+      0x98, 0x72, 0x1f, 0xb2, 0xe9, 0x63, 0xe8, 0x4d, 0x4a, 0xbb, 0x34, 0x7a,
+      0x37, 0x76, 0x44, 0x10, 0x65, 0xca, 0x71, 0x6a, 0x8a, 0xa4, 0x75, 0x6c,
+      0x79, 0xe4, 0xd7, 0x35, 0xf7, 0x98, 0x3b, 0x0f, 0x6f, 0xb8, 0x06, 0xf4},
+     {0x00, 0x00, 0x6f, 0xfc, 0x41, 0x06, 0xf6, 0x4f, 0x9f, 0xeb, 0x0e, 0x50,
+      0x72, 0x78, 0x97, 0x50, 0x90, 0xee, 0x7c, 0x29, 0x4e, 0xd0, 0xd5, 0x36,
+      0x5d, 0xe6, 0xbb, 0x36, 0x6f, 0x60, 0xa5, 0x06, 0x58, 0x13, 0x4e, 0x62,
+      0x3b, 0x62, 0x0e, 0xbc, 0xfc, 0x5e, 0x09, 0x3c, 0xea, 0x07, 0x5e, 0x64,
+      0x87, 0x7d, 0x2b, 0xf2, 0xc2, 0xa7, 0xb5, 0x86, 0x62, 0xc3, 0xd6, 0x92,
+      0xf3, 0x77, 0x24, 0xdd, 0xa2, 0x60, 0xe6, 0xd2, 0x8c, 0x0a, 0x4a, 0x24,
+      0xfd, 0x73, 0x58, 0x60, 0xfd, 0x53, 0xb1, 0x57, 0x05, 0x73, 0x5e, 0x0a,
+      0x50, 0x63, 0xd3, 0x57, 0x1f, 0xde, 0xb2, 0x65, 0xa6, 0x3c, 0x47, 0xc2},
+     {0x00, 0x01, 0x17, 0x31, 0x02, 0x2a, 0x2d, 0x1f, 0xba, 0xfe, 0x45, 0x19,
+      0xcc, 0xe8, 0x76, 0x12, 0x79, 0x26, 0x8b, 0x35, 0x83, 0xec, 0xbf, 0x79,
+      0x1d, 0xa8, 0x6b, 0xa5, 0x8b, 0x1f, 0x8c, 0x27, 0xc0, 0xc7, 0x69, 0x9b,
+      0xa4, 0xf7, 0xce, 0x8c, 0x49, 0x18, 0x83, 0x98, 0x89, 0xc7, 0x9b, 0xa9,
+      0xeb, 0xbb, 0x8f, 0x5b, 0x03, 0x63, 0x67, 0x14, 0x66, 0xe8, 0x2d, 0xee,
+      0x15, 0x2d, 0xf0, 0xca, 0x17, 0x57, 0x71, 0xe4, 0xbd, 0xcd, 0x26, 0x4e,
+      0x2d, 0x65, 0x0f, 0x4d, 0x5a, 0xd7, 0x27, 0x93, 0xf9, 0x04, 0x1f, 0xd2,
+      0xf3, 0x41, 0x16, 0x80, 0x03, 0x8e, 0x2d, 0x0f, 0x57, 0x84, 0x6d, 0xcc}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x90, 0x24, 0x78, 0x79, 0xca, 0xa4, 0x93, 0xbe, 0xe7, 0x02,
+      0xba, 0xb3, 0xd0, 0xbb, 0x6a, 0x0b, 0xdb, 0x03, 0x48, 0x16, 0xe5, 0x19,
+      0xe8, 0x89, 0x18, 0x3c, 0x1e, 0x52, 0x9c, 0x4a, 0x9c, 0xdd, 0x1f, 0x1e,
+      0x66, 0x0c, 0xd9, 0xf7, 0x21, 0x77, 0xfb, 0x3e, 0x5c, 0xbd, 0xf8, 0xbf,
+      0x76, 0x09, 0x64, 0x4d, 0xce, 0xff, 0x1b, 0x0e, 0x43, 0x43, 0x57, 0xa0,
+      0xe2, 0xdd, 0xa4, 0x5b, 0xb1, 0xd9, 0xe7, 0x2e, 0xf1, 0x99, 0xfb, 0x14,
+      0x5c, 0x27, 0x67, 0x64, 0x9e, 0x83, 0xd9, 0x67, 0xe1, 0x86, 0x37, 0x55,
+      0x64, 0x2e, 0xa0, 0x9c, 0xdc, 0x17, 0x05, 0x99, 0x17, 0xae, 0x74, 0xe2},
+     {0x00, 0x00, 0xe7, 0x0b, 0xe7, 0x5a, 0x78, 0x0e, 0x23, 0xb1, 0x36, 0x89,
+      0xb4, 0x2a, 0x82, 0x21, 0x68, 0x33, 0x64, 0x18, 0xed, 0x44, 0x64, 0x1c,
+      0x46, 0x72, 0xcf, 0x12, 0xf2, 0x50, 0x81, 0xef, 0x5c, 0xd2, 0x4a, 0xe7,
+      0xc4, 0xf8, 0xbb, 0x57, 0xd5, 0xec, 0x8e, 0x3e, 0x03, 0xe3, 0x5e, 0x59,
+      0xbe, 0x85, 0x2c, 0x76, 0xaa, 0xeb, 0x2d, 0x50, 0xc1, 0x0c, 0x21, 0xea,
+      0x38, 0x71, 0xb8, 0xed, 0x4f, 0x3d, 0xef, 0xed, 0x8d, 0xa8, 0x1b, 0x6f,
+      0xee, 0x06, 0x50, 0xca, 0x9e, 0x30, 0x4b, 0xbc, 0xd9, 0xe9, 0x6e, 0xde,
+      0xd8, 0x2c, 0x7e, 0x6f, 0x92, 0x06, 0x3b, 0x05, 0x4b, 0xc2, 0x73, 0xee},
+     {0x00, 0x01, 0xc3, 0x66, 0xb8, 0x59, 0x78, 0x99, 0xab, 0xf3, 0x05, 0x2a,
+      0x82, 0x03, 0xbb, 0x3d, 0xc2, 0xf7, 0x81, 0x46, 0x34, 0x39, 0x14, 0x94,
+      0x74, 0x7e, 0x77, 0xc7, 0x2a, 0x23, 0x56, 0xf9, 0x21, 0xcd, 0x28, 0x16,
+      0xcb, 0x08, 0xcb, 0xe1, 0xd2, 0x78, 0x3f, 0xb8, 0x8f, 0xe0, 0x22, 0x18,
+      0xc7, 0x3a, 0x11, 0x35, 0xed, 0x4d, 0xe6, 0x8f, 0xba, 0x82, 0xd1, 0xae,
+      0xb1, 0xce, 0x77, 0x55, 0xb8, 0x2f, 0x4f, 0x80, 0xb4, 0xe8, 0xcc, 0xb4,
+      0x71, 0x1c, 0xe0, 0xa3, 0xc6, 0x75, 0x84, 0xbb, 0xf9, 0x5b, 0xaf, 0x22,
+      0x39, 0x2f, 0xd0, 0x03, 0x23, 0x2b, 0x19, 0x43, 0xf3, 0xdb, 0x04, 0xea},
+     {0x00, 0x00, 0x94, 0x76, 0xd8, 0x49, 0x33, 0x55, 0xf4, 0xa2, 0x7e, 0x50,
+      0x4e, 0xa5, 0x46, 0x2d, 0x52, 0xf0, 0x2e, 0xea, 0x7b, 0x75, 0x5e, 0xa6,
+      0xe3, 0xb1, 0xc2, 0x4e, 0xd9, 0x0e, 0x0a, 0x5e, 0xa4, 0xa4, 0x21, 0xa4,
+      0x3d, 0x64, 0x50, 0x33, 0x4d, 0x34, 0xfd, 0x6e, 0xf5, 0x2c, 0x84, 0xba,
+      0x28, 0x1f, 0x4e, 0x01, 0x8b, 0x7a, 0x58, 0x19, 0xb7, 0x26, 0x6b, 0x45,
+      0x92, 0x20, 0x63, 0xa6, 0x48, 0x70, 0xf5, 0x5f, 0xc2, 0x60, 0x51, 0xee,
+      0x55, 0x8f, 0xb4, 0x8c, 0x93, 0xd4, 0x54, 0x8f, 0x1b, 0x2b, 0x8b, 0x72,
+      0xc2, 0xb1, 0xaf, 0x4f, 0x0b, 0x45, 0x9d, 0xab, 0xd4, 0x3f, 0xb8, 0x4c}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x03, 0xbf, 0xec, 0xd4, 0x4c, 0xb1, 0x2a, 0x29, 0xc8, 0x8e,
+      0xf8, 0xf3, 0x47, 0xf3, 0x01, 0x82, 0x1a, 0xf2, 0x63, 0x51, 0x52, 0x0a,
+      0xe8, 0xf2, 0x36, 0x0f, 0xc4, 0xbd, 0x75, 0x0b, 0xb9, 0x9b, 0x55, 0x6e,
+      0xb7, 0xa0, 0xaa, 0xde, 0x69, 0x6b, 0xba, 0x8d, 0x20, 0x6b, 0xcc, 0x3f,
+      0x75, 0x59, 0xd3, 0x48, 0xd0, 0x85, 0x0b, 0xe0, 0xac, 0x53, 0x94, 0xea,
+      0x4f, 0xf1, 0x5d, 0x14, 0x11, 0x92, 0x88, 0x8e, 0x1b, 0xca, 0x40, 0x41,
+      0x66, 0x3a, 0xff, 0x19, 0x84, 0x72, 0x65, 0xbe, 0x24, 0x57, 0xc0, 0x2b,
+      0x9e, 0x69, 0x43, 0x5b, 0xbf, 0x71, 0x09, 0xed, 0xc6, 0x45, 0xc3, 0x28},
+     {0x00, 0x01, 0x75, 0xbd, 0x41, 0x47, 0x42, 0xc1, 0xf6, 0x39, 0x1c, 0x51,
+      0xa2, 0xa4, 0xb6, 0xb6, 0xcc, 0x62, 0x57, 0x63, 0xf6, 0xb2, 0x35, 0x66,
+      0xed, 0x25, 0x84, 0xae, 0xc3, 0x45, 0x8b, 0x33, 0xeb, 0x99, 0xd0, 0x36,
+      0x00, 0x52, 0x80, 0xe4, 0xad, 0x19, 0xe3, 0x3c, 0x51, 0x0e, 0x42, 0xfd,
+      0x56, 0x03, 0x4d, 0x43, 0xae, 0xbe, 0x0c, 0xbd, 0x74, 0xdc, 0x2b, 0x24,
+      0x22, 0x36, 0x4a, 0xcc, 0xc8, 0x47, 0xf3, 0xda, 0xb3, 0x20, 0x73, 0xc5,
+      0xc5, 0x9f, 0x9f, 0x9d, 0xa1, 0x60, 0xcf, 0x44, 0x13, 0x9a, 0xcf, 0xf4,
+      0xe6, 0x50, 0xb2, 0x27, 0x9f, 0xb3, 0xd1, 0x73, 0x5a, 0x0f, 0x64, 0x91},
+     {0x00, 0x01, 0x34, 0x42, 0x93, 0x15, 0x10, 0xa9, 0xdd, 0xc0, 0xed, 0xa1,
+      0x13, 0xef, 0x9c, 0x32, 0x53, 0xba, 0xbf, 0x6b, 0xf7, 0x27, 0xb9, 0x67,
+      0x67, 0xf5, 0x9d, 0xd3, 0xdb, 0xd6, 0x50, 0x4b, 0xf6, 0x74, 0xf0, 0xdf,
+      0x35, 0xbd, 0xf6, 0x62, 0xf3, 0x07, 0xc6, 0x7f, 0x10, 0x61, 0x62, 0x6f,
+      0xe5, 0x1e, 0x60, 0xae, 0xaf, 0x5e, 0xdd, 0x3d, 0x25, 0x50, 0xb2, 0x52,
+      0x6c, 0x92, 0x72, 0x56, 0xd5, 0x60, 0x1b, 0x07, 0x8a, 0x24, 0x76, 0x00,
+      0x0d, 0xe0, 0xb1, 0x73, 0xfc, 0x4b, 0x90, 0x0a, 0xa6, 0xba, 0x55, 0xc1,
+      0x73, 0xc4, 0x47, 0xde, 0x2a, 0x58, 0x2a, 0xfa, 0x21, 0xff, 0x92, 0x4a},
+     {0x00, 0x00, 0xe6, 0x61, 0x34, 0x87, 0x1c, 0xbd, 0x94, 0xfe, 0x63, 0x7f,
+      0x6b, 0xf5, 0x60, 0x93, 0x61, 0xa7, 0xd6, 0x0d, 0x58, 0x12, 0x24, 0x5b,
+      0xfe, 0x91, 0x99, 0xf4, 0x81, 0xc9, 0x6b, 0x04, 0x56, 0xb7, 0x15, 0xdf,
+      0xd0, 0x7f, 0x8c, 0xc3, 0xc3, 0x96, 0x43, 0x48, 0x40, 0xd7, 0x15, 0x65,
+      0x08, 0x15, 0xb4, 0xef, 0x85, 0xc8, 0x28, 0x28, 0x67, 0xef, 0x28, 0x76,
+      0xff, 0xbb, 0xbb, 0x8a, 0xc6, 0x35, 0x0e, 0x40, 0xe5, 0xae, 0x87, 0x26,
+      0xb6, 0x01, 0x2e, 0xaa, 0x85, 0xda, 0x0b, 0x03, 0x36, 0x04, 0xec, 0xf8,
+      0x91, 0x32, 0xbe, 0xaa, 0x71, 0x81, 0x36, 0xa5, 0xf8, 0x54, 0xd9, 0xcf}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0xa4, 0xe6, 0xa6, 0xe8, 0xb7, 0x64, 0x35, 0xf9, 0x58, 0x61,
+      0x1e, 0x8b, 0xa1, 0x6d, 0xa9, 0x59, 0xb3, 0x16, 0xb3, 0xea, 0x36, 0x22,
+      0xd1, 0x51, 0x1d, 0x5d, 0x77, 0x3f, 0x77, 0x9a, 0x12, 0x76, 0xd3, 0x03,
+      0x9c, 0xbc, 0x92, 0x86, 0x70, 0x06, 0x98, 0x58, 0x5b, 0xb5, 0x6f, 0x63,
+      0x15, 0xf5, 0x29, 0x40, 0x3a, 0x53, 0xc4, 0x58, 0x6e, 0x23, 0x0c, 0xfc,
+      0xd5, 0x01, 0x6c, 0xb9, 0x61, 0x2d, 0x19, 0x20, 0x44, 0xfc, 0x43, 0xd2,
+      0x23, 0xed, 0xaf, 0x6b, 0x47, 0x48, 0x06, 0x41, 0xe5, 0xdc, 0xbb, 0xf3,
+      0x1e, 0x42, 0xc7, 0x84, 0xa6, 0xb3, 0xb9, 0xc6, 0x48, 0x6f, 0xcf, 0x42},
+     {0x00, 0x00, 0x12, 0x79, 0xea, 0xfb, 0xca, 0x47, 0x70, 0x63, 0x5e, 0xbc,
+      0xc8, 0x4d, 0xcb, 0x92, 0x09, 0xea, 0xf5, 0xb8, 0x7a, 0x0a, 0x22, 0xaa,
+      0xa5, 0x1d, 0x3a, 0xe3, 0x17, 0x98, 0x43, 0x95, 0x5b, 0xa8, 0x37, 0xb5,
+      0x17, 0x90, 0x46, 0x5b, 0x99, 0x45, 0xd4, 0xba, 0x28, 0xaa, 0xbf, 0x2c,
+      0x6b, 0x6b, 0xc7, 0x74, 0x24, 0x4c, 0xb7, 0x5b, 0xbe, 0x3e, 0x4e, 0x27,
+      0x41, 0x3e, 0xf3, 0xe1, 0xb4, 0xfd, 0x56, 0x43, 0xa4, 0x9f, 0xf5, 0x27,
+      0xa2, 0xc3, 0x38, 0xf8, 0x66, 0x14, 0x81, 0x69, 0xf8, 0x4a, 0x1f, 0x88,
+      0x45, 0x46, 0x05, 0xb2, 0xe7, 0x36, 0xa4, 0x4c, 0xb0, 0x09, 0xf3, 0x32},
+     {0x00, 0x00, 0x1f, 0xff, 0x69, 0xd3, 0x90, 0xcd, 0xeb, 0x67, 0xef, 0x86,
+      0x8b, 0x6b, 0x05, 0x05, 0x63, 0x0a, 0x04, 0x8a, 0x4d, 0x35, 0x7f, 0x43,
+      0xc1, 0x82, 0x10, 0x82, 0x89, 0xb1, 0xf1, 0xa7, 0xf1, 0x6d, 0xd3, 0x5d,
+      0x85, 0xc8, 0x24, 0xea, 0x3b, 0xdb, 0x97, 0xf6, 0x6c, 0x97, 0x6d, 0x83,
+      0x71, 0x52, 0x66, 0xac, 0xdb, 0xd6, 0x6f, 0xaf, 0x6a, 0x75, 0x07, 0xcf,
+      0x35, 0x2c, 0x38, 0x4c, 0xf2, 0xd3, 0x36, 0xa9, 0x04, 0x7e, 0x17, 0xdf,
+      0xcf, 0x65, 0x33, 0x42, 0x5b, 0xd5, 0x6d, 0x10, 0xdd, 0x2f, 0x7a, 0xe2,
+      0xba, 0x3d, 0x1d, 0x02, 0xe5, 0xff, 0x62, 0xad, 0x33, 0xa2, 0xf3, 0x9e},
+     {0x00, 0x01, 0x65, 0xbc, 0xf0, 0x43, 0xbe, 0x17, 0x02, 0x9d, 0xd8, 0x67,
+      0x06, 0x96, 0xbc, 0x06, 0x8f, 0x1a, 0x7d, 0x89, 0xc7, 0xcb, 0x28, 0x9e,
+      0x9f, 0x0b, 0x97, 0x52, 0xbc, 0x6e, 0x68, 0xde, 0xb1, 0xa8, 0xf6, 0xe4,
+      0x5e, 0x34, 0xc3, 0x50, 0x60, 0xb4, 0x0c, 0xe9, 0x2e, 0xc0, 0x5c, 0xa8,
+      0x3c, 0x25, 0x7a, 0xeb, 0xa5, 0xab, 0x9c, 0xf2, 0x68, 0x22, 0xb2, 0xc8,
+      0xf7, 0x34, 0x11, 0xdf, 0x30, 0x53, 0x17, 0x1c, 0x1f, 0xd1, 0x7b, 0xc0,
+      0x66, 0xf0, 0x10, 0xc5, 0xbb, 0x93, 0x1d, 0xfa, 0xeb, 0xb4, 0x2d, 0xe3,
+      0xff, 0x47, 0xed, 0x9c, 0xd7, 0xd9, 0xfc, 0x2a, 0x76, 0xd3, 0x76, 0x33}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x23, 0xd8, 0x94, 0xa3, 0x4d, 0x30, 0x0c, 0x71, 0xdb, 0xbd,
+      0x3b, 0x40, 0x34, 0xc9, 0x26, 0x9c, 0x0f, 0x4d, 0xc6, 0x8b, 0x30, 0xbf,
+      0x53, 0x26, 0xe2, 0x79, 0x47, 0x28, 0x65, 0x71, 0x5e, 0x84, 0xd3, 0x88,
+      0xfe, 0xa6, 0xd7, 0x6f, 0xbe, 0xc1, 0x9c, 0xc0, 0x44, 0x96, 0x0d, 0x05,
+      0x31, 0xb9, 0xe0, 0x11, 0xd0, 0xe5, 0x0a, 0x9d, 0x18, 0xa5, 0x9c, 0xae,
+      0x21, 0x9b, 0x18, 0x4d, 0x0e, 0xa5, 0x43, 0x3e, 0x33, 0xbc, 0xe8, 0x85,
+      0x9a, 0xad, 0xa5, 0xa0, 0x33, 0xd9, 0xf7, 0xd7, 0xf7, 0x7f, 0x54, 0xc5,
+      0x14, 0x1f, 0xa4, 0xf1, 0x4e, 0xab, 0xad, 0x76, 0xae, 0xfa, 0xe1, 0xb4},
+     {0x00, 0x00, 0x33, 0x16, 0x85, 0x70, 0x8f, 0x91, 0x24, 0x5d, 0xd4, 0x29,
+      0xb9, 0xd8, 0x68, 0xe5, 0x1f, 0x20, 0x79, 0x3d, 0xf0, 0x64, 0xd3, 0x45,
+      0xd3, 0x5c, 0x2f, 0x35, 0x1c, 0x7d, 0x84, 0x3c, 0xd7, 0xc8, 0x8d, 0x72,
+      0x4c, 0xd2, 0x7f, 0xb9, 0x33, 0xf5, 0x65, 0x35, 0xf4, 0x46, 0x9c, 0x3e,
+      0x97, 0x8c, 0x24, 0x23, 0xb2, 0x9f, 0xce, 0xd4, 0x84, 0xaf, 0xfc, 0xe1,
+      0x42, 0xb9, 0x5f, 0x03, 0xed, 0xf2, 0x9c, 0x63, 0xfa, 0x2f, 0x66, 0xc1,
+      0x7b, 0xbe, 0xac, 0x42, 0x80, 0xb9, 0x75, 0x5b, 0xdf, 0xb3, 0x08, 0xbb,
+      0x14, 0x20, 0xea, 0x22, 0x49, 0x49, 0xa9, 0xb3, 0xe4, 0x02, 0x38, 0x12},
+     {0x00, 0x00, 0x27, 0x17, 0xb4, 0x69, 0x0b, 0x5e, 0x15, 0x8f, 0xe4, 0x3b,
+      0xec, 0x59, 0x35, 0x6c, 0x03, 0xdf, 0xcc, 0xd5, 0x7e, 0x26, 0x2a, 0xec,
+      0x5e, 0x21, 0xd6, 0x6f, 0x15, 0x54, 0x62, 0x71, 0x13, 0x4c, 0x57, 0x23,
+      0x25, 0x6b, 0xa0, 0xe5, 0x67, 0xb2, 0xe1, 0x71, 0x82, 0xef, 0x90, 0xde,
+      0x71, 0xb0, 0x60, 0x82, 0x1c, 0xc5, 0xe4, 0x03, 0x6f, 0x45, 0x1c, 0x52,
+      0xad, 0x55, 0x3c, 0x92, 0xe3, 0x5b, 0x0d, 0xb3, 0xb6, 0x30, 0x74, 0x18,
+      0xd4, 0xc0, 0x19, 0xfe, 0x18, 0x83, 0x48, 0x04, 0xda, 0x08, 0xc1, 0x2f,
+      0x56, 0xf8, 0x9e, 0xc3, 0x44, 0x95, 0xb5, 0x5e, 0xe4, 0x52, 0x71, 0x1c},
+     {0x00, 0x00, 0xac, 0xde, 0x91, 0xdb, 0xa7, 0x23, 0xa6, 0x8c, 0x1a, 0x74,
+      0x8a, 0xbf, 0x54, 0x66, 0x3f, 0xa8, 0x13, 0xe8, 0x2d, 0x85, 0xaf, 0xf1,
+      0x69, 0xcc, 0x73, 0xa1, 0xf4, 0x6a, 0xe6, 0x9a, 0xbe, 0x81, 0x9c, 0x6e,
+      0x93, 0x08, 0xcb, 0xc9, 0xe4, 0xac, 0x75, 0xc8, 0xb2, 0x20, 0xbd, 0xa5,
+      0x5a, 0xd0, 0xf9, 0x20, 0xb2, 0xb9, 0xac, 0x83, 0x15, 0x39, 0xd9, 0xe2,
+      0x9c, 0x9b, 0x55, 0x94, 0xa7, 0x05, 0x57, 0xab, 0x5f, 0x3c, 0xe5, 0x10,
+      0x9f, 0x13, 0x72, 0xb2, 0xba, 0x03, 0xc2, 0x1f, 0x9e, 0xd6, 0x2c, 0x02,
+      0x3e, 0x74, 0xa3, 0x1f, 0xb4, 0xda, 0x71, 0xaa, 0xe1, 0xd1, 0xd2, 0x81}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x1b, 0x38, 0xdb, 0x5a, 0x20, 0xd2, 0x9a, 0xd0, 0x93, 0x26,
+      0x4a, 0x9f, 0xc9, 0xc0, 0xc2, 0x06, 0x5c, 0x25, 0x37, 0x87, 0x28, 0x7e,
+      0x82, 0x90, 0x64, 0x99, 0xab, 0xc6, 0x72, 0xa5, 0x54, 0x98, 0xfe, 0x27,
+      0x49, 0xc1, 0xdc, 0xaa, 0x52, 0xe0, 0x54, 0xd9, 0x78, 0xf2, 0xff, 0x2c,
+      0xdf, 0x1a, 0x8d, 0x8e, 0xb5, 0xbe, 0xd0, 0x9a, 0x2e, 0x4e, 0xcb, 0x6c,
+      0xdf, 0x96, 0xcb, 0x52, 0x0f, 0x5f, 0x2e, 0xf9, 0xe0, 0x77, 0x6e, 0x48,
+      0xfb, 0x24, 0x2e, 0xc2, 0xf5, 0x85, 0x20, 0xc7, 0x9d, 0x22, 0x5e, 0x98,
+      0xdc, 0xfd, 0xf0, 0x3a, 0xc9, 0x47, 0xa9, 0xd2, 0xfc, 0x3b, 0x02, 0xfb},
+     {0x00, 0x01, 0x15, 0xc1, 0x72, 0xcb, 0xc1, 0x7f, 0x67, 0x61, 0x5b, 0xfe,
+      0xef, 0xcf, 0xf7, 0x92, 0x31, 0x12, 0x3f, 0xcd, 0x7d, 0xca, 0x93, 0xa5,
+      0xed, 0x77, 0x7e, 0xb0, 0x93, 0xf0, 0xed, 0x5a, 0x20, 0x8c, 0xf1, 0x99,
+      0x41, 0x62, 0xdb, 0xf2, 0x8f, 0xc8, 0xa8, 0x42, 0x71, 0x6c, 0xf3, 0x56,
+      0xb1, 0x0b, 0x27, 0x1a, 0x6c, 0xe5, 0x28, 0x39, 0xd9, 0x97, 0x55, 0x16,
+      0x8c, 0x76, 0x4e, 0x8b, 0x7a, 0xe1, 0xa9, 0x38, 0x65, 0xb0, 0x26, 0xbf,
+      0xfd, 0x3b, 0x61, 0x45, 0x15, 0xf2, 0x17, 0xb6, 0xd6, 0xb4, 0x51, 0xd3,
+      0x6a, 0xd0, 0x4e, 0x97, 0x03, 0x68, 0x5c, 0xce, 0xcb, 0x2c, 0xb6, 0x4e},
+     {0x00, 0x00, 0x76, 0x53, 0x3d, 0xc7, 0x70, 0xf6, 0xed, 0xd2, 0x4c, 0x1f,
+      0xe3, 0x85, 0x14, 0x5b, 0xfa, 0xcb, 0x0c, 0xd7, 0xc4, 0x7d, 0x29, 0x0c,
+      0x98, 0x67, 0x84, 0x14, 0x38, 0x49, 0x8e, 0x0e, 0xee, 0x6a, 0x13, 0xe0,
+      0x21, 0xb8, 0x80, 0xf6, 0x5d, 0xd6, 0x99, 0xfd, 0xae, 0xd6, 0x28, 0x25,
+      0x28, 0xa4, 0x90, 0x40, 0x1c, 0x14, 0x1f, 0x19, 0xa6, 0x7e, 0xd9, 0x38,
+      0x3e, 0xd9, 0x11, 0x8c, 0x9c, 0x9e, 0x55, 0x47, 0x75, 0x52, 0x57, 0xea,
+      0x7a, 0x0c, 0x4e, 0xda, 0xae, 0x44, 0x3b, 0xb1, 0xc9, 0x58, 0x97, 0xa3,
+      0x37, 0x85, 0x39, 0xa7, 0xd0, 0x00, 0x33, 0xdf, 0xcd, 0xa7, 0x3c, 0x54},
+     {0x00, 0x01, 0x85, 0xd7, 0xb4, 0x4c, 0xc7, 0x30, 0xea, 0xba, 0xfd, 0x50,
+      0x55, 0xc3, 0x02, 0xb1, 0x5e, 0x06, 0xa9, 0x72, 0x92, 0x6a, 0x33, 0xc0,
+      0xc8, 0x3e, 0x38, 0x2f, 0x95, 0xa6, 0xf8, 0x80, 0x43, 0x61, 0xea, 0x68,
+      0x6c, 0x9b, 0x02, 0x07, 0x6a, 0x78, 0xc9, 0xca, 0x0b, 0x1a, 0x05, 0xc3,
+      0x12, 0x61, 0xc2, 0x1d, 0xd3, 0x28, 0x38, 0x3b, 0x03, 0xeb, 0xb6, 0xe8,
+      0x4a, 0x0e, 0xdc, 0x83, 0xfd, 0x78, 0x00, 0x0d, 0x33, 0x28, 0xc8, 0x95,
+      0x10, 0x9f, 0xcd, 0x50, 0x7a, 0x34, 0x24, 0xf0, 0xa1, 0xdc, 0x1a, 0x29,
+      0x63, 0xce, 0x16, 0xa6, 0x7d, 0xce, 0xdb, 0x2a, 0x62, 0xb0, 0x73, 0x0d}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x0c, 0x17, 0x48, 0xf8, 0xc5, 0x74, 0x6a, 0xce, 0x87, 0xa2,
+      0x15, 0x61, 0xb9, 0x86, 0x73, 0x79, 0x23, 0x19, 0xee, 0x9e, 0x34, 0x6f,
+      0xc3, 0x42, 0x3e, 0xe4, 0x75, 0xcb, 0xe8, 0x59, 0x3d, 0x1d, 0x48, 0x76,
+      0x74, 0x39, 0xc7, 0xb6, 0xdb, 0x60, 0x60, 0x7c, 0x1c, 0x58, 0xf1, 0x31,
+      0x1b, 0x39, 0x8f, 0x8d, 0xf1, 0x95, 0x45, 0x82, 0xb0, 0xd4, 0xdc, 0x8e,
+      0x15, 0xe5, 0x08, 0x3a, 0xff, 0x70, 0x08, 0xae, 0xef, 0xcf, 0x97, 0x82,
+      0x69, 0xc5, 0x58, 0x28, 0xa8, 0x4f, 0xaa, 0xd4, 0x8d, 0x99, 0x1e, 0x24,
+      0x8d, 0x22, 0x1e, 0x4f, 0xfe, 0xde, 0xf7, 0x63, 0x25, 0x39, 0xa9, 0xc1},
+     {0x00, 0x00, 0x5b, 0x7e, 0x48, 0x65, 0x78, 0x41, 0x19, 0x87, 0xa1, 0x01,
+      0x65, 0x70, 0xb3, 0x3c, 0x55, 0xda, 0x41, 0x0c, 0xdf, 0x1f, 0x59, 0xe4,
+      0x70, 0xb5, 0x19, 0x9d, 0xf2, 0x4b, 0xe1, 0x01, 0xbd, 0xf0, 0x81, 0xd6,
+      0xe2, 0xe2, 0x34, 0xcb, 0x1e, 0xd0, 0xa3, 0xa7, 0xf9, 0x10, 0x08, 0x24,
+      0x49, 0x66, 0x12, 0x4b, 0x26, 0x5a, 0x88, 0x8a, 0x30, 0xf3, 0x14, 0x0b,
+      0xe7, 0xbb, 0x44, 0x99, 0xcc, 0xd4, 0x9c, 0xcf, 0x25, 0xb7, 0x59, 0xc9,
+      0x66, 0x51, 0x5d, 0x80, 0x32, 0xc0, 0x22, 0xd7, 0x63, 0xb4, 0x11, 0xdb,
+      0x12, 0x0c, 0xa0, 0xd7, 0x49, 0x67, 0x70, 0x92, 0xfd, 0x0f, 0x14, 0x92},
+     {0x00, 0x00, 0xfe, 0x60, 0x44, 0xf0, 0xec, 0xe0, 0x12, 0xa8, 0xc4, 0xaf,
+      0xee, 0x09, 0x54, 0x3e, 0xa1, 0x93, 0x53, 0x43, 0xdd, 0x58, 0x4e, 0xaf,
+      0x40, 0xac, 0x13, 0x7d, 0xef, 0xb3, 0xed, 0x5c, 0xd4, 0x8c, 0x2f, 0xde,
+      0xe7, 0x91, 0x5d, 0xb9, 0x37, 0xd9, 0xc7, 0xb5, 0x2e, 0x36, 0xdf, 0x44,
+      0xe9, 0xe0, 0x04, 0x11, 0x92, 0x3d, 0xb0, 0x5b, 0xdf, 0x19, 0x15, 0x94,
+      0x30, 0x8e, 0x3d, 0x14, 0xff, 0xdb, 0x1a, 0x4c, 0x40, 0xa4, 0x72, 0x0c,
+      0xa6, 0xd7, 0xb1, 0x0b, 0xa5, 0x26, 0xc0, 0xa5, 0x9b, 0xb5, 0xab, 0xa2,
+      0xab, 0x72, 0x7b, 0xa6, 0x1f, 0x87, 0x3d, 0x61, 0x81, 0x4c, 0xc7, 0x46},
+     {0x00, 0x01, 0x04, 0x7b, 0x61, 0x09, 0x3f, 0x1f, 0xaf, 0x73, 0xd4, 0xb2,
+      0x7a, 0xd8, 0x62, 0x94, 0x87, 0xea, 0x55, 0xd6, 0x0a, 0xc4, 0x32, 0x38,
+      0xd7, 0x29, 0x47, 0x27, 0x65, 0x98, 0xfd, 0x75, 0x29, 0xee, 0x40, 0xfa,
+      0xd7, 0x44, 0x38, 0x17, 0xdb, 0x1c, 0x32, 0xd6, 0x23, 0x57, 0xa9, 0x44,
+      0x47, 0xfc, 0x69, 0x13, 0xbb, 0xeb, 0x99, 0xbd, 0xd5, 0x2e, 0x2f, 0x18,
+      0x2e, 0x7d, 0x27, 0x68, 0x50, 0x4d, 0x67, 0x77, 0xe8, 0xc2, 0xdb, 0x3a,
+      0x15, 0xb8, 0x2b, 0x9b, 0xcc, 0x67, 0xc6, 0xba, 0x49, 0x77, 0x4d, 0xef,
+      0x5d, 0x50, 0x56, 0x94, 0xcf, 0x43, 0xe6, 0x85, 0xa8, 0xa0, 0x9d, 0xaf}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x99, 0xe1, 0x4d, 0x73, 0x36, 0x6c, 0xb6, 0x85, 0x33, 0xd3,
+      0x33, 0x88, 0xb9, 0xea, 0xab, 0xcb, 0xcb, 0x20, 0x0a, 0xf6, 0xb8, 0xe3,
+      0xa6, 0xc3, 0x5f, 0xf7, 0xb4, 0xd9, 0xfc, 0x60, 0x93, 0xaa, 0x5b, 0xb5,
+      0x5f, 0xae, 0xbc, 0x78, 0xc4, 0xd6, 0xec, 0x1f, 0x52, 0x6a, 0x50, 0xc8,
+      0x27, 0x72, 0xfc, 0x52, 0xf7, 0xbe, 0x1c, 0x0e, 0xc5, 0xa6, 0xcb, 0x8c,
+      0x77, 0x47, 0x3a, 0x52, 0x71, 0xed, 0x39, 0x79, 0xcf, 0xef, 0x7c, 0x6e,
+      0x4c, 0xb7, 0xe2, 0x3e, 0xa2, 0x07, 0x9b, 0x01, 0xff, 0xee, 0x4e, 0xc8,
+      0xff, 0x26, 0x4a, 0xfe, 0x68, 0xfd, 0x38, 0xa6, 0xb9, 0x81, 0x34, 0xc4},
+     {0x00, 0x00, 0x44, 0x05, 0x7e, 0xcd, 0x06, 0x99, 0x0c, 0xcd, 0x72, 0xde,
+      0x0a, 0xb2, 0x4e, 0xf3, 0x10, 0x19, 0x0d, 0x6c, 0x6c, 0x1d, 0xb8, 0xc5,
+      0xc8, 0xbb, 0xb1, 0xd4, 0x9d, 0x10, 0xe2, 0x8d, 0x14, 0xd0, 0xb5, 0xc5,
+      0xaa, 0x5c, 0xec, 0x04, 0xf6, 0x03, 0x25, 0x98, 0xe3, 0x7a, 0x1f, 0xc2,
+      0x23, 0xa7, 0x54, 0xb7, 0x95, 0xc2, 0xcb, 0x4f, 0x41, 0x5e, 0xe2, 0x5d,
+      0xc3, 0xb0, 0x90, 0xa7, 0xc5, 0x6c, 0xbb, 0x23, 0xcd, 0x8f, 0x66, 0x1e,
+      0xe1, 0x20, 0xd8, 0x74, 0x5b, 0x34, 0x0e, 0xe5, 0x9f, 0x4b, 0x28, 0xbc,
+      0x24, 0x09, 0x18, 0x6a, 0xa5, 0x05, 0xf9, 0xff, 0x58, 0xc0, 0x51, 0xaa},
+     {0x00, 0x00, 0x18, 0xd0, 0x21, 0xb4, 0x90, 0x9c, 0xe5, 0x6a, 0x3c, 0xc6,
+      0xbf, 0xc1, 0x53, 0x93, 0x98, 0x09, 0xde, 0x46, 0x36, 0x08, 0x7e, 0x55,
+      0x7f, 0x2d, 0x3c, 0x6c, 0x28, 0x6b, 0xec, 0xec, 0xce, 0xe1, 0x98, 0xe1,
+      0x28, 0x41, 0x4f, 0xad, 0x3c, 0xc4, 0x93, 0xbd, 0x74, 0xd4, 0x8f, 0xac,
+      0x10, 0x58, 0x8c, 0x6e, 0x09, 0x84, 0x35, 0x82, 0x0a, 0xeb, 0x10, 0x05,
+      0x78, 0xfa, 0x4b, 0x4a, 0x9e, 0xca, 0x2a, 0xcc, 0x86, 0xf7, 0x70, 0x0f,
+      0xb2, 0x27, 0xd7, 0xbf, 0xfb, 0x5d, 0xeb, 0xfa, 0x38, 0x72, 0x18, 0x7b,
+      0xda, 0xf5, 0xd6, 0xd1, 0xa6, 0x49, 0xc7, 0x4d, 0x2b, 0xa2, 0x6a, 0x3a},
+     {0x00, 0x00, 0x90, 0xa2, 0x20, 0x0c, 0xf7, 0xde, 0x0f, 0xf5, 0x40, 0x5f,
+      0x59, 0x51, 0x36, 0x7f, 0xc7, 0xab, 0x9e, 0xcc, 0xe5, 0x23, 0xce, 0x75,
+      0x8c, 0xea, 0x4e, 0xf5, 0x2e, 0x87, 0x7f, 0x17, 0x47, 0x83, 0x17, 0x20,
+      0x53, 0xf1, 0x0e, 0x1a, 0xc0, 0x4c, 0xea, 0x03, 0xa1, 0xa9, 0x2c, 0x96,
+      0xd5, 0xa4, 0x3e, 0x23, 0x5d, 0x2d, 0xf8, 0xce, 0x14, 0x82, 0xca, 0x95,
+      0x1a, 0xf3, 0x1a, 0xcd, 0x3a, 0x01, 0x01, 0x5f, 0x22, 0x8b, 0x7b, 0xba,
+      0x19, 0xa2, 0x4d, 0x70, 0x8e, 0xbe, 0xb2, 0x25, 0x53, 0x27, 0x75, 0x17,
+      0x74, 0xb3, 0xc8, 0xe3, 0x2d, 0x9c, 0xb6, 0x6f, 0xe8, 0x0f, 0x7e, 0x04}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x32, 0xab, 0x4b, 0x1a, 0x4a, 0x57, 0x69, 0x47, 0x30, 0x73,
+      0xe1, 0xcc, 0x81, 0x42, 0xf9, 0xa6, 0x20, 0xc2, 0x5d, 0xfa, 0xaf, 0x82,
+      0x9a, 0x4a, 0x2b, 0x6c, 0x40, 0x5e, 0xe8, 0x8c, 0x82, 0x1f, 0x76, 0x5c,
+      0xac, 0x0f, 0x12, 0xe7, 0x39, 0x63, 0x31, 0x87, 0xaa, 0x34, 0x2a, 0x49,
+      0x4b, 0x67, 0x66, 0xb5, 0x6d, 0x4b, 0xf8, 0xe9, 0x53, 0x2d, 0x63, 0xd4,
+      0xce, 0x21, 0xf2, 0xb0, 0x36, 0xb4, 0x44, 0x28, 0xeb, 0xc1, 0xc1, 0xd0,
+      0xda, 0x9c, 0x8a, 0xd6, 0xba, 0x1d, 0x16, 0x7f, 0x36, 0xb7, 0x3f, 0xe0,
+      0x56, 0x96, 0x52, 0xae, 0xa0, 0x19, 0x8f, 0xa7, 0x4f, 0x52, 0x78, 0x33},
+     {0x00, 0x01, 0x37, 0xa3, 0x10, 0xa4, 0x6e, 0x79, 0x68, 0xd0, 0x08, 0xc4,
+      0x9b, 0x6e, 0x07, 0x3d, 0x1c, 0x1f, 0x6f, 0xad, 0xdc, 0xf3, 0x67, 0xbb,
+      0xb5, 0x06, 0x57, 0x84, 0x9e, 0x30, 0xa0, 0xca, 0x66, 0x12, 0xd1, 0x12,
+      0x15, 0x91, 0x05, 0xb2, 0xf6, 0x08, 0x0d, 0xde, 0xa2, 0xd5, 0x6f, 0xc1,
+      0xee, 0x86, 0x99, 0x44, 0x87, 0x48, 0x49, 0xfb, 0x3c, 0x23, 0xd7, 0x53,
+      0x10, 0x04, 0x5b, 0x9a, 0x7e, 0xe6, 0xc2, 0x1a, 0xbd, 0x23, 0x4f, 0x0c,
+      0x01, 0x69, 0x16, 0xbd, 0x4e, 0xd5, 0xf2, 0x31, 0x38, 0x23, 0x20, 0x33,
+      0x6b, 0x99, 0xe4, 0x6d, 0xfe, 0x66, 0x77, 0x11, 0xb3, 0x28, 0x4f, 0xd6},
+     {0x00, 0x01, 0x70, 0xbb, 0x01, 0x02, 0x13, 0x74, 0x5c, 0x1a, 0x6f, 0x61,
+      0xf3, 0xb8, 0xce, 0xdb, 0x4c, 0xa4, 0x21, 0x4e, 0x4a, 0x61, 0x3e, 0xb5,
+      0x6d, 0x99, 0xf1, 0xf4, 0x92, 0x80, 0x78, 0x6f, 0x16, 0xa9, 0x7b, 0x10,
+      0xfb, 0x1d, 0x2c, 0x6e, 0xef, 0x3e, 0x8e, 0x0e, 0xcf, 0xc6, 0xc5, 0x85,
+      0xa3, 0x32, 0x27, 0x01, 0x38, 0xc1, 0xc3, 0xdd, 0x78, 0xea, 0x98, 0x94,
+      0xf5, 0x2b, 0x25, 0x12, 0x17, 0xbc, 0x4b, 0x61, 0x8f, 0x76, 0xff, 0xf1,
+      0xe3, 0x61, 0x04, 0x25, 0xf6, 0xb9, 0x80, 0x84, 0x22, 0x81, 0xd5, 0xa9,
+      0x62, 0x92, 0xd6, 0x95, 0x56, 0x4e, 0xb1, 0x3d, 0x14, 0x5b, 0x2f, 0xb6},
+     {0x00, 0x00, 0x23, 0xd9, 0xfc, 0x16, 0x8a, 0x3d, 0xe0, 0x47, 0xb0, 0x5e,
+      0x6b, 0x61, 0x29, 0x02, 0xf0, 0xfd, 0x77, 0x00, 0x38, 0x11, 0x09, 0x77,
+      0x49, 0x16, 0xe6, 0x98, 0xd6, 0xe2, 0x27, 0x7e, 0xff, 0x8e, 0xed, 0xe8,
+      0x2b, 0x81, 0xf8, 0xd3, 0x54, 0xe5, 0x62, 0xbb, 0xa4, 0xe4, 0x7c, 0x5d,
+      0x1c, 0xe4, 0xea, 0x36, 0x3b, 0x5d, 0xed, 0x3d, 0x66, 0x08, 0x5c, 0xfe,
+      0x19, 0xa5, 0xc9, 0x58, 0xe9, 0xc0, 0x75, 0xfe, 0x5f, 0xb4, 0x3d, 0x8f,
+      0xe3, 0x03, 0x52, 0x10, 0xaf, 0x15, 0x9f, 0xf3, 0x5a, 0xeb, 0x84, 0x29,
+      0xe6, 0x27, 0x16, 0x7a, 0x0b, 0xa3, 0xbb, 0x71, 0x17, 0x57, 0x70, 0xf7}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x73, 0xf2, 0x91, 0x0a, 0xe3, 0x31, 0xfe, 0xa0, 0x9c, 0xce,
+      0x4b, 0xbf, 0xd7, 0x5a, 0x97, 0xe8, 0x3c, 0xd5, 0xc8, 0xb3, 0x39, 0x73,
+      0x36, 0x25, 0x07, 0x38, 0xfa, 0xf1, 0x51, 0x00, 0xbe, 0xc9, 0xbc, 0x68,
+      0xfc, 0x70, 0x56, 0xf3, 0x01, 0x14, 0x96, 0xf6, 0x0e, 0xb6, 0xe2, 0xd7,
+      0x2a, 0x2a, 0xc4, 0x45, 0x97, 0xcd, 0x5e, 0x6f, 0x7e, 0xab, 0x4b, 0xde,
+      0x7d, 0xca, 0x2e, 0x8a, 0x2d, 0x30, 0xf9, 0x73, 0x87, 0x5f, 0xe8, 0x1d,
+      0xde, 0x08, 0x4c, 0x3b, 0x11, 0x16, 0xcf, 0x12, 0xb8, 0xea, 0x91, 0xc8,
+      0x24, 0xa7, 0x5b, 0x66, 0xb9, 0x80, 0x81, 0x08, 0x91, 0x9f, 0x7c, 0x25},
+     {0x00, 0x01, 0x7a, 0x35, 0x7c, 0x45, 0xc9, 0xf2, 0x90, 0xd1, 0x3d, 0xf6,
+      0xd2, 0x99, 0x16, 0xcc, 0x56, 0x6a, 0xf4, 0x15, 0xe3, 0x99, 0x3c, 0x69,
+      0xd1, 0xfd, 0x0e, 0x04, 0x34, 0x86, 0xe2, 0x35, 0x1f, 0xe0, 0x88, 0x0d,
+      0x47, 0xa7, 0x17, 0xf3, 0x5f, 0xf8, 0xec, 0xdb, 0x46, 0x66, 0x74, 0xb5,
+      0xac, 0x44, 0x0e, 0x14, 0x9a, 0x0f, 0xf9, 0xc4, 0xd9, 0xfd, 0xf6, 0x90,
+      0x88, 0x1c, 0x1c, 0x99, 0x25, 0xf8, 0x4e, 0x2b, 0x61, 0x3c, 0x5d, 0xdc,
+      0x5c, 0x44, 0x77, 0xfe, 0x4e, 0x0a, 0x0a, 0xf5, 0xad, 0x98, 0x9f, 0x61,
+      0x50, 0xa8, 0xee, 0x79, 0xdd, 0xf7, 0xe3, 0xce, 0xc1, 0x54, 0x87, 0x46},
+     {0x00, 0x01, 0x3c, 0xaf, 0xdc, 0xaa, 0xdc, 0xe6, 0x2c, 0xc7, 0x23, 0x9a,
+      0x12, 0xae, 0x23, 0x96, 0x52, 0x85, 0x7b, 0x2f, 0x22, 0xbe, 0x3f, 0x93,
+      0xab, 0xdd, 0x42, 0xf0, 0x7c, 0x5a, 0xbc, 0x69, 0x1b, 0x7f, 0x8e, 0x08,
+      0x41, 0x7d, 0xa2, 0x4a, 0x61, 0x13, 0xa8, 0x73, 0xbb, 0xc3, 0xd3, 0x00,
+      0x81, 0x20, 0x83, 0x53, 0x65, 0xfb, 0xef, 0x11, 0x4d, 0x06, 0x02, 0x57,
+      0x4d, 0x42, 0x31, 0x71, 0xfd, 0x4e, 0xad, 0x56, 0xab, 0x04, 0xc3, 0xe2,
+      0xf2, 0x79, 0x1b, 0x1a, 0x73, 0x17, 0x80, 0xcc, 0xf7, 0x75, 0x11, 0xa4,
+      0x8e, 0x4a, 0x32, 0x53, 0x0b, 0x8a, 0xab, 0x71, 0x4a, 0x8b, 0x50, 0x1e},
+     {0x00, 0x00, 0xfa, 0xcf, 0x29, 0xa0, 0xc1, 0x3e, 0xeb, 0x4f, 0xda, 0xea,
+      0x0d, 0x1a, 0x4e, 0x33, 0x16, 0x3f, 0x9a, 0x51, 0x89, 0x96, 0xa9, 0x3a,
+      0x97, 0xaa, 0x83, 0xba, 0x38, 0xe3, 0xd4, 0xbe, 0xfc, 0x03, 0xdf, 0xad,
+      0x4c, 0x80, 0xc0, 0x01, 0x3a, 0x48, 0xa0, 0x7d, 0x41, 0xf3, 0x48, 0xf4,
+      0x86, 0x77, 0x2f, 0x18, 0xd8, 0xdd, 0x45, 0x51, 0xde, 0x93, 0xa9, 0xef,
+      0x93, 0x22, 0x06, 0xa5, 0x2b, 0x4e, 0xa9, 0x0f, 0x79, 0xea, 0x2a, 0x77,
+      0x3c, 0x65, 0xde, 0xc2, 0x89, 0xe3, 0x80, 0x37, 0x9d, 0xb2, 0xc7, 0xc9,
+      0x7a, 0x02, 0x28, 0x29, 0xda, 0xd5, 0x5c, 0xcc, 0x4b, 0x10, 0x78, 0x53}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0xb8, 0x24, 0x2f, 0xed, 0x5e, 0x81, 0x41, 0x68, 0xf6, 0xd8,
+      0x55, 0xe5, 0x44, 0x28, 0xc7, 0x73, 0xda, 0x7b, 0x9c, 0xc6, 0xa3, 0x84,
+      0x57, 0x57, 0x52, 0xfe, 0xb3, 0xcf, 0x0a, 0x18, 0xe1, 0xc3, 0x93, 0xaa,
+      0xba, 0xa1, 0xf9, 0x7b, 0x28, 0xc4, 0xf5, 0x03, 0xda, 0x65, 0x72, 0x36,
+      0x64, 0x29, 0x1f, 0xaa, 0x3e, 0x51, 0xbd, 0x08, 0x36, 0x85, 0xc8, 0x80,
+      0x42, 0x0e, 0x06, 0x35, 0x11, 0x29, 0x57, 0x6f, 0x14, 0xd1, 0xee, 0xf4,
+      0x5a, 0x74, 0xb5, 0x60, 0xec, 0xf8, 0xa8, 0x4f, 0xc7, 0xfc, 0xf8, 0x5b,
+      0xe5, 0x8e, 0x11, 0xc5, 0xdc, 0xb5, 0x9e, 0x4b, 0x19, 0xcf, 0xf3, 0xdb},
+     {0x00, 0x01, 0x86, 0xf4, 0x10, 0x46, 0x07, 0x20, 0x41, 0x02, 0x27, 0x0b,
+      0x2b, 0xde, 0x53, 0xd2, 0x26, 0x7d, 0x93, 0x4b, 0x08, 0x29, 0xc3, 0x87,
+      0xcc, 0xea, 0x41, 0xcb, 0xde, 0x46, 0x88, 0x40, 0x18, 0x10, 0x27, 0x41,
+      0x51, 0x02, 0x8b, 0xef, 0xad, 0x63, 0x21, 0xb5, 0xb0, 0x13, 0x48, 0xe3,
+      0x07, 0x53, 0xc6, 0x96, 0xf1, 0x1e, 0x7f, 0xf4, 0xef, 0x6b, 0xfa, 0xef,
+      0x6f, 0x4b, 0x01, 0x71, 0xa4, 0xf9, 0xae, 0xda, 0xa5, 0x7b, 0x82, 0x26,
+      0x53, 0x38, 0x65, 0x6e, 0x83, 0x93, 0x47, 0xf5, 0x0f, 0x7f, 0x9d, 0x61,
+      0x94, 0x03, 0x46, 0x96, 0x45, 0x97, 0x36, 0x58, 0xd1, 0x03, 0x2a, 0x60},
+     {0x00, 0x01, 0x42, 0x8c, 0x7b, 0x49, 0x46, 0x99, 0x10, 0x3a, 0x2a, 0x6d,
+      0x58, 0x16, 0x11, 0xeb, 0xfd, 0x51, 0x96, 0x72, 0xb3, 0xea, 0xd0, 0xa3,
+      0x5b, 0x0e, 0x37, 0x0d, 0x32, 0x0a, 0x14, 0x13, 0x1f, 0xc0, 0x84, 0xb1,
+      0x07, 0xc6, 0xf7, 0x2d, 0xf1, 0xfd, 0x0e, 0x4d, 0xf3, 0xc7, 0xf6, 0x13,
+      0x1f, 0x2a, 0x0f, 0xba, 0x55, 0x28, 0x3a, 0x58, 0xb6, 0x21, 0x7f, 0xd7,
+      0x96, 0x11, 0x0c, 0x1c, 0xad, 0xa9, 0x1d, 0xb0, 0xec, 0x6c, 0xea, 0x20,
+      0x70, 0x7a, 0xa7, 0xe1, 0x63, 0x75, 0x19, 0xbb, 0x31, 0xbc, 0xb3, 0xcb,
+      0x4f, 0xf3, 0xc4, 0xd9, 0x1e, 0x06, 0x79, 0x68, 0xeb, 0xed, 0xa5, 0x54},
+     {0x00, 0x00, 0x0d, 0x0f, 0x5a, 0x8e, 0xc3, 0x2e, 0x4e, 0x27, 0x56, 0xcc,
+      0x30, 0x6d, 0x09, 0xa5, 0x32, 0xd5, 0x1e, 0x6b, 0x52, 0xb9, 0x87, 0xfb,
+      0xe5, 0x60, 0xf4, 0x91, 0x23, 0x8d, 0x14, 0xa2, 0xa4, 0xec, 0xae, 0x54,
+      0x7d, 0x04, 0x41, 0xb9, 0xb8, 0xd0, 0x3a, 0xa9, 0xb4, 0x34, 0xcc, 0x2f,
+      0xc9, 0x7a, 0x76, 0x35, 0x06, 0xd5, 0x8d, 0xad, 0xf4, 0x2b, 0x64, 0x70,
+      0x8a, 0xc9, 0x28, 0x88, 0x88, 0x6e, 0x1b, 0xb8, 0xd3, 0x54, 0x90, 0xcb,
+      0xee, 0x94, 0x5d, 0xb2, 0x09, 0x1a, 0x87, 0x84, 0xf5, 0x77, 0xf4, 0x9d,
+      0x4a, 0x87, 0x32, 0x64, 0xdb, 0x28, 0xe7, 0x0c, 0x7d, 0xa0, 0x9a, 0x6a}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0xbc, 0xa1, 0x63, 0xb3, 0x54, 0xcb, 0xb9, 0xf3, 0x67, 0x24,
+      0xaa, 0x89, 0x3c, 0xf4, 0x1b, 0x3f, 0xb4, 0x5b, 0x96, 0xf8, 0x72, 0x23,
+      0x1d, 0xb1, 0x00, 0xb3, 0xb1, 0xee, 0x51, 0xfe, 0xf2, 0xce, 0xfb, 0xef,
+      0xd2, 0x57, 0x9d, 0xf9, 0xa1, 0xf9, 0x43, 0x13, 0x00, 0x07, 0x67, 0xbc,
+      0x77, 0x85, 0x51, 0x62, 0x53, 0x9c, 0xba, 0xa5, 0x50, 0xcd, 0xd3, 0xac,
+      0x62, 0x3b, 0x85, 0xae, 0x2b, 0x0c, 0xef, 0xc1, 0x75, 0xb1, 0x9f, 0x19,
+      0xa5, 0xd3, 0x60, 0x07, 0xbb, 0xf4, 0xab, 0xab, 0xdf, 0x20, 0x32, 0x07,
+      0x0a, 0x41, 0x45, 0x81, 0xed, 0x5b, 0x2c, 0x18, 0x0c, 0x4e, 0x2b, 0x64},
+     {0x00, 0x00, 0x0c, 0xe0, 0xa7, 0xe6, 0x42, 0x27, 0x08, 0xe7, 0x3d, 0x4f,
+      0x3c, 0x07, 0xdd, 0x95, 0xf2, 0xe6, 0x7c, 0xc4, 0xd9, 0xfe, 0xb4, 0x5e,
+      0x95, 0xc6, 0xc4, 0x5b, 0xa9, 0x80, 0x9b, 0x0b, 0xb7, 0x9d, 0x37, 0x2a,
+      0x5c, 0xf9, 0xa4, 0xe0, 0xce, 0x4a, 0xe1, 0xa1, 0xa9, 0xba, 0x1e, 0x7e,
+      0x15, 0xbf, 0x9b, 0xdd, 0x80, 0x38, 0xab, 0x13, 0x31, 0x99, 0x93, 0xb9,
+      0xf4, 0x4f, 0x1d, 0xbe, 0x64, 0x69, 0x7a, 0xbb, 0x6e, 0xce, 0x27, 0x9c,
+      0xa7, 0xa6, 0xb7, 0x7a, 0x81, 0x64, 0x58, 0xcb, 0x20, 0x59, 0x6c, 0x88,
+      0x43, 0x6b, 0xc7, 0xcd, 0x23, 0x84, 0x62, 0x09, 0x41, 0x63, 0x3d, 0xe0},
+     {0x00, 0x00, 0x07, 0xa4, 0xb8, 0x9a, 0x4c, 0x2c, 0x61, 0xfc, 0xb2, 0xa0,
+      0x9e, 0xbd, 0xd0, 0x77, 0x44, 0xd6, 0x10, 0x5a, 0xa5, 0xe4, 0x24, 0xc3,
+      0x11, 0x73, 0x9b, 0x7c, 0xdb, 0x03, 0x98, 0xb9, 0xdd, 0xd7, 0x82, 0x25,
+      0x54, 0x6e, 0xd6, 0xa2, 0xf4, 0x12, 0x7a, 0x63, 0x45, 0x95, 0x86, 0xaf,
+      0xcd, 0x43, 0x28, 0x18, 0x4c, 0x63, 0x7a, 0x7a, 0xde, 0xfc, 0x05, 0x10,
+      0x03, 0xa5, 0xde, 0xc8, 0xa5, 0x20, 0xb7, 0x1b, 0xe0, 0x2c, 0xc2, 0x93,
+      0x72, 0xda, 0x0e, 0x2b, 0x2a, 0x16, 0x7e, 0x8d, 0x83, 0x55, 0x2f, 0x80,
+      0x9a, 0x73, 0x5f, 0x78, 0x9e, 0xd2, 0x83, 0x79, 0x27, 0xe9, 0x80, 0x5e},
+     {0x00, 0x00, 0x30, 0x55, 0xc2, 0x68, 0x28, 0x10, 0x04, 0x96, 0x5b, 0xce,
+      0x1f, 0x3c, 0x50, 0x20, 0x8e, 0xac, 0x9e, 0xc5, 0xd0, 0x92, 0xa7, 0xf0,
+      0x4f, 0x1f, 0x24, 0x70, 0xb1, 0x63, 0xaa, 0x8d, 0x3b, 0xa5, 0x16, 0x75,
+      0xa4, 0xc8, 0x3b, 0x03, 0x00, 0xb4, 0x81, 0xab, 0x25, 0x84, 0x44, 0xef,
+      0xfa, 0xd1, 0x61, 0x32, 0xa9, 0x79, 0x3f, 0x13, 0xa4, 0xa8, 0x14, 0x05,
+      0x84, 0x1e, 0x48, 0x37, 0x3e, 0xbd, 0x10, 0xf2, 0x0e, 0x46, 0x4b, 0xdb,
+      0x54, 0xca, 0x6e, 0xf0, 0x9c, 0x99, 0x62, 0xf8, 0x6c, 0x5a, 0x3b, 0xc7,
+      0x06, 0x3d, 0x8b, 0x6e, 0xca, 0xcd, 0x5d, 0x16, 0xa0, 0xde, 0x3c, 0x54}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x91, 0xca, 0x03, 0x0a, 0xf2, 0xee, 0x3a, 0xcf, 0x51, 0xaf,
+      0x29, 0xb5, 0x6b, 0x13, 0xac, 0x7f, 0x5f, 0x20, 0xb7, 0x2e, 0x40, 0x75,
+      0x43, 0x28, 0x35, 0xac, 0x79, 0x63, 0x1b, 0x2e, 0x7a, 0x4e, 0x43, 0x1e,
+      0x91, 0xb1, 0xe1, 0x4c, 0xca, 0x3f, 0x5f, 0xbb, 0xc0, 0xc3, 0x5a, 0x3d,
+      0x70, 0x17, 0xc5, 0xd2, 0x45, 0x70, 0xdb, 0x79, 0xd5, 0xd5, 0xbb, 0x74,
+      0x0c, 0x5a, 0xf2, 0xd0, 0x92, 0x22, 0x97, 0x84, 0x72, 0xcd, 0x2c, 0x14,
+      0xfc, 0x0e, 0x1f, 0x21, 0xba, 0xfa, 0x3c, 0xbf, 0x19, 0xa2, 0xac, 0x20,
+      0x9c, 0x9c, 0x26, 0x1b, 0x42, 0x04, 0xc0, 0xb5, 0x51, 0xc1, 0x4a, 0x1f},
+     {0x00, 0x01, 0xa7, 0xfa, 0xc5, 0x7b, 0x09, 0x5c, 0x81, 0x5f, 0x24, 0x3e,
+      0xc2, 0x99, 0x76, 0x2a, 0xb2, 0xdc, 0x9b, 0x3d, 0x2a, 0x6e, 0xa0, 0xb8,
+      0x1c, 0x88, 0xbd, 0xfa, 0x85, 0xc9, 0x44, 0x6c, 0x83, 0x47, 0x3f, 0x88,
+      0x52, 0x0b, 0x69, 0xa7, 0x93, 0xa1, 0xc0, 0x86, 0x1b, 0x8a, 0x17, 0xc4,
+      0x90, 0x44, 0xb9, 0xb8, 0x51, 0xff, 0x61, 0x33, 0xdb, 0x26, 0xce, 0x1c,
+      0x9b, 0x3d, 0xb8, 0x4a, 0x4a, 0x02, 0x2e, 0x1b, 0xb2, 0x10, 0xe1, 0x37,
+      0xb0, 0xd3, 0x0f, 0x64, 0x57, 0x4b, 0xfb, 0x77, 0xcb, 0x8d, 0xba, 0x02,
+      0x9b, 0xe6, 0xcc, 0x2b, 0x8c, 0xfc, 0xd2, 0xee, 0x48, 0x4f, 0xcd, 0x8a},
+     {0x00, 0x00, 0xed, 0xd6, 0x87, 0x07, 0xcc, 0x0c, 0x3c, 0xd7, 0x6c, 0x56,
+      0x72, 0xc1, 0x11, 0xf6, 0x5f, 0x30, 0xbc, 0x9c, 0xd1, 0xda, 0x19, 0x1b,
+      0xa8, 0x79, 0x49, 0x18, 0xd2, 0x8f, 0xf3, 0x5f, 0x19, 0x86, 0xca, 0x93,
+      0xb8, 0xa9, 0x00, 0xdc, 0x9c, 0x94, 0xcd, 0x7e, 0x46, 0xbc, 0x30, 0xa6,
+      0x76, 0x8f, 0x0e, 0xf1, 0x6e, 0x6b, 0x61, 0xeb, 0x41, 0xa9, 0xf6, 0x6c,
+      0xa9, 0xec, 0xdf, 0x07, 0x6d, 0x0e, 0x9a, 0x4b, 0x25, 0x33, 0xe9, 0x2b,
+      0x9e, 0xea, 0x83, 0x85, 0xe6, 0xbe, 0x73, 0x3f, 0xb9, 0xe2, 0x02, 0x9c,
+      0xee, 0x81, 0x5d, 0xd1, 0xb9, 0x6c, 0xb2, 0x1d, 0xde, 0x61, 0xd6, 0x5e},
+     {0x00, 0x01, 0xba, 0xdf, 0x68, 0x65, 0x67, 0xfe, 0xca, 0x9a, 0x67, 0xe1,
+      0x22, 0x46, 0xa5, 0xb6, 0x1b, 0x87, 0xe9, 0xa6, 0x4b, 0x83, 0x6d, 0x41,
+      0x52, 0x69, 0x05, 0xb4, 0x6f, 0x45, 0xf7, 0xbd, 0x28, 0xa1, 0x6a, 0xef,
+      0xe5, 0x24, 0xdc, 0x87, 0x0c, 0x5a, 0x14, 0xea, 0x1f, 0x84, 0x03, 0x21,
+      0x9d, 0x0f, 0xa7, 0x0c, 0x43, 0xee, 0x02, 0x37, 0xae, 0x39, 0xd1, 0xcd,
+      0x6b, 0x54, 0xe2, 0x42, 0x0b, 0x6e, 0x5c, 0xaa, 0x49, 0x1b, 0xe4, 0xbf,
+      0x1a, 0xd0, 0xcf, 0xc5, 0x6b, 0x07, 0xe0, 0x7c, 0xd4, 0x4d, 0xa1, 0xb2,
+      0xf3, 0xb9, 0xfc, 0x61, 0x2a, 0x35, 0xdd, 0x25, 0x28, 0xd2, 0xc9, 0xb9}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x0f, 0x0b, 0x46, 0xb8, 0xe4, 0xbd, 0xc3, 0x03, 0xe4, 0xea,
+      0xc8, 0xcb, 0xd6, 0x44, 0x34, 0x17, 0xbc, 0x00, 0xd2, 0x16, 0x72, 0x84,
+      0xd1, 0x29, 0x8d, 0x5b, 0x50, 0xaf, 0x9f, 0x51, 0x52, 0xf1, 0x20, 0x85,
+      0x98, 0x53, 0x5a, 0x48, 0x79, 0x7b, 0xc9, 0x96, 0xe8, 0x18, 0x06, 0x89,
+      0x8c, 0xdb, 0x6d, 0x06, 0x68, 0x96, 0xd6, 0x49, 0xf9, 0x4c, 0x23, 0x5e,
+      0x66, 0x2b, 0x7a, 0xac, 0x07, 0x09, 0xe6, 0xb9, 0x23, 0xb0, 0xed, 0xfb,
+      0x02, 0xed, 0x15, 0x69, 0xfd, 0x7b, 0xae, 0xd0, 0x98, 0xfa, 0xcd, 0x24,
+      0x28, 0xef, 0x5b, 0x1e, 0x6a, 0xc9, 0x6d, 0x5d, 0x40, 0x09, 0xed, 0xb9},
+     {0x00, 0x00, 0x7e, 0x39, 0x99, 0xb2, 0x57, 0x19, 0x98, 0xe8, 0x6b, 0x39,
+      0x58, 0x68, 0xc6, 0xa8, 0x27, 0x7a, 0x0f, 0x63, 0xf0, 0xf4, 0xee, 0x0e,
+      0x37, 0x48, 0xee, 0xd9, 0xce, 0xc5, 0xf5, 0x52, 0x36, 0x91, 0x45, 0x59,
+      0x8f, 0xed, 0x59, 0xf7, 0x4a, 0x9f, 0xbe, 0x88, 0xf7, 0x86, 0x87, 0x00,
+      0x58, 0x8a, 0x22, 0xe8, 0x62, 0xf7, 0x16, 0xfe, 0xc9, 0x6f, 0xd4, 0xe3,
+      0x7e, 0x79, 0x63, 0xd4, 0x40, 0x8f, 0x49, 0x54, 0x09, 0xec, 0x9e, 0x2c,
+      0x0a, 0x71, 0x5f, 0xdc, 0xb5, 0xfb, 0x10, 0x40, 0x2c, 0xcc, 0x60, 0x07,
+      0x48, 0x0c, 0x0a, 0x54, 0x77, 0x05, 0x3b, 0x0b, 0xf8, 0xfc, 0xab, 0xf7},
+     {0x00, 0x00, 0xd2, 0xd0, 0x65, 0xee, 0x77, 0x43, 0x7b, 0xc6, 0x84, 0x15,
+      0x38, 0x6a, 0xec, 0x41, 0x89, 0x5c, 0xad, 0x75, 0x81, 0xa0, 0x0f, 0x31,
+      0xb4, 0x4e, 0xa1, 0x2a, 0x76, 0x05, 0xf8, 0x8a, 0x8e, 0xb5, 0x30, 0xeb,
+      0xab, 0x1f, 0xb1, 0xde, 0x4d, 0xcb, 0x50, 0x29, 0x47, 0xf5, 0x0f, 0xea,
+      0x8e, 0xea, 0x9d, 0xd1, 0xa3, 0x8e, 0xe9, 0xa3, 0x78, 0x5a, 0xdc, 0x19,
+      0x6d, 0xb1, 0xc9, 0x67, 0x74, 0xe0, 0x49, 0x18, 0x74, 0xce, 0xcf, 0x39,
+      0x36, 0x99, 0x7a, 0xc2, 0x6d, 0x3e, 0x08, 0xb8, 0x65, 0x2e, 0x55, 0x10,
+      0xba, 0xd3, 0x7f, 0x5f, 0x0e, 0xa6, 0x7e, 0x10, 0x6f, 0x32, 0x6e, 0x78},
+     {0x00, 0x01, 0x26, 0xd4, 0x58, 0xd9, 0x85, 0xfd, 0x09, 0xc3, 0x84, 0x82,
+      0x19, 0x42, 0x68, 0xe8, 0x6d, 0xa2, 0x07, 0x57, 0xcc, 0x2f, 0x48, 0x3f,
+      0xd2, 0xa1, 0x82, 0x53, 0x44, 0xd0, 0x90, 0x43, 0xdb, 0xbf, 0xf9, 0xd5,
+      0x77, 0x57, 0x85, 0xba, 0x4a, 0x18, 0x9d, 0xf6, 0x28, 0x61, 0x0a, 0x14,
+      0x41, 0xde, 0xb8, 0xfc, 0x87, 0x37, 0x30, 0x77, 0x28, 0xb1, 0x33, 0x89,
+      0x4e, 0x18, 0x22, 0x11, 0xe2, 0xd3, 0xc6, 0x0d, 0x10, 0x7d, 0xa3, 0x0a,
+      0xcd, 0xc3, 0xe6, 0x8e, 0xbf, 0x66, 0x64, 0xca, 0x71, 0x55, 0x06, 0xc7,
+      0x9a, 0x87, 0x9f, 0x15, 0x95, 0x23, 0x28, 0xe2, 0xcf, 0xec, 0x3e, 0x6b}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x30, 0xbb, 0xfd, 0x54, 0xc1, 0x79, 0x9f, 0xdf, 0xd2, 0xed,
+      0x35, 0x24, 0x60, 0xe4, 0xee, 0x62, 0x8f, 0x04, 0x7d, 0x1b, 0x1c, 0x95,
+      0xfa, 0x6c, 0x49, 0x6d, 0xee, 0x41, 0x0c, 0xe9, 0x6b, 0x97, 0x09, 0x8b,
+      0xdd, 0x89, 0x59, 0xe2, 0x11, 0x5d, 0xe6, 0x94, 0x36, 0xc2, 0x73, 0xc3,
+      0x31, 0x9e, 0x0e, 0xc5, 0x33, 0x8a, 0xf3, 0x6e, 0x05, 0x3c, 0xe8, 0xf4,
+      0x5c, 0xb6, 0x74, 0x18, 0x27, 0xcc, 0x51, 0xbe, 0x30, 0x3d, 0x9b, 0x34,
+      0x17, 0x45, 0xe3, 0x18, 0xb4, 0xa6, 0x56, 0x9b, 0x8a, 0x07, 0x78, 0x42,
+      0xda, 0xbb, 0x6e, 0xad, 0xd0, 0x1b, 0xd0, 0x9c, 0xa8, 0xbe, 0x5a, 0x51},
+     {0x00, 0x00, 0x03, 0xcd, 0x77, 0x65, 0x10, 0x0d, 0x6c, 0xb1, 0x27, 0x1b,
+      0x94, 0x09, 0x9a, 0x45, 0xe5, 0xbb, 0xba, 0xd4, 0xa2, 0xde, 0xc4, 0x9e,
+      0xe8, 0x29, 0x22, 0xa2, 0x7a, 0x54, 0x04, 0x2a, 0x49, 0xcc, 0x2f, 0x02,
+      0xae, 0x13, 0xe2, 0x27, 0xb5, 0x8f, 0xfb, 0x76, 0x57, 0x8e, 0x81, 0xdb,
+      0x78, 0x82, 0xb6, 0xf6, 0xc6, 0xb7, 0x39, 0x39, 0x48, 0xe1, 0x20, 0x08,
+      0xd2, 0xcc, 0xa4, 0xdd, 0x50, 0xfd, 0x1b, 0x08, 0x15, 0xf5, 0xde, 0xdd,
+      0xec, 0xa2, 0x5b, 0xf0, 0x35, 0x3a, 0xbf, 0xb0, 0x21, 0x12, 0x63, 0x33,
+      0x0a, 0xf4, 0xdd, 0xb9, 0x80, 0xf6, 0x0c, 0x4e, 0x6b, 0x02, 0x25, 0x88},
+     {0x00, 0x00, 0xdc, 0x15, 0x51, 0x71, 0x0f, 0x38, 0x3d, 0x6a, 0x07, 0x90,
+      0x11, 0xe3, 0x37, 0xba, 0x6c, 0xb7, 0x2d, 0xc1, 0xb1, 0x61, 0xca, 0x71,
+      0x80, 0xd6, 0x3f, 0x82, 0x96, 0x2b, 0xfd, 0x77, 0x50, 0x6f, 0x90, 0xd3,
+      0x7a, 0xf8, 0x58, 0xb5, 0xf0, 0x6c, 0x2e, 0x59, 0xd1, 0x60, 0x13, 0xda,
+      0x4b, 0x6a, 0x53, 0x84, 0x14, 0xe1, 0xdc, 0xfe, 0x5b, 0x02, 0x3f, 0xe2,
+      0xea, 0xe5, 0x2f, 0x85, 0x8f, 0x89, 0x99, 0x3d, 0xf8, 0xfa, 0xfc, 0x68,
+      0xa0, 0xe3, 0x21, 0xf1, 0x43, 0x5d, 0xf4, 0xaa, 0xd9, 0x29, 0x97, 0x48,
+      0x10, 0xf6, 0x1e, 0x1c, 0x62, 0xeb, 0xbe, 0x20, 0xc1, 0x6b, 0xda, 0x83},
+     {0x00, 0x00, 0x2a, 0x34, 0xf1, 0x02, 0x05, 0x5e, 0x26, 0xa4, 0x13, 0xd8,
+      0xb9, 0x9b, 0x1b, 0x08, 0x2c, 0x23, 0xba, 0xb6, 0x2d, 0x1f, 0x1b, 0x2c,
+      0xe9, 0x19, 0xb5, 0x81, 0x91, 0xf9, 0x3c, 0x35, 0xb2, 0x9d, 0x82, 0xb9,
+      0xb2, 0x34, 0x8b, 0x3f, 0xbb, 0x97, 0x1f, 0xba, 0x48, 0x8c, 0xd9, 0xab,
+      0x5c, 0xa2, 0x06, 0x6a, 0x90, 0xbe, 0xe9, 0xcd, 0x7b, 0xa1, 0x48, 0x46,
+      0x5c, 0x2a, 0xfc, 0x31, 0xa8, 0x39, 0x3a, 0x8d, 0xf8, 0xc3, 0xc1, 0xe6,
+      0xf3, 0xb9, 0x6b, 0xfd, 0x66, 0x6f, 0x92, 0x81, 0x51, 0x5b, 0xf6, 0xb9,
+      0x1e, 0xdc, 0xa3, 0xba, 0x5c, 0x23, 0x94, 0x20, 0xef, 0xd5, 0xb3, 0xfe}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x27, 0x5d, 0xc8, 0xa2, 0x9f, 0x1a, 0x4b, 0xf0, 0xfa, 0xd4,
+      0xdf, 0xfd, 0xe9, 0xa7, 0x98, 0x54, 0xd9, 0xa8, 0x1a, 0x5a, 0xbf, 0x15,
+      0xde, 0x43, 0x82, 0x15, 0x69, 0x58, 0x56, 0x8a, 0x12, 0x9c, 0x8f, 0x58,
+      0xdb, 0x4e, 0x94, 0x69, 0x60, 0xda, 0x2c, 0xe3, 0x7a, 0x1d, 0xad, 0xd5,
+      0xa5, 0xa5, 0x92, 0x44, 0x06, 0xd5, 0xed, 0xed, 0x04, 0x77, 0x41, 0x8f,
+      0x67, 0x1e, 0x56, 0x9e, 0xcd, 0xa2, 0x65, 0x70, 0x22, 0x6d, 0x4a, 0xce,
+      0x68, 0x8f, 0xab, 0x2b, 0x9b, 0x3d, 0x47, 0x42, 0x18, 0x32, 0x9b, 0xbf,
+      0x93, 0xd1, 0xc9, 0x21, 0xd8, 0x4c, 0x2a, 0xf0, 0xcd, 0x54, 0xd4, 0x4f},
+     {0x00, 0x01, 0x0e, 0x8d, 0xb9, 0x6a, 0x40, 0x05, 0x09, 0x02, 0x86, 0x4a,
+      0xa7, 0x18, 0x63, 0x27, 0x3c, 0x29, 0xb6, 0x27, 0xb3, 0xef, 0xa9, 0x80,
+      0x4a, 0xd0, 0x13, 0xab, 0x8a, 0x18, 0x5f, 0xff, 0x20, 0xd8, 0xbc, 0x37,
+      0xb8, 0x68, 0xc4, 0xd2, 0x61, 0x09, 0x22, 0xe9, 0x8c, 0x0e, 0xeb, 0xe4,
+      0x19, 0xf6, 0xd2, 0xe1, 0x91, 0x38, 0x71, 0x2c, 0x83, 0x33, 0xce, 0xec,
+      0xc2, 0xaf, 0x8e, 0xef, 0x78, 0x25, 0xd3, 0x30, 0x15, 0xa2, 0x5f, 0x2c,
+      0xf8, 0x92, 0xd1, 0x3d, 0x8e, 0x90, 0x95, 0xf7, 0x7a, 0x95, 0x31, 0xec,
+      0x7f, 0x2c, 0x04, 0x70, 0x94, 0xc6, 0x21, 0xad, 0x97, 0x87, 0x0b, 0x0e},
+     {0x00, 0x01, 0x64, 0x97, 0xe3, 0xec, 0x88, 0x8b, 0x4a, 0xb3, 0xcb, 0x27,
+      0x2c, 0xde, 0x1a, 0x9d, 0x04, 0x51, 0xed, 0xa7, 0xc8, 0x04, 0x29, 0x3a,
+      0xd3, 0x28, 0xe8, 0x6b, 0x8e, 0x17, 0xc3, 0xb9, 0xfa, 0x04, 0x5a, 0x83,
+      0x58, 0x90, 0x96, 0xa4, 0xca, 0x21, 0x49, 0xe9, 0x5d, 0x21, 0xff, 0x1f,
+      0x8a, 0x33, 0xb0, 0x33, 0x8d, 0xa5, 0xad, 0x5d, 0x04, 0xe0, 0xd1, 0xb5,
+      0x55, 0xdd, 0x0e, 0xda, 0x9b, 0xc8, 0x6e, 0x48, 0x95, 0x8f, 0x15, 0xa4,
+      0xb5, 0x6e, 0xd3, 0x22, 0x14, 0x44, 0x77, 0xdb, 0x79, 0x57, 0xaa, 0x56,
+      0xe6, 0x38, 0x2e, 0xa2, 0xa0, 0xb3, 0xc4, 0xaf, 0x90, 0xa9, 0x5f, 0xfc},
+     {0x00, 0x00, 0x68, 0x27, 0x0c, 0x84, 0xc7, 0x52, 0xbe, 0x6c, 0x90, 0x47,
+      0x8b, 0xe1, 0x46, 0xa3, 0xa6, 0x96, 0xc4, 0x23, 0x3f, 0x59, 0x30, 0xb3,
+      0x76, 0x7c, 0x20, 0x38, 0x3f, 0xd6, 0xaf, 0xa3, 0x6d, 0xb2, 0xfb, 0x86,
+      0x15, 0xea, 0xe5, 0x5e, 0x97, 0xa3, 0x9d, 0xd9, 0x55, 0x32, 0x99, 0xe2,
+      0x9a, 0x4a, 0xc2, 0xfc, 0xb7, 0x3f, 0x9d, 0xf7, 0x85, 0x9f, 0xa9, 0x66,
+      0xf8, 0xe3, 0x9f, 0x5e, 0xf8, 0x1c, 0x7f, 0xf6, 0xd4, 0x4b, 0x0c, 0x99,
+      0x91, 0x80, 0xc0, 0xfe, 0xc9, 0x00, 0x45, 0x72, 0x95, 0x5f, 0xc9, 0x49,
+      0x34, 0xd8, 0xd1, 0xdd, 0xaa, 0xc9, 0x14, 0xd9, 0x7e, 0xe7, 0xc1, 0xe1}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x8b, 0xc7, 0x74, 0x67, 0x5e, 0x19, 0x2d, 0xa1, 0x82, 0xe9,
+      0x8e, 0x62, 0x3c, 0xf3, 0x6f, 0x74, 0x9d, 0x15, 0x83, 0x29, 0xb5, 0x85,
+      0xe3, 0x34, 0xbf, 0x56, 0x9f, 0xce, 0x66, 0x17, 0x3a, 0x93, 0x1a, 0xdc,
+      0x1b, 0x03, 0x22, 0x61, 0x47, 0x33, 0xff, 0x9b, 0x7d, 0x3b, 0x94, 0x01,
+      0x7d, 0x3b, 0xb9, 0x10, 0x1b, 0x01, 0x12, 0xb0, 0x31, 0x92, 0x87, 0x21,
+      0x68, 0xac, 0xd3, 0x38, 0x4a, 0xdd, 0xd7, 0x89, 0x14, 0xa1, 0xf5, 0x4f,
+      0x95, 0x31, 0x5d, 0x97, 0xad, 0x2b, 0xe7, 0x87, 0x44, 0x85, 0x3a, 0xc7,
+      0x9b, 0x14, 0x38, 0x16, 0x69, 0x28, 0x6f, 0xbe, 0xb0, 0x10, 0xe7, 0x88},
+     {0x00, 0x01, 0x22, 0x29, 0x74, 0xbf, 0xe9, 0xc6, 0xe8, 0xdb, 0x82, 0xbe,
+      0xf0, 0xaf, 0xf2, 0x35, 0xca, 0xad, 0xdb, 0x03, 0xd8, 0x41, 0xa5, 0xf5,
+      0x55, 0x97, 0x3a, 0xc9, 0x45, 0x3e, 0x73, 0x4d, 0xf2, 0xd9, 0x86, 0x4a,
+      0x1b, 0x51, 0x26, 0x37, 0xb9, 0x29, 0x2b, 0x33, 0xef, 0x09, 0x28, 0x61,
+      0xe8, 0xc6, 0xb4, 0x9f, 0x32, 0x6d, 0xcd, 0x95, 0x80, 0xbc, 0x43, 0x22,
+      0xf3, 0x9a, 0x10, 0xb3, 0x16, 0x26, 0x6f, 0x04, 0x24, 0xe4, 0x3f, 0x30,
+      0x78, 0x82, 0x97, 0xf7, 0x18, 0xc4, 0x94, 0xbd, 0x11, 0x78, 0x05, 0x4f,
+      0xc3, 0x47, 0x39, 0x37, 0x25, 0x57, 0x87, 0x83, 0xf1, 0x58, 0x39, 0x73},
+     {0x00, 0x00, 0xca, 0x2a, 0xf0, 0x96, 0x18, 0x7c, 0x26, 0x4d, 0x6b, 0x4b,
+      0x93, 0xb9, 0x79, 0xdf, 0xb2, 0x1b, 0x9b, 0xde, 0xe3, 0xdc, 0x2e, 0x26,
+      0xc0, 0x9d, 0x81, 0x2e, 0xc0, 0x7a, 0x94, 0x67, 0x8c, 0x09, 0x33, 0x60,
+      0x11, 0xf4, 0xdd, 0xae, 0x72, 0x1c, 0x7a, 0xe9, 0x07, 0xb3, 0x1d, 0x13,
+      0xd2, 0xfb, 0x90, 0xf4, 0xf9, 0x9a, 0x62, 0xf1, 0x0f, 0xb0, 0xe0, 0xe2,
+      0xf3, 0x64, 0x99, 0x19, 0xa5, 0x13, 0x5b, 0x95, 0x51, 0xd6, 0xcb, 0x1d,
+      0xfd, 0xdc, 0xcb, 0x9a, 0x10, 0x1f, 0x60, 0x52, 0xce, 0xa9, 0x00, 0x7e,
+      0x31, 0xd9, 0x54, 0x37, 0x7a, 0x52, 0xdc, 0xef, 0x99, 0x91, 0x83, 0xd2},
+     {0x00, 0x01, 0x53, 0xfe, 0xac, 0x2a, 0x89, 0x7c, 0x25, 0x76, 0xf9, 0xd0,
+      0xda, 0x8e, 0x42, 0x58, 0xd5, 0x1f, 0xcd, 0x21, 0xe8, 0xb5, 0xa2, 0xce,
+      0x5d, 0xf4, 0x80, 0x2b, 0x83, 0xa8, 0xff, 0xbd, 0x28, 0xf7, 0x02, 0xd0,
+      0x4f, 0x14, 0x2e, 0x97, 0x07, 0x8f, 0xd9, 0x79, 0x30, 0xe1, 0x06, 0x50,
+      0xcc, 0x90, 0xb8, 0xb7, 0x33, 0x1b, 0xb9, 0xd9, 0x61, 0x3c, 0x17, 0xd9,
+      0x78, 0x57, 0x7a, 0x6e, 0x32, 0xe8, 0xb1, 0x0c, 0x50, 0x56, 0xaf, 0xc7,
+      0xc2, 0xe8, 0x15, 0x6f, 0x94, 0xcc, 0xb6, 0x0e, 0x60, 0x51, 0xdb, 0x73,
+      0xeb, 0xa7, 0x44, 0xce, 0x49, 0x51, 0x5f, 0x8a, 0xaa, 0xaf, 0xa0, 0xd3}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0xe7, 0xc3, 0x1b, 0xc6, 0x08, 0xbc, 0x36, 0x7f, 0x68, 0x9a,
+      0x9e, 0x94, 0x27, 0xb3, 0xd5, 0xc4, 0xa0, 0x5b, 0x68, 0x04, 0xce, 0x8f,
+      0xa4, 0x31, 0xd2, 0x2f, 0xd3, 0x03, 0xf5, 0x4d, 0xd2, 0xf7, 0x4b, 0xb6,
+      0xcb, 0x1f, 0xc7, 0x16, 0xba, 0x2b, 0x62, 0xcd, 0x74, 0xfe, 0x43, 0xd9,
+      0x6a, 0x52, 0xb0, 0x64, 0x6f, 0x8b, 0x67, 0x33, 0xef, 0x91, 0xc7, 0x7a,
+      0x14, 0x8c, 0x22, 0x26, 0xb7, 0x42, 0x7a, 0x6b, 0x8e, 0xb9, 0xa0, 0xd3,
+      0xc9, 0xe3, 0xef, 0x76, 0x9a, 0x61, 0xd0, 0x83, 0xbd, 0xf9, 0x88, 0xf7,
+      0x6c, 0xef, 0xc8, 0x71, 0xb3, 0xff, 0xb8, 0xd6, 0x9b, 0xb7, 0xa0, 0xbc},
+     {0x00, 0x01, 0x67, 0x43, 0xd6, 0xf7, 0x89, 0x78, 0x9b, 0xac, 0x96, 0x40,
+      0x77, 0xe9, 0x72, 0x13, 0x17, 0x6b, 0xd4, 0xff, 0x0b, 0xd9, 0x87, 0xd6,
+      0xe4, 0x47, 0xd4, 0xa8, 0x26, 0xd4, 0x65, 0x3d, 0xe9, 0xca, 0xff, 0x4d,
+      0x90, 0x20, 0xca, 0x67, 0xe6, 0x02, 0x12, 0x06, 0x70, 0xfb, 0x12, 0x79,
+      0xa1, 0x94, 0x65, 0xfc, 0xb7, 0xf6, 0x0a, 0x86, 0x4a, 0x45, 0xaa, 0x71,
+      0x19, 0xb2, 0x8c, 0xb3, 0xfe, 0x76, 0x68, 0x2e, 0xfa, 0xc8, 0x7a, 0x79,
+      0x50, 0x18, 0x0e, 0x93, 0x52, 0x62, 0xbd, 0x24, 0x2c, 0x72, 0xb5, 0xfc,
+      0xd5, 0x23, 0xc7, 0x18, 0x4d, 0x35, 0x4d, 0xe7, 0x75, 0x34, 0xa0, 0xfe},
+     {0x00, 0x01, 0x3a, 0x9a, 0x53, 0x71, 0xca, 0x3f, 0x68, 0xa9, 0x98, 0x37,
+      0xf8, 0xd9, 0x3f, 0x6a, 0x2e, 0x80, 0x82, 0x35, 0xe3, 0xb4, 0x74, 0x55,
+      0x17, 0x0d, 0x48, 0x09, 0x72, 0xe6, 0x66, 0x35, 0x41, 0x04, 0xf3, 0xcf,
+      0x65, 0xb9, 0x08, 0x87, 0xce, 0x3f, 0x69, 0xe0, 0xf2, 0xd1, 0x8c, 0x54,
+      0x5e, 0xec, 0x02, 0x87, 0x62, 0xb6, 0xcd, 0xd6, 0xfd, 0x08, 0x7e, 0xc1,
+      0x1a, 0x40, 0xca, 0x3d, 0x40, 0x1b, 0x64, 0xb9, 0xba, 0x06, 0xf2, 0xba,
+      0x8b, 0x5b, 0x47, 0x86, 0x77, 0x7d, 0x11, 0xac, 0xfc, 0xa5, 0x7e, 0x3f,
+      0x57, 0x6c, 0x07, 0x92, 0xe3, 0x95, 0xeb, 0x29, 0x9a, 0xb0, 0xed, 0xbb},
+     {0x00, 0x01, 0x80, 0x2f, 0x7b, 0x75, 0x01, 0x94, 0xf9, 0x09, 0x5c, 0xd9,
+      0xe0, 0x17, 0x08, 0xee, 0x27, 0x79, 0xd0, 0xb2, 0xf3, 0x00, 0x64, 0x7c,
+      0xb7, 0x49, 0xb3, 0xac, 0x05, 0xcd, 0xda, 0xbd, 0xb0, 0x2c, 0x58, 0x58,
+      0x03, 0x76, 0xbe, 0xe7, 0xe8, 0x22, 0x49, 0x08, 0xf1, 0x22, 0x4e, 0x6e,
+      0xb2, 0xf6, 0x1c, 0x55, 0xe7, 0x9b, 0x9a, 0x42, 0x94, 0x16, 0x03, 0xcb,
+      0x53, 0x35, 0x87, 0x8d, 0xdd, 0x0c, 0x74, 0x4c, 0x8d, 0xd9, 0x53, 0xfd,
+      0xc1, 0xe8, 0x17, 0xd3, 0x29, 0xc4, 0xb0, 0x84, 0xc0, 0x2f, 0x71, 0xf5,
+      0xfc, 0x34, 0xbe, 0x0b, 0xd6, 0x4f, 0xc8, 0xac, 0x98, 0xdb, 0x4e, 0x26}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x58, 0x6e, 0x29, 0xd4, 0x52, 0xc0, 0x16, 0xc1, 0xa1, 0x9f,
+      0x35, 0x8d, 0x32, 0xb6, 0xbd, 0x63, 0x9c, 0x41, 0x42, 0x7e, 0x83, 0x8c,
+      0xfa, 0x69, 0x98, 0x06, 0x59, 0x41, 0xa3, 0x7d, 0xd5, 0x44, 0xb4, 0x84,
+      0x36, 0xa9, 0xe2, 0x54, 0x33, 0x57, 0x96, 0xf6, 0x4d, 0x46, 0xef, 0x9d,
+      0xe7, 0x6d, 0xc9, 0x53, 0xbd, 0x9c, 0x17, 0xf3, 0x13, 0x78, 0x30, 0x53,
+      0x92, 0xea, 0xed, 0xdd, 0x85, 0x0c, 0xa1, 0x10, 0x3e, 0x15, 0x08, 0x54,
+      0xb7, 0xb1, 0x1f, 0xe6, 0xff, 0x9d, 0x5e, 0x44, 0x3a, 0xfc, 0x37, 0x91,
+      0xe9, 0xe8, 0x0e, 0x9d, 0x50, 0xe5, 0x0a, 0x92, 0xa1, 0x3a, 0x48, 0x9b},
+     {0x00, 0x00, 0x18, 0xc5, 0x78, 0x70, 0xfc, 0x60, 0xfc, 0x41, 0xde, 0x5d,
+      0x11, 0x8d, 0x50, 0xbd, 0x3e, 0x3c, 0x57, 0x89, 0x74, 0x0b, 0x79, 0x9b,
+      0xaf, 0x1b, 0x14, 0xfe, 0x9c, 0xbe, 0x8d, 0xd1, 0xc0, 0x84, 0x84, 0x73,
+      0xe3, 0xc4, 0xd0, 0xc5, 0x22, 0x0e, 0x01, 0xc6, 0x64, 0xe4, 0x14, 0xcb,
+      0x15, 0x44, 0x21, 0x82, 0xbd, 0x1a, 0xf7, 0xb9, 0x2d, 0x5a, 0x71, 0x21,
+      0xb0, 0x39, 0x49, 0x7f, 0xd1, 0x5d, 0x67, 0xd4, 0x52, 0x81, 0x75, 0x34,
+      0x62, 0xbf, 0x2d, 0x15, 0x15, 0x9c, 0xf1, 0x58, 0x06, 0xc2, 0x8f, 0x78,
+      0x3a, 0x8a, 0x36, 0x53, 0xde, 0x09, 0x7f, 0x29, 0x2b, 0x28, 0x82, 0x47},
+     {0x00, 0x00, 0x8a, 0x1d, 0x81, 0x0a, 0x79, 0xcf, 0x39, 0x7a, 0x34, 0xf3,
+      0x1c, 0xd6, 0x30, 0x70, 0x63, 0x35, 0x04, 0x10, 0x96, 0xee, 0xef, 0xc6,
+      0x9e, 0x0e, 0x58, 0x9e, 0x4b, 0x64, 0xb0, 0xd3, 0x73, 0xe0, 0x46, 0x40,
+      0x8d, 0xb5, 0x64, 0xec, 0xd1, 0x30, 0x2c, 0x30, 0x46, 0x2f, 0x34, 0x33,
+      0x95, 0xfa, 0x03, 0x6e, 0x74, 0x91, 0x9b, 0xdb, 0xf2, 0x8a, 0x67, 0xdd,
+      0xe7, 0x01, 0xc5, 0xf9, 0x94, 0xd9, 0x36, 0x97, 0xf7, 0x3b, 0x08, 0xcd,
+      0xed, 0x9b, 0xfc, 0x83, 0x1b, 0xc0, 0x6e, 0x58, 0x2d, 0x0a, 0xc3, 0x38,
+      0x47, 0x80, 0x9f, 0xc6, 0x1a, 0xea, 0xcd, 0xb7, 0x5a, 0xe1, 0x9f, 0x59},
+     {0x00, 0x01, 0x2b, 0x1b, 0x8c, 0x0c, 0x0f, 0x07, 0x43, 0x63, 0x39, 0xc5,
+      0x4d, 0x3a, 0x68, 0x9e, 0x6c, 0xc7, 0x21, 0xb2, 0x54, 0x35, 0x77, 0xcb,
+      0xe1, 0x12, 0x8c, 0xd7, 0x6a, 0xdf, 0x89, 0xeb, 0xfd, 0x76, 0x24, 0x69,
+      0xe7, 0x7c, 0x3d, 0x92, 0xc3, 0x7f, 0xf5, 0x30, 0x06, 0xc2, 0xb7, 0xcb,
+      0x30, 0x17, 0x93, 0xb5, 0x98, 0x77, 0xc2, 0x84, 0x4e, 0xbe, 0x5f, 0xfe,
+      0xc5, 0xac, 0xbd, 0xaf, 0xa0, 0x40, 0xed, 0xd4, 0xba, 0xbc, 0xbe, 0x45,
+      0x06, 0xac, 0xa9, 0x2a, 0x79, 0x0e, 0xa3, 0xa8, 0xbc, 0x9a, 0x68, 0x75,
+      0xa3, 0xaf, 0x80, 0xce, 0x05, 0x19, 0x83, 0x2d, 0x5c, 0xe2, 0xd8, 0x43}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x50, 0x42, 0x8d, 0x37, 0x8d, 0x97, 0x8a, 0x5a, 0x1e, 0x83,
+      0x8d, 0xbd, 0x3f, 0x26, 0xca, 0x32, 0x6e, 0x0a, 0x8e, 0x76, 0x5d, 0xbc,
+      0x92, 0xc6, 0xb8, 0x33, 0x53, 0xb4, 0xe3, 0x4d, 0xaf, 0xec, 0xfe, 0xd3,
+      0x8d, 0x54, 0xa5, 0xf7, 0x34, 0x17, 0x6a, 0xae, 0x12, 0x4d, 0xbe, 0x61,
+      0x31, 0x4c, 0xd2, 0x11, 0x83, 0x1f, 0x58, 0x12, 0x1c, 0x23, 0xcf, 0x3b,
+      0x09, 0x96, 0xf4, 0xa7, 0x9b, 0xcf, 0xf5, 0xae, 0x71, 0x93, 0x02, 0x87,
+      0xc9, 0x11, 0xf6, 0x12, 0x1a, 0xae, 0x02, 0x1d, 0xb2, 0xfe, 0xfe, 0x22,
+      0xa3, 0x77, 0xac, 0x32, 0xf5, 0x42, 0xb7, 0x78, 0x6a, 0x8e, 0x77, 0x3d},
+     {0x00, 0x00, 0x0b, 0xdd, 0x74, 0x6a, 0xc7, 0x0f, 0x41, 0xf4, 0xf2, 0xe6,
+      0xb3, 0xfc, 0x4a, 0x4d, 0xf8, 0xc8, 0x83, 0x64, 0x53, 0xa8, 0x3d, 0xf0,
+      0xbb, 0x4d, 0xb8, 0x77, 0x32, 0x63, 0x3f, 0xc4, 0x28, 0xa3, 0x71, 0x8b,
+      0xbb, 0x77, 0xc8, 0x04, 0x56, 0x99, 0x30, 0x37, 0x74, 0xc7, 0x35, 0x05,
+      0xcd, 0x81, 0x51, 0x72, 0xcd, 0xc5, 0xd0, 0x2a, 0x93, 0xe3, 0x89, 0x23,
+      0xb1, 0x4f, 0x5a, 0x3d, 0xcf, 0x2f, 0x38, 0x75, 0x73, 0xc5, 0x08, 0xfa,
+      0x2e, 0x2d, 0xb9, 0xdb, 0xba, 0xd2, 0x38, 0x48, 0x74, 0xb5, 0x67, 0x86,
+      0x70, 0x8d, 0x29, 0xa2, 0xfc, 0x1c, 0xa8, 0x88, 0x1e, 0xe4, 0xaa, 0x70},
+     {0x00, 0x01, 0x3f, 0x76, 0xa2, 0x1d, 0x62, 0xaa, 0xe2, 0x79, 0xd1, 0x92,
+      0x95, 0xba, 0xfa, 0x00, 0x1f, 0xbe, 0x93, 0x1f, 0x44, 0xd6, 0x32, 0xf5,
+      0x2e, 0x67, 0x4f, 0x48, 0xd1, 0x7e, 0x82, 0xe8, 0x3a, 0xeb, 0xf7, 0xf0,
+      0xd2, 0x43, 0x53, 0x81, 0xf0, 0x6d, 0x26, 0x4c, 0x81, 0x8a, 0x73, 0x63,
+      0xc9, 0x5c, 0x74, 0xfb, 0x55, 0xf6, 0xea, 0x8a, 0x6c, 0xad, 0xde, 0xbe,
+      0x3b, 0x8e, 0xf4, 0x0b, 0xe4, 0x25, 0x82, 0xff, 0x25, 0xe3, 0x4d, 0x32,
+      0x30, 0x44, 0xd6, 0x45, 0x27, 0x21, 0xbf, 0x49, 0xf2, 0x76, 0xa6, 0x0a,
+      0x38, 0x74, 0xc8, 0x66, 0x88, 0x9e, 0x83, 0xc8, 0x2d, 0xa1, 0xfd, 0xe9},
+     {0x00, 0x00, 0x3a, 0x4e, 0xfd, 0x38, 0xe3, 0x18, 0x13, 0x9b, 0x12, 0x12,
+      0x3b, 0xc0, 0x22, 0xea, 0x8d, 0xfe, 0x66, 0xd9, 0x34, 0xb8, 0x63, 0x8e,
+      0x11, 0xea, 0x84, 0x3b, 0x2c, 0x43, 0xb4, 0x0a, 0x8e, 0x3f, 0x9a, 0xd1,
+      0x51, 0xb8, 0x7d, 0x94, 0x06, 0x18, 0x82, 0xcb, 0x3e, 0x1c, 0xf0, 0xa2,
+      0xc1, 0x8c, 0x15, 0xf4, 0xb0, 0x6c, 0xb4, 0x5e, 0x2e, 0x96, 0xcf, 0xf0,
+      0xc3, 0x99, 0x59, 0x57, 0x17, 0x53, 0x8f, 0x66, 0xd4, 0x48, 0xaf, 0x4a,
+      0x11, 0x65, 0x90, 0x7d, 0xcd, 0x52, 0x8c, 0x85, 0x61, 0x00, 0xeb, 0x5e,
+      0xe3, 0xf8, 0x89, 0x0c, 0xa2, 0x6d, 0x11, 0x28, 0x6b, 0x33, 0x3d, 0x40}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x01, 0x8c, 0xb8, 0x5f, 0x43, 0x14, 0x05, 0xb4, 0x03, 0x6a, 0x12,
+      0x64, 0x2b, 0x08, 0x66, 0xab, 0xab, 0x3a, 0x99, 0x3c, 0x6c, 0x22, 0x79,
+      0x1a, 0x48, 0x39, 0x5b, 0x43, 0xfa, 0xed, 0xbd, 0xcf, 0x50, 0x11, 0xe4,
+      0x83, 0x45, 0x2f, 0xd7, 0xd2, 0xbf, 0x62, 0xb0, 0x82, 0x5a, 0x41, 0x3f,
+      0x92, 0x4b, 0x68, 0x05, 0x70, 0x70, 0x31, 0xc3, 0x62, 0x2d, 0xf9, 0xf3,
+      0x39, 0x37, 0x67, 0x80, 0x44, 0x6b, 0x9d, 0x1f, 0xea, 0xb5, 0x8b, 0xab,
+      0x20, 0x39, 0xb8, 0x30, 0x49, 0x75, 0xc5, 0xd9, 0x3e, 0x01, 0xa9, 0x9d,
+      0x88, 0xaf, 0xc3, 0x8b, 0x8b, 0x7b, 0x82, 0x50, 0x0b, 0xb6, 0x38, 0x1f},
+     {0x00, 0x01, 0x67, 0x83, 0x6a, 0x4b, 0x6e, 0x4c, 0x03, 0x25, 0x38, 0x4e,
+      0xc6, 0xee, 0xd2, 0xfd, 0x51, 0x48, 0x93, 0xe5, 0xc1, 0xdd, 0x20, 0xc7,
+      0xf4, 0x0a, 0xd7, 0x3d, 0x90, 0x25, 0xe2, 0x75, 0xe7, 0x40, 0xbd, 0x57,
+      0x4d, 0xbf, 0x66, 0x42, 0x93, 0xfc, 0xac, 0x95, 0x30, 0x07, 0xb5, 0xac,
+      0x87, 0x65, 0x89, 0xd7, 0x91, 0x1c, 0xa2, 0x54, 0x72, 0xb5, 0x44, 0xd8,
+      0x42, 0x96, 0x69, 0xc6, 0x25, 0xd1, 0xa2, 0xa3, 0xa8, 0x70, 0xab, 0xc2,
+      0x2c, 0x29, 0x94, 0x31, 0x7d, 0xbe, 0x4b, 0x26, 0x31, 0x78, 0xba, 0x3b,
+      0x8e, 0xb9, 0x5d, 0x74, 0x0a, 0xac, 0xf5, 0x5c, 0xa2, 0x82, 0xa7, 0x75},
+     {0x00, 0x00, 0xc7, 0x1f, 0xd6, 0x81, 0x86, 0x52, 0x5b, 0x32, 0x6a, 0x58,
+      0xfd, 0x93, 0x43, 0xb6, 0x26, 0x1f, 0xa1, 0xfe, 0x73, 0x77, 0x21, 0x57,
+      0x23, 0x1e, 0xa2, 0x70, 0xdd, 0x9d, 0x84, 0xef, 0xac, 0xa8, 0xe1, 0x6a,
+      0x04, 0x47, 0x87, 0x2e, 0xb6, 0xdd, 0xdb, 0x9b, 0x6e, 0x44, 0x99, 0x39,
+      0xf8, 0x95, 0xcd, 0x9a, 0x0a, 0x0a, 0x67, 0xc7, 0xb8, 0xca, 0x51, 0x73,
+      0x0a, 0x96, 0xb7, 0x99, 0x43, 0x89, 0x17, 0xc5, 0xe2, 0xe5, 0x7f, 0x39,
+      0xa1, 0xda, 0x98, 0x69, 0x7d, 0x78, 0xa7, 0x09, 0x93, 0xdf, 0xd9, 0x44,
+      0x0c, 0xa8, 0x8c, 0x7b, 0xca, 0x41, 0x9a, 0xaa, 0x00, 0x54, 0x6f, 0x02},
+     {0x00, 0x01, 0x91, 0x87, 0x19, 0xff, 0xfb, 0xe1, 0x17, 0x4f, 0x97, 0xc4,
+      0x09, 0x89, 0xc4, 0x30, 0xc9, 0x30, 0xf8, 0x15, 0xcb, 0x57, 0xa9, 0xaf,
+      0xff, 0xd8, 0x16, 0x60, 0x63, 0x60, 0xc0, 0x66, 0x49, 0x41, 0x0e, 0xd7,
+      0x54, 0x4c, 0xef, 0x6e, 0x24, 0x5a, 0x37, 0x04, 0x6e, 0xa9, 0x3f, 0x91,
+      0x27, 0x4e, 0x4c, 0x76, 0xbe, 0x98, 0xdf, 0x77, 0x41, 0xee, 0x63, 0x5c,
+      0xfa, 0x28, 0x6d, 0x9c, 0xf6, 0x0e, 0x75, 0xc8, 0x87, 0xdd, 0x44, 0xe0,
+      0x4d, 0x8d, 0xd6, 0x6c, 0x02, 0x53, 0x5e, 0x1e, 0x14, 0xc5, 0x00, 0x9f,
+      0x84, 0xc5, 0xb3, 0xa4, 0x4f, 0x13, 0x9f, 0x97, 0xc8, 0x63, 0xc4, 0x55}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x4b, 0x07, 0x4b, 0x1e, 0x73, 0x40, 0xa5, 0x72, 0x01, 0x61,
+      0x0c, 0x3c, 0x00, 0x40, 0x88, 0xdb, 0x56, 0x23, 0x2c, 0x85, 0x48, 0x98,
+      0x5e, 0x89, 0x93, 0xfc, 0x49, 0x51, 0x7d, 0xb0, 0x7c, 0x24, 0xc8, 0xde,
+      0x07, 0x80, 0x70, 0x4d, 0xd7, 0x05, 0x81, 0x22, 0x4b, 0xf4, 0x6e, 0xf3,
+      0x59, 0x4f, 0xb0, 0x3f, 0xd9, 0x40, 0x6a, 0xce, 0xcf, 0xef, 0xdd, 0x76,
+      0xd7, 0x77, 0x2d, 0xad, 0xca, 0xc7, 0xb8, 0x70, 0x9e, 0xca, 0x81, 0xfc,
+      0xc0, 0x22, 0x5e, 0x6c, 0x86, 0xe3, 0x15, 0xb0, 0x21, 0xd2, 0x67, 0x6e,
+      0x00, 0x4b, 0x82, 0x6c, 0x70, 0x30, 0x7a, 0x20, 0x4d, 0x0b, 0x9a, 0xbf},
+     {0x00, 0x00, 0x2c, 0x73, 0x4a, 0x96, 0x5e, 0x65, 0xad, 0xb5, 0xa3, 0xb9,
+      0x71, 0x4e, 0x1e, 0xb9, 0xe6, 0x5b, 0x2a, 0x23, 0xc3, 0x81, 0x08, 0xe6,
+      0x6a, 0x0c, 0xa8, 0x23, 0xd4, 0x1e, 0xb9, 0xde, 0xe1, 0x8a, 0x58, 0x83,
+      0x28, 0xca, 0x8b, 0x68, 0xdb, 0xce, 0x97, 0x42, 0x53, 0x89, 0xb0, 0x81,
+      0x83, 0x45, 0xa5, 0x4b, 0x3e, 0x2f, 0x93, 0x0c, 0x87, 0xb1, 0xc6, 0x96,
+      0xd8, 0x3a, 0x21, 0x28, 0x8c, 0xa3, 0xce, 0x97, 0xff, 0x41, 0xc3, 0x2f,
+      0xc3, 0x01, 0x43, 0x6d, 0x4c, 0xe4, 0x4a, 0x69, 0xf0, 0x11, 0x0b, 0x76,
+      0xe5, 0x26, 0xb7, 0x88, 0x8b, 0x80, 0x59, 0x58, 0x3e, 0x5a, 0x76, 0xce},
+     {0x00, 0x00, 0xc9, 0x9b, 0xb7, 0x69, 0x4c, 0x86, 0xbb, 0xaf, 0x55, 0xbe,
+      0x53, 0x32, 0x5e, 0xe9, 0xd4, 0xa2, 0xc1, 0x5a, 0xba, 0xc3, 0x9b, 0x68,
+      0x2a, 0x9d, 0xe9, 0xc5, 0x13, 0xaa, 0x91, 0x07, 0x44, 0xc3, 0xc6, 0x1a,
+      0xd4, 0xac, 0x32, 0x4a, 0x03, 0x6b, 0x47, 0x0a, 0x03, 0x3e, 0xbd, 0x40,
+      0x7d, 0xd6, 0xdd, 0xfd, 0x76, 0x59, 0xb2, 0xaa, 0x9b, 0x26, 0x9e, 0x22,
+      0xc3, 0x6b, 0x39, 0x53, 0x4a, 0xad, 0x12, 0xe1, 0xd9, 0x97, 0x35, 0xe3,
+      0xf9, 0x07, 0xf5, 0x00, 0xe4, 0x26, 0x7b, 0x7f, 0x1c, 0x15, 0x1c, 0x8e,
+      0x25, 0x53, 0x95, 0x45, 0x8a, 0x01, 0x4f, 0x9c, 0x3c, 0x0e, 0x38, 0x13},
+     {0x00, 0x01, 0xb0, 0xec, 0x44, 0x57, 0xd6, 0x55, 0x1a, 0x9d, 0xc6, 0x73,
+      0x0b, 0x90, 0x77, 0xaa, 0xbc, 0x71, 0x75, 0x7e, 0xc2, 0x35, 0xb7, 0xa7,
+      0x93, 0x16, 0xfd, 0x9e, 0x8c, 0x44, 0x70, 0x26, 0xa0, 0x24, 0x9d, 0x09,
+      0x35, 0xe0, 0x42, 0xef, 0x00, 0xca, 0xae, 0x84, 0x87, 0x77, 0x5e, 0x66,
+      0x88, 0xd7, 0xd7, 0xf1, 0x6c, 0xb1, 0xcd, 0xc7, 0x87, 0xcc, 0x11, 0xb3,
+      0xc9, 0x26, 0x75, 0xaf, 0x0a, 0x5d, 0xf3, 0x95, 0xaa, 0xe8, 0x95, 0xa2,
+      0x55, 0x98, 0xf2, 0x46, 0x70, 0x0a, 0x41, 0xbe, 0x0d, 0xcb, 0x83, 0x71,
+      0x01, 0xb0, 0x7b, 0xb1, 0x21, 0x3d, 0xd5, 0x76, 0x22, 0x4b, 0x25, 0x32}},
+    {{0x00, 0x00, 0xce, 0xf8, 0xf1, 0xaa, 0x3b, 0xb2, 0x26, 0xd8, 0x25, 0x27,
+      0x12, 0xfe, 0x04, 0x24, 0x96, 0xbf, 0xe2, 0x1c, 0xb5, 0x96, 0x77, 0x78,
+      0x05, 0x62, 0x89, 0xc8, 0xf0, 0x17, 0x8f, 0x87, 0xb9, 0x8d, 0x5f, 0xb5,
+      0x11, 0x4a, 0x4f, 0x5c, 0x1c, 0x85, 0x58, 0xce, 0x61, 0xcf, 0x39, 0x48,
+      0xd1, 0xa3, 0x06, 0x48, 0x40, 0x99, 0x8d, 0xf6, 0x32, 0x9e, 0xa9, 0x7a,
+      0xee, 0xb3, 0x0b, 0x50, 0x7c, 0x2a, 0x06, 0x42, 0xdf, 0x7a, 0x1c, 0xce,
+      0x77, 0xa9, 0x30, 0x0b, 0xb0, 0x97, 0x0e, 0x9b, 0x9f, 0x0c, 0xf8, 0xa5,
+      0x68, 0x17, 0x4a, 0xbb, 0x94, 0x20, 0xb1, 0xd0, 0x0b, 0xa6, 0x44, 0x94},
+     {0x00, 0x00, 0x63, 0xcb, 0xc7, 0x23, 0x3b, 0x2d, 0xf4, 0x01, 0x88, 0xec,
+      0xc8, 0x91, 0xe0, 0x53, 0x06, 0xe9, 0xae, 0x6d, 0x96, 0xf7, 0x3a, 0xf4,
+      0x15, 0xd3, 0x38, 0xd3, 0x1c, 0xc6, 0x5c, 0x8a, 0xc6, 0x87, 0x4d, 0xea,
+      0xb7, 0xa5, 0x54, 0x9c, 0xfa, 0xbc, 0x4c, 0xb9, 0xf3, 0x18, 0x99, 0x41,
+      0xa2, 0xe6, 0xb2, 0x9d, 0xec, 0xe6, 0x98, 0xcd, 0xaf, 0x66, 0x2d, 0x27,
+      0x3a, 0x44, 0x60, 0x4a, 0xf4, 0xb6, 0x2f, 0x7a, 0x03, 0xd5, 0x8c, 0xe4,
+      0xc8, 0x05, 0x3b, 0x26, 0xfb, 0xa1, 0x61, 0x48, 0x4f, 0x42, 0x1b, 0xd6,
+      0x6a, 0x8b, 0xf6, 0x8a, 0x3b, 0x53, 0xe0, 0x99, 0xa3, 0x88, 0x0f, 0xb5},
+     {0x00, 0x01, 0x04, 0x7c, 0x1a, 0x7d, 0x6e, 0x84, 0xf0, 0xa8, 0x2e, 0x2c,
+      0xd1, 0x4f, 0xc5, 0x00, 0xc3, 0x2d, 0x53, 0x1b, 0x69, 0xd9, 0x22, 0xe7,
+      0x51, 0xd7, 0x46, 0x7a, 0x24, 0xab, 0x21, 0x11, 0x69, 0xb1, 0x9d, 0x2c,
+      0xdc, 0x9e, 0x78, 0x09, 0x9c, 0x6b, 0xa2, 0x60, 0x00, 0x55, 0x8a, 0x39,
+      0xa8, 0xc0, 0x2b, 0x44, 0x00, 0xb3, 0x2e, 0x30, 0x17, 0xa2, 0x6b, 0xed,
+      0x49, 0x02, 0x53, 0xc9, 0xaf, 0xfb, 0xd7, 0xca, 0xcd, 0x51, 0x51, 0x20,
+      0x13, 0x10, 0x67, 0xc3, 0x04, 0x14, 0x5f, 0xd4, 0x4e, 0xf0, 0xf6, 0x2d,
+      0xe7, 0x44, 0xa3, 0x65, 0x15, 0x58, 0x99, 0x4d, 0xf1, 0x8b, 0xa9, 0x97},
+     {0x00, 0x01, 0x2f, 0x8c, 0x9e, 0x89, 0xcd, 0x08, 0x79, 0x2a, 0xc3, 0x69,
+      0x60, 0x3a, 0x16, 0x11, 0x34, 0x05, 0x75, 0x5c, 0x66, 0x3c, 0x88, 0x7a,
+      0x8a, 0x81, 0x18, 0xa9, 0x89, 0x56, 0x36, 0xa5, 0xca, 0xe8, 0x79, 0x9a,
+      0x11, 0xd8, 0xef, 0x3c, 0x13, 0x14, 0x4c, 0x05, 0x04, 0x51, 0x7a, 0xd2,
+      0x07, 0x23, 0xcb, 0x6f, 0xee, 0x90, 0xf1, 0xfb, 0xac, 0x77, 0x95, 0x1b,
+      0x14, 0xce, 0x20, 0x19, 0xb4, 0xab, 0x61, 0xfb, 0xa4, 0x9d, 0xc1, 0xb8,
+      0x98, 0xf3, 0x37, 0x55, 0xa0, 0xff, 0xf9, 0x76, 0x3d, 0xff, 0x15, 0x49,
+      0x19, 0x66, 0x81, 0xf8, 0x04, 0x4b, 0x22, 0x32, 0x09, 0x34, 0xa7, 0x49},
+     {0x00, 0x00, 0xe0, 0xaa, 0xe7, 0xa2, 0x79, 0xcc, 0x3e, 0x2a, 0x4d, 0xb3,
+      0x09, 0xa0, 0x18, 0xdf, 0x26, 0x53, 0x77, 0x82, 0xca, 0xbc, 0xe7, 0x0c,
+      0x46, 0xf6, 0x2d, 0xb2, 0x19, 0xc7, 0x5e, 0x05, 0x27, 0x3d, 0x93, 0x44,
+      0x4c, 0x62, 0x57, 0xa5, 0x7a, 0xa4, 0xa9, 0x3f, 0x83, 0x1b, 0x4a, 0xb5,
+      0xd4, 0x32, 0x0c, 0x13, 0xc3, 0x3b, 0x43, 0xa1, 0x4d, 0x37, 0x98, 0x0f,
+      0x65, 0x98, 0xfb, 0xaa, 0x40, 0xa4, 0xaa, 0x81, 0xb0, 0x19, 0xaa, 0x2c,
+      0x54, 0xf5, 0x66, 0x5d, 0xa6, 0x49, 0xf6, 0x67, 0x73, 0xf6, 0x14, 0x54,
+      0x15, 0x76, 0xdd, 0xc2, 0xb8, 0x9f, 0x2a, 0xaa, 0x63, 0x09, 0xd6, 0x75}}};
+#endif
+
+// fnv-1a of the tables above, as built, see poseidon_tables_ok
+#if defined(CODA_HOST)
+#define poseidon_tables_checksum 0xe1a40ff5
+#else
+#define poseidon_tables_checksum 0x012740b1
+#endif
+
+static inline unsigned int poseidon_tables_sum(void) {
+  unsigned int h = tables_checksum_init;
+  h = tables_checksum(h, &full_round_keys, sizeof(full_round_keys));
+  h = tables_checksum(h, &MDS_U, sizeof(MDS_U));
+  h = tables_checksum(h, &MDS_L, sizeof(MDS_L));
+  h = tables_checksum(h, &partial_round_keys, sizeof(partial_round_keys));
+  h = tables_checksum(h, &MDS_pre, sizeof(MDS_pre));
+  h = tables_checksum(h, &MDS_sparse, sizeof(MDS_sparse));
+  return h;
+}
+
+#endif // POSEIDON_TABLES
@@ -22,59 +22,18 @@
 #include <stdint.h>
 #include <os.h>
 #include <os_io_seproxyhal.h>
+#include <cx.h>
 #include "crypto.h"
 #include "poseidon.h"
 #include "ux.h"
 
-static void divWW10(uint64_t u1, uint64_t u0, uint64_t *q, uint64_t *r) {
-  const uint64_t s = 60ULL;
-  const uint64_t v = 11529215046068469760ULL;
-  const uint64_t vn1 = 2684354560ULL;
-  const uint64_t _B2 = 4294967296ULL;
-  uint64_t un32 = u1<<s | u0>>(64-s);
-  uint64_t un10 = u0 << s;
-  uint64_t un1 = un10 >> 32;
-  uint64_t un0 = un10 & (_B2-1);
-  uint64_t q1 = un32 / vn1;
-  uint64_t rhat = un32 - q1*vn1;
-
-  while (q1 >= _B2) {
-    q1--;
-    rhat += vn1;
-    if (rhat >= _B2) {
-      break;
-    }
-  }
-
-  uint64_t un21 = un32*_B2 + un1 - q1*v;
-  uint64_t q0 = un21 / vn1;
-  rhat = un21 - q0*vn1;
-
-  while (q0 >= _B2) {
-    q0--;
-    rhat += vn1;
-    if (rhat >= _B2) {
-      break;
-    }
-  }
-
-  *q = q1*_B2 + q0;
-  *r = (un21*_B2 + un0 - q0*v) >> s;
-}
-
-static uint64_t quorem10(uint64_t nat[], int len) {
-  uint64_t r = 0;
-  for (int i = len - 1; i >= 0; i--) {
-    divWW10(r, nat[i], &nat[i], &r);
-  }
-  return r;
-}
-
 // what is a currency string?
 // cur2dec converts a currency value to a decimal string and
-// appends a final NUL byte. It returns the length of the string. If the value
-// is too large, it throws TXN_STATE_ERR.
-static int cur2dec(uint8_t *out, uint8_t *cur) {
+// appends a final NUL byte. It returns the length of the string, and stores
+// the value itself in val. If the value is too large, it throws
+// TXN_STATE_ERR.
+static int cur2dec(uint8_t *out, uint8_t *cur, uint64_t val[cur_limbs]) {
+  os_memset(val, 0, cur_limbs * sizeof(uint64_t));
   if (cur[0] == 0) {
     out[0] = '\0';
     return 0;
@@ -92,38 +51,40 @@ static int cur2dec(uint8_t *out, uint8_t *cur) {
   // may not be a full 8 bytes. We handle this by treating the length prefix
   // as part of the first uint64. This is safe as long as the length prefix
   // has only 1 non-zero byte, which should be enforced elsewhere.
-  uint64_t nat[32];
+  uint64_t nat[dec_limbs];
   int len = (cur[0] / 8) + ((cur[0] % 8) != 0);
   cur += 8 - (len*8 - cur[0]);
   for (int i = 0; i < len; i++) {
-    nat[len-i-1] = U8BE(cur, i*8);
+    nat[len-i-1] = val[len-i-1] = U8BE(cur, i*8);
   }
 
-  // decode digits into buf, right-to-left
-  //
-  // NOTE: buf must be large enough to hold the decimal representation of
-  // 2^144, which has 44 digits.
-  uint8_t buf[64];
-  int i = sizeof(buf);
-  buf[--i] = '\0';
-  while (len > 0) {
-    if (i <= 0) {
-      THROW(TXN_STATE_ERR);
-    }
-    buf[--i] = '0' + quorem10(nat, len);
-    // normalize nat
-    while (len > 0 && nat[len-1] == 0) {
-      len--;
-    }
-  }
+  return nat2dec(out, nat, len);
+}
 
-  // copy buf->out, trimming whitespace
-  os_memmove(out, buf+i, sizeof(buf)-i);
-  return sizeof(buf)-i-1;
+// the element being decoded is read straight out of the APDU payload at in.
+// only when an earlier APDU ended part way through it do its first bytes sit
+// in carry instead; elem tops the carry up from in so that the first n bytes
+// of the element are contiguous, and returns a pointer to them. no element
+// is longer than the carry, so asking for more means the txn is corrupt.
+static const uint8_t *elem(txn_state *txn, uint64_t n) {
+  if (n > sizeof(txn->carry)) {
+    THROW(TXN_STATE_ERR);
+  }
+  if (txn->carry_len == 0) {
+    return txn->in;
+  }
+  if (n > txn->carry_len) {
+    n -= txn->carry_len;
+    os_memmove(txn->carry + txn->carry_len, txn->in, n);
+    txn->carry_len += n;
+    txn->in += n;
+    txn->in_len -= n;
+  }
+  return txn->carry;
 }
 
 static void need_at_least(txn_state *txn, uint64_t n) {
-  if ((txn->buf_len - txn->pos) < n) {
+  if ((txn->carry_len + txn->in_len - txn->pos) < n) {
     THROW(TXN_STATE_PARTIAL);
   }
 }
@@ -134,41 +95,56 @@ static void seek(txn_state *txn, uint64_t n) {
 }
 
 static void advance(txn_state *txn) {
-  // if elem is covered, add it to the hash
-  // && txn->pos >= 96 below?
+  // if elem is covered, add it to the hash, zero padded to two scalars
   if (txn->slice_index == txn->sig_index) {
-    poseidon_2in(txn->hash_state, txn->buf, txn->buf + scalar_bytes);
+    uint16_t n = txn->pos < 2 * scalar_bytes ? txn->pos : 2 * scalar_bytes;
+    os_memmove(txn->carry, elem(txn, n), n);
+    os_memset(txn->carry + n, 0, 2 * scalar_bytes - n);
+    poseidon_absorb_many(&txn->hash_state, (const scalar *)txn->carry, 2);
   }
 
-  txn->buf_len -= txn->pos;
-  os_memmove(txn->buf, txn->buf+txn->pos, txn->buf_len);
+  // the carry never holds more than the element, so whatever is left of it
+  // is consumed from in
+  txn->in += txn->pos - txn->carry_len;
+  txn->in_len -= txn->pos - txn->carry_len;
+  txn->carry_len = 0;
   txn->pos = 0;
 }
 
 static uint64_t read_int(txn_state *txn) {
   need_at_least(txn, 8);
-  uint64_t u = U8LE(txn->buf, txn->pos);
+  uint64_t u = U8LE(elem(txn, txn->pos + 8), txn->pos);
   seek(txn, 8);
   return u;
 }
 
 // should we not make the value have a fixed length?
 static void read_currency(txn_state *txn, uint8_t *out_val) {
+  uint64_t start = txn->pos;
   uint64_t val_len = read_int(txn);
+  // the length comes from the host; nothing longer than cur_limbs limbs is
+  // a value cur2dec can use
+  if (val_len > cur_limbs * 8) {
+    THROW(TXN_STATE_ERR);
+  }
   need_at_least(txn, val_len);
   if (out_val) {
-    txn->val_len = cur2dec(out_val, txn->buf+txn->pos-8);
+    // cur2dec reads the length prefix as well as the value
+    const uint8_t *cur = elem(txn, txn->pos + val_len) + start;
+    txn->val_len = cur2dec(out_val, (uint8_t *)cur, txn->val_nat);
   }
   seek(txn, val_len);
 }
 
 static void read_key(txn_state *txn) {
-  need_at_least(txn, group_bytes);
-  seek(txn, group_bytes);
+  need_at_least(txn, affine_bytes);
+  seek(txn, affine_bytes);
 }
 
 // throws txn_decoder_state_e
 static void __txn_next_elem(txn_state *txn) {
+  uint8_t hash[32];
+
   // if we're on a slice boundary, read the next length prefix and bump the
   // element type
   PRINTF("%s:%d\n", __FILE__, __LINE__);
@@ -182,17 +158,13 @@ static void __txn_next_elem(txn_state *txn) {
     if (txn->elem_type == TXN_ELEM_MEMO) {
       PRINTF("%s:%d\n", __FILE__, __LINE__);
       // store final hash -- XXX msg isn't hashed before signing so this doesn't make sense anymore
-      poseidon_digest(txn->hash_state, txn->hash);
+      poseidon_squeeze(&txn->hash_state, txn->hash);
       THROW(TXN_STATE_FINISHED);
     }
     txn->slice_len = read_int(txn);
     txn->slice_index = 0;
     txn->elem_type++;
     advance(txn);
-
-    if ((txn->elem_type == TXN_ELEM_MEMO) && (txn->sig_index >= txn->slice_len)) {
-      THROW(TXN_STATE_ERR);
-    }
   }
 
 /*
@@ -211,7 +183,7 @@ static void __txn_next_elem(txn_state *txn) {
 
   case TXN_ELEM_IS_DELEGATION:
     PRINTF("%s:%d\n", __FILE__, __LINE__);
-    read_int(txn);                // read the first element of txn, txn.del
+    txn->del = read_int(txn) != 0; // read the first element of txn, txn.del
     advance(txn);
     txn->slice_index++;
     THROW(TXN_STATE_READY);
@@ -231,6 +203,8 @@ static void __txn_next_elem(txn_state *txn) {
 
   case TXN_ELEM_TO:
     read_key(txn);                // read 'to' key : txn->out_key
+    cx_hash_sha256(elem(txn, txn->pos), txn->pos, hash, sizeof(hash));
+    os_memmove(txn->to_tag, hash, tag_bytes);
     advance(txn);
     txn->slice_index++;
     THROW(TXN_STATE_READY);
@@ -279,32 +253,44 @@ txn_decoder_state_e txn_next_elem(txn_state *txn) {
     }
   }
   END_TRY;
-  if (txn->buf_len + 255 > sizeof(txn->buf)) {
-    // we filled the buffer to max capacity, but there still wasn't enough
-    // to decode a full element. This generally means that the txn is
-    // corrupt in some way, since elements shouldn't be very large.
-    return TXN_STATE_ERR;
+  if (result == TXN_STATE_PARTIAL) {
+    // the APDU buffer is about to be reused for the next packet, so the
+    // start of the unfinished element moves to the carry-over area.
+    if (txn->carry_len + txn->in_len > sizeof(txn->carry)) {
+      // the carry is as large as the largest element, so if it cannot hold
+      // what we have so far the txn is corrupt in some way.
+      return TXN_STATE_ERR;
+    }
+    os_memmove(txn->carry + txn->carry_len, txn->in, txn->in_len);
+    txn->carry_len += txn->in_len;
+    txn->in_len = 0;
   }
   return result;
 }
 
 void txn_init(txn_state *txn, uint16_t sig_index) {
   os_memset(txn, 0, sizeof(txn_state));
-  txn->buf_len = txn->pos = txn->slice_index = txn->slice_len = txn->val_len = 0;
+  txn->in_len = txn->carry_len = txn->pos = txn->slice_index = txn->slice_len = txn->val_len = 0;
   txn->elem_type = -1;
   txn->sig_index = sig_index;
 }
 
-void txn_update(txn_state *txn, uint8_t *in, uint8_t in_len) {
-  // the buffer should never overflow; any elements should always be drained
-  // before the next read.
-  if (txn->buf_len + in_len > sizeof(txn->buf)) {
+void txn_restart(txn_state *txn) {
+  const uint8_t *in = txn->in;
+  uint16_t in_len = txn->in_len;
+  txn_init(txn, txn->sig_index);
+  txn->in = in;
+  txn->in_len = in_len;
+}
+
+void txn_update(txn_state *txn, uint8_t *in, uint16_t in_len) {
+  // the previous packet should always be drained, or staged in the carry,
+  // before the next one arrives.
+  if (txn->in_len != 0) {
     THROW(SW_DEVELOPER_ERR);
   }
-
-  // append to the buffer
-  os_memmove(txn->buf + txn->buf_len, in, in_len);
-  txn->buf_len += in_len;
+  txn->in = in;
+  txn->in_len = in_len;
 
   // reset the seek position; if we previously threw TXN_STATE_PARTIAL, now
   // we can try decoding again from the beginning.